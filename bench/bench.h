@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * bench: Declares the micro-benchmark driver helpers
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+/* Number of values each benchmark feeds through the code under test. */
+#define BENCH_COUNT 1000000
+
+/* Number of timed rounds; the fastest round is reported. */
+#define BENCH_ROUNDS 5
+
+/* Returns the processor time used so far, in seconds. */
+double bench_now(void);
+
+/* Prints one result line as nanoseconds per value. */
+void bench_report(const char* name, unsigned long count, double seconds);
+
+void bench_argint(void);
+void bench_argdbl(void);
+void bench_argdate(void);
+void bench_argenum(void);
+void bench_argfile(void);
+void bench_argrex(void);
+void bench_list(void);
+
+#endif
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * benchall: Runs the argtable3 micro-benchmarks
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+
+static const struct {
+    const char* name;
+    void (*fn)(void);
+} benchmarks[] = {
+    {"argint", bench_argint},
+    {"argdbl", bench_argdbl},
+    {"argdate", bench_argdate},
+    {"argenum", bench_argenum},
+    {"argfile", bench_argfile},
+    {"argrex", bench_argrex},
+    {"list", bench_list},
+};
+
+double bench_now(void) {
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
+void bench_report(const char* name, unsigned long count, double seconds) {
+    printf("%-32s %10lu values %10.2f ns/value\n", name, count, seconds * 1e9 / (double)count);
+}
+
+/* Runs every benchmark, or only those named on the command line. */
+int main(int argc, char* argv[]) {
+    size_t i;
+    int j;
+
+    for (i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+        int selected = (argc < 2);
+        for (j = 1; j < argc; j++)
+            selected |= (strcmp(argv[j], benchmarks[i].name) == 0);
+        if (selected)
+            benchmarks[i].fn();
+    }
+    return 0;
+}
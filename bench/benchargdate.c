@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * benchargdate: Times compiled arg_date formats against arg_strptime
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "argtable3.h"
+#include "bench.h"
+
+char* arg_strptime(const char* buf, const char* fmt, struct tm* tm);
+
+#define BENCH_DATE_LEN 20
+
+/* Fills buf with BENCH_COUNT timestamps in the given strftime format, one every 37 seconds from 2001 on */
+static void bench_argdate_values(char* buf, const char* format) {
+    struct tm tm;
+    int i;
+
+    for (i = 0; i < BENCH_COUNT; i++) {
+        long t = 978307200L + 37L * i;
+        memset(&tm, 0, sizeof(tm));
+        tm.tm_year = 101 + (int)(t / 31536000L) % 20;
+        tm.tm_mon = (int)(t / 2592000L) % 12;
+        tm.tm_mday = 1 + (int)(t / 86400L) % 28;
+        tm.tm_hour = (int)(t / 3600L) % 24;
+        tm.tm_min = (int)(t / 60L) % 60;
+        tm.tm_sec = (int)(t % 60L);
+        strftime(buf + (size_t)i * BENCH_DATE_LEN, BENCH_DATE_LEN, format, &tm);
+    }
+}
+
+/* Times one date format through arg_strptime() and through the scanfn of arg_daten() */
+static void bench_argdate_format(const char* format, const char* strftime_format, char* values) {
+    struct arg_date* a = arg_date0(NULL, "at", format, NULL, NULL);
+    char name[64];
+    double best = 0;
+    long sum = 0;
+    int round;
+    int i;
+
+    bench_argdate_values(values, strftime_format);
+
+    /* the format string interpreted for every value, as before */
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        for (i = 0; i < BENCH_COUNT; i++) {
+            struct tm tm;
+            memset(&tm, 0, sizeof(tm));
+            if (arg_strptime(values + (size_t)i * BENCH_DATE_LEN, format, &tm))
+                sum += tm.tm_min;
+        }
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    sprintf(name, "arg_strptime \"%s\"", format);
+    bench_report(name, BENCH_COUNT, best);
+
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        for (i = 0; i < BENCH_COUNT; i++) {
+            a->hdr.resetfn(a);
+            if (a->hdr.scanfn(a, values + (size_t)i * BENCH_DATE_LEN) == 0)
+                sum += a->tmval[0].tm_min;
+        }
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    sprintf(name, "arg_date scanfn \"%s\"", format);
+    bench_report(name, BENCH_COUNT, best);
+    printf("(checksum %ld)\n", sum);
+
+    arg_freetable((void**)&a, 1);
+}
+
+void bench_argdate(void) {
+    char* values = (char*)malloc((size_t)BENCH_COUNT * BENCH_DATE_LEN);
+    if (!values)
+        return;
+
+    bench_argdate_format("%d/%m/%Y %H:%M", "%d/%m/%Y %H:%M", values);
+    bench_argdate_format("%b %d %T", "%b %d %H:%M:%S", values);
+    bench_argdate_format("%Y-%m-%d %T", "%Y-%m-%d %H:%M:%S", values);
+    free(values);
+}
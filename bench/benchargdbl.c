@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * benchargdbl: Times arg_dbl value conversion against strtod()
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argtable3.h"
+#include "bench.h"
+
+/* Fills buf with count NUL separated values in the forms typically found */
+/* on generated command lines: full precision, fixed point, scientific    */
+/* notation and plain integers.                                           */
+static char* bench_argdbl_values(char** values, int count) {
+    char* buf = malloc((size_t)count * 32);
+    char* p = buf;
+    unsigned long seed = 1;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        double d;
+        seed = (seed * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+        d = (double)seed / 2147483648.0 * 2000.0 - 1000.0;
+        values[i] = p;
+        switch (i % 4) {
+            case 0:
+                sprintf(p, "%.17g", d);
+                break;
+            case 1:
+                sprintf(p, "%.3f", d);
+                break;
+            case 2:
+                sprintf(p, "%.6e", d * 1e-9);
+                break;
+            default:
+                sprintf(p, "%d", (int)d);
+                break;
+        }
+        p += strlen(p) + 1;
+    }
+    return buf;
+}
+
+void bench_argdbl(void) {
+    char** values = malloc(BENCH_COUNT * sizeof(char*));
+    char* buf = bench_argdbl_values(values, BENCH_COUNT);
+    struct arg_dbl* a = arg_dbln(NULL, "x", "<double>", 0, BENCH_COUNT, NULL);
+    double best = 0;
+    double sum = 0;
+    int round;
+    int i;
+
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        a->hdr.resetfn(a);
+        for (i = 0; i < BENCH_COUNT; i++)
+            a->hdr.scanfn(a, values[i]);
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    for (i = 0; i < a->count; i++)
+        sum += a->dval[i];
+    bench_report("arg_dbl scanfn (mixed formats)", BENCH_COUNT, best);
+
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        for (i = 0; i < BENCH_COUNT; i++)
+            sum += strtod(values[i], NULL);
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    bench_report("strtod (reference)", BENCH_COUNT, best);
+    printf("(checksum %g, %d of %d values accepted)\n", sum, a->count, BENCH_COUNT);
+
+    arg_freetable((void**)&a, 1);
+    free(buf);
+    free(values);
+}
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * benchargenum: Times arg_enum matching against arg_rex alternatives
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "argtable3.h"
+#include "bench.h"
+
+static const char* bench_choices[] = {"none", "fast", "safe", "debug", "trace", "profile", "release", "minsize", NULL};
+
+/* Values cycle through the choices, with every fourth one rejected */
+static const char* bench_argenum_values[] = {"fast", "safe", "debug", "turbo", "trace", "profile", "release", "slow"};
+
+void bench_argenum(void) {
+    struct arg_enum* a = arg_enumn(NULL, "mode", bench_choices, NULL, 0, BENCH_COUNT, 0, NULL);
+    struct arg_rex* r = arg_rexn(NULL, "mode", "^(none|fast|safe|debug|trace|profile|release|minsize)$", NULL, 0, BENCH_COUNT, 0, NULL);
+    double best = 0;
+    long sum = 0;
+    int round;
+    int i;
+
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        a->hdr.resetfn(a);
+        for (i = 0; i < BENCH_COUNT; i++)
+            a->hdr.scanfn(a, bench_argenum_values[i % 8]);
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    for (i = 0; i < a->count; i++)
+        sum += a->idx[i];
+    bench_report("arg_enum scanfn (8 choices)", BENCH_COUNT, best);
+
+    /* the same choices as a regular expression, which arg_rex compiles per value */
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        r->hdr.resetfn(r);
+        for (i = 0; i < BENCH_COUNT; i++)
+            r->hdr.scanfn(r, bench_argenum_values[i % 8]);
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    bench_report("arg_rex scanfn (alternation)", BENCH_COUNT, best);
+    printf("(checksum %ld, %d and %d of %d values accepted)\n", sum, a->count, r->count, BENCH_COUNT);
+
+    arg_freetable((void**)&a, 1);
+    arg_freetable((void**)&r, 1);
+}
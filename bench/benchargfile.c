@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * benchargfile: Times the arg_file path split against strrchr() lookups
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argtable3.h"
+#include "bench.h"
+
+#define BENCH_PATH_LEN 48
+
+/* The basename lookup arg_file used before, with two strrchr() calls, strcmp() and strlen() */
+static const char* bench_basename(const char* filename) {
+    const char* result = strrchr(filename, '/');
+
+    result = result ? result + 1 : filename;
+    if (strcmp(".", result) == 0 || strcmp("..", result) == 0)
+        result = filename + strlen(filename);
+    return result;
+}
+
+/* The extension lookup arg_file used before, with strrchr() and up to three strlen() calls */
+static const char* bench_extension(const char* basename) {
+    const char* result = strrchr(basename, '.');
+
+    if (!result)
+        result = basename + strlen(basename);
+    if (result == basename)
+        result = basename + strlen(basename);
+    if (strlen(result) == 1)
+        result = basename + strlen(basename);
+    return result;
+}
+
+void bench_argfile(void) {
+    struct arg_file* a = arg_file0(NULL, NULL, NULL, NULL);
+    char* paths = (char*)malloc((size_t)BENCH_COUNT * BENCH_PATH_LEN);
+    double best = 0;
+    size_t sum = 0;
+    int round;
+    int i;
+
+    if (!paths) {
+        arg_freetable((void**)&a, 1);
+        return;
+    }
+
+    for (i = 0; i < BENCH_COUNT; i++)
+        sprintf(paths + (size_t)i * BENCH_PATH_LEN, "/srv/data/project%d/src/module%d.c", i % 97, i);
+
+    /* the separate lookups, plus the strlen() a caller needs for the basename length */
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        for (i = 0; i < BENCH_COUNT; i++) {
+            const char* path = paths + (size_t)i * BENCH_PATH_LEN;
+            a->hdr.resetfn(a);
+            a->filename[0] = path;
+            a->basename[0] = bench_basename(path);
+            a->extension[0] = bench_extension(a->basename[0]);
+            sum += strlen(a->basename[0]);
+        }
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    bench_report("strrchr basename+extension", BENCH_COUNT, best);
+
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        for (i = 0; i < BENCH_COUNT; i++) {
+            a->hdr.resetfn(a);
+            a->hdr.scanfn(a, paths + (size_t)i * BENCH_PATH_LEN);
+            sum += a->span[0].length - a->span[0].basename;
+        }
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    bench_report("arg_file scanfn (with spans)", BENCH_COUNT, best);
+    printf("(checksum %lu)\n", (unsigned long)sum);
+
+    free(paths);
+    arg_freetable((void**)&a, 1);
+}
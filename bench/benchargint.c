@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * benchargint: Times arg_int value conversion
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argtable3.h"
+#include "bench.h"
+
+/* Fills buf with count NUL separated values cycling through every format */
+/* arg_int accepts: decimal, signed, hex, octal, binary and size suffixes. */
+static char* bench_argint_values(char** values, int count) {
+    char* buf = malloc((size_t)count * 24);
+    char* p = buf;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        int v = (int)(((unsigned long)i * 2654435761UL) % 1000000UL);
+        values[i] = p;
+        switch (i % 8) {
+            case 0:
+                sprintf(p, "%d", v);
+                break;
+            case 1:
+                sprintf(p, "-%d", v);
+                break;
+            case 2:
+                sprintf(p, "0x%X", (unsigned int)v);
+                break;
+            case 3:
+                sprintf(p, "-0x%x", (unsigned int)v);
+                break;
+            case 4:
+                sprintf(p, "0o%o", (unsigned int)v);
+                break;
+            case 5:
+                sprintf(p, "0b%d%d%d%d%d%d%d%d", (v >> 7) & 1, (v >> 6) & 1, (v >> 5) & 1, (v >> 4) & 1, (v >> 3) & 1, (v >> 2) & 1,
+                        (v >> 1) & 1, v & 1);
+                break;
+            case 6:
+                sprintf(p, "%dKB", v % 2000);
+                break;
+            default:
+                sprintf(p, " +%dMB ", v % 2000);
+                break;
+        }
+        p += strlen(p) + 1;
+    }
+    return buf;
+}
+
+void bench_argint(void) {
+    char** values = malloc(BENCH_COUNT * sizeof(char*));
+    char* buf = bench_argint_values(values, BENCH_COUNT);
+    struct arg_int* a = arg_intn(NULL, "x", "<int>", 0, BENCH_COUNT, NULL);
+    double best = 0;
+    long sum = 0;
+    int round;
+    int i;
+
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        a->hdr.resetfn(a);
+        for (i = 0; i < BENCH_COUNT; i++)
+            a->hdr.scanfn(a, values[i]);
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    for (i = 0; i < a->count; i++)
+        sum += a->ival[i];
+    bench_report("arg_int scanfn (mixed formats)", BENCH_COUNT, best);
+
+    /* plain strtol() on the same strings as a point of reference */
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        for (i = 0; i < BENCH_COUNT; i++)
+            sum += strtol(values[i], NULL, 0);
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    bench_report("strtol base 0 (reference)", BENCH_COUNT, best);
+    printf("(checksum %ld, %d of %d values accepted)\n", sum, a->count, BENCH_COUNT);
+
+    arg_freetable((void**)&a, 1);
+    free(buf);
+    free(values);
+}
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * benchargrex: Times arg_rex matching on values it mostly rejects
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "argtable3.h"
+#include "bench.h"
+
+/* Values for a file name pattern, with seven of every eight rejected */
+static const char* bench_argrex_files[] = {"img-1.raw", "img-2.png", "image-3.raw", "img-4.raw.bak", "tmp-5.raw", "img-6.RAW", "img-.raw", "raw"};
+
+/* Values for an address pattern, with seven of every eight rejected */
+static const char* bench_argrex_mails[] = {"bob@example.com", "bob.example.com", "alice", "carol at example.com", "dave@example", "eve", "mallory.com", "trent"};
+
+/* Times scanfn over the values, returning the number accepted in the fastest round */
+static int bench_argrex_run(const char* name, const char* pattern, const char** values) {
+    struct arg_rex* r = arg_rexn(NULL, "value", pattern, NULL, 0, BENCH_COUNT, 0, NULL);
+    double best = 0;
+    int count;
+    int round;
+    int i;
+
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        r->hdr.resetfn(r);
+        for (i = 0; i < BENCH_COUNT; i++)
+            r->hdr.scanfn(r, values[i % 8]);
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    bench_report(name, BENCH_COUNT, best);
+    count = r->count;
+    arg_freetable((void**)&r, 1);
+    return count;
+}
+
+void bench_argrex(void) {
+    int files;
+    int mails;
+
+    /* most values fail the literal prefix or suffix of the pattern */
+    files = bench_argrex_run("arg_rex scanfn (prefix, suffix)", "^img-[0-9]+\\.raw$", bench_argrex_files);
+
+    /* most values lack the one byte every match contains */
+    mails = bench_argrex_run("arg_rex scanfn (required byte)", "[a-z]+@[a-z]+\\.com", bench_argrex_mails);
+
+    printf("(%d and %d of %d values accepted)\n", files, mails, BENCH_COUNT);
+}
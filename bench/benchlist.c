@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * benchlist: Times the splitting of list-valued options
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argtable3.h"
+#include "bench.h"
+
+/* Returns a single comma separated value holding count integers */
+static char* bench_list_value(int count) {
+    char* buf = malloc((size_t)count * 12 + 1);
+    char* p = buf;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        int v = (int)(((unsigned long)i * 2654435761UL) % 1000000UL);
+        p += sprintf(p, i ? ",%d" : "%d", v);
+    }
+    return buf;
+}
+
+void bench_list(void) {
+    char* value = bench_list_value(BENCH_COUNT);
+    struct arg_intlist* a = arg_intlistn(NULL, "ids", NULL, ',', 0, 1, NULL);
+    struct arg_strlist* b = arg_strlistn(NULL, "names", NULL, ',', 0, 1, NULL);
+    double best = 0;
+    long sum = 0;
+    int round;
+    int i;
+
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        a->hdr.resetfn(a);
+        a->hdr.scanfn(a, value);
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    for (i = 0; i < a->nvals; i++)
+        sum += a->ival[i];
+    bench_report("arg_intlist scanfn", BENCH_COUNT, best);
+
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        b->hdr.resetfn(b);
+        b->hdr.scanfn(b, value);
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    bench_report("arg_strlist scanfn", BENCH_COUNT, best);
+
+    /* splitting an arg_str value by hand, with one allocation per element */
+    for (round = 0; round < BENCH_ROUNDS; round++) {
+        double t0 = bench_now();
+        double t;
+        const char* p = value;
+        for (i = 0; i < BENCH_COUNT; i++) {
+            size_t len = strcspn(p, ",");
+            char* elem = malloc(len + 1);
+            memcpy(elem, p, len);
+            elem[len] = '\0';
+            sum += strtol(elem, NULL, 0);
+            free(elem);
+            p += len + (p[len] != '\0');
+        }
+        t = bench_now() - t0;
+        if (round == 0 || t < best)
+            best = t;
+    }
+    bench_report("hand split + strtol (reference)", BENCH_COUNT, best);
+    printf("(checksum %ld, %d and %d elements)\n", sum, a->nvals, b->nvals);
+
+    arg_freetable((void**)&a, 1);
+    arg_freetable((void**)&b, 1);
+    free(value);
+}
@@ -0,0 +1,14479 @@
+/*******************************************************************************
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 1998-2001,2003-2011,2013 Stewart Heitmann
+ * <sheitmann@users.sourceforge.net>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+/* arg_glob uses lstat() and d_type, which strict C modes hide */
+#if !defined(_WIN32) && !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE 700
+#endif
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE
+#endif
+
+#include "argtable3.h"
+
+#define ARG_AMALGAMATION
+
+/*******************************************************************************
+ * argtable3_private: Declares private types, constants, and interfaces
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2019 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#ifndef ARG_UTILS_H
+#define ARG_UTILS_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef ARG_ENABLE_TRACE
+#define ARG_ENABLE_TRACE 0
+#endif /* ARG_ENABLE_TRACE */
+
+#ifndef ARG_ENABLE_LOG
+#define ARG_ENABLE_LOG 1
+#endif /* ARG_ENABLE_LOG */
+
+/* Use the embedded getopt as the system getopt(3) */
+#ifndef ARG_REPLACE_GETOPT
+#define ARG_REPLACE_GETOPT 1
+#endif /* ARG_REPLACE_GETOPT */
+
+/* Size of the buffer pre-allocated for dynamic strings.
+ * If the length exceeds this size, the buffer will be dynamically allocated.
+ */
+#ifndef ARG_DSTR_SIZE
+#define ARG_DSTR_SIZE 200
+#endif /* ARG_DSTR_SIZE */
+
+/* Run worker pool tasks on background threads.
+ * If disabled, tasks are executed on the thread that waits for them.
+ */
+#ifndef ARG_ENABLE_THREADS
+#define ARG_ENABLE_THREADS 0
+#endif /* ARG_ENABLE_THREADS */
+
+/* storage class of state that each thread keeps its own copy of */
+#if !ARG_ENABLE_THREADS
+#define ARG_TLS
+#elif defined(_MSC_VER)
+#define ARG_TLS __declspec(thread)
+#else
+#define ARG_TLS __thread
+#endif
+
+/* Use memory-mapped I/O to read script, response and configuration files,
+ * and the contents of file arguments.
+ * If disabled, or if a file cannot be mapped, the file is read into the heap.
+ */
+#ifndef ARG_ENABLE_MMAP
+#if defined(_WIN32) || defined(__unix__) || defined(__APPLE__)
+#define ARG_ENABLE_MMAP 1
+#else
+#define ARG_ENABLE_MMAP 0
+#endif
+#endif /* ARG_ENABLE_MMAP */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+    ARG_ERR_MINCOUNT = 1,
+    ARG_ERR_MAXCOUNT,
+    ARG_ERR_BADINT,
+    ARG_ERR_OVERFLOW,
+    ARG_ERR_BADDOUBLE,
+    ARG_ERR_BADDATE,
+    ARG_ERR_REGNOMATCH,
+    ARG_ERR_BADENUM,
+    ARG_ERR_FILESTAT,
+    ARG_ERR_FILETYPE,
+    ARG_ERR_FILEACCESS,
+    ARG_ERR_GLOBNOMATCH,
+    ARG_ERR_GLOBLIMIT
+};
+
+typedef void(arg_panicfn)(const char* fmt, ...);
+
+#if defined(_MSC_VER)
+#define ARG_TRACE(x)                                               \
+    __pragma(warning(push)) __pragma(warning(disable : 4127)) do { \
+        if (ARG_ENABLE_TRACE)                                      \
+            dbg_printf x;                                          \
+    }                                                              \
+    while (0)                                                      \
+    __pragma(warning(pop))
+
+#define ARG_LOG(x)                                                 \
+    __pragma(warning(push)) __pragma(warning(disable : 4127)) do { \
+        if (ARG_ENABLE_LOG)                                        \
+            dbg_printf x;                                          \
+    }                                                              \
+    while (0)                                                      \
+    __pragma(warning(pop))
+#else
+#define ARG_TRACE(x)          \
+    do {                      \
+        if (ARG_ENABLE_TRACE) \
+            dbg_printf x;     \
+    } while (0)
+
+#define ARG_LOG(x)          \
+    do {                    \
+        if (ARG_ENABLE_LOG) \
+            dbg_printf x;   \
+    } while (0)
+#endif
+
+/*
+ * Rename a few generic names to unique names.
+ * They can be a problem for the platforms like NuttX, where
+ * the namespace is flat for everything including apps and libraries.
+ */
+#define	xmalloc argtable3_xmalloc
+#define	xcalloc argtable3_xcalloc
+#define	xrealloc argtable3_xrealloc
+#define	xfree argtable3_xfree
+
+extern void dbg_printf(const char* fmt, ...);
+extern void arg_set_panic(arg_panicfn* proc);
+extern void* xmalloc(size_t size);
+extern void* xcalloc(size_t count, size_t size);
+extern void* xrealloc(void* ptr, size_t size);
+extern void xfree(void* ptr);
+
+/*
+ * A private, writable view of a file's contents. The byte at data[len] is
+ * always a writable '\0', so the contents can be tokenized in place.
+ */
+typedef struct arg_mmap {
+    char* data;
+    size_t len;
+    int mapped; /* non-zero if data is a memory mapping rather than a heap buffer */
+} arg_mmap_t;
+
+/**
+ * @brief Map a file into memory, falling back to reading it into the heap.
+ *
+ * @param   map   the view to initialize
+ * @param   path  the file to map
+ * @return        zero on success, non-zero if the file could not be read
+ */
+int arg_mmap_open(arg_mmap_t* map, const char* path);
+
+/**
+ * @brief Read a stream, such as stdin, to its end into a heap buffer.
+ *
+ * @param   map   the view to initialize
+ * @param   fp    the stream to read
+ * @return        zero on success, non-zero on a read error
+ */
+int arg_mmap_read(arg_mmap_t* map, FILE* fp);
+
+/**
+ * @brief Initialize a view with a heap copy of the given buffer.
+ */
+void arg_mmap_copy(arg_mmap_t* map, const char* buf, size_t len);
+
+/**
+ * @brief Release the memory behind a view. Safe to call on a zeroed view.
+ */
+void arg_mmap_close(arg_mmap_t* map);
+
+/*
+ * In-place scanner for shell-like words. Words are separated by unquoted
+ * white space; single quotes preserve everything literally, double quotes
+ * honour backslash escapes for '"', '\\' and newlines, and an unquoted
+ * backslash escapes any character (a backslash-newline joins two lines).
+ * Unquoted text is compacted over the quote and escape characters and each
+ * word is null-terminated inside the buffer, so no memory is allocated.
+ * An unterminated quote extends to the end of the input.
+ */
+typedef struct arg_scanner {
+    char* p;      /* current read position */
+    char* end;    /* end of the buffer, *end must be writable */
+    int line;     /* line on which the last word started, 1-based */
+    int newline;  /* non-zero if an unescaped line break precedes the last word */
+    int comments; /* if non-zero, '#' at the start of a word comments out the rest of the line */
+    int pending;  /* line breaks inside or right after the last word, not yet counted */
+    int eol;      /* non-zero if the last word was delimited by a line break */
+    int quoted;   /* non-zero if the first character of the last word was quoted or escaped */
+} arg_scanner_t;
+
+void arg_scanner_init(arg_scanner_t* s, char* buf, size_t len, int comments);
+
+/**
+ * @brief Scan the next word.
+ *
+ * @param   s     the scanner
+ * @param   word  receives the null-terminated word
+ * @return        non-zero if a word was found, zero at the end of the input
+ */
+int arg_scan_word(arg_scanner_t* s, char** word);
+
+/**
+ * @brief Return a monotonic timestamp in seconds, for measuring intervals.
+ */
+double arg_clock(void);
+
+/**
+ * @brief Scan the magnitude and sign of an integer argument value.
+ *
+ * Accepts the `arg_int` grammar: an optional sign, an optional `0x`, `0o` or
+ * `0b` radix prefix, the digits and an optional `KB`, `MB` or `GB` suffix
+ * (also `TB` if `tb` is non-zero), surrounded by optional white space.
+ *
+ * @param   str   the null-terminated value to scan
+ * @param   tb    non-zero to accept the `TB` suffix
+ * @param   mag   receives the magnitude, including the suffix multiplier
+ * @param   neg   receives non-zero if the value is negative
+ * @return        0 on success, ARG_ERR_BADINT if `str` is malformed, or
+ *                ARG_ERR_OVERFLOW if the magnitude does not fit in 64 bits
+ */
+int arg_int_scanmag(const char* str, int tb, uint64_t* mag, int* neg);
+
+/**
+ * @brief Convert decimal text to the nearest double, ignoring the locale.
+ *
+ * Accepts the same text as strtod(), but always uses '.' as the decimal
+ * point. Decimal input is converted without calling the C library in all
+ * but rare cases.
+ *
+ * @param   str     the null-terminated text to convert
+ * @param   endptr  if not NULL, receives a pointer past the converted text,
+ *                  or `str` if no conversion could be performed
+ * @return          the converted value
+ */
+double arg_strtod(const char* str, char** endptr);
+
+struct arg_hashtable_entry {
+    void *k, *v;
+    unsigned int h;
+    struct arg_hashtable_entry* next;
+};
+
+typedef struct arg_hashtable {
+    unsigned int tablelength;
+    struct arg_hashtable_entry** table;
+    unsigned int entrycount;
+    unsigned int loadlimit;
+    unsigned int primeindex;
+    unsigned int (*hashfn)(const void* k);
+    int (*eqfn)(const void* k1, const void* k2);
+    int freekeys; /* keys are freed with their entries (default) */
+} arg_hashtable_t;
+
+/**
+ * @brief Create a hash table.
+ *
+ * @param   minsize   minimum initial size of hash table
+ * @param   hashfn    function for hashing keys
+ * @param   eqfn      function for determining key equality
+ * @return            newly created hash table or NULL on failure
+ */
+arg_hashtable_t* arg_hashtable_create(unsigned int minsize, unsigned int (*hashfn)(const void*), int (*eqfn)(const void*, const void*));
+
+/**
+ * @brief This function will cause the table to expand if the insertion would take
+ * the ratio of entries to table size over the maximum load factor.
+ *
+ * This function does not check for repeated insertions with a duplicate key.
+ * The value returned when using a duplicate key is undefined -- when
+ * the hash table changes size, the order of retrieval of duplicate key
+ * entries is reversed.
+ * If in doubt, remove before insert.
+ *
+ * @param   h   the hash table to insert into
+ * @param   k   the key - hash table claims ownership and will free on removal
+ * @param   v   the value - does not claim ownership
+ * @return      non-zero for successful insertion
+ */
+void arg_hashtable_insert(arg_hashtable_t* h, void* k, void* v);
+
+#define ARG_DEFINE_HASHTABLE_INSERT(fnname, keytype, valuetype) \
+    int fnname(arg_hashtable_t* h, keytype* k, valuetype* v) { return arg_hashtable_insert(h, k, v); }
+
+/**
+ * @brief Search the specified key in the hash table.
+ *
+ * @param   h   the hash table to search
+ * @param   k   the key to search for  - does not claim ownership
+ * @return      the value associated with the key, or NULL if none found
+ */
+void* arg_hashtable_search(arg_hashtable_t* h, const void* k);
+
+#define ARG_DEFINE_HASHTABLE_SEARCH(fnname, keytype, valuetype) \
+    valuetype* fnname(arg_hashtable_t* h, keytype* k) { return (valuetype*)(arg_hashtable_search(h, k)); }
+
+/**
+ * @brief Remove the specified key from the hash table.
+ *
+ * @param   h   the hash table to remove the item from
+ * @param   k   the key to search for  - does not claim ownership
+ */
+void arg_hashtable_remove(arg_hashtable_t* h, const void* k);
+
+#define ARG_DEFINE_HASHTABLE_REMOVE(fnname, keytype, valuetype) \
+    void fnname(arg_hashtable_t* h, keytype* k) { arg_hashtable_remove(h, k); }
+
+/**
+ * @brief Return the number of keys in the hash table.
+ *
+ * @param   h   the hash table
+ * @return      the number of items stored in the hash table
+ */
+unsigned int arg_hashtable_count(arg_hashtable_t* h);
+
+/**
+ * @brief Change the value associated with the key.
+ *
+ * function to change the value associated with a key, where there already
+ * exists a value bound to the key in the hash table.
+ * Source due to Holger Schemel.
+ *
+ * @name        hashtable_change
+ * @param   h   the hash table
+ * @param       key
+ * @param       value
+ */
+int arg_hashtable_change(arg_hashtable_t* h, void* k, void* v);
+
+/**
+ * @brief Free the hash table and the memory allocated for each key-value pair.
+ *
+ * @param   h            the hash table
+ * @param   free_values  whether to call 'free' on the remaining values
+ */
+void arg_hashtable_destroy(arg_hashtable_t* h, int free_values);
+
+typedef struct arg_hashtable_itr {
+    arg_hashtable_t* h;
+    struct arg_hashtable_entry* e;
+    struct arg_hashtable_entry* parent;
+    unsigned int index;
+} arg_hashtable_itr_t;
+
+arg_hashtable_itr_t* arg_hashtable_itr_create(arg_hashtable_t* h);
+
+void arg_hashtable_itr_destroy(arg_hashtable_itr_t* itr);
+
+/**
+ * @brief Return the value of the (key,value) pair at the current position.
+ */
+extern void* arg_hashtable_itr_key(arg_hashtable_itr_t* i);
+
+/**
+ * @brief Return the value of the (key,value) pair at the current position.
+ */
+extern void* arg_hashtable_itr_value(arg_hashtable_itr_t* i);
+
+/**
+ * @brief Advance the iterator to the next element. Returns zero if advanced to end of table.
+ */
+int arg_hashtable_itr_advance(arg_hashtable_itr_t* itr);
+
+/**
+ * @brief Remove current element and advance the iterator to the next element.
+ */
+int arg_hashtable_itr_remove(arg_hashtable_itr_t* itr);
+
+/**
+ * @brief Search and overwrite the supplied iterator, to point to the entry matching the supplied key.
+ *
+ * @return  Zero if not found.
+ */
+int arg_hashtable_itr_search(arg_hashtable_itr_t* itr, arg_hashtable_t* h, void* k);
+
+#define ARG_DEFINE_HASHTABLE_ITERATOR_SEARCH(fnname, keytype) \
+    int fnname(arg_hashtable_itr_t* i, arg_hashtable_t* h, keytype* k) { return (arg_hashtable_iterator_search(i, h, k)); }
+
+typedef void(arg_taskfn)(void* arg);
+
+enum { ARG_TASK_QUEUED = 1, ARG_TASK_RUNNING, ARG_TASK_DONE };
+
+/*
+ * A unit of work for the worker pool. The storage is owned by the caller and
+ * must stay valid until arg_tpool_join() returns for the task.
+ */
+typedef struct arg_task {
+    arg_taskfn* fn;
+    void* arg;
+    int state;
+    struct arg_task* next;
+} arg_task_t;
+
+typedef struct arg_tpool arg_tpool_t;
+
+/**
+ * @brief Create a worker pool.
+ *
+ * @param   nthreads  number of worker threads, 0 runs every task on the
+ *                    thread that joins it
+ * @return            newly created worker pool
+ */
+arg_tpool_t* arg_tpool_create(int nthreads);
+
+/**
+ * @brief Run any tasks still queued, stop the workers and free the pool.
+ */
+void arg_tpool_destroy(arg_tpool_t* pool);
+
+/**
+ * @brief Return the number of worker threads actually running in the pool.
+ */
+int arg_tpool_size(arg_tpool_t* pool);
+
+/**
+ * @brief Queue a task for execution.
+ *
+ * @param   pool  the worker pool
+ * @param   task  caller-owned task storage
+ * @param   fn    function to run
+ * @param   arg   argument passed to fn
+ */
+void arg_tpool_submit(arg_tpool_t* pool, arg_task_t* task, arg_taskfn* fn, void* arg);
+
+/**
+ * @brief Return non-zero if the task has finished.
+ */
+int arg_tpool_done(arg_tpool_t* pool, arg_task_t* task);
+
+/**
+ * @brief Wait until the task has finished.
+ *
+ * A task that has not been picked up by a worker yet is removed from the
+ * queue and executed on the calling thread.
+ */
+void arg_tpool_join(arg_tpool_t* pool, arg_task_t* task);
+
+/**
+ * @brief Return the number of online processors, or 1 if unknown.
+ */
+int arg_thread_ncpu(void);
+
+/**
+ * @brief Expand a glob pattern into the paths that match it.
+ *
+ * Supports '*', '?' and bracket expressions within a path component, and
+ * "**" as a whole component for any number of directories. Hidden entries
+ * only match a component that starts with a '.'. Directories of one level of
+ * the walk are read in parallel on a worker pool.
+ *
+ * @param   pattern   the pattern to expand
+ * @param   limit     the largest number of matches accepted
+ * @param   nworkers  worker threads, negative for one per processor
+ * @param   paths     receives the matches in strcmp() order, as one block
+ *                    to be released with xfree()
+ * @return            the number of matches, 0 if nothing matches, or -1 if
+ *                    there are more than limit matches, or more than limit
+ *                    paths at any level of the walk
+ */
+int arg_glob(const char* pattern, int limit, int nworkers, char*** paths);
+
+struct arg_end;
+struct arg_hdr;
+
+/**
+ * @brief Record an error in the arg_end of a table.
+ *
+ * If the arg_end is full, its last error is replaced by ARG_ELIMIT.
+ */
+void arg_register_error(struct arg_end* end, void* parent, int error, const char* argval);
+
+/**
+ * @brief Expand the response files of a command line, if the table allows it.
+ *
+ * Each argument after argv[0] of the form "@path" is replaced by the words
+ * of the file, tokenized in place in its mapping. Files that cannot be read
+ * or that refer to themselves are reported as errors in end.
+ *
+ * @param   end       the arg_end of the table
+ * @param   argc      number of arguments in argv
+ * @param   argv      the command line
+ * @param   expanded  receives the expanded command line, or argv if nothing
+ *                    was expanded; it stays valid until the next parse
+ * @return            the number of arguments in the expanded command line
+ */
+int arg_end_expand(struct arg_end* end, int argc, char** argv, char*** expanded);
+
+/* The optional functions of an argument, or NULL if it provides none */
+#define ARG_HDR_EXT(hdr) (((hdr)->flag & ARG_HASEXT) ? (const struct arg_hdr_ext*)(hdr)->priv : NULL)
+
+/**
+ * @brief Copy the memory block of an argument struct for its clonefn.
+ *
+ * The copy's hdr.parent points to the copy. Pointers into the block must be
+ * moved to the copy with ARG_CLONE_PTR().
+ *
+ * @param   parent  the argument struct
+ * @param   nbytes  the size of the block allocated by the constructor
+ * @return          the copy
+ */
+void* arg_clone_block(const void* parent, size_t nbytes);
+
+#define ARG_CLONE_PTR(clone, parent, ptr) ((void*)((char*)(clone) + ((const char*)(ptr) - (const char*)(parent))))
+
+/**
+ * @brief Move the environment binding of an argument to its copy.
+ *
+ * The clonefn of arg_end copies the bindings of the original arguments, which
+ * the copy of the table must then point to its own arguments.
+ */
+void arg_end_rebind(struct arg_end* end, void* from, void* to);
+
+/* A set of table entries, one bit per entry */
+typedef unsigned int arg_bits_t;
+
+#define ARG_BITS_WIDTH (sizeof(arg_bits_t) * 8)
+#define ARG_BITS_LEN(n) (((size_t)(n) + ARG_BITS_WIDTH - 1) / ARG_BITS_WIDTH)
+#define ARG_BITS_SET(bits, i) ((bits)[(size_t)(i) / ARG_BITS_WIDTH] |= 1u << ((size_t)(i) % ARG_BITS_WIDTH))
+#define ARG_BITS_CLEAR(bits, i) ((bits)[(size_t)(i) / ARG_BITS_WIDTH] &= ~(1u << ((size_t)(i) % ARG_BITS_WIDTH)))
+#define ARG_BITS_TEST(bits, i) (((bits)[(size_t)(i) / ARG_BITS_WIDTH] >> ((size_t)(i) % ARG_BITS_WIDTH)) & 1u)
+
+/**
+ * @brief Return non-zero if response files are expanded.
+ */
+int arg_end_hasrespfile(struct arg_end* end);
+
+/**
+ * @brief Return non-zero if options of the table can also be read from the
+ * environment or from configuration files.
+ */
+int arg_end_haslayers(struct arg_end* end);
+
+/**
+ * @brief Scan the options the command line left out from the other layers.
+ *
+ * The environment is indexed once, and the value of each bound option is
+ * passed to its scanfn. The configuration files are then read from the last
+ * one added to the first, each one only setting the options that no layer
+ * of higher precedence has set. Errors are recorded in end, with the file
+ * and line of errors from configuration files.
+ *
+ * @param   end    the arg_end of the table
+ * @param   table  the argument table
+ * @param   given  the table entries the command line gave, updated with the
+ *                 entries set by each layer
+ */
+void arg_end_scanlayers(struct arg_end* end, struct arg_hdr** table, arg_bits_t* given);
+
+/**
+ * @brief Return non-zero if constraints between options were registered.
+ */
+int arg_end_hasconstraints(struct arg_end* end);
+
+/**
+ * @brief Check the constraints registered with arg_end_constrain().
+ *
+ * Each constraint is evaluated by testing the bits of its options, so the
+ * cost is linear in the total size of the constraints. Violations are
+ * registered in end, with the names of the options as their argval.
+ *
+ * @param   end      the arg_end of the table
+ * @param   table    the argument table
+ * @param   present  the table entries that were given
+ */
+void arg_end_checkconstraints(struct arg_end* end, struct arg_hdr** table, const arg_bits_t* present);
+
+/**
+ * @brief Register an error from a checkfn that reports more than one error.
+ *
+ * Only valid while arg_parse() runs the post-parse checks. The error is added
+ * to the arg_end of the table being checked, with argval as its argument.
+ */
+void arg_check_error(void* parent, int error, const char* argval);
+
+/**
+ * @brief Serialize access to process-wide state such as the getopt variables.
+ */
+void arg_global_lock(void);
+void arg_global_unlock(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/*******************************************************************************
+ * arg_utils: Implements memory, panic, and other utility functions
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2019 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#undef WIN32_LEAN_AND_MEAN
+#elif ARG_ENABLE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static void panic(const char* fmt, ...);
+static arg_panicfn* s_panic = panic;
+
+void dbg_printf(const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+static void panic(const char* fmt, ...) {
+    va_list args;
+    char* s;
+
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4996)
+#endif
+    s = getenv("EF_DUMPCORE");
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+    if (s != NULL && *s != '\0') {
+        abort();
+    } else {
+        exit(EXIT_FAILURE);
+    }
+}
+
+void arg_set_panic(arg_panicfn* proc) {
+    s_panic = proc;
+}
+
+void* xmalloc(size_t size) {
+    void* ret = malloc(size);
+    if (!ret) {
+        s_panic("Out of memory!\n");
+    }
+    return ret;
+}
+
+void* xcalloc(size_t count, size_t size) {
+    size_t allocated_count = count && size ? count : 1;
+    size_t allocated_size = count && size ? size : 1;
+    void* ret = calloc(allocated_count, allocated_size);
+    if (!ret) {
+        s_panic("Out of memory!\n");
+    }
+    return ret;
+}
+
+void* xrealloc(void* ptr, size_t size) {
+    size_t allocated_size = size ? size : 1;
+    void* ret = realloc(ptr, allocated_size);
+    if (!ret) {
+        s_panic("Out of memory!\n");
+    }
+    return ret;
+}
+
+void xfree(void* ptr) {
+    free(ptr);
+}
+
+void* arg_clone_block(const void* parent, size_t nbytes) {
+    struct arg_hdr* result = (struct arg_hdr*)xmalloc(nbytes);
+
+    memcpy(result, parent, nbytes);
+    result->parent = result;
+    return result;
+}
+
+static void merge(void* data, int esize, int i, int j, int k, arg_comparefn* comparefn) {
+    char* a = (char*)data;
+    char* m;
+    int ipos, jpos, mpos;
+
+    /* Initialize the counters used in merging. */
+    ipos = i;
+    jpos = j + 1;
+    mpos = 0;
+
+    /* Allocate storage for the merged elements. */
+    m = (char*)xmalloc((size_t)(esize * ((k - i) + 1)));
+
+    /* Continue while either division has elements to merge. */
+    while (ipos <= j || jpos <= k) {
+        if (ipos > j) {
+            /* The left division has no more elements to merge. */
+            while (jpos <= k) {
+                memcpy(&m[mpos * esize], &a[jpos * esize], (size_t)esize);
+                jpos++;
+                mpos++;
+            }
+
+            continue;
+        } else if (jpos > k) {
+            /* The right division has no more elements to merge. */
+            while (ipos <= j) {
+                memcpy(&m[mpos * esize], &a[ipos * esize], (size_t)esize);
+                ipos++;
+                mpos++;
+            }
+
+            continue;
+        }
+
+        /* Append the next ordered element to the merged elements. */
+        if (comparefn(&a[ipos * esize], &a[jpos * esize]) < 0) {
+            memcpy(&m[mpos * esize], &a[ipos * esize], (size_t)esize);
+            ipos++;
+            mpos++;
+        } else {
+            memcpy(&m[mpos * esize], &a[jpos * esize], (size_t)esize);
+            jpos++;
+            mpos++;
+        }
+    }
+
+    /* Prepare to pass back the merged data. */
+    memcpy(&a[i * esize], m, (size_t)(esize * ((k - i) + 1)));
+    xfree(m);
+}
+
+void arg_mgsort(void* data, int size, int esize, int i, int k, arg_comparefn* comparefn) {
+    int j;
+
+    /* Stop the recursion when no more divisions can be made. */
+    if (i < k) {
+        /* Determine where to divide the elements. */
+        j = (int)(((i + k - 1)) / 2);
+
+        /* Recursively sort the two divisions. */
+        arg_mgsort(data, size, esize, i, j, comparefn);
+        arg_mgsort(data, size, esize, j + 1, k, comparefn);
+        merge(data, esize, i, j, k, comparefn);
+    }
+}
+
+/* Read a whole stream into a heap buffer with one spare byte for the terminator. */
+int arg_mmap_read(arg_mmap_t* map, FILE* fp) {
+    size_t cap = 4096;
+    size_t len = 0;
+    char* buf = (char*)xmalloc(cap + 1);
+
+    for (;;) {
+        size_t n = fread(buf + len, 1, cap - len, fp);
+        len += n;
+        if (len < cap)
+            break;
+        cap *= 2;
+        buf = (char*)xrealloc(buf, cap + 1);
+    }
+
+    if (ferror(fp)) {
+        xfree(buf);
+        return -1;
+    }
+
+    buf[len] = '\0';
+    map->data = buf;
+    map->len = len;
+    map->mapped = 0;
+    return 0;
+}
+
+int arg_mmap_open(arg_mmap_t* map, const char* path) {
+    FILE* fp;
+    int err;
+
+    map->data = NULL;
+    map->len = 0;
+    map->mapped = 0;
+
+#if ARG_ENABLE_MMAP && defined(_WIN32)
+    {
+        HANDLE file, mapping;
+        LARGE_INTEGER size;
+        SYSTEM_INFO info;
+        void* view = NULL;
+
+        GetSystemInfo(&info);
+        file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file != INVALID_HANDLE_VALUE) {
+            /* the terminator lives in the zero-filled tail of the last page, so whole pages can't be mapped */
+            if (GetFileSizeEx(file, &size) && size.QuadPart > 0 && (size_t)size.QuadPart == (SIZE_T)size.QuadPart &&
+                (size.QuadPart % info.dwPageSize) != 0) {
+                mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+                if (mapping != NULL) {
+                    view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+                    CloseHandle(mapping);
+                }
+            }
+            CloseHandle(file);
+        }
+
+        if (view != NULL) {
+            map->data = (char*)view;
+            map->len = (size_t)size.QuadPart;
+            map->mapped = 1;
+            return 0;
+        }
+    }
+#elif ARG_ENABLE_MMAP
+    {
+        struct stat st;
+        void* view = MAP_FAILED;
+        long pagesize = sysconf(_SC_PAGESIZE);
+        int fd = open(path, O_RDONLY);
+
+        if (fd >= 0) {
+            /* the terminator lives in the zero-filled tail of the last page, so whole pages can't be mapped */
+            if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 && pagesize > 0 && (st.st_size % pagesize) != 0)
+                view = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            close(fd);
+        }
+
+        if (view != MAP_FAILED) {
+            map->data = (char*)view;
+            map->len = (size_t)st.st_size;
+            map->mapped = 1;
+            return 0;
+        }
+    }
+#endif
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4996)
+#endif
+    fp = fopen(path, "rb");
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+    if (fp == NULL)
+        return -1;
+
+    err = arg_mmap_read(map, fp);
+    fclose(fp);
+    return err;
+}
+
+void arg_mmap_copy(arg_mmap_t* map, const char* buf, size_t len) {
+    map->data = (char*)xmalloc(len + 1);
+    memcpy(map->data, buf, len);
+    map->data[len] = '\0';
+    map->len = len;
+    map->mapped = 0;
+}
+
+void arg_mmap_close(arg_mmap_t* map) {
+    if (map->data == NULL)
+        return;
+
+#if ARG_ENABLE_MMAP && defined(_WIN32)
+    if (map->mapped)
+        UnmapViewOfFile(map->data);
+    else
+        xfree(map->data);
+#elif ARG_ENABLE_MMAP
+    if (map->mapped)
+        munmap(map->data, map->len);
+    else
+        xfree(map->data);
+#else
+    xfree(map->data);
+#endif
+
+    map->data = NULL;
+    map->len = 0;
+    map->mapped = 0;
+}
+
+void arg_scanner_init(arg_scanner_t* s, char* buf, size_t len, int comments) {
+    s->p = buf;
+    s->end = buf + len;
+    s->line = 1;
+    s->newline = 1;
+    s->comments = comments;
+    s->pending = 0;
+    s->eol = 1;
+    s->quoted = 0;
+}
+
+#define ARG_ISBLANK(c) ((c) == ' ' || (c) == '\t' || (c) == '\r' || (c) == '\f' || (c) == '\v')
+
+int arg_scan_word(arg_scanner_t* s, char** word) {
+    char* r = s->p;
+    char* w;
+    char* end = s->end;
+    int quote = 0;
+    int plain = 0;
+
+    s->line += s->pending;
+    s->newline = s->eol;
+    s->pending = 0;
+    s->eol = 0;
+
+    /* skip white space, comments and line continuations up to the next word */
+    for (;;) {
+        while (r < end && ARG_ISBLANK(*r))
+            r++;
+        if (r == end)
+            break;
+        if (*r == '\n') {
+            s->line++;
+            s->newline = 1;
+            r++;
+        } else if (*r == '\\' && r + 1 < end && r[1] == '\n') {
+            s->line++;
+            r += 2;
+        } else if (*r == '#' && s->comments) {
+            while (r < end && *r != '\n')
+                r++;
+        } else {
+            break;
+        }
+    }
+
+    if (r == end) {
+        s->p = r;
+        return 0;
+    }
+
+    /* copy the word onto itself, dropping quotes and escapes */
+    *word = w = r;
+    while (r < end) {
+        char c = *r;
+        if (quote == '\'') {
+            if (c == '\'')
+                quote = 0;
+            else {
+                if (c == '\n')
+                    s->pending++;
+                *w++ = c;
+            }
+            r++;
+        } else if (quote == '"') {
+            if (c == '"') {
+                quote = 0;
+                r++;
+            } else if (c == '\\' && r + 1 < end && (r[1] == '"' || r[1] == '\\' || r[1] == '\n')) {
+                if (r[1] == '\n')
+                    s->pending++;
+                else
+                    *w++ = r[1];
+                r += 2;
+            } else {
+                if (c == '\n')
+                    s->pending++;
+                *w++ = c;
+                r++;
+            }
+        } else if (c == '\'' || c == '"') {
+            quote = c;
+            r++;
+        } else if (c == '\\' && r + 1 < end) {
+            if (r[1] == '\n')
+                s->pending++;
+            else
+                *w++ = r[1];
+            r += 2;
+        } else if (ARG_ISBLANK(c) || c == '\n') {
+            break;
+        } else {
+            if (w == *word)
+                plain = 1;
+            *w++ = c;
+            r++;
+        }
+    }
+    s->quoted = w > *word && !plain;
+
+    /* consume the delimiter, remembering a line break for the next word */
+    if (r < end) {
+        if (*r == '\n') {
+            s->pending++;
+            s->eol = 1;
+        }
+        r++;
+    }
+    s->p = r;
+    *w = '\0';
+
+    return 1;
+}
+
+double arg_clock(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart / (double)freq.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+/*******************************************************************************
+ * arg_thread: Implements the threading primitives and the worker pool
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <stdlib.h>
+
+#if ARG_ENABLE_THREADS
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#undef WIN32_LEAN_AND_MEAN
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
+#if ARG_ENABLE_THREADS && defined(_WIN32)
+
+typedef SRWLOCK arg_mutex_t;
+typedef CONDITION_VARIABLE arg_cond_t;
+typedef HANDLE arg_thread_t;
+
+#define ARG_MUTEX_INITIALIZER SRWLOCK_INIT
+
+static void arg_mutex_init(arg_mutex_t* m) {
+    InitializeSRWLock(m);
+}
+
+static void arg_mutex_destroy(arg_mutex_t* m) {
+    (void)m;
+}
+
+static void arg_mutex_lock(arg_mutex_t* m) {
+    AcquireSRWLockExclusive(m);
+}
+
+static void arg_mutex_unlock(arg_mutex_t* m) {
+    ReleaseSRWLockExclusive(m);
+}
+
+static void arg_cond_init(arg_cond_t* c) {
+    InitializeConditionVariable(c);
+}
+
+static void arg_cond_destroy(arg_cond_t* c) {
+    (void)c;
+}
+
+static void arg_cond_wait(arg_cond_t* c, arg_mutex_t* m) {
+    SleepConditionVariableSRW(c, m, INFINITE, 0);
+}
+
+static void arg_cond_broadcast(arg_cond_t* c) {
+    WakeAllConditionVariable(c);
+}
+
+static void arg_cond_signal(arg_cond_t* c) {
+    WakeConditionVariable(c);
+}
+
+struct arg_thread_start {
+    void (*proc)(void*);
+    void* arg;
+};
+
+static DWORD WINAPI arg_thread_main(LPVOID param) {
+    struct arg_thread_start start = *(struct arg_thread_start*)param;
+    xfree(param);
+    start.proc(start.arg);
+    return 0;
+}
+
+static int arg_thread_create(arg_thread_t* t, void (*proc)(void*), void* arg) {
+    struct arg_thread_start* start = (struct arg_thread_start*)xmalloc(sizeof(struct arg_thread_start));
+    start->proc = proc;
+    start->arg = arg;
+    *t = CreateThread(NULL, 0, arg_thread_main, start, 0, NULL);
+    if (*t == NULL) {
+        xfree(start);
+        return -1;
+    }
+    return 0;
+}
+
+static void arg_thread_join(arg_thread_t t) {
+    WaitForSingleObject(t, INFINITE);
+    CloseHandle(t);
+}
+
+int arg_thread_ncpu(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+}
+
+#elif ARG_ENABLE_THREADS
+
+typedef pthread_mutex_t arg_mutex_t;
+typedef pthread_cond_t arg_cond_t;
+typedef pthread_t arg_thread_t;
+
+#define ARG_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+
+static void arg_mutex_init(arg_mutex_t* m) {
+    pthread_mutex_init(m, NULL);
+}
+
+static void arg_mutex_destroy(arg_mutex_t* m) {
+    pthread_mutex_destroy(m);
+}
+
+static void arg_mutex_lock(arg_mutex_t* m) {
+    pthread_mutex_lock(m);
+}
+
+static void arg_mutex_unlock(arg_mutex_t* m) {
+    pthread_mutex_unlock(m);
+}
+
+static void arg_cond_init(arg_cond_t* c) {
+    pthread_cond_init(c, NULL);
+}
+
+static void arg_cond_destroy(arg_cond_t* c) {
+    pthread_cond_destroy(c);
+}
+
+static void arg_cond_wait(arg_cond_t* c, arg_mutex_t* m) {
+    pthread_cond_wait(c, m);
+}
+
+static void arg_cond_broadcast(arg_cond_t* c) {
+    pthread_cond_broadcast(c);
+}
+
+static void arg_cond_signal(arg_cond_t* c) {
+    pthread_cond_signal(c);
+}
+
+struct arg_thread_start {
+    void (*proc)(void*);
+    void* arg;
+};
+
+static void* arg_thread_main(void* param) {
+    struct arg_thread_start start = *(struct arg_thread_start*)param;
+    xfree(param);
+    start.proc(start.arg);
+    return NULL;
+}
+
+static int arg_thread_create(arg_thread_t* t, void (*proc)(void*), void* arg) {
+    struct arg_thread_start* start = (struct arg_thread_start*)xmalloc(sizeof(struct arg_thread_start));
+    start->proc = proc;
+    start->arg = arg;
+    if (pthread_create(t, NULL, arg_thread_main, start) != 0) {
+        xfree(start);
+        return -1;
+    }
+    return 0;
+}
+
+static void arg_thread_join(arg_thread_t t) {
+    pthread_join(t, NULL);
+}
+
+int arg_thread_ncpu(void) {
+#ifdef _SC_NPROCESSORS_ONLN
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#else
+    return 1;
+#endif
+}
+
+#else
+
+/*
+ * Without thread support the pool never starts any workers, so every task is
+ * still queued when it is joined and runs on the joining thread. The locking
+ * primitives have nothing to protect and compile to no-ops.
+ */
+typedef int arg_mutex_t;
+typedef int arg_cond_t;
+typedef int arg_thread_t;
+
+#define ARG_MUTEX_INITIALIZER 0
+
+static void arg_mutex_init(arg_mutex_t* m) {
+    *m = 0;
+}
+
+static void arg_mutex_destroy(arg_mutex_t* m) {
+    (void)m;
+}
+
+static void arg_mutex_lock(arg_mutex_t* m) {
+    (void)m;
+}
+
+static void arg_mutex_unlock(arg_mutex_t* m) {
+    (void)m;
+}
+
+static void arg_cond_init(arg_cond_t* c) {
+    *c = 0;
+}
+
+static void arg_cond_destroy(arg_cond_t* c) {
+    (void)c;
+}
+
+static void arg_cond_wait(arg_cond_t* c, arg_mutex_t* m) {
+    (void)c;
+    (void)m;
+}
+
+static void arg_cond_broadcast(arg_cond_t* c) {
+    (void)c;
+}
+
+static void arg_cond_signal(arg_cond_t* c) {
+    (void)c;
+}
+
+static int arg_thread_create(arg_thread_t* t, void (*proc)(void*), void* arg) {
+    (void)t;
+    (void)proc;
+    (void)arg;
+    return -1;
+}
+
+static void arg_thread_join(arg_thread_t t) {
+    (void)t;
+}
+
+int arg_thread_ncpu(void) {
+    return 1;
+}
+
+#endif
+
+static arg_mutex_t s_global_lock = ARG_MUTEX_INITIALIZER;
+
+void arg_global_lock(void) {
+    arg_mutex_lock(&s_global_lock);
+}
+
+void arg_global_unlock(void) {
+    arg_mutex_unlock(&s_global_lock);
+}
+
+struct arg_tpool {
+    arg_mutex_t lock;
+    arg_cond_t work; /* signalled when a task is queued or the pool shuts down */
+    arg_cond_t done; /* broadcast whenever a task finishes */
+    arg_task_t* head;
+    arg_task_t* tail;
+    int shutdown;
+    int nthreads;
+    arg_thread_t* threads;
+};
+
+/* Run a task that has already been taken off the queue. Called without the lock held. */
+static void arg_tpool_run(arg_tpool_t* pool, arg_task_t* task) {
+    task->fn(task->arg);
+
+    arg_mutex_lock(&pool->lock);
+    task->state = ARG_TASK_DONE;
+    arg_cond_broadcast(&pool->done);
+    arg_mutex_unlock(&pool->lock);
+}
+
+/* Remove the first queued task. Called with the lock held. */
+static arg_task_t* arg_tpool_pop(arg_tpool_t* pool) {
+    arg_task_t* task = pool->head;
+    if (task) {
+        pool->head = task->next;
+        if (pool->head == NULL)
+            pool->tail = NULL;
+        task->next = NULL;
+        task->state = ARG_TASK_RUNNING;
+    }
+    return task;
+}
+
+static void arg_tpool_worker(void* arg) {
+    arg_tpool_t* pool = (arg_tpool_t*)arg;
+    arg_task_t* task;
+
+    arg_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->head == NULL && !pool->shutdown)
+            arg_cond_wait(&pool->work, &pool->lock);
+
+        /* the queue is drained before a worker honours a shutdown request */
+        task = arg_tpool_pop(pool);
+        if (task == NULL)
+            break;
+
+        arg_mutex_unlock(&pool->lock);
+        arg_tpool_run(pool, task);
+        arg_mutex_lock(&pool->lock);
+    }
+    arg_mutex_unlock(&pool->lock);
+}
+
+arg_tpool_t* arg_tpool_create(int nthreads) {
+    arg_tpool_t* pool;
+    int i;
+
+    nthreads = nthreads < 0 ? 0 : nthreads;
+
+    pool = (arg_tpool_t*)xmalloc(sizeof(arg_tpool_t));
+    arg_mutex_init(&pool->lock);
+    arg_cond_init(&pool->work);
+    arg_cond_init(&pool->done);
+    pool->head = NULL;
+    pool->tail = NULL;
+    pool->shutdown = 0;
+    pool->nthreads = 0;
+    pool->threads = (arg_thread_t*)xcalloc((size_t)(nthreads > 0 ? nthreads : 1), sizeof(arg_thread_t));
+
+    /* a thread that fails to start just leaves the pool smaller */
+    for (i = 0; i < nthreads; i++) {
+        if (arg_thread_create(&pool->threads[pool->nthreads], arg_tpool_worker, pool) == 0)
+            pool->nthreads++;
+    }
+
+    return pool;
+}
+
+void arg_tpool_destroy(arg_tpool_t* pool) {
+    arg_task_t* task;
+    int i;
+
+    if (pool == NULL)
+        return;
+
+    arg_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    arg_cond_broadcast(&pool->work);
+    arg_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < pool->nthreads; i++)
+        arg_thread_join(pool->threads[i]);
+
+    /* a pool without workers still owes its queued tasks a run */
+    while ((task = arg_tpool_pop(pool)) != NULL)
+        arg_tpool_run(pool, task);
+
+    arg_cond_destroy(&pool->done);
+    arg_cond_destroy(&pool->work);
+    arg_mutex_destroy(&pool->lock);
+    xfree(pool->threads);
+    xfree(pool);
+}
+
+int arg_tpool_size(arg_tpool_t* pool) {
+    return pool->nthreads;
+}
+
+void arg_tpool_submit(arg_tpool_t* pool, arg_task_t* task, arg_taskfn* fn, void* arg) {
+    task->fn = fn;
+    task->arg = arg;
+    task->state = ARG_TASK_QUEUED;
+    task->next = NULL;
+
+    arg_mutex_lock(&pool->lock);
+    if (pool->tail)
+        pool->tail->next = task;
+    else
+        pool->head = task;
+    pool->tail = task;
+    arg_cond_signal(&pool->work);
+    arg_mutex_unlock(&pool->lock);
+}
+
+int arg_tpool_done(arg_tpool_t* pool, arg_task_t* task) {
+    int done;
+
+    arg_mutex_lock(&pool->lock);
+    done = (task->state == ARG_TASK_DONE);
+    arg_mutex_unlock(&pool->lock);
+    return done;
+}
+
+void arg_tpool_join(arg_tpool_t* pool, arg_task_t* task) {
+    arg_mutex_lock(&pool->lock);
+
+    /* nobody has started the task yet, so run it here instead of idling */
+    if (task->state == ARG_TASK_QUEUED) {
+        arg_task_t** link = &pool->head;
+        arg_task_t* prev = NULL;
+
+        while (*link != task) {
+            prev = *link;
+            link = &(*link)->next;
+        }
+        *link = task->next;
+        if (pool->tail == task)
+            pool->tail = prev;
+        task->next = NULL;
+        task->state = ARG_TASK_RUNNING;
+
+        arg_mutex_unlock(&pool->lock);
+        arg_tpool_run(pool, task);
+        return;
+    }
+
+    while (task->state != ARG_TASK_DONE)
+        arg_cond_wait(&pool->done, &pool->lock);
+    arg_mutex_unlock(&pool->lock);
+}
+/*******************************************************************************
+ * arg_hashtable: Implements the hash table utilities
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2019 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * This hash table module is adapted from the C hash table implementation by
+ * Christopher Clark. Here is the copyright notice from the library:
+ *
+ * Copyright (c) 2002, Christopher Clark
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the original author; nor the names of any contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Credit for primes table: Aaron Krowne
+ * http://br.endernet.org/~akrowne/
+ * http://planetmath.org/encyclopedia/GoodHashTablePrimes.html
+ */
+static const unsigned int primes[] = {53,       97,       193,      389,       769,       1543,      3079,      6151,      12289,
+                                      24593,    49157,    98317,    196613,    393241,    786433,    1572869,   3145739,   6291469,
+                                      12582917, 25165843, 50331653, 100663319, 201326611, 402653189, 805306457, 1610612741};
+const unsigned int prime_table_length = sizeof(primes) / sizeof(primes[0]);
+const float max_load_factor = (float)0.65;
+
+static unsigned int enhanced_hash(arg_hashtable_t* h, const void* k) {
+    /*
+     * Aim to protect against poor hash functions by adding logic here.
+     * The logic is taken from Java 1.4 hash table source.
+     */
+    unsigned int i = h->hashfn(k);
+    i += ~(i << 9);
+    i ^= ((i >> 14) | (i << 18)); /* >>> */
+    i += (i << 4);
+    i ^= ((i >> 10) | (i << 22)); /* >>> */
+    return i;
+}
+
+static unsigned int index_for(unsigned int tablelength, unsigned int hashvalue) {
+    return (hashvalue % tablelength);
+}
+
+arg_hashtable_t* arg_hashtable_create(unsigned int minsize, unsigned int (*hashfn)(const void*), int (*eqfn)(const void*, const void*)) {
+    arg_hashtable_t* h;
+    unsigned int pindex;
+    unsigned int size = primes[0];
+
+    /* Check requested hash table isn't too large */
+    if (minsize > (1u << 30))
+        return NULL;
+
+    /*
+     * Enforce size as prime. The reason is to avoid clustering of values
+     * into a small number of buckets (yes, distribution). A more even
+     *  distributed hash table will perform more consistently.
+     */
+    for (pindex = 0; pindex < prime_table_length; pindex++) {
+        if (primes[pindex] > minsize) {
+            size = primes[pindex];
+            break;
+        }
+    }
+
+    h = (arg_hashtable_t*)xmalloc(sizeof(arg_hashtable_t));
+    h->table = (struct arg_hashtable_entry**)xmalloc(sizeof(struct arg_hashtable_entry*) * size);
+    memset(h->table, 0, size * sizeof(struct arg_hashtable_entry*));
+    h->tablelength = size;
+    h->primeindex = pindex;
+    h->entrycount = 0;
+    h->hashfn = hashfn;
+    h->eqfn = eqfn;
+    h->freekeys = 1;
+    h->loadlimit = (unsigned int)ceil(size * (double)max_load_factor);
+    return h;
+}
+
+static int arg_hashtable_expand(arg_hashtable_t* h) {
+    /* Double the size of the table to accommodate more entries */
+    struct arg_hashtable_entry** newtable;
+    struct arg_hashtable_entry* e;
+    unsigned int newsize;
+    unsigned int i;
+    unsigned int index;
+
+    /* Check we're not hitting max capacity */
+    if (h->primeindex == (prime_table_length - 1))
+        return 0;
+    newsize = primes[++(h->primeindex)];
+
+    newtable = (struct arg_hashtable_entry**)xmalloc(sizeof(struct arg_hashtable_entry*) * newsize);
+    memset(newtable, 0, newsize * sizeof(struct arg_hashtable_entry*));
+    /*
+     * This algorithm is not 'stable': it reverses the list
+     * when it transfers entries between the tables
+     */
+    for (i = 0; i < h->tablelength; i++) {
+        while (NULL != (e = h->table[i])) {
+            h->table[i] = e->next;
+            index = index_for(newsize, e->h);
+            e->next = newtable[index];
+            newtable[index] = e;
+        }
+    }
+
+    xfree(h->table);
+    h->table = newtable;
+    h->tablelength = newsize;
+    h->loadlimit = (unsigned int)ceil(newsize * (double)max_load_factor);
+    return -1;
+}
+
+unsigned int arg_hashtable_count(arg_hashtable_t* h) {
+    return h->entrycount;
+}
+
+void arg_hashtable_insert(arg_hashtable_t* h, void* k, void* v) {
+    /* This method allows duplicate keys - but they shouldn't be used */
+    unsigned int index;
+    struct arg_hashtable_entry* e;
+    if ((h->entrycount + 1) > h->loadlimit) {
+        /*
+         * Ignore the return value. If expand fails, we should
+         * still try cramming just this value into the existing table
+         * -- we may not have memory for a larger table, but one more
+         * element may be ok. Next time we insert, we'll try expanding again.
+         */
+        arg_hashtable_expand(h);
+    }
+    e = (struct arg_hashtable_entry*)xmalloc(sizeof(struct arg_hashtable_entry));
+    e->h = enhanced_hash(h, k);
+    index = index_for(h->tablelength, e->h);
+    e->k = k;
+    e->v = v;
+    e->next = h->table[index];
+    h->table[index] = e;
+    h->entrycount++;
+}
+
+void* arg_hashtable_search(arg_hashtable_t* h, const void* k) {
+    struct arg_hashtable_entry* e;
+    unsigned int hashvalue;
+    unsigned int index;
+
+    hashvalue = enhanced_hash(h, k);
+    index = index_for(h->tablelength, hashvalue);
+    e = h->table[index];
+    while (e != NULL) {
+        /* Check hash value to short circuit heavier comparison */
+        if ((hashvalue == e->h) && (h->eqfn(k, e->k)))
+            return e->v;
+        e = e->next;
+    }
+    return NULL;
+}
+
+void arg_hashtable_remove(arg_hashtable_t* h, const void* k) {
+    /*
+     * TODO: consider compacting the table when the load factor drops enough,
+     *       or provide a 'compact' method.
+     */
+
+    struct arg_hashtable_entry* e;
+    struct arg_hashtable_entry** pE;
+    unsigned int hashvalue;
+    unsigned int index;
+
+    hashvalue = enhanced_hash(h, k);
+    index = index_for(h->tablelength, hashvalue);
+    pE = &(h->table[index]);
+    e = *pE;
+    while (NULL != e) {
+        /* Check hash value to short circuit heavier comparison */
+        if ((hashvalue == e->h) && (h->eqfn(k, e->k))) {
+            *pE = e->next;
+            h->entrycount--;
+            if (h->freekeys)
+                xfree(e->k);
+            xfree(e->v);
+            xfree(e);
+            return;
+        }
+        pE = &(e->next);
+        e = e->next;
+    }
+}
+
+void arg_hashtable_destroy(arg_hashtable_t* h, int free_values) {
+    unsigned int i;
+    struct arg_hashtable_entry *e, *f;
+    struct arg_hashtable_entry** table = h->table;
+    if (free_values) {
+        for (i = 0; i < h->tablelength; i++) {
+            e = table[i];
+            while (NULL != e) {
+                f = e;
+                e = e->next;
+                if (h->freekeys)
+                    xfree(f->k);
+                xfree(f->v);
+                xfree(f);
+            }
+        }
+    } else {
+        for (i = 0; i < h->tablelength; i++) {
+            e = table[i];
+            while (NULL != e) {
+                f = e;
+                e = e->next;
+                if (h->freekeys)
+                    xfree(f->k);
+                xfree(f);
+            }
+        }
+    }
+    xfree(h->table);
+    xfree(h);
+}
+
+arg_hashtable_itr_t* arg_hashtable_itr_create(arg_hashtable_t* h) {
+    unsigned int i;
+    unsigned int tablelength;
+
+    arg_hashtable_itr_t* itr = (arg_hashtable_itr_t*)xmalloc(sizeof(arg_hashtable_itr_t));
+    itr->h = h;
+    itr->e = NULL;
+    itr->parent = NULL;
+    tablelength = h->tablelength;
+    itr->index = tablelength;
+    if (0 == h->entrycount)
+        return itr;
+
+    for (i = 0; i < tablelength; i++) {
+        if (h->table[i] != NULL) {
+            itr->e = h->table[i];
+            itr->index = i;
+            break;
+        }
+    }
+    return itr;
+}
+
+void arg_hashtable_itr_destroy(arg_hashtable_itr_t* itr) {
+    xfree(itr);
+}
+
+void* arg_hashtable_itr_key(arg_hashtable_itr_t* i) {
+    return i->e->k;
+}
+
+void* arg_hashtable_itr_value(arg_hashtable_itr_t* i) {
+    return i->e->v;
+}
+
+int arg_hashtable_itr_advance(arg_hashtable_itr_t* itr) {
+    unsigned int j;
+    unsigned int tablelength;
+    struct arg_hashtable_entry** table;
+    struct arg_hashtable_entry* next;
+
+    if (itr->e == NULL)
+        return 0; /* stupidity check */
+
+    next = itr->e->next;
+    if (NULL != next) {
+        itr->parent = itr->e;
+        itr->e = next;
+        return -1;
+    }
+
+    tablelength = itr->h->tablelength;
+    itr->parent = NULL;
+    if (tablelength <= (j = ++(itr->index))) {
+        itr->e = NULL;
+        return 0;
+    }
+
+    table = itr->h->table;
+    while (NULL == (next = table[j])) {
+        if (++j >= tablelength) {
+            itr->index = tablelength;
+            itr->e = NULL;
+            return 0;
+        }
+    }
+
+    itr->index = j;
+    itr->e = next;
+    return -1;
+}
+
+int arg_hashtable_itr_remove(arg_hashtable_itr_t* itr) {
+    struct arg_hashtable_entry* remember_e;
+    struct arg_hashtable_entry* remember_parent;
+    int ret;
+
+    /* Do the removal */
+    if ((itr->parent) == NULL) {
+        /* element is head of a chain */
+        itr->h->table[itr->index] = itr->e->next;
+    } else {
+        /* element is mid-chain */
+        itr->parent->next = itr->e->next;
+    }
+    /* itr->e is now outside the hashtable */
+    remember_e = itr->e;
+    itr->h->entrycount--;
+    if (itr->h->freekeys)
+        xfree(remember_e->k);
+    xfree(remember_e->v);
+
+    /* Advance the iterator, correcting the parent */
+    remember_parent = itr->parent;
+    ret = arg_hashtable_itr_advance(itr);
+    if (itr->parent == remember_e) {
+        itr->parent = remember_parent;
+    }
+    xfree(remember_e);
+    return ret;
+}
+
+int arg_hashtable_itr_search(arg_hashtable_itr_t* itr, arg_hashtable_t* h, void* k) {
+    struct arg_hashtable_entry* e;
+    struct arg_hashtable_entry* parent;
+    unsigned int hashvalue;
+    unsigned int index;
+
+    hashvalue = enhanced_hash(h, k);
+    index = index_for(h->tablelength, hashvalue);
+
+    e = h->table[index];
+    parent = NULL;
+    while (e != NULL) {
+        /* Check hash value to short circuit heavier comparison */
+        if ((hashvalue == e->h) && (h->eqfn(k, e->k))) {
+            itr->index = index;
+            itr->e = e;
+            itr->parent = parent;
+            itr->h = h;
+            return -1;
+        }
+        parent = e;
+        e = e->next;
+    }
+    return 0;
+}
+
+int arg_hashtable_change(arg_hashtable_t* h, void* k, void* v) {
+    struct arg_hashtable_entry* e;
+    unsigned int hashvalue;
+    unsigned int index;
+
+    hashvalue = enhanced_hash(h, k);
+    index = index_for(h->tablelength, hashvalue);
+    e = h->table[index];
+    while (e != NULL) {
+        /* Check hash value to short circuit heavier comparison */
+        if ((hashvalue == e->h) && (h->eqfn(k, e->k))) {
+            xfree(e->v);
+            e->v = v;
+            return -1;
+        }
+        e = e->next;
+    }
+    return 0;
+}
+/*******************************************************************************
+ * arg_dstr: Implements the dynamic string utilities
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2019 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4996)
+#endif
+
+#define START_VSNBUFF 16
+
+#if defined(_MSC_VER)
+    #define arg_vsnprintf _vsnprintf
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+    #define arg_vsnprintf vsnprintf
+#else
+/**
+ * A C89-compatible replacement for vsnprintf().
+ *
+ * Writes at most (size - 1) characters to str and always null-terminates,
+ * unless size is 0. The output is truncated if necessary.
+ *
+ * @param str  Output buffer.
+ * @param size Size of output buffer.
+ * @param format printf-style format string.
+ * @param ap    va_list of arguments.
+ * @return The number of characters that would have been written, excluding the null byte.
+ */
+int arg_vsnprintf(char *str, size_t size, const char *format, va_list ap) {
+    char *temp_buffer;
+    int result;
+    size_t temp_size;
+
+    if (str == NULL || size == 0) {
+        /* Just calculate required size using a temporary large buffer */
+        temp_size = 65536; /* Large temporary buffer */
+        temp_buffer = malloc(temp_size);
+        if (temp_buffer == NULL) {
+            return -1;
+        }
+
+        result = vsprintf(temp_buffer, format, ap);
+        free(temp_buffer);
+        return result;
+    }
+
+    if (size == 1) {
+        str[0] = '\0';
+        return 0;
+    }
+
+    /* Use a large temporary buffer to safely format */
+    temp_size = size * 4; /* Start with 4x the target size */
+    if (temp_size < 1024) {
+        temp_size = 1024;
+    }
+
+    temp_buffer = malloc(temp_size);
+    if (temp_buffer == NULL) {
+        return -1;
+    }
+
+    result = vsprintf(temp_buffer, format, ap);
+    if (result < 0) {
+        free(temp_buffer);
+        return -1;
+    }
+
+    /* Copy to destination buffer, truncating if necessary */
+    strncpy(str, temp_buffer, size - 1);
+    if ((size_t)result >= size) {
+        /* Truncate */
+        str[size - 1] = '\0';
+    }
+
+    free(temp_buffer);
+    return result; /* Return the number of chars that would be written */
+}
+#endif
+
+/*
+ * This dynamic string module is adapted from TclResult.c in the Tcl library.
+ * Here is the copyright notice from the library:
+ *
+ * This software is copyrighted by the Regents of the University of
+ * California, Sun Microsystems, Inc., Scriptics Corporation, ActiveState
+ * Corporation and other parties.  The following terms apply to all files
+ * associated with the software unless explicitly disclaimed in
+ * individual files.
+ *
+ * The authors hereby grant permission to use, copy, modify, distribute,
+ * and license this software and its documentation for any purpose, provided
+ * that existing copyright notices are retained in all copies and that this
+ * notice is included verbatim in any distributions. No written agreement,
+ * license, or royalty fee is required for any of the authorized uses.
+ * Modifications to this software may be copyrighted by their authors
+ * and need not follow the licensing terms described here, provided that
+ * the new terms are clearly indicated on the first page of each file where
+ * they apply.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR DISTRIBUTORS BE LIABLE TO ANY PARTY
+ * FOR DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE, ITS DOCUMENTATION, OR ANY
+ * DERIVATIVES THEREOF, EVEN IF THE AUTHORS HAVE BEEN ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * THE AUTHORS AND DISTRIBUTORS SPECIFICALLY DISCLAIM ANY WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.  THIS SOFTWARE
+ * IS PROVIDED ON AN "AS IS" BASIS, AND THE AUTHORS AND DISTRIBUTORS HAVE
+ * NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR
+ * MODIFICATIONS.
+ *
+ * GOVERNMENT USE: If you are acquiring this software on behalf of the
+ * U.S. government, the Government shall have only "Restricted Rights"
+ * in the software and related documentation as defined in the Federal
+ * Acquisition Regulations (FARs) in Clause 52.227.19 (c) (2).  If you
+ * are acquiring the software on behalf of the Department of Defense, the
+ * software shall be classified as "Commercial Computer Software" and the
+ * Government shall have only "Restricted Rights" as defined in Clause
+ * 252.227-7014 (b) (3) of DFARs.  Notwithstanding the foregoing, the
+ * authors grant the U.S. Government and others acting in its behalf
+ * permission to use and distribute the software in accordance with the
+ * terms specified in this license.
+ */
+
+typedef struct _internal_arg_dstr {
+    char* data;
+    arg_dstr_freefn* free_proc;
+    char sbuf[ARG_DSTR_SIZE + 1];
+    char* append_data;
+    int append_data_size;
+    int append_used;
+} _internal_arg_dstr_t;
+
+static void setup_append_buf(arg_dstr_t res, int newSpace);
+
+arg_dstr_t arg_dstr_create(void) {
+    _internal_arg_dstr_t* h = (_internal_arg_dstr_t*)xmalloc(sizeof(_internal_arg_dstr_t));
+    memset(h, 0, sizeof(_internal_arg_dstr_t));
+    h->sbuf[0] = 0;
+    h->data = h->sbuf;
+    h->free_proc = ARG_DSTR_STATIC;
+    return h;
+}
+
+void arg_dstr_destroy(arg_dstr_t ds) {
+    if (ds == NULL)
+        return;
+
+    arg_dstr_reset(ds);
+    xfree(ds);
+    return;
+}
+
+void arg_dstr_set(arg_dstr_t ds, char* str, arg_dstr_freefn* free_proc) {
+    int length;
+    register arg_dstr_freefn* old_free_proc = ds->free_proc;
+    char* old_result = ds->data;
+
+    if (str == NULL) {
+        ds->sbuf[0] = 0;
+        ds->data = ds->sbuf;
+        ds->free_proc = ARG_DSTR_STATIC;
+    } else if (free_proc == ARG_DSTR_VOLATILE) {
+        length = (int)strlen(str);
+        if (length > ARG_DSTR_SIZE) {
+            ds->data = (char*)xmalloc((size_t)length + 1);
+            ds->free_proc = ARG_DSTR_DYNAMIC;
+            strncpy(ds->data, str, (size_t)length + 1); /* NOSONAR */
+            assert(ds->data[length] == '\0');
+        } else {
+            ds->data = ds->sbuf;
+            ds->free_proc = ARG_DSTR_STATIC;
+            strncpy(ds->data, str, sizeof(ds->sbuf) - 1); /* NOSONAR */
+            ds->data[sizeof(ds->sbuf) - 1] = '\0';
+            assert(ds->data[ARG_DSTR_SIZE] == '\0');
+        }
+    } else {
+        ds->data = str;
+        ds->free_proc = free_proc;
+    }
+
+    /*
+     * If the old result was dynamically-allocated, free it up. Do it here,
+     * rather than at the beginning, in case the new result value was part of
+     * the old result value.
+     */
+
+    if ((old_free_proc != 0) && (old_result != ds->data)) {
+        if (old_free_proc == ARG_DSTR_DYNAMIC) {
+            xfree(old_result);
+        } else {
+            (*old_free_proc)(old_result);
+        }
+    }
+
+    if ((ds->append_data != NULL) && (ds->append_data_size > 0)) {
+        xfree(ds->append_data);
+        ds->append_data = NULL;
+        ds->append_data_size = 0;
+    }
+}
+
+char* arg_dstr_cstr(arg_dstr_t ds) /* Interpreter whose result to return. */
+{
+    return ds->data;
+}
+
+void arg_dstr_cat(arg_dstr_t ds, const char* str) {
+    setup_append_buf(ds, (int)strlen(str) + 1);
+    memcpy(ds->data + strlen(ds->data), str, strlen(str));
+}
+
+void arg_dstr_catc(arg_dstr_t ds, char c) {
+    setup_append_buf(ds, 2);
+    memcpy(ds->data + strlen(ds->data), &c, 1);
+}
+
+/*
+ * The logic of the `arg_dstr_catf` function is adapted from the `bformat`
+ * function in The Better String Library by Paul Hsieh. Here is the copyright
+ * notice from the library:
+ *
+ * Copyright (c) 2014, Paul Hsieh
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of bstrlib nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+void arg_dstr_catf(arg_dstr_t ds, const char* fmt, ...) {
+    va_list arglist;
+    char* buff;
+    int n, r;
+    size_t slen;
+
+    if (fmt == NULL)
+        return;
+
+    /* Since the length is not determinable beforehand, a search is
+       performed using the truncating "vsnprintf" call (to avoid buffer
+       overflows) on increasing potential sizes for the output result. */
+
+    if ((n = (int)(2 * strlen(fmt))) < START_VSNBUFF)
+        n = START_VSNBUFF;
+
+    buff = (char*)xmalloc((size_t)(n + 2));
+    memset(buff, 0, (size_t)(n + 2));
+
+    for (;;) {
+        va_start(arglist, fmt);
+        r = arg_vsnprintf(buff, (size_t)(n + 1), fmt, arglist);
+        va_end(arglist);
+
+        slen = strlen(buff);
+        if (slen < (size_t)n)
+            break;
+
+        if (r > n)
+            n = r;
+        else
+            n += n;
+
+        xfree(buff);
+        buff = (char*)xmalloc((size_t)(n + 2));
+        memset(buff, 0, (size_t)(n + 2));
+    }
+
+    arg_dstr_cat(ds, buff);
+    xfree(buff);
+}
+
+static void setup_append_buf(arg_dstr_t ds, int new_space) {
+    int total_space;
+
+    /*
+     * Make the append buffer larger, if that's necessary, then copy the
+     * data into the append buffer and make the append buffer the official
+     * data.
+     */
+    if (ds->data != ds->append_data) {
+        /*
+         * If the buffer is too big, then free it up so we go back to a
+         * smaller buffer. This avoids tying up memory forever after a large
+         * operation.
+         */
+        if (ds->append_data_size > 500) {
+            xfree(ds->append_data);
+            ds->append_data = NULL;
+            ds->append_data_size = 0;
+        }
+        ds->append_used = (int)strlen(ds->data);
+    } else if (ds->data[ds->append_used] != 0) {
+        /*
+         * Most likely someone has modified a result created by
+         * arg_dstr_cat et al. so that it has a different size. Just
+         * recompute the size.
+         */
+        ds->append_used = (int)strlen(ds->data);
+    }
+
+    total_space = new_space + ds->append_used;
+    if (total_space >= ds->append_data_size) {
+        char* newbuf = NULL;
+
+        if (total_space < 100) {
+            total_space = 200;
+        } else {
+            total_space *= 2;
+        }
+        newbuf = (char*)xmalloc((unsigned)total_space);
+        memset(newbuf, 0, (size_t)total_space);
+        strncpy(newbuf, ds->data, (size_t)total_space); /* NOSONAR */
+        assert(newbuf[total_space - 1] == '\0');
+        if (ds->append_data != NULL) {
+            xfree(ds->append_data);
+        }
+
+        ds->append_data = newbuf;
+        ds->append_data_size = total_space;
+    } else if (ds->data != ds->append_data && ds->append_data != NULL) {
+        strncpy(ds->append_data, ds->data, (size_t)ds->append_data_size); /* NOSONAR */
+        assert(ds->append_data[ds->append_data_size - 1] == '\0');
+    }
+
+    assert(ds->append_data != NULL);
+    arg_dstr_free(ds);
+    ds->data = ds->append_data;
+}
+
+void arg_dstr_free(arg_dstr_t ds) {
+    if (ds->free_proc != NULL) {
+        if (ds->free_proc == ARG_DSTR_DYNAMIC) {
+            xfree(ds->data);
+        } else {
+            (*ds->free_proc)(ds->data);
+        }
+        ds->free_proc = NULL;
+    }
+}
+
+void arg_dstr_reset(arg_dstr_t ds) {
+    arg_dstr_free(ds);
+    if ((ds->append_data != NULL) && (ds->append_data_size > 0)) {
+        xfree(ds->append_data);
+        ds->append_data = NULL;
+        ds->append_data_size = 0;
+    }
+
+    ds->data = ds->sbuf;
+    ds->sbuf[0] = 0;
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+/*******************************************************************************
+ * arg_strtod: Implements locale-independent decimal to double conversion
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <ctype.h>
+#include <float.h>
+#include <locale.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * arg_strtod() converts decimal floating-point text to the nearest double
+ * without consulting the locale, so "1.5" means one and a half even when
+ * the process runs with a locale that uses a decimal comma.
+ *
+ * The decimal mantissa (up to 19 significant digits) and exponent are
+ * collected in one pass and converted with the first of these that applies:
+ *
+ *  1. Clinger's fast path: a mantissa below 2^53 and a power of ten up to
+ *     1e22 are both exact doubles, so a single multiplication or division
+ *     gives the correctly rounded result.
+ *  2. The Eisel-Lemire algorithm: the mantissa is multiplied by a 128-bit
+ *     approximation of the power of ten, which determines the correctly
+ *     rounded result in all but a tiny fraction of cases, and reports when
+ *     it cannot.
+ *  3. The C library strtod(), given a copy of the text in which the '.' has
+ *     been replaced by the decimal point of the current locale. This also
+ *     handles the hexadecimal, infinity and NaN forms that strtod() accepts.
+ *
+ * See D. Lemire, "Number Parsing at a Gigabyte per Second", Software:
+ * Practice and Experience 51(8), 2021, and N. Tao's "Eisel-Lemire ParseNumberF64
+ * Algorithm" write-up for the details of step 2.
+ */
+
+#define ARG_POW10_MIN (-342)
+#define ARG_POW10_MAX 308
+
+/* 128-bit mantissas of 10^q for q in [ARG_POW10_MIN, ARG_POW10_MAX], */
+/* normalized so that the top bit is set and truncated (rounded down). */
+/* Each row holds the four 32-bit words, most significant first.     */
+static const uint32_t arg_pow10_tab[][4] = {
+    {0xEEF453D6, 0x923BD65A, 0x113FAA29, 0x06A13B3F}, /* 1e-342 */
+    {0x9558B466, 0x1B6565F8, 0x4AC7CA59, 0xA424C507}, /* 1e-341 */
+    {0xBAAEE17F, 0xA23EBF76, 0x5D79BCF0, 0x0D2DF649}, /* 1e-340 */
+    {0xE95A99DF, 0x8ACE6F53, 0xF4D82C2C, 0x107973DC}, /* 1e-339 */
+    {0x91D8A02B, 0xB6C10594, 0x79071B9B, 0x8A4BE869}, /* 1e-338 */
+    {0xB64EC836, 0xA47146F9, 0x9748E282, 0x6CDEE284}, /* 1e-337 */
+    {0xE3E27A44, 0x4D8D98B7, 0xFD1B1B23, 0x08169B25}, /* 1e-336 */
+    {0x8E6D8C6A, 0xB0787F72, 0xFE30F0F5, 0xE50E20F7}, /* 1e-335 */
+    {0xB208EF85, 0x5C969F4F, 0xBDBD2D33, 0x5E51A935}, /* 1e-334 */
+    {0xDE8B2B66, 0xB3BC4723, 0xAD2C7880, 0x35E61382}, /* 1e-333 */
+    {0x8B16FB20, 0x3055AC76, 0x4C3BCB50, 0x21AFCC31}, /* 1e-332 */
+    {0xADDCB9E8, 0x3C6B1793, 0xDF4ABE24, 0x2A1BBF3D}, /* 1e-331 */
+    {0xD953E862, 0x4B85DD78, 0xD71D6DAD, 0x34A2AF0D}, /* 1e-330 */
+    {0x87D4713D, 0x6F33AA6B, 0x8672648C, 0x40E5AD68}, /* 1e-329 */
+    {0xA9C98D8C, 0xCB009506, 0x680EFDAF, 0x511F18C2}, /* 1e-328 */
+    {0xD43BF0EF, 0xFDC0BA48, 0x0212BD1B, 0x2566DEF2}, /* 1e-327 */
+    {0x84A57695, 0xFE98746D, 0x014BB630, 0xF7604B57}, /* 1e-326 */
+    {0xA5CED43B, 0x7E3E9188, 0x419EA3BD, 0x35385E2D}, /* 1e-325 */
+    {0xCF42894A, 0x5DCE35EA, 0x52064CAC, 0x828675B9}, /* 1e-324 */
+    {0x818995CE, 0x7AA0E1B2, 0x7343EFEB, 0xD1940993}, /* 1e-323 */
+    {0xA1EBFB42, 0x19491A1F, 0x1014EBE6, 0xC5F90BF8}, /* 1e-322 */
+    {0xCA66FA12, 0x9F9B60A6, 0xD41A26E0, 0x77774EF6}, /* 1e-321 */
+    {0xFD00B897, 0x478238D0, 0x8920B098, 0x955522B4}, /* 1e-320 */
+    {0x9E20735E, 0x8CB16382, 0x55B46E5F, 0x5D5535B0}, /* 1e-319 */
+    {0xC5A89036, 0x2FDDBC62, 0xEB2189F7, 0x34AA831D}, /* 1e-318 */
+    {0xF712B443, 0xBBD52B7B, 0xA5E9EC75, 0x01D523E4}, /* 1e-317 */
+    {0x9A6BB0AA, 0x55653B2D, 0x47B233C9, 0x2125366E}, /* 1e-316 */
+    {0xC1069CD4, 0xEABE89F8, 0x999EC0BB, 0x696E840A}, /* 1e-315 */
+    {0xF148440A, 0x256E2C76, 0xC00670EA, 0x43CA250D}, /* 1e-314 */
+    {0x96CD2A86, 0x5764DBCA, 0x38040692, 0x6A5E5728}, /* 1e-313 */
+    {0xBC807527, 0xED3E12BC, 0xC6050837, 0x04F5ECF2}, /* 1e-312 */
+    {0xEBA09271, 0xE88D976B, 0xF7864A44, 0xC633682E}, /* 1e-311 */
+    {0x93445B87, 0x31587EA3, 0x7AB3EE6A, 0xFBE0211D}, /* 1e-310 */
+    {0xB8157268, 0xFDAE9E4C, 0x5960EA05, 0xBAD82964}, /* 1e-309 */
+    {0xE61ACF03, 0x3D1A45DF, 0x6FB92487, 0x298E33BD}, /* 1e-308 */
+    {0x8FD0C162, 0x06306BAB, 0xA5D3B6D4, 0x79F8E056}, /* 1e-307 */
+    {0xB3C4F1BA, 0x87BC8696, 0x8F48A489, 0x9877186C}, /* 1e-306 */
+    {0xE0B62E29, 0x29ABA83C, 0x331ACDAB, 0xFE94DE87}, /* 1e-305 */
+    {0x8C71DCD9, 0xBA0B4925, 0x9FF0C08B, 0x7F1D0B14}, /* 1e-304 */
+    {0xAF8E5410, 0x288E1B6F, 0x07ECF0AE, 0x5EE44DD9}, /* 1e-303 */
+    {0xDB71E914, 0x32B1A24A, 0xC9E82CD9, 0xF69D6150}, /* 1e-302 */
+    {0x892731AC, 0x9FAF056E, 0xBE311C08, 0x3A225CD2}, /* 1e-301 */
+    {0xAB70FE17, 0xC79AC6CA, 0x6DBD630A, 0x48AAF406}, /* 1e-300 */
+    {0xD64D3D9D, 0xB981787D, 0x092CBBCC, 0xDAD5B108}, /* 1e-299 */
+    {0x85F04682, 0x93F0EB4E, 0x25BBF560, 0x08C58EA5}, /* 1e-298 */
+    {0xA76C5823, 0x38ED2621, 0xAF2AF2B8, 0x0AF6F24E}, /* 1e-297 */
+    {0xD1476E2C, 0x07286FAA, 0x1AF5AF66, 0x0DB4AEE1}, /* 1e-296 */
+    {0x82CCA4DB, 0x847945CA, 0x50D98D9F, 0xC890ED4D}, /* 1e-295 */
+    {0xA37FCE12, 0x6597973C, 0xE50FF107, 0xBAB528A0}, /* 1e-294 */
+    {0xCC5FC196, 0xFEFD7D0C, 0x1E53ED49, 0xA96272C8}, /* 1e-293 */
+    {0xFF77B1FC, 0xBEBCDC4F, 0x25E8E89C, 0x13BB0F7A}, /* 1e-292 */
+    {0x9FAACF3D, 0xF73609B1, 0x77B19161, 0x8C54E9AC}, /* 1e-291 */
+    {0xC795830D, 0x75038C1D, 0xD59DF5B9, 0xEF6A2417}, /* 1e-290 */
+    {0xF97AE3D0, 0xD2446F25, 0x4B057328, 0x6B44AD1D}, /* 1e-289 */
+    {0x9BECCE62, 0x836AC577, 0x4EE367F9, 0x430AEC32}, /* 1e-288 */
+    {0xC2E801FB, 0x244576D5, 0x229C41F7, 0x93CDA73F}, /* 1e-287 */
+    {0xF3A20279, 0xED56D48A, 0x6B435275, 0x78C1110F}, /* 1e-286 */
+    {0x9845418C, 0x345644D6, 0x830A1389, 0x6B78AAA9}, /* 1e-285 */
+    {0xBE5691EF, 0x416BD60C, 0x23CC986B, 0xC656D553}, /* 1e-284 */
+    {0xEDEC366B, 0x11C6CB8F, 0x2CBFBE86, 0xB7EC8AA8}, /* 1e-283 */
+    {0x94B3A202, 0xEB1C3F39, 0x7BF7D714, 0x32F3D6A9}, /* 1e-282 */
+    {0xB9E08A83, 0xA5E34F07, 0xDAF5CCD9, 0x3FB0CC53}, /* 1e-281 */
+    {0xE858AD24, 0x8F5C22C9, 0xD1B3400F, 0x8F9CFF68}, /* 1e-280 */
+    {0x91376C36, 0xD99995BE, 0x23100809, 0xB9C21FA1}, /* 1e-279 */
+    {0xB5854744, 0x8FFFFB2D, 0xABD40A0C, 0x2832A78A}, /* 1e-278 */
+    {0xE2E69915, 0xB3FFF9F9, 0x16C90C8F, 0x323F516C}, /* 1e-277 */
+    {0x8DD01FAD, 0x907FFC3B, 0xAE3DA7D9, 0x7F6792E3}, /* 1e-276 */
+    {0xB1442798, 0xF49FFB4A, 0x99CD11CF, 0xDF41779C}, /* 1e-275 */
+    {0xDD95317F, 0x31C7FA1D, 0x40405643, 0xD711D583}, /* 1e-274 */
+    {0x8A7D3EEF, 0x7F1CFC52, 0x482835EA, 0x666B2572}, /* 1e-273 */
+    {0xAD1C8EAB, 0x5EE43B66, 0xDA324365, 0x0005EECF}, /* 1e-272 */
+    {0xD863B256, 0x369D4A40, 0x90BED43E, 0x40076A82}, /* 1e-271 */
+    {0x873E4F75, 0xE2224E68, 0x5A7744A6, 0xE804A291}, /* 1e-270 */
+    {0xA90DE353, 0x5AAAE202, 0x711515D0, 0xA205CB36}, /* 1e-269 */
+    {0xD3515C28, 0x31559A83, 0x0D5A5B44, 0xCA873E03}, /* 1e-268 */
+    {0x8412D999, 0x1ED58091, 0xE858790A, 0xFE9486C2}, /* 1e-267 */
+    {0xA5178FFF, 0x668AE0B6, 0x626E974D, 0xBE39A872}, /* 1e-266 */
+    {0xCE5D73FF, 0x402D98E3, 0xFB0A3D21, 0x2DC8128F}, /* 1e-265 */
+    {0x80FA687F, 0x881C7F8E, 0x7CE66634, 0xBC9D0B99}, /* 1e-264 */
+    {0xA139029F, 0x6A239F72, 0x1C1FFFC1, 0xEBC44E80}, /* 1e-263 */
+    {0xC9874347, 0x44AC874E, 0xA327FFB2, 0x66B56220}, /* 1e-262 */
+    {0xFBE91419, 0x15D7A922, 0x4BF1FF9F, 0x0062BAA8}, /* 1e-261 */
+    {0x9D71AC8F, 0xADA6C9B5, 0x6F773FC3, 0x603DB4A9}, /* 1e-260 */
+    {0xC4CE17B3, 0x99107C22, 0xCB550FB4, 0x384D21D3}, /* 1e-259 */
+    {0xF6019DA0, 0x7F549B2B, 0x7E2A53A1, 0x46606A48}, /* 1e-258 */
+    {0x99C10284, 0x4F94E0FB, 0x2EDA7444, 0xCBFC426D}, /* 1e-257 */
+    {0xC0314325, 0x637A1939, 0xFA911155, 0xFEFB5308}, /* 1e-256 */
+    {0xF03D93EE, 0xBC589F88, 0x793555AB, 0x7EBA27CA}, /* 1e-255 */
+    {0x96267C75, 0x35B763B5, 0x4BC1558B, 0x2F3458DE}, /* 1e-254 */
+    {0xBBB01B92, 0x83253CA2, 0x9EB1AAED, 0xFB016F16}, /* 1e-253 */
+    {0xEA9C2277, 0x23EE8BCB, 0x465E15A9, 0x79C1CADC}, /* 1e-252 */
+    {0x92A1958A, 0x7675175F, 0x0BFACD89, 0xEC191EC9}, /* 1e-251 */
+    {0xB749FAED, 0x14125D36, 0xCEF980EC, 0x671F667B}, /* 1e-250 */
+    {0xE51C79A8, 0x5916F484, 0x82B7E127, 0x80E7401A}, /* 1e-249 */
+    {0x8F31CC09, 0x37AE58D2, 0xD1B2ECB8, 0xB0908810}, /* 1e-248 */
+    {0xB2FE3F0B, 0x8599EF07, 0x861FA7E6, 0xDCB4AA15}, /* 1e-247 */
+    {0xDFBDCECE, 0x67006AC9, 0x67A791E0, 0x93E1D49A}, /* 1e-246 */
+    {0x8BD6A141, 0x006042BD, 0xE0C8BB2C, 0x5C6D24E0}, /* 1e-245 */
+    {0xAECC4991, 0x4078536D, 0x58FAE9F7, 0x73886E18}, /* 1e-244 */
+    {0xDA7F5BF5, 0x90966848, 0xAF39A475, 0x506A899E}, /* 1e-243 */
+    {0x888F9979, 0x7A5E012D, 0x6D8406C9, 0x52429603}, /* 1e-242 */
+    {0xAAB37FD7, 0xD8F58178, 0xC8E5087B, 0xA6D33B83}, /* 1e-241 */
+    {0xD5605FCD, 0xCF32E1D6, 0xFB1E4A9A, 0x90880A64}, /* 1e-240 */
+    {0x855C3BE0, 0xA17FCD26, 0x5CF2EEA0, 0x9A55067F}, /* 1e-239 */
+    {0xA6B34AD8, 0xC9DFC06F, 0xF42FAA48, 0xC0EA481E}, /* 1e-238 */
+    {0xD0601D8E, 0xFC57B08B, 0xF13B94DA, 0xF124DA26}, /* 1e-237 */
+    {0x823C1279, 0x5DB6CE57, 0x76C53D08, 0xD6B70858}, /* 1e-236 */
+    {0xA2CB1717, 0xB52481ED, 0x54768C4B, 0x0C64CA6E}, /* 1e-235 */
+    {0xCB7DDCDD, 0xA26DA268, 0xA9942F5D, 0xCF7DFD09}, /* 1e-234 */
+    {0xFE5D5415, 0x0B090B02, 0xD3F93B35, 0x435D7C4C}, /* 1e-233 */
+    {0x9EFA548D, 0x26E5A6E1, 0xC47BC501, 0x4A1A6DAF}, /* 1e-232 */
+    {0xC6B8E9B0, 0x709F109A, 0x359AB641, 0x9CA1091B}, /* 1e-231 */
+    {0xF867241C, 0x8CC6D4C0, 0xC30163D2, 0x03C94B62}, /* 1e-230 */
+    {0x9B407691, 0xD7FC44F8, 0x79E0DE63, 0x425DCF1D}, /* 1e-229 */
+    {0xC2109436, 0x4DFB5636, 0x985915FC, 0x12F542E4}, /* 1e-228 */
+    {0xF294B943, 0xE17A2BC4, 0x3E6F5B7B, 0x17B2939D}, /* 1e-227 */
+    {0x979CF3CA, 0x6CEC5B5A, 0xA705992C, 0xEECF9C42}, /* 1e-226 */
+    {0xBD8430BD, 0x08277231, 0x50C6FF78, 0x2A838353}, /* 1e-225 */
+    {0xECE53CEC, 0x4A314EBD, 0xA4F8BF56, 0x35246428}, /* 1e-224 */
+    {0x940F4613, 0xAE5ED136, 0x871B7795, 0xE136BE99}, /* 1e-223 */
+    {0xB9131798, 0x99F68584, 0x28E2557B, 0x59846E3F}, /* 1e-222 */
+    {0xE757DD7E, 0xC07426E5, 0x331AEADA, 0x2FE589CF}, /* 1e-221 */
+    {0x9096EA6F, 0x3848984F, 0x3FF0D2C8, 0x5DEF7621}, /* 1e-220 */
+    {0xB4BCA50B, 0x065ABE63, 0x0FED077A, 0x756B53A9}, /* 1e-219 */
+    {0xE1EBCE4D, 0xC7F16DFB, 0xD3E84959, 0x12C62894}, /* 1e-218 */
+    {0x8D3360F0, 0x9CF6E4BD, 0x64712DD7, 0xABBBD95C}, /* 1e-217 */
+    {0xB080392C, 0xC4349DEC, 0xBD8D794D, 0x96AACFB3}, /* 1e-216 */
+    {0xDCA04777, 0xF541C567, 0xECF0D7A0, 0xFC5583A0}, /* 1e-215 */
+    {0x89E42CAA, 0xF9491B60, 0xF41686C4, 0x9DB57244}, /* 1e-214 */
+    {0xAC5D37D5, 0xB79B6239, 0x311C2875, 0xC522CED5}, /* 1e-213 */
+    {0xD77485CB, 0x25823AC7, 0x7D633293, 0x366B828B}, /* 1e-212 */
+    {0x86A8D39E, 0xF77164BC, 0xAE5DFF9C, 0x02033197}, /* 1e-211 */
+    {0xA8530886, 0xB54DBDEB, 0xD9F57F83, 0x0283FDFC}, /* 1e-210 */
+    {0xD267CAA8, 0x62A12D66, 0xD072DF63, 0xC324FD7B}, /* 1e-209 */
+    {0x8380DEA9, 0x3DA4BC60, 0x4247CB9E, 0x59F71E6D}, /* 1e-208 */
+    {0xA4611653, 0x8D0DEB78, 0x52D9BE85, 0xF074E608}, /* 1e-207 */
+    {0xCD795BE8, 0x70516656, 0x67902E27, 0x6C921F8B}, /* 1e-206 */
+    {0x806BD971, 0x4632DFF6, 0x00BA1CD8, 0xA3DB53B6}, /* 1e-205 */
+    {0xA086CFCD, 0x97BF97F3, 0x80E8A40E, 0xCCD228A4}, /* 1e-204 */
+    {0xC8A883C0, 0xFDAF7DF0, 0x6122CD12, 0x8006B2CD}, /* 1e-203 */
+    {0xFAD2A4B1, 0x3D1B5D6C, 0x796B8057, 0x20085F81}, /* 1e-202 */
+    {0x9CC3A6EE, 0xC6311A63, 0xCBE33036, 0x74053BB0}, /* 1e-201 */
+    {0xC3F490AA, 0x77BD60FC, 0xBEDBFC44, 0x11068A9C}, /* 1e-200 */
+    {0xF4F1B4D5, 0x15ACB93B, 0xEE92FB55, 0x15482D44}, /* 1e-199 */
+    {0x99171105, 0x2D8BF3C5, 0x751BDD15, 0x2D4D1C4A}, /* 1e-198 */
+    {0xBF5CD546, 0x78EEF0B6, 0xD262D45A, 0x78A0635D}, /* 1e-197 */
+    {0xEF340A98, 0x172AACE4, 0x86FB8971, 0x16C87C34}, /* 1e-196 */
+    {0x9580869F, 0x0E7AAC0E, 0xD45D35E6, 0xAE3D4DA0}, /* 1e-195 */
+    {0xBAE0A846, 0xD2195712, 0x89748360, 0x59CCA109}, /* 1e-194 */
+    {0xE998D258, 0x869FACD7, 0x2BD1A438, 0x703FC94B}, /* 1e-193 */
+    {0x91FF8377, 0x5423CC06, 0x7B6306A3, 0x4627DDCF}, /* 1e-192 */
+    {0xB67F6455, 0x292CBF08, 0x1A3BC84C, 0x17B1D542}, /* 1e-191 */
+    {0xE41F3D6A, 0x7377EECA, 0x20CABA5F, 0x1D9E4A93}, /* 1e-190 */
+    {0x8E938662, 0x882AF53E, 0x547EB47B, 0x7282EE9C}, /* 1e-189 */
+    {0xB23867FB, 0x2A35B28D, 0xE99E619A, 0x4F23AA43}, /* 1e-188 */
+    {0xDEC681F9, 0xF4C31F31, 0x6405FA00, 0xE2EC94D4}, /* 1e-187 */
+    {0x8B3C113C, 0x38F9F37E, 0xDE83BC40, 0x8DD3DD04}, /* 1e-186 */
+    {0xAE0B158B, 0x4738705E, 0x9624AB50, 0xB148D445}, /* 1e-185 */
+    {0xD98DDAEE, 0x19068C76, 0x3BADD624, 0xDD9B0957}, /* 1e-184 */
+    {0x87F8A8D4, 0xCFA417C9, 0xE54CA5D7, 0x0A80E5D6}, /* 1e-183 */
+    {0xA9F6D30A, 0x038D1DBC, 0x5E9FCF4C, 0xCD211F4C}, /* 1e-182 */
+    {0xD47487CC, 0x8470652B, 0x7647C320, 0x0069671F}, /* 1e-181 */
+    {0x84C8D4DF, 0xD2C63F3B, 0x29ECD9F4, 0x0041E073}, /* 1e-180 */
+    {0xA5FB0A17, 0xC777CF09, 0xF4681071, 0x00525890}, /* 1e-179 */
+    {0xCF79CC9D, 0xB955C2CC, 0x7182148D, 0x4066EEB4}, /* 1e-178 */
+    {0x81AC1FE2, 0x93D599BF, 0xC6F14CD8, 0x48405530}, /* 1e-177 */
+    {0xA21727DB, 0x38CB002F, 0xB8ADA00E, 0x5A506A7C}, /* 1e-176 */
+    {0xCA9CF1D2, 0x06FDC03B, 0xA6D90811, 0xF0E4851C}, /* 1e-175 */
+    {0xFD442E46, 0x88BD304A, 0x908F4A16, 0x6D1DA663}, /* 1e-174 */
+    {0x9E4A9CEC, 0x15763E2E, 0x9A598E4E, 0x043287FE}, /* 1e-173 */
+    {0xC5DD4427, 0x1AD3CDBA, 0x40EFF1E1, 0x853F29FD}, /* 1e-172 */
+    {0xF7549530, 0xE188C128, 0xD12BEE59, 0xE68EF47C}, /* 1e-171 */
+    {0x9A94DD3E, 0x8CF578B9, 0x82BB74F8, 0x301958CE}, /* 1e-170 */
+    {0xC13A148E, 0x3032D6E7, 0xE36A5236, 0x3C1FAF01}, /* 1e-169 */
+    {0xF18899B1, 0xBC3F8CA1, 0xDC44E6C3, 0xCB279AC1}, /* 1e-168 */
+    {0x96F5600F, 0x15A7B7E5, 0x29AB103A, 0x5EF8C0B9}, /* 1e-167 */
+    {0xBCB2B812, 0xDB11A5DE, 0x7415D448, 0xF6B6F0E7}, /* 1e-166 */
+    {0xEBDF6617, 0x91D60F56, 0x111B495B, 0x3464AD21}, /* 1e-165 */
+    {0x936B9FCE, 0xBB25C995, 0xCAB10DD9, 0x00BEEC34}, /* 1e-164 */
+    {0xB84687C2, 0x69EF3BFB, 0x3D5D514F, 0x40EEA742}, /* 1e-163 */
+    {0xE65829B3, 0x046B0AFA, 0x0CB4A5A3, 0x112A5112}, /* 1e-162 */
+    {0x8FF71A0F, 0xE2C2E6DC, 0x47F0E785, 0xEABA72AB}, /* 1e-161 */
+    {0xB3F4E093, 0xDB73A093, 0x59ED2167, 0x65690F56}, /* 1e-160 */
+    {0xE0F218B8, 0xD25088B8, 0x306869C1, 0x3EC3532C}, /* 1e-159 */
+    {0x8C974F73, 0x83725573, 0x1E414218, 0xC73A13FB}, /* 1e-158 */
+    {0xAFBD2350, 0x644EEACF, 0xE5D1929E, 0xF90898FA}, /* 1e-157 */
+    {0xDBAC6C24, 0x7D62A583, 0xDF45F746, 0xB74ABF39}, /* 1e-156 */
+    {0x894BC396, 0xCE5DA772, 0x6B8BBA8C, 0x328EB783}, /* 1e-155 */
+    {0xAB9EB47C, 0x81F5114F, 0x066EA92F, 0x3F326564}, /* 1e-154 */
+    {0xD686619B, 0xA27255A2, 0xC80A537B, 0x0EFEFEBD}, /* 1e-153 */
+    {0x8613FD01, 0x45877585, 0xBD06742C, 0xE95F5F36}, /* 1e-152 */
+    {0xA798FC41, 0x96E952E7, 0x2C481138, 0x23B73704}, /* 1e-151 */
+    {0xD17F3B51, 0xFCA3A7A0, 0xF75A1586, 0x2CA504C5}, /* 1e-150 */
+    {0x82EF8513, 0x3DE648C4, 0x9A984D73, 0xDBE722FB}, /* 1e-149 */
+    {0xA3AB6658, 0x0D5FDAF5, 0xC13E60D0, 0xD2E0EBBA}, /* 1e-148 */
+    {0xCC963FEE, 0x10B7D1B3, 0x318DF905, 0x079926A8}, /* 1e-147 */
+    {0xFFBBCFE9, 0x94E5C61F, 0xFDF17746, 0x497F7052}, /* 1e-146 */
+    {0x9FD561F1, 0xFD0F9BD3, 0xFEB6EA8B, 0xEDEFA633}, /* 1e-145 */
+    {0xC7CABA6E, 0x7C5382C8, 0xFE64A52E, 0xE96B8FC0}, /* 1e-144 */
+    {0xF9BD690A, 0x1B68637B, 0x3DFDCE7A, 0xA3C673B0}, /* 1e-143 */
+    {0x9C1661A6, 0x51213E2D, 0x06BEA10C, 0xA65C084E}, /* 1e-142 */
+    {0xC31BFA0F, 0xE5698DB8, 0x486E494F, 0xCFF30A62}, /* 1e-141 */
+    {0xF3E2F893, 0xDEC3F126, 0x5A89DBA3, 0xC3EFCCFA}, /* 1e-140 */
+    {0x986DDB5C, 0x6B3A76B7, 0xF8962946, 0x5A75E01C}, /* 1e-139 */
+    {0xBE895233, 0x86091465, 0xF6BBB397, 0xF1135823}, /* 1e-138 */
+    {0xEE2BA6C0, 0x678B597F, 0x746AA07D, 0xED582E2C}, /* 1e-137 */
+    {0x94DB4838, 0x40B717EF, 0xA8C2A44E, 0xB4571CDC}, /* 1e-136 */
+    {0xBA121A46, 0x50E4DDEB, 0x92F34D62, 0x616CE413}, /* 1e-135 */
+    {0xE896A0D7, 0xE51E1566, 0x77B020BA, 0xF9C81D17}, /* 1e-134 */
+    {0x915E2486, 0xEF32CD60, 0x0ACE1474, 0xDC1D122E}, /* 1e-133 */
+    {0xB5B5ADA8, 0xAAFF80B8, 0x0D819992, 0x132456BA}, /* 1e-132 */
+    {0xE3231912, 0xD5BF60E6, 0x10E1FFF6, 0x97ED6C69}, /* 1e-131 */
+    {0x8DF5EFAB, 0xC5979C8F, 0xCA8D3FFA, 0x1EF463C1}, /* 1e-130 */
+    {0xB1736B96, 0xB6FD83B3, 0xBD308FF8, 0xA6B17CB2}, /* 1e-129 */
+    {0xDDD0467C, 0x64BCE4A0, 0xAC7CB3F6, 0xD05DDBDE}, /* 1e-128 */
+    {0x8AA22C0D, 0xBEF60EE4, 0x6BCDF07A, 0x423AA96B}, /* 1e-127 */
+    {0xAD4AB711, 0x2EB3929D, 0x86C16C98, 0xD2C953C6}, /* 1e-126 */
+    {0xD89D64D5, 0x7A607744, 0xE871C7BF, 0x077BA8B7}, /* 1e-125 */
+    {0x87625F05, 0x6C7C4A8B, 0x11471CD7, 0x64AD4972}, /* 1e-124 */
+    {0xA93AF6C6, 0xC79B5D2D, 0xD598E40D, 0x3DD89BCF}, /* 1e-123 */
+    {0xD389B478, 0x79823479, 0x4AFF1D10, 0x8D4EC2C3}, /* 1e-122 */
+    {0x843610CB, 0x4BF160CB, 0xCEDF722A, 0x585139BA}, /* 1e-121 */
+    {0xA54394FE, 0x1EEDB8FE, 0xC2974EB4, 0xEE658828}, /* 1e-120 */
+    {0xCE947A3D, 0xA6A9273E, 0x733D2262, 0x29FEEA32}, /* 1e-119 */
+    {0x811CCC66, 0x8829B887, 0x0806357D, 0x5A3F525F}, /* 1e-118 */
+    {0xA163FF80, 0x2A3426A8, 0xCA07C2DC, 0xB0CF26F7}, /* 1e-117 */
+    {0xC9BCFF60, 0x34C13052, 0xFC89B393, 0xDD02F0B5}, /* 1e-116 */
+    {0xFC2C3F38, 0x41F17C67, 0xBBAC2078, 0xD443ACE2}, /* 1e-115 */
+    {0x9D9BA783, 0x2936EDC0, 0xD54B944B, 0x84AA4C0D}, /* 1e-114 */
+    {0xC5029163, 0xF384A931, 0x0A9E795E, 0x65D4DF11}, /* 1e-113 */
+    {0xF64335BC, 0xF065D37D, 0x4D4617B5, 0xFF4A16D5}, /* 1e-112 */
+    {0x99EA0196, 0x163FA42E, 0x504BCED1, 0xBF8E4E45}, /* 1e-111 */
+    {0xC06481FB, 0x9BCF8D39, 0xE45EC286, 0x2F71E1D6}, /* 1e-110 */
+    {0xF07DA27A, 0x82C37088, 0x5D767327, 0xBB4E5A4C}, /* 1e-109 */
+    {0x964E858C, 0x91BA2655, 0x3A6A07F8, 0xD510F86F}, /* 1e-108 */
+    {0xBBE226EF, 0xB628AFEA, 0x890489F7, 0x0A55368B}, /* 1e-107 */
+    {0xEADAB0AB, 0xA3B2DBE5, 0x2B45AC74, 0xCCEA842E}, /* 1e-106 */
+    {0x92C8AE6B, 0x464FC96F, 0x3B0B8BC9, 0x0012929D}, /* 1e-105 */
+    {0xB77ADA06, 0x17E3BBCB, 0x09CE6EBB, 0x40173744}, /* 1e-104 */
+    {0xE5599087, 0x9DDCAABD, 0xCC420A6A, 0x101D0515}, /* 1e-103 */
+    {0x8F57FA54, 0xC2A9EAB6, 0x9FA94682, 0x4A12232D}, /* 1e-102 */
+    {0xB32DF8E9, 0xF3546564, 0x47939822, 0xDC96ABF9}, /* 1e-101 */
+    {0xDFF97724, 0x70297EBD, 0x59787E2B, 0x93BC56F7}, /* 1e-100 */
+    {0x8BFBEA76, 0xC619EF36, 0x57EB4EDB, 0x3C55B65A}, /* 1e-99 */
+    {0xAEFAE514, 0x77A06B03, 0xEDE62292, 0x0B6B23F1}, /* 1e-98 */
+    {0xDAB99E59, 0x958885C4, 0xE95FAB36, 0x8E45ECED}, /* 1e-97 */
+    {0x88B402F7, 0xFD75539B, 0x11DBCB02, 0x18EBB414}, /* 1e-96 */
+    {0xAAE103B5, 0xFCD2A881, 0xD652BDC2, 0x9F26A119}, /* 1e-95 */
+    {0xD59944A3, 0x7C0752A2, 0x4BE76D33, 0x46F0495F}, /* 1e-94 */
+    {0x857FCAE6, 0x2D8493A5, 0x6F70A440, 0x0C562DDB}, /* 1e-93 */
+    {0xA6DFBD9F, 0xB8E5B88E, 0xCB4CCD50, 0x0F6BB952}, /* 1e-92 */
+    {0xD097AD07, 0xA71F26B2, 0x7E2000A4, 0x1346A7A7}, /* 1e-91 */
+    {0x825ECC24, 0xC873782F, 0x8ED40066, 0x8C0C28C8}, /* 1e-90 */
+    {0xA2F67F2D, 0xFA90563B, 0x72890080, 0x2F0F32FA}, /* 1e-89 */
+    {0xCBB41EF9, 0x79346BCA, 0x4F2B40A0, 0x3AD2FFB9}, /* 1e-88 */
+    {0xFEA126B7, 0xD78186BC, 0xE2F610C8, 0x4987BFA8}, /* 1e-87 */
+    {0x9F24B832, 0xE6B0F436, 0x0DD9CA7D, 0x2DF4D7C9}, /* 1e-86 */
+    {0xC6EDE63F, 0xA05D3143, 0x91503D1C, 0x79720DBB}, /* 1e-85 */
+    {0xF8A95FCF, 0x88747D94, 0x75A44C63, 0x97CE912A}, /* 1e-84 */
+    {0x9B69DBE1, 0xB548CE7C, 0xC986AFBE, 0x3EE11ABA}, /* 1e-83 */
+    {0xC24452DA, 0x229B021B, 0xFBE85BAD, 0xCE996168}, /* 1e-82 */
+    {0xF2D56790, 0xAB41C2A2, 0xFAE27299, 0x423FB9C3}, /* 1e-81 */
+    {0x97C560BA, 0x6B0919A5, 0xDCCD879F, 0xC967D41A}, /* 1e-80 */
+    {0xBDB6B8E9, 0x05CB600F, 0x5400E987, 0xBBC1C920}, /* 1e-79 */
+    {0xED246723, 0x473E3813, 0x290123E9, 0xAAB23B68}, /* 1e-78 */
+    {0x9436C076, 0x0C86E30B, 0xF9A0B672, 0x0AAF6521}, /* 1e-77 */
+    {0xB9447093, 0x8FA89BCE, 0xF808E40E, 0x8D5B3E69}, /* 1e-76 */
+    {0xE7958CB8, 0x7392C2C2, 0xB60B1D12, 0x30B20E04}, /* 1e-75 */
+    {0x90BD77F3, 0x483BB9B9, 0xB1C6F22B, 0x5E6F48C2}, /* 1e-74 */
+    {0xB4ECD5F0, 0x1A4AA828, 0x1E38AEB6, 0x360B1AF3}, /* 1e-73 */
+    {0xE2280B6C, 0x20DD5232, 0x25C6DA63, 0xC38DE1B0}, /* 1e-72 */
+    {0x8D590723, 0x948A535F, 0x579C487E, 0x5A38AD0E}, /* 1e-71 */
+    {0xB0AF48EC, 0x79ACE837, 0x2D835A9D, 0xF0C6D851}, /* 1e-70 */
+    {0xDCDB1B27, 0x98182244, 0xF8E43145, 0x6CF88E65}, /* 1e-69 */
+    {0x8A08F0F8, 0xBF0F156B, 0x1B8E9ECB, 0x641B58FF}, /* 1e-68 */
+    {0xAC8B2D36, 0xEED2DAC5, 0xE272467E, 0x3D222F3F}, /* 1e-67 */
+    {0xD7ADF884, 0xAA879177, 0x5B0ED81D, 0xCC6ABB0F}, /* 1e-66 */
+    {0x86CCBB52, 0xEA94BAEA, 0x98E94712, 0x9FC2B4E9}, /* 1e-65 */
+    {0xA87FEA27, 0xA539E9A5, 0x3F2398D7, 0x47B36224}, /* 1e-64 */
+    {0xD29FE4B1, 0x8E88640E, 0x8EEC7F0D, 0x19A03AAD}, /* 1e-63 */
+    {0x83A3EEEE, 0xF9153E89, 0x1953CF68, 0x300424AC}, /* 1e-62 */
+    {0xA48CEAAA, 0xB75A8E2B, 0x5FA8C342, 0x3C052DD7}, /* 1e-61 */
+    {0xCDB02555, 0x653131B6, 0x3792F412, 0xCB06794D}, /* 1e-60 */
+    {0x808E1755, 0x5F3EBF11, 0xE2BBD88B, 0xBEE40BD0}, /* 1e-59 */
+    {0xA0B19D2A, 0xB70E6ED6, 0x5B6ACEAE, 0xAE9D0EC4}, /* 1e-58 */
+    {0xC8DE0475, 0x64D20A8B, 0xF245825A, 0x5A445275}, /* 1e-57 */
+    {0xFB158592, 0xBE068D2E, 0xEED6E2F0, 0xF0D56712}, /* 1e-56 */
+    {0x9CED737B, 0xB6C4183D, 0x55464DD6, 0x9685606B}, /* 1e-55 */
+    {0xC428D05A, 0xA4751E4C, 0xAA97E14C, 0x3C26B886}, /* 1e-54 */
+    {0xF5330471, 0x4D9265DF, 0xD53DD99F, 0x4B3066A8}, /* 1e-53 */
+    {0x993FE2C6, 0xD07B7FAB, 0xE546A803, 0x8EFE4029}, /* 1e-52 */
+    {0xBF8FDB78, 0x849A5F96, 0xDE985204, 0x72BDD033}, /* 1e-51 */
+    {0xEF73D256, 0xA5C0F77C, 0x963E6685, 0x8F6D4440}, /* 1e-50 */
+    {0x95A86376, 0x27989AAD, 0xDDE70013, 0x79A44AA8}, /* 1e-49 */
+    {0xBB127C53, 0xB17EC159, 0x5560C018, 0x580D5D52}, /* 1e-48 */
+    {0xE9D71B68, 0x9DDE71AF, 0xAAB8F01E, 0x6E10B4A6}, /* 1e-47 */
+    {0x92267121, 0x62AB070D, 0xCAB39613, 0x04CA70E8}, /* 1e-46 */
+    {0xB6B00D69, 0xBB55C8D1, 0x3D607B97, 0xC5FD0D22}, /* 1e-45 */
+    {0xE45C10C4, 0x2A2B3B05, 0x8CB89A7D, 0xB77C506A}, /* 1e-44 */
+    {0x8EB98A7A, 0x9A5B04E3, 0x77F3608E, 0x92ADB242}, /* 1e-43 */
+    {0xB267ED19, 0x40F1C61C, 0x55F038B2, 0x37591ED3}, /* 1e-42 */
+    {0xDF01E85F, 0x912E37A3, 0x6B6C46DE, 0xC52F6688}, /* 1e-41 */
+    {0x8B61313B, 0xBABCE2C6, 0x2323AC4B, 0x3B3DA015}, /* 1e-40 */
+    {0xAE397D8A, 0xA96C1B77, 0xABEC975E, 0x0A0D081A}, /* 1e-39 */
+    {0xD9C7DCED, 0x53C72255, 0x96E7BD35, 0x8C904A21}, /* 1e-38 */
+    {0x881CEA14, 0x545C7575, 0x7E50D641, 0x77DA2E54}, /* 1e-37 */
+    {0xAA242499, 0x697392D2, 0xDDE50BD1, 0xD5D0B9E9}, /* 1e-36 */
+    {0xD4AD2DBF, 0xC3D07787, 0x955E4EC6, 0x4B44E864}, /* 1e-35 */
+    {0x84EC3C97, 0xDA624AB4, 0xBD5AF13B, 0xEF0B113E}, /* 1e-34 */
+    {0xA6274BBD, 0xD0FADD61, 0xECB1AD8A, 0xEACDD58E}, /* 1e-33 */
+    {0xCFB11EAD, 0x453994BA, 0x67DE18ED, 0xA5814AF2}, /* 1e-32 */
+    {0x81CEB32C, 0x4B43FCF4, 0x80EACF94, 0x8770CED7}, /* 1e-31 */
+    {0xA2425FF7, 0x5E14FC31, 0xA1258379, 0xA94D028D}, /* 1e-30 */
+    {0xCAD2F7F5, 0x359A3B3E, 0x096EE458, 0x13A04330}, /* 1e-29 */
+    {0xFD87B5F2, 0x8300CA0D, 0x8BCA9D6E, 0x188853FC}, /* 1e-28 */
+    {0x9E74D1B7, 0x91E07E48, 0x775EA264, 0xCF55347D}, /* 1e-27 */
+    {0xC6120625, 0x76589DDA, 0x95364AFE, 0x032A819D}, /* 1e-26 */
+    {0xF79687AE, 0xD3EEC551, 0x3A83DDBD, 0x83F52204}, /* 1e-25 */
+    {0x9ABE14CD, 0x44753B52, 0xC4926A96, 0x72793542}, /* 1e-24 */
+    {0xC16D9A00, 0x95928A27, 0x75B7053C, 0x0F178293}, /* 1e-23 */
+    {0xF1C90080, 0xBAF72CB1, 0x5324C68B, 0x12DD6338}, /* 1e-22 */
+    {0x971DA050, 0x74DA7BEE, 0xD3F6FC16, 0xEBCA5E03}, /* 1e-21 */
+    {0xBCE50864, 0x92111AEA, 0x88F4BB1C, 0xA6BCF584}, /* 1e-20 */
+    {0xEC1E4A7D, 0xB69561A5, 0x2B31E9E3, 0xD06C32E5}, /* 1e-19 */
+    {0x9392EE8E, 0x921D5D07, 0x3AFF322E, 0x62439FCF}, /* 1e-18 */
+    {0xB877AA32, 0x36A4B449, 0x09BEFEB9, 0xFAD487C2}, /* 1e-17 */
+    {0xE69594BE, 0xC44DE15B, 0x4C2EBE68, 0x7989A9B3}, /* 1e-16 */
+    {0x901D7CF7, 0x3AB0ACD9, 0x0F9D3701, 0x4BF60A10}, /* 1e-15 */
+    {0xB424DC35, 0x095CD80F, 0x538484C1, 0x9EF38C94}, /* 1e-14 */
+    {0xE12E1342, 0x4BB40E13, 0x2865A5F2, 0x06B06FB9}, /* 1e-13 */
+    {0x8CBCCC09, 0x6F5088CB, 0xF93F87B7, 0x442E45D3}, /* 1e-12 */
+    {0xAFEBFF0B, 0xCB24AAFE, 0xF78F69A5, 0x1539D748}, /* 1e-11 */
+    {0xDBE6FECE, 0xBDEDD5BE, 0xB573440E, 0x5A884D1B}, /* 1e-10 */
+    {0x89705F41, 0x36B4A597, 0x31680A88, 0xF8953030}, /* 1e-9 */
+    {0xABCC7711, 0x8461CEFC, 0xFDC20D2B, 0x36BA7C3D}, /* 1e-8 */
+    {0xD6BF94D5, 0xE57A42BC, 0x3D329076, 0x04691B4C}, /* 1e-7 */
+    {0x8637BD05, 0xAF6C69B5, 0xA63F9A49, 0xC2C1B10F}, /* 1e-6 */
+    {0xA7C5AC47, 0x1B478423, 0x0FCF80DC, 0x33721D53}, /* 1e-5 */
+    {0xD1B71758, 0xE219652B, 0xD3C36113, 0x404EA4A8}, /* 1e-4 */
+    {0x83126E97, 0x8D4FDF3B, 0x645A1CAC, 0x083126E9}, /* 1e-3 */
+    {0xA3D70A3D, 0x70A3D70A, 0x3D70A3D7, 0x0A3D70A3}, /* 1e-2 */
+    {0xCCCCCCCC, 0xCCCCCCCC, 0xCCCCCCCC, 0xCCCCCCCC}, /* 1e-1 */
+    {0x80000000, 0x00000000, 0x00000000, 0x00000000}, /* 1e0 */
+    {0xA0000000, 0x00000000, 0x00000000, 0x00000000}, /* 1e1 */
+    {0xC8000000, 0x00000000, 0x00000000, 0x00000000}, /* 1e2 */
+    {0xFA000000, 0x00000000, 0x00000000, 0x00000000}, /* 1e3 */
+    {0x9C400000, 0x00000000, 0x00000000, 0x00000000}, /* 1e4 */
+    {0xC3500000, 0x00000000, 0x00000000, 0x00000000}, /* 1e5 */
+    {0xF4240000, 0x00000000, 0x00000000, 0x00000000}, /* 1e6 */
+    {0x98968000, 0x00000000, 0x00000000, 0x00000000}, /* 1e7 */
+    {0xBEBC2000, 0x00000000, 0x00000000, 0x00000000}, /* 1e8 */
+    {0xEE6B2800, 0x00000000, 0x00000000, 0x00000000}, /* 1e9 */
+    {0x9502F900, 0x00000000, 0x00000000, 0x00000000}, /* 1e10 */
+    {0xBA43B740, 0x00000000, 0x00000000, 0x00000000}, /* 1e11 */
+    {0xE8D4A510, 0x00000000, 0x00000000, 0x00000000}, /* 1e12 */
+    {0x9184E72A, 0x00000000, 0x00000000, 0x00000000}, /* 1e13 */
+    {0xB5E620F4, 0x80000000, 0x00000000, 0x00000000}, /* 1e14 */
+    {0xE35FA931, 0xA0000000, 0x00000000, 0x00000000}, /* 1e15 */
+    {0x8E1BC9BF, 0x04000000, 0x00000000, 0x00000000}, /* 1e16 */
+    {0xB1A2BC2E, 0xC5000000, 0x00000000, 0x00000000}, /* 1e17 */
+    {0xDE0B6B3A, 0x76400000, 0x00000000, 0x00000000}, /* 1e18 */
+    {0x8AC72304, 0x89E80000, 0x00000000, 0x00000000}, /* 1e19 */
+    {0xAD78EBC5, 0xAC620000, 0x00000000, 0x00000000}, /* 1e20 */
+    {0xD8D726B7, 0x177A8000, 0x00000000, 0x00000000}, /* 1e21 */
+    {0x87867832, 0x6EAC9000, 0x00000000, 0x00000000}, /* 1e22 */
+    {0xA968163F, 0x0A57B400, 0x00000000, 0x00000000}, /* 1e23 */
+    {0xD3C21BCE, 0xCCEDA100, 0x00000000, 0x00000000}, /* 1e24 */
+    {0x84595161, 0x401484A0, 0x00000000, 0x00000000}, /* 1e25 */
+    {0xA56FA5B9, 0x9019A5C8, 0x00000000, 0x00000000}, /* 1e26 */
+    {0xCECB8F27, 0xF4200F3A, 0x00000000, 0x00000000}, /* 1e27 */
+    {0x813F3978, 0xF8940984, 0x40000000, 0x00000000}, /* 1e28 */
+    {0xA18F07D7, 0x36B90BE5, 0x50000000, 0x00000000}, /* 1e29 */
+    {0xC9F2C9CD, 0x04674EDE, 0xA4000000, 0x00000000}, /* 1e30 */
+    {0xFC6F7C40, 0x45812296, 0x4D000000, 0x00000000}, /* 1e31 */
+    {0x9DC5ADA8, 0x2B70B59D, 0xF0200000, 0x00000000}, /* 1e32 */
+    {0xC5371912, 0x364CE305, 0x6C280000, 0x00000000}, /* 1e33 */
+    {0xF684DF56, 0xC3E01BC6, 0xC7320000, 0x00000000}, /* 1e34 */
+    {0x9A130B96, 0x3A6C115C, 0x3C7F4000, 0x00000000}, /* 1e35 */
+    {0xC097CE7B, 0xC90715B3, 0x4B9F1000, 0x00000000}, /* 1e36 */
+    {0xF0BDC21A, 0xBB48DB20, 0x1E86D400, 0x00000000}, /* 1e37 */
+    {0x96769950, 0xB50D88F4, 0x13144480, 0x00000000}, /* 1e38 */
+    {0xBC143FA4, 0xE250EB31, 0x17D955A0, 0x00000000}, /* 1e39 */
+    {0xEB194F8E, 0x1AE525FD, 0x5DCFAB08, 0x00000000}, /* 1e40 */
+    {0x92EFD1B8, 0xD0CF37BE, 0x5AA1CAE5, 0x00000000}, /* 1e41 */
+    {0xB7ABC627, 0x050305AD, 0xF14A3D9E, 0x40000000}, /* 1e42 */
+    {0xE596B7B0, 0xC643C719, 0x6D9CCD05, 0xD0000000}, /* 1e43 */
+    {0x8F7E32CE, 0x7BEA5C6F, 0xE4820023, 0xA2000000}, /* 1e44 */
+    {0xB35DBF82, 0x1AE4F38B, 0xDDA2802C, 0x8A800000}, /* 1e45 */
+    {0xE0352F62, 0xA19E306E, 0xD50B2037, 0xAD200000}, /* 1e46 */
+    {0x8C213D9D, 0xA502DE45, 0x4526F422, 0xCC340000}, /* 1e47 */
+    {0xAF298D05, 0x0E4395D6, 0x9670B12B, 0x7F410000}, /* 1e48 */
+    {0xDAF3F046, 0x51D47B4C, 0x3C0CDD76, 0x5F114000}, /* 1e49 */
+    {0x88D8762B, 0xF324CD0F, 0xA5880A69, 0xFB6AC800}, /* 1e50 */
+    {0xAB0E93B6, 0xEFEE0053, 0x8EEA0D04, 0x7A457A00}, /* 1e51 */
+    {0xD5D238A4, 0xABE98068, 0x72A49045, 0x98D6D880}, /* 1e52 */
+    {0x85A36366, 0xEB71F041, 0x47A6DA2B, 0x7F864750}, /* 1e53 */
+    {0xA70C3C40, 0xA64E6C51, 0x999090B6, 0x5F67D924}, /* 1e54 */
+    {0xD0CF4B50, 0xCFE20765, 0xFFF4B4E3, 0xF741CF6D}, /* 1e55 */
+    {0x82818F12, 0x81ED449F, 0xBFF8F10E, 0x7A8921A4}, /* 1e56 */
+    {0xA321F2D7, 0x226895C7, 0xAFF72D52, 0x192B6A0D}, /* 1e57 */
+    {0xCBEA6F8C, 0xEB02BB39, 0x9BF4F8A6, 0x9F764490}, /* 1e58 */
+    {0xFEE50B70, 0x25C36A08, 0x02F236D0, 0x4753D5B4}, /* 1e59 */
+    {0x9F4F2726, 0x179A2245, 0x01D76242, 0x2C946590}, /* 1e60 */
+    {0xC722F0EF, 0x9D80AAD6, 0x424D3AD2, 0xB7B97EF5}, /* 1e61 */
+    {0xF8EBAD2B, 0x84E0D58B, 0xD2E08987, 0x65A7DEB2}, /* 1e62 */
+    {0x9B934C3B, 0x330C8577, 0x63CC55F4, 0x9F88EB2F}, /* 1e63 */
+    {0xC2781F49, 0xFFCFA6D5, 0x3CBF6B71, 0xC76B25FB}, /* 1e64 */
+    {0xF316271C, 0x7FC3908A, 0x8BEF464E, 0x3945EF7A}, /* 1e65 */
+    {0x97EDD871, 0xCFDA3A56, 0x97758BF0, 0xE3CBB5AC}, /* 1e66 */
+    {0xBDE94E8E, 0x43D0C8EC, 0x3D52EEED, 0x1CBEA317}, /* 1e67 */
+    {0xED63A231, 0xD4C4FB27, 0x4CA7AAA8, 0x63EE4BDD}, /* 1e68 */
+    {0x945E455F, 0x24FB1CF8, 0x8FE8CAA9, 0x3E74EF6A}, /* 1e69 */
+    {0xB975D6B6, 0xEE39E436, 0xB3E2FD53, 0x8E122B44}, /* 1e70 */
+    {0xE7D34C64, 0xA9C85D44, 0x60DBBCA8, 0x7196B616}, /* 1e71 */
+    {0x90E40FBE, 0xEA1D3A4A, 0xBC8955E9, 0x46FE31CD}, /* 1e72 */
+    {0xB51D13AE, 0xA4A488DD, 0x6BABAB63, 0x98BDBE41}, /* 1e73 */
+    {0xE264589A, 0x4DCDAB14, 0xC696963C, 0x7EED2DD1}, /* 1e74 */
+    {0x8D7EB760, 0x70A08AEC, 0xFC1E1DE5, 0xCF543CA2}, /* 1e75 */
+    {0xB0DE6538, 0x8CC8ADA8, 0x3B25A55F, 0x43294BCB}, /* 1e76 */
+    {0xDD15FE86, 0xAFFAD912, 0x49EF0EB7, 0x13F39EBE}, /* 1e77 */
+    {0x8A2DBF14, 0x2DFCC7AB, 0x6E356932, 0x6C784337}, /* 1e78 */
+    {0xACB92ED9, 0x397BF996, 0x49C2C37F, 0x07965404}, /* 1e79 */
+    {0xD7E77A8F, 0x87DAF7FB, 0xDC33745E, 0xC97BE906}, /* 1e80 */
+    {0x86F0AC99, 0xB4E8DAFD, 0x69A028BB, 0x3DED71A3}, /* 1e81 */
+    {0xA8ACD7C0, 0x222311BC, 0xC40832EA, 0x0D68CE0C}, /* 1e82 */
+    {0xD2D80DB0, 0x2AABD62B, 0xF50A3FA4, 0x90C30190}, /* 1e83 */
+    {0x83C7088E, 0x1AAB65DB, 0x792667C6, 0xDA79E0FA}, /* 1e84 */
+    {0xA4B8CAB1, 0xA1563F52, 0x577001B8, 0x91185938}, /* 1e85 */
+    {0xCDE6FD5E, 0x09ABCF26, 0xED4C0226, 0xB55E6F86}, /* 1e86 */
+    {0x80B05E5A, 0xC60B6178, 0x544F8158, 0x315B05B4}, /* 1e87 */
+    {0xA0DC75F1, 0x778E39D6, 0x696361AE, 0x3DB1C721}, /* 1e88 */
+    {0xC913936D, 0xD571C84C, 0x03BC3A19, 0xCD1E38E9}, /* 1e89 */
+    {0xFB587849, 0x4ACE3A5F, 0x04AB48A0, 0x4065C723}, /* 1e90 */
+    {0x9D174B2D, 0xCEC0E47B, 0x62EB0D64, 0x283F9C76}, /* 1e91 */
+    {0xC45D1DF9, 0x42711D9A, 0x3BA5D0BD, 0x324F8394}, /* 1e92 */
+    {0xF5746577, 0x930D6500, 0xCA8F44EC, 0x7EE36479}, /* 1e93 */
+    {0x9968BF6A, 0xBBE85F20, 0x7E998B13, 0xCF4E1ECB}, /* 1e94 */
+    {0xBFC2EF45, 0x6AE276E8, 0x9E3FEDD8, 0xC321A67E}, /* 1e95 */
+    {0xEFB3AB16, 0xC59B14A2, 0xC5CFE94E, 0xF3EA101E}, /* 1e96 */
+    {0x95D04AEE, 0x3B80ECE5, 0xBBA1F1D1, 0x58724A12}, /* 1e97 */
+    {0xBB445DA9, 0xCA61281F, 0x2A8A6E45, 0xAE8EDC97}, /* 1e98 */
+    {0xEA157514, 0x3CF97226, 0xF52D09D7, 0x1A3293BD}, /* 1e99 */
+    {0x924D692C, 0xA61BE758, 0x593C2626, 0x705F9C56}, /* 1e100 */
+    {0xB6E0C377, 0xCFA2E12E, 0x6F8B2FB0, 0x0C77836C}, /* 1e101 */
+    {0xE498F455, 0xC38B997A, 0x0B6DFB9C, 0x0F956447}, /* 1e102 */
+    {0x8EDF98B5, 0x9A373FEC, 0x4724BD41, 0x89BD5EAC}, /* 1e103 */
+    {0xB2977EE3, 0x00C50FE7, 0x58EDEC91, 0xEC2CB657}, /* 1e104 */
+    {0xDF3D5E9B, 0xC0F653E1, 0x2F2967B6, 0x6737E3ED}, /* 1e105 */
+    {0x8B865B21, 0x5899F46C, 0xBD79E0D2, 0x0082EE74}, /* 1e106 */
+    {0xAE67F1E9, 0xAEC07187, 0xECD85906, 0x80A3AA11}, /* 1e107 */
+    {0xDA01EE64, 0x1A708DE9, 0xE80E6F48, 0x20CC9495}, /* 1e108 */
+    {0x884134FE, 0x908658B2, 0x3109058D, 0x147FDCDD}, /* 1e109 */
+    {0xAA51823E, 0x34A7EEDE, 0xBD4B46F0, 0x599FD415}, /* 1e110 */
+    {0xD4E5E2CD, 0xC1D1EA96, 0x6C9E18AC, 0x7007C91A}, /* 1e111 */
+    {0x850FADC0, 0x9923329E, 0x03E2CF6B, 0xC604DDB0}, /* 1e112 */
+    {0xA6539930, 0xBF6BFF45, 0x84DB8346, 0xB786151C}, /* 1e113 */
+    {0xCFE87F7C, 0xEF46FF16, 0xE6126418, 0x65679A63}, /* 1e114 */
+    {0x81F14FAE, 0x158C5F6E, 0x4FCB7E8F, 0x3F60C07E}, /* 1e115 */
+    {0xA26DA399, 0x9AEF7749, 0xE3BE5E33, 0x0F38F09D}, /* 1e116 */
+    {0xCB090C80, 0x01AB551C, 0x5CADF5BF, 0xD3072CC5}, /* 1e117 */
+    {0xFDCB4FA0, 0x02162A63, 0x73D9732F, 0xC7C8F7F6}, /* 1e118 */
+    {0x9E9F11C4, 0x014DDA7E, 0x2867E7FD, 0xDCDD9AFA}, /* 1e119 */
+    {0xC646D635, 0x01A1511D, 0xB281E1FD, 0x541501B8}, /* 1e120 */
+    {0xF7D88BC2, 0x4209A565, 0x1F225A7C, 0xA91A4226}, /* 1e121 */
+    {0x9AE75759, 0x6946075F, 0x3375788D, 0xE9B06958}, /* 1e122 */
+    {0xC1A12D2F, 0xC3978937, 0x0052D6B1, 0x641C83AE}, /* 1e123 */
+    {0xF209787B, 0xB47D6B84, 0xC0678C5D, 0xBD23A49A}, /* 1e124 */
+    {0x9745EB4D, 0x50CE6332, 0xF840B7BA, 0x963646E0}, /* 1e125 */
+    {0xBD176620, 0xA501FBFF, 0xB650E5A9, 0x3BC3D898}, /* 1e126 */
+    {0xEC5D3FA8, 0xCE427AFF, 0xA3E51F13, 0x8AB4CEBE}, /* 1e127 */
+    {0x93BA47C9, 0x80E98CDF, 0xC66F336C, 0x36B10137}, /* 1e128 */
+    {0xB8A8D9BB, 0xE123F017, 0xB80B0047, 0x445D4184}, /* 1e129 */
+    {0xE6D3102A, 0xD96CEC1D, 0xA60DC059, 0x157491E5}, /* 1e130 */
+    {0x9043EA1A, 0xC7E41392, 0x87C89837, 0xAD68DB2F}, /* 1e131 */
+    {0xB454E4A1, 0x79DD1877, 0x29BABE45, 0x98C311FB}, /* 1e132 */
+    {0xE16A1DC9, 0xD8545E94, 0xF4296DD6, 0xFEF3D67A}, /* 1e133 */
+    {0x8CE2529E, 0x2734BB1D, 0x1899E4A6, 0x5F58660C}, /* 1e134 */
+    {0xB01AE745, 0xB101E9E4, 0x5EC05DCF, 0xF72E7F8F}, /* 1e135 */
+    {0xDC21A117, 0x1D42645D, 0x76707543, 0xF4FA1F73}, /* 1e136 */
+    {0x899504AE, 0x72497EBA, 0x6A06494A, 0x791C53A8}, /* 1e137 */
+    {0xABFA45DA, 0x0EDBDE69, 0x0487DB9D, 0x17636892}, /* 1e138 */
+    {0xD6F8D750, 0x9292D603, 0x45A9D284, 0x5D3C42B6}, /* 1e139 */
+    {0x865B8692, 0x5B9BC5C2, 0x0B8A2392, 0xBA45A9B2}, /* 1e140 */
+    {0xA7F26836, 0xF282B732, 0x8E6CAC77, 0x68D7141E}, /* 1e141 */
+    {0xD1EF0244, 0xAF2364FF, 0x3207D795, 0x430CD926}, /* 1e142 */
+    {0x8335616A, 0xED761F1F, 0x7F44E6BD, 0x49E807B8}, /* 1e143 */
+    {0xA402B9C5, 0xA8D3A6E7, 0x5F16206C, 0x9C6209A6}, /* 1e144 */
+    {0xCD036837, 0x130890A1, 0x36DBA887, 0xC37A8C0F}, /* 1e145 */
+    {0x80222122, 0x6BE55A64, 0xC2494954, 0xDA2C9789}, /* 1e146 */
+    {0xA02AA96B, 0x06DEB0FD, 0xF2DB9BAA, 0x10B7BD6C}, /* 1e147 */
+    {0xC83553C5, 0xC8965D3D, 0x6F928294, 0x94E5ACC7}, /* 1e148 */
+    {0xFA42A8B7, 0x3ABBF48C, 0xCB772339, 0xBA1F17F9}, /* 1e149 */
+    {0x9C69A972, 0x84B578D7, 0xFF2A7604, 0x14536EFB}, /* 1e150 */
+    {0xC38413CF, 0x25E2D70D, 0xFEF51385, 0x19684ABA}, /* 1e151 */
+    {0xF46518C2, 0xEF5B8CD1, 0x7EB25866, 0x5FC25D69}, /* 1e152 */
+    {0x98BF2F79, 0xD5993802, 0xEF2F773F, 0xFBD97A61}, /* 1e153 */
+    {0xBEEEFB58, 0x4AFF8603, 0xAAFB550F, 0xFACFD8FA}, /* 1e154 */
+    {0xEEAABA2E, 0x5DBF6784, 0x95BA2A53, 0xF983CF38}, /* 1e155 */
+    {0x952AB45C, 0xFA97A0B2, 0xDD945A74, 0x7BF26183}, /* 1e156 */
+    {0xBA756174, 0x393D88DF, 0x94F97111, 0x9AEEF9E4}, /* 1e157 */
+    {0xE912B9D1, 0x478CEB17, 0x7A37CD56, 0x01AAB85D}, /* 1e158 */
+    {0x91ABB422, 0xCCB812EE, 0xAC62E055, 0xC10AB33A}, /* 1e159 */
+    {0xB616A12B, 0x7FE617AA, 0x577B986B, 0x314D6009}, /* 1e160 */
+    {0xE39C4976, 0x5FDF9D94, 0xED5A7E85, 0xFDA0B80B}, /* 1e161 */
+    {0x8E41ADE9, 0xFBEBC27D, 0x14588F13, 0xBE847307}, /* 1e162 */
+    {0xB1D21964, 0x7AE6B31C, 0x596EB2D8, 0xAE258FC8}, /* 1e163 */
+    {0xDE469FBD, 0x99A05FE3, 0x6FCA5F8E, 0xD9AEF3BB}, /* 1e164 */
+    {0x8AEC23D6, 0x80043BEE, 0x25DE7BB9, 0x480D5854}, /* 1e165 */
+    {0xADA72CCC, 0x20054AE9, 0xAF561AA7, 0x9A10AE6A}, /* 1e166 */
+    {0xD910F7FF, 0x28069DA4, 0x1B2BA151, 0x8094DA04}, /* 1e167 */
+    {0x87AA9AFF, 0x79042286, 0x90FB44D2, 0xF05D0842}, /* 1e168 */
+    {0xA99541BF, 0x57452B28, 0x353A1607, 0xAC744A53}, /* 1e169 */
+    {0xD3FA922F, 0x2D1675F2, 0x42889B89, 0x97915CE8}, /* 1e170 */
+    {0x847C9B5D, 0x7C2E09B7, 0x69956135, 0xFEBADA11}, /* 1e171 */
+    {0xA59BC234, 0xDB398C25, 0x43FAB983, 0x7E699095}, /* 1e172 */
+    {0xCF02B2C2, 0x1207EF2E, 0x94F967E4, 0x5E03F4BB}, /* 1e173 */
+    {0x8161AFB9, 0x4B44F57D, 0x1D1BE0EE, 0xBAC278F5}, /* 1e174 */
+    {0xA1BA1BA7, 0x9E1632DC, 0x6462D92A, 0x69731732}, /* 1e175 */
+    {0xCA28A291, 0x859BBF93, 0x7D7B8F75, 0x03CFDCFE}, /* 1e176 */
+    {0xFCB2CB35, 0xE702AF78, 0x5CDA7352, 0x44C3D43E}, /* 1e177 */
+    {0x9DEFBF01, 0xB061ADAB, 0x3A088813, 0x6AFA64A7}, /* 1e178 */
+    {0xC56BAEC2, 0x1C7A1916, 0x088AAA18, 0x45B8FDD0}, /* 1e179 */
+    {0xF6C69A72, 0xA3989F5B, 0x8AAD549E, 0x57273D45}, /* 1e180 */
+    {0x9A3C2087, 0xA63F6399, 0x36AC54E2, 0xF678864B}, /* 1e181 */
+    {0xC0CB28A9, 0x8FCF3C7F, 0x84576A1B, 0xB416A7DD}, /* 1e182 */
+    {0xF0FDF2D3, 0xF3C30B9F, 0x656D44A2, 0xA11C51D5}, /* 1e183 */
+    {0x969EB7C4, 0x7859E743, 0x9F644AE5, 0xA4B1B325}, /* 1e184 */
+    {0xBC4665B5, 0x96706114, 0x873D5D9F, 0x0DDE1FEE}, /* 1e185 */
+    {0xEB57FF22, 0xFC0C7959, 0xA90CB506, 0xD155A7EA}, /* 1e186 */
+    {0x9316FF75, 0xDD87CBD8, 0x09A7F124, 0x42D588F2}, /* 1e187 */
+    {0xB7DCBF53, 0x54E9BECE, 0x0C11ED6D, 0x538AEB2F}, /* 1e188 */
+    {0xE5D3EF28, 0x2A242E81, 0x8F1668C8, 0xA86DA5FA}, /* 1e189 */
+    {0x8FA47579, 0x1A569D10, 0xF96E017D, 0x694487BC}, /* 1e190 */
+    {0xB38D92D7, 0x60EC4455, 0x37C981DC, 0xC395A9AC}, /* 1e191 */
+    {0xE070F78D, 0x3927556A, 0x85BBE253, 0xF47B1417}, /* 1e192 */
+    {0x8C469AB8, 0x43B89562, 0x93956D74, 0x78CCEC8E}, /* 1e193 */
+    {0xAF584166, 0x54A6BABB, 0x387AC8D1, 0x970027B2}, /* 1e194 */
+    {0xDB2E51BF, 0xE9D0696A, 0x06997B05, 0xFCC0319E}, /* 1e195 */
+    {0x88FCF317, 0xF22241E2, 0x441FECE3, 0xBDF81F03}, /* 1e196 */
+    {0xAB3C2FDD, 0xEEAAD25A, 0xD527E81C, 0xAD7626C3}, /* 1e197 */
+    {0xD60B3BD5, 0x6A5586F1, 0x8A71E223, 0xD8D3B074}, /* 1e198 */
+    {0x85C70565, 0x62757456, 0xF6872D56, 0x67844E49}, /* 1e199 */
+    {0xA738C6BE, 0xBB12D16C, 0xB428F8AC, 0x016561DB}, /* 1e200 */
+    {0xD106F86E, 0x69D785C7, 0xE13336D7, 0x01BEBA52}, /* 1e201 */
+    {0x82A45B45, 0x0226B39C, 0xECC00246, 0x61173473}, /* 1e202 */
+    {0xA34D7216, 0x42B06084, 0x27F002D7, 0xF95D0190}, /* 1e203 */
+    {0xCC20CE9B, 0xD35C78A5, 0x31EC038D, 0xF7B441F4}, /* 1e204 */
+    {0xFF290242, 0xC83396CE, 0x7E670471, 0x75A15271}, /* 1e205 */
+    {0x9F79A169, 0xBD203E41, 0x0F0062C6, 0xE984D386}, /* 1e206 */
+    {0xC75809C4, 0x2C684DD1, 0x52C07B78, 0xA3E60868}, /* 1e207 */
+    {0xF92E0C35, 0x37826145, 0xA7709A56, 0xCCDF8A82}, /* 1e208 */
+    {0x9BBCC7A1, 0x42B17CCB, 0x88A66076, 0x400BB691}, /* 1e209 */
+    {0xC2ABF989, 0x935DDBFE, 0x6ACFF893, 0xD00EA435}, /* 1e210 */
+    {0xF356F7EB, 0xF83552FE, 0x0583F6B8, 0xC4124D43}, /* 1e211 */
+    {0x98165AF3, 0x7B2153DE, 0xC3727A33, 0x7A8B704A}, /* 1e212 */
+    {0xBE1BF1B0, 0x59E9A8D6, 0x744F18C0, 0x592E4C5C}, /* 1e213 */
+    {0xEDA2EE1C, 0x7064130C, 0x1162DEF0, 0x6F79DF73}, /* 1e214 */
+    {0x9485D4D1, 0xC63E8BE7, 0x8ADDCB56, 0x45AC2BA8}, /* 1e215 */
+    {0xB9A74A06, 0x37CE2EE1, 0x6D953E2B, 0xD7173692}, /* 1e216 */
+    {0xE8111C87, 0xC5C1BA99, 0xC8FA8DB6, 0xCCDD0437}, /* 1e217 */
+    {0x910AB1D4, 0xDB9914A0, 0x1D9C9892, 0x400A22A2}, /* 1e218 */
+    {0xB54D5E4A, 0x127F59C8, 0x2503BEB6, 0xD00CAB4B}, /* 1e219 */
+    {0xE2A0B5DC, 0x971F303A, 0x2E44AE64, 0x840FD61D}, /* 1e220 */
+    {0x8DA471A9, 0xDE737E24, 0x5CEAECFE, 0xD289E5D2}, /* 1e221 */
+    {0xB10D8E14, 0x56105DAD, 0x7425A83E, 0x872C5F47}, /* 1e222 */
+    {0xDD50F199, 0x6B947518, 0xD12F124E, 0x28F77719}, /* 1e223 */
+    {0x8A5296FF, 0xE33CC92F, 0x82BD6B70, 0xD99AAA6F}, /* 1e224 */
+    {0xACE73CBF, 0xDC0BFB7B, 0x636CC64D, 0x1001550B}, /* 1e225 */
+    {0xD8210BEF, 0xD30EFA5A, 0x3C47F7E0, 0x5401AA4E}, /* 1e226 */
+    {0x8714A775, 0xE3E95C78, 0x65ACFAEC, 0x34810A71}, /* 1e227 */
+    {0xA8D9D153, 0x5CE3B396, 0x7F1839A7, 0x41A14D0D}, /* 1e228 */
+    {0xD31045A8, 0x341CA07C, 0x1EDE4811, 0x1209A050}, /* 1e229 */
+    {0x83EA2B89, 0x2091E44D, 0x934AED0A, 0xAB460432}, /* 1e230 */
+    {0xA4E4B66B, 0x68B65D60, 0xF81DA84D, 0x5617853F}, /* 1e231 */
+    {0xCE1DE406, 0x42E3F4B9, 0x36251260, 0xAB9D668E}, /* 1e232 */
+    {0x80D2AE83, 0xE9CE78F3, 0xC1D72B7C, 0x6B426019}, /* 1e233 */
+    {0xA1075A24, 0xE4421730, 0xB24CF65B, 0x8612F81F}, /* 1e234 */
+    {0xC94930AE, 0x1D529CFC, 0xDEE033F2, 0x6797B627}, /* 1e235 */
+    {0xFB9B7CD9, 0xA4A7443C, 0x169840EF, 0x017DA3B1}, /* 1e236 */
+    {0x9D412E08, 0x06E88AA5, 0x8E1F2895, 0x60EE864E}, /* 1e237 */
+    {0xC491798A, 0x08A2AD4E, 0xF1A6F2BA, 0xB92A27E2}, /* 1e238 */
+    {0xF5B5D7EC, 0x8ACB58A2, 0xAE10AF69, 0x6774B1DB}, /* 1e239 */
+    {0x9991A6F3, 0xD6BF1765, 0xACCA6DA1, 0xE0A8EF29}, /* 1e240 */
+    {0xBFF610B0, 0xCC6EDD3F, 0x17FD090A, 0x58D32AF3}, /* 1e241 */
+    {0xEFF394DC, 0xFF8A948E, 0xDDFC4B4C, 0xEF07F5B0}, /* 1e242 */
+    {0x95F83D0A, 0x1FB69CD9, 0x4ABDAF10, 0x1564F98E}, /* 1e243 */
+    {0xBB764C4C, 0xA7A4440F, 0x9D6D1AD4, 0x1ABE37F1}, /* 1e244 */
+    {0xEA53DF5F, 0xD18D5513, 0x84C86189, 0x216DC5ED}, /* 1e245 */
+    {0x92746B9B, 0xE2F8552C, 0x32FD3CF5, 0xB4E49BB4}, /* 1e246 */
+    {0xB7118682, 0xDBB66A77, 0x3FBC8C33, 0x221DC2A1}, /* 1e247 */
+    {0xE4D5E823, 0x92A40515, 0x0FABAF3F, 0xEAA5334A}, /* 1e248 */
+    {0x8F05B116, 0x3BA6832D, 0x29CB4D87, 0xF2A7400E}, /* 1e249 */
+    {0xB2C71D5B, 0xCA9023F8, 0x743E20E9, 0xEF511012}, /* 1e250 */
+    {0xDF78E4B2, 0xBD342CF6, 0x914DA924, 0x6B255416}, /* 1e251 */
+    {0x8BAB8EEF, 0xB6409C1A, 0x1AD089B6, 0xC2F7548E}, /* 1e252 */
+    {0xAE9672AB, 0xA3D0C320, 0xA184AC24, 0x73B529B1}, /* 1e253 */
+    {0xDA3C0F56, 0x8CC4F3E8, 0xC9E5D72D, 0x90A2741E}, /* 1e254 */
+    {0x88658996, 0x17FB1871, 0x7E2FA67C, 0x7A658892}, /* 1e255 */
+    {0xAA7EEBFB, 0x9DF9DE8D, 0xDDBB901B, 0x98FEEAB7}, /* 1e256 */
+    {0xD51EA6FA, 0x85785631, 0x552A7422, 0x7F3EA565}, /* 1e257 */
+    {0x8533285C, 0x936B35DE, 0xD53A8895, 0x8F87275F}, /* 1e258 */
+    {0xA67FF273, 0xB8460356, 0x8A892ABA, 0xF368F137}, /* 1e259 */
+    {0xD01FEF10, 0xA657842C, 0x2D2B7569, 0xB0432D85}, /* 1e260 */
+    {0x8213F56A, 0x67F6B29B, 0x9C3B2962, 0x0E29FC73}, /* 1e261 */
+    {0xA298F2C5, 0x01F45F42, 0x8349F3BA, 0x91B47B8F}, /* 1e262 */
+    {0xCB3F2F76, 0x42717713, 0x241C70A9, 0x36219A73}, /* 1e263 */
+    {0xFE0EFB53, 0xD30DD4D7, 0xED238CD3, 0x83AA0110}, /* 1e264 */
+    {0x9EC95D14, 0x63E8A506, 0xF4363804, 0x324A40AA}, /* 1e265 */
+    {0xC67BB459, 0x7CE2CE48, 0xB143C605, 0x3EDCD0D5}, /* 1e266 */
+    {0xF81AA16F, 0xDC1B81DA, 0xDD94B786, 0x8E94050A}, /* 1e267 */
+    {0x9B10A4E5, 0xE9913128, 0xCA7CF2B4, 0x191C8326}, /* 1e268 */
+    {0xC1D4CE1F, 0x63F57D72, 0xFD1C2F61, 0x1F63A3F0}, /* 1e269 */
+    {0xF24A01A7, 0x3CF2DCCF, 0xBC633B39, 0x673C8CEC}, /* 1e270 */
+    {0x976E4108, 0x8617CA01, 0xD5BE0503, 0xE085D813}, /* 1e271 */
+    {0xBD49D14A, 0xA79DBC82, 0x4B2D8644, 0xD8A74E18}, /* 1e272 */
+    {0xEC9C459D, 0x51852BA2, 0xDDF8E7D6, 0x0ED1219E}, /* 1e273 */
+    {0x93E1AB82, 0x52F33B45, 0xCABB90E5, 0xC942B503}, /* 1e274 */
+    {0xB8DA1662, 0xE7B00A17, 0x3D6A751F, 0x3B936243}, /* 1e275 */
+    {0xE7109BFB, 0xA19C0C9D, 0x0CC51267, 0x0A783AD4}, /* 1e276 */
+    {0x906A617D, 0x450187E2, 0x27FB2B80, 0x668B24C5}, /* 1e277 */
+    {0xB484F9DC, 0x9641E9DA, 0xB1F9F660, 0x802DEDF6}, /* 1e278 */
+    {0xE1A63853, 0xBBD26451, 0x5E7873F8, 0xA0396973}, /* 1e279 */
+    {0x8D07E334, 0x55637EB2, 0xDB0B487B, 0x6423E1E8}, /* 1e280 */
+    {0xB049DC01, 0x6ABC5E5F, 0x91CE1A9A, 0x3D2CDA62}, /* 1e281 */
+    {0xDC5C5301, 0xC56B75F7, 0x7641A140, 0xCC7810FB}, /* 1e282 */
+    {0x89B9B3E1, 0x1B6329BA, 0xA9E904C8, 0x7FCB0A9D}, /* 1e283 */
+    {0xAC2820D9, 0x623BF429, 0x546345FA, 0x9FBDCD44}, /* 1e284 */
+    {0xD732290F, 0xBACAF133, 0xA97C1779, 0x47AD4095}, /* 1e285 */
+    {0x867F59A9, 0xD4BED6C0, 0x49ED8EAB, 0xCCCC485D}, /* 1e286 */
+    {0xA81F3014, 0x49EE8C70, 0x5C68F256, 0xBFFF5A74}, /* 1e287 */
+    {0xD226FC19, 0x5C6A2F8C, 0x73832EEC, 0x6FFF3111}, /* 1e288 */
+    {0x83585D8F, 0xD9C25DB7, 0xC831FD53, 0xC5FF7EAB}, /* 1e289 */
+    {0xA42E74F3, 0xD032F525, 0xBA3E7CA8, 0xB77F5E55}, /* 1e290 */
+    {0xCD3A1230, 0xC43FB26F, 0x28CE1BD2, 0xE55F35EB}, /* 1e291 */
+    {0x80444B5E, 0x7AA7CF85, 0x7980D163, 0xCF5B81B3}, /* 1e292 */
+    {0xA0555E36, 0x1951C366, 0xD7E105BC, 0xC332621F}, /* 1e293 */
+    {0xC86AB5C3, 0x9FA63440, 0x8DD9472B, 0xF3FEFAA7}, /* 1e294 */
+    {0xFA856334, 0x878FC150, 0xB14F98F6, 0xF0FEB951}, /* 1e295 */
+    {0x9C935E00, 0xD4B9D8D2, 0x6ED1BF9A, 0x569F33D3}, /* 1e296 */
+    {0xC3B83581, 0x09E84F07, 0x0A862F80, 0xEC4700C8}, /* 1e297 */
+    {0xF4A642E1, 0x4C6262C8, 0xCD27BB61, 0x2758C0FA}, /* 1e298 */
+    {0x98E7E9CC, 0xCFBD7DBD, 0x8038D51C, 0xB897789C}, /* 1e299 */
+    {0xBF21E440, 0x03ACDD2C, 0xE0470A63, 0xE6BD56C3}, /* 1e300 */
+    {0xEEEA5D50, 0x04981478, 0x1858CCFC, 0xE06CAC74}, /* 1e301 */
+    {0x95527A52, 0x02DF0CCB, 0x0F37801E, 0x0C43EBC8}, /* 1e302 */
+    {0xBAA718E6, 0x8396CFFD, 0xD3056025, 0x8F54E6BA}, /* 1e303 */
+    {0xE950DF20, 0x247C83FD, 0x47C6B82E, 0xF32A2069}, /* 1e304 */
+    {0x91D28B74, 0x16CDD27E, 0x4CDC331D, 0x57FA5441}, /* 1e305 */
+    {0xB6472E51, 0x1C81471D, 0xE0133FE4, 0xADF8E952}, /* 1e306 */
+    {0xE3D8F9E5, 0x63A198E5, 0x58180FDD, 0xD97723A6}, /* 1e307 */
+    {0x8E679C2F, 0x5E44FF8F, 0x570F09EA, 0xA7EA7648}, /* 1e308 */
+};
+
+/* Clinger's fast path relies on double arithmetic being done in double precision. */
+#if defined(FLT_EVAL_METHOD)
+#define ARG_STRTOD_CLINGER (FLT_EVAL_METHOD == 0)
+#elif defined(_M_X64) || defined(__x86_64__) || defined(__aarch64__) || defined(_M_ARM64) || defined(__SSE2_MATH__)
+#define ARG_STRTOD_CLINGER 1
+#else
+#define ARG_STRTOD_CLINGER 0
+#endif
+
+#if ARG_STRTOD_CLINGER
+/* Exact powers of ten for Clinger's fast path. */
+static const double arg_pow10_exact[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                         1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+#endif
+
+/* Full 64x64 -> 128-bit product of a and b. */
+static void arg_strtod_mul(uint64_t a, uint64_t b, uint64_t* hi, uint64_t* lo) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 arg_uint128_t;
+    arg_uint128_t r = (arg_uint128_t)a * b;
+    *hi = (uint64_t)(r >> 64);
+    *lo = (uint64_t)r;
+#else
+    uint64_t a0 = a & 0xFFFFFFFFu, a1 = a >> 32;
+    uint64_t b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+    *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    *lo = (mid << 32) | (p00 & 0xFFFFFFFFu);
+#endif
+}
+
+static double arg_strtod_bits(uint64_t bits) {
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
+
+/* Eisel-Lemire: converts w * 10^q (w != 0) to a double in *result.  */
+/* Returns 0 if the result cannot be decided this way, or if it is   */
+/* subnormal, zero or infinite, in which case the caller falls back. */
+static int arg_strtod_eisel_lemire(uint64_t w, int q, int neg, double* result) {
+    const uint32_t* t;
+    uint64_t thi, tlo, xhi, xlo, mantissa, msb;
+    long exp2;
+    int clz = 0;
+
+    if (q < ARG_POW10_MIN || q > ARG_POW10_MAX)
+        return 0;
+    t = arg_pow10_tab[q - ARG_POW10_MIN];
+    thi = ((uint64_t)t[0] << 32) | t[1];
+    tlo = ((uint64_t)t[2] << 32) | t[3];
+
+    /* normalize the mantissa */
+    while ((w >> 63) == 0) {
+        w <<= 1;
+        clz++;
+    }
+
+    /* floor(q * log2(10)) + 64 + the exponent bias, without shifting a negative value */
+    exp2 = (q >= 0 ? (217706L * q) >> 16 : -((217706L * -q + 65535L) >> 16)) + 64 + 1023 - clz;
+
+    arg_strtod_mul(w, thi, &xhi, &xlo);
+
+    /* widen the approximation if the truncated bits could matter */
+    if ((xhi & 0x1FF) == 0x1FF && xlo + w < w) {
+        uint64_t yhi, ylo;
+        arg_strtod_mul(w, tlo, &yhi, &ylo);
+        xlo += yhi;
+        if (xlo < yhi)
+            xhi++;
+        if ((xhi & 0x1FF) == 0x1FF && xlo + 1 == 0 && ylo + w < w)
+            return 0;
+    }
+
+    /* shift to 54 bits */
+    msb = xhi >> 63;
+    mantissa = xhi >> (msb + 9);
+    exp2 -= (long)(1 ^ msb);
+
+    /* a result exactly half-way between two doubles cannot be rounded here */
+    if (xlo == 0 && (xhi & 0x1FF) == 0 && (mantissa & 3) == 1)
+        return 0;
+
+    /* round to 53 bits, half to even */
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >> 53) {
+        mantissa >>= 1;
+        exp2++;
+    }
+
+    if (exp2 <= 0 || exp2 >= 0x7FF)
+        return 0;
+
+    *result = arg_strtod_bits(((uint64_t)exp2 << 52) | (mantissa & (((uint64_t)1 << 52) - 1)) | ((uint64_t)(neg ? 1 : 0) << 63));
+    return 1;
+}
+
+/* Converts str with the C library strtod(), substituting the locale's     */
+/* decimal point for '.'. The text is cut short at any character equal to */
+/* the locale's decimal point, so that only '.' is accepted as one.      */
+static double arg_strtod_libc(const char* str, char** endptr) {
+    const char* point = localeconv()->decimal_point;
+    size_t plen = strlen(point);
+    char buf[128];
+    char* copy = buf;
+    char* end;
+    const char* s;
+    size_t n = 0;
+    size_t len;
+    double val;
+
+    if (plen == 0 || (plen == 1 && point[0] == '.'))
+        return strtod(str, endptr);
+
+    len = strlen(str);
+    if ((len + 1) * plen >= sizeof(buf))
+        copy = (char*)xmalloc((len + 1) * plen + 1);
+
+    for (s = str; *s && *s != point[0]; s++) {
+        if (*s == '.') {
+            memcpy(copy + n, point, plen);
+            n += plen;
+        } else {
+            copy[n++] = *s;
+        }
+    }
+    copy[n] = '\0';
+
+    val = strtod(copy, &end);
+
+    /* map the end of the conversion back onto str */
+    if (endptr) {
+        n = (size_t)(end - copy);
+        for (s = str; n > 0; s++)
+            n -= (*s == '.' && n >= plen) ? plen : 1;
+        *endptr = (char*)s;
+    }
+
+    if (copy != buf)
+        xfree(copy);
+    return val;
+}
+
+double arg_strtod(const char* str, char** endptr) {
+    const unsigned char* p = (const unsigned char*)str;
+    uint64_t w = 0;
+    int nd = 0;        /* significant digits in w */
+    int seen = 0;      /* at least one digit was scanned */
+    int truncated = 0; /* non-zero digits were dropped from w */
+    int neg = 0;
+    long q = 0;
+    double val;
+
+    while (isspace(*p))
+        p++;
+    if (*p == '+' || *p == '-')
+        neg = (*p++ == '-');
+
+    /* leave hexadecimal floats to the C library */
+    if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+        return arg_strtod_libc(str, endptr);
+
+    /* integer part */
+    for (; *p >= '0' && *p <= '9'; p++) {
+        seen = 1;
+        if (nd < 19) {
+            w = w * 10 + (uint64_t)(*p - '0');
+            nd += (w != 0);
+        } else {
+            q++;
+            truncated |= (*p != '0');
+        }
+    }
+
+    /* fractional part */
+    if (*p == '.') {
+        for (p++; *p >= '0' && *p <= '9'; p++) {
+            seen = 1;
+            if (nd < 19) {
+                w = w * 10 + (uint64_t)(*p - '0');
+                nd += (w != 0);
+                q--;
+            } else {
+                truncated |= (*p != '0');
+            }
+        }
+    }
+
+    /* infinity, NaN and malformed text */
+    if (!seen)
+        return arg_strtod_libc(str, endptr);
+
+    /* exponent, only consumed if it has at least one digit */
+    if (*p == 'e' || *p == 'E') {
+        const unsigned char* e = p + 1;
+        int eneg = 0;
+        long ev = 0;
+
+        if (*e == '+' || *e == '-')
+            eneg = (*e++ == '-');
+        if (*e >= '0' && *e <= '9') {
+            for (; *e >= '0' && *e <= '9'; e++) {
+                if (ev < 100000L)
+                    ev = ev * 10 + (*e - '0');
+            }
+            q += eneg ? -ev : ev;
+            p = e;
+        }
+    }
+
+    if (endptr)
+        *endptr = (char*)p;
+
+    if (w == 0)
+        return neg ? -0.0 : 0.0;
+
+#if ARG_STRTOD_CLINGER
+    if (!truncated && w <= ((uint64_t)1 << 53) && q >= -22 && q <= 22) {
+        val = (double)w;
+        val = (q < 0) ? val / arg_pow10_exact[-q] : val * arg_pow10_exact[q];
+        return neg ? -val : val;
+    }
+#endif
+
+    if (arg_strtod_eisel_lemire(w, (int)q, neg, &val)) {
+        double upper;
+
+        /* with dropped digits the value lies between w and w + 1 */
+        if (!truncated || (arg_strtod_eisel_lemire(w + 1, (int)q, neg, &upper) && upper == val))
+            return val;
+    }
+
+    /* the C library decides the remaining cases */
+    {
+        size_t len = (size_t)((const char*)p - str);
+        char buf[128];
+        char* copy = (len < sizeof(buf)) ? buf : (char*)xmalloc(len + 1);
+
+        memcpy(copy, str, len);
+        copy[len] = '\0';
+        val = arg_strtod_libc(copy, NULL);
+        if (copy != buf)
+            xfree(copy);
+    }
+    return val;
+}
+/*	$NetBSD: getopt.h,v 1.4 2000/07/07 10:43:54 ad Exp $	*/
+/*	$FreeBSD$ */
+
+/*-
+ * SPDX-License-Identifier: BSD-2-Clause-NetBSD
+ *
+ * Copyright (c) 2000 The NetBSD Foundation, Inc.
+ * All rights reserved.
+ *
+ * This code is derived from software contributed to The NetBSD Foundation
+ * by Dieter Baron and Thomas Klausner.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE NETBSD FOUNDATION, INC. AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE FOUNDATION OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#if ARG_REPLACE_GETOPT == 1
+
+#ifndef _GETOPT_H_
+#define _GETOPT_H_
+
+/*
+ * GNU-like getopt_long()/getopt_long_only() with 4.4BSD optreset extension.
+ * getopt() is declared here too for GNU programs.
+ */
+#define no_argument        0
+#define required_argument  1
+#define optional_argument  2
+
+struct option {
+	/* name of long option */
+	const char *name;
+	/*
+	 * one of no_argument, required_argument, and optional_argument:
+	 * whether option takes an argument
+	 */
+	int has_arg;
+	/* if not NULL, set *flag to val when option found */
+	int *flag;
+	/* if flag not NULL, value to set *flag to; else return value */
+	int val;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int	getopt_long(int, char * const *, const char *,
+	const struct option *, int *);
+int	getopt_long_only(int, char * const *, const char *,
+	const struct option *, int *);
+
+/*
+ * Reentrant interface used by argtable. The scanner keeps its position in a
+ * struct arg_getopt instead of the getopt(3) external variables, so several
+ * threads can scan their own argument vectors at once.
+ */
+struct arg_getopt {
+	int ind;		/* index into parent argv vector */
+	int err;		/* if error message should be printed */
+	int opt;		/* character checked for validity */
+	int reset;		/* reset getopt */
+	char *arg;		/* argument associated with option */
+	char *place;		/* option letter processing */
+	int nonopt_start;	/* first non option argument (for permute) */
+	int nonopt_end;		/* first option after non options (for permute) */
+	int dash_prefix;
+	int posixly_correct;
+};
+
+void	arg_getopt_init(struct arg_getopt *);
+int	arg_getopt_long(struct arg_getopt *, int, char * const *, const char *,
+	const struct option *, int *);
+int	arg_getopt_long_only(struct arg_getopt *, int, char * const *,
+	const char *, const struct option *, int *);
+#ifndef _GETOPT_DECLARED
+#define	_GETOPT_DECLARED
+int getopt(int, char * const [], const char *);
+
+extern char *optarg;			/* getopt(3) external variables */
+extern int optind, opterr, optopt;
+#endif
+#ifndef _OPTRESET_DECLARED
+#define	_OPTRESET_DECLARED
+extern int optreset;			/* getopt(3) external variable */
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+ 
+#endif /* !_GETOPT_H_ */
+
+#endif /* ARG_REPLACE_GETOPT == 1 */
+/*	$OpenBSD: getopt_long.c,v 1.26 2013/06/08 22:47:56 millert Exp $	*/
+/*	$NetBSD: getopt_long.c,v 1.15 2002/01/31 22:43:40 tv Exp $	*/
+
+/*
+ * Copyright (c) 2002 Todd C. Miller <Todd.Miller@courtesan.com>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ * Sponsored in part by the Defense Advanced Research Projects
+ * Agency (DARPA) and Air Force Research Laboratory, Air Force
+ * Materiel Command, USAF, under agreement number F39502-99-1-0512.
+ */
+/*-
+ * Copyright (c) 2000 The NetBSD Foundation, Inc.
+ * All rights reserved.
+ *
+ * This code is derived from software contributed to The NetBSD Foundation
+ * by Dieter Baron and Thomas Klausner.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE NETBSD FOUNDATION, INC. AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE FOUNDATION OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "argtable3.h"
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#if ARG_REPLACE_GETOPT == 1
+
+#ifndef ARG_AMALGAMATION
+#include "arg_getopt.h"
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GNU_COMPATIBLE		/* Be more compatible, configure's use us! */
+
+int	opterr = 1;		/* if error message should be printed */
+int	optind = 1;		/* index into parent argv vector */
+int	optopt = '?';	/* character checked for validity */
+int	optreset;		/* reset getopt */
+char *optarg;		/* argument associated with option */
+
+#define PRINT_ERROR	((opterr) && (*options != ':'))
+
+#define FLAG_PERMUTE	0x01	/* permute non-options to the end of argv */
+#define FLAG_ALLARGS	0x02	/* treat non-options as args to option "-1" */
+#define FLAG_LONGONLY	0x04	/* operate as getopt_long_only */
+
+/* return values */
+#define	BADCH		(int)'?'
+#define	BADARG		((*options == ':') ? (int)':' : (int)'?')
+#define	INORDER 	(int)1
+
+#define	EMSG		""
+
+#ifdef GNU_COMPATIBLE
+#define NO_PREFIX	(-1)
+#define D_PREFIX	0
+#define DD_PREFIX	1
+#define W_PREFIX	2
+#endif
+
+static int getopt_internal(struct arg_getopt *, int, char * const *,
+			   const char *, const struct option *, int *, int);
+static int parse_long_options(struct arg_getopt *, char * const *,
+			      const char *, const struct option *, int *, int,
+			      int);
+static int gcd(int, int);
+static void permute_args(int, int, int, char * const *);
+
+/* Error messages */
+static const char recargchar[] = "option requires an argument -- %c";
+static const char illoptchar[] = "illegal option -- %c"; /* From P1003.2 */
+#ifdef GNU_COMPATIBLE
+static const char gnuoptchar[] = "invalid option -- %c";
+
+static const char recargstring[] = "option `%s%s' requires an argument";
+static const char ambig[] = "option `%s%.*s' is ambiguous";
+static const char noarg[] = "option `%s%.*s' doesn't allow an argument";
+static const char illoptstring[] = "unrecognized option `%s%s'";
+#else
+static const char recargstring[] = "option requires an argument -- %s";
+static const char ambig[] = "ambiguous option -- %.*s";
+static const char noarg[] = "option doesn't take an argument -- %.*s";
+static const char illoptstring[] = "unknown option -- %s";
+#endif
+
+#ifdef _WIN32
+
+/*
+ * Windows needs warnx().  We change the definition though:
+ *  1. (another) global is defined, opterrmsg, which holds the error message
+ *  2. errors are always printed out on stderr w/o the program name
+ * Note that opterrmsg always gets set no matter what opterr is set to.  The
+ * error message will not be printed if opterr is 0 as usual.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#define MAX_OPTERRMSG_SIZE 128
+
+extern char opterrmsg[MAX_OPTERRMSG_SIZE];
+char opterrmsg[MAX_OPTERRMSG_SIZE]; /* buffer for the last error message */
+
+static void warnx(const char* fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+
+    /*
+     * Make sure opterrmsg is always zero-terminated despite the _vsnprintf()
+     * implementation specifics and manually suppress the warning.
+     */
+    memset(opterrmsg, 0, sizeof(opterrmsg));
+    if (fmt != NULL)
+#if (defined(__STDC_LIB_EXT1__) && defined(__STDC_WANT_LIB_EXT1__)) || (defined(__STDC_SECURE_LIB__) && defined(__STDC_WANT_SECURE_LIB__))
+        _vsnprintf_s(opterrmsg, sizeof(opterrmsg), sizeof(opterrmsg) - 1, fmt, ap);
+#else
+        _vsnprintf(opterrmsg, sizeof(opterrmsg) - 1, fmt, ap);
+#endif
+
+    va_end(ap);
+
+#ifdef _MSC_VER
+#pragma warning(suppress : 6053)
+#endif
+    fprintf(stderr, "%s\n", opterrmsg);
+}
+
+#else
+#include <err.h>
+#endif /*_WIN32*/
+/*
+ * Compute the greatest common divisor of a and b.
+ */
+static int
+gcd(int a, int b)
+{
+	int c;
+
+	c = a % b;
+	while (c != 0) {
+		a = b;
+		b = c;
+		c = a % b;
+	}
+
+	return (b);
+}
+
+/*
+ * Exchange the block from nonopt_start to nonopt_end with the block
+ * from nonopt_end to opt_end (keeping the same order of arguments
+ * in each block).
+ */
+static void
+permute_args(int panonopt_start, int panonopt_end, int opt_end,
+	char * const *nargv)
+{
+	int cstart, cyclelen, i, j, ncycle, nnonopts, nopts, pos;
+	char *swap;
+
+	/*
+	 * compute lengths of blocks and number and size of cycles
+	 */
+	nnonopts = panonopt_end - panonopt_start;
+	nopts = opt_end - panonopt_end;
+	ncycle = gcd(nnonopts, nopts);
+	cyclelen = (opt_end - panonopt_start) / ncycle;
+
+	for (i = 0; i < ncycle; i++) {
+		cstart = panonopt_end+i;
+		pos = cstart;
+		for (j = 0; j < cyclelen; j++) {
+			if (pos >= panonopt_end)
+				pos -= nnonopts;
+			else
+				pos += nopts;
+			swap = nargv[pos];
+			/* LINTED const cast */
+			((char **) nargv)[pos] = nargv[cstart];
+			/* LINTED const cast */
+			((char **)nargv)[cstart] = swap;
+		}
+	}
+}
+
+/*
+ * The scanner below works on the state passed to it, which the getopt(3)
+ * names refer to until the end of getopt_internal().
+ */
+#define optind		(st->ind)
+#define opterr		(st->err)
+#define optopt		(st->opt)
+#define optreset	(st->reset)
+#define optarg		(st->arg)
+#define place		(st->place)
+#define nonopt_start	(st->nonopt_start)
+#define nonopt_end	(st->nonopt_end)
+#define dash_prefix	(st->dash_prefix)
+#define posixly_correct	(st->posixly_correct)
+
+/*
+ * parse_long_options --
+ *	Parse long options in argc/argv argument vector.
+ * Returns -1 if short_too is set and the option does not match long_options.
+ */
+static int
+parse_long_options(struct arg_getopt *st, char * const *nargv,
+	const char *options, const struct option *long_options, int *idx,
+	int short_too, int flags)
+{
+	char *current_argv, *has_equal;
+#ifdef GNU_COMPATIBLE
+	char *current_dash;
+#endif
+	size_t current_argv_len;
+	int i, match, exact_match, second_partial_match;
+
+	current_argv = place;
+#ifdef GNU_COMPATIBLE
+	switch (dash_prefix) {
+		case D_PREFIX:
+			current_dash = "-";
+			break;
+		case DD_PREFIX:
+			current_dash = "--";
+			break;
+		case W_PREFIX:
+			current_dash = "-W ";
+			break;
+		default:
+			current_dash = "";
+			break;
+	}
+#endif
+	match = -1;
+	exact_match = 0;
+	second_partial_match = 0;
+
+	optind++;
+
+	if ((has_equal = strchr(current_argv, '=')) != NULL) {
+		/* argument found (--option=arg) */
+		current_argv_len = (size_t)(has_equal - current_argv);
+		has_equal++;
+	} else
+		current_argv_len = strlen(current_argv);
+
+	for (i = 0; long_options[i].name; i++) {
+		/* find matching long option */
+		if (strncmp(current_argv, long_options[i].name,
+		    current_argv_len))
+			continue;
+
+		if (strlen(long_options[i].name) == current_argv_len) {
+			/* exact match */
+			match = i;
+			exact_match = 1;
+			break;
+		}
+		/*
+		 * If this is a known short option, don't allow
+		 * a partial match of a single character.
+		 */
+		if (short_too && current_argv_len == 1)
+			continue;
+
+		if (match == -1)	/* first partial match */
+			match = i;
+		else if ((flags & FLAG_LONGONLY) ||
+			 long_options[i].has_arg !=
+			     long_options[match].has_arg ||
+			 long_options[i].flag != long_options[match].flag ||
+			 long_options[i].val != long_options[match].val)
+			second_partial_match = 1;
+	}
+	if (!exact_match && second_partial_match) {
+		/* ambiguous abbreviation */
+		if (PRINT_ERROR)
+			warnx(ambig,
+#ifdef GNU_COMPATIBLE
+			     current_dash,
+#endif
+			     (int)current_argv_len,
+			     current_argv);
+		optopt = 0;
+		return (BADCH);
+	}
+	if (match != -1) {		/* option found */
+		if (long_options[match].has_arg == no_argument
+		    && has_equal) {
+			if (PRINT_ERROR)
+				warnx(noarg,
+#ifdef GNU_COMPATIBLE
+				     current_dash,
+#endif
+				     (int)current_argv_len,
+				     current_argv);
+			/*
+			 * XXX: GNU sets optopt to val regardless of flag
+			 */
+			if (long_options[match].flag == NULL)
+				optopt = long_options[match].val;
+			else
+				optopt = 0;
+#ifdef GNU_COMPATIBLE
+			return (BADCH);
+#else
+			return (BADARG);
+#endif
+		}
+		if (long_options[match].has_arg == required_argument ||
+		    long_options[match].has_arg == optional_argument) {
+			if (has_equal)
+				optarg = has_equal;
+			else if (long_options[match].has_arg ==
+			    required_argument) {
+				/*
+				 * optional argument doesn't use next nargv
+				 */
+				optarg = nargv[optind++];
+			}
+		}
+		if ((long_options[match].has_arg == required_argument)
+		    && (optarg == NULL)) {
+			/*
+			 * Missing argument; leading ':' indicates no error
+			 * should be generated.
+			 */
+			if (PRINT_ERROR)
+				warnx(recargstring,
+#ifdef GNU_COMPATIBLE
+				    current_dash,
+#endif
+				    current_argv);
+			/*
+			 * XXX: GNU sets optopt to val regardless of flag
+			 */
+			if (long_options[match].flag == NULL)
+				optopt = long_options[match].val;
+			else
+				optopt = 0;
+			--optind;
+			return (BADARG);
+		}
+	} else {			/* unknown option */
+		if (short_too) {
+			--optind;
+			return (-1);
+		}
+		if (PRINT_ERROR)
+			warnx(illoptstring,
+#ifdef GNU_COMPATIBLE
+			      current_dash,
+#endif
+			      current_argv);
+		optopt = 0;
+		return (BADCH);
+	}
+	if (idx)
+		*idx = match;
+	if (long_options[match].flag) {
+		*long_options[match].flag = long_options[match].val;
+		return (0);
+	} else
+		return (long_options[match].val);
+}
+
+/*
+ * getopt_internal --
+ *	Parse argc/argv argument vector.  Called by user level routines.
+ */
+static int
+getopt_internal(struct arg_getopt *st, int nargc, char * const *nargv,
+	const char *options, const struct option *long_options, int *idx,
+	int flags)
+{
+	char *oli;				/* option letter list index */
+	int optchar, short_too;
+
+	if (options == NULL)
+		return (-1);
+
+	/*
+	 * XXX Some GNU programs (like cvs) set optind to 0 instead of
+	 * XXX using optreset.  Work around this braindamage.
+	 */
+	if (optind == 0)
+		optind = optreset = 1;
+
+	/*
+	 * Disable GNU extensions if POSIXLY_CORRECT is set or options
+	 * string begins with a '+'.
+	 */
+	if (posixly_correct == -1 || optreset) {
+#if defined(_WIN32) && ((defined(__STDC_LIB_EXT1__) && defined(__STDC_WANT_LIB_EXT1__)) || (defined(__STDC_SECURE_LIB__) && defined(__STDC_WANT_SECURE_LIB__)))
+		size_t requiredSize;
+		getenv_s(&requiredSize, NULL, 0, "POSIXLY_CORRECT");
+		posixly_correct = requiredSize != 0;
+#else
+		posixly_correct = (getenv("POSIXLY_CORRECT") != NULL);
+#endif
+	}
+
+	if (*options == '-')
+		flags |= FLAG_ALLARGS;
+	else if (posixly_correct || *options == '+')
+		flags &= ~FLAG_PERMUTE;
+	if (*options == '+' || *options == '-')
+		options++;
+
+	optarg = NULL;
+	if (optreset)
+		nonopt_start = nonopt_end = -1;
+start:
+	if (optreset || !*place) {		/* update scanning pointer */
+		optreset = 0;
+		if (optind >= nargc) {          /* end of argument vector */
+			place = EMSG;
+			if (nonopt_end != -1) {
+				/* do permutation, if we have to */
+				permute_args(nonopt_start, nonopt_end,
+				    optind, nargv);
+				optind -= nonopt_end - nonopt_start;
+			}
+			else if (nonopt_start != -1) {
+				/*
+				 * If we skipped non-options, set optind
+				 * to the first of them.
+				 */
+				optind = nonopt_start;
+			}
+			nonopt_start = nonopt_end = -1;
+			return (-1);
+		}
+		if (*(place = nargv[optind]) != '-' ||
+#ifdef GNU_COMPATIBLE
+		    place[1] == '\0') {
+#else
+		    (place[1] == '\0' && strchr(options, '-') == NULL)) {
+#endif
+			place = EMSG;		/* found non-option */
+			if (flags & FLAG_ALLARGS) {
+				/*
+				 * GNU extension:
+				 * return non-option as argument to option 1
+				 */
+				optarg = nargv[optind++];
+				return (INORDER);
+			}
+			if (!(flags & FLAG_PERMUTE)) {
+				/*
+				 * If no permutation wanted, stop parsing
+				 * at first non-option.
+				 */
+				return (-1);
+			}
+			/* do permutation */
+			if (nonopt_start == -1)
+				nonopt_start = optind;
+			else if (nonopt_end != -1) {
+				permute_args(nonopt_start, nonopt_end,
+				    optind, nargv);
+				nonopt_start = optind -
+				    (nonopt_end - nonopt_start);
+				nonopt_end = -1;
+			}
+			optind++;
+			/* process next argument */
+			goto start;
+		}
+		if (nonopt_start != -1 && nonopt_end == -1)
+			nonopt_end = optind;
+
+		/*
+		 * If we have "-" do nothing, if "--" we are done.
+		 */
+		if (place[1] != '\0' && *++place == '-' && place[1] == '\0') {
+			optind++;
+			place = EMSG;
+			/*
+			 * We found an option (--), so if we skipped
+			 * non-options, we have to permute.
+			 */
+			if (nonopt_end != -1) {
+				permute_args(nonopt_start, nonopt_end,
+				    optind, nargv);
+				optind -= nonopt_end - nonopt_start;
+			}
+			nonopt_start = nonopt_end = -1;
+			return (-1);
+		}
+	}
+
+	/*
+	 * Check long options if:
+	 *  1) we were passed some
+	 *  2) the arg is not just "-"
+	 *  3) either the arg starts with -- we are getopt_long_only()
+	 */
+	if (long_options != NULL && place != nargv[optind] &&
+	    (*place == '-' || (flags & FLAG_LONGONLY))) {
+		short_too = 0;
+#ifdef GNU_COMPATIBLE
+		dash_prefix = D_PREFIX;
+#endif
+		if (*place == '-') {
+			place++;		/* --foo long option */
+			if (*place == '\0')
+				return (BADARG);	/* malformed option */
+#ifdef GNU_COMPATIBLE
+			dash_prefix = DD_PREFIX;
+#endif
+		} else if (*place != ':' && strchr(options, *place) != NULL)
+			short_too = 1;		/* could be short option too */
+
+		optchar = parse_long_options(st, nargv, options, long_options,
+		    idx, short_too, flags);
+		if (optchar != -1) {
+			place = EMSG;
+			return (optchar);
+		}
+	}
+
+	if ((optchar = (int)*place++) == (int)':' ||
+	    (optchar == (int)'-' && *place != '\0') ||
+	    (oli = strchr(options, optchar)) == NULL) {
+		/*
+		 * If the user specified "-" and  '-' isn't listed in
+		 * options, return -1 (non-option) as per POSIX.
+		 * Otherwise, it is an unknown option character (or ':').
+		 */
+		if (optchar == (int)'-' && *place == '\0')
+			return (-1);
+		if (!*place)
+			++optind;
+#ifdef GNU_COMPATIBLE
+		if (PRINT_ERROR)
+			warnx(posixly_correct ? illoptchar : gnuoptchar,
+			      optchar);
+#else
+		if (PRINT_ERROR)
+			warnx(illoptchar, optchar);
+#endif
+		optopt = optchar;
+		return (BADCH);
+	}
+	if (long_options != NULL && optchar == 'W' && oli[1] == ';') {
+		/* -W long-option */
+		if (*place)			/* no space */
+			/* NOTHING */;
+		else if (++optind >= nargc) {	/* no arg */
+			place = EMSG;
+			if (PRINT_ERROR)
+				warnx(recargchar, optchar);
+			optopt = optchar;
+			return (BADARG);
+		} else				/* white space */
+			place = nargv[optind];
+#ifdef GNU_COMPATIBLE
+		dash_prefix = W_PREFIX;
+#endif
+		optchar = parse_long_options(st, nargv, options, long_options,
+		    idx, 0, flags);
+		place = EMSG;
+		return (optchar);
+	}
+	if (*++oli != ':') {			/* doesn't take argument */
+		if (!*place)
+			++optind;
+	} else {				/* takes (optional) argument */
+		optarg = NULL;
+		if (*place)			/* no white space */
+			optarg = place;
+		else if (oli[1] != ':') {	/* arg not optional */
+			if (++optind >= nargc) {	/* no arg */
+				place = EMSG;
+				if (PRINT_ERROR)
+					warnx(recargchar, optchar);
+				optopt = optchar;
+				return (BADARG);
+			} else
+				optarg = nargv[optind];
+		}
+		place = EMSG;
+		++optind;
+	}
+	/* dump back option letter */
+	return (optchar);
+}
+
+#undef optind
+#undef opterr
+#undef optopt
+#undef optreset
+#undef optarg
+#undef place
+#undef nonopt_start
+#undef nonopt_end
+#undef dash_prefix
+#undef posixly_correct
+
+/*
+ * arg_getopt_init --
+ *	Prepare a scanner state for a new argument vector.
+ */
+void
+arg_getopt_init(struct arg_getopt *st)
+{
+
+	st->ind = 0;
+	st->err = 1;
+	st->opt = '?';
+	st->reset = 0;
+	st->arg = NULL;
+	st->place = EMSG;
+	st->nonopt_start = -1;
+	st->nonopt_end = -1;
+	st->dash_prefix = NO_PREFIX;
+	st->posixly_correct = -1;
+}
+
+/*
+ * arg_getopt_long --
+ *	Parse argc/argv argument vector, keeping the position in st.
+ */
+int
+arg_getopt_long(struct arg_getopt *st, int nargc, char * const *nargv,
+	const char *options, const struct option *long_options, int *idx)
+{
+
+	return (getopt_internal(st, nargc, nargv, options, long_options, idx,
+	    FLAG_PERMUTE));
+}
+
+/*
+ * arg_getopt_long_only --
+ *	Parse argc/argv argument vector, keeping the position in st.
+ */
+int
+arg_getopt_long_only(struct arg_getopt *st, int nargc, char * const *nargv,
+	const char *options, const struct option *long_options, int *idx)
+{
+
+	return (getopt_internal(st, nargc, nargv, options, long_options, idx,
+	    FLAG_PERMUTE|FLAG_LONGONLY));
+}
+
+/*
+ * The state of getopt(), getopt_long() and getopt_long_only(), which is
+ * copied from and back to the getopt(3) external variables around each call.
+ */
+static struct arg_getopt getopt_state = {
+	1, 1, '?', 0, NULL, EMSG, -1, -1, NO_PREFIX, -1
+};
+
+static int
+getopt_global(int nargc, char * const *nargv, const char *options,
+	const struct option *long_options, int *idx, int flags)
+{
+	int ret;
+
+	getopt_state.ind = optind;
+	getopt_state.err = opterr;
+	getopt_state.opt = optopt;
+	getopt_state.reset = optreset;
+	ret = getopt_internal(&getopt_state, nargc, nargv, options,
+	    long_options, idx, flags);
+	optind = getopt_state.ind;
+	optopt = getopt_state.opt;
+	optreset = getopt_state.reset;
+	optarg = getopt_state.arg;
+	return (ret);
+}
+
+/*
+ * getopt --
+ *	Parse argc/argv argument vector.
+ *
+ * [eventually this will replace the BSD getopt]
+ */
+int
+getopt(int nargc, char * const *nargv, const char *options)
+{
+
+	/*
+	 * We don't pass FLAG_PERMUTE to getopt_internal() since
+	 * the BSD getopt(3) (unlike GNU) has never done this.
+	 *
+	 * Furthermore, since many privileged programs call getopt()
+	 * before dropping privileges it makes sense to keep things
+	 * as simple (and bug-free) as possible.
+	 */
+	return (getopt_global(nargc, nargv, options, NULL, NULL, 0));
+}
+
+/*
+ * getopt_long --
+ *	Parse argc/argv argument vector.
+ */
+int
+getopt_long(int nargc, char * const *nargv, const char *options,
+	const struct option *long_options, int *idx)
+{
+
+	return (getopt_global(nargc, nargv, options, long_options, idx,
+	    FLAG_PERMUTE));
+}
+
+/*
+ * getopt_long_only --
+ *	Parse argc/argv argument vector.
+ */
+int
+getopt_long_only(int nargc, char * const *nargv, const char *options,
+	const struct option *long_options, int *idx)
+{
+
+	return (getopt_global(nargc, nargv, options, long_options, idx,
+	    FLAG_PERMUTE|FLAG_LONGONLY));
+}
+
+#endif /* ARG_REPLACE_GETOPT == 1 */
+/*******************************************************************************
+ * arg_date: Implements the date command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 1998-2001,2003-2011,2013 Stewart Heitmann
+ * <sheitmann@users.sourceforge.net>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+char* arg_strptime(const char* buf, const char* fmt, struct tm* tm);
+
+#define ARG_DATE_NSEC_PER_SEC ((int64_t)1000000000)
+
+/*
+ * A format string is compiled once by arg_daten() into a program of these
+ * instructions, which arg_date_exec() runs for every value. Each instruction
+ * carries the literal run that follows it in the format, so "%d/%m/%Y" takes
+ * three instructions. The program accepts exactly the values that
+ * arg_strptime() accepts for the format.
+ */
+enum {
+    ARG_DATE_OP_END,     /* end of the program */
+    ARG_DATE_OP_SPACE,   /* skip any white-space */
+    ARG_DATE_OP_LIT,     /* nothing but the literal run, for a format that starts with one */
+    ARG_DATE_OP_WDAY,    /* read a day of week name */
+    ARG_DATE_OP_MONTH,   /* read a month name */
+    ARG_DATE_OP_AMPM,    /* read AM or PM, which must end the value */
+    ARG_DATE_OP_NUM,     /* read a number and store it plus delta at offset in struct tm */
+    ARG_DATE_OP_RANGE,   /* read a number and only check its bounds (%U, %W) */
+    ARG_DATE_OP_HOUR12,  /* read a 12-hour clock hour (%I, %l) */
+    ARG_DATE_OP_YEAR2,   /* read a year within 100 years of the epoch (%y) */
+    ARG_DATE_OP_YEAR2X,  /* %y inside %c, %D or %x, which never combines with %C */
+    ARG_DATE_OP_CENTURY  /* read a century (%C) */
+};
+
+struct arg_date_op {
+    int code;        /* ARG_DATE_OP_* */
+    int lo, hi;      /* bounds of a number, read from ARG_DATE_OP_NUM on */
+    int width;       /* the most digits of a number, which is the number of digits of hi */
+    int offset;      /* offset of the int field of struct tm for ARG_DATE_OP_NUM */
+    int delta;       /* added to the number for ARG_DATE_OP_NUM */
+    const char* lit; /* literal run that must follow, pointing into the format */
+    int len;         /* number of characters of the literal run, or 0 */
+};
+
+static int arg_date_compile(const char* fmt, int depth, struct arg_date_op* prog, int n, int* tail);
+static const char* arg_date_exec(const struct arg_date_op* op, const char* bp, struct tm* tm);
+
+/*
+ * Formats recognized by arg_daten() that are parsed without running a format
+ * program. For the fixed formats, only values in their canonical form, with
+ * every field written with all its digits, take the fast path; anything else
+ * is left to the format program, so the accepted values do not change.
+ */
+enum {
+    ARG_DATE_GENERIC,   /* any other format, parsed by the format program */
+    ARG_DATE_YMD,       /* %Y-%m-%d */
+    ARG_DATE_HMS,       /* %H:%M:%S or %T */
+    ARG_DATE_YMD_T_HMS, /* %Y-%m-%dT%H:%M:%S or %Y-%m-%dT%T */
+    ARG_DATE_YMD_HMS,   /* %Y-%m-%d %H:%M:%S or %Y-%m-%d %T */
+    ARG_DATE_ISO        /* ARG_DATE_ISO8601 */
+};
+
+static const struct {
+    const char* format;
+    int kind;
+} arg_date_formats[] = {
+    {"%Y-%m-%d", ARG_DATE_YMD},
+    {"%H:%M:%S", ARG_DATE_HMS},
+    {"%T", ARG_DATE_HMS},
+    {"%Y-%m-%dT%H:%M:%S", ARG_DATE_YMD_T_HMS},
+    {"%Y-%m-%dT%T", ARG_DATE_YMD_T_HMS},
+    {"%Y-%m-%d %H:%M:%S", ARG_DATE_YMD_HMS},
+    {"%Y-%m-%d %T", ARG_DATE_YMD_HMS},
+    {ARG_DATE_ISO8601, ARG_DATE_ISO},
+};
+
+/* private data of arg_date, stored after the tmval[] or nsec[] array */
+struct arg_date_priv {
+    struct arg_hdr_ext ext; /* must come first, see ARG_HASEXT */
+    int kind;
+    struct arg_date_op* prog; /* compiled format, or NULL for ARG_DATE_ISO */
+};
+
+/* Reads exactly n digits from *str into *val, returns 0 if there are fewer */
+static int arg_date_digits(const char** str, int n, int* val) {
+    const char* ptr = *str;
+    int result = 0;
+
+    for (; n > 0; n--, ptr++) {
+        if (*ptr < '0' || *ptr > '9')
+            return 0;
+        result = result * 10 + (*ptr - '0');
+    }
+
+    *str = ptr;
+    *val = result;
+    return 1;
+}
+
+/* Reads the canonical "YYYY-MM-DD" into the date fields of tm, with the ranges of %Y, %m and %d */
+static int arg_date_scanymd(const char** str, struct tm* tm) {
+    const char* ptr = *str;
+    int y, m, d;
+
+    if (!arg_date_digits(&ptr, 4, &y) || *ptr++ != '-' || !arg_date_digits(&ptr, 2, &m) || *ptr++ != '-' || !arg_date_digits(&ptr, 2, &d))
+        return 0;
+    if (m < 1 || m > 12 || d < 1 || d > 31)
+        return 0;
+
+    tm->tm_year = y - 1900;
+    tm->tm_mon = m - 1;
+    tm->tm_mday = d;
+    *str = ptr;
+    return 1;
+}
+
+/* Reads the canonical "hh:mm:ss" into the time fields of tm, with the ranges of %H, %M and %S */
+static int arg_date_scanhms(const char** str, struct tm* tm) {
+    const char* ptr = *str;
+    int h, m, sec;
+
+    if (!arg_date_digits(&ptr, 2, &h) || *ptr++ != ':' || !arg_date_digits(&ptr, 2, &m) || *ptr++ != ':' || !arg_date_digits(&ptr, 2, &sec))
+        return 0;
+    if (h > 23 || m > 59 || sec > 61)
+        return 0;
+
+    tm->tm_hour = h;
+    tm->tm_min = m;
+    tm->tm_sec = sec;
+    *str = ptr;
+    return 1;
+}
+
+/*
+ * Parses str in one of the fixed formats. Returns 1 and updates tm only if
+ * str is a valid value in canonical form; otherwise returns 0 and leaves the
+ * value to the format program.
+ */
+static int arg_date_scanfixed(const char* str, int kind, struct tm* tm) {
+    struct tm result = *tm;
+
+    switch (kind) {
+        case ARG_DATE_YMD:
+            if (!arg_date_scanymd(&str, &result))
+                return 0;
+            break;
+
+        case ARG_DATE_HMS:
+            if (!arg_date_scanhms(&str, &result))
+                return 0;
+            break;
+
+        case ARG_DATE_YMD_T_HMS:
+        case ARG_DATE_YMD_HMS:
+            if (!arg_date_scanymd(&str, &result) || *str++ != (kind == ARG_DATE_YMD_HMS ? ' ' : 'T') || !arg_date_scanhms(&str, &result))
+                return 0;
+            break;
+
+        default:
+            return 0;
+    }
+
+    if (*str != '\0')
+        return 0;
+
+    *tm = result;
+    return 1;
+}
+
+/* Returns the number of days from 1970-01-01 to the given date of the proleptic Gregorian calendar */
+static int64_t arg_date_days(int64_t y, int m, int d) {
+    int64_t era;
+    int yoe;
+    int doy;
+
+    y -= (m <= 2);
+    era = (y >= 0 ? y : y - 399) / 400;
+    yoe = (int)(y - era * 400);
+    doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    return era * 146097 + yoe * 365 + yoe / 4 - yoe / 100 + doy - 719468;
+}
+
+/* Sets the calendar fields of tm, in UTC, to the time secs seconds after 1970-01-01 00:00:00 */
+static void arg_date_civil(int64_t secs, struct tm* tm) {
+    int64_t days = (secs >= 0 ? secs : secs - 86399) / 86400;
+    int64_t rem = secs - days * 86400;
+    int64_t z = days + 719468;
+    int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    int doe = (int)(z - era * 146097);
+    int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int mp = (5 * doy + 2) / 153;
+    int m = mp < 10 ? mp + 3 : mp - 9;
+    int64_t y = era * 400 + yoe + (m <= 2);
+
+    tm->tm_year = (int)(y - 1900);
+    tm->tm_mon = m - 1;
+    tm->tm_mday = doy - (153 * mp + 2) / 5 + 1;
+    tm->tm_hour = (int)(rem / 3600);
+    tm->tm_min = (int)(rem / 60 % 60);
+    tm->tm_sec = (int)(rem % 60);
+    tm->tm_wday = (int)((days % 7 + 11) % 7); /* 1970-01-01 was a Thursday */
+    tm->tm_yday = (int)(days - arg_date_days(y, 1, 1));
+    tm->tm_isdst = 0;
+}
+
+/*
+ * Parses an ARG_DATE_ISO8601 value. On success stores the time in UTC in tm,
+ * the seconds since the epoch in secs and the fraction in frac (nanoseconds).
+ */
+static int arg_date_scaniso(const char* str, struct tm* tm, int64_t* secs, long* frac) {
+    static const int mdays[12] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    int y, m, d;
+    int h = 0, min = 0, sec = 0;
+    int offset = 0;
+    long ns = 0;
+
+    if (!arg_date_digits(&str, 4, &y) || *str++ != '-' || !arg_date_digits(&str, 2, &m) || *str++ != '-' || !arg_date_digits(&str, 2, &d))
+        return ARG_ERR_BADDATE;
+    if (m < 1 || m > 12 || d < 1 || d > mdays[m - 1] || (m == 2 && d == 29 && (y % 4 != 0 || (y % 100 == 0 && y % 400 != 0))))
+        return ARG_ERR_BADDATE;
+
+    if (*str == 'T' || *str == 't' || *str == ' ') {
+        str++;
+        if (!arg_date_digits(&str, 2, &h) || *str++ != ':' || !arg_date_digits(&str, 2, &min) || h > 23 || min > 59)
+            return ARG_ERR_BADDATE;
+
+        if (*str == ':') {
+            str++;
+            if (!arg_date_digits(&str, 2, &sec) || sec > 60)
+                return ARG_ERR_BADDATE;
+
+            if ((*str == '.' || *str == ',') && str[1] >= '0' && str[1] <= '9') {
+                long scale = 100000000L;
+                for (str++; *str >= '0' && *str <= '9'; str++, scale /= 10)
+                    ns += (*str - '0') * scale; /* digits beyond nanoseconds add zero */
+            }
+        }
+
+        if (*str == 'Z' || *str == 'z') {
+            str++;
+        } else if (*str == '+' || *str == '-') {
+            int sign = (*str++ == '-') ? -1 : 1;
+            int oh;
+            int om = 0;
+
+            if (!arg_date_digits(&str, 2, &oh) || oh > 23)
+                return ARG_ERR_BADDATE;
+            if (*str != '\0') {
+                if (*str == ':')
+                    str++;
+                if (!arg_date_digits(&str, 2, &om) || om > 59)
+                    return ARG_ERR_BADDATE;
+            }
+            offset = sign * (oh * 3600 + om * 60);
+        }
+    }
+
+    if (*str != '\0')
+        return ARG_ERR_BADDATE;
+
+    *secs = arg_date_days(y, m, d) * 86400 + h * 3600 + min * 60 + sec - offset;
+    *frac = ns;
+    arg_date_civil(*secs, tm);
+    return 0;
+}
+
+/* Converts secs seconds and frac nanoseconds since the epoch to nanoseconds, if that fits in 64 bits */
+static int arg_date_nsec(int64_t secs, long frac, int64_t* nsec) {
+    int64_t max = (int64_t)(~(uint64_t)0 >> 1);
+    int64_t min = -max - 1;
+
+    /* min / 10^9 rounds toward zero, so the smallest whole second is always in range */
+    if (secs > max / ARG_DATE_NSEC_PER_SEC || secs < min / ARG_DATE_NSEC_PER_SEC ||
+        (secs == max / ARG_DATE_NSEC_PER_SEC && frac > max % ARG_DATE_NSEC_PER_SEC))
+        return ARG_ERR_OVERFLOW;
+
+    *nsec = secs * ARG_DATE_NSEC_PER_SEC + frac;
+    return 0;
+}
+
+static void arg_date_resetfn(void* parent_) {
+    struct arg_date* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+static int arg_date_scanfn(void* parent_, const char* argval) {
+    struct arg_date* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* no argument value was given, leave parent->tmval[] unaltered but still count it */
+        parent->count++;
+    } else {
+        struct arg_date_priv* priv = (struct arg_date_priv*)parent->hdr.priv;
+        const char* pend;
+        struct tm tm;
+        int64_t secs = 0;
+        long frac = 0;
+
+        /* start from the previous value, or from the epoch when storing nanoseconds */
+        if (parent->tmval) {
+            tm = parent->tmval[parent->count];
+        } else {
+            memset(&tm, 0, sizeof(tm));
+            tm.tm_year = 70;
+            tm.tm_mday = 1;
+        }
+
+        /* parse the given argument value, with a fast path for the ISO-8601 formats */
+        if (priv->kind == ARG_DATE_ISO) {
+            errorcode = arg_date_scaniso(argval, &tm, &secs, &frac);
+        } else if (priv->kind == ARG_DATE_GENERIC || !arg_date_scanfixed(argval, priv->kind, &tm)) {
+            pend = arg_date_exec(priv->prog, argval, &tm);
+            if (!pend || pend[0] != '\0')
+                errorcode = ARG_ERR_BADDATE;
+        }
+
+        /* store result in parent->tmval[] or parent->nsec[] */
+        if (errorcode == 0 && parent->nsec) {
+            if (priv->kind != ARG_DATE_ISO)
+                secs = arg_date_days(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday) * 86400 + tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+            errorcode = arg_date_nsec(secs, frac, &parent->nsec[parent->count]);
+        }
+        if (errorcode == 0) {
+            if (parent->tmval)
+                parent->tmval[parent->count] = tm;
+            parent->count++;
+        }
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_date_checkfn(void* parent_) {
+    struct arg_date* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_date_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_date* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADDATE: {
+            struct tm tm;
+            char buff[200];
+
+            arg_dstr_catf(ds, "illegal timestamp format \"%s\"\n", argval);
+            memset(&tm, 0, sizeof(tm));
+            arg_strptime("1999-12-31 23:59:59", "%F %H:%M:%S", &tm);
+            strftime(buff, sizeof(buff), parent->format, &tm);
+            arg_dstr_catf(ds, "correct format is \"%s\"\n", buff);
+            break;
+        }
+
+        case ARG_ERR_OVERFLOW:
+            arg_dstr_catf(ds, "timestamp \"%s\" is out of range at option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+    }
+}
+
+static void* arg_date_clonefn(void* parent_) {
+    struct arg_date* parent = parent_;
+    struct arg_date_priv* priv = (struct arg_date_priv*)parent->hdr.priv;
+    size_t valsize = parent->tmval ? sizeof(struct tm) : sizeof(int64_t);
+    size_t nops = 0;
+    struct arg_date* result;
+    struct arg_date_priv* rpriv;
+
+    /* the format program ends with its ARG_DATE_OP_END instruction */
+    if (priv->prog) {
+        while (priv->prog[nops].code != ARG_DATE_OP_END)
+            nops++;
+        nops++;
+    }
+
+    result = (struct arg_date*)arg_clone_block(parent, sizeof(struct arg_date) + (size_t)parent->hdr.maxcount * valsize + sizeof(struct arg_date_priv) +
+                                                           nops * sizeof(struct arg_date_op));
+    result->hdr.priv = ARG_CLONE_PTR(result, parent, priv);
+    rpriv = (struct arg_date_priv*)result->hdr.priv;
+    if (priv->prog)
+        rpriv->prog = (struct arg_date_op*)ARG_CLONE_PTR(result, parent, priv->prog);
+    if (parent->tmval)
+        result->tmval = (struct tm*)ARG_CLONE_PTR(result, parent, parent->tmval);
+    else
+        result->nsec = (int64_t*)ARG_CLONE_PTR(result, parent, parent->nsec);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_date_ext = {ARG_HDR_EXT_VERSION, NULL, arg_date_clonefn};
+
+struct arg_date* arg_date0(const char* shortopts, const char* longopts, const char* format, const char* datatype, const char* glossary) {
+    return arg_daten(shortopts, longopts, format, datatype, 0, 1, glossary);
+}
+
+struct arg_date* arg_date1(const char* shortopts, const char* longopts, const char* format, const char* datatype, const char* glossary) {
+    return arg_daten(shortopts, longopts, format, datatype, 1, 1, glossary);
+}
+
+/*
+ * Creates an arg_date that stores struct tm values in tmval[], or, if epoch
+ * is nonzero, nanoseconds since the epoch in nsec[].
+ */
+static struct arg_date* arg_date_create(const char* shortopts,
+                                        const char* longopts,
+                                        const char* format,
+                                        const char* datatype,
+                                        int mincount,
+                                        int maxcount,
+                                        const char* glossary,
+                                        int epoch) {
+    size_t nbytes;
+    size_t valsize = epoch ? sizeof(int64_t) : sizeof(struct tm);
+    struct arg_date* result;
+    struct arg_date_priv* priv;
+    int kind = ARG_DATE_GENERIC;
+    int nops = 0;
+    int tail = 0;
+    size_t i;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    /* default time format is the national date format for the locale */
+    if (!format)
+        format = "%x";
+
+    /* recognize the formats that have a fast path */
+    for (i = 0; i < sizeof(arg_date_formats) / sizeof(arg_date_formats[0]); i++) {
+        if (strcmp(format, arg_date_formats[i].format) == 0)
+            kind = arg_date_formats[i].kind;
+    }
+
+    /* count the instructions of the format program, which also validates the format */
+    if (kind != ARG_DATE_ISO) {
+        nops = arg_date_compile(format, 0, NULL, 0, &tail);
+        if (nops < 0) {
+            ARG_LOG(("argtable: ERROR - invalid date format \"%s\"\n", format));
+            ARG_LOG(("argtable: Bad argument table.\n"));
+            return NULL;
+        }
+        nops++; /* room for the ARG_DATE_OP_END instruction */
+    }
+
+    nbytes = sizeof(struct arg_date)                      /* storage for struct arg_date */
+             + (size_t)maxcount * valsize                 /* storage for tmval[maxcount] or nsec[maxcount] array */
+             + sizeof(struct arg_date_priv)               /* storage for private arg_date data */
+             + (size_t)nops * sizeof(struct arg_date_op); /* storage for the format program */
+
+    /* allocate storage for the arg_date struct + tmval[] array.    */
+    /* we use calloc because we want the tmval[] array zero filled. */
+    result = (struct arg_date*)xcalloc(1, nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype ? datatype : format;
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_date_resetfn;
+    result->hdr.scanfn = arg_date_scanfn;
+    result->hdr.checkfn = arg_date_checkfn;
+    result->hdr.errorfn = arg_date_errorfn;
+
+    /* store the tmval[maxcount] or nsec[maxcount] array immediately after the arg_date struct */
+    if (epoch) {
+        result->tmval = NULL;
+        result->nsec = (int64_t*)(result + 1);
+    } else {
+        result->tmval = (struct tm*)(result + 1);
+        result->nsec = NULL;
+    }
+
+    /* store the arg_date_priv struct after the array */
+    priv = (struct arg_date_priv*)((char*)(result + 1) + (size_t)maxcount * valsize);
+    result->hdr.priv = priv;
+    priv->ext = arg_date_ext;
+    priv->kind = kind;
+
+    /* compile the format program after the arg_date_priv struct */
+    if (nops > 0) {
+        priv->prog = (struct arg_date_op*)(priv + 1);
+        tail = 0;
+        priv->prog[arg_date_compile(format, 0, priv->prog, 0, &tail)].code = ARG_DATE_OP_END;
+    } else {
+        priv->prog = NULL;
+    }
+
+    /* init the remaining arg_date member variables */
+    result->count = 0;
+    result->format = format;
+
+    return result;
+}
+
+struct arg_date*
+arg_daten(const char* shortopts, const char* longopts, const char* format, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    struct arg_date* result = arg_date_create(shortopts, longopts, format, datatype, mincount, maxcount, glossary, 0);
+    ARG_TRACE(("arg_daten() returns %p\n", result));
+    return result;
+}
+
+struct arg_date* arg_epoch0(const char* shortopts, const char* longopts, const char* format, const char* datatype, const char* glossary) {
+    return arg_epochn(shortopts, longopts, format, datatype, 0, 1, glossary);
+}
+
+struct arg_date* arg_epoch1(const char* shortopts, const char* longopts, const char* format, const char* datatype, const char* glossary) {
+    return arg_epochn(shortopts, longopts, format, datatype, 1, 1, glossary);
+}
+
+struct arg_date*
+arg_epochn(const char* shortopts, const char* longopts, const char* format, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    struct arg_date* result = arg_date_create(shortopts, longopts, format, datatype, mincount, maxcount, glossary, 1);
+    ARG_TRACE(("arg_epochn() returns %p\n", result));
+    return result;
+}
+
+/*-
+ * Copyright (c) 1997, 1998, 2005, 2008 The NetBSD Foundation, Inc.
+ * All rights reserved.
+ *
+ * This code was contributed to The NetBSD Foundation by Klaus Klein.
+ * Heavily optimised by David Laight
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE NETBSD FOUNDATION, INC. AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE FOUNDATION OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <ctype.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * We do not implement alternate representations. However, we always
+ * check whether a given modifier is allowed for a certain conversion.
+ */
+#define ALT_E 0x01
+#define ALT_O 0x02
+#define LEGAL_ALT(x)           \
+    {                          \
+        if (alt_format & ~(x)) \
+            return (0);        \
+    }
+#define TM_YEAR_BASE (1900)
+
+static int conv_num(const char**, int*, int, int);
+
+static const char* day[7] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+
+static const char* abday[7] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+
+static const char* mon[12] = {"January", "February", "March",     "April",   "May",      "June",
+                              "July",    "August",   "September", "October", "November", "December"};
+
+static const char* abmon[12] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+static const char* am_pm[2] = {"AM", "PM"};
+
+static int arg_strcasecmp(const char* s1, const char* s2) {
+    const unsigned char* us1 = (const unsigned char*)s1;
+    const unsigned char* us2 = (const unsigned char*)s2;
+    while (tolower(*us1) == tolower(*us2++))
+        if (*us1++ == '\0')
+            return 0;
+
+    return tolower(*us1) - tolower(*--us2);
+}
+
+static int arg_strncasecmp(const char* s1, const char* s2, size_t n) {
+    if (n != 0) {
+        const unsigned char* us1 = (const unsigned char*)s1;
+        const unsigned char* us2 = (const unsigned char*)s2;
+        do {
+            if (tolower(*us1) != tolower(*us2++))
+                return tolower(*us1) - tolower(*--us2);
+
+            if (*us1++ == '\0')
+                break;
+        } while (--n != 0);
+    }
+
+    return 0;
+}
+
+char* arg_strptime(const char* buf, const char* fmt, struct tm* tm) {
+    char c;
+    const char* bp;
+    size_t len = 0;
+    int alt_format, i, split_year = 0;
+
+    bp = buf;
+
+    while ((c = *fmt) != '\0') {
+        /* Clear `alternate' modifier prior to new conversion. */
+        alt_format = 0;
+
+        /* Eat up white-space. */
+        if (isspace(c)) {
+            while (isspace((int)(*bp)))
+                bp++;
+
+            fmt++;
+            continue;
+        }
+
+        if ((c = *fmt++) != '%')
+            goto literal;
+
+    again:
+        switch (c = *fmt++) {
+            case '%': /* "%%" is converted to "%". */
+            literal:
+                if (c != *bp++)
+                    return (0);
+                break;
+
+            /*
+             * "Alternative" modifiers. Just set the appropriate flag
+             * and start over again.
+             */
+            case 'E': /* "%E?" alternative conversion modifier. */
+                LEGAL_ALT(0);
+                alt_format |= ALT_E;
+                goto again;
+
+            case 'O': /* "%O?" alternative conversion modifier. */
+                LEGAL_ALT(0);
+                alt_format |= ALT_O;
+                goto again;
+
+            /*
+             * "Complex" conversion rules, implemented through recursion.
+             */
+            case 'c': /* Date and time, using the locale's format. */
+                LEGAL_ALT(ALT_E);
+                bp = arg_strptime(bp, "%x %X", tm);
+                if (!bp)
+                    return (0);
+                break;
+
+            case 'D': /* The date as "%m/%d/%y". */
+                LEGAL_ALT(0);
+                bp = arg_strptime(bp, "%m/%d/%y", tm);
+                if (!bp)
+                    return (0);
+                break;
+
+            case 'R': /* The time as "%H:%M". */
+                LEGAL_ALT(0);
+                bp = arg_strptime(bp, "%H:%M", tm);
+                if (!bp)
+                    return (0);
+                break;
+
+            case 'r': /* The time in 12-hour clock representation. */
+                LEGAL_ALT(0);
+                bp = arg_strptime(bp, "%I:%M:%S %p", tm);
+                if (!bp)
+                    return (0);
+                break;
+
+            case 'T': /* The time as "%H:%M:%S". */
+                LEGAL_ALT(0);
+                bp = arg_strptime(bp, "%H:%M:%S", tm);
+                if (!bp)
+                    return (0);
+                break;
+
+            case 'X': /* The time, using the locale's format. */
+                LEGAL_ALT(ALT_E);
+                bp = arg_strptime(bp, "%H:%M:%S", tm);
+                if (!bp)
+                    return (0);
+                break;
+
+            case 'x': /* The date, using the locale's format. */
+                LEGAL_ALT(ALT_E);
+                bp = arg_strptime(bp, "%m/%d/%y", tm);
+                if (!bp)
+                    return (0);
+                break;
+
+            /*
+             * "Elementary" conversion rules.
+             */
+            case 'A': /* The day of week, using the locale's form. */
+            case 'a':
+                LEGAL_ALT(0);
+                for (i = 0; i < 7; i++) {
+                    /* Full name. */
+                    len = strlen(day[i]);
+                    if (arg_strncasecmp(day[i], bp, len) == 0)
+                        break;
+
+                    /* Abbreviated name. */
+                    len = strlen(abday[i]);
+                    if (arg_strncasecmp(abday[i], bp, len) == 0)
+                        break;
+                }
+
+                /* Nothing matched. */
+                if (i == 7)
+                    return (0);
+
+                tm->tm_wday = i;
+                bp += len;
+                break;
+
+            case 'B': /* The month, using the locale's form. */
+            case 'b':
+            case 'h':
+                LEGAL_ALT(0);
+                for (i = 0; i < 12; i++) {
+                    /* Full name. */
+                    len = strlen(mon[i]);
+                    if (arg_strncasecmp(mon[i], bp, len) == 0)
+                        break;
+
+                    /* Abbreviated name. */
+                    len = strlen(abmon[i]);
+                    if (arg_strncasecmp(abmon[i], bp, len) == 0)
+                        break;
+                }
+
+                /* Nothing matched. */
+                if (i == 12)
+                    return (0);
+
+                tm->tm_mon = i;
+                bp += len;
+                break;
+
+            case 'C': /* The century number. */
+                LEGAL_ALT(ALT_E);
+                if (!(conv_num(&bp, &i, 0, 99)))
+                    return (0);
+
+                if (split_year) {
+                    tm->tm_year = (tm->tm_year % 100) + (i * 100);
+                } else {
+                    tm->tm_year = i * 100;
+                    split_year = 1;
+                }
+                break;
+
+            case 'd': /* The day of month. */
+            case 'e':
+                LEGAL_ALT(ALT_O);
+                if (!(conv_num(&bp, &tm->tm_mday, 1, 31)))
+                    return (0);
+                break;
+
+            case 'k': /* The hour (24-hour clock representation). */
+                LEGAL_ALT(0);
+            /* FALLTHROUGH */
+            case 'H':
+                LEGAL_ALT(ALT_O);
+                if (!(conv_num(&bp, &tm->tm_hour, 0, 23)))
+                    return (0);
+                break;
+
+            case 'l': /* The hour (12-hour clock representation). */
+                LEGAL_ALT(0);
+            /* FALLTHROUGH */
+            case 'I':
+                LEGAL_ALT(ALT_O);
+                if (!(conv_num(&bp, &tm->tm_hour, 1, 12)))
+                    return (0);
+                if (tm->tm_hour == 12)
+                    tm->tm_hour = 0;
+                break;
+
+            case 'j': /* The day of year. */
+                LEGAL_ALT(0);
+                if (!(conv_num(&bp, &i, 1, 366)))
+                    return (0);
+                tm->tm_yday = i - 1;
+                break;
+
+            case 'M': /* The minute. */
+                LEGAL_ALT(ALT_O);
+                if (!(conv_num(&bp, &tm->tm_min, 0, 59)))
+                    return (0);
+                break;
+
+            case 'm': /* The month. */
+                LEGAL_ALT(ALT_O);
+                if (!(conv_num(&bp, &i, 1, 12)))
+                    return (0);
+                tm->tm_mon = i - 1;
+                break;
+
+            case 'p': /* The locale's equivalent of AM/PM. */
+                LEGAL_ALT(0);
+                /* AM? */
+                if (arg_strcasecmp(am_pm[0], bp) == 0) {
+                    if (tm->tm_hour > 11)
+                        return (0);
+
+                    bp += strlen(am_pm[0]);
+                    break;
+                }
+                /* PM? */
+                else if (arg_strcasecmp(am_pm[1], bp) == 0) {
+                    if (tm->tm_hour > 11)
+                        return (0);
+
+                    tm->tm_hour += 12;
+                    bp += strlen(am_pm[1]);
+                    break;
+                }
+
+                /* Nothing matched. */
+                return (0);
+
+            case 'S': /* The seconds. */
+                LEGAL_ALT(ALT_O);
+                if (!(conv_num(&bp, &tm->tm_sec, 0, 61)))
+                    return (0);
+                break;
+
+            case 'U': /* The week of year, beginning on sunday. */
+            case 'W': /* The week of year, beginning on monday. */
+                LEGAL_ALT(ALT_O);
+                /*
+                 * XXX This is bogus, as we can not assume any valid
+                 * information present in the tm structure at this
+                 * point to calculate a real value, so just check the
+                 * range for now.
+                 */
+                if (!(conv_num(&bp, &i, 0, 53)))
+                    return (0);
+                break;
+
+            case 'w': /* The day of week, beginning on sunday. */
+                LEGAL_ALT(ALT_O);
+                if (!(conv_num(&bp, &tm->tm_wday, 0, 6)))
+                    return (0);
+                break;
+
+            case 'Y': /* The year. */
+                LEGAL_ALT(ALT_E);
+                if (!(conv_num(&bp, &i, 0, 9999)))
+                    return (0);
+
+                tm->tm_year = i - TM_YEAR_BASE;
+                break;
+
+            case 'y': /* The year within 100 years of the epoch. */
+                LEGAL_ALT(ALT_E | ALT_O);
+                if (!(conv_num(&bp, &i, 0, 99)))
+                    return (0);
+
+                if (split_year) {
+                    tm->tm_year = ((tm->tm_year / 100) * 100) + i;
+                    break;
+                }
+                split_year = 1;
+                if (i <= 68)
+                    tm->tm_year = i + 2000 - TM_YEAR_BASE;
+                else
+                    tm->tm_year = i + 1900 - TM_YEAR_BASE;
+                break;
+
+            /*
+             * Miscellaneous conversions.
+             */
+            case 'n': /* Any kind of white-space. */
+            case 't':
+                LEGAL_ALT(0);
+                while (isspace((int)(*bp)))
+                    bp++;
+                break;
+
+            default: /* Unknown/unsupported conversion. */
+                return (0);
+        }
+    }
+
+    /* LINTED functional specification */
+    return ((char*)bp);
+}
+
+static int conv_num(const char** buf, int* dest, int llim, int ulim) {
+    int result = 0;
+
+    /* The limit also determines the number of valid digits. */
+    int rulim = ulim;
+
+    if (**buf < '0' || **buf > '9')
+        return (0);
+
+    do {
+        result *= 10;
+        result += *(*buf)++ - '0';
+        rulim /= 10;
+    } while ((result * 10 <= ulim) && rulim && **buf >= '0' && **buf <= '9');
+
+    if (result < llim || result > ulim)
+        return (0);
+
+    *dest = result;
+    return (1);
+}
+
+/*
+ * Conversions understood by arg_date_compile(), with the same meaning and the
+ * same alternative modifiers as in arg_strptime(). The composite conversions
+ * are compiled from their expansion.
+ */
+static const struct {
+    char conv;          /* conversion character */
+    int alt;            /* permitted ALT_E and ALT_O modifiers */
+    const char* expand; /* expansion of a composite conversion, or NULL */
+    int code;
+    int lo, hi;
+    int offset, delta;
+} arg_date_convs[] = {
+    {'c', ALT_E, "%x %X", 0, 0, 0, 0, 0},
+    {'D', 0, "%m/%d/%y", 0, 0, 0, 0, 0},
+    {'R', 0, "%H:%M", 0, 0, 0, 0, 0},
+    {'r', 0, "%I:%M:%S %p", 0, 0, 0, 0, 0},
+    {'T', 0, "%H:%M:%S", 0, 0, 0, 0, 0},
+    {'X', ALT_E, "%H:%M:%S", 0, 0, 0, 0, 0},
+    {'x', ALT_E, "%m/%d/%y", 0, 0, 0, 0, 0},
+    {'A', 0, NULL, ARG_DATE_OP_WDAY, 0, 0, 0, 0},
+    {'a', 0, NULL, ARG_DATE_OP_WDAY, 0, 0, 0, 0},
+    {'B', 0, NULL, ARG_DATE_OP_MONTH, 0, 0, 0, 0},
+    {'b', 0, NULL, ARG_DATE_OP_MONTH, 0, 0, 0, 0},
+    {'h', 0, NULL, ARG_DATE_OP_MONTH, 0, 0, 0, 0},
+    {'p', 0, NULL, ARG_DATE_OP_AMPM, 0, 0, 0, 0},
+    {'n', 0, NULL, ARG_DATE_OP_SPACE, 0, 0, 0, 0},
+    {'t', 0, NULL, ARG_DATE_OP_SPACE, 0, 0, 0, 0},
+    {'C', ALT_E, NULL, ARG_DATE_OP_CENTURY, 0, 99, 0, 0},
+    {'d', ALT_O, NULL, ARG_DATE_OP_NUM, 1, 31, offsetof(struct tm, tm_mday), 0},
+    {'e', ALT_O, NULL, ARG_DATE_OP_NUM, 1, 31, offsetof(struct tm, tm_mday), 0},
+    {'k', 0, NULL, ARG_DATE_OP_NUM, 0, 23, offsetof(struct tm, tm_hour), 0},
+    {'H', ALT_O, NULL, ARG_DATE_OP_NUM, 0, 23, offsetof(struct tm, tm_hour), 0},
+    {'l', 0, NULL, ARG_DATE_OP_HOUR12, 1, 12, 0, 0},
+    {'I', ALT_O, NULL, ARG_DATE_OP_HOUR12, 1, 12, 0, 0},
+    {'j', 0, NULL, ARG_DATE_OP_NUM, 1, 366, offsetof(struct tm, tm_yday), -1},
+    {'M', ALT_O, NULL, ARG_DATE_OP_NUM, 0, 59, offsetof(struct tm, tm_min), 0},
+    {'m', ALT_O, NULL, ARG_DATE_OP_NUM, 1, 12, offsetof(struct tm, tm_mon), -1},
+    {'S', ALT_O, NULL, ARG_DATE_OP_NUM, 0, 61, offsetof(struct tm, tm_sec), 0},
+    {'U', ALT_O, NULL, ARG_DATE_OP_RANGE, 0, 53, 0, 0},
+    {'W', ALT_O, NULL, ARG_DATE_OP_RANGE, 0, 53, 0, 0},
+    {'w', ALT_O, NULL, ARG_DATE_OP_NUM, 0, 6, offsetof(struct tm, tm_wday), 0},
+    {'Y', ALT_E, NULL, ARG_DATE_OP_NUM, 0, 9999, offsetof(struct tm, tm_year), -TM_YEAR_BASE},
+    {'y', ALT_E | ALT_O, NULL, ARG_DATE_OP_YEAR2, 0, 99, 0, 0},
+};
+
+/*
+ * Compiles fmt into prog, starting at instruction n, and returns the index
+ * after the last instruction, or -1 if fmt has an unknown conversion or an
+ * illegal modifier. With prog NULL the instructions are only counted. The
+ * depth is nonzero for the expansion of a composite conversion, and *tail is
+ * nonzero while instruction n-1 can still take a literal run.
+ */
+static int arg_date_compile(const char* fmt, int depth, struct arg_date_op* prog, int n, int* tail) {
+    while (*fmt != '\0') {
+        struct arg_date_op op;
+        const char* lit = NULL;
+        int alt = 0;
+        int lim;
+        size_t i;
+
+        memset(&op, 0, sizeof(op));
+        if (isspace((unsigned char)*fmt)) {
+            /* a run of white-space skips any white-space, like a single one */
+            while (isspace((unsigned char)*fmt))
+                fmt++;
+            op.code = ARG_DATE_OP_SPACE;
+        } else if (*fmt != '%') {
+            lit = fmt;
+            while (*fmt != '\0' && *fmt != '%' && !isspace((unsigned char)*fmt))
+                fmt++;
+        } else {
+            /* at most one of the "%E?" and "%O?" modifiers */
+            for (fmt++; *fmt == 'E' || *fmt == 'O'; fmt++) {
+                if (alt)
+                    return -1;
+                alt = (*fmt == 'E') ? ALT_E : ALT_O;
+            }
+
+            if (*fmt == '%') {
+                lit = fmt++;
+            } else {
+                for (i = 0; i < sizeof(arg_date_convs) / sizeof(arg_date_convs[0]); i++) {
+                    if (arg_date_convs[i].conv == *fmt)
+                        break;
+                }
+                if (*fmt == '\0' || i == sizeof(arg_date_convs) / sizeof(arg_date_convs[0]) || (alt & ~arg_date_convs[i].alt))
+                    return -1;
+                fmt++;
+
+                if (arg_date_convs[i].expand) {
+                    n = arg_date_compile(arg_date_convs[i].expand, depth + 1, prog, n, tail);
+                    continue;
+                }
+
+                op.code = arg_date_convs[i].code;
+                op.lo = arg_date_convs[i].lo;
+                op.hi = arg_date_convs[i].hi;
+                op.offset = (int)arg_date_convs[i].offset;
+                op.delta = arg_date_convs[i].delta;
+                /* conv_num() reads at most as many digits as hi has */
+                for (op.width = 1, lim = op.hi; lim >= 10; lim /= 10)
+                    op.width++;
+                if (op.code == ARG_DATE_OP_YEAR2 && depth > 0)
+                    op.code = ARG_DATE_OP_YEAR2X;
+            }
+        }
+
+        /* attach a literal run to the previous instruction, or start the program with it */
+        if (lit) {
+            op.code = ARG_DATE_OP_LIT;
+            op.lit = lit;
+            op.len = (int)(fmt - lit);
+            if (*tail) {
+                if (prog) {
+                    prog[n - 1].lit = op.lit;
+                    prog[n - 1].len = op.len;
+                }
+                *tail = 0;
+                continue;
+            }
+        } else {
+            *tail = 1;
+        }
+
+        if (prog)
+            prog[n] = op;
+        n++;
+    }
+
+    return n;
+}
+
+/* Matches a day or month name, full or abbreviated, and returns its index or -1 */
+static int arg_date_name(const char** bp, const char** full, const char** abbr, int count) {
+    size_t len;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        len = strlen(full[i]);
+        if (arg_strncasecmp(full[i], *bp, len) == 0)
+            break;
+
+        len = strlen(abbr[i]);
+        if (arg_strncasecmp(abbr[i], *bp, len) == 0)
+            break;
+    }
+
+    if (i == count)
+        return -1;
+
+    *bp += len;
+    return i;
+}
+
+/*
+ * Runs a format program over the value in bp, updating tm. Returns a pointer
+ * to the first unparsed character, or NULL if the value does not match.
+ */
+static const char* arg_date_exec(const struct arg_date_op* op, const char* bp, struct tm* tm) {
+    int split_year = 0;
+    int i = 0;
+
+    for (;; op++) {
+        /* read the number of a numeric conversion, with the same digits as conv_num() */
+        if (op->code >= ARG_DATE_OP_NUM) {
+            int width = op->width;
+
+            if (*bp < '0' || *bp > '9')
+                return NULL;
+            i = *bp++ - '0';
+            while (--width > 0 && i * 10 <= op->hi && *bp >= '0' && *bp <= '9')
+                i = i * 10 + (*bp++ - '0');
+            if (i < op->lo || i > op->hi)
+                return NULL;
+        }
+
+        switch (op->code) {
+            case ARG_DATE_OP_END:
+                return bp;
+
+            case ARG_DATE_OP_SPACE:
+                while (isspace((unsigned char)*bp))
+                    bp++;
+                break;
+
+            case ARG_DATE_OP_LIT:
+            case ARG_DATE_OP_RANGE:
+                break;
+
+            case ARG_DATE_OP_WDAY:
+                if ((i = arg_date_name(&bp, day, abday, 7)) < 0)
+                    return NULL;
+                tm->tm_wday = i;
+                break;
+
+            case ARG_DATE_OP_MONTH:
+                if ((i = arg_date_name(&bp, mon, abmon, 12)) < 0)
+                    return NULL;
+                tm->tm_mon = i;
+                break;
+
+            case ARG_DATE_OP_AMPM:
+                /* as in arg_strptime(), AM or PM is compared with the rest of the value */
+                if (tm->tm_hour > 11)
+                    return NULL;
+                if (arg_strcasecmp(am_pm[0], bp) == 0) {
+                    bp += strlen(am_pm[0]);
+                } else if (arg_strcasecmp(am_pm[1], bp) == 0) {
+                    tm->tm_hour += 12;
+                    bp += strlen(am_pm[1]);
+                } else {
+                    return NULL;
+                }
+                break;
+
+            case ARG_DATE_OP_NUM:
+                *(int*)((char*)tm + op->offset) = i + op->delta;
+                break;
+
+            case ARG_DATE_OP_HOUR12:
+                tm->tm_hour = (i == 12) ? 0 : i;
+                break;
+
+            case ARG_DATE_OP_YEAR2:
+                if (split_year) {
+                    tm->tm_year = ((tm->tm_year / 100) * 100) + i;
+                    break;
+                }
+                split_year = 1;
+            /* FALLTHROUGH */
+            case ARG_DATE_OP_YEAR2X:
+                tm->tm_year = (i <= 68) ? i + 2000 - TM_YEAR_BASE : i + 1900 - TM_YEAR_BASE;
+                break;
+
+            case ARG_DATE_OP_CENTURY:
+                if (split_year) {
+                    tm->tm_year = (tm->tm_year % 100) + (i * 100);
+                } else {
+                    tm->tm_year = i * 100;
+                    split_year = 1;
+                }
+                break;
+        }
+
+        /* literal runs are short, so compare them in place rather than calling strncmp() */
+        for (i = 0; i < op->len; i++) {
+            if (bp[i] != op->lit[i])
+                return NULL;
+        }
+        bp += op->len;
+    }
+}
+/*******************************************************************************
+ * arg_dbl: Implements the double command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 1998-2001,2003-2011,2013 Stewart Heitmann
+ * <sheitmann@users.sourceforge.net>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+static void arg_dbl_resetfn(void* parent_) {
+    struct arg_dbl* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+static int arg_dbl_scanfn(void* parent_, const char* argval) {
+    struct arg_dbl* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent argument value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        double val;
+        char* end;
+
+        /* extract double from argval into val, always with '.' as the decimal point */
+        val = arg_strtod(argval, &end);
+
+        /* if success then store result in parent->dval[] array otherwise return error*/
+        if (*end == 0)
+            parent->dval[parent->count++] = val;
+        else
+            errorcode = ARG_ERR_BADDOUBLE;
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_dbl_checkfn(void* parent_) {
+    struct arg_dbl* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_dbl_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_dbl* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADDOUBLE:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+    }
+}
+
+static void* arg_dbl_clonefn(void* parent_) {
+    struct arg_dbl* parent = parent_;
+    struct arg_dbl* result = (struct arg_dbl*)arg_clone_block(parent, sizeof(struct arg_dbl) + (size_t)(parent->hdr.maxcount + 1) * sizeof(double));
+    result->dval = (double*)ARG_CLONE_PTR(result, parent, parent->dval);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_dbl_ext = {ARG_HDR_EXT_VERSION, NULL, arg_dbl_clonefn};
+
+struct arg_dbl* arg_dbl0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_dbln(shortopts, longopts, datatype, 0, 1, glossary);
+}
+
+struct arg_dbl* arg_dbl1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_dbln(shortopts, longopts, datatype, 1, 1, glossary);
+}
+
+struct arg_dbl* arg_dbln(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    size_t nbytes;
+    struct arg_dbl* result;
+    size_t addr;
+    size_t rem;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_dbl)             /* storage for struct arg_dbl */
+             + (size_t)(maxcount + 1) * sizeof(double); /* storage for dval[maxcount] array plus one extra for padding to memory boundary */
+
+    result = (struct arg_dbl*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype ? datatype : "<double>";
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_dbl_resetfn;
+    result->hdr.scanfn = arg_dbl_scanfn;
+    result->hdr.checkfn = arg_dbl_checkfn;
+    result->hdr.errorfn = arg_dbl_errorfn;
+    result->hdr.priv = (void*)&arg_dbl_ext;
+
+    /* Store the dval[maxcount] array on the first double boundary that
+     * immediately follows the arg_dbl struct. We do the memory alignment
+     * purely for SPARC and Motorola systems. They require floats and
+     * doubles to be aligned on natural boundaries.
+     */
+    addr = (size_t)(result + 1);
+    rem = addr % sizeof(double);
+    result->dval = (double*)(addr + sizeof(double) - rem);
+    ARG_TRACE(("addr=%p, dval=%p, sizeof(double)=%d rem=%d\n", addr, result->dval, (int)sizeof(double), (int)rem));
+
+    result->count = 0;
+
+    ARG_TRACE(("arg_dbln() returns %p\n", result));
+    return result;
+}
+/*******************************************************************************
+ * arg_end: Implements the error handling utilities
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 1998-2001,2003-2011,2013 Stewart Heitmann
+ * <sheitmann@users.sourceforge.net>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#if defined(_WIN32)
+#define ARG_ENVIRON _environ
+#elif defined(__APPLE__)
+#include <crt_externs.h>
+#define ARG_ENVIRON (*_NSGetEnviron())
+#else
+extern char** environ;
+#define ARG_ENVIRON environ
+#endif
+
+/* An option bound to an environment variable by arg_end_envbind() */
+struct arg_end_binding {
+    void* parent;
+    const char* name;
+};
+
+/* Where in a configuration file an error was found */
+struct arg_end_where {
+    const char* path;
+    int line;
+};
+
+/* A constraint between options, registered by arg_end_constrain() */
+struct arg_end_constraint {
+    int kind;
+    int nargs;
+    void** args; /* the options, args[0] being the one that requires the others for ARG_CONSTRAINT_REQUIRES */
+    int* index;  /* table index of each option, found on first use */
+    char* text;  /* names of the options, for error messages */
+};
+
+/* Response file expansion, allocated by arg_end_respfile() */
+struct arg_end_resp {
+    char** argv; /* expanded command line */
+    int maxargs;
+    int operands; /* non-zero once "--" has been seen, after which '@' is not special */
+};
+
+/* Options read from the environment, allocated by arg_end_envprefix() or arg_end_envbind() */
+struct arg_end_env {
+    const char* prefix; /* prefix of the variables derived from long options, or NULL */
+    struct arg_end_binding* bindings;
+    int nbindings;
+    int maxbindings;
+};
+
+/* Options read from configuration files, allocated by arg_end_config() */
+struct arg_end_conf {
+    const char** configs; /* configuration files, lowest precedence first */
+    int nconfigs;
+    int maxconfigs;
+    struct arg_end_where* where; /* location of each error[] from a configuration file */
+};
+
+/* Constraints between options, allocated by arg_end_constrain() */
+struct arg_end_rules {
+    struct arg_end_constraint* constraints;
+    int nconstraints;
+    int maxconstraints;
+};
+
+/*
+ * Private data of an arg_end, stored between the struct and its error[]
+ * array. Each feature keeps its state in a struct of its own, allocated when
+ * the feature is set up, so an arg_end that uses none of them only carries
+ * the pointers. The response and configuration files of the last parse stay
+ * mapped, because the expanded argv[] and the values of the options point
+ * into them.
+ */
+struct arg_end_priv {
+    struct arg_hdr_ext ext; /* must come first, see ARG_HASEXT */
+    arg_mmap_t* files;      /* response and configuration files of the last parse */
+    int nfiles;
+    int maxfiles;
+    struct arg_end_resp* resp; /* NULL unless response files are expanded */
+    struct arg_end_env* env;
+    struct arg_end_conf* conf;
+    struct arg_end_rules* rules;
+};
+
+/* A response file being expanded, linked to the one that refers to it */
+struct arg_end_frame {
+    const struct arg_end_frame* up;
+#ifdef _WIN32
+    const char* path; /* st_ino is always 0 on Windows */
+#else
+    dev_t dev;
+    ino_t ino;
+#endif
+};
+
+/* Releases the response and configuration files of the last parse */
+static void arg_end_release(struct arg_end* parent) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)parent->hdr.priv;
+
+    while (priv->nfiles > 0)
+        arg_mmap_close(&priv->files[--priv->nfiles]);
+}
+
+/* Maps a response or configuration file for the rest of the parse */
+static arg_mmap_t* arg_end_map(struct arg_end_priv* priv, const char* path) {
+    arg_mmap_t* map;
+
+    if (priv->nfiles == priv->maxfiles) {
+        priv->maxfiles = priv->maxfiles ? priv->maxfiles * 2 : 4;
+        priv->files = (arg_mmap_t*)xrealloc(priv->files, sizeof(arg_mmap_t) * (size_t)priv->maxfiles);
+    }
+    map = &priv->files[priv->nfiles];
+    if (arg_mmap_open(map, path) != 0)
+        return NULL;
+    priv->nfiles++;
+    return map;
+}
+
+static void arg_end_resetfn(void* parent_) {
+    struct arg_end* parent = parent_;
+    struct arg_end_priv* priv = (struct arg_end_priv*)parent->hdr.priv;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+    arg_end_release(parent);
+    if (priv->conf)
+        memset(priv->conf->where, 0, sizeof(struct arg_end_where) * (size_t)parent->hdr.maxcount);
+}
+
+static void arg_end_freefn(void* parent_) {
+    struct arg_end* parent = parent_;
+    struct arg_end_priv* priv = (struct arg_end_priv*)parent->hdr.priv;
+    ARG_TRACE(("%s:freefn(%p)\n", __FILE__, parent));
+    arg_end_release(parent);
+    xfree(priv->files);
+    if (priv->resp) {
+        xfree(priv->resp->argv);
+        xfree(priv->resp);
+    }
+    if (priv->env) {
+        xfree(priv->env->bindings);
+        xfree(priv->env);
+    }
+    if (priv->conf) {
+        xfree(priv->conf->configs);
+        xfree(priv->conf->where);
+        xfree(priv->conf);
+    }
+    if (priv->rules) {
+        while (priv->rules->nconstraints > 0)
+            xfree(priv->rules->constraints[--priv->rules->nconstraints].args);
+        xfree(priv->rules->constraints);
+        xfree(priv->rules);
+    }
+}
+
+/* Returns the environment settings, allocating them on first use */
+static struct arg_end_env* arg_end_env(struct arg_end* end) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+
+    if (!priv->env)
+        priv->env = (struct arg_end_env*)xcalloc(1, sizeof(struct arg_end_env));
+    return priv->env;
+}
+
+static void arg_end_push(struct arg_end_resp* resp, int* argc, char* arg) {
+    /* keep room for the NULL that terminates argv[] */
+    if (*argc + 1 >= resp->maxargs) {
+        resp->maxargs *= 2;
+        resp->argv = (char**)xrealloc(resp->argv, sizeof(char*) * (size_t)resp->maxargs);
+    }
+    resp->argv[(*argc)++] = arg;
+}
+
+/*
+ * Appends the words of the response file named by ref, which is "@path", to
+ * the expanded argv[]. The words are tokenized in place in the mapping, and
+ * words that start with '@' are expanded in turn, unless the file they name
+ * is already being expanded.
+ */
+static void arg_end_include(struct arg_end* end, char* ref, const struct arg_end_frame* up, int* argc) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    const struct arg_end_frame* frame;
+    struct arg_end_frame self;
+    arg_scanner_t scanner;
+    arg_mmap_t* map;
+    struct stat st;
+    char* word;
+
+    if (stat(ref + 1, &st) != 0) {
+        arg_register_error(end, end, ARG_ERESPFILE, ref);
+        return;
+    }
+
+    self.up = up;
+#ifdef _WIN32
+    self.path = ref + 1;
+    for (frame = up; frame; frame = frame->up) {
+        if (strcmp(frame->path, self.path) == 0)
+            break;
+    }
+#else
+    self.dev = st.st_dev;
+    self.ino = st.st_ino;
+    for (frame = up; frame; frame = frame->up) {
+        if (frame->dev == self.dev && frame->ino == self.ino)
+            break;
+    }
+#endif
+    if (frame) {
+        arg_register_error(end, end, ARG_ERESPCYCLE, ref);
+        return;
+    }
+
+    map = arg_end_map(priv, ref + 1);
+    if (!map) {
+        arg_register_error(end, end, ARG_ERESPFILE, ref);
+        return;
+    }
+
+    arg_scanner_init(&scanner, map->data, map->len, 0);
+    while (arg_scan_word(&scanner, &word)) {
+        if (!priv->resp->operands && !scanner.quoted && word[0] == '@' && word[1] != '\0') {
+            arg_end_include(end, word, &self, argc);
+        } else {
+            if (strcmp(word, "--") == 0)
+                priv->resp->operands = 1;
+            arg_end_push(priv->resp, argc, word);
+        }
+    }
+}
+
+int arg_end_expand(struct arg_end* end, int argc, char** argv, char*** expanded) {
+    struct arg_end_resp* resp = ((struct arg_end_priv*)end->hdr.priv)->resp;
+    int n = 0;
+    int i;
+
+    *expanded = argv;
+    if (!resp)
+        return argc;
+
+    /*
+     * Leave argv[] alone unless it refers to a response file, argv[0] being
+     * the program name. Words after "--" are operands, so "@name" there is
+     * passed on as it is, as is a quoted "@name" inside a response file.
+     */
+    for (i = 1; i < argc && strcmp(argv[i], "--") != 0; i++) {
+        if (argv[i][0] == '@' && argv[i][1] != '\0')
+            break;
+    }
+    if (i == argc || argv[i][0] != '@')
+        return argc;
+
+    resp->operands = 0;
+    for (i = 0; i < argc; i++) {
+        if (i > 0 && !resp->operands && argv[i][0] == '@' && argv[i][1] != '\0') {
+            arg_end_include(end, argv[i], NULL, &n);
+        } else {
+            if (i > 0 && strcmp(argv[i], "--") == 0)
+                resp->operands = 1;
+            arg_end_push(resp, &n, argv[i]);
+        }
+    }
+    resp->argv[n] = NULL;
+
+    *expanded = resp->argv;
+    return n;
+}
+
+/* Hashes an environment variable name, which ends at the '=' of an environ[] entry */
+static unsigned int arg_end_envhash(const void* key) {
+    const unsigned char* p = (const unsigned char*)key;
+    unsigned int hash = 5381;
+
+    while (*p && *p != '=')
+        hash = hash * 33 + *p++;
+    return hash;
+}
+
+static int arg_end_enveq(const void* k1, const void* k2) {
+    const char* a = (const char*)k1;
+    const char* b = (const char*)k2;
+
+    while (*a && *a != '=' && *a == *b) {
+        a++;
+        b++;
+    }
+    return (*a == '\0' || *a == '=') && (*b == '\0' || *b == '=');
+}
+
+/* Returns non-zero unless a flag's variable is empty or one of 0, false, no and off */
+static int arg_end_envtrue(const char* value) {
+    static const char* const off[] = {"", "0", "false", "no", "off"};
+    size_t i;
+
+    for (i = 0; i < sizeof(off) / sizeof(off[0]); i++) {
+        const char* a = value;
+        const char* b = off[i];
+        while (*a && tolower((unsigned char)*a) == *b) {
+            a++;
+            b++;
+        }
+        if (*a == '\0' && *b == '\0')
+            return 0;
+    }
+    return 1;
+}
+
+/* Hashes the parent of an option, as bound by arg_end_envbind() */
+static unsigned int arg_end_parenthash(const void* key) {
+    return (unsigned int)((size_t)key >> 3);
+}
+
+static int arg_end_parenteq(const void* k1, const void* k2) {
+    return k1 == k2;
+}
+
+/* Returns the variable an option is bound to, building a name from the prefix in buf if needed */
+static const char* arg_end_envname(const struct arg_end_env* env, arg_hashtable_t* bound, struct arg_hdr* hdr, arg_dstr_t buf) {
+    const struct arg_end_binding* binding;
+    const char* p;
+
+    /* a binding with a NULL name keeps the option out of the environment */
+    binding = bound ? (const struct arg_end_binding*)arg_hashtable_search(bound, hdr->parent) : NULL;
+    if (binding)
+        return binding->name;
+    if (!env->prefix || !hdr->longopts || !*hdr->longopts)
+        return NULL;
+
+    /* --dry-run with the prefix MYTOOL_ is read from MYTOOL_DRY_RUN */
+    arg_dstr_reset(buf);
+    arg_dstr_cat(buf, env->prefix);
+    for (p = hdr->longopts; *p && *p != ','; p++)
+        arg_dstr_catc(buf, *p == '-' ? '_' : (char)toupper((unsigned char)*p));
+    return arg_dstr_cstr(buf);
+}
+
+/*
+ * Scans a value from the environment or a configuration file. A flag without
+ * a value is set, or left alone if the value turns it off. Returns non-zero
+ * if the option was scanned, with the error of its scanfn in *errorcode.
+ */
+static int arg_end_scan(struct arg_hdr* hdr, const char* value, int* errorcode) {
+    if (hdr->flag & ARG_HASVALUE)
+        *errorcode = hdr->scanfn(hdr->parent, value);
+    else if (!value || arg_end_envtrue(value))
+        *errorcode = hdr->scanfn(hdr->parent, NULL);
+    else
+        return 0;
+    return 1;
+}
+
+/* Reads the options the command line left out from the environment, marking them in given */
+static void arg_end_envscan(struct arg_end* end, struct arg_hdr** table, arg_bits_t* given) {
+    const struct arg_end_env* settings = ((struct arg_end_priv*)end->hdr.priv)->env;
+    char** env = ARG_ENVIRON;
+    size_t prefixlen = (settings->nbindings == 0 && settings->prefix) ? strlen(settings->prefix) : 0;
+    arg_hashtable_t* index;
+    arg_hashtable_t* bound = NULL;
+    arg_dstr_t buf;
+    int tabindex;
+    int n = 0;
+    int i;
+
+    /*
+     * Index environ[] once, so each option costs one lookup rather than a
+     * getenv() scan. The keys and values point into environ[] itself.
+     * Entries are inserted last to first, so the first of two variables
+     * with the same name is found, as with getenv().
+     */
+    while (env && env[n])
+        n++;
+    index = arg_hashtable_create((unsigned int)(n + n / 2), arg_end_envhash, arg_end_enveq);
+    index->freekeys = 0;
+    for (i = n - 1; i >= 0; i--) {
+        char* eq;
+
+        /* with only a prefix rule, other variables can never match */
+        if (prefixlen && strncmp(env[i], settings->prefix, prefixlen) != 0)
+            continue;
+        eq = strchr(env[i], '=');
+        if (eq)
+            arg_hashtable_insert(index, env[i], eq + 1);
+    }
+
+    /* likewise the bindings, so finding the name of an option does not depend on their number */
+    if (settings->nbindings > 0) {
+        bound = arg_hashtable_create((unsigned int)(settings->nbindings + settings->nbindings / 2), arg_end_parenthash, arg_end_parenteq);
+        bound->freekeys = 0;
+        for (i = 0; i < settings->nbindings; i++)
+            arg_hashtable_insert(bound, settings->bindings[i].parent, &settings->bindings[i]);
+    }
+
+    buf = arg_dstr_create();
+    for (tabindex = 0; !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        struct arg_hdr* hdr = table[tabindex];
+        const char* name;
+        const char* value;
+        int errorcode;
+
+        /* options given on the command line take precedence over the environment */
+        if (ARG_BITS_TEST(given, tabindex) || !hdr->scanfn || (!hdr->shortopts && !hdr->longopts))
+            continue;
+
+        name = arg_end_envname(settings, bound, hdr, buf);
+        value = name ? (const char*)arg_hashtable_search(index, name) : NULL;
+        if (!value || !arg_end_scan(hdr, value, &errorcode))
+            continue;
+
+        ARG_BITS_SET(given, tabindex);
+        if (errorcode != 0)
+            arg_register_error(end, hdr->parent, errorcode, value);
+    }
+
+    arg_dstr_destroy(buf);
+    if (bound)
+        arg_hashtable_destroy(bound, 0);
+    arg_hashtable_destroy(index, 0);
+}
+
+/* Hashes a long option name, which ends at the ',' before the next alias in longopts */
+static unsigned int arg_end_opthash(const void* key) {
+    const unsigned char* p = (const unsigned char*)key;
+    unsigned int hash = 5381;
+
+    while (*p && *p != ',')
+        hash = hash * 33 + *p++;
+    return hash;
+}
+
+static int arg_end_opteq(const void* k1, const void* k2) {
+    const char* a = (const char*)k1;
+    const char* b = (const char*)k2;
+
+    while (*a && *a != ',' && *a == *b) {
+        a++;
+        b++;
+    }
+    return (*a == '\0' || *a == ',') && (*b == '\0' || *b == ',');
+}
+
+/* Records an error found in a configuration file, with its location */
+static void arg_end_configerror(struct arg_end* end, void* parent, int error, const char* argval, const char* path, int line) {
+    struct arg_end_where* where = ((struct arg_end_priv*)end->hdr.priv)->conf->where;
+    int i = end->count;
+
+    arg_register_error(end, parent, error, argval);
+    if (end->count > i) {
+        where[i].path = path;
+        where[i].line = line;
+    }
+}
+
+#define ARG_END_ISBLANK(c) ((c) == ' ' || (c) == '\t' || (c) == '\r' || (c) == '\f' || (c) == '\v')
+#define ARG_END_ISKEY(c) (isalnum((unsigned char)(c)) || (c) == '-' || (c) == '_' || (c) == '.')
+
+/*
+ * Reads one configuration file in a single pass over its mapping. Each line
+ * is empty, a comment starting with '#' or ';', a "[section]" header, which
+ * is ignored, or "key = value", where key is a long option. A value can be
+ * enclosed in single or double quotes to keep leading or trailing blanks,
+ * and a key without "= value" sets a flag. Keys and values are terminated
+ * in place, so the values of the options point into the mapping. Options
+ * marked in given are skipped, and the options the file sets are marked in
+ * seen.
+ */
+static void arg_end_configscan(struct arg_end* end, struct arg_hdr** table, arg_hashtable_t* keys, const char* path, const arg_bits_t* given,
+                               arg_bits_t* seen) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    arg_mmap_t* map;
+    char* p;
+    char* eof;
+    int line = 0;
+
+    errno = 0;
+    map = arg_end_map(priv, path);
+    if (!map) {
+        /* a layer that does not exist is simply left out */
+        if (errno != ENOENT)
+            arg_end_configerror(end, end, ARG_ECONFFILE, path, path, 0);
+        return;
+    }
+
+    p = map->data;
+    eof = map->data + map->len;
+    while (p < eof) {
+        char* eol = (char*)memchr(p, '\n', (size_t)(eof - p));
+        char* next;
+        char* key;
+        char* keyend;
+        char* value = NULL;
+        struct arg_hdr** slot;
+        int tabindex;
+        int errorcode;
+
+        if (!eol)
+            eol = eof;
+        next = eol < eof ? eol + 1 : eof;
+        line++;
+
+        /* trim the line */
+        while (p < eol && ARG_END_ISBLANK(*p))
+            p++;
+        while (eol > p && ARG_END_ISBLANK(eol[-1]))
+            eol--;
+        if (p == eol || *p == '#' || *p == ';' || (*p == '[' && eol[-1] == ']')) {
+            p = next;
+            continue;
+        }
+
+        key = p;
+        while (p < eol && ARG_END_ISKEY(*p))
+            p++;
+        keyend = p;
+        while (p < eol && ARG_END_ISBLANK(*p))
+            p++;
+
+        *eol = '\0';
+        if (keyend == key || (p < eol && *p != '=')) {
+            arg_end_configerror(end, end, ARG_ECONFSYNTAX, key, path, line);
+            p = next;
+            continue;
+        }
+
+        if (p < eol) {
+            for (p++; p < eol && ARG_END_ISBLANK(*p); p++)
+                ;
+            value = p;
+            if (eol - value >= 2 && (*value == '"' || *value == '\'') && eol[-1] == *value) {
+                value++;
+                eol[-1] = '\0';
+            }
+        }
+        *keyend = '\0';
+        p = next;
+
+        slot = (struct arg_hdr**)arg_hashtable_search(keys, key);
+        if (!slot) {
+            arg_end_configerror(end, end, ARG_ECONFKEY, key, path, line);
+            continue;
+        }
+
+        /* options from a layer of higher precedence are kept */
+        tabindex = (int)(slot - table);
+        if (ARG_BITS_TEST(given, tabindex))
+            continue;
+        ARG_BITS_SET(seen, tabindex);
+
+        if (!value && ((*slot)->flag & ARG_HASVALUE))
+            arg_end_configerror(end, end, ARG_EMISSARG, key, path, line);
+        else if (arg_end_scan(*slot, value, &errorcode) && errorcode != 0)
+            arg_end_configerror(end, (*slot)->parent, errorcode, value, path, line);
+    }
+}
+
+int arg_end_hasrespfile(struct arg_end* end) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    return priv->resp != NULL;
+}
+
+int arg_end_haslayers(struct arg_end* end) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    return (priv->env && (priv->env->prefix || priv->env->nbindings > 0)) || (priv->conf && priv->conf->nconfigs > 0);
+}
+
+int arg_end_hasconstraints(struct arg_end* end) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    return priv->rules && priv->rules->nconstraints > 0;
+}
+
+void arg_end_checkconstraints(struct arg_end* end, struct arg_hdr** table, const arg_bits_t* present) {
+    struct arg_end_rules* rules = ((struct arg_end_priv*)end->hdr.priv)->rules;
+    int ntable;
+    int i, j;
+
+    for (ntable = 0; !(table[ntable]->flag & ARG_TERMINATOR); ntable++)
+        ;
+
+    for (i = 0; i < rules->nconstraints; i++) {
+        struct arg_end_constraint* c = &rules->constraints[i];
+        int npresent = 0;
+        int first = 0;
+
+        for (j = 0; j < c->nargs; j++) {
+            int* index = &c->index[j];
+
+            /* the index is kept from the last parse, unless the option has moved */
+            if (*index < 0 || *index >= ntable || table[*index] != c->args[j]) {
+                for (*index = 0; *index < ntable && table[*index] != c->args[j]; (*index)++)
+                    ;
+            }
+            if (*index < ntable && ARG_BITS_TEST(present, *index)) {
+                npresent++;
+                if (j == 0)
+                    first = 1;
+            }
+        }
+
+        switch (c->kind) {
+            case ARG_CONSTRAINT_EXCLUSIVE:
+                if (npresent > 1)
+                    arg_register_error(end, end, ARG_EEXCLUSIVE, c->text);
+                break;
+            case ARG_CONSTRAINT_REQUIRES:
+                if (first && npresent < c->nargs)
+                    arg_register_error(end, end, ARG_EREQUIRES, c->text);
+                break;
+            case ARG_CONSTRAINT_ANYOF:
+                if (npresent == 0)
+                    arg_register_error(end, end, ARG_EANYOF, c->text);
+                break;
+        }
+    }
+}
+
+void arg_end_scanlayers(struct arg_end* end, struct arg_hdr** table, arg_bits_t* given) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    arg_hashtable_t* keys;
+    arg_bits_t* seen;
+    size_t nwords;
+    size_t w;
+    int ntable;
+    int tabindex;
+    int i;
+
+    if (priv->env && (priv->env->prefix || priv->env->nbindings > 0))
+        arg_end_envscan(end, table, given);
+    if (!priv->conf || priv->conf->nconfigs == 0)
+        return;
+
+    /* index the long options of the table, and each of their aliases, once for all files */
+    for (ntable = 0; !(table[ntable]->flag & ARG_TERMINATOR); ntable++)
+        ;
+    keys = arg_hashtable_create((unsigned int)(2 * ntable), arg_end_opthash, arg_end_opteq);
+    keys->freekeys = 0;
+    for (tabindex = 0; tabindex < ntable; tabindex++) {
+        const char* p = table[tabindex]->longopts;
+        if (!p || !table[tabindex]->scanfn)
+            continue;
+        while (*p) {
+            if (*p != ',')
+                arg_hashtable_insert(keys, (void*)p, &table[tabindex]);
+            while (*p && *p != ',')
+                p++;
+            if (*p)
+                p++;
+        }
+    }
+
+    /* read the files from the highest precedence down, each keeping what the ones before it set */
+    nwords = ARG_BITS_LEN(ntable + 1);
+    seen = (arg_bits_t*)xcalloc(nwords, sizeof(arg_bits_t));
+    for (i = priv->conf->nconfigs - 1; i >= 0; i--) {
+        arg_end_configscan(end, table, keys, priv->conf->configs[i], given, seen);
+        for (w = 0; w < nwords; w++)
+            given[w] |= seen[w];
+    }
+
+    xfree(seen);
+    arg_hashtable_destroy(keys, 0);
+}
+
+static void arg_end_errorfn(void* parent, arg_dstr_t ds, int error, const char* argval, const char* progname) {
+    /* suppress unreferenced formal parameter warning */
+    (void)parent;
+
+    progname = progname ? progname : "";
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (error) {
+        case ARG_ELIMIT:
+            arg_dstr_cat(ds, "too many errors to display");
+            break;
+        case ARG_EMALLOC:
+            arg_dstr_cat(ds, "insufficient memory");
+            break;
+        case ARG_ENOMATCH:
+            arg_dstr_catf(ds, "unexpected argument \"%s\"", argval);
+            break;
+        case ARG_EMISSARG:
+            arg_dstr_catf(ds, "option \"%s\" requires an argument", argval);
+            break;
+        case ARG_ERESPFILE:
+            arg_dstr_catf(ds, "cannot read response file \"%s\"", argval + (*argval == '@'));
+            break;
+        case ARG_ERESPCYCLE:
+            arg_dstr_catf(ds, "response file \"%s\" refers to itself", argval + (*argval == '@'));
+            break;
+        case ARG_ECONFFILE:
+            arg_dstr_catf(ds, "cannot read configuration file \"%s\"", argval);
+            break;
+        case ARG_ECONFKEY:
+            arg_dstr_catf(ds, "unknown option \"%s\"", argval);
+            break;
+        case ARG_ECONFSYNTAX:
+            arg_dstr_catf(ds, "invalid line \"%s\"", argval);
+            break;
+        case ARG_EEXCLUSIVE:
+            arg_dstr_catf(ds, "only one of %s may be given", argval);
+            break;
+        case ARG_EREQUIRES:
+            arg_dstr_catf(ds, "option %s", argval);
+            break;
+        case ARG_EANYOF:
+            arg_dstr_catf(ds, "one of %s is required", argval);
+            break;
+        case ARG_ELONGOPT:
+            arg_dstr_catf(ds, "invalid option \"%s\"", argval);
+            break;
+        default:
+            arg_dstr_catf(ds, "invalid option \"-%c\"", error);
+            break;
+    }
+
+    arg_dstr_cat(ds, "\n");
+}
+
+/* Registers a constraint that arg_end_constrain() has validated */
+static void arg_end_addconstraint(struct arg_end* end, int kind, void** args, int nargs) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    struct arg_end_rules* rules;
+    struct arg_end_constraint* c;
+    arg_dstr_t ds = arg_dstr_create();
+    size_t len;
+    int i;
+
+    for (i = 0; i < nargs; i++) {
+        struct arg_hdr* hdr = (struct arg_hdr*)args[i];
+
+        if (i > 0)
+            arg_dstr_cat(ds, (kind == ARG_CONSTRAINT_REQUIRES && i == 1) ? " requires " : ", ");
+        arg_print_option_ds(ds, hdr->shortopts, hdr->longopts, (hdr->shortopts || hdr->longopts) ? NULL : hdr->datatype, NULL);
+    }
+    len = strlen(arg_dstr_cstr(ds)) + 1;
+
+    if (!priv->rules)
+        priv->rules = (struct arg_end_rules*)xcalloc(1, sizeof(struct arg_end_rules));
+    rules = priv->rules;
+    if (rules->nconstraints == rules->maxconstraints) {
+        rules->maxconstraints = rules->maxconstraints ? rules->maxconstraints * 2 : 4;
+        rules->constraints =
+            (struct arg_end_constraint*)xrealloc(rules->constraints, sizeof(struct arg_end_constraint) * (size_t)rules->maxconstraints);
+    }
+    c = &rules->constraints[rules->nconstraints++];
+    c->kind = kind;
+    c->nargs = nargs;
+
+    /* the options, their indexes and the text share one block */
+    c->args = (void**)xmalloc((sizeof(void*) + sizeof(int)) * (size_t)nargs + len);
+    c->index = (int*)(c->args + nargs);
+    c->text = (char*)(c->index + nargs);
+    for (i = 0; i < nargs; i++) {
+        c->args[i] = args[i];
+        c->index[i] = -1;
+    }
+    memcpy(c->text, arg_dstr_cstr(ds), len);
+    arg_dstr_destroy(ds);
+}
+
+/* Copies the terminator with its settings, but none of the errors or files of the last parse */
+static void* arg_end_clonefn(void* parent_) {
+    struct arg_end* parent = parent_;
+    struct arg_end_priv* priv = (struct arg_end_priv*)parent->hdr.priv;
+    struct arg_end_priv* rpriv;
+    struct arg_end* result;
+    size_t maxcount = (size_t)parent->hdr.maxcount;
+    int i;
+
+    result = (struct arg_end*)arg_clone_block(
+        parent, sizeof(struct arg_end) + sizeof(struct arg_end_priv) + maxcount * (sizeof(int) + sizeof(void*) + sizeof(char*)));
+    result->error = (int*)ARG_CLONE_PTR(result, parent, parent->error);
+    result->parent = (void**)ARG_CLONE_PTR(result, parent, parent->parent);
+    result->argval = (const char**)ARG_CLONE_PTR(result, parent, parent->argval);
+    result->count = 0;
+
+    /* the features are set up again rather than sharing the parent's state */
+    rpriv = (struct arg_end_priv*)ARG_CLONE_PTR(result, parent, priv);
+    rpriv->files = NULL;
+    rpriv->nfiles = 0;
+    rpriv->maxfiles = 0;
+    rpriv->resp = NULL;
+    rpriv->env = NULL;
+    rpriv->conf = NULL;
+    rpriv->rules = NULL;
+    result->hdr.priv = rpriv;
+
+    if (priv->resp)
+        arg_end_respfile(result, 1);
+    if (priv->env) {
+        arg_end_envprefix(result, priv->env->prefix);
+        for (i = 0; i < priv->env->nbindings; i++)
+            arg_end_envbind(result, priv->env->bindings[i].parent, priv->env->bindings[i].name);
+    }
+    if (priv->conf) {
+        for (i = 0; i < priv->conf->nconfigs; i++)
+            arg_end_config(result, priv->conf->configs[i]);
+    }
+    if (priv->rules) {
+        for (i = 0; i < priv->rules->nconstraints; i++) {
+            struct arg_end_constraint* c = &priv->rules->constraints[i];
+            arg_end_addconstraint(result, c->kind, c->args, c->nargs);
+        }
+    }
+    return result;
+}
+
+void arg_end_rebind(struct arg_end* end, void* from, void* to) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    int i;
+
+    for (i = 0; priv->env && i < priv->env->nbindings; i++) {
+        if (priv->env->bindings[i].parent == from)
+            priv->env->bindings[i].parent = to;
+    }
+    for (i = 0; priv->rules && i < priv->rules->nconstraints; i++) {
+        struct arg_end_constraint* c = &priv->rules->constraints[i];
+        int j;
+
+        for (j = 0; j < c->nargs; j++) {
+            if (c->args[j] == from)
+                c->args[j] = to;
+        }
+    }
+}
+
+/* The optional functions of an arg_end */
+static const struct arg_hdr_ext arg_end_ext = {ARG_HDR_EXT_VERSION, arg_end_freefn, arg_end_clonefn};
+
+struct arg_end* arg_end(int maxcount) {
+    size_t nbytes;
+    struct arg_end* result;
+    struct arg_end_priv* priv;
+
+    nbytes = sizeof(struct arg_end) + sizeof(struct arg_end_priv) /* storage for the private data */
+             + (size_t)maxcount * sizeof(int)                      /* storage for int error[maxcount] array*/
+             + (size_t)maxcount * sizeof(void*)                    /* storage for void* parent[maxcount] array */
+             + (size_t)maxcount * sizeof(char*);                   /* storage for char* argval[maxcount] array */
+
+    result = (struct arg_end*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_TERMINATOR | ARG_HASEXT;
+    result->hdr.shortopts = NULL;
+    result->hdr.longopts = NULL;
+    result->hdr.datatype = NULL;
+    result->hdr.glossary = NULL;
+    result->hdr.mincount = 1;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_end_resetfn;
+    result->hdr.scanfn = NULL;
+    result->hdr.checkfn = NULL;
+    result->hdr.errorfn = arg_end_errorfn;
+
+    /* store the private data immediately after struct arg_end */
+    priv = (struct arg_end_priv*)(result + 1);
+    memset(priv, 0, sizeof(struct arg_end_priv));
+    priv->ext = arg_end_ext;
+    result->hdr.priv = priv;
+
+    /* store error[maxcount] array immediately after the private data */
+    result->error = (int*)(priv + 1);
+
+    /* store parent[maxcount] array immediately after error[] array */
+    result->parent = (void**)(result->error + maxcount);
+
+    /* store argval[maxcount] array immediately after parent[] array */
+    result->argval = (const char**)(result->parent + maxcount);
+
+    ARG_TRACE(("arg_end(%d) returns %p\n", maxcount, result));
+    return result;
+}
+
+void arg_print_errors_ds(arg_dstr_t ds, struct arg_end* end, const char* progname) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    struct arg_end_where* where = priv->conf ? priv->conf->where : NULL;
+    arg_dstr_t located = NULL;
+    int i;
+    ARG_TRACE(("arg_errors()\n"));
+    for (i = 0; i < end->count; i++) {
+        struct arg_hdr* errorparent = (struct arg_hdr*)(end->parent[i]);
+        const char* name = progname;
+
+        /* errors from a configuration file name the file and line after the program */
+        if (where && where[i].path && end->error[i] != ARG_ELIMIT) {
+            if (!located)
+                located = arg_dstr_create();
+            arg_dstr_reset(located);
+            arg_dstr_catf(located, "%s%s%s", progname ? progname : "", progname && *progname ? ": " : "", where[i].path);
+            if (where[i].line > 0)
+                arg_dstr_catf(located, ":%d", where[i].line);
+            name = arg_dstr_cstr(located);
+        }
+
+        if (errorparent->errorfn)
+            errorparent->errorfn(end->parent[i], ds, end->error[i], end->argval[i], name);
+    }
+    if (located)
+        arg_dstr_destroy(located);
+}
+
+void arg_print_errors(FILE* fp, struct arg_end* end, const char* progname) {
+    arg_dstr_t ds = arg_dstr_create();
+    arg_print_errors_ds(ds, end, progname);
+    fputs(arg_dstr_cstr(ds), fp);
+    arg_dstr_destroy(ds);
+}
+
+void arg_end_respfile(struct arg_end* end, int enable) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+
+    if (enable && !priv->resp) {
+        priv->resp = (struct arg_end_resp*)xmalloc(sizeof(struct arg_end_resp));
+        priv->resp->maxargs = 64;
+        priv->resp->operands = 0;
+        priv->resp->argv = (char**)xmalloc(sizeof(char*) * (size_t)priv->resp->maxargs);
+    } else if (!enable && priv->resp) {
+        arg_end_release(end);
+        xfree(priv->resp->argv);
+        xfree(priv->resp);
+        priv->resp = NULL;
+    }
+}
+
+void arg_end_envprefix(struct arg_end* end, const char* prefix) {
+    arg_end_env(end)->prefix = prefix;
+}
+
+void arg_end_envbind(struct arg_end* end, void* arg, const char* name) {
+    struct arg_end_env* env = arg_end_env(end);
+    int i;
+
+    for (i = 0; i < env->nbindings; i++) {
+        if (env->bindings[i].parent == arg) {
+            env->bindings[i].name = name;
+            return;
+        }
+    }
+
+    if (env->nbindings == env->maxbindings) {
+        env->maxbindings = env->maxbindings ? env->maxbindings * 2 : 8;
+        env->bindings = (struct arg_end_binding*)xrealloc(env->bindings, sizeof(struct arg_end_binding) * (size_t)env->maxbindings);
+    }
+    env->bindings[env->nbindings].parent = arg;
+    env->bindings[env->nbindings].name = name;
+    env->nbindings++;
+}
+
+void arg_end_config(struct arg_end* end, const char* path) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    struct arg_end_conf* conf = priv->conf;
+
+    if (!path) {
+        if (conf)
+            conf->nconfigs = 0;
+        return;
+    }
+
+    if (!conf) {
+        conf = (struct arg_end_conf*)xcalloc(1, sizeof(struct arg_end_conf));
+        conf->where = (struct arg_end_where*)xcalloc((size_t)end->hdr.maxcount, sizeof(struct arg_end_where));
+        priv->conf = conf;
+    }
+    if (conf->nconfigs == conf->maxconfigs) {
+        conf->maxconfigs = conf->maxconfigs ? conf->maxconfigs * 2 : 4;
+        conf->configs = (const char**)xrealloc((void*)conf->configs, sizeof(const char*) * (size_t)conf->maxconfigs);
+    }
+    conf->configs[conf->nconfigs++] = path;
+}
+
+int arg_end_constrain(void** argtable, int kind, void** args, int nargs) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    int ntable;
+    int i, j;
+
+    for (ntable = 0; !(table[ntable]->flag & ARG_TERMINATOR); ntable++)
+        ;
+
+    if (kind != ARG_CONSTRAINT_EXCLUSIVE && kind != ARG_CONSTRAINT_REQUIRES && kind != ARG_CONSTRAINT_ANYOF) {
+        ARG_LOG(("argtable: ERROR - unknown constraint kind %d\n", kind));
+        ARG_LOG(("argtable: Bad argument table.\n"));
+        return -1;
+    }
+
+    /* with fewer options, an exclusion or a requirement could never be violated */
+    if (!args || nargs < (kind == ARG_CONSTRAINT_ANYOF ? 1 : 2)) {
+        ARG_LOG(("argtable: ERROR - too few options (%d) for a constraint\n", nargs));
+        ARG_LOG(("argtable: Bad argument table.\n"));
+        return -1;
+    }
+
+    for (i = 0; i < nargs; i++) {
+        for (j = 0; j < ntable && argtable[j] != args[i]; j++)
+            ;
+        if (j == ntable) {
+            ARG_LOG(("argtable: ERROR - option %d of a constraint is not an entry of the table\n", i));
+            ARG_LOG(("argtable: Bad argument table.\n"));
+            return -1;
+        }
+    }
+
+    arg_end_addconstraint((struct arg_end*)table[ntable], kind, args, nargs);
+    return 0;
+}
+/*******************************************************************************
+ * arg_glob: Implements glob pattern expansion for file arguments
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+/* lstat() and d_type are POSIX and BSD extensions that strict C modes hide */
+#if !defined(_WIN32) && !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE 700
+#endif
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE
+#endif
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _WIN32
+#include <io.h>
+#define ARG_GLOB_ISSEP(c) ((c) == '/' || (c) == '\\')
+#else
+#include <dirent.h>
+#define ARG_GLOB_ISSEP(c) ((c) == '/')
+#endif
+
+#ifndef S_ISDIR
+#define S_ISDIR(m) (((m) & S_IFMT) == S_IFDIR)
+#endif
+
+/* A growable list of heap allocated paths */
+struct arg_glob_list {
+    char** items;
+    int count;
+    int alloc;
+};
+
+/*
+ * Reads one directory. With a pattern, the task keeps the entries whose names
+ * match it; without one, it keeps every subdirectory, which is how "**"
+ * descends. Directories are kept with a trailing separator so that the next
+ * component can be appended directly.
+ */
+struct arg_glob_task {
+    const char* dir; /* directory to read, "" for the current directory */
+    const char* pat; /* pattern of the component, not null-terminated, or NULL */
+    size_t patlen;
+    int dirsonly; /* only keep directories */
+    int limit;    /* stop reading once more than this many entries are kept */
+    struct arg_glob_list out;
+    arg_task_t task;
+};
+
+/* The worker pool, created when a level of the walk first has more than one directory to read */
+struct arg_glob_ctx {
+    int nworkers;
+    int limit;
+    arg_tpool_t* pool;
+};
+
+static char* arg_glob_push(struct arg_glob_list* list, const char* dir, const char* name, size_t namelen, int sep) {
+    size_t dirlen = strlen(dir);
+    char* path = (char*)xmalloc(dirlen + namelen + 2);
+
+    memcpy(path, dir, dirlen);
+    memcpy(path + dirlen, name, namelen);
+    if (sep)
+        path[dirlen + namelen++] = '/';
+    path[dirlen + namelen] = '\0';
+
+    if (list->count == list->alloc) {
+        list->alloc = list->alloc ? list->alloc * 2 : 16;
+        list->items = (char**)xrealloc(list->items, sizeof(char*) * (size_t)list->alloc);
+    }
+    list->items[list->count++] = path;
+    return path;
+}
+
+static void arg_glob_clear(struct arg_glob_list* list) {
+    int i;
+
+    for (i = 0; i < list->count; i++)
+        xfree(list->items[i]);
+    xfree(list->items);
+    list->items = NULL;
+    list->count = list->alloc = 0;
+}
+
+/* Moves the paths of src to the end of dst */
+static void arg_glob_append(struct arg_glob_list* dst, struct arg_glob_list* src) {
+    if (dst->count + src->count > dst->alloc) {
+        dst->alloc = dst->count + src->count;
+        dst->items = (char**)xrealloc(dst->items, sizeof(char*) * (size_t)dst->alloc);
+    }
+    if (src->count > 0)
+        memcpy(dst->items + dst->count, src->items, sizeof(char*) * (size_t)src->count);
+    dst->count += src->count;
+    src->count = 0;
+    arg_glob_clear(src);
+}
+
+/*
+ * Matches c against the bracket expression that starts after the '[' at p.
+ * Returns the character after the closing ']', or NULL if there is none, in
+ * which case the '[' is an ordinary character.
+ */
+static const char* arg_glob_class(const char* p, const char* pend, unsigned char c, int* matched) {
+    int negate = 0;
+    int hit = 0;
+
+    if (p < pend && (*p == '!' || *p == '^')) {
+        negate = 1;
+        p++;
+    }
+
+    /* a ']' right after the '[' or the negation is an ordinary character */
+    if (p < pend && *p == ']') {
+        hit = (c == ']');
+        p++;
+    }
+
+    while (p < pend && *p != ']') {
+        if (p + 2 < pend && p[1] == '-' && p[2] != ']') {
+            if ((unsigned char)p[0] <= c && c <= (unsigned char)p[2])
+                hit = 1;
+            p += 3;
+        } else {
+            if ((unsigned char)*p == c)
+                hit = 1;
+            p++;
+        }
+    }
+
+    if (p == pend)
+        return NULL;
+    *matched = (hit != negate);
+    return p + 1;
+}
+
+/*
+ * Matches a name against the pattern [p, pend). A '*' is matched by
+ * remembering where it was seen and retrying one character further on a
+ * mismatch, so only the last '*' is ever backtracked to.
+ */
+static int arg_glob_match(const char* p, const char* pend, const char* s) {
+    const char* star = NULL;
+    const char* retry = NULL;
+
+    while (*s) {
+        if (p < pend) {
+            if (*p == '*') {
+                star = ++p;
+                retry = s;
+                continue;
+            }
+            if (*p == '?') {
+                p++;
+                s++;
+                continue;
+            }
+            if (*p == '[') {
+                int matched = 0;
+                const char* next = arg_glob_class(p + 1, pend, (unsigned char)*s, &matched);
+                if (next ? matched : (*s == '[')) {
+                    p = next ? next : p + 1;
+                    s++;
+                    continue;
+                }
+            } else if (*p == *s) {
+                p++;
+                s++;
+                continue;
+            }
+        }
+
+        if (!star)
+            return 0;
+        p = star;
+        s = ++retry;
+    }
+
+    while (p < pend && *p == '*')
+        p++;
+    return p == pend;
+}
+
+static int arg_glob_haswild(const char* p, const char* pend) {
+    for (; p < pend; p++) {
+        if (*p == '*' || *p == '?' || *p == '[')
+            return 1;
+    }
+    return 0;
+}
+
+/* Handles one directory entry; isdir is negative when the entry type is not known yet */
+static void arg_glob_entry(struct arg_glob_task* t, const char* name, int isdir) {
+    char* path;
+
+    /* "." and ".." never match, and hidden entries only match a pattern that starts with a '.' */
+    if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+        return;
+    if (name[0] == '.' && (!t->pat || *t->pat != '.'))
+        return;
+    if (t->pat && !arg_glob_match(t->pat, t->pat + t->patlen, name))
+        return;
+    if (t->dirsonly && isdir == 0)
+        return;
+
+    path = arg_glob_push(&t->out, t->dir, name, strlen(name), t->dirsonly);
+
+#ifndef _WIN32
+    if (t->dirsonly && isdir < 0) {
+        struct stat st;
+        int rc;
+
+        /* "**" does not follow symbolic links, so that a link cannot make the walk loop */
+        path[strlen(path) - 1] = '\0';
+        rc = t->pat ? stat(path, &st) : lstat(path, &st);
+        if (rc != 0 || !S_ISDIR(st.st_mode)) {
+            xfree(path);
+            t->out.count--;
+            return;
+        }
+        path[strlen(path)] = '/';
+    }
+#endif
+}
+
+static void arg_glob_taskfn(void* arg) {
+    struct arg_glob_task* t = (struct arg_glob_task*)arg;
+
+#ifdef _WIN32
+    struct _finddata_t fd;
+    intptr_t handle;
+    size_t len = strlen(t->dir);
+    char* spec = (char*)xmalloc(len + 2);
+
+    memcpy(spec, t->dir, len);
+    spec[len] = '*';
+    spec[len + 1] = '\0';
+    handle = _findfirst(spec, &fd);
+    xfree(spec);
+    if (handle == -1)
+        return;
+    do {
+        arg_glob_entry(t, fd.name, (fd.attrib & _A_SUBDIR) != 0);
+    } while (t->out.count <= t->limit && _findnext(handle, &fd) == 0);
+    _findclose(handle);
+#else
+    DIR* dir = opendir(*t->dir ? t->dir : ".");
+    struct dirent* entry;
+
+    if (!dir)
+        return;
+    while (t->out.count <= t->limit && (entry = readdir(dir)) != NULL) {
+        int isdir = -1;
+#ifdef DT_DIR
+        /* symbolic links and unknown types are resolved with stat() when it matters */
+        if (entry->d_type == DT_DIR)
+            isdir = 1;
+        else if (entry->d_type != DT_UNKNOWN && entry->d_type != DT_LNK)
+            isdir = 0;
+#endif
+        arg_glob_entry(t, entry->d_name, isdir);
+    }
+    closedir(dir);
+#endif
+}
+
+/*
+ * Reads every directory of in, one task per directory, and returns what the
+ * tasks kept in out. The results are concatenated in the order of in, so the
+ * outcome does not depend on how the tasks were scheduled.
+ */
+static void arg_glob_level(struct arg_glob_ctx* ctx, const struct arg_glob_list* in, const char* pat, size_t patlen, int dirsonly,
+                           struct arg_glob_list* out) {
+    struct arg_glob_task* tasks = (struct arg_glob_task*)xcalloc((size_t)in->count, sizeof(struct arg_glob_task));
+    int i;
+
+    if (in->count > 1 && ctx->nworkers != 0 && !ctx->pool)
+        ctx->pool = arg_tpool_create(ctx->nworkers < 0 ? arg_thread_ncpu() : ctx->nworkers);
+
+    for (i = 0; i < in->count; i++) {
+        tasks[i].dir = in->items[i];
+        tasks[i].pat = pat;
+        tasks[i].patlen = patlen;
+        tasks[i].dirsonly = dirsonly;
+        tasks[i].limit = ctx->limit;
+        if (in->count > 1 && ctx->pool)
+            arg_tpool_submit(ctx->pool, &tasks[i].task, arg_glob_taskfn, &tasks[i]);
+        else
+            arg_glob_taskfn(&tasks[i]);
+    }
+
+    for (i = 0; i < in->count; i++) {
+        if (in->count > 1 && ctx->pool)
+            arg_tpool_join(ctx->pool, &tasks[i].task);
+        arg_glob_append(out, &tasks[i].out);
+    }
+    xfree(tasks);
+}
+
+/* Returns the number of paths of list, not counting the current directory that a leading "**" starts from */
+static int arg_glob_count(const struct arg_glob_list* list) {
+    return list->count - (list->count > 0 && list->items[0][0] == '\0');
+}
+
+/*
+ * Replaces the directories of list with themselves and all their subdirectories,
+ * for "**". The walk stops as soon as list has more than the limit of paths.
+ */
+static void arg_glob_descend(struct arg_glob_ctx* ctx, struct arg_glob_list* list) {
+    struct arg_glob_list frontier = {NULL, 0, 0};
+    int i;
+
+    for (i = 0; i < list->count; i++)
+        arg_glob_push(&frontier, list->items[i], "", 0, 0);
+
+    /* walk the tree breadth first, so each level is read in parallel */
+    while (frontier.count > 0 && arg_glob_count(list) <= ctx->limit) {
+        struct arg_glob_list next = {NULL, 0, 0};
+
+        arg_glob_level(ctx, &frontier, NULL, 0, 1, &next);
+        arg_glob_clear(&frontier);
+        if (arg_glob_count(list) + next.count <= ctx->limit) {
+            for (i = 0; i < next.count; i++)
+                arg_glob_push(&frontier, next.items[i], "", 0, 0);
+        }
+        arg_glob_append(list, &next);
+    }
+    arg_glob_clear(&frontier);
+}
+
+static int arg_glob_cmp(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+int arg_glob(const char* pattern, int limit, int nworkers, char*** paths) {
+    struct arg_glob_ctx ctx;
+    struct arg_glob_list cur = {NULL, 0, 0};
+    const char* p = pattern;
+    const char* start = pattern;
+    size_t total;
+    char** result;
+    char* text;
+    int i;
+
+    ARG_TRACE(("arg_glob(\"%s\", %d, %d)\n", pattern, limit, nworkers));
+    *paths = NULL;
+    ctx.nworkers = nworkers;
+    ctx.limit = limit;
+    ctx.pool = NULL;
+
+    /* the components before the first one with a wildcard are the starting directory */
+    while (*p) {
+        const char* end = p;
+        while (*end && !ARG_GLOB_ISSEP(*end))
+            end++;
+        if (arg_glob_haswild(p, end))
+            break;
+        while (*end && ARG_GLOB_ISSEP(*end))
+            end++;
+        p = end;
+    }
+    arg_glob_push(&cur, "", start, (size_t)(p - start), 0);
+
+    /* give up as soon as a level of the walk holds more paths than the limit */
+    while (*p && cur.count > 0 && arg_glob_count(&cur) <= limit) {
+        struct arg_glob_list next = {NULL, 0, 0};
+        const char* end = p;
+        const char* comp = p;
+        size_t complen;
+        int last;
+
+        while (*end && !ARG_GLOB_ISSEP(*end))
+            end++;
+        complen = (size_t)(end - comp);
+        p = end;
+        while (*p && ARG_GLOB_ISSEP(*p))
+            p++;
+
+        /* a trailing separator keeps only directories, like in the shell */
+        last = (*end == '\0');
+
+        if (complen == 2 && comp[0] == '*' && comp[1] == '*') {
+            arg_glob_descend(&ctx, &cur);
+            if (!last || arg_glob_count(&cur) > limit)
+                continue;
+            /* a final "**" matches everything below the directory */
+            comp = "*";
+            complen = 1;
+        }
+
+        if (arg_glob_haswild(comp, comp + complen)) {
+            arg_glob_level(&ctx, &cur, comp, complen, !last, &next);
+        } else {
+            for (i = 0; i < cur.count; i++) {
+                struct stat st;
+                char* path = arg_glob_push(&next, cur.items[i], comp, complen, !last);
+
+                /* literal components of the last level come from the pattern, not from a directory listing */
+                if (last && stat(path, &st) != 0) {
+                    xfree(path);
+                    next.count--;
+                }
+            }
+        }
+        arg_glob_clear(&cur);
+        cur = next;
+    }
+
+    if (ctx.pool)
+        arg_tpool_destroy(ctx.pool);
+
+    /* a pattern ending in "**" followed by a separator also yields the starting directory, which may be empty */
+    for (i = 0; i < cur.count; i++) {
+        if (cur.items[i][0] == '\0') {
+            xfree(cur.items[i]);
+            cur.items[i--] = cur.items[--cur.count];
+        }
+    }
+
+    if (cur.count <= 0 || cur.count > limit) {
+        i = cur.count;
+        arg_glob_clear(&cur);
+        return i == 0 ? 0 : -1;
+    }
+
+    /* sort the matches, then pack them into one block with the pointer array first */
+    qsort(cur.items, (size_t)cur.count, sizeof(char*), arg_glob_cmp);
+    total = sizeof(char*) * (size_t)cur.count;
+    for (i = 0; i < cur.count; i++)
+        total += strlen(cur.items[i]) + 1;
+
+    result = (char**)xmalloc(total);
+    text = (char*)(result + cur.count);
+    for (i = 0; i < cur.count; i++) {
+        size_t len = strlen(cur.items[i]) + 1;
+        memcpy(text, cur.items[i], len);
+        result[i] = text;
+        text += len;
+    }
+
+    i = cur.count;
+    arg_glob_clear(&cur);
+    *paths = result;
+    return i;
+}
+/*******************************************************************************
+ * arg_file: Implements the file command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 1998-2001,2003-2011,2013 Stewart Heitmann
+ * <sheitmann@users.sourceforge.net>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _WIN32
+#include <io.h>
+#define ARG_FILE_ACCESS(path) _access(path, 4)
+#else
+#include <unistd.h>
+#define ARG_FILE_ACCESS(path) access(path, R_OK)
+#endif
+
+#ifndef S_ISREG
+#define S_ISREG(m) (((m) & S_IFMT) == S_IFREG)
+#endif
+#ifndef S_ISDIR
+#define S_ISDIR(m) (((m) & S_IFMT) == S_IFDIR)
+#endif
+
+#ifdef WIN32
+#define FILESEPARATOR1 '\\'
+#define FILESEPARATOR2 '/'
+#else
+#define FILESEPARATOR1 '/'
+#define FILESEPARATOR2 '/'
+#endif
+
+/* Number of paths checked by one task of the validation pool */
+#define ARG_FILE_CHUNK 64
+
+/*
+ * Private data of an arg_file, allocated by arg_file_validate(),
+ * arg_file_glob() or arg_file_map(). The st[], maps[], err[], errnum[] and
+ * globs[] arrays have maxcount entries and follow the struct.
+ */
+struct arg_file_priv {
+    struct arg_hdr_ext ext; /* must come first, see ARG_HASEXT */
+    int flags;
+    int nworkers;
+    int checked;     /* number of paths whose st[] and err[] are valid */
+    struct stat* st; /* status of each path */
+    int* err;        /* 0, or the ARG_ERR_FILE* error of each path */
+    int* errnum;     /* errno of a failed stat() or access() */
+    int globlimit;   /* largest number of matches of one pattern, 0 if patterns are not expanded */
+    int globworkers;
+    int nglobs;
+    char*** globs; /* matches of each expanded pattern, which filename[] points into */
+    arg_mmap_t* maps;  /* contents of each path, opened by arg_file_map() */
+    arg_mmap_t stdin_; /* contents of stdin, shared by every "-" path and kept until the argument is freed */
+};
+
+static void arg_file_freefn(void* parent_);
+static void* arg_file_clonefn(void* parent_);
+
+/* The optional functions of an arg_file, without and with private data */
+static const struct arg_hdr_ext arg_file_ext = {ARG_HDR_EXT_VERSION, NULL, arg_file_clonefn};
+static const struct arg_hdr_ext arg_file_privext = {ARG_HDR_EXT_VERSION, arg_file_freefn, arg_file_clonefn};
+
+/* Returns the private data, or NULL until arg_file_priv() allocates it */
+static struct arg_file_priv* arg_file_getpriv(const struct arg_file* parent) {
+    return parent->hdr.priv == (const void*)&arg_file_ext ? NULL : (struct arg_file_priv*)parent->hdr.priv;
+}
+
+/* A range of paths checked by one task */
+struct arg_file_chunk {
+    struct arg_file* parent;
+    int begin;
+    int end;
+    arg_task_t task;
+};
+
+/* Releases the contents mapped and the patterns expanded since the last parse */
+static void arg_file_release(struct arg_file* parent) {
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    int i;
+
+    if (!priv)
+        return;
+    for (i = 0; i < parent->count; i++)
+        arg_mmap_close(&priv->maps[i]);
+    while (priv->nglobs > 0)
+        xfree(priv->globs[--priv->nglobs]);
+}
+
+static void arg_file_resetfn(void* parent_) {
+    struct arg_file* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    arg_file_release(parent);
+    parent->count = 0;
+}
+
+/*
+ * Finds the length, basename and extension of filename. The basename follows
+ * the last FILESEPARATOR1, or else the last FILESEPARATOR2, as two alternative
+ * separators are not supported together in the same filename. The extension
+ * is found by scanning the basename backwards, so only the characters after
+ * the last separator are looked at twice.
+ */
+static void arg_file_split(const char* filename, struct arg_file_span* span) {
+    const char* sep = strrchr(filename, FILESEPARATOR1);
+    size_t base, len, dot;
+
+    if (!sep)
+        sep = strrchr(filename, FILESEPARATOR2);
+    base = sep ? (size_t)(sep - filename) + 1 : 0;
+    len = base + strlen(filename + base);
+
+    /* special cases of "." and ".." are not considered basenames */
+    if (filename[base] == '.' && (len - base == 1 || (len - base == 2 && filename[base + 1] == '.')))
+        base = len;
+
+    /* find the last '.' in the basename */
+    dot = len;
+    while (dot > base && filename[dot - 1] != '.')
+        dot--;
+
+    /* neither a leading dot (eg ".foo") nor a trailing one (eg "foo.", "foo..") starts a true extension */
+    span->length = len;
+    span->basename = base;
+    span->extension = (dot > base + 1 && dot < len) ? dot - 1 : len;
+}
+
+/* Stores a path, which must outlive the parse, in the next free entry */
+static void arg_file_store(struct arg_file* parent, const char* path) {
+    struct arg_file_span* span = &parent->span[parent->count];
+
+    arg_file_split(path, span);
+    parent->filename[parent->count] = path;
+    parent->basename[parent->count] = path + span->basename;
+    parent->extension[parent->count] = path + span->extension;
+    parent->count++;
+}
+
+/* Stores the paths that match a pattern, in sorted order */
+static int arg_file_expand(struct arg_file* parent, const char* pattern) {
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    char** paths;
+    int n = arg_glob(pattern, priv->globlimit, priv->globworkers, &paths);
+    int i;
+
+    if (n < 0)
+        return ARG_ERR_GLOBLIMIT;
+    if (n == 0)
+        return ARG_ERR_GLOBNOMATCH;
+    if (n > parent->hdr.maxcount - parent->count) {
+        xfree(paths);
+        return ARG_ERR_MAXCOUNT;
+    }
+
+    priv->globs[priv->nglobs++] = paths;
+    for (i = 0; i < n; i++)
+        arg_file_store(parent, paths[i]);
+    return 0;
+}
+
+static int arg_file_scanfn(void* parent_, const char* argval) {
+    struct arg_file* parent = parent_;
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent arguiment value unaltered but still count the argument. */
+        parent->count++;
+    } else if (priv && priv->globlimit > 0 && strpbrk(argval, "*?[")) {
+        errorcode = arg_file_expand(parent, argval);
+    } else {
+        arg_file_store(parent, argval);
+    }
+
+    ARG_TRACE(("%s4:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+/* Checks one path against the filesystem, storing its status, error and errno */
+static void arg_file_check(struct arg_file* parent, int i) {
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    int flags = priv->flags;
+    int err = 0;
+
+    errno = 0;
+    if (stat(parent->filename[i], &priv->st[i]) != 0) {
+        err = ARG_ERR_FILESTAT;
+    } else if ((flags & (ARG_FILE_REGULAR | ARG_FILE_DIR)) && !((flags & ARG_FILE_REGULAR) && S_ISREG(priv->st[i].st_mode)) &&
+               !((flags & ARG_FILE_DIR) && S_ISDIR(priv->st[i].st_mode))) {
+        err = ARG_ERR_FILETYPE;
+    } else if ((flags & ARG_FILE_READABLE) && ARG_FILE_ACCESS(parent->filename[i]) != 0) {
+        err = ARG_ERR_FILEACCESS;
+    }
+
+    priv->err[i] = err;
+    priv->errnum[i] = err ? errno : 0;
+}
+
+static void arg_file_chunkfn(void* arg) {
+    struct arg_file_chunk* chunk = (struct arg_file_chunk*)arg;
+    int i;
+
+    for (i = chunk->begin; i < chunk->end; i++)
+        arg_file_check(chunk->parent, i);
+}
+
+/* Checks all paths, splitting them into chunks for a worker pool when there are enough of them */
+static void arg_file_checkall(struct arg_file* parent) {
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    int nchunks = (parent->count + ARG_FILE_CHUNK - 1) / ARG_FILE_CHUNK;
+    int nworkers = priv->nworkers < 0 ? arg_thread_ncpu() : priv->nworkers;
+    struct arg_file_chunk* chunks;
+    arg_tpool_t* pool;
+    int i;
+
+    /* the calling thread works on the chunks too, so one chunk needs no pool */
+    if (nworkers > nchunks - 1)
+        nworkers = nchunks - 1;
+    if (nworkers <= 0) {
+        for (i = 0; i < parent->count; i++)
+            arg_file_check(parent, i);
+        return;
+    }
+
+    chunks = (struct arg_file_chunk*)xmalloc(sizeof(struct arg_file_chunk) * (size_t)nchunks);
+    pool = arg_tpool_create(nworkers);
+    for (i = 0; i < nchunks; i++) {
+        chunks[i].parent = parent;
+        chunks[i].begin = i * ARG_FILE_CHUNK;
+        chunks[i].end = (i == nchunks - 1) ? parent->count : (i + 1) * ARG_FILE_CHUNK;
+        arg_tpool_submit(pool, &chunks[i].task, arg_file_chunkfn, &chunks[i]);
+    }
+    for (i = 0; i < nchunks; i++)
+        arg_tpool_join(pool, &chunks[i].task);
+    arg_tpool_destroy(pool);
+    xfree(chunks);
+}
+
+static int arg_file_checkfn(void* parent_) {
+    struct arg_file* parent = parent_;
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    int i;
+
+    /* check the paths in parallel, then report the failures in command line order */
+    if (priv && priv->flags) {
+        arg_file_checkall(parent);
+        priv->checked = parent->count;
+        for (i = 0; i < parent->count; i++) {
+            if (priv->err[i])
+                arg_check_error(parent, priv->err[i], parent->filename[i]);
+        }
+    }
+
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_file_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_file* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_FILESTAT:
+        case ARG_ERR_FILEACCESS: {
+            struct arg_file_priv* priv = arg_file_getpriv(parent);
+            int errnum = 0;
+            int i;
+
+            /* find the errno that was saved for this path */
+            for (i = 0; priv && i < priv->checked; i++) {
+                if (parent->filename[i] == argval) {
+                    errnum = priv->errnum[i];
+                    break;
+                }
+            }
+
+            arg_dstr_catf(ds, "cannot %s \"%s\"", errorcode == ARG_ERR_FILESTAT ? "access" : "read", argval);
+            if (errnum)
+                arg_dstr_catf(ds, " (%s)", strerror(errnum));
+            arg_dstr_cat(ds, " at option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+        }
+
+        case ARG_ERR_FILETYPE: {
+            struct arg_file_priv* priv = arg_file_getpriv(parent);
+            int flags = priv ? priv->flags & (ARG_FILE_REGULAR | ARG_FILE_DIR) : 0;
+
+            arg_dstr_catf(ds, "\"%s\" is not a %s at option ", argval,
+                          flags == ARG_FILE_REGULAR ? "regular file" : (flags == ARG_FILE_DIR ? "directory" : "regular file or directory"));
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+        }
+
+        case ARG_ERR_GLOBNOMATCH:
+            arg_dstr_catf(ds, "no files match \"%s\" at option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_GLOBLIMIT: {
+            struct arg_file_priv* priv = arg_file_getpriv(parent);
+            arg_dstr_catf(ds, "\"%s\" matches more than %d files at option ", argval, priv ? priv->globlimit : 0);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+        }
+
+        default:
+            arg_dstr_catf(ds, "unknown error at \"%s\"\n", argval);
+    }
+}
+
+static void arg_file_freefn(void* parent_) {
+    struct arg_file* parent = parent_;
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    ARG_TRACE(("%s:freefn(%p)\n", __FILE__, parent));
+    arg_file_release(parent);
+    if (priv)
+        arg_mmap_close(&priv->stdin_);
+    xfree(priv);
+    parent->hdr.priv = (void*)&arg_file_ext;
+}
+
+/* Returns the private data, allocating it with its arrays on first use */
+static struct arg_file_priv* arg_file_priv(struct arg_file* parent) {
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    size_t maxcount = (size_t)parent->hdr.maxcount;
+
+    if (!priv) {
+        priv = (struct arg_file_priv*)xcalloc(
+            1, sizeof(struct arg_file_priv) + maxcount * (sizeof(struct stat) + sizeof(arg_mmap_t) + sizeof(char**) + 2 * sizeof(int)));
+        priv->st = (struct stat*)(priv + 1);
+        priv->maps = (arg_mmap_t*)(priv->st + maxcount);
+        priv->globs = (char***)(priv->maps + maxcount);
+        priv->err = (int*)(priv->globs + maxcount);
+        priv->errnum = priv->err + maxcount;
+        priv->ext = arg_file_privext;
+        parent->hdr.priv = priv;
+    }
+    return priv;
+}
+
+/* Copies the argument with its settings, but none of the checks, expansions or contents of the last parse */
+static void* arg_file_clonefn(void* parent_) {
+    struct arg_file* parent = parent_;
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    size_t maxcount = (size_t)parent->hdr.maxcount;
+    struct arg_file* result;
+
+    result = (struct arg_file*)arg_clone_block(parent, sizeof(struct arg_file) + 3 * maxcount * sizeof(char*) + maxcount * sizeof(struct arg_file_span));
+    result->filename = (const char**)ARG_CLONE_PTR(result, parent, parent->filename);
+    result->basename = (const char**)ARG_CLONE_PTR(result, parent, parent->basename);
+    result->extension = (const char**)ARG_CLONE_PTR(result, parent, parent->extension);
+    result->span = (struct arg_file_span*)ARG_CLONE_PTR(result, parent, parent->span);
+    result->hdr.priv = (void*)&arg_file_ext;
+    if (priv) {
+        struct arg_file_priv* rpriv = arg_file_priv(result);
+        rpriv->flags = priv->flags;
+        rpriv->nworkers = priv->nworkers;
+        rpriv->globlimit = priv->globlimit;
+        rpriv->globworkers = priv->globworkers;
+    }
+    return result;
+}
+
+void arg_file_validate(struct arg_file* parent, int flags, int nworkers) {
+    struct arg_file_priv* priv = arg_file_priv(parent);
+
+    /* every check needs the path to exist */
+    priv->flags = flags ? (flags | ARG_FILE_EXISTS) : 0;
+    priv->nworkers = nworkers;
+    priv->checked = 0;
+}
+
+void arg_file_glob(struct arg_file* parent, int maxmatches, int nworkers) {
+    struct arg_file_priv* priv = arg_file_priv(parent);
+
+    priv->globlimit = maxmatches > 0 ? maxmatches : 0;
+    priv->globworkers = nworkers;
+}
+
+const char* arg_file_map(struct arg_file* parent, int index, size_t* len) {
+    struct arg_file_priv* priv;
+    arg_mmap_t* map;
+
+    if (index < 0 || index >= parent->count)
+        return NULL;
+
+    priv = arg_file_priv(parent);
+    if (strcmp(parent->filename[index], "-") == 0) {
+        /* stdin can only be read once, so every "-" shares one copy */
+        map = &priv->stdin_;
+        if (!map->data && arg_mmap_read(map, stdin) != 0)
+            return NULL;
+    } else {
+        map = &priv->maps[index];
+        if (!map->data && arg_mmap_open(map, parent->filename[index]) != 0)
+            return NULL;
+    }
+
+    if (len)
+        *len = map->len;
+    return map->data;
+}
+
+const struct stat* arg_file_stat(const struct arg_file* parent, int index) {
+    const struct arg_file_priv* priv = arg_file_getpriv(parent);
+
+    if (!priv || !priv->flags || index < 0 || index >= priv->checked || index >= parent->count || priv->err[index] == ARG_ERR_FILESTAT)
+        return NULL;
+    return &priv->st[index];
+}
+
+struct arg_file* arg_file0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_filen(shortopts, longopts, datatype, 0, 1, glossary);
+}
+
+struct arg_file* arg_file1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_filen(shortopts, longopts, datatype, 1, 1, glossary);
+}
+
+struct arg_file* arg_filen(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    size_t nbytes;
+    struct arg_file* result;
+    int i;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_file)                            /* storage for struct arg_file */
+             + sizeof(char*) * (size_t)maxcount                 /* storage for filename[maxcount] array */
+             + sizeof(char*) * (size_t)maxcount                 /* storage for basename[maxcount] array */
+             + sizeof(char*) * (size_t)maxcount                 /* storage for extension[maxcount] array */
+             + sizeof(struct arg_file_span) * (size_t)maxcount; /* storage for span[maxcount] array */
+
+    result = (struct arg_file*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASFILEVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.glossary = glossary;
+    result->hdr.datatype = datatype ? datatype : "<file>";
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_file_resetfn;
+    result->hdr.scanfn = arg_file_scanfn;
+    result->hdr.checkfn = arg_file_checkfn;
+    result->hdr.errorfn = arg_file_errorfn;
+    result->hdr.priv = (void*)&arg_file_ext;
+
+    /* store the filename,basename,extension,span arrays immediately after the arg_file struct */
+    result->filename = (const char**)(result + 1);
+    result->basename = result->filename + maxcount;
+    result->extension = result->basename + maxcount;
+    result->span = (struct arg_file_span*)(result->extension + maxcount);
+    result->count = 0;
+
+    /* foolproof the string pointers by initialising them with empty strings */
+    for (i = 0; i < maxcount; i++) {
+        result->filename[i] = "";
+        result->basename[i] = "";
+        result->extension[i] = "";
+        result->span[i].length = 0;
+        result->span[i].basename = 0;
+        result->span[i].extension = 0;
+    }
+
+    ARG_TRACE(("arg_filen() returns %p\n", result));
+    return result;
+}
+/*******************************************************************************
+ * arg_int: Implements the int command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 1998-2001,2003-2011,2013 Stewart Heitmann
+ * <sheitmann@users.sourceforge.net>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <ctype.h>
+#include <limits.h>
+#include <stdlib.h>
+
+static void arg_int_resetfn(void* parent_) {
+    struct arg_int* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+/* Returns the value of the alphanumeric digit c, or 36 for anything else. */
+static unsigned int arg_int_digit(int c) {
+    if (c >= '0' && c <= '9')
+        return (unsigned int)(c - '0');
+    if (c >= 'a' && c <= 'z')
+        return (unsigned int)(c - 'a' + 10);
+    if (c >= 'A' && c <= 'Z')
+        return (unsigned int)(c - 'A' + 10);
+    return 36;
+}
+
+/* arg_int_scanmag() scans an integer in a single pass over its bytes,     */
+/* returning its magnitude and sign separately so that the int, int64 and   */
+/* uint64 argument types can apply their own range checks. It accepts the   */
+/* same grammar as the strtol() based chain that arg_int originally used:   */
+/*                                                                          */
+/*   [ws] [+|-] digits                            decimal, eg: -1234        */
+/*   [ws] [+|-] 0X [ws] [+|-] [0X] xdigits        hex, eg: +0x12AB          */
+/*   [ws] [+|-] 0O [ws] [+|-] odigits             octal, eg: 0o755          */
+/*   [ws] [+|-] 0B [ws] [+|-] bdigits             binary, eg: -0b1010       */
+/*                                                                          */
+/* followed by an optional KB, MB or GB suffix (and TB if tb is non-zero)   */
+/* and trailing white space. Prefixes and suffixes are case insensitive.    */
+/* The part after a radix prefix follows strtol() rules, so it may carry    */
+/* its own sign. Returns 0 on success, ARG_ERR_BADINT for malformed input,  */
+/* or ARG_ERR_OVERFLOW when the magnitude (after the suffix multiplier)     */
+/* does not fit in 64 bits. Malformed input takes precedence over overflow. */
+int arg_int_scanmag(const char* str, int tb, uint64_t* mag, int* neg) {
+    const unsigned char* ptr = (const unsigned char*)str;
+    const unsigned char* digits;
+    uint64_t max = ~(uint64_t)0;
+    uint64_t val = 0;
+    uint64_t cutoff;
+    uint64_t mult = 1;
+    unsigned int cutlim;
+    unsigned int radix = 10;
+    int overflow = 0;
+
+    *neg = 0;
+
+    /* skip leading whitespace and scan optional sign character */
+    while (isspace(*ptr))
+        ptr++;
+    if (*ptr == '+' || *ptr == '-')
+        *neg = (*ptr++ == '-');
+
+    /* '0X', '0O' or '0B' radix prefix */
+    if (ptr[0] == '0') {
+        switch (toupper(ptr[1])) {
+            case 'X':
+                radix = 16;
+                break;
+            case 'O':
+                radix = 8;
+                break;
+            case 'B':
+                radix = 2;
+                break;
+        }
+
+        if (radix != 10) {
+            /* the remainder is scanned the way strtol() would scan it */
+            ptr += 2;
+            while (isspace(*ptr))
+                ptr++;
+            if (*ptr == '+' || *ptr == '-')
+                *neg ^= (*ptr++ == '-');
+            if (radix == 16 && ptr[0] == '0' && toupper(ptr[1]) == 'X' && isxdigit(ptr[2]))
+                ptr += 2;
+        }
+    }
+
+    /* accumulate the magnitude, noting overflow but consuming every digit */
+    cutoff = max / radix;
+    cutlim = (unsigned int)(max % radix);
+    digits = ptr;
+    for (;;) {
+        unsigned int d = arg_int_digit(*ptr);
+        if (d >= radix)
+            break;
+        if (val > cutoff || (val == cutoff && d > cutlim))
+            overflow = 1;
+        else
+            val = val * radix + d;
+        ptr++;
+    }
+    if (ptr == digits)
+        return ARG_ERR_BADINT;
+
+    /* optional KB, MB, GB or TB suffix */
+    switch (toupper(*ptr)) {
+        case 'K':
+            mult = (uint64_t)1 << 10;
+            break;
+        case 'M':
+            mult = (uint64_t)1 << 20;
+            break;
+        case 'G':
+            mult = (uint64_t)1 << 30;
+            break;
+        case 'T':
+            if (tb)
+                mult = (uint64_t)1 << 40;
+            break;
+    }
+    if (mult != 1 && toupper(ptr[1]) == 'B')
+        ptr += 2;
+    else
+        mult = 1;
+
+    /* nothing but whitespace may follow */
+    while (isspace(*ptr))
+        ptr++;
+    if (*ptr != '\0')
+        return ARG_ERR_BADINT;
+
+    if (overflow || val > max / mult)
+        return ARG_ERR_OVERFLOW;
+
+    *mag = val * mult;
+    return 0;
+}
+
+static int arg_int_scanfn(void* parent_, const char* argval) {
+    struct arg_int* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent arguiment value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        uint64_t mag;
+        int neg;
+
+        errorcode = arg_int_scanmag(argval, 0, &mag, &neg);
+
+        /* the magnitude of INT_MIN is one more than INT_MAX */
+        if (errorcode == 0 && mag > (uint64_t)INT_MAX + (neg ? 1 : 0))
+            errorcode = ARG_ERR_OVERFLOW;
+
+        /* if success then store result in parent->ival[] array */
+        if (errorcode == 0)
+            parent->ival[parent->count++] = neg && mag ? -(int)(mag - 1) - 1 : (int)mag;
+    }
+
+    /* printf("%s:scanfn(%p,%p) returns %d\n",__FILE__,parent,argval,errorcode); */
+    return errorcode;
+}
+
+static int arg_int_checkfn(void* parent_) {
+    struct arg_int* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    /*printf("%s:checkfn(%p) returns %d\n",__FILE__,parent,errorcode);*/
+    return errorcode;
+}
+
+static void arg_int_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_int* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADINT:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_OVERFLOW:
+            arg_dstr_cat(ds, "integer overflow at option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, " ");
+            arg_dstr_catf(ds, "(%s is too large)\n", argval);
+            break;
+    }
+}
+
+static void* arg_int_clonefn(void* parent_) {
+    struct arg_int* parent = parent_;
+    struct arg_int* result = (struct arg_int*)arg_clone_block(parent, sizeof(struct arg_int) + (size_t)parent->hdr.maxcount * sizeof(int));
+    result->ival = (int*)ARG_CLONE_PTR(result, parent, parent->ival);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_int_ext = {ARG_HDR_EXT_VERSION, NULL, arg_int_clonefn};
+
+struct arg_int* arg_int0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_intn(shortopts, longopts, datatype, 0, 1, glossary);
+}
+
+struct arg_int* arg_int1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_intn(shortopts, longopts, datatype, 1, 1, glossary);
+}
+
+struct arg_int* arg_intn(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    size_t nbytes;
+    struct arg_int* result;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_int)    /* storage for struct arg_int */
+             + (size_t)maxcount * sizeof(int); /* storage for ival[maxcount] array */
+
+    result = (struct arg_int*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype ? datatype : "<int>";
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_int_resetfn;
+    result->hdr.scanfn = arg_int_scanfn;
+    result->hdr.checkfn = arg_int_checkfn;
+    result->hdr.errorfn = arg_int_errorfn;
+    result->hdr.priv = (void*)&arg_int_ext;
+
+    /* store the ival[maxcount] array immediately after the arg_int struct */
+    result->ival = (int*)(result + 1);
+    result->count = 0;
+
+    ARG_TRACE(("arg_intn() returns %p\n", result));
+    return result;
+}
+/*******************************************************************************
+ * arg_int64: Implements the 64-bit signed integer command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+static void arg_int64_resetfn(void* parent_) {
+    struct arg_int64* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+static int arg_int64_scanfn(void* parent_, const char* argval) {
+    struct arg_int64* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent argument value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        uint64_t mag;
+        int neg;
+
+        errorcode = arg_int_scanmag(argval, 1, &mag, &neg);
+
+        /* the magnitude of the most negative value is one more than the largest */
+        if (errorcode == 0 && mag > (~(uint64_t)0 >> 1) + (neg ? 1 : 0))
+            errorcode = ARG_ERR_OVERFLOW;
+
+        /* if success then store result in parent->ival[] array */
+        if (errorcode == 0)
+            parent->ival[parent->count++] = neg && mag ? -(int64_t)(mag - 1) - 1 : (int64_t)mag;
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_int64_checkfn(void* parent_) {
+    struct arg_int64* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_int64_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_int64* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADINT:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_OVERFLOW:
+            arg_dstr_cat(ds, "integer overflow at option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, " ");
+            arg_dstr_catf(ds, "(%s is too large)\n", argval);
+            break;
+    }
+}
+
+static void* arg_int64_clonefn(void* parent_) {
+    struct arg_int64* parent = parent_;
+    struct arg_int64* result = (struct arg_int64*)arg_clone_block(parent, sizeof(struct arg_int64) + (size_t)(parent->hdr.maxcount + 1) * sizeof(int64_t));
+    result->ival = (int64_t*)ARG_CLONE_PTR(result, parent, parent->ival);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_int64_ext = {ARG_HDR_EXT_VERSION, NULL, arg_int64_clonefn};
+
+arg_int64_t* arg_int640(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_int64n(shortopts, longopts, datatype, 0, 1, glossary);
+}
+
+arg_int64_t* arg_int641(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_int64n(shortopts, longopts, datatype, 1, 1, glossary);
+}
+
+arg_int64_t* arg_int64n(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    size_t nbytes;
+    struct arg_int64* result;
+    size_t addr;
+    size_t rem;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_int64)                    /* storage for struct arg_int64 */
+             + (size_t)(maxcount + 1) * sizeof(int64_t); /* storage for ival[maxcount] array plus one extra for padding to memory boundary */
+
+    result = (struct arg_int64*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype ? datatype : "<int64>";
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_int64_resetfn;
+    result->hdr.scanfn = arg_int64_scanfn;
+    result->hdr.checkfn = arg_int64_checkfn;
+    result->hdr.errorfn = arg_int64_errorfn;
+    result->hdr.priv = (void*)&arg_int64_ext;
+
+    /* Store the ival[maxcount] array on the first int64_t boundary that
+     * follows the arg_int64 struct, as some platforms require 64-bit
+     * integers to be aligned on natural boundaries.
+     */
+    addr = (size_t)(result + 1);
+    rem = addr % sizeof(int64_t);
+    result->ival = (int64_t*)(addr + sizeof(int64_t) - rem);
+    result->count = 0;
+
+    ARG_TRACE(("arg_int64n() returns %p\n", result));
+    return result;
+}
+/*******************************************************************************
+ * arg_uint64: Implements the 64-bit unsigned integer command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+static void arg_uint64_resetfn(void* parent_) {
+    struct arg_uint64* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+static int arg_uint64_scanfn(void* parent_, const char* argval) {
+    struct arg_uint64* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent argument value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        uint64_t mag;
+        int neg;
+
+        errorcode = arg_int_scanmag(argval, 1, &mag, &neg);
+
+        /* negative values are invalid rather than wrapped around */
+        if (errorcode != ARG_ERR_BADINT && neg && (errorcode != 0 || mag != 0))
+            errorcode = ARG_ERR_BADINT;
+
+        /* if success then store result in parent->uval[] array */
+        if (errorcode == 0)
+            parent->uval[parent->count++] = mag;
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_uint64_checkfn(void* parent_) {
+    struct arg_uint64* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_uint64_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_uint64* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADINT:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_OVERFLOW:
+            arg_dstr_cat(ds, "integer overflow at option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, " ");
+            arg_dstr_catf(ds, "(%s is too large)\n", argval);
+            break;
+    }
+}
+
+static void* arg_uint64_clonefn(void* parent_) {
+    struct arg_uint64* parent = parent_;
+    struct arg_uint64* result = (struct arg_uint64*)arg_clone_block(parent, sizeof(struct arg_uint64) + (size_t)(parent->hdr.maxcount + 1) * sizeof(uint64_t));
+    result->uval = (uint64_t*)ARG_CLONE_PTR(result, parent, parent->uval);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_uint64_ext = {ARG_HDR_EXT_VERSION, NULL, arg_uint64_clonefn};
+
+arg_uint64_t* arg_uint640(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_uint64n(shortopts, longopts, datatype, 0, 1, glossary);
+}
+
+arg_uint64_t* arg_uint641(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_uint64n(shortopts, longopts, datatype, 1, 1, glossary);
+}
+
+arg_uint64_t* arg_uint64n(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    size_t nbytes;
+    struct arg_uint64* result;
+    size_t addr;
+    size_t rem;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_uint64)                    /* storage for struct arg_uint64 */
+             + (size_t)(maxcount + 1) * sizeof(uint64_t); /* storage for uval[maxcount] array plus one extra for padding to memory boundary */
+
+    result = (struct arg_uint64*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype ? datatype : "<uint64>";
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_uint64_resetfn;
+    result->hdr.scanfn = arg_uint64_scanfn;
+    result->hdr.checkfn = arg_uint64_checkfn;
+    result->hdr.errorfn = arg_uint64_errorfn;
+    result->hdr.priv = (void*)&arg_uint64_ext;
+
+    /* Store the uval[maxcount] array on the first uint64_t boundary that
+     * follows the arg_uint64 struct, as some platforms require 64-bit
+     * integers to be aligned on natural boundaries.
+     */
+    addr = (size_t)(result + 1);
+    rem = addr % sizeof(uint64_t);
+    result->uval = (uint64_t*)(addr + sizeof(uint64_t) - rem);
+    result->count = 0;
+
+    ARG_TRACE(("arg_uint64n() returns %p\n", result));
+    return result;
+}
+/*******************************************************************************
+ * arg_size: Implements the byte size command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <ctype.h>
+#include <string.h>
+
+static void arg_size_resetfn(void* parent_) {
+    struct arg_size* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+/* Multipliers for the SI (powers of 1000) and IEC (powers of 1024) */
+/* prefixes, in the order k, M, G, T, P, E.                          */
+static const char arg_size_prefixes[] = "KMGTPE";
+
+/* arg_size_scan() converts a byte count such as "64MiB", "10kB" or   */
+/* "512" in a single pass. The grammar is                              */
+/*                                                                     */
+/*   [ws] [+] digits [B | prefix B | prefix iB] [ws]                   */
+/*                                                                     */
+/* where prefix is one of k, M, G, T, P or E. "kB" style suffixes are  */
+/* SI multiples (1kB = 1000 bytes), "KiB" style suffixes are IEC       */
+/* multiples (1KiB = 1024 bytes). Suffixes are case insensitive.       */
+/* Returns 0 on success, ARG_ERR_BADINT for malformed input, or        */
+/* ARG_ERR_OVERFLOW if the size does not fit in 64 bits.               */
+static int arg_size_scan(const char* str, uint64_t* result) {
+    const unsigned char* ptr = (const unsigned char*)str;
+    const unsigned char* digits;
+    const char* prefix;
+    uint64_t max = ~(uint64_t)0;
+    uint64_t val = 0;
+    uint64_t mult = 1;
+    int overflow = 0;
+
+    while (isspace(*ptr))
+        ptr++;
+    if (*ptr == '+')
+        ptr++;
+
+    digits = ptr;
+    for (; *ptr >= '0' && *ptr <= '9'; ptr++) {
+        unsigned int d = (unsigned int)(*ptr - '0');
+        if (val > (max - d) / 10)
+            overflow = 1;
+        else
+            val = val * 10 + d;
+    }
+    if (ptr == digits)
+        return ARG_ERR_BADINT;
+
+    /* optional unit suffix */
+    prefix = *ptr ? strchr(arg_size_prefixes, toupper(*ptr)) : NULL;
+    if (prefix) {
+        uint64_t base = 1000;
+        int n;
+
+        ptr++;
+        if (*ptr == 'i' || *ptr == 'I') {
+            base = 1024;
+            ptr++;
+        }
+        for (n = 0; n <= prefix - arg_size_prefixes; n++)
+            mult *= base;
+        if (*ptr != 'B' && *ptr != 'b')
+            return ARG_ERR_BADINT;
+    }
+    if (*ptr == 'B' || *ptr == 'b')
+        ptr++;
+
+    while (isspace(*ptr))
+        ptr++;
+    if (*ptr != '\0')
+        return ARG_ERR_BADINT;
+
+    if (overflow || val > max / mult)
+        return ARG_ERR_OVERFLOW;
+
+    *result = val * mult;
+    return 0;
+}
+
+static int arg_size_scanfn(void* parent_, const char* argval) {
+    struct arg_size* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent argument value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        uint64_t bytes;
+
+        errorcode = arg_size_scan(argval, &bytes);
+
+        /* if success then store result in parent->bytes[] array */
+        if (errorcode == 0)
+            parent->bytes[parent->count++] = bytes;
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_size_checkfn(void* parent_) {
+    struct arg_size* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_size_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_size* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADINT:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_OVERFLOW:
+            arg_dstr_cat(ds, "integer overflow at option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, " ");
+            arg_dstr_catf(ds, "(%s is too large)\n", argval);
+            break;
+    }
+}
+
+static void* arg_size_clonefn(void* parent_) {
+    struct arg_size* parent = parent_;
+    struct arg_size* result = (struct arg_size*)arg_clone_block(parent, sizeof(struct arg_size) + (size_t)(parent->hdr.maxcount + 1) * sizeof(uint64_t));
+    result->bytes = (uint64_t*)ARG_CLONE_PTR(result, parent, parent->bytes);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_size_ext = {ARG_HDR_EXT_VERSION, NULL, arg_size_clonefn};
+
+arg_size_t* arg_size0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_sizen(shortopts, longopts, datatype, 0, 1, glossary);
+}
+
+arg_size_t* arg_size1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_sizen(shortopts, longopts, datatype, 1, 1, glossary);
+}
+
+arg_size_t* arg_sizen(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    size_t nbytes;
+    struct arg_size* result;
+    size_t addr;
+    size_t rem;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_size)                    /* storage for struct arg_size */
+             + (size_t)(maxcount + 1) * sizeof(uint64_t); /* storage for bytes[maxcount] array plus one extra for padding to memory boundary */
+
+    result = (struct arg_size*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype ? datatype : "<size>";
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_size_resetfn;
+    result->hdr.scanfn = arg_size_scanfn;
+    result->hdr.checkfn = arg_size_checkfn;
+    result->hdr.errorfn = arg_size_errorfn;
+    result->hdr.priv = (void*)&arg_size_ext;
+
+    /* Store the bytes[maxcount] array on the first uint64_t boundary that
+     * follows the arg_size struct, as some platforms require 64-bit
+     * integers to be aligned on natural boundaries.
+     */
+    addr = (size_t)(result + 1);
+    rem = addr % sizeof(uint64_t);
+    result->bytes = (uint64_t*)(addr + sizeof(uint64_t) - rem);
+    result->count = 0;
+
+    ARG_TRACE(("arg_sizen() returns %p\n", result));
+    return result;
+}
+/*******************************************************************************
+ * arg_duration: Implements the time duration command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <ctype.h>
+#include <string.h>
+
+static void arg_duration_resetfn(void* parent_) {
+    struct arg_duration* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+/* Duration units and their length in nanoseconds. */
+static const struct {
+    const char* name;
+    uint64_t nsec;
+} arg_duration_units[] = {
+    {"ns", 1},
+    {"us", 1000},
+    {"\xC2\xB5s", 1000}, /* U+00B5 MICRO SIGN */
+    {"\xCE\xBCs", 1000}, /* U+03BC GREEK SMALL LETTER MU */
+    {"ms", 1000000},
+    {"s", 1000000000UL},
+    {"m", (uint64_t)60 * 1000000000UL},
+    {"h", (uint64_t)3600 * 1000000000UL},
+};
+
+/* Returns the whole nanoseconds in the fraction digits [digit, end) of */
+/* the given unit, rounding toward zero. Every unit is c * 10^e with a   */
+/* small c, so the first e digits scale to whole nanoseconds, and the    */
+/* rest add floor(c * 0.ddd), found by long multiplication from the      */
+/* right. No digit is lost and no intermediate value can overflow.       */
+static uint64_t arg_duration_frac(const unsigned char* digit, const unsigned char* end, uint64_t unit) {
+    uint64_t whole = 0;
+    unsigned int carry = 0;
+    unsigned int c;
+    int e = 0;
+
+    while (unit % 10 == 0) {
+        unit /= 10;
+        e++;
+    }
+    c = (unsigned int)unit;
+
+    for (; digit < end && e > 0; digit++, e--)
+        whole = whole * 10 + (uint64_t)(*digit - '0');
+    for (; e > 0; e--)
+        whole *= 10;
+    while (end > digit)
+        carry = (c * (unsigned int)(*--end - '0') + carry) / 10;
+
+    return whole * c + carry;
+}
+
+/* arg_duration_scan() converts a duration such as "250ms", "1.5s" or    */
+/* "1h30m" to nanoseconds in a single pass. The grammar is               */
+/*                                                                       */
+/*   [ws] [+|-] (number unit)+ [ws]     or     [ws] [+|-] 0 [ws]         */
+/*                                                                       */
+/* where number is a decimal with an optional fraction (eg: 1, 1.5, .5)  */
+/* and unit is one of ns, us (also with a micro sign), ms, s, m and h.   */
+/* Units are case sensitive, since "m" and "M" are easily confused.      */
+/* Fractions are resolved to whole nanoseconds, rounding toward zero.    */
+/* Returns 0 on success, ARG_ERR_BADINT for malformed input, or          */
+/* ARG_ERR_OVERFLOW if the total does not fit in an int64_t.             */
+static int arg_duration_scan(const char* str, int64_t* result) {
+    const unsigned char* ptr = (const unsigned char*)str;
+    uint64_t limit = (~(uint64_t)0 >> 1) + 1; /* magnitude of the most negative value */
+    uint64_t total = 0;
+    int overflow = 0;
+    int neg = 0;
+
+    while (isspace(*ptr))
+        ptr++;
+    if (*ptr == '+' || *ptr == '-')
+        neg = (*ptr++ == '-');
+
+    /* a lone zero needs no unit */
+    if (ptr[0] == '0' && (ptr[1] == '\0' || isspace(ptr[1]))) {
+        ptr++;
+    } else {
+        do {
+            const unsigned char* start = ptr;
+            const unsigned char* frac = NULL;
+            const unsigned char* fracend = NULL;
+            uint64_t val = 0;
+            uint64_t unit = 0;
+            size_t i;
+
+            /* whole part */
+            for (; *ptr >= '0' && *ptr <= '9'; ptr++) {
+                unsigned int d = (unsigned int)(*ptr - '0');
+                if (val > (limit - d) / 10)
+                    overflow = 1;
+                else
+                    val = val * 10 + d;
+            }
+
+            /* fraction, resolved once the unit is known */
+            if (*ptr == '.') {
+                frac = ++ptr;
+                while (*ptr >= '0' && *ptr <= '9')
+                    ptr++;
+                fracend = ptr;
+            }
+            if (ptr == start || (ptr - start == 1 && *start == '.'))
+                return ARG_ERR_BADINT;
+
+            /* unit; "ms" is listed before "m" so the first match is the right one */
+            for (i = 0; i < sizeof(arg_duration_units) / sizeof(arg_duration_units[0]); i++) {
+                size_t len = strlen(arg_duration_units[i].name);
+                if (strncmp((const char*)ptr, arg_duration_units[i].name, len) == 0) {
+                    unit = arg_duration_units[i].nsec;
+                    ptr += len;
+                    break;
+                }
+            }
+            if (unit == 0)
+                return ARG_ERR_BADINT;
+
+            /* accumulate, saturating at the limit */
+            if (val > limit / unit) {
+                overflow = 1;
+            } else {
+                val *= unit;
+                if (frac)
+                    val += arg_duration_frac(frac, fracend, unit);
+                if (val > limit - total)
+                    overflow = 1;
+                else
+                    total += val;
+            }
+        } while ((*ptr >= '0' && *ptr <= '9') || *ptr == '.');
+    }
+
+    while (isspace(*ptr))
+        ptr++;
+    if (*ptr != '\0')
+        return ARG_ERR_BADINT;
+
+    if (overflow || total > limit - (neg ? 0 : 1))
+        return ARG_ERR_OVERFLOW;
+
+    *result = neg && total ? -(int64_t)(total - 1) - 1 : (int64_t)total;
+    return 0;
+}
+
+static int arg_duration_scanfn(void* parent_, const char* argval) {
+    struct arg_duration* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent argument value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        int64_t nsec;
+
+        errorcode = arg_duration_scan(argval, &nsec);
+
+        /* if success then store result in parent->nsec[] array */
+        if (errorcode == 0)
+            parent->nsec[parent->count++] = nsec;
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_duration_checkfn(void* parent_) {
+    struct arg_duration* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_duration_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_duration* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADINT:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_OVERFLOW:
+            arg_dstr_cat(ds, "integer overflow at option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, " ");
+            arg_dstr_catf(ds, "(%s is too large)\n", argval);
+            break;
+    }
+}
+
+static void* arg_duration_clonefn(void* parent_) {
+    struct arg_duration* parent = parent_;
+    struct arg_duration* result = (struct arg_duration*)arg_clone_block(parent, sizeof(struct arg_duration) + (size_t)(parent->hdr.maxcount + 1) * sizeof(int64_t));
+    result->nsec = (int64_t*)ARG_CLONE_PTR(result, parent, parent->nsec);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_duration_ext = {ARG_HDR_EXT_VERSION, NULL, arg_duration_clonefn};
+
+arg_duration_t* arg_duration0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_durationn(shortopts, longopts, datatype, 0, 1, glossary);
+}
+
+arg_duration_t* arg_duration1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_durationn(shortopts, longopts, datatype, 1, 1, glossary);
+}
+
+arg_duration_t* arg_durationn(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    size_t nbytes;
+    struct arg_duration* result;
+    size_t addr;
+    size_t rem;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_duration)                    /* storage for struct arg_duration */
+             + (size_t)(maxcount + 1) * sizeof(int64_t); /* storage for nsec[maxcount] array plus one extra for padding to memory boundary */
+
+    result = (struct arg_duration*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype ? datatype : "<duration>";
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_duration_resetfn;
+    result->hdr.scanfn = arg_duration_scanfn;
+    result->hdr.checkfn = arg_duration_checkfn;
+    result->hdr.errorfn = arg_duration_errorfn;
+    result->hdr.priv = (void*)&arg_duration_ext;
+
+    /* Store the nsec[maxcount] array on the first int64_t boundary that
+     * follows the arg_duration struct, as some platforms require 64-bit
+     * integers to be aligned on natural boundaries.
+     */
+    addr = (size_t)(result + 1);
+    rem = addr % sizeof(int64_t);
+    result->nsec = (int64_t*)(addr + sizeof(int64_t) - rem);
+    result->count = 0;
+
+    ARG_TRACE(("arg_durationn() returns %p\n", result));
+    return result;
+}
+/*******************************************************************************
+ * arg_list: Implements the list-valued command-line options
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The list types share one layout: the count of occurrences, the total
+ * number of elements, the first[] index array and a growable element array.
+ * The delimiter and the capacity of the element array are kept in a private
+ * struct stored immediately after the parent struct, like the private data of
+ * arg_rex.
+ */
+struct arg_list_priv {
+    struct arg_hdr_ext ext; /* must come first, see ARG_HASEXT */
+    int capacity;
+    char delim;
+};
+
+/* 0x0101010101010101 and 0x8080808080808080, spelled out without 64-bit literals */
+#define ARG_LIST_ONES (~(uint64_t)0 / 0xFF)
+#define ARG_LIST_HIGHS (ARG_LIST_ONES * 0x80)
+
+/*
+ * Returns a word with the high bit set in every byte of word that equals the
+ * byte replicated in pattern, and all other bits clear. Unlike the common
+ * "has zero byte" test, this one has no false positives, so the result can
+ * also be used to count matches.
+ */
+static uint64_t arg_list_match(uint64_t word, uint64_t pattern) {
+    uint64_t x = word ^ pattern;
+    return ~(((x & ~ARG_LIST_HIGHS) + ~ARG_LIST_HIGHS) | x) & ARG_LIST_HIGHS;
+}
+
+/* Returns the number of elements in [str, end), which is one more than the number of delimiters */
+static size_t arg_list_count(const char* str, const char* end, char delim) {
+    uint64_t pattern = ARG_LIST_ONES * (unsigned char)delim;
+    size_t n = 1;
+
+    for (; end - str >= 8; str += 8) {
+        uint64_t word;
+        memcpy(&word, str, 8);
+        /* each match contributes one to the top byte of the product */
+        n += (size_t)(((arg_list_match(word, pattern) >> 7) * ARG_LIST_ONES) >> 56);
+    }
+    for (; str < end; str++)
+        n += (*str == delim);
+
+    return n;
+}
+
+/* Returns the first delimiter in [str, end), or end if there is none */
+static const char* arg_list_find(const char* str, const char* end, char delim) {
+    uint64_t pattern = ARG_LIST_ONES * (unsigned char)delim;
+
+    /* skip eight characters at a time until a word contains the delimiter */
+    for (; end - str >= 8; str += 8) {
+        uint64_t word;
+        memcpy(&word, str, 8);
+        if (arg_list_match(word, pattern))
+            break;
+    }
+    while (str < end && *str != delim)
+        str++;
+
+    return str;
+}
+
+/* Returns vals, grown if needed to hold total elements of elemsize bytes */
+static void* arg_list_grow(struct arg_list_priv* priv, void* vals, size_t elemsize, int total) {
+    int capacity = priv->capacity < 16 ? 16 : priv->capacity;
+
+    if (total <= priv->capacity)
+        return vals;
+
+    while (capacity < total)
+        capacity = capacity <= INT_MAX / 2 ? capacity * 2 : INT_MAX;
+
+    priv->capacity = capacity;
+    return xrealloc(vals, (size_t)capacity * elemsize);
+}
+
+/*
+ * Copies the element [ptr, end) into buf if it fits, or into a new block
+ * otherwise, so that it can be handed to the NUL-terminated scanners.
+ */
+static char* arg_list_strndup(char* buf, size_t size, const char* ptr, const char* end) {
+    size_t len = (size_t)(end - ptr);
+    char* str = len < size ? buf : (char*)xmalloc(len + 1);
+    memcpy(str, ptr, len);
+    str[len] = '\0';
+    return str;
+}
+
+static int arg_intlist_scanelem(const char* ptr, const char* end, int* val) {
+    char buf[64];
+    char* str = arg_list_strndup(buf, sizeof(buf), ptr, end);
+    uint64_t mag;
+    int neg;
+    int errorcode;
+
+    errorcode = arg_int_scanmag(str, 0, &mag, &neg);
+
+    /* the magnitude of INT_MIN is one more than INT_MAX */
+    if (errorcode == 0 && mag > (uint64_t)INT_MAX + (neg ? 1 : 0))
+        errorcode = ARG_ERR_OVERFLOW;
+
+    if (errorcode == 0)
+        *val = neg && mag ? -(int)(mag - 1) - 1 : (int)mag;
+
+    if (str != buf)
+        xfree(str);
+    return errorcode;
+}
+
+static int arg_dbllist_scanelem(const char* ptr, const char* end, double* val) {
+    char buf[64];
+    char* str = arg_list_strndup(buf, sizeof(buf), ptr, end);
+    char* last;
+    int errorcode = 0;
+
+    /* extract double from the element, always with '.' as the decimal point */
+    *val = arg_strtod(str, &last);
+    if (*last != 0 || last == str)
+        errorcode = ARG_ERR_BADDOUBLE;
+
+    if (str != buf)
+        xfree(str);
+    return errorcode;
+}
+
+static void arg_intlist_resetfn(void* parent_) {
+    struct arg_intlist* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+    parent->nvals = 0;
+}
+
+static void arg_dbllist_resetfn(void* parent_) {
+    struct arg_dbllist* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+    parent->nvals = 0;
+}
+
+static void arg_strlist_resetfn(void* parent_) {
+    struct arg_strlist* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+    parent->nvals = 0;
+}
+
+static int arg_intlist_scanfn(void* parent_, const char* argval) {
+    struct arg_intlist* parent = parent_;
+    struct arg_list_priv* priv = (struct arg_list_priv*)parent->hdr.priv;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval || *argval == '\0') {
+        /* no value or an empty value gives an empty list */
+        parent->first[++parent->count] = parent->nvals;
+    } else {
+        const char* end = argval + strlen(argval);
+        size_t n = arg_list_count(argval, end, priv->delim);
+        int i = parent->nvals;
+
+        /* make room for all elements up front */
+        if (n > (size_t)(INT_MAX - i))
+            errorcode = ARG_ERR_OVERFLOW;
+        else
+            parent->ival = (int*)arg_list_grow(priv, parent->ival, sizeof(int), i + (int)n);
+
+        while (errorcode == 0 && argval <= end) {
+            const char* next = arg_list_find(argval, end, priv->delim);
+            errorcode = arg_intlist_scanelem(argval, next, &parent->ival[i++]);
+            argval = next + 1;
+        }
+
+        /* keep the elements only if all of them were valid */
+        if (errorcode == 0) {
+            parent->nvals = i;
+            parent->first[++parent->count] = i;
+        }
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_dbllist_scanfn(void* parent_, const char* argval) {
+    struct arg_dbllist* parent = parent_;
+    struct arg_list_priv* priv = (struct arg_list_priv*)parent->hdr.priv;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval || *argval == '\0') {
+        /* no value or an empty value gives an empty list */
+        parent->first[++parent->count] = parent->nvals;
+    } else {
+        const char* end = argval + strlen(argval);
+        size_t n = arg_list_count(argval, end, priv->delim);
+        int i = parent->nvals;
+
+        /* make room for all elements up front */
+        if (n > (size_t)(INT_MAX - i))
+            errorcode = ARG_ERR_OVERFLOW;
+        else
+            parent->dval = (double*)arg_list_grow(priv, parent->dval, sizeof(double), i + (int)n);
+
+        while (errorcode == 0 && argval <= end) {
+            const char* next = arg_list_find(argval, end, priv->delim);
+            errorcode = arg_dbllist_scanelem(argval, next, &parent->dval[i++]);
+            argval = next + 1;
+        }
+
+        /* keep the elements only if all of them were valid */
+        if (errorcode == 0) {
+            parent->nvals = i;
+            parent->first[++parent->count] = i;
+        }
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_strlist_scanfn(void* parent_, const char* argval) {
+    struct arg_strlist* parent = parent_;
+    struct arg_list_priv* priv = (struct arg_list_priv*)parent->hdr.priv;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval || *argval == '\0') {
+        /* no value or an empty value gives an empty list */
+        parent->first[++parent->count] = parent->nvals;
+    } else {
+        const char* end = argval + strlen(argval);
+        size_t n = arg_list_count(argval, end, priv->delim);
+        int i = parent->nvals;
+
+        /* make room for all elements up front */
+        if (n > (size_t)(INT_MAX - i))
+            errorcode = ARG_ERR_OVERFLOW;
+        else
+            parent->sval = (arg_slice_t*)arg_list_grow(priv, parent->sval, sizeof(arg_slice_t), i + (int)n);
+
+        if (errorcode == 0) {
+            /* the elements are slices of argval itself, nothing is copied */
+            while (argval <= end) {
+                const char* next = arg_list_find(argval, end, priv->delim);
+                parent->sval[i].ptr = argval;
+                parent->sval[i++].len = (size_t)(next - argval);
+                argval = next + 1;
+            }
+            parent->nvals = i;
+            parent->first[++parent->count] = i;
+        }
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_intlist_checkfn(void* parent_) {
+    struct arg_intlist* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_dbllist_checkfn(void* parent_) {
+    struct arg_dbllist* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_strlist_checkfn(void* parent_) {
+    struct arg_strlist* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+/* every list type starts with its arg_hdr, which is all the error messages need */
+static void arg_list_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_hdr* hdr = parent_;
+    const char* shortopts = hdr->shortopts;
+    const char* longopts = hdr->longopts;
+    const char* datatype = hdr->datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADINT:
+        case ARG_ERR_BADDOUBLE:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_OVERFLOW:
+            arg_dstr_cat(ds, "integer overflow at option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, " ");
+            arg_dstr_catf(ds, "(%s is too large)\n", argval);
+            break;
+    }
+}
+
+static void arg_intlist_freefn(void* parent_) {
+    struct arg_intlist* parent = parent_;
+    ARG_TRACE(("%s:freefn(%p)\n", __FILE__, parent));
+    xfree(parent->ival);
+}
+
+static void arg_dbllist_freefn(void* parent_) {
+    struct arg_dbllist* parent = parent_;
+    ARG_TRACE(("%s:freefn(%p)\n", __FILE__, parent));
+    xfree(parent->dval);
+}
+
+static void arg_strlist_freefn(void* parent_) {
+    struct arg_strlist* parent = parent_;
+    ARG_TRACE(("%s:freefn(%p)\n", __FILE__, parent));
+    xfree(parent->sval);
+}
+
+/*
+ * Copies a list struct of nbytes with its private struct and first[] array.
+ * The caller moves first[] and copies the values.
+ */
+static struct arg_hdr* arg_list_clone(void* parent, size_t nbytes) {
+    struct arg_hdr* hdr = (struct arg_hdr*)parent;
+    struct arg_hdr* result;
+
+    result = (struct arg_hdr*)arg_clone_block(parent, nbytes + sizeof(struct arg_list_priv) + (size_t)(hdr->maxcount + 1) * sizeof(int));
+    result->priv = ARG_CLONE_PTR(result, parent, hdr->priv);
+    return result;
+}
+
+/* Returns a copy of the nvals values of a list for its clone */
+static void* arg_list_dupvals(struct arg_hdr* clone, const void* vals, size_t elemsize, int nvals) {
+    struct arg_list_priv* priv = (struct arg_list_priv*)clone->priv;
+    void* result = NULL;
+
+    priv->capacity = 0;
+    if (nvals > 0) {
+        result = xmalloc((size_t)nvals * elemsize);
+        memcpy(result, vals, (size_t)nvals * elemsize);
+        priv->capacity = nvals;
+    }
+    return result;
+}
+
+static void* arg_intlist_clonefn(void* parent_) {
+    struct arg_intlist* parent = parent_;
+    struct arg_intlist* result = (struct arg_intlist*)arg_list_clone(parent, sizeof(struct arg_intlist));
+    result->first = (int*)ARG_CLONE_PTR(result, parent, parent->first);
+    result->ival = (int*)arg_list_dupvals(&result->hdr, parent->ival, sizeof(int), parent->nvals);
+    return result;
+}
+
+static void* arg_dbllist_clonefn(void* parent_) {
+    struct arg_dbllist* parent = parent_;
+    struct arg_dbllist* result = (struct arg_dbllist*)arg_list_clone(parent, sizeof(struct arg_dbllist));
+    result->first = (int*)ARG_CLONE_PTR(result, parent, parent->first);
+    result->dval = (double*)arg_list_dupvals(&result->hdr, parent->dval, sizeof(double), parent->nvals);
+    return result;
+}
+
+static void* arg_strlist_clonefn(void* parent_) {
+    struct arg_strlist* parent = parent_;
+    struct arg_strlist* result = (struct arg_strlist*)arg_list_clone(parent, sizeof(struct arg_strlist));
+    result->first = (int*)ARG_CLONE_PTR(result, parent, parent->first);
+    result->sval = (arg_slice_t*)arg_list_dupvals(&result->hdr, parent->sval, sizeof(arg_slice_t), parent->nvals);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_intlist_ext = {ARG_HDR_EXT_VERSION, arg_intlist_freefn, arg_intlist_clonefn};
+static const struct arg_hdr_ext arg_dbllist_ext = {ARG_HDR_EXT_VERSION, arg_dbllist_freefn, arg_dbllist_clonefn};
+static const struct arg_hdr_ext arg_strlist_ext = {ARG_HDR_EXT_VERSION, arg_strlist_freefn, arg_strlist_clonefn};
+
+/*
+ * Allocates a list struct of nbytes followed by the private struct and the
+ * first[maxcount + 1] array, and initializes its arg_hdr with the free and
+ * clone functions of ext. Returns the address of the first[] array through
+ * first. The caller sets the other type-specific functions and members.
+ */
+static struct arg_hdr* arg_list_create(size_t nbytes,
+                                       const struct arg_hdr_ext* ext,
+                                       const char* shortopts,
+                                       const char* longopts,
+                                       const char* datatype,
+                                       char delim,
+                                       int mincount,
+                                       int maxcount,
+                                       const char* glossary,
+                                       int** first) {
+    struct arg_hdr* hdr;
+    struct arg_list_priv* priv;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    hdr = (struct arg_hdr*)xmalloc(nbytes                                   /* storage for the list struct */
+                                   + sizeof(struct arg_list_priv)           /* storage for private list data */
+                                   + (size_t)(maxcount + 1) * sizeof(int)); /* storage for first[maxcount + 1] array */
+
+    /* init the arg_hdr struct, which is the first member of every list struct */
+    hdr->flag = ARG_HASVALUE | ARG_HASEXT;
+    hdr->shortopts = shortopts;
+    hdr->longopts = longopts;
+    hdr->datatype = datatype;
+    hdr->glossary = glossary;
+    hdr->mincount = mincount;
+    hdr->maxcount = maxcount;
+    hdr->parent = hdr;
+    hdr->errorfn = arg_list_errorfn;
+
+    /* store the private struct and then the first[] array after the list struct */
+    priv = (struct arg_list_priv*)((char*)hdr + nbytes);
+    priv->ext = *ext;
+    priv->capacity = 0;
+    priv->delim = delim ? delim : ',';
+    hdr->priv = priv;
+    *first = (int*)(priv + 1);
+    (*first)[0] = 0;
+
+    return hdr;
+}
+
+arg_intlist_t* arg_intlist0(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary) {
+    return arg_intlistn(shortopts, longopts, datatype, delim, 0, 1, glossary);
+}
+
+arg_intlist_t* arg_intlist1(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary) {
+    return arg_intlistn(shortopts, longopts, datatype, delim, 1, 1, glossary);
+}
+
+arg_intlist_t* arg_intlistn(const char* shortopts, const char* longopts, const char* datatype, char delim, int mincount, int maxcount, const char* glossary) {
+    struct arg_intlist* result;
+    int* first;
+
+    result = (struct arg_intlist*)arg_list_create(sizeof(struct arg_intlist), &arg_intlist_ext, shortopts, longopts,
+                                                 datatype ? datatype : "<ints>", delim, mincount, maxcount, glossary, &first);
+    result->hdr.resetfn = arg_intlist_resetfn;
+    result->hdr.scanfn = arg_intlist_scanfn;
+    result->hdr.checkfn = arg_intlist_checkfn;
+    result->first = first;
+    result->count = 0;
+    result->nvals = 0;
+    result->ival = NULL;
+
+    ARG_TRACE(("arg_intlistn() returns %p\n", result));
+    return result;
+}
+
+arg_dbllist_t* arg_dbllist0(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary) {
+    return arg_dbllistn(shortopts, longopts, datatype, delim, 0, 1, glossary);
+}
+
+arg_dbllist_t* arg_dbllist1(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary) {
+    return arg_dbllistn(shortopts, longopts, datatype, delim, 1, 1, glossary);
+}
+
+arg_dbllist_t* arg_dbllistn(const char* shortopts, const char* longopts, const char* datatype, char delim, int mincount, int maxcount, const char* glossary) {
+    struct arg_dbllist* result;
+    int* first;
+
+    result = (struct arg_dbllist*)arg_list_create(sizeof(struct arg_dbllist), &arg_dbllist_ext, shortopts, longopts,
+                                                 datatype ? datatype : "<doubles>", delim, mincount, maxcount, glossary, &first);
+    result->hdr.resetfn = arg_dbllist_resetfn;
+    result->hdr.scanfn = arg_dbllist_scanfn;
+    result->hdr.checkfn = arg_dbllist_checkfn;
+    result->first = first;
+    result->count = 0;
+    result->nvals = 0;
+    result->dval = NULL;
+
+    ARG_TRACE(("arg_dbllistn() returns %p\n", result));
+    return result;
+}
+
+arg_strlist_t* arg_strlist0(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary) {
+    return arg_strlistn(shortopts, longopts, datatype, delim, 0, 1, glossary);
+}
+
+arg_strlist_t* arg_strlist1(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary) {
+    return arg_strlistn(shortopts, longopts, datatype, delim, 1, 1, glossary);
+}
+
+arg_strlist_t* arg_strlistn(const char* shortopts, const char* longopts, const char* datatype, char delim, int mincount, int maxcount, const char* glossary) {
+    struct arg_strlist* result;
+    int* first;
+
+    result = (struct arg_strlist*)arg_list_create(sizeof(struct arg_strlist), &arg_strlist_ext, shortopts, longopts,
+                                                 datatype ? datatype : "<strings>", delim, mincount, maxcount, glossary, &first);
+    result->hdr.resetfn = arg_strlist_resetfn;
+    result->hdr.scanfn = arg_strlist_scanfn;
+    result->hdr.checkfn = arg_strlist_checkfn;
+    result->first = first;
+    result->count = 0;
+    result->nvals = 0;
+    result->sval = NULL;
+
+    ARG_TRACE(("arg_strlistn() returns %p\n", result));
+    return result;
+}
+/*******************************************************************************
+ * arg_lit: Implements the literature command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 1998-2001,2003-2011,2013 Stewart Heitmann
+ * <sheitmann@users.sourceforge.net>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <stdlib.h>
+
+static void arg_lit_resetfn(void* parent_) {
+    struct arg_lit* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+static int arg_lit_scanfn(void* parent_, const char* argval) {
+    struct arg_lit* parent = parent_;
+    int errorcode = 0;
+    if (parent->count < parent->hdr.maxcount)
+        parent->count++;
+    else
+        errorcode = ARG_ERR_MAXCOUNT;
+
+    ARG_TRACE(("%s:scanfn(%p,%s) returns %d\n", __FILE__, parent, argval, errorcode));
+    return errorcode;
+}
+
+static int arg_lit_checkfn(void* parent_) {
+    struct arg_lit* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_lit_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_lit* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_catf(ds, "%s: missing option ", progname);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            arg_dstr_cat(ds, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_catf(ds, "%s: extraneous option ", progname);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+    }
+
+    ARG_TRACE(("%s:errorfn(%p, %p, %d, %s, %s)\n", __FILE__, parent, ds, errorcode, argval, progname));
+}
+
+static void* arg_lit_clonefn(void* parent) {
+    return arg_clone_block(parent, sizeof(struct arg_lit));
+}
+
+static const struct arg_hdr_ext arg_lit_ext = {ARG_HDR_EXT_VERSION, NULL, arg_lit_clonefn};
+
+struct arg_lit* arg_lit0(const char* shortopts, const char* longopts, const char* glossary) {
+    return arg_litn(shortopts, longopts, 0, 1, glossary);
+}
+
+struct arg_lit* arg_lit1(const char* shortopts, const char* longopts, const char* glossary) {
+    return arg_litn(shortopts, longopts, 1, 1, glossary);
+}
+
+struct arg_lit* arg_litn(const char* shortopts, const char* longopts, int mincount, int maxcount, const char* glossary) {
+    struct arg_lit* result;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    result = (struct arg_lit*)xmalloc(sizeof(struct arg_lit));
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = NULL;
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_lit_resetfn;
+    result->hdr.scanfn = arg_lit_scanfn;
+    result->hdr.checkfn = arg_lit_checkfn;
+    result->hdr.errorfn = arg_lit_errorfn;
+    result->hdr.priv = (void*)&arg_lit_ext;
+
+    /* init local variables */
+    result->count = 0;
+
+    ARG_TRACE(("arg_litn() returns %p\n", result));
+    return result;
+}
+/*******************************************************************************
+ * arg_rem: Implements the rem command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 1998-2001,2003-2011,2013 Stewart Heitmann
+ * <sheitmann@users.sourceforge.net>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <stdlib.h>
+
+static void* arg_rem_clonefn(void* parent) {
+    return arg_clone_block(parent, sizeof(struct arg_rem));
+}
+
+static const struct arg_hdr_ext arg_rem_ext = {ARG_HDR_EXT_VERSION, NULL, arg_rem_clonefn};
+
+struct arg_rem* arg_rem(const char* datatype, const char* glossary) {
+    struct arg_rem* result = (struct arg_rem*)xmalloc(sizeof(struct arg_rem));
+
+    result->hdr.flag = ARG_HASEXT;
+    result->hdr.shortopts = NULL;
+    result->hdr.longopts = NULL;
+    result->hdr.datatype = datatype;
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = 1;
+    result->hdr.maxcount = 1;
+    result->hdr.parent = result;
+    result->hdr.resetfn = NULL;
+    result->hdr.scanfn = NULL;
+    result->hdr.checkfn = NULL;
+    result->hdr.errorfn = NULL;
+    result->hdr.priv = (void*)&arg_rem_ext;
+
+    ARG_TRACE(("arg_rem() returns %p\n", result));
+    return result;
+}
+/*******************************************************************************
+ * arg_rex: Implements the regex command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 1998-2001,2003-2011,2013 Stewart Heitmann
+ * <sheitmann@users.sourceforge.net>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _TREX_H_
+#define _TREX_H_
+
+/*
+ * This module uses the T-Rex regular expression library to implement the regex
+ * logic. Here is the copyright notice of the library:
+ *
+ * Copyright (C) 2003-2006 Alberto Demichelis
+ *
+ * This software is provided 'as-is', without any express
+ * or implied warranty. In no event will the authors be held
+ * liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for
+ * any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ *   1. The origin of this software must not be misrepresented;
+ *      you must not claim that you wrote the original software.
+ *      If you use this software in a product, an acknowledgment
+ *      in the product documentation would be appreciated but
+ *      is not required.
+ *
+ *   2. Altered source versions must be plainly marked as such,
+ *      and must not be misrepresented as being the original software.
+ *
+ *   3. This notice may not be removed or altered from any
+ *      source distribution.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRexChar char
+#define MAX_CHAR 0xFF
+#define _TREXC(c) (c)
+#define trex_strlen strlen
+#define trex_printf printf
+
+#ifndef TREX_API
+#define TREX_API extern
+#endif
+
+#define TRex_True 1
+#define TRex_False 0
+
+#define TREX_ICASE ARG_REX_ICASE
+
+typedef unsigned int TRexBool;
+typedef struct TRex TRex;
+
+typedef struct {
+    const TRexChar* begin;
+    int len;
+} TRexMatch;
+
+#if defined(__clang__)
+TREX_API TRex* trex_compile(const TRexChar* pattern, const TRexChar** error, int flags) __attribute__((optnone));
+#elif defined(__GNUC__)
+TREX_API TRex* trex_compile(const TRexChar* pattern, const TRexChar** error, int flags) __attribute__((optimize(0)));
+#else
+TREX_API TRex* trex_compile(const TRexChar* pattern, const TRexChar** error, int flags);
+#endif
+TREX_API void trex_free(TRex* exp);
+TREX_API TRexBool trex_match(TRex* exp, const TRexChar* text);
+TREX_API TRexBool trex_search(TRex* exp, const TRexChar* text, const TRexChar** out_begin, const TRexChar** out_end);
+TREX_API TRexBool
+trex_searchrange(TRex* exp, const TRexChar* text_begin, const TRexChar* text_end, const TRexChar** out_begin, const TRexChar** out_end);
+TREX_API int trex_getsubexpcount(TRex* exp);
+TREX_API TRexBool trex_getsubexp(TRex* exp, int n, TRexMatch* subexp);
+TREX_API void trex_literals(TRex* exp, TRexChar* prefix, TRexChar* suffix, TRexChar* required);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+struct privhdr {
+    struct arg_hdr_ext ext; /* must come first, see ARG_HASEXT */
+    const char* pattern;
+    int flags;
+    const char* prefix;   /* bytes every match starts with */
+    const char* suffix;   /* bytes every match ends with */
+    const char* required; /* other bytes every match contains */
+    size_t prefixlen;
+    size_t suffixlen;
+};
+
+/* Returns the size of an arg_rex block, which ends with room for the
+ * prefix, suffix and required bytes. None of them can be longer than the
+ * pattern, as each of their bytes comes from a different literal in it.
+ */
+static size_t arg_rex_nbytes(const char* pattern, int maxcount) {
+    return sizeof(struct arg_rex)             /* storage for struct arg_rex */
+           + sizeof(struct privhdr)           /* storage for private arg_rex data */
+           + (size_t)maxcount * sizeof(char*) /* storage for sval[maxcount] array */
+           + 3 * (strlen(pattern) + 1);       /* storage for the literals */
+}
+
+/* Rejects values that lack a literal every match of the pattern has, which
+ * is much cheaper than compiling and running the pattern.
+ */
+static int arg_rex_prefilter(const struct privhdr* priv, const char* argval) {
+    size_t len = strlen(argval);
+    const char* c;
+
+    if (len < priv->prefixlen || len < priv->suffixlen)
+        return 0;
+    if (memcmp(argval, priv->prefix, priv->prefixlen) != 0)
+        return 0;
+    if (memcmp(argval + len - priv->suffixlen, priv->suffix, priv->suffixlen) != 0)
+        return 0;
+    for (c = priv->required; *c; c++) {
+        if (!memchr(argval, *c, len))
+            return 0;
+    }
+    return 1;
+}
+
+static void arg_rex_resetfn(void* parent_) {
+    struct arg_rex* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+static int arg_rex_scanfn(void* parent_, const char* argval) {
+    struct arg_rex* parent = parent_;
+    int errorcode = 0;
+    const TRexChar* error = NULL;
+    TRex* rex = NULL;
+    TRexBool is_match = TRex_False;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent argument value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        struct privhdr* priv = (struct privhdr*)parent->hdr.priv;
+
+        /* test the current argument value for a match with the regular expression */
+        /* if a match is detected, record the argument value in the arg_rex struct */
+
+        if (arg_rex_prefilter(priv, argval)) {
+            rex = trex_compile(priv->pattern, &error, priv->flags);
+            is_match = trex_match(rex, argval);
+            trex_free(rex);
+        }
+        if (!is_match)
+            errorcode = ARG_ERR_REGNOMATCH;
+        else
+            parent->sval[parent->count++] = argval;
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_rex_checkfn(void* parent_) {
+    struct arg_rex* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+#if 0
+    struct privhdr *priv = (struct privhdr*)parent->hdr.priv;
+
+    /* free the regex "program" we constructed in resetfn */
+    regfree(&(priv->regex));
+
+    /*printf("%s:checkfn(%p) returns %d\n",__FILE__,parent,errorcode);*/
+#endif
+    return errorcode;
+}
+
+static void arg_rex_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_rex* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_REGNOMATCH:
+            arg_dstr_cat(ds, "illegal value  ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        default: {
+        #if 0
+            char errbuff[256];
+            regerror(errorcode, NULL, errbuff, sizeof(errbuff));
+            printf("%s\n", errbuff);
+        #endif
+        } break;
+    }
+}
+
+static void* arg_rex_clonefn(void* parent_) {
+    struct arg_rex* parent = parent_;
+    struct arg_rex* result;
+
+    struct privhdr* priv = (struct privhdr*)parent->hdr.priv;
+    struct privhdr* clonepriv;
+
+    result = (struct arg_rex*)arg_clone_block(parent, arg_rex_nbytes(priv->pattern, parent->hdr.maxcount));
+    result->hdr.priv = ARG_CLONE_PTR(result, parent, parent->hdr.priv);
+    result->sval = (const char**)ARG_CLONE_PTR(result, parent, parent->sval);
+    clonepriv = (struct privhdr*)result->hdr.priv;
+    clonepriv->prefix = (const char*)ARG_CLONE_PTR(result, parent, priv->prefix);
+    clonepriv->suffix = (const char*)ARG_CLONE_PTR(result, parent, priv->suffix);
+    clonepriv->required = (const char*)ARG_CLONE_PTR(result, parent, priv->required);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_rex_ext = {ARG_HDR_EXT_VERSION, NULL, arg_rex_clonefn};
+
+struct arg_rex* arg_rex0(const char* shortopts, const char* longopts, const char* pattern, const char* datatype, int flags, const char* glossary) {
+    return arg_rexn(shortopts, longopts, pattern, datatype, 0, 1, flags, glossary);
+}
+
+struct arg_rex* arg_rex1(const char* shortopts, const char* longopts, const char* pattern, const char* datatype, int flags, const char* glossary) {
+    return arg_rexn(shortopts, longopts, pattern, datatype, 1, 1, flags, glossary);
+}
+
+struct arg_rex* arg_rexn(const char* shortopts,
+                         const char* longopts,
+                         const char* pattern,
+                         const char* datatype,
+                         int mincount,
+                         int maxcount,
+                         int flags,
+                         const char* glossary) {
+    size_t nbytes;
+    struct arg_rex* result;
+    struct privhdr* priv;
+    char* literals;
+    size_t litlen;
+    int i;
+    const TRexChar* error = NULL;
+    TRex* rex = NULL;
+
+    if (!pattern) {
+        printf("argtable: ERROR - illegal regular expression pattern \"(NULL)\"\n");
+        printf("argtable: Bad argument table.\n");
+        return NULL;
+    }
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = arg_rex_nbytes(pattern, maxcount);
+
+    /* init the arg_hdr struct */
+    result = (struct arg_rex*)xmalloc(nbytes);
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype ? datatype : pattern;
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_rex_resetfn;
+    result->hdr.scanfn = arg_rex_scanfn;
+    result->hdr.checkfn = arg_rex_checkfn;
+    result->hdr.errorfn = arg_rex_errorfn;
+
+    /* store the arg_rex_priv struct immediately after the arg_rex struct */
+    result->hdr.priv = result + 1;
+    priv = (struct privhdr*)(result->hdr.priv);
+    priv->ext = arg_rex_ext;
+    priv->pattern = pattern;
+    priv->flags = flags;
+
+    /* store the sval[maxcount] array immediately after the arg_rex_priv struct */
+    result->sval = (const char**)(priv + 1);
+    result->count = 0;
+
+    /* foolproof the string pointers by initializing them to reference empty strings */
+    for (i = 0; i < maxcount; i++)
+        result->sval[i] = "";
+
+    /* store the prefix, suffix and required bytes after the sval[] array */
+    litlen = strlen(pattern) + 1;
+    literals = (char*)(result->sval + maxcount);
+    memset(literals, 0, 3 * litlen);
+    priv->prefix = literals;
+    priv->suffix = literals + litlen;
+    priv->required = literals + 2 * litlen;
+
+    /* here we construct and destroy a regex representation of the regular
+     * expression for no other reason than to force any regex errors to be
+     * trapped now rather than later. If we don't, then errors may go undetected
+     * until an argument is actually parsed. The compiled program also gives
+     * the literals that scanfn checks before it runs the full match.
+     */
+
+    rex = trex_compile(priv->pattern, &error, priv->flags);
+    if (rex == NULL) {
+        ARG_LOG(("argtable: %s \"%s\"\n", error ? error : _TREXC("undefined"), priv->pattern));
+        ARG_LOG(("argtable: Bad argument table.\n"));
+    } else {
+        trex_literals(rex, literals, literals + litlen, literals + 2 * litlen);
+    }
+    priv->prefixlen = strlen(priv->prefix);
+    priv->suffixlen = strlen(priv->suffix);
+
+    trex_free(rex);
+
+    ARG_TRACE(("arg_rexn() returns %p\n", result));
+    return result;
+}
+
+/* see copyright notice in trex.h */
+#include <ctype.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _UINCODE
+#define scisprint iswprint
+#define scstrlen wcslen
+#define scprintf wprintf
+#define _SC(x) L(x)
+#else
+#define scisprint isprint
+#define scstrlen strlen
+#define scprintf printf
+#define _SC(x) (x)
+#endif
+
+#ifdef ARG_REX_DEBUG
+#include <stdio.h>
+
+static const TRexChar* g_nnames[] = {_SC("NONE"),    _SC("OP_GREEDY"), _SC("OP_OR"),     _SC("OP_EXPR"),   _SC("OP_NOCAPEXPR"),
+                                     _SC("OP_DOT"),  _SC("OP_CLASS"),  _SC("OP_CCLASS"), _SC("OP_NCLASS"), _SC("OP_RANGE"),
+                                     _SC("OP_CHAR"), _SC("OP_EOL"),    _SC("OP_BOL"),    _SC("OP_WB")};
+
+#endif
+#define OP_GREEDY (MAX_CHAR + 1)  /*  * + ? {n} */
+#define OP_OR (MAX_CHAR + 2)
+#define OP_EXPR (MAX_CHAR + 3)       /* parentesis () */
+#define OP_NOCAPEXPR (MAX_CHAR + 4)  /* parentesis (?:) */
+#define OP_DOT (MAX_CHAR + 5)
+#define OP_CLASS (MAX_CHAR + 6)
+#define OP_CCLASS (MAX_CHAR + 7)
+#define OP_NCLASS (MAX_CHAR + 8)  /* negates class the [^ */
+#define OP_RANGE (MAX_CHAR + 9)
+#define OP_CHAR (MAX_CHAR + 10)
+#define OP_EOL (MAX_CHAR + 11)
+#define OP_BOL (MAX_CHAR + 12)
+#define OP_WB (MAX_CHAR + 13)
+
+#define TREX_SYMBOL_ANY_CHAR ('.')
+#define TREX_SYMBOL_GREEDY_ONE_OR_MORE ('+')
+#define TREX_SYMBOL_GREEDY_ZERO_OR_MORE ('*')
+#define TREX_SYMBOL_GREEDY_ZERO_OR_ONE ('?')
+#define TREX_SYMBOL_BRANCH ('|')
+#define TREX_SYMBOL_END_OF_STRING ('$')
+#define TREX_SYMBOL_BEGINNING_OF_STRING ('^')
+#define TREX_SYMBOL_ESCAPE_CHAR ('\\')
+
+typedef int TRexNodeType;
+
+typedef struct tagTRexNode {
+    TRexNodeType type;
+    int left;
+    int right;
+    int next;
+} TRexNode;
+
+struct TRex {
+    const TRexChar* _eol;
+    const TRexChar* _bol;
+    const TRexChar* _p;
+    int _first;
+    int _op;
+    TRexNode* _nodes;
+    int _nallocated;
+    int _nsize;
+    int _nsubexpr;
+    TRexMatch* _matches;
+    int _currsubexp;
+    void* _jmpbuf;
+    const TRexChar** _error;
+    int _flags;
+};
+
+static int trex_list(TRex* exp);
+
+static int trex_newnode(TRex* exp, TRexNodeType type) {
+    TRexNode n;
+    int newid;
+    n.type = type;
+    n.next = n.right = n.left = -1;
+    if (type == OP_EXPR)
+        n.right = exp->_nsubexpr++;
+    if (exp->_nallocated < (exp->_nsize + 1)) {
+        exp->_nallocated *= 2;
+        exp->_nodes = (TRexNode*)xrealloc(exp->_nodes, (size_t)exp->_nallocated * sizeof(TRexNode));
+    }
+    exp->_nodes[exp->_nsize++] = n;
+    newid = exp->_nsize - 1;
+    return (int)newid;
+}
+
+static void trex_error(TRex* exp, const TRexChar* error) {
+    if (exp->_error)
+        *exp->_error = error;
+    longjmp(*((jmp_buf*)exp->_jmpbuf), -1);
+}
+
+static void trex_expect(TRex* exp, int n) {
+    if ((*exp->_p) != n)
+        trex_error(exp, _SC("expected paren"));
+    exp->_p++;
+}
+
+static TRexChar trex_escapechar(TRex* exp) {
+    if (*exp->_p == TREX_SYMBOL_ESCAPE_CHAR) {
+        exp->_p++;
+        switch (*exp->_p) {
+            case 'v':
+                exp->_p++;
+                return '\v';
+            case 'n':
+                exp->_p++;
+                return '\n';
+            case 't':
+                exp->_p++;
+                return '\t';
+            case 'r':
+                exp->_p++;
+                return '\r';
+            case 'f':
+                exp->_p++;
+                return '\f';
+            default:
+                return (*exp->_p++);
+        }
+    } else if (!scisprint((int)(*exp->_p)))
+        trex_error(exp, _SC("letter expected"));
+    return (*exp->_p++);
+}
+
+static int trex_charclass(TRex* exp, int classid) {
+    int n = trex_newnode(exp, OP_CCLASS);
+    exp->_nodes[n].left = classid;
+    return n;
+}
+
+static int trex_charnode(TRex* exp, TRexBool isclass) {
+    TRexChar t;
+    if (*exp->_p == TREX_SYMBOL_ESCAPE_CHAR) {
+        exp->_p++;
+        switch (*exp->_p) {
+            case 'n':
+                exp->_p++;
+                return trex_newnode(exp, '\n');
+            case 't':
+                exp->_p++;
+                return trex_newnode(exp, '\t');
+            case 'r':
+                exp->_p++;
+                return trex_newnode(exp, '\r');
+            case 'f':
+                exp->_p++;
+                return trex_newnode(exp, '\f');
+            case 'v':
+                exp->_p++;
+                return trex_newnode(exp, '\v');
+            case 'a':
+            case 'A':
+            case 'w':
+            case 'W':
+            case 's':
+            case 'S':
+            case 'd':
+            case 'D':
+            case 'x':
+            case 'X':
+            case 'c':
+            case 'C':
+            case 'p':
+            case 'P':
+            case 'l':
+            case 'u': {
+                t = *exp->_p;
+                exp->_p++;
+                return trex_charclass(exp, t);
+            }
+            case 'b':
+            case 'B':
+                if (!isclass) {
+                    int node = trex_newnode(exp, OP_WB);
+                    exp->_nodes[node].left = *exp->_p;
+                    exp->_p++;
+                    return node;
+                }
+                /* fall through */
+            default:
+                t = *exp->_p;
+                exp->_p++;
+                return trex_newnode(exp, t);
+        }
+    } else if (!scisprint((int)(*exp->_p))) {
+        trex_error(exp, _SC("letter expected"));
+    }
+    t = *exp->_p;
+    exp->_p++;
+    return trex_newnode(exp, t);
+}
+
+static int trex_class(TRex* exp) {
+    int ret = -1;
+    int first = -1, chain;
+    if (*exp->_p == TREX_SYMBOL_BEGINNING_OF_STRING) {
+        ret = trex_newnode(exp, OP_NCLASS);
+        exp->_p++;
+    } else
+        ret = trex_newnode(exp, OP_CLASS);
+
+    if (*exp->_p == ']')
+        trex_error(exp, _SC("empty class"));
+    chain = ret;
+    while (*exp->_p != ']' && exp->_p != exp->_eol) {
+        if (*exp->_p == '-' && first != -1) {
+            int r, t;
+            if (*exp->_p++ == ']')
+                trex_error(exp, _SC("unfinished range"));
+            r = trex_newnode(exp, OP_RANGE);
+            if (first > *exp->_p)
+                trex_error(exp, _SC("invalid range"));
+            if (exp->_nodes[first].type == OP_CCLASS)
+                trex_error(exp, _SC("cannot use character classes in ranges"));
+            exp->_nodes[r].left = exp->_nodes[first].type;
+            t = trex_escapechar(exp);
+            exp->_nodes[r].right = t;
+            exp->_nodes[chain].next = r;
+            chain = r;
+            first = -1;
+        } else {
+            if (first != -1) {
+                int c = first;
+                exp->_nodes[chain].next = c;
+                chain = c;
+                first = trex_charnode(exp, TRex_True);
+            } else {
+                first = trex_charnode(exp, TRex_True);
+            }
+        }
+    }
+
+    if (first != -1) {
+        int c = first;
+        exp->_nodes[chain].next = c;
+    }
+
+    /* hack? */
+    exp->_nodes[ret].left = exp->_nodes[ret].next;
+    exp->_nodes[ret].next = -1;
+    return ret;
+}
+
+static int trex_parsenumber(TRex* exp) {
+    int ret = *exp->_p - '0';
+    int positions = 10;
+    exp->_p++;
+    while (isdigit((int)(*exp->_p))) {
+        ret = ret * 10 + (*exp->_p++ - '0');
+        if (positions == 1000000000)
+            trex_error(exp, _SC("overflow in numeric constant"));
+        positions *= 10;
+    };
+    return ret;
+}
+
+static int trex_element(TRex* exp) {
+    int ret = -1;
+    switch (*exp->_p) {
+        case '(': {
+            int expr, newn;
+            exp->_p++;
+
+            if (*exp->_p == '?') {
+                exp->_p++;
+                trex_expect(exp, ':');
+                expr = trex_newnode(exp, OP_NOCAPEXPR);
+            } else
+                expr = trex_newnode(exp, OP_EXPR);
+            newn = trex_list(exp);
+            exp->_nodes[expr].left = newn;
+            ret = expr;
+            trex_expect(exp, ')');
+        } break;
+        case '[':
+            exp->_p++;
+            ret = trex_class(exp);
+            trex_expect(exp, ']');
+            break;
+        case TREX_SYMBOL_END_OF_STRING:
+            exp->_p++;
+            ret = trex_newnode(exp, OP_EOL);
+            break;
+        case TREX_SYMBOL_ANY_CHAR:
+            exp->_p++;
+            ret = trex_newnode(exp, OP_DOT);
+            break;
+        default:
+            ret = trex_charnode(exp, TRex_False);
+            break;
+    }
+
+    {
+        TRexBool isgreedy = TRex_False;
+        unsigned short p0 = 0, p1 = 0;
+        switch (*exp->_p) {
+            case TREX_SYMBOL_GREEDY_ZERO_OR_MORE:
+                p0 = 0;
+                p1 = 0xFFFF;
+                exp->_p++;
+                isgreedy = TRex_True;
+                break;
+            case TREX_SYMBOL_GREEDY_ONE_OR_MORE:
+                p0 = 1;
+                p1 = 0xFFFF;
+                exp->_p++;
+                isgreedy = TRex_True;
+                break;
+            case TREX_SYMBOL_GREEDY_ZERO_OR_ONE:
+                p0 = 0;
+                p1 = 1;
+                exp->_p++;
+                isgreedy = TRex_True;
+                break;
+            case '{':
+                exp->_p++;
+                if (!isdigit((int)(*exp->_p)))
+                    trex_error(exp, _SC("number expected"));
+                p0 = (unsigned short)trex_parsenumber(exp);
+                /*******************************/
+                switch (*exp->_p) {
+                    case '}':
+                        p1 = p0;
+                        exp->_p++;
+                        break;
+                    case ',':
+                        exp->_p++;
+                        p1 = 0xFFFF;
+                        if (isdigit((int)(*exp->_p))) {
+                            p1 = (unsigned short)trex_parsenumber(exp);
+                        }
+                        trex_expect(exp, '}');
+                        break;
+                    default:
+                        trex_error(exp, _SC(", or } expected"));
+                }
+                /*******************************/
+                isgreedy = TRex_True;
+                break;
+        }
+        if (isgreedy) {
+            int nnode = trex_newnode(exp, OP_GREEDY);
+            exp->_nodes[nnode].left = ret;
+            exp->_nodes[nnode].right = ((p0) << 16) | p1;
+            ret = nnode;
+        }
+    }
+    if ((*exp->_p != TREX_SYMBOL_BRANCH) && (*exp->_p != ')') && (*exp->_p != TREX_SYMBOL_GREEDY_ZERO_OR_MORE) &&
+        (*exp->_p != TREX_SYMBOL_GREEDY_ONE_OR_MORE) && (*exp->_p != '\0')) {
+        int nnode = trex_element(exp);
+        exp->_nodes[ret].next = nnode;
+    }
+
+    return ret;
+}
+
+static int trex_list(TRex* exp) {
+    int ret = -1, e;
+    if (*exp->_p == TREX_SYMBOL_BEGINNING_OF_STRING) {
+        exp->_p++;
+        ret = trex_newnode(exp, OP_BOL);
+    }
+    e = trex_element(exp);
+    if (ret != -1) {
+        exp->_nodes[ret].next = e;
+    } else
+        ret = e;
+
+    if (*exp->_p == TREX_SYMBOL_BRANCH) {
+        int temp, tright;
+        exp->_p++;
+        temp = trex_newnode(exp, OP_OR);
+        exp->_nodes[temp].left = ret;
+        tright = trex_list(exp);
+        exp->_nodes[temp].right = tright;
+        ret = temp;
+    }
+    return ret;
+}
+
+static TRexBool trex_matchcclass(int cclass, TRexChar c) {
+    switch (cclass) {
+        case 'a':
+            return isalpha(c) ? TRex_True : TRex_False;
+        case 'A':
+            return !isalpha(c) ? TRex_True : TRex_False;
+        case 'w':
+            return (isalnum(c) || c == '_') ? TRex_True : TRex_False;
+        case 'W':
+            return (!isalnum(c) && c != '_') ? TRex_True : TRex_False;
+        case 's':
+            return isspace(c) ? TRex_True : TRex_False;
+        case 'S':
+            return !isspace(c) ? TRex_True : TRex_False;
+        case 'd':
+            return isdigit(c) ? TRex_True : TRex_False;
+        case 'D':
+            return !isdigit(c) ? TRex_True : TRex_False;
+        case 'x':
+            return isxdigit(c) ? TRex_True : TRex_False;
+        case 'X':
+            return !isxdigit(c) ? TRex_True : TRex_False;
+        case 'c':
+            return iscntrl(c) ? TRex_True : TRex_False;
+        case 'C':
+            return !iscntrl(c) ? TRex_True : TRex_False;
+        case 'p':
+            return ispunct(c) ? TRex_True : TRex_False;
+        case 'P':
+            return !ispunct(c) ? TRex_True : TRex_False;
+        case 'l':
+            return islower(c) ? TRex_True : TRex_False;
+        case 'u':
+            return isupper(c) ? TRex_True : TRex_False;
+    }
+    return TRex_False; /*cannot happen*/
+}
+
+static TRexBool trex_matchclass(TRex* exp, TRexNode* node, TRexChar c) {
+    do {
+        switch (node->type) {
+            case OP_RANGE:
+                if (exp->_flags & TREX_ICASE) {
+                    if (c >= toupper(node->left) && c <= toupper(node->right))
+                        return TRex_True;
+                    if (c >= tolower(node->left) && c <= tolower(node->right))
+                        return TRex_True;
+                } else {
+                    if (c >= node->left && c <= node->right)
+                        return TRex_True;
+                }
+                break;
+            case OP_CCLASS:
+                if (trex_matchcclass(node->left, c))
+                    return TRex_True;
+                break;
+            default:
+                if (exp->_flags & TREX_ICASE) {
+                    if (c == tolower(node->type) || c == toupper(node->type))
+                        return TRex_True;
+                } else {
+                    if (c == node->type)
+                        return TRex_True;
+                }
+        }
+    } while ((node->next != -1) && ((node = &exp->_nodes[node->next]) != NULL));
+    return TRex_False;
+}
+
+static const TRexChar* trex_matchnode(TRex* exp, TRexNode* node, const TRexChar* str, TRexNode* next) {
+    TRexNodeType type = node->type;
+    switch (type) {
+        case OP_GREEDY: {
+            /* TRexNode *greedystop = (node->next != -1) ? &exp->_nodes[node->next] : NULL; */
+            TRexNode* greedystop = NULL;
+            int p0 = (node->right >> 16) & 0x0000FFFF, p1 = node->right & 0x0000FFFF, nmaches = 0;
+            const TRexChar *s = str, *good = str;
+
+            if (node->next != -1) {
+                greedystop = &exp->_nodes[node->next];
+            } else {
+                greedystop = next;
+            }
+
+            while ((nmaches == 0xFFFF || nmaches < p1)) {
+                const TRexChar* stop;
+                if ((s = trex_matchnode(exp, &exp->_nodes[node->left], s, greedystop)) == NULL)
+                    break;
+                nmaches++;
+                good = s;
+                if (greedystop) {
+                    /* checks that 0 matches satisfy the expression(if so skips) */
+                    /* if not would always stop(for instance if is a '?') */
+                    if (greedystop->type != OP_GREEDY || (greedystop->type == OP_GREEDY && ((greedystop->right >> 16) & 0x0000FFFF) != 0)) {
+                        TRexNode* gnext = NULL;
+                        if (greedystop->next != -1) {
+                            gnext = &exp->_nodes[greedystop->next];
+                        } else if (next && next->next != -1) {
+                            gnext = &exp->_nodes[next->next];
+                        }
+                        stop = trex_matchnode(exp, greedystop, s, gnext);
+                        if (stop) {
+                            /* if satisfied stop it */
+                            if (p0 == p1 && p0 == nmaches)
+                                break;
+                            else if (nmaches >= p0 && p1 == 0xFFFF)
+                                break;
+                            else if (nmaches >= p0 && nmaches <= p1)
+                                break;
+                        }
+                    }
+                }
+
+                if (s >= exp->_eol)
+                    break;
+            }
+            if (p0 == p1 && p0 == nmaches)
+                return good;
+            else if (nmaches >= p0 && p1 == 0xFFFF)
+                return good;
+            else if (nmaches >= p0 && nmaches <= p1)
+                return good;
+            return NULL;
+        }
+        case OP_OR: {
+            const TRexChar* asd = str;
+            TRexNode* temp = &exp->_nodes[node->left];
+            while ((asd = trex_matchnode(exp, temp, asd, NULL)) != NULL) {
+                if (temp->next != -1)
+                    temp = &exp->_nodes[temp->next];
+                else
+                    return asd;
+            }
+            asd = str;
+            temp = &exp->_nodes[node->right];
+            while ((asd = trex_matchnode(exp, temp, asd, NULL)) != NULL) {
+                if (temp->next != -1)
+                    temp = &exp->_nodes[temp->next];
+                else
+                    return asd;
+            }
+            return NULL;
+            break;
+        }
+        case OP_EXPR:
+        case OP_NOCAPEXPR: {
+            TRexNode* n = &exp->_nodes[node->left];
+            const TRexChar* cur = str;
+            int capture = -1;
+            if (node->type != OP_NOCAPEXPR && node->right == exp->_currsubexp) {
+                capture = exp->_currsubexp;
+                exp->_matches[capture].begin = cur;
+                exp->_currsubexp++;
+            }
+
+            do {
+                TRexNode* subnext = NULL;
+                if (n->next != -1) {
+                    subnext = &exp->_nodes[n->next];
+                } else {
+                    subnext = next;
+                }
+                if ((cur = trex_matchnode(exp, n, cur, subnext)) == NULL) {
+                    if (capture != -1) {
+                        exp->_matches[capture].begin = 0;
+                        exp->_matches[capture].len = 0;
+                    }
+                    return NULL;
+                }
+            } while ((n->next != -1) && ((n = &exp->_nodes[n->next]) != NULL));
+
+            if (capture != -1)
+                exp->_matches[capture].len = (int)(cur - exp->_matches[capture].begin);
+            return cur;
+        }
+        case OP_WB:
+            if ((str == exp->_bol && !isspace((int)(*str))) || (str == exp->_eol && !isspace((int)(*(str - 1)))) || (!isspace((int)(*str)) && isspace((int)(*(str + 1)))) ||
+                (isspace((int)(*str)) && !isspace((int)(*(str + 1))))) {
+                return (node->left == 'b') ? str : NULL;
+            }
+            return (node->left == 'b') ? NULL : str;
+        case OP_BOL:
+            if (str == exp->_bol)
+                return str;
+            return NULL;
+        case OP_EOL:
+            if (str == exp->_eol)
+                return str;
+            return NULL;
+        case OP_DOT: {
+            str++;
+        }
+            return str;
+        case OP_NCLASS:
+        case OP_CLASS:
+            if (trex_matchclass(exp, &exp->_nodes[node->left], *str) ? (type == OP_CLASS ? TRex_True : TRex_False)
+                                                                     : (type == OP_NCLASS ? TRex_True : TRex_False)) {
+                str++;
+                return str;
+            }
+            return NULL;
+        case OP_CCLASS:
+            if (trex_matchcclass(node->left, *str)) {
+                str++;
+                return str;
+            }
+            return NULL;
+        default: /* char */
+            if (exp->_flags & TREX_ICASE) {
+                if (*str != tolower(node->type) && *str != toupper(node->type))
+                    return NULL;
+            } else {
+                if (*str != node->type)
+                    return NULL;
+            }
+            str++;
+            return str;
+    }
+}
+
+/* public api */
+TRex* trex_compile(const TRexChar* pattern, const TRexChar** error, int flags) {
+    TRex* exp = (TRex*)xmalloc(sizeof(TRex));
+    exp->_eol = exp->_bol = NULL;
+    exp->_p = pattern;
+    exp->_nallocated = (int)(scstrlen(pattern) * sizeof(TRexChar));
+    exp->_nodes = (TRexNode*)xmalloc((size_t)exp->_nallocated * sizeof(TRexNode));
+    exp->_nsize = 0;
+    exp->_matches = 0;
+    exp->_nsubexpr = 0;
+    exp->_first = trex_newnode(exp, OP_EXPR);
+    exp->_error = error;
+    exp->_jmpbuf = xmalloc(sizeof(jmp_buf));
+    exp->_flags = flags;
+    if (setjmp(*((jmp_buf*)exp->_jmpbuf)) == 0) {
+        int res = trex_list(exp);
+        exp->_nodes[exp->_first].left = res;
+        if (*exp->_p != '\0')
+            trex_error(exp, _SC("unexpected character"));
+#ifdef ARG_REX_DEBUG
+        {
+            int nsize, i;
+            nsize = exp->_nsize;
+            scprintf(_SC("\n"));
+            for (i = 0; i < nsize; i++) {
+                if (exp->_nodes[i].type > MAX_CHAR)
+                    scprintf(_SC("[%02d] %10s "), i, g_nnames[exp->_nodes[i].type - MAX_CHAR]);
+                else
+                    scprintf(_SC("[%02d] %10c "), i, exp->_nodes[i].type);
+                scprintf(_SC("left %02d right %02d next %02d\n"), exp->_nodes[i].left, exp->_nodes[i].right, exp->_nodes[i].next);
+            }
+            scprintf(_SC("\n"));
+        }
+#endif
+        exp->_matches = (TRexMatch*)xmalloc((size_t)exp->_nsubexpr * sizeof(TRexMatch));
+        memset(exp->_matches, 0, (size_t)exp->_nsubexpr * sizeof(TRexMatch));
+    } else {
+        trex_free(exp);
+        return NULL;
+    }
+    return exp;
+}
+
+void trex_free(TRex* exp) {
+    if (exp) {
+        xfree(exp->_nodes);
+        xfree(exp->_jmpbuf);
+        xfree(exp->_matches);
+        xfree(exp);
+    }
+}
+
+TRexBool trex_match(TRex* exp, const TRexChar* text) {
+    const TRexChar* res = NULL;
+    exp->_bol = text;
+    exp->_eol = text + scstrlen(text);
+    exp->_currsubexp = 0;
+    res = trex_matchnode(exp, exp->_nodes, text, NULL);
+    if (res == NULL || res != exp->_eol)
+        return TRex_False;
+    return TRex_True;
+}
+
+TRexBool trex_searchrange(TRex* exp, const TRexChar* text_begin, const TRexChar* text_end, const TRexChar** out_begin, const TRexChar** out_end) {
+    const TRexChar* cur = NULL;
+    int node = exp->_first;
+    if (text_begin >= text_end)
+        return TRex_False;
+    exp->_bol = text_begin;
+    exp->_eol = text_end;
+    do {
+        cur = text_begin;
+        while (node != -1) {
+            exp->_currsubexp = 0;
+            cur = trex_matchnode(exp, &exp->_nodes[node], cur, NULL);
+            if (!cur)
+                break;
+            node = exp->_nodes[node].next;
+        }
+        text_begin++;
+    } while (cur == NULL && text_begin != text_end);
+
+    if (cur == NULL)
+        return TRex_False;
+
+    --text_begin;
+
+    if (out_begin)
+        *out_begin = text_begin;
+    if (out_end)
+        *out_end = cur;
+    return TRex_True;
+}
+
+TRexBool trex_search(TRex* exp, const TRexChar* text, const TRexChar** out_begin, const TRexChar** out_end) {
+    return trex_searchrange(exp, text, text + scstrlen(text), out_begin, out_end);
+}
+
+int trex_getsubexpcount(TRex* exp) {
+    return exp->_nsubexpr;
+}
+
+TRexBool trex_getsubexp(TRex* exp, int n, TRexMatch* subexp) {
+    if (n < 0 || n >= exp->_nsubexpr)
+        return TRex_False;
+    *subexp = exp->_matches[n];
+    return TRex_True;
+}
+
+/* Marks the characters that every match of the node chain has to contain.
+ * A chain starting with an alternation guarantees nothing, and a repeated
+ * node only contributes when it has to match at least once.
+ */
+static void trex_required(TRex* exp, int node, unsigned char* seen) {
+    if (node == -1 || exp->_nodes[node].type == OP_OR)
+        return;
+    for (; node != -1; node = exp->_nodes[node].next) {
+        TRexNode* n = &exp->_nodes[node];
+        if (n->type <= MAX_CHAR)
+            seen[(unsigned char)n->type] = 1;
+        else if (n->type == OP_EXPR || n->type == OP_NOCAPEXPR)
+            trex_required(exp, n->left, seen);
+        else if (n->type == OP_GREEDY && ((n->right >> 16) & 0x0000FFFF) > 0)
+            trex_required(exp, n->left, seen);
+    }
+}
+
+/* Extracts the literals of the top-level node chain that every text accepted
+ * by trex_match has: the characters it starts with, those it ends with, and
+ * the other characters it contains, each as a NUL terminated string. Since
+ * trex_match consumes the text from its start to its end, one node after the
+ * other, the characters matched by a leading run of character nodes are a
+ * prefix of the text and those of a trailing run are a suffix. Anchors and
+ * word boundaries consume nothing and do not break a run. Case insensitive
+ * programs yield no literals.
+ */
+void trex_literals(TRex* exp, TRexChar* prefix, TRexChar* suffix, TRexChar* required) {
+    unsigned char seen[MAX_CHAR + 1];
+    int node = exp->_nodes[exp->_first].left;
+    int inprefix = 1;
+    int np = 0, ns = 0, nr = 0;
+    int c, i;
+
+    memset(seen, 0, sizeof(seen));
+    if (!(exp->_flags & TREX_ICASE) && node != -1 && exp->_nodes[node].type != OP_OR) {
+        for (; node != -1; node = exp->_nodes[node].next) {
+            TRexNodeType type = exp->_nodes[node].type;
+            if (type <= MAX_CHAR) {
+                if (inprefix)
+                    prefix[np++] = (TRexChar)type;
+                suffix[ns++] = (TRexChar)type;
+            } else if (type != OP_BOL && type != OP_EOL && type != OP_WB) {
+                inprefix = 0;
+                ns = 0;
+            }
+        }
+        trex_required(exp, exp->_nodes[exp->_first].left, seen);
+    }
+
+    /* the prefix and suffix are compared as a whole, so their characters need no search */
+    for (i = 0; i < np; i++)
+        seen[(unsigned char)prefix[i]] = 0;
+    for (i = 0; i < ns; i++)
+        seen[(unsigned char)suffix[i]] = 0;
+    for (c = 1; c <= MAX_CHAR; c++) {
+        if (seen[c])
+            required[nr++] = (TRexChar)c;
+    }
+    prefix[np] = suffix[ns] = required[nr] = 0;
+}
+/*******************************************************************************
+ * arg_enum: Implements the enumerated choice command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <ctype.h>
+#include <string.h>
+
+/*
+ * The choices are stored in a minimal perfect hash table built with the
+ * "hash, displace" method: every key is first hashed into one of n buckets,
+ * and each bucket then records how to place its keys in the n slots. For a
+ * bucket with several keys, disp[] holds the seed of a second hash that sends
+ * all of them to free slots; for a bucket with a single key, disp[] holds
+ * -(slot + 1) so that the key lands in that slot directly. Looking a value up
+ * takes at most two hashes and one string comparison.
+ */
+struct arg_enum_priv {
+    struct arg_hdr_ext ext;     /* must come first, see ARG_HASEXT */
+    const char* const* choices; /* NULL terminated array of choices */
+    int nchoices;               /* number of choices, which is also the table size */
+    int flags;                  /* ARG_ENUM_ICASE */
+    int* disp;                  /* disp[nchoices] displacement of each bucket */
+    int* slot;                  /* slot[nchoices] index of the choice in each slot */
+};
+
+/* FNV-1a over the (optionally case folded) bytes of str, varied by seed and finished with the MurmurHash3 mixer */
+static unsigned int arg_enum_hash(const char* str, unsigned int seed, int icase) {
+    const unsigned char* ptr = (const unsigned char*)str;
+    unsigned int hash = 2166136261u ^ (seed * 2654435761u);
+
+    if (icase) {
+        for (; *ptr; ptr++)
+            hash = (hash ^ (unsigned int)tolower(*ptr)) * 16777619u;
+    } else {
+        for (; *ptr; ptr++)
+            hash = (hash ^ *ptr) * 16777619u;
+    }
+
+    /* the low bits of FNV-1a depend only on the low bits of the input, mix in the high ones */
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static int arg_enum_equal(const char* s1, const char* s2, int icase) {
+    const unsigned char* us1 = (const unsigned char*)s1;
+    const unsigned char* us2 = (const unsigned char*)s2;
+
+    if (!icase)
+        return strcmp(s1, s2) == 0;
+
+    while (tolower(*us1) == tolower(*us2)) {
+        if (*us1 == '\0')
+            return 1;
+        us1++;
+        us2++;
+    }
+    return 0;
+}
+
+/* Returns the index of the choice equal to str, or -1 if there is none */
+static int arg_enum_lookup(const struct arg_enum_priv* priv, const char* str) {
+    unsigned int n = (unsigned int)priv->nchoices;
+    int icase = priv->flags & ARG_ENUM_ICASE;
+    int d = priv->disp[arg_enum_hash(str, 0, icase) % n];
+    int i = priv->slot[d < 0 ? -d - 1 : (int)(arg_enum_hash(str, (unsigned int)d, icase) % n)];
+
+    return arg_enum_equal(priv->choices[i], str, icase) ? i : -1;
+}
+
+/*
+ * Builds the perfect hash table of priv->choices in priv->disp[] and
+ * priv->slot[]. Returns -1 on success, or the index of a choice equal to an
+ * earlier one, in which case no table can be built.
+ */
+static int arg_enum_build(struct arg_enum_priv* priv) {
+    int n = priv->nchoices;
+    int icase = priv->flags & ARG_ENUM_ICASE;
+    int* first = (int*)xmalloc(sizeof(int) * (size_t)n * 3); /* first key of each bucket */
+    int* next = first + n;                                   /* next key in the same bucket */
+    int* size = next + n;                                    /* number of keys in each bucket */
+    int maxsize = 0;
+    int duplicate = -1;
+    int b;
+    int i;
+    int s;
+
+    for (b = 0; b < n; b++) {
+        first[b] = -1;
+        size[b] = 0;
+        priv->disp[b] = 0;
+        priv->slot[b] = -1;
+    }
+
+    /* hash every key into its bucket, equal keys end up in the same one */
+    for (i = n - 1; i >= 0; i--) {
+        b = (int)(arg_enum_hash(priv->choices[i], 0, icase) % (unsigned int)n);
+        next[i] = first[b];
+        first[b] = i;
+        if (++size[b] > maxsize)
+            maxsize = size[b];
+    }
+
+    /* place the buckets with several keys first, largest first, as they are the hardest to place */
+    for (; maxsize > 1 && duplicate < 0; maxsize--) {
+        for (b = 0; b < n && duplicate < 0; b++) {
+            unsigned int seed;
+            int key;
+
+            if (size[b] != maxsize)
+                continue;
+
+            for (key = first[b]; key >= 0; key = next[key]) {
+                for (i = next[key]; i >= 0; i = next[i]) {
+                    if (arg_enum_equal(priv->choices[key], priv->choices[i], icase))
+                        duplicate = i;
+                }
+            }
+            if (duplicate >= 0)
+                break;
+
+            /* find a seed that sends every key of the bucket to a distinct free slot */
+            for (seed = 1;; seed++) {
+                for (key = first[b]; key >= 0; key = next[key]) {
+                    s = (int)(arg_enum_hash(priv->choices[key], seed, icase) % (unsigned int)n);
+                    if (priv->slot[s] >= 0)
+                        break;
+                    priv->slot[s] = key;
+                }
+                if (key < 0)
+                    break;
+
+                /* take back the keys placed with this seed */
+                for (key = first[b]; key >= 0; key = next[key]) {
+                    s = (int)(arg_enum_hash(priv->choices[key], seed, icase) % (unsigned int)n);
+                    if (priv->slot[s] == key)
+                        priv->slot[s] = -1;
+                }
+            }
+            priv->disp[b] = (int)seed;
+        }
+    }
+
+    /* the buckets with a single key go straight to the remaining free slots */
+    for (b = 0, s = 0; b < n && duplicate < 0; b++) {
+        if (size[b] != 1)
+            continue;
+        while (priv->slot[s] >= 0)
+            s++;
+        priv->slot[s] = first[b];
+        priv->disp[b] = -s - 1;
+    }
+
+    /* empty buckets keep a seed of 0, only values that are not choices hash to them */
+    xfree(first);
+    return duplicate;
+}
+
+static void arg_enum_resetfn(void* parent_) {
+    struct arg_enum* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+static int arg_enum_scanfn(void* parent_, const char* argval) {
+    struct arg_enum* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent argument value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        int i = arg_enum_lookup((const struct arg_enum_priv*)parent->hdr.priv, argval);
+
+        /* if success then store the index of the choice in parent->idx[] array */
+        if (i >= 0)
+            parent->idx[parent->count++] = i;
+        else
+            errorcode = ARG_ERR_BADENUM;
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_enum_checkfn(void* parent_) {
+    struct arg_enum* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_enum_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_enum* parent = parent_;
+    struct arg_enum_priv* priv = (struct arg_enum_priv*)parent->hdr.priv;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+    int i;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADENUM:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, " ");
+            arg_dstr_cat(ds, "(expected one of ");
+            for (i = 0; i < priv->nchoices; i++)
+                arg_dstr_catf(ds, i ? ", %s" : "%s", priv->choices[i]);
+            arg_dstr_cat(ds, ")\n");
+            break;
+    }
+}
+
+static void* arg_enum_clonefn(void* parent_) {
+    struct arg_enum* parent = parent_;
+    struct arg_enum_priv* priv = (struct arg_enum_priv*)parent->hdr.priv;
+    const char* str = (const char*)(priv->slot + priv->nchoices);
+    size_t nbytes;
+    struct arg_enum* result;
+    struct arg_enum_priv* rpriv;
+
+    nbytes = sizeof(struct arg_enum) + sizeof(struct arg_enum_priv) + (size_t)parent->hdr.maxcount * sizeof(int) +
+             (size_t)priv->nchoices * 2 * sizeof(int) + (parent->hdr.datatype == str ? strlen(str) + 1 : 0);
+    result = (struct arg_enum*)arg_clone_block(parent, nbytes);
+
+    /* the lookup table is only read while parsing, but lives in the same block */
+    result->hdr.priv = ARG_CLONE_PTR(result, parent, priv);
+    rpriv = (struct arg_enum_priv*)result->hdr.priv;
+    rpriv->disp = (int*)ARG_CLONE_PTR(result, parent, priv->disp);
+    rpriv->slot = (int*)ARG_CLONE_PTR(result, parent, priv->slot);
+    result->idx = (int*)ARG_CLONE_PTR(result, parent, parent->idx);
+    if (parent->hdr.datatype == str)
+        result->hdr.datatype = (const char*)ARG_CLONE_PTR(result, parent, str);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_enum_ext = {ARG_HDR_EXT_VERSION, NULL, arg_enum_clonefn};
+
+arg_enum_t* arg_enum0(const char* shortopts, const char* longopts, const char* const* choices, const char* datatype, int flags, const char* glossary) {
+    return arg_enumn(shortopts, longopts, choices, datatype, 0, 1, flags, glossary);
+}
+
+arg_enum_t* arg_enum1(const char* shortopts, const char* longopts, const char* const* choices, const char* datatype, int flags, const char* glossary) {
+    return arg_enumn(shortopts, longopts, choices, datatype, 1, 1, flags, glossary);
+}
+
+arg_enum_t* arg_enumn(const char* shortopts,
+                      const char* longopts,
+                      const char* const* choices,
+                      const char* datatype,
+                      int mincount,
+                      int maxcount,
+                      int flags,
+                      const char* glossary) {
+    size_t nbytes;
+    size_t len = 0;
+    struct arg_enum* result;
+    struct arg_enum_priv* priv;
+    int nchoices = 0;
+    int duplicate;
+
+    if (!choices || !choices[0]) {
+        ARG_LOG(("argtable: ERROR - no choices given for enumerated option\n"));
+        ARG_LOG(("argtable: Bad argument table.\n"));
+        return NULL;
+    }
+
+    /* count the choices and the length of the "{a,b,c}" datatype listing them */
+    for (nchoices = 0; choices[nchoices]; nchoices++)
+        len += strlen(choices[nchoices]) + 1;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_enum)                    /* storage for struct arg_enum */
+             + sizeof(struct arg_enum_priv)             /* storage for private arg_enum data */
+             + (size_t)maxcount * sizeof(int)           /* storage for idx[maxcount] array */
+             + (size_t)nchoices * 2 * sizeof(int)       /* storage for disp[] and slot[] arrays */
+             + (datatype ? 0 : len + 2);                /* storage for the datatype string */
+
+    result = (struct arg_enum*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype;
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_enum_resetfn;
+    result->hdr.scanfn = arg_enum_scanfn;
+    result->hdr.checkfn = arg_enum_checkfn;
+    result->hdr.errorfn = arg_enum_errorfn;
+
+    /* store the arg_enum_priv struct immediately after the arg_enum struct */
+    result->hdr.priv = result + 1;
+    priv = (struct arg_enum_priv*)(result->hdr.priv);
+    priv->ext = arg_enum_ext;
+    priv->choices = choices;
+    priv->nchoices = nchoices;
+    priv->flags = flags;
+
+    /* store the idx[maxcount], disp[nchoices] and slot[nchoices] arrays after it */
+    result->idx = (int*)(priv + 1);
+    result->count = 0;
+    priv->disp = result->idx + maxcount;
+    priv->slot = priv->disp + nchoices;
+
+    /* list the choices as the datatype unless one was given */
+    if (!datatype) {
+        char* str = (char*)(priv->slot + nchoices);
+        int i;
+
+        result->hdr.datatype = str;
+        *str++ = '{';
+        for (i = 0; i < nchoices; i++) {
+            size_t n = strlen(choices[i]);
+            memcpy(str, choices[i], n);
+            str += n;
+            *str++ = (i + 1 < nchoices) ? ',' : '}';
+        }
+        *str = '\0';
+    }
+
+    duplicate = arg_enum_build(priv);
+    if (duplicate >= 0) {
+        ARG_LOG(("argtable: ERROR - duplicate choice \"%s\" for enumerated option\n", choices[duplicate]));
+        ARG_LOG(("argtable: Bad argument table.\n"));
+        xfree(result);
+        return NULL;
+    }
+
+    ARG_TRACE(("arg_enumn() returns %p\n", result));
+    return result;
+}
+/*******************************************************************************
+ * arg_str: Implements the str command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 1998-2001,2003-2011,2013 Stewart Heitmann
+ * <sheitmann@users.sourceforge.net>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <stdlib.h>
+
+static void arg_str_resetfn(void* parent_) {
+    struct arg_str* parent = parent_;
+    int i;
+
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    for (i = 0; i < parent->count; i++) {
+        parent->sval[i] = "";
+    }
+    parent->count = 0;
+}
+
+static int arg_str_scanfn(void* parent_, const char* argval) {
+    struct arg_str* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent argument value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        parent->sval[parent->count++] = argval;
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_str_checkfn(void* parent_) {
+    struct arg_str* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_str_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_str* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+    }
+}
+
+static void* arg_str_clonefn(void* parent_) {
+    struct arg_str* parent = parent_;
+    struct arg_str* result = (struct arg_str*)arg_clone_block(parent, sizeof(struct arg_str) + (size_t)parent->hdr.maxcount * sizeof(char*));
+    result->sval = (const char**)ARG_CLONE_PTR(result, parent, parent->sval);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_str_ext = {ARG_HDR_EXT_VERSION, NULL, arg_str_clonefn};
+
+struct arg_str* arg_str0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_strn(shortopts, longopts, datatype, 0, 1, glossary);
+}
+
+struct arg_str* arg_str1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_strn(shortopts, longopts, datatype, 1, 1, glossary);
+}
+
+struct arg_str* arg_strn(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    size_t nbytes;
+    struct arg_str* result;
+    int i;
+
+    /* should not allow this stupid error */
+    /* we should return an error code warning this logic error */
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_str)      /* storage for struct arg_str */
+             + (size_t)maxcount * sizeof(char*); /* storage for sval[maxcount] array */
+
+    result = (struct arg_str*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype ? datatype : "<string>";
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_str_resetfn;
+    result->hdr.scanfn = arg_str_scanfn;
+    result->hdr.checkfn = arg_str_checkfn;
+    result->hdr.errorfn = arg_str_errorfn;
+    result->hdr.priv = (void*)&arg_str_ext;
+
+    /* store the sval[maxcount] array immediately after the arg_str struct */
+    result->sval = (const char**)(result + 1);
+    result->count = 0;
+
+    /* foolproof the string pointers by initializing them to reference empty strings */
+    for (i = 0; i < maxcount; i++)
+        result->sval[i] = "";
+
+    ARG_TRACE(("arg_strn() returns %p\n", result));
+    return result;
+}
+/*******************************************************************************
+ * arg_cmd: Provides the sub-command mechanism
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2019 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_MODULE_VERSION_SIZE 128
+
+static arg_hashtable_t* s_hashtable = NULL;
+static arg_tpool_t* s_cmd_pool = NULL;
+static unsigned int s_cmd_pool_gen = 0;
+static int s_cmd_workers = -1;
+static char* s_module_name = NULL;
+static int s_mod_ver_major = 0;
+static int s_mod_ver_minor = 0;
+static int s_mod_ver_patch = 0;
+static char* s_mod_ver_tag = NULL;
+static char* s_mod_ver = NULL;
+
+void arg_set_module_name(const char* name) {
+    size_t slen;
+
+    xfree(s_module_name);
+    slen = strlen(name);
+    s_module_name = (char*)xmalloc(slen + 1);
+    memset(s_module_name, 0, slen + 1);
+
+#if (defined(__STDC_LIB_EXT1__) && defined(__STDC_WANT_LIB_EXT1__)) || (defined(__STDC_SECURE_LIB__) && defined(__STDC_WANT_SECURE_LIB__))
+    strncpy_s(s_module_name, slen + 1, name, slen);
+#else
+    memcpy(s_module_name, name, slen);
+#endif
+}
+
+void arg_set_module_version(int major, int minor, int patch, const char* tag) {
+    size_t slen_tag, slen_ds;
+    arg_dstr_t ds;
+
+    s_mod_ver_major = major;
+    s_mod_ver_minor = minor;
+    s_mod_ver_patch = patch;
+
+    xfree(s_mod_ver_tag);
+    slen_tag = strlen(tag);
+    s_mod_ver_tag = (char*)xmalloc(slen_tag + 1);
+    memset(s_mod_ver_tag, 0, slen_tag + 1);
+
+#if (defined(__STDC_LIB_EXT1__) && defined(__STDC_WANT_LIB_EXT1__)) || (defined(__STDC_SECURE_LIB__) && defined(__STDC_WANT_SECURE_LIB__))
+    strncpy_s(s_mod_ver_tag, slen_tag + 1, tag, slen_tag);
+#else
+    memcpy(s_mod_ver_tag, tag, slen_tag);
+#endif
+
+    ds = arg_dstr_create();
+    arg_dstr_catf(ds, "%d.", s_mod_ver_major);
+    arg_dstr_catf(ds, "%d.", s_mod_ver_minor);
+    arg_dstr_catf(ds, "%d.", s_mod_ver_patch);
+    arg_dstr_cat(ds, s_mod_ver_tag);
+
+    xfree(s_mod_ver);
+    slen_ds = strlen(arg_dstr_cstr(ds));
+    s_mod_ver = (char*)xmalloc(slen_ds + 1);
+    memset(s_mod_ver, 0, slen_ds + 1);
+
+#if (defined(__STDC_LIB_EXT1__) && defined(__STDC_WANT_LIB_EXT1__)) || (defined(__STDC_SECURE_LIB__) && defined(__STDC_WANT_SECURE_LIB__))
+    strncpy_s(s_mod_ver, slen_ds + 1, arg_dstr_cstr(ds), slen_ds);
+#else
+    memcpy(s_mod_ver, arg_dstr_cstr(ds), slen_ds);
+#endif
+
+    arg_dstr_destroy(ds);
+}
+
+static unsigned int hash_key(const void* key) {
+    const char* str = (const char*)key;
+    int c;
+    unsigned int hash = 5381;
+
+    while ((c = *str++) != 0)
+        hash = ((hash << 5) + hash) + (unsigned int)c; /* hash * 33 + c */
+
+    return hash;
+}
+
+static int equal_keys(const void* key1, const void* key2) {
+    char* k1 = (char*)key1;
+    char* k2 = (char*)key2;
+    return (0 == strcmp(k1, k2));
+}
+
+#if ARG_CMD_COMPACT
+/*
+ * In compact mode the names and descriptions of all sub-commands live in a
+ * string arena: a chain of large blocks that are neither moved nor freed before
+ * arg_cmd_uninit(). Strings are interned through an open-addressing set of
+ * pointers into the arena, so each distinct string is stored once and the keys
+ * of s_hashtable point straight into the arena.
+ */
+#define ARG_CMD_ARENA_BLOCK_SIZE 16384
+
+struct arg_cmd_arena_block {
+    struct arg_cmd_arena_block* next;
+    size_t used;
+    size_t size;
+};
+
+static struct arg_cmd_arena_block* s_arena = NULL;
+static const char** s_intern = NULL;
+static size_t s_intern_size = 0;
+static size_t s_intern_count = 0;
+
+static char* arg_cmd_arena_alloc(size_t len) {
+    struct arg_cmd_arena_block* block = s_arena;
+    char* p;
+
+    if (block == NULL || block->size - block->used < len) {
+        size_t size = len > ARG_CMD_ARENA_BLOCK_SIZE ? len : ARG_CMD_ARENA_BLOCK_SIZE;
+
+        block = (struct arg_cmd_arena_block*)xmalloc(sizeof(struct arg_cmd_arena_block) + size);
+        block->used = 0;
+        block->size = size;
+        if (s_arena && size == len) {
+            /* an oversized string gets its own block; keep filling the current one */
+            block->next = s_arena->next;
+            s_arena->next = block;
+        } else {
+            block->next = s_arena;
+            s_arena = block;
+        }
+    }
+
+    p = (char*)(block + 1) + block->used;
+    block->used += len;
+    return p;
+}
+
+static void arg_cmd_intern_insert(const char** table, size_t size, const char* str) {
+    size_t i = (size_t)hash_key(str) & (size - 1);
+
+    while (table[i])
+        i = (i + 1) & (size - 1);
+    table[i] = str;
+}
+
+static const char* arg_cmd_intern(const char* str) {
+    size_t len;
+    size_t i;
+    char* p;
+
+    /* keep the load factor at or below 1/2 */
+    if (2 * (s_intern_count + 1) > s_intern_size) {
+        size_t size = s_intern_size ? 2 * s_intern_size : 64;
+        const char** table = (const char**)xcalloc(size, sizeof(const char*));
+
+        for (i = 0; i < s_intern_size; i++) {
+            if (s_intern[i])
+                arg_cmd_intern_insert(table, size, s_intern[i]);
+        }
+        xfree((void*)s_intern);
+        s_intern = table;
+        s_intern_size = size;
+    }
+
+    for (i = (size_t)hash_key(str) & (s_intern_size - 1); s_intern[i]; i = (i + 1) & (s_intern_size - 1)) {
+        if (strcmp(s_intern[i], str) == 0)
+            return s_intern[i];
+    }
+
+    len = strlen(str);
+    p = arg_cmd_arena_alloc(len + 1);
+    memcpy(p, str, len + 1);
+    s_intern[i] = p;
+    s_intern_count++;
+    return p;
+}
+
+static void arg_cmd_intern_free(void) {
+    while (s_arena) {
+        struct arg_cmd_arena_block* next = s_arena->next;
+        xfree(s_arena);
+        s_arena = next;
+    }
+    xfree((void*)s_intern);
+    s_intern = NULL;
+    s_intern_size = 0;
+    s_intern_count = 0;
+}
+#endif
+
+/*
+ * State of a command registered with arg_cmd_register_table(), kept in both
+ * arg_cmd_info_t.priv and arg_cmd_info_t.ctx so that calling the trampoline in
+ * arg_cmd_info_t.proc with arg_cmd_info_t.ctx runs the command. The registry
+ * holds one reference, and every dispatch holds another while it is queued or
+ * running, so replacing or removing the command does not free the state under
+ * a dispatch.
+ */
+struct arg_cmd_table {
+    arg_cmdtablefn proc;
+    arg_cmdfactoryfn factory;
+    void* ctx;       /* user context passed to proc and factory */
+    void** argtable; /* built on first dispatch, then reused */
+    int busy;        /* argtable is being used by a dispatch */
+    int refs;
+};
+
+static void arg_cmd_argtable_free(void** argtable) {
+    if (argtable == NULL)
+        return;
+
+    arg_free(argtable);
+    free(argtable);
+}
+
+static struct arg_cmd_table* arg_cmd_table_retain(struct arg_cmd_table* table) {
+    if (table) {
+        arg_global_lock();
+        table->refs++;
+        arg_global_unlock();
+    }
+    return table;
+}
+
+static void arg_cmd_table_release(struct arg_cmd_table* table) {
+    int refs;
+
+    if (table == NULL)
+        return;
+
+    arg_global_lock();
+    refs = --table->refs;
+    arg_global_unlock();
+
+    if (refs == 0) {
+        arg_cmd_argtable_free(table->argtable);
+        xfree(table);
+    }
+}
+
+static void arg_cmd_table_free(arg_cmd_info_t* cmd_info) {
+    arg_cmd_table_release((struct arg_cmd_table*)cmd_info->priv);
+    cmd_info->priv = NULL;
+}
+
+void arg_cmd_init(void) {
+    s_hashtable = arg_hashtable_create(32, hash_key, equal_keys);
+#if ARG_CMD_COMPACT
+    /* the keys are the interned names */
+    s_hashtable->freekeys = 0;
+#endif
+}
+
+void arg_cmd_uninit(void) {
+    arg_tpool_destroy(s_cmd_pool);
+    s_cmd_pool = NULL;
+    s_cmd_pool_gen++;
+    if (s_hashtable && arg_hashtable_count(s_hashtable) > 0) {
+        arg_hashtable_itr_t* itr = arg_hashtable_itr_create(s_hashtable);
+        do {
+            arg_cmd_table_free((arg_cmd_info_t*)arg_hashtable_itr_value(itr));
+        } while (arg_hashtable_itr_advance(itr));
+        arg_hashtable_itr_destroy(itr);
+    }
+    arg_hashtable_destroy(s_hashtable, 1);
+    s_hashtable = NULL;
+#if ARG_CMD_COMPACT
+    arg_cmd_intern_free();
+#endif
+}
+
+/* Add a command, or replace the command of the same name, and return its info */
+static arg_cmd_info_t* arg_cmd_insert(const char* name, const char* description, void* ctx) {
+    arg_cmd_info_t* cmd_info;
+#if !ARG_CMD_COMPACT
+    size_t slen_name;
+    void* k;
+
+    assert(strlen(name) < ARG_CMD_NAME_LEN);
+    assert(strlen(description) < ARG_CMD_DESCRIPTION_LEN);
+#endif
+
+    /* Check if the command already exists. */
+    /* If the command exists, replace the existing command. */
+    /* If the command doesn't exist, insert the command. */
+    cmd_info = (arg_cmd_info_t*)arg_hashtable_search(s_hashtable, name);
+    if (cmd_info) {
+        arg_cmd_table_free(cmd_info);
+        arg_hashtable_remove(s_hashtable, name);
+        cmd_info = NULL;
+    }
+
+    cmd_info = (arg_cmd_info_t*)xmalloc(sizeof(arg_cmd_info_t));
+    memset(cmd_info, 0, sizeof(arg_cmd_info_t));
+
+#if ARG_CMD_COMPACT
+    cmd_info->name = arg_cmd_intern(name);
+    cmd_info->description = arg_cmd_intern(description);
+    cmd_info->ctx = ctx;
+
+    arg_hashtable_insert(s_hashtable, (void*)cmd_info->name, cmd_info);
+#else
+#if (defined(__STDC_LIB_EXT1__) && defined(__STDC_WANT_LIB_EXT1__)) || (defined(__STDC_SECURE_LIB__) && defined(__STDC_WANT_SECURE_LIB__))
+    strncpy_s(cmd_info->name, ARG_CMD_NAME_LEN, name, strlen(name));
+    strncpy_s(cmd_info->description, ARG_CMD_DESCRIPTION_LEN, description, strlen(description));
+#else
+    memcpy(cmd_info->name, name, strlen(name));
+    memcpy(cmd_info->description, description, strlen(description));
+#endif
+
+    cmd_info->ctx = ctx;
+
+    slen_name = strlen(name);
+    k = xmalloc(slen_name + 1);
+    memset(k, 0, slen_name + 1);
+
+#if (defined(__STDC_LIB_EXT1__) && defined(__STDC_WANT_LIB_EXT1__)) || (defined(__STDC_SECURE_LIB__) && defined(__STDC_WANT_SECURE_LIB__))
+    strncpy_s((char*)k, slen_name + 1, name, slen_name);
+#else
+    memcpy((char*)k, name, slen_name);
+#endif
+
+    arg_hashtable_insert(s_hashtable, k, cmd_info);
+#endif
+    return cmd_info;
+}
+
+/*
+ * The handler of table-driven commands. It parses into the cached argtable,
+ * which is built by the factory on first use. A dispatch that finds the cached
+ * table in use by another thread (or by a nested dispatch of the same command)
+ * gets a temporary table instead.
+ */
+static int arg_cmd_table_proc(int argc, char* argv[], arg_dstr_t res, void* ctx) {
+    struct arg_cmd_table* table = arg_cmd_table_retain((struct arg_cmd_table*)ctx);
+    void** argtable = NULL;
+    int cached = 0;
+    int nerrors;
+    int ret;
+
+    arg_global_lock();
+    if (!table->busy) {
+        table->busy = 1;
+        argtable = table->argtable;
+        cached = 1;
+    }
+    arg_global_unlock();
+
+    if (argtable == NULL) {
+        argtable = table->factory(table->ctx);
+        if (argtable == NULL || arg_nullcheck(argtable) != 0) {
+            arg_cmd_argtable_free(argtable);
+            argtable = NULL;
+        }
+    }
+
+    if (argtable) {
+        /* arg_parse() resets the table before parsing */
+        nerrors = arg_parse(argc, argv, argtable);
+        ret = table->proc(argc, argv, argtable, nerrors, res, table->ctx);
+    } else {
+        arg_dstr_cat(res, "failed to allocate argtable\n");
+        ret = -1;
+    }
+
+    if (cached) {
+        arg_global_lock();
+        table->argtable = argtable;
+        table->busy = 0;
+        arg_global_unlock();
+    } else {
+        arg_cmd_argtable_free(argtable);
+    }
+
+    arg_cmd_table_release(table);
+    return ret;
+}
+
+void arg_cmd_register(const char* name, arg_cmdfn proc, const char* description, void* ctx) {
+    arg_cmd_info_t* cmd_info = arg_cmd_insert(name, description, ctx);
+    cmd_info->proc = proc;
+}
+
+void arg_cmd_register_table(const char* name, arg_cmdtablefn proc, arg_cmdfactoryfn factory, const char* description, void* ctx) {
+    arg_cmd_info_t* cmd_info;
+    struct arg_cmd_table* table;
+
+    assert(proc != NULL);
+    assert(factory != NULL);
+
+    table = (struct arg_cmd_table*)xmalloc(sizeof(struct arg_cmd_table));
+    table->proc = proc;
+    table->factory = factory;
+    table->ctx = ctx;
+    table->argtable = NULL;
+    table->busy = 0;
+    table->refs = 1;
+
+    cmd_info = arg_cmd_insert(name, description, table);
+    cmd_info->proc = arg_cmd_table_proc;
+    cmd_info->priv = table;
+}
+
+void arg_cmd_unregister(const char* name) {
+    arg_cmd_info_t* cmd_info = arg_cmd_info(name);
+
+    if (cmd_info)
+        arg_cmd_table_free(cmd_info);
+    arg_hashtable_remove(s_hashtable, name);
+}
+
+int arg_cmd_dispatch(const char* name, int argc, char* argv[], arg_dstr_t res) {
+    arg_cmd_info_t* cmd_info = arg_cmd_info(name);
+
+    assert(cmd_info != NULL);
+    assert(cmd_info->proc != NULL);
+
+    return cmd_info->proc(argc, argv, res, cmd_info->ctx);
+}
+
+/*
+ * Queued work copies the handler and context out of the registry, which may
+ * replace or remove the command before the work runs, and keeps the state of
+ * a table-driven command alive until it has run.
+ */
+struct _internal_arg_cmd_job {
+    arg_task_t task;
+    unsigned int pool_gen;
+    arg_cmdfn proc;
+    void* ctx;
+    struct arg_cmd_table* table;
+    int argc;
+    char** argv;
+    arg_dstr_t res;
+    int ret;
+};
+
+static void arg_cmd_job_run(void* arg) {
+    struct _internal_arg_cmd_job* job = (struct _internal_arg_cmd_job*)arg;
+    job->ret = job->proc(job->argc, job->argv, job->res, job->ctx);
+    arg_cmd_table_release(job->table);
+    job->table = NULL;
+}
+
+void arg_cmd_set_workers(int nworkers) {
+    /* finish the work queued on the old pool before resizing */
+    arg_tpool_destroy(s_cmd_pool);
+    s_cmd_pool = NULL;
+    s_cmd_pool_gen++;
+    s_cmd_workers = nworkers;
+}
+
+/* Return the worker pool, starting it on first use. */
+static arg_tpool_t* arg_cmd_pool(void) {
+    if (s_cmd_pool == NULL)
+        s_cmd_pool = arg_tpool_create(s_cmd_workers < 0 ? arg_thread_ncpu() : s_cmd_workers);
+    return s_cmd_pool;
+}
+
+/* Wait for a job. Jobs of a pool that has since been destroyed have already run. */
+static void arg_cmd_job_join(arg_cmd_job_t job) {
+    if (job->pool_gen == s_cmd_pool_gen)
+        arg_tpool_join(s_cmd_pool, &job->task);
+}
+
+arg_cmd_job_t arg_cmd_dispatch_async(const char* name, int argc, char* argv[]) {
+    arg_cmd_info_t* cmd_info = arg_cmd_info(name);
+    struct _internal_arg_cmd_job* job;
+
+    assert(cmd_info != NULL);
+    assert(cmd_info->proc != NULL);
+
+    job = (struct _internal_arg_cmd_job*)xmalloc(sizeof(struct _internal_arg_cmd_job));
+    job->proc = cmd_info->proc;
+    job->ctx = cmd_info->ctx;
+    job->table = arg_cmd_table_retain((struct arg_cmd_table*)cmd_info->priv);
+    job->argc = argc;
+    job->argv = argv;
+    job->res = arg_dstr_create();
+    job->ret = 0;
+    job->pool_gen = s_cmd_pool_gen;
+
+    arg_tpool_submit(arg_cmd_pool(), &job->task, arg_cmd_job_run, job);
+    return job;
+}
+
+int arg_cmd_job_poll(arg_cmd_job_t job) {
+    if (job->pool_gen != s_cmd_pool_gen)
+        return 1;
+    return arg_tpool_done(s_cmd_pool, &job->task);
+}
+
+int arg_cmd_job_wait(arg_cmd_job_t job) {
+    arg_cmd_job_join(job);
+    return job->ret;
+}
+
+arg_dstr_t arg_cmd_job_result(arg_cmd_job_t job) {
+    arg_cmd_job_join(job);
+    return job->res;
+}
+
+void arg_cmd_job_destroy(arg_cmd_job_t job) {
+    if (job == NULL)
+        return;
+
+    arg_cmd_job_join(job);
+    arg_dstr_destroy(job->res);
+    xfree(job);
+}
+
+void arg_cmd_set_flags(const char* name, int flags) {
+    arg_cmd_info_t* cmd_info = arg_cmd_info(name);
+
+    assert(cmd_info != NULL);
+    cmd_info->flags = flags;
+}
+
+struct arg_cmd_batch_item {
+    arg_task_t task;
+    arg_cmdfn proc; /* NULL for unknown commands */
+    void* ctx;
+    struct arg_cmd_table* table;
+    arg_cmd_batch_entry_t* entry;
+};
+
+struct _internal_arg_cmd_batch {
+    arg_mmap_t script;
+    char** words;
+    int count;
+    arg_cmd_batch_entry_t* entries;
+    struct arg_cmd_batch_item* items;
+};
+
+static arg_cmd_batch_t arg_cmd_batch_parse(arg_mmap_t* script) {
+    arg_cmd_batch_t batch;
+    arg_scanner_t scanner;
+    char* word;
+    int* first; /* index of each command's first word, later turned into argv pointers */
+    int nwords = 0, maxwords = 64;
+    int maxcount = 16;
+    int i;
+
+    batch = (arg_cmd_batch_t)xmalloc(sizeof(struct _internal_arg_cmd_batch));
+    batch->script = *script;
+    batch->count = 0;
+    batch->words = (char**)xmalloc(sizeof(char*) * (size_t)maxwords);
+    batch->entries = (arg_cmd_batch_entry_t*)xmalloc(sizeof(arg_cmd_batch_entry_t) * (size_t)maxcount);
+    first = (int*)xmalloc(sizeof(int) * (size_t)maxcount);
+
+    /* one pass over the script: each line break that precedes a word starts a new command */
+    arg_scanner_init(&scanner, batch->script.data, batch->script.len, 1);
+    while (arg_scan_word(&scanner, &word)) {
+        /* reserve room for this word and the NULL that terminates its command */
+        if (nwords + 2 > maxwords) {
+            maxwords *= 2;
+            batch->words = (char**)xrealloc(batch->words, sizeof(char*) * (size_t)maxwords);
+        }
+
+        if (scanner.newline) {
+            if (batch->count > 0)
+                batch->words[nwords++] = NULL;
+
+            if (batch->count == maxcount) {
+                maxcount *= 2;
+                batch->entries = (arg_cmd_batch_entry_t*)xrealloc(batch->entries, sizeof(arg_cmd_batch_entry_t) * (size_t)maxcount);
+                first = (int*)xrealloc(first, sizeof(int) * (size_t)maxcount);
+            }
+
+            first[batch->count] = nwords;
+            batch->entries[batch->count].line = scanner.line;
+            batch->entries[batch->count].argc = 0;
+            batch->count++;
+        }
+
+        batch->words[nwords++] = word;
+        batch->entries[batch->count - 1].argc++;
+    }
+    if (batch->count > 0)
+        batch->words[nwords++] = NULL;
+
+    batch->items = (struct arg_cmd_batch_item*)xmalloc(sizeof(struct arg_cmd_batch_item) * (size_t)(batch->count > 0 ? batch->count : 1));
+    for (i = 0; i < batch->count; i++) {
+        arg_cmd_batch_entry_t* entry = &batch->entries[i];
+        entry->argv = batch->words + first[i];
+        entry->ret = 0;
+        entry->res = arg_dstr_create();
+        entry->elapsed = 0;
+        batch->items[i].entry = entry;
+    }
+
+    xfree(first);
+    return batch;
+}
+
+arg_cmd_batch_t arg_cmd_batch_load(const char* path) {
+    arg_mmap_t script;
+
+    if (arg_mmap_open(&script, path) != 0)
+        return NULL;
+
+    return arg_cmd_batch_parse(&script);
+}
+
+arg_cmd_batch_t arg_cmd_batch_create(const char* text, size_t len) {
+    arg_mmap_t script;
+
+    arg_mmap_copy(&script, text, len);
+    return arg_cmd_batch_parse(&script);
+}
+
+static void arg_cmd_batch_item_run(void* arg) {
+    struct arg_cmd_batch_item* item = (struct arg_cmd_batch_item*)arg;
+    arg_cmd_batch_entry_t* entry = item->entry;
+    double start = arg_clock();
+
+    entry->ret = item->proc(entry->argc, entry->argv, entry->res, item->ctx);
+    entry->elapsed = arg_clock() - start;
+    arg_cmd_table_release(item->table);
+    item->table = NULL;
+}
+
+int arg_cmd_batch_run(arg_cmd_batch_t batch) {
+    arg_tpool_t* pool = NULL;
+    int pending = 0; /* first command that may still be running on the pool */
+    int nfailed = 0;
+    int i, j;
+
+    for (i = 0; i < batch->count; i++) {
+        struct arg_cmd_batch_item* item = &batch->items[i];
+        arg_cmd_batch_entry_t* entry = item->entry;
+        arg_cmd_info_t* cmd_info = arg_cmd_info(entry->argv[0]);
+
+        arg_dstr_reset(entry->res);
+        entry->elapsed = 0;
+        item->proc = NULL;
+
+        if (cmd_info == NULL || cmd_info->proc == NULL) {
+            arg_dstr_catf(entry->res, "unknown command \"%s\"\n", entry->argv[0]);
+            entry->ret = -1;
+            continue;
+        }
+
+        item->proc = cmd_info->proc;
+        item->ctx = cmd_info->ctx;
+        item->table = arg_cmd_table_retain((struct arg_cmd_table*)cmd_info->priv);
+
+        if (cmd_info->flags & ARG_CMD_INDEPENDENT) {
+            pool = arg_cmd_pool();
+            arg_tpool_submit(pool, &item->task, arg_cmd_batch_item_run, item);
+            continue;
+        }
+
+        /* a dependent command is a barrier: everything before it has to finish first */
+        for (j = pending; j < i; j++) {
+            if (batch->items[j].proc && pool)
+                arg_tpool_join(pool, &batch->items[j].task);
+        }
+        pending = i + 1;
+        arg_cmd_batch_item_run(item);
+    }
+
+    for (j = pending; j < batch->count; j++) {
+        if (batch->items[j].proc && pool)
+            arg_tpool_join(pool, &batch->items[j].task);
+    }
+
+    for (i = 0; i < batch->count; i++) {
+        if (batch->entries[i].ret != 0)
+            nfailed++;
+    }
+
+    return nfailed;
+}
+
+int arg_cmd_batch_count(arg_cmd_batch_t batch) {
+    return batch->count;
+}
+
+arg_cmd_batch_entry_t* arg_cmd_batch_entry(arg_cmd_batch_t batch, int i) {
+    assert(i >= 0 && i < batch->count);
+    return &batch->entries[i];
+}
+
+void arg_cmd_batch_destroy(arg_cmd_batch_t batch) {
+    int i;
+
+    if (batch == NULL)
+        return;
+
+    for (i = 0; i < batch->count; i++)
+        arg_dstr_destroy(batch->entries[i].res);
+
+    arg_mmap_close(&batch->script);
+    xfree(batch->items);
+    xfree(batch->entries);
+    xfree(batch->words);
+    xfree(batch);
+}
+
+arg_cmd_info_t* arg_cmd_info(const char* name) {
+    return (arg_cmd_info_t*)arg_hashtable_search(s_hashtable, name);
+}
+
+unsigned int arg_cmd_count(void) {
+    return s_hashtable ? arg_hashtable_count(s_hashtable) : 0;
+}
+
+arg_cmd_itr_t arg_cmd_itr_create(void) {
+    return (arg_cmd_itr_t)arg_hashtable_itr_create(s_hashtable);
+}
+
+int arg_cmd_itr_advance(arg_cmd_itr_t itr) {
+    return arg_hashtable_itr_advance((arg_hashtable_itr_t*)itr);
+}
+
+char* arg_cmd_itr_key(arg_cmd_itr_t itr) {
+    return (char*)arg_hashtable_itr_key((arg_hashtable_itr_t*)itr);
+}
+
+arg_cmd_info_t* arg_cmd_itr_value(arg_cmd_itr_t itr) {
+    return (arg_cmd_info_t*)arg_hashtable_itr_value((arg_hashtable_itr_t*)itr);
+}
+
+void arg_cmd_itr_destroy(arg_cmd_itr_t itr) {
+    arg_hashtable_itr_destroy((arg_hashtable_itr_t*)itr);
+}
+
+int arg_cmd_itr_search(arg_cmd_itr_t itr, void* k) {
+    return arg_hashtable_itr_search((arg_hashtable_itr_t*)itr, s_hashtable, k);
+}
+
+static const char* module_name(void) {
+    if (s_module_name == NULL || strlen(s_module_name) == 0)
+        return "<name>";
+
+    return s_module_name;
+}
+
+static const char* module_version(void) {
+    if (s_mod_ver == NULL || strlen(s_mod_ver) == 0)
+        return "0.0.0.0";
+
+    return s_mod_ver;
+}
+
+void arg_make_get_help_msg(arg_dstr_t res) {
+    arg_dstr_catf(res, "%s v%s\n", module_name(), module_version());
+    arg_dstr_catf(res, "Please type '%s help' to get more information.\n", module_name());
+}
+
+void arg_make_help_msg(arg_dstr_t ds, const char* cmd_name, void** argtable) {
+    arg_cmd_info_t* cmd_info = (arg_cmd_info_t*)arg_hashtable_search(s_hashtable, cmd_name);
+    if (cmd_info) {
+        arg_dstr_catf(ds, "%s: %s\n", cmd_name, cmd_info->description);
+    }
+
+    arg_dstr_cat(ds, "Usage:\n");
+    arg_dstr_catf(ds, "  %s", module_name());
+
+    arg_print_syntaxv_ds(ds, argtable, "\n \nAvailable options:\n");
+    arg_print_glossary_ds(ds, argtable, "  %-23s %s\n");
+
+    arg_dstr_cat(ds, "\n");
+}
+
+void arg_make_syntax_err_msg(arg_dstr_t ds, void** argtable, struct arg_end* end) {
+    arg_print_errors_ds(ds, end, module_name());
+    arg_dstr_cat(ds, "Usage: \n");
+    arg_dstr_catf(ds, "  %s", module_name());
+    arg_print_syntaxv_ds(ds, argtable, "\n");
+    arg_dstr_cat(ds, "\n");
+}
+
+int arg_make_syntax_err_help_msg(arg_dstr_t ds, const char* name, int help, int nerrors, void** argtable, struct arg_end* end, int* exitcode) {
+    /* help handling
+     * note: '-h|--help' takes precedence over error reporting
+     */
+    if (help > 0) {
+        arg_make_help_msg(ds, name, argtable);
+        *exitcode = EXIT_SUCCESS;
+        return 1;
+    }
+
+    /* syntax error handling */
+    if (nerrors > 0) {
+        arg_make_syntax_err_msg(ds, argtable, end);
+        *exitcode = EXIT_FAILURE;
+        return 1;
+    }
+
+    return 0;
+}
+/*******************************************************************************
+ * arg_complete: Generates static shell completion scripts
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The generators below only look at the static parts of an argtable: the
+ * option names, the ARG_HASVALUE/ARG_HASOPTVALUE/ARG_HASFILEVALUE flags and
+ * the glossary text. Untagged entries (no short or long options) are
+ * positional arguments; entries without a scanfn, such as arg_rem, are
+ * ignored. Registered sub-commands are completed as the first positional
+ * word, in name order so that the generated script is reproducible.
+ */
+
+struct arg_complete_ctx {
+    struct arg_hdr** table;
+    arg_cmd_info_t** cmds;
+    unsigned int ncmds;
+    int posfile; /* positional words name files */
+    const char* progname;
+    char* fname; /* progname mangled into a shell function name */
+};
+
+static int arg_complete_isopt(const struct arg_hdr* hdr) {
+    return (hdr->shortopts && *hdr->shortopts) || (hdr->longopts && *hdr->longopts);
+}
+
+/* Returns the length of the long option name starting at p */
+static size_t arg_complete_optlen(const char* p) {
+    const char* q = strchr(p, ',');
+    return q ? (size_t)(q - p) : strlen(p);
+}
+
+/*
+ * Appends len bytes of src for use inside a single-quoted word. Quotes are
+ * written as '\'' unless bsquote is set, in which case quotes and backslashes
+ * are backslash-escaped as fish requires. Characters listed in special are
+ * always prefixed with a backslash, and control characters become spaces so
+ * that a multi-line glossary cannot break the script.
+ */
+static void arg_complete_catq(arg_dstr_t ds, const char* src, size_t len, int bsquote, const char* special) {
+    size_t i;
+
+    for (i = 0; i < len && src[i]; i++) {
+        char c = src[i];
+        if ((unsigned char)c < 0x20 || c == 0x7f) {
+            arg_dstr_catc(ds, ' ');
+        } else if ((bsquote && (c == '\\' || c == '\'')) || (special && strchr(special, c))) {
+            arg_dstr_catc(ds, '\\');
+            arg_dstr_catc(ds, c);
+        } else if (c == '\'') {
+            arg_dstr_cat(ds, "'\\''");
+        } else {
+            arg_dstr_catc(ds, c);
+        }
+    }
+}
+
+static int arg_complete_cmdcmp(const void* a, const void* b) {
+    const arg_cmd_info_t* x = *(arg_cmd_info_t* const*)a;
+    const arg_cmd_info_t* y = *(arg_cmd_info_t* const*)b;
+    return strcmp(x->name, y->name);
+}
+
+static void arg_complete_init(struct arg_complete_ctx* ctx, void** argtable, const char* progname) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    size_t i;
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->table = table;
+    ctx->progname = progname;
+
+    if (table) {
+        int tabindex;
+        for (tabindex = 0; !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+            if (table[tabindex]->scanfn && !arg_complete_isopt(table[tabindex]) && (table[tabindex]->flag & ARG_HASFILEVALUE))
+                ctx->posfile = 1;
+        }
+    }
+
+    ctx->ncmds = arg_cmd_count();
+    if (ctx->ncmds > 0) {
+        arg_cmd_itr_t itr = arg_cmd_itr_create();
+        unsigned int n = 0;
+
+        ctx->cmds = (arg_cmd_info_t**)xmalloc(sizeof(arg_cmd_info_t*) * ctx->ncmds);
+        do {
+            ctx->cmds[n++] = arg_cmd_itr_value(itr);
+        } while (n < ctx->ncmds && arg_cmd_itr_advance(itr));
+        arg_cmd_itr_destroy(itr);
+        ctx->ncmds = n;
+        qsort(ctx->cmds, ctx->ncmds, sizeof(arg_cmd_info_t*), arg_complete_cmdcmp);
+    }
+
+    ctx->fname = (char*)xmalloc(strlen(progname) + 2);
+    ctx->fname[0] = '_';
+    for (i = 0; progname[i]; i++) {
+        char c = progname[i];
+        int alnum = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+        ctx->fname[i + 1] = alnum ? c : '_';
+    }
+    ctx->fname[i + 1] = '\0';
+}
+
+static void arg_complete_free(struct arg_complete_ctx* ctx) {
+    xfree(ctx->cmds);
+    xfree(ctx->fname);
+}
+
+/* Appends the option names of hdr as a bash case pattern, eg -o|--output */
+static void arg_complete_bash_pattern(arg_dstr_t ds, const struct arg_hdr* hdr) {
+    const char* p;
+    int first = 1;
+
+    for (p = hdr->shortopts; p && *p; p++) {
+        arg_dstr_cat(ds, first ? "" : "|");
+        arg_dstr_catc(ds, '-');
+        arg_complete_catq(ds, p, 1, 0, "|*?[]()$`'\"\\ ");
+        first = 0;
+    }
+    for (p = hdr->longopts; p && *p;) {
+        size_t len = arg_complete_optlen(p);
+        arg_dstr_cat(ds, first ? "--" : "|--");
+        arg_complete_catq(ds, p, len, 0, "|*?[]()$`'\"\\ ");
+        first = 0;
+        p += len;
+        if (*p == ',')
+            p++;
+    }
+}
+
+static void arg_complete_bash_files(arg_dstr_t ds, const char* indent) {
+    arg_dstr_catf(ds, "%slocal IFS=$'\\n'\n", indent);
+    arg_dstr_catf(ds, "%scompopt -o filenames 2>/dev/null\n", indent);
+    arg_dstr_catf(ds, "%sCOMPREPLY=( $(compgen -f -- \"$cur\") )\n", indent);
+}
+
+static void arg_complete_bash(arg_dstr_t ds, struct arg_complete_ctx* ctx) {
+    struct arg_hdr** table = ctx->table;
+    int tabindex;
+    unsigned int i;
+
+    arg_dstr_catf(ds, "# bash completion for %s\n", ctx->progname);
+    arg_dstr_cat(ds, "# generated by argtable3; do not edit\n\n");
+    arg_dstr_catf(ds, "%s()\n{\n", ctx->fname);
+    arg_dstr_cat(ds, "    local cur prev eq= cmd= i\n");
+    arg_dstr_cat(ds, "    COMPREPLY=()\n");
+    arg_dstr_cat(ds, "    cur=\"${COMP_WORDS[COMP_CWORD]}\"\n");
+    arg_dstr_cat(ds, "    prev=\"${COMP_WORDS[COMP_CWORD-1]}\"\n");
+    arg_dstr_cat(ds, "    if [ \"$cur\" = \"=\" ]; then\n");
+    arg_dstr_cat(ds, "        cur=\n");
+    arg_dstr_cat(ds, "        eq=1\n");
+    arg_dstr_cat(ds, "    elif [ \"$prev\" = \"=\" ] && [ \"$COMP_CWORD\" -gt 1 ]; then\n");
+    arg_dstr_cat(ds, "        prev=\"${COMP_WORDS[COMP_CWORD-2]}\"\n");
+    arg_dstr_cat(ds, "        eq=1\n");
+    arg_dstr_cat(ds, "    fi\n\n");
+
+    /* values of options */
+    arg_dstr_cat(ds, "    case \"$prev\" in\n");
+    for (tabindex = 0; table && !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        struct arg_hdr* hdr = table[tabindex];
+        const char* indent = "            ";
+
+        if (!hdr->scanfn || !arg_complete_isopt(hdr) || !(hdr->flag & (ARG_HASVALUE | ARG_HASOPTVALUE)))
+            continue;
+
+        arg_dstr_cat(ds, "        ");
+        arg_complete_bash_pattern(ds, hdr);
+        arg_dstr_cat(ds, ")\n");
+        if (hdr->flag & ARG_HASOPTVALUE) {
+            /* an optional value must be attached with '=' */
+            arg_dstr_cat(ds, "            if [ -n \"$eq\" ]; then\n");
+            indent = "                ";
+        }
+        if (hdr->flag & ARG_HASFILEVALUE)
+            arg_complete_bash_files(ds, indent);
+        arg_dstr_catf(ds, "%sreturn 0\n", indent);
+        if (hdr->flag & ARG_HASOPTVALUE)
+            arg_dstr_cat(ds, "            fi\n");
+        arg_dstr_cat(ds, "            ;;\n");
+    }
+    arg_dstr_cat(ds, "    esac\n\n");
+
+    /* option names */
+    arg_dstr_cat(ds, "    case \"$cur\" in\n");
+    arg_dstr_cat(ds, "        -*)\n");
+    arg_dstr_cat(ds, "            COMPREPLY=( $(compgen -W '");
+    for (tabindex = 0; table && !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        struct arg_hdr* hdr = table[tabindex];
+        const char* p;
+
+        if (!hdr->scanfn)
+            continue;
+        for (p = hdr->shortopts; p && *p; p++) {
+            arg_dstr_cat(ds, " -");
+            arg_complete_catq(ds, p, 1, 0, NULL);
+        }
+        for (p = hdr->longopts; p && *p;) {
+            size_t len = arg_complete_optlen(p);
+            arg_dstr_cat(ds, " --");
+            arg_complete_catq(ds, p, len, 0, NULL);
+            p += len;
+            if (*p == ',')
+                p++;
+        }
+    }
+    arg_dstr_cat(ds, "' -- \"$cur\") )\n");
+    arg_dstr_cat(ds, "            return 0\n");
+    arg_dstr_cat(ds, "            ;;\n");
+    arg_dstr_cat(ds, "    esac\n");
+
+    /* sub-command names */
+    if (ctx->ncmds > 0) {
+        arg_dstr_cat(ds, "\n    for ((i = 1; i < COMP_CWORD; i++)); do\n");
+        arg_dstr_cat(ds, "        case \"${COMP_WORDS[i]}\" in\n");
+        arg_dstr_cat(ds, "            ");
+        for (i = 0; i < ctx->ncmds; i++) {
+            arg_dstr_cat(ds, i == 0 ? "" : "|");
+            arg_complete_catq(ds, ctx->cmds[i]->name, strlen(ctx->cmds[i]->name), 0, "|*?[]()$`'\"\\ ");
+        }
+        arg_dstr_cat(ds, ")\n");
+        arg_dstr_cat(ds, "                cmd=\"${COMP_WORDS[i]}\"\n");
+        arg_dstr_cat(ds, "                break\n");
+        arg_dstr_cat(ds, "                ;;\n");
+        arg_dstr_cat(ds, "        esac\n");
+        arg_dstr_cat(ds, "    done\n");
+        arg_dstr_cat(ds, "    if [ -z \"$cmd\" ]; then\n");
+        arg_dstr_cat(ds, "        COMPREPLY=( $(compgen -W '");
+        for (i = 0; i < ctx->ncmds; i++) {
+            arg_dstr_catc(ds, ' ');
+            arg_complete_catq(ds, ctx->cmds[i]->name, strlen(ctx->cmds[i]->name), 0, NULL);
+        }
+        arg_dstr_cat(ds, "' -- \"$cur\") )\n");
+        arg_dstr_cat(ds, "        return 0\n");
+        arg_dstr_cat(ds, "    fi\n");
+    }
+
+    /* positional arguments */
+    if (ctx->posfile || ctx->ncmds > 0) {
+        arg_dstr_cat(ds, "\n");
+        arg_complete_bash_files(ds, "    ");
+    }
+    arg_dstr_cat(ds, "}\n\n");
+
+    arg_dstr_catf(ds, "complete -F %s '", ctx->fname);
+    arg_complete_catq(ds, ctx->progname, strlen(ctx->progname), 0, NULL);
+    arg_dstr_cat(ds, "'\n");
+}
+
+/* Appends one _arguments spec for the option name in opt[0..len) */
+static void arg_complete_zsh_spec(arg_dstr_t ds, const struct arg_hdr* hdr, const char* prefix, const char* opt, size_t len) {
+    int longopt = prefix[1] == '-';
+
+    arg_dstr_catf(ds, " \\\n        '%s%s", hdr->maxcount > 1 ? "*" : "", prefix);
+    arg_complete_catq(ds, opt, len, 0, NULL);
+    if (hdr->flag & ARG_HASOPTVALUE)
+        arg_dstr_cat(ds, longopt ? "=-" : "-");
+    else if (hdr->flag & ARG_HASVALUE)
+        arg_dstr_cat(ds, longopt ? "=" : "+");
+
+    if (hdr->glossary) {
+        arg_dstr_catc(ds, '[');
+        arg_complete_catq(ds, hdr->glossary, strlen(hdr->glossary), 0, "[]\\");
+        arg_dstr_catc(ds, ']');
+    }
+
+    if (hdr->flag & (ARG_HASVALUE | ARG_HASOPTVALUE)) {
+        const char* datatype = hdr->datatype ? hdr->datatype : "value";
+        arg_dstr_catc(ds, ':');
+        arg_complete_catq(ds, datatype, strlen(datatype), 0, ":\\");
+        arg_dstr_cat(ds, (hdr->flag & ARG_HASFILEVALUE) ? ":_files" : ": ");
+    }
+    arg_dstr_catc(ds, '\'');
+}
+
+static void arg_complete_zsh(arg_dstr_t ds, struct arg_complete_ctx* ctx) {
+    struct arg_hdr** table = ctx->table;
+    int tabindex;
+    unsigned int i;
+
+    arg_dstr_catf(ds, "#compdef %s\n", ctx->progname);
+    arg_dstr_cat(ds, "# zsh completion; generated by argtable3; do not edit\n\n");
+
+    if (ctx->ncmds > 0) {
+        arg_dstr_catf(ds, "%s_commands() {\n", ctx->fname);
+        arg_dstr_cat(ds, "    local -a commands\n");
+        arg_dstr_cat(ds, "    commands=(\n");
+        for (i = 0; i < ctx->ncmds; i++) {
+            arg_dstr_cat(ds, "        '");
+            arg_complete_catq(ds, ctx->cmds[i]->name, strlen(ctx->cmds[i]->name), 0, ":\\");
+            arg_dstr_catc(ds, ':');
+            arg_complete_catq(ds, ctx->cmds[i]->description, strlen(ctx->cmds[i]->description), 0, NULL);
+            arg_dstr_cat(ds, "'\n");
+        }
+        arg_dstr_cat(ds, "    )\n");
+        arg_dstr_cat(ds, "    _describe -t commands command commands\n");
+        arg_dstr_cat(ds, "}\n\n");
+    }
+
+    arg_dstr_catf(ds, "%s() {\n", ctx->fname);
+    arg_dstr_cat(ds, "    _arguments -s -S");
+    for (tabindex = 0; table && !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        struct arg_hdr* hdr = table[tabindex];
+        const char* p;
+
+        if (!hdr->scanfn || !arg_complete_isopt(hdr))
+            continue;
+        for (p = hdr->shortopts; p && *p; p++)
+            arg_complete_zsh_spec(ds, hdr, "-", p, 1);
+        for (p = hdr->longopts; p && *p;) {
+            size_t len = arg_complete_optlen(p);
+            arg_complete_zsh_spec(ds, hdr, "--", p, len);
+            p += len;
+            if (*p == ',')
+                p++;
+        }
+    }
+    if (ctx->ncmds > 0) {
+        arg_dstr_catf(ds, " \\\n        '1: :%s_commands'", ctx->fname);
+        arg_dstr_cat(ds, " \\\n        '*:: :_files'");
+    } else if (ctx->posfile) {
+        arg_dstr_cat(ds, " \\\n        '*:file:_files'");
+    }
+    arg_dstr_cat(ds, "\n}\n\n");
+
+    arg_dstr_catf(ds, "if [ \"$funcstack[1]\" = \"%s\" ]; then\n", ctx->fname);
+    arg_dstr_catf(ds, "    %s \"$@\"\n", ctx->fname);
+    arg_dstr_cat(ds, "else\n");
+    arg_dstr_catf(ds, "    compdef %s '", ctx->fname);
+    arg_complete_catq(ds, ctx->progname, strlen(ctx->progname), 0, NULL);
+    arg_dstr_cat(ds, "'\n");
+    arg_dstr_cat(ds, "fi\n");
+}
+
+static void arg_complete_fish_cmd(arg_dstr_t ds, struct arg_complete_ctx* ctx) {
+    arg_dstr_cat(ds, "complete -c '");
+    arg_complete_catq(ds, ctx->progname, strlen(ctx->progname), 1, NULL);
+    arg_dstr_catc(ds, '\'');
+}
+
+static void arg_complete_fish(arg_dstr_t ds, struct arg_complete_ctx* ctx) {
+    struct arg_hdr** table = ctx->table;
+    int tabindex;
+    unsigned int i;
+
+    arg_dstr_catf(ds, "# fish completion for %s\n", ctx->progname);
+    arg_dstr_cat(ds, "# generated by argtable3; do not edit\n\n");
+
+    /* positional arguments */
+    if (ctx->ncmds > 0) {
+        arg_complete_fish_cmd(ds, ctx);
+        arg_dstr_cat(ds, " -n __fish_use_subcommand -f\n");
+        for (i = 0; i < ctx->ncmds; i++) {
+            arg_complete_fish_cmd(ds, ctx);
+            arg_dstr_cat(ds, " -n __fish_use_subcommand -a '");
+            arg_complete_catq(ds, ctx->cmds[i]->name, strlen(ctx->cmds[i]->name), 1, NULL);
+            arg_dstr_cat(ds, "' -d '");
+            arg_complete_catq(ds, ctx->cmds[i]->description, strlen(ctx->cmds[i]->description), 1, NULL);
+            arg_dstr_cat(ds, "'\n");
+        }
+    } else if (!ctx->posfile) {
+        arg_complete_fish_cmd(ds, ctx);
+        arg_dstr_cat(ds, " -f\n");
+    }
+
+    for (tabindex = 0; table && !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        struct arg_hdr* hdr = table[tabindex];
+        const char* p;
+
+        if (!hdr->scanfn || !arg_complete_isopt(hdr))
+            continue;
+
+        arg_complete_fish_cmd(ds, ctx);
+        for (p = hdr->shortopts; p && *p; p++) {
+            arg_dstr_cat(ds, " -s '");
+            arg_complete_catq(ds, p, 1, 1, NULL);
+            arg_dstr_catc(ds, '\'');
+        }
+        for (p = hdr->longopts; p && *p;) {
+            size_t len = arg_complete_optlen(p);
+            arg_dstr_cat(ds, " -l '");
+            arg_complete_catq(ds, p, len, 1, NULL);
+            arg_dstr_catc(ds, '\'');
+            p += len;
+            if (*p == ',')
+                p++;
+        }
+        if (hdr->flag & ARG_HASVALUE)
+            arg_dstr_cat(ds, (hdr->flag & ARG_HASFILEVALUE) ? " -r -F" : " -x");
+        else if (hdr->flag & ARG_HASOPTVALUE)
+            arg_dstr_cat(ds, (hdr->flag & ARG_HASFILEVALUE) ? " -F" : " -f");
+        if (hdr->glossary) {
+            arg_dstr_cat(ds, " -d '");
+            arg_complete_catq(ds, hdr->glossary, strlen(hdr->glossary), 1, NULL);
+            arg_dstr_catc(ds, '\'');
+        }
+        arg_dstr_catc(ds, '\n');
+    }
+}
+
+void arg_print_completion_ds(arg_dstr_t ds, void** argtable, const char* progname, int shell) {
+    struct arg_complete_ctx ctx;
+
+    arg_complete_init(&ctx, argtable, progname);
+    switch (shell) {
+        case ARG_SHELL_BASH:
+            arg_complete_bash(ds, &ctx);
+            break;
+        case ARG_SHELL_ZSH:
+            arg_complete_zsh(ds, &ctx);
+            break;
+        case ARG_SHELL_FISH:
+            arg_complete_fish(ds, &ctx);
+            break;
+        default:
+            break;
+    }
+    arg_complete_free(&ctx);
+}
+
+void arg_print_completion(FILE* fp, void** argtable, const char* progname, int shell) {
+    arg_dstr_t ds = arg_dstr_create();
+    arg_print_completion_ds(ds, argtable, progname, shell);
+    fputs(arg_dstr_cstr(ds), fp);
+    arg_dstr_destroy(ds);
+}
+/*******************************************************************************
+ * argtable3: Implements the main interfaces of the library
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 1998-2001,2003-2011,2013 Stewart Heitmann
+ * <sheitmann@users.sourceforge.net>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#if ARG_REPLACE_GETOPT == 1
+#include "arg_getopt.h"
+#else
+#include <getopt.h>
+#endif
+#else
+#if ARG_REPLACE_GETOPT == 0
+#include <getopt.h>
+#endif
+#endif
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#undef WIN32_LEAN_AND_MEAN
+#endif
+
+#include <assert.h>
+#include <ctype.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+void arg_register_error(struct arg_end* end, void* parent, int error, const char* argval) {
+    /* printf("arg_register_error(%p,%p,%d,%s)\n",end,parent,error,argval); */
+    if (end->count < end->hdr.maxcount) {
+        end->error[end->count] = error;
+        end->parent[end->count] = parent;
+        end->argval[end->count] = argval;
+        end->count++;
+    } else {
+        end->error[end->hdr.maxcount - 1] = ARG_ELIMIT;
+        end->parent[end->hdr.maxcount - 1] = end;
+        end->argval[end->hdr.maxcount - 1] = NULL;
+    }
+}
+
+/*
+ * Return index of first table entry with a matching short option
+ * or -1 if no match was found.
+ */
+static int find_shortoption(struct arg_hdr** table, char shortopt) {
+    int tabindex;
+    for (tabindex = 0; !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        if (table[tabindex]->shortopts && strchr(table[tabindex]->shortopts, shortopt))
+            return tabindex;
+    }
+    return -1;
+}
+
+struct longoptions {
+    int getoptval;
+    int noptions;
+    struct option* options;
+};
+
+#if 0
+static
+void dump_longoptions(struct longoptions * longoptions)
+{
+    int i;
+    printf("getoptval = %d\n", longoptions->getoptval);
+    printf("noptions  = %d\n", longoptions->noptions);
+    for (i = 0; i < longoptions->noptions; i++)
+    {
+        printf("options[%d].name    = \"%s\"\n",
+               i,
+               longoptions->options[i].name);
+        printf("options[%d].has_arg = %d\n", i, longoptions->options[i].has_arg);
+        printf("options[%d].flag    = %p\n", i, longoptions->options[i].flag);
+        printf("options[%d].val     = %d\n", i, longoptions->options[i].val);
+    }
+}
+#endif
+
+static struct longoptions* alloc_longoptions(struct arg_hdr** table) {
+    struct longoptions* result;
+    size_t nbytes;
+    int noptions = 1;
+    size_t longoptlen = 0;
+    int tabindex;
+    int option_index = 0;
+    char* store;
+
+    /*
+     * Determine the total number of option structs required
+     * by counting the number of comma separated long options
+     * in all table entries and return the count in noptions.
+     * note: noptions starts at 1 not 0 because we getoptlong
+     * requires a NULL option entry to terminate the option array.
+     * While we are at it, count the number of chars required
+     * to store private copies of all the longoption strings
+     * and return that count in logoptlen.
+     */
+    tabindex = 0;
+    do {
+        const char* longopts = table[tabindex]->longopts;
+        longoptlen += (longopts ? strlen(longopts) : 0) + 1;
+        while (longopts) {
+            noptions++;
+            longopts = strchr(longopts + 1, ',');
+        }
+    } while (!(table[tabindex++]->flag & ARG_TERMINATOR));
+    /*printf("%d long options consuming %d chars in total\n",noptions,longoptlen);*/
+
+    /* allocate storage for return data structure as: */
+    /* (struct longoptions) + (struct options)[noptions] + char[longoptlen] */
+    nbytes = sizeof(struct longoptions) + sizeof(struct option) * (size_t)noptions + longoptlen;
+    result = (struct longoptions*)xmalloc(nbytes);
+
+    result->getoptval = 0;
+    result->noptions = noptions;
+    result->options = (struct option*)(result + 1);
+    store = (char*)(result->options + noptions);
+
+    for (tabindex = 0; !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        const char* longopts = table[tabindex]->longopts;
+
+        while (longopts && *longopts) {
+            char* storestart = store;
+
+            /* copy progressive longopt strings into the store */
+            while (*longopts != 0 && *longopts != ',')
+                *store++ = *longopts++;
+            *store++ = 0;
+            if (*longopts == ',')
+                longopts++;
+            /*fprintf(stderr,"storestart=\"%s\"\n",storestart);*/
+
+            result->options[option_index].name = storestart;
+            result->options[option_index].flag = &(result->getoptval);
+            result->options[option_index].val = tabindex;
+            if (table[tabindex]->flag & ARG_HASOPTVALUE)
+                result->options[option_index].has_arg = 2;
+            else if (table[tabindex]->flag & ARG_HASVALUE)
+                result->options[option_index].has_arg = 1;
+            else
+                result->options[option_index].has_arg = 0;
+
+            option_index++;
+        }
+    }
+    /* terminate the options array with a zero-filled entry */
+    result->options[option_index].name = 0;
+    result->options[option_index].has_arg = 0;
+    result->options[option_index].flag = 0;
+    result->options[option_index].val = 0;
+
+    /*dump_longoptions(result);*/
+    return result;
+}
+
+static char* alloc_shortoptions(struct arg_hdr** table) {
+    char* result;
+    size_t len = 2;
+    int tabindex;
+    char* res;
+
+    /* determine the total number of option chars required */
+    for (tabindex = 0; !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        struct arg_hdr* hdr = table[tabindex];
+        len += 3 * (hdr->shortopts ? strlen(hdr->shortopts) : 0);
+    }
+
+    result = xmalloc(len);
+
+    res = result;
+
+    /* add a leading ':' so getopt return codes distinguish    */
+    /* unrecognised option and options missing argument values */
+    *res++ = ':';
+
+    for (tabindex = 0; !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        struct arg_hdr* hdr = table[tabindex];
+        const char* shortopts = hdr->shortopts;
+        while (shortopts && *shortopts) {
+            *res++ = *shortopts++;
+            if (hdr->flag & ARG_HASVALUE)
+                *res++ = ':';
+            if (hdr->flag & ARG_HASOPTVALUE)
+                *res++ = ':';
+        }
+    }
+    /* null terminate the string */
+    *res = 0;
+
+    /*printf("alloc_shortoptions() returns \"%s\"\n",(result?result:"NULL"));*/
+    return result;
+}
+
+#if ARG_REPLACE_GETOPT == 0
+/*
+ * The getopt of the C library keeps its state in the getopt(3) external
+ * variables, so this shim copies them to and from a struct arg_getopt around
+ * each call, and arg_parse() holds the global lock while it scans.
+ */
+struct arg_getopt {
+    int ind;
+    int err;
+    int opt;
+    char* arg;
+};
+
+static void arg_getopt_init(struct arg_getopt* st) {
+    st->ind = 0;
+    st->err = 1;
+    st->opt = '?';
+    st->arg = NULL;
+}
+#endif
+
+/* fetch the next option with getopt_long, or getopt_long_only for ARG_LONG_ONLY */
+static int arg_getopt_next(struct arg_getopt* st, int argc, char** argv, const char* shortoptions, const struct option* longoptions) {
+#if ARG_REPLACE_GETOPT == 1
+#ifdef ARG_LONG_ONLY
+    return arg_getopt_long_only(st, argc, argv, shortoptions, longoptions, NULL);
+#else
+    return arg_getopt_long(st, argc, argv, shortoptions, longoptions, NULL);
+#endif
+#else
+    int copt;
+
+    optind = st->ind;
+    opterr = st->err;
+#ifdef ARG_LONG_ONLY
+    copt = getopt_long_only(argc, argv, shortoptions, longoptions, NULL);
+#else
+    copt = getopt_long(argc, argv, shortoptions, longoptions, NULL);
+#endif
+    st->ind = optind;
+    st->opt = optopt;
+    st->arg = optarg;
+    return copt;
+#endif
+}
+
+/* return index of the table terminator entry */
+static int arg_endindex(struct arg_hdr** table) {
+    int tabindex = 0;
+    while (!(table[tabindex]->flag & ARG_TERMINATOR))
+        tabindex++;
+    return tabindex;
+}
+
+/*
+ * Options found by the tagged pass of an incremental parse, in command line
+ * order, which are recorded instead of scanned
+ */
+struct arg_events {
+    int* tabindex; /* entry of each option, or -1 for the next error registered in the end table */
+    const char** optarg;
+    int count;
+    int maxcount;
+};
+
+static void arg_event(struct arg_events* events, int tabindex, const char* optarg) {
+    if (!events)
+        return;
+    if (events->count == events->maxcount) {
+        events->maxcount = events->maxcount ? events->maxcount * 2 : 16;
+        events->tabindex = (int*)xrealloc(events->tabindex, sizeof(int) * (size_t)events->maxcount);
+        events->optarg = (const char**)xrealloc((void*)events->optarg, sizeof(char*) * (size_t)events->maxcount);
+    }
+    events->tabindex[events->count] = tabindex;
+    events->optarg[events->count] = optarg;
+    events->count++;
+}
+
+/*
+ * Parses the tagged options, and returns the index in argv[] of the first untagged argument.
+ * If events is not NULL, the options are recorded there rather than scanned.
+ */
+static int arg_parse_tagged(int argc, char** argv, struct arg_hdr** table, struct arg_end* endtable, arg_bits_t* given, struct arg_events* events) {
+    struct longoptions* longoptions;
+    char* shortoptions;
+    struct arg_getopt st;
+    int copt;
+
+    /*printf("arg_parse_tagged(%d,%p,%p,%p)\n",argc,argv,table,endtable);*/
+
+    /* allocate short and long option arrays for the given opttable[].   */
+    /* if the allocs fail then put an error msg in the last table entry. */
+    longoptions = alloc_longoptions(table);
+    shortoptions = alloc_shortoptions(table);
+
+    /*dump_longoptions(longoptions);*/
+
+    /* start getopt at the beginning of argv[], and disable error reporting */
+    arg_getopt_init(&st);
+    st.err = 0;
+
+    /* fetch and process args using getopt_long */
+    while ((copt = arg_getopt_next(&st, argc, argv, shortoptions, longoptions->options)) != -1) {
+        /*
+           printf("optarg='%s'\n",st.arg);
+           printf("optind=%d\n",st.ind);
+           printf("copt=%c\n",(char)copt);
+           printf("optopt=%c (%d)\n",st.opt, (int)(st.opt));
+         */
+        switch (copt) {
+            case 0: {
+                int tabindex = longoptions->getoptval;
+                void* parent = table[tabindex]->parent;
+                /*printf("long option detected from argtable[%d]\n", tabindex);*/
+                if (st.arg && st.arg[0] == 0 && (table[tabindex]->flag & ARG_HASVALUE)) {
+                    /* printf(": long option %s requires an argument\n",argv[st.ind-1]); */
+                    arg_register_error(endtable, endtable, ARG_EMISSARG, argv[st.ind - 1]);
+                    arg_event(events, -1, NULL);
+                    /* continue to scan the (empty) argument value to enforce argument count checking */
+                }
+                if (events) {
+                    arg_event(events, tabindex, st.arg);
+                } else if (table[tabindex]->scanfn) {
+                    int errorcode = table[tabindex]->scanfn(parent, st.arg);
+                    if (errorcode != 0)
+                        arg_register_error(endtable, parent, errorcode, st.arg);
+                }
+                if (given)
+                    ARG_BITS_SET(given, tabindex);
+            } break;
+
+            case '?':
+                /*
+                 * getopt_long() found an unrecognised short option.
+                 * if it was a short option its value is in st.opt
+                 * if it was a long option then st.opt=0
+                 */
+                switch (st.opt) {
+                    case 0:
+                        /*printf("?0 unrecognised long option %s\n",argv[st.ind-1]);*/
+                        arg_register_error(endtable, endtable, ARG_ELONGOPT, argv[st.ind - 1]);
+                        arg_event(events, -1, NULL);
+                        break;
+                    default:
+                        /*printf("?* unrecognised short option '%c'\n",st.opt);*/
+                        arg_register_error(endtable, endtable, st.opt, NULL);
+                        arg_event(events, -1, NULL);
+                        break;
+                }
+                break;
+
+            case ':':
+                /*
+                 * getopt_long() found an option with its argument missing.
+                 */
+                /*printf(": option %s requires an argument\n",argv[st.ind-1]); */
+                arg_register_error(endtable, endtable, ARG_EMISSARG, argv[st.ind - 1]);
+                arg_event(events, -1, NULL);
+                break;
+
+            default: {
+                /* getopt_long() found a valid short option */
+                int tabindex = find_shortoption(table, (char)copt);
+                /*printf("short option detected from argtable[%d]\n", tabindex);*/
+                if (tabindex == -1) {
+                    /* should never get here - but handle it just in case */
+                    /*printf("unrecognised short option %d\n",copt);*/
+                    arg_register_error(endtable, endtable, copt, NULL);
+                    arg_event(events, -1, NULL);
+                } else if (events) {
+                    arg_event(events, tabindex, st.arg);
+                } else {
+                    if (table[tabindex]->scanfn) {
+                        void* parent = table[tabindex]->parent;
+                        int errorcode = table[tabindex]->scanfn(parent, st.arg);
+                        if (errorcode != 0)
+                            arg_register_error(endtable, parent, errorcode, st.arg);
+                    }
+                    if (given)
+                        ARG_BITS_SET(given, tabindex);
+                }
+                break;
+            }
+        }
+    }
+
+    xfree(shortoptions);
+    xfree(longoptions);
+    return st.ind;
+}
+
+/* Parses the untagged arguments, from argv[argi] on, marking the entries that take one in given if it is not NULL */
+static void arg_parse_untagged(int argc, char** argv, int argi, struct arg_hdr** table, struct arg_end* endtable, arg_bits_t* given) {
+    int tabindex = 0;
+    int errorlast = 0;
+    const char* optarglast = NULL;
+    void* parentlast = NULL;
+
+    /*printf("arg_parse_untagged(%d,%p,%p,%p)\n",argc,argv,table,endtable);*/
+    while (!(table[tabindex]->flag & ARG_TERMINATOR)) {
+        void* parent;
+        int errorcode;
+
+        /* if we have exhausted our argv[argi] entries then we have finished */
+        if (argi >= argc) {
+            /*printf("arg_parse_untagged(): argv[] exhausted\n");*/
+            return;
+        }
+
+        /* skip table entries with non-null long or short options (they are not untagged entries) */
+        if (table[tabindex]->longopts || table[tabindex]->shortopts) {
+            /*printf("arg_parse_untagged(): skipping argtable[%d] (tagged argument)\n",tabindex);*/
+            tabindex++;
+            continue;
+        }
+
+        /* skip table entries with NULL scanfn */
+        if (!(table[tabindex]->scanfn)) {
+            /*printf("arg_parse_untagged(): skipping argtable[%d] (NULL scanfn)\n",tabindex);*/
+            tabindex++;
+            continue;
+        }
+
+        /* attempt to scan the current argv[argi] with the current     */
+        /* table[tabindex] entry. If it succeeds then keep it, otherwise */
+        /* try again with the next table[] entry.                        */
+        parent = table[tabindex]->parent;
+        errorcode = table[tabindex]->scanfn(parent, argv[argi]);
+        if (errorcode == 0) {
+            /* success, move onto next argv[argi] but stay with same table[tabindex] */
+            /*printf("arg_parse_untagged(): argtable[%d] successfully matched\n",tabindex);*/
+            argi++;
+            if (given)
+                ARG_BITS_SET(given, tabindex);
+
+            /* clear the last tentative error */
+            errorlast = 0;
+        } else {
+            /* failure, try same argv[argi] with next table[tabindex] entry */
+            /*printf("arg_parse_untagged(): argtable[%d] failed match\n",tabindex);*/
+            tabindex++;
+
+            /* remember this as a tentative error we may wish to reinstate later */
+            errorlast = errorcode;
+            optarglast = argv[argi];
+            parentlast = parent;
+        }
+    }
+
+    /* if a tenative error still remains at this point then register it as a proper error */
+    if (errorlast) {
+        arg_register_error(endtable, parentlast, errorlast, optarglast);
+        argi++;
+    }
+
+    /* only get here when not all argv[] entries were consumed */
+    /* register an error for each unused argv[] entry */
+    while (argi < argc) {
+        /*printf("arg_parse_untagged(): argv[%d]=\"%s\" not consumed\n",argi,argv[argi]);*/
+        arg_register_error(endtable, endtable, ARG_ENOMATCH, argv[argi++]);
+    }
+
+    return;
+}
+
+/* the arg_end of the table whose post-parse checks are running on this thread, for arg_check_error() */
+static ARG_TLS struct arg_end* s_check_endtable = NULL;
+
+void arg_check_error(void* parent, int error, const char* argval) {
+    if (s_check_endtable)
+        arg_register_error(s_check_endtable, parent, error, argval);
+}
+
+static void arg_check_entry(struct arg_hdr* hdr, struct arg_end* endtable) {
+    void* parent = hdr->parent;
+    int errorcode;
+
+    s_check_endtable = endtable;
+    errorcode = hdr->checkfn(parent);
+    if (errorcode != 0)
+        arg_register_error(endtable, parent, errorcode, NULL);
+    s_check_endtable = NULL;
+}
+
+static void arg_parse_check(struct arg_hdr** table, struct arg_end* endtable, const arg_bits_t* given) {
+    int tabindex = 0;
+    /* printf("arg_parse_check()\n"); */
+
+    do {
+        if (table[tabindex]->checkfn)
+            arg_check_entry(table[tabindex], endtable);
+    } while (!(table[tabindex++]->flag & ARG_TERMINATOR));
+
+    /* then the constraints between entries, against the set of entries given */
+    if (given && arg_end_hasconstraints(endtable))
+        arg_end_checkconstraints(endtable, table, given);
+}
+
+static void arg_reset(void** argtable) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    int tabindex = 0;
+    /*printf("arg_reset(%p)\n",argtable);*/
+    do {
+        if (table[tabindex]->resetfn)
+            table[tabindex]->resetfn(table[tabindex]->parent);
+    } while (!(table[tabindex++]->flag & ARG_TERMINATOR));
+}
+
+static int arg_parse_impl(int argc, char** argv, void** argtable) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    struct arg_end* endtable;
+    int endindex;
+    char** argvcopy = NULL;
+    arg_bits_t* given = NULL;
+    int argi;
+    int i;
+
+    /*printf("arg_parse(%d,%p,%p)\n",argc,argv,argtable);*/
+
+    /* reset any argtable data from previous invocations */
+    arg_reset(argtable);
+
+    /* locate the first end-of-table marker within the array */
+    endindex = arg_endindex(table);
+    endtable = (struct arg_end*)table[endindex];
+
+    /* replace @file arguments with the contents of the response files, if enabled */
+    argc = arg_end_expand(endtable, argc, argv, &argv);
+
+    /*
+     * remember which options the command line gives, if the environment or
+     * configuration files can give them too, or constraints depend on them
+     */
+    if (arg_end_haslayers(endtable) || arg_end_hasconstraints(endtable))
+        given = (arg_bits_t*)xcalloc(ARG_BITS_LEN(endindex + 1), sizeof(arg_bits_t));
+
+    /* Special case of argc==0.  This can occur on Texas Instruments DSP. */
+    /* Failure to trap this case results in an unwanted NULL result from  */
+    /* the malloc for argvcopy (next code block).                         */
+    if (argc == 0) {
+        if (given && arg_end_haslayers(endtable))
+            arg_end_scanlayers(endtable, table, given);
+
+        /* We must still perform post-parse checks despite the absence of command line arguments */
+        arg_parse_check(table, endtable, given);
+        xfree(given);
+
+        /* Now we are finished */
+        return endtable->count;
+    }
+
+    argvcopy = (char**)xmalloc(sizeof(char*) * (size_t)(argc + 1));
+
+    /*
+        Fill in the local copy of argv[]. We need a local copy
+        because getopt rearranges argv[] which adversely affects
+        susbsequent parsing attempts.
+        */
+    for (i = 0; i < argc; i++)
+        argvcopy[i] = argv[i];
+
+    argvcopy[argc] = NULL;
+
+    /* parse the command line (local copy) for tagged options */
+    argi = arg_parse_tagged(argc, argvcopy, table, endtable, given, NULL);
+
+    /* parse the command line (local copy) for untagged options */
+    arg_parse_untagged(argc, argvcopy, argi, table, endtable, given);
+
+    /* fill in the options that the command line left out from the environment, then the configuration files */
+    if (given && arg_end_haslayers(endtable))
+        arg_end_scanlayers(endtable, table, given);
+
+    /* if no errors so far then perform post-parse checks otherwise dont bother */
+    if (endtable->count == 0)
+        arg_parse_check(table, endtable, given);
+    xfree(given);
+
+    /* release the local copt of argv[] */
+    xfree(argvcopy);
+
+    return endtable->count;
+}
+
+int arg_parse(int argc, char** argv, void** argtable) {
+#if ARG_REPLACE_GETOPT == 1
+    return arg_parse_impl(argc, argv, argtable);
+#else
+    int nerrors;
+
+    /* the getopt of the C library keeps its state in globals, so parses from different threads must take turns */
+    arg_global_lock();
+    nerrors = arg_parse_impl(argc, argv, argtable);
+    arg_global_unlock();
+
+    return nerrors;
+#endif
+}
+
+/* Copies each argument of the table into clone[], and returns non-zero if an argument cannot be copied */
+static int arg_clonetable(void** argtable, int n, void** clone) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        const struct arg_hdr_ext* ext = ARG_HDR_EXT(table[i]);
+        if (!ext || !ext->clonefn)
+            return -1;
+    }
+
+    for (i = 0; i < n; i++)
+        clone[i] = ARG_HDR_EXT(table[i])->clonefn(table[i]->parent);
+
+    /* options bound to environment variables are matched by their struct */
+    for (i = 0; i < n; i++)
+        arg_end_rebind((struct arg_end*)clone[n - 1], argtable[i], clone[i]);
+    return 0;
+}
+
+struct _internal_arg_result {
+    int n;
+    void** defs; /* entries of the table the result was created from */
+    void** args; /* copy of each entry, which parses store their results in */
+};
+
+arg_result_t arg_result_create(void** argtable) {
+    arg_result_t result;
+    int n = arg_endindex((struct arg_hdr**)argtable) + 1;
+
+    result = (arg_result_t)xmalloc(sizeof(struct _internal_arg_result) + 2 * sizeof(void*) * (size_t)n);
+    result->n = n;
+    result->defs = (void**)(result + 1);
+    result->args = result->defs + n;
+    memcpy(result->defs, argtable, sizeof(void*) * (size_t)n);
+    if (arg_clonetable(argtable, n, result->args) != 0) {
+        xfree(result);
+        return NULL;
+    }
+    return result;
+}
+
+int arg_parse_result(int argc, char** argv, arg_result_t result) {
+    return arg_parse(argc, argv, result->args);
+}
+
+void* arg_result_get(arg_result_t result, const void* arg) {
+    int i;
+
+    for (i = 0; i < result->n; i++) {
+        if (result->defs[i] == arg)
+            return result->args[i];
+    }
+    return NULL;
+}
+
+arg_end_t* arg_result_end(arg_result_t result) {
+    return (arg_end_t*)result->args[result->n - 1];
+}
+
+void arg_result_destroy(arg_result_t result) {
+    if (result == NULL)
+        return;
+
+    arg_freetable(result->args, (size_t)result->n);
+    xfree(result);
+}
+
+/* The jobs of a batch and the results to collect */
+struct arg_batch {
+    int njobs;
+    const int* argcs;
+    char*** argvs;
+    const arg_column_t* columns;
+    int ncolumns;
+    int* index; /* table index of the argument of each column */
+};
+
+/* A range of jobs parsed by one worker into its own copy of the table */
+struct arg_batch_chunk {
+    const struct arg_batch* batch;
+    arg_result_t result;
+    void** table; /* the arguments the jobs are parsed into */
+    int begin;
+    int end;
+    int nfailed;
+    arg_task_t task;
+};
+
+/* Copies the count and values a job left in an argument into the column buffers */
+static void arg_batch_collect(const arg_column_t* column, void* arg, int job) {
+    int count = *(const int*)ARG_CLONE_PTR(arg, column->arg, column->count);
+    const char* src = NULL;
+    char* dest;
+    int n;
+
+    if (column->counts)
+        column->counts[job] = count;
+    if (!column->values)
+        return;
+
+    dest = (char*)column->values + (size_t)job * (size_t)column->nvalues * column->size;
+    if (column->field)
+        src = *(const char* const*)ARG_CLONE_PTR(arg, column->arg, column->field);
+    n = (src && count < column->nvalues) ? count : (src ? column->nvalues : 0);
+    if (n > 0)
+        memcpy(dest, src, (size_t)n * column->size);
+    memset(dest + (size_t)n * column->size, 0, (size_t)(column->nvalues - n) * column->size);
+}
+
+static void arg_batch_run(void* arg) {
+    struct arg_batch_chunk* chunk = (struct arg_batch_chunk*)arg;
+    const struct arg_batch* batch = chunk->batch;
+    int i, j;
+
+    for (i = chunk->begin; i < chunk->end; i++) {
+        if (arg_parse(batch->argcs[i], batch->argvs[i], chunk->table) > 0)
+            chunk->nfailed++;
+        for (j = 0; j < batch->ncolumns; j++)
+            arg_batch_collect(&batch->columns[j], chunk->table[batch->index[j]], i);
+    }
+}
+
+int arg_parse_batch(void** argtable, int njobs, const int* argcs, char*** argvs, const arg_column_t* columns, int ncolumns, int nworkers) {
+    struct arg_batch batch;
+    struct arg_batch_chunk* chunks;
+    arg_tpool_t* pool;
+    int ntable = arg_endindex((struct arg_hdr**)argtable) + 1;
+    int nchunks;
+    int nfailed = 0;
+    int i, j;
+
+    if (ncolumns < 0)
+        return -1;
+
+    /* every column must describe an entry of the table, or there is nothing to copy its results from */
+    batch.index = (int*)xmalloc(sizeof(int) * (size_t)(ncolumns > 0 ? ncolumns : 1));
+    for (j = 0; j < ncolumns; j++) {
+        for (i = 0; i < ntable && argtable[i] != columns[j].arg; i++)
+            ;
+        if (i == ntable) {
+            xfree(batch.index);
+            return -1;
+        }
+        batch.index[j] = i;
+    }
+
+    if (njobs <= 0) {
+        xfree(batch.index);
+        return 0;
+    }
+
+    batch.njobs = njobs;
+    batch.argcs = argcs;
+    batch.argvs = argvs;
+    batch.columns = columns;
+    batch.ncolumns = ncolumns;
+
+    /* the getopt of the C library cannot run on several threads at once, so its parses are not spread */
+    if (nworkers < 0)
+        nworkers = arg_thread_ncpu();
+#if ARG_REPLACE_GETOPT == 0
+    nworkers = 0;
+#endif
+    nchunks = nworkers < 1 ? 1 : (nworkers < njobs ? nworkers : njobs);
+
+    chunks = (struct arg_batch_chunk*)xcalloc((size_t)nchunks, sizeof(struct arg_batch_chunk));
+    for (i = 0; i < nchunks; i++) {
+        chunks[i].batch = &batch;
+        chunks[i].begin = i * (njobs / nchunks) + (i < njobs % nchunks ? i : njobs % nchunks);
+        chunks[i].end = chunks[i].begin + njobs / nchunks + (i < njobs % nchunks ? 1 : 0);
+        chunks[i].result = arg_result_create(argtable);
+        if (!chunks[i].result)
+            break;
+        chunks[i].table = chunks[i].result->args;
+    }
+
+    if (i < nchunks) {
+        /* an argument without a clonefn: parse every job in the caller's table, one after another */
+        while (i-- > 0)
+            arg_result_destroy(chunks[i].result);
+        chunks[0].begin = 0;
+        chunks[0].end = njobs;
+        chunks[0].table = argtable;
+        arg_batch_run(&chunks[0]);
+        nfailed = chunks[0].nfailed;
+    } else {
+        pool = arg_tpool_create(nchunks > 1 ? nchunks : 0);
+        for (i = 0; i < nchunks; i++)
+            arg_tpool_submit(pool, &chunks[i].task, arg_batch_run, &chunks[i]);
+        for (i = 0; i < nchunks; i++) {
+            arg_tpool_join(pool, &chunks[i].task);
+            nfailed += chunks[i].nfailed;
+            arg_result_destroy(chunks[i].result);
+        }
+        arg_tpool_destroy(pool);
+    }
+
+    xfree(chunks);
+    xfree(batch.index);
+    return nfailed;
+}
+
+/* An error kept by an incremental parse until the entry it belongs to is scanned or checked again */
+struct arg_session_error {
+    void* parent;
+    int error;
+    const char* argval;
+    int occurrence; /* option the error was found in, counted from 0 for each entry */
+};
+
+struct arg_session_errors {
+    struct arg_session_error* item;
+    int count;
+    int maxcount;
+};
+
+struct arg_session_values {
+    const char** item;
+    int count;
+    int maxcount;
+};
+
+/* What an incremental parse remembers of a table entry */
+struct arg_session_entry {
+    struct arg_session_values optargs; /* values the entry was last scanned with, in order */
+    struct arg_session_values next;    /* values the current command line gives it */
+    struct arg_session_errors scan;    /* errors of its last scan */
+    struct arg_session_errors check;   /* errors of its last check */
+    int checked;                       /* non-zero if check is up to date */
+};
+
+/*
+ * State of an incremental parse. Options and arguments are recognized by the
+ * address of their token, so an edit never allocates a token after freeing
+ * one: a token that is unchanged keeps its address, and a new one cannot
+ * reuse the address of a token the caches still refer to.
+ */
+struct _internal_arg_session {
+    struct arg_hdr** table;
+    int ntable;
+    char** argv; /* the command line, as copies owned by the session */
+    int argc;
+    int maxargs;
+    char** argvcopy; /* argv[] for getopt to permute */
+    struct arg_session_values positional; /* untagged arguments last scanned */
+    int valid; /* non-zero if the caches match the table */
+    struct arg_events events;
+    struct arg_end* opterrors; /* errors of the tagged pass that belong to no entry */
+    struct arg_end* poserrors; /* errors of the untagged pass */
+    struct arg_end* scratch;   /* errors of the scan or check being run */
+    arg_bits_t* present;       /* entries given by the command line, for the constraints */
+    struct arg_session_entry* entries;
+};
+
+static void arg_session_push(struct arg_session_values* values, const char* value) {
+    if (values->count == values->maxcount) {
+        values->maxcount = values->maxcount ? values->maxcount * 2 : 4;
+        values->item = (const char**)xrealloc((void*)values->item, sizeof(char*) * (size_t)values->maxcount);
+    }
+    values->item[values->count++] = value;
+}
+
+/* Moves the errors registered in a scratch arg_end to an entry's cache, tagged with the option they belong to */
+static void arg_session_keep(struct arg_session_errors* errors, struct arg_end* scratch, int occurrence) {
+    int i;
+
+    for (i = 0; i < scratch->count; i++) {
+        struct arg_session_error* e;
+
+        if (errors->count == errors->maxcount) {
+            errors->maxcount = errors->maxcount ? errors->maxcount * 2 : 4;
+            errors->item = (struct arg_session_error*)xrealloc(errors->item, sizeof(struct arg_session_error) * (size_t)errors->maxcount);
+        }
+        e = &errors->item[errors->count++];
+        e->parent = scratch->parent[i];
+        e->error = scratch->error[i];
+        e->argval = scratch->argval[i];
+        e->occurrence = occurrence;
+    }
+    scratch->count = 0;
+}
+
+/* Registers an error in the table's arg_end, moving errors about a scratch arg_end to the real one */
+static void arg_session_error(arg_session_t session, void* parent, int error, const char* argval) {
+    struct arg_end* end = (struct arg_end*)session->table[session->ntable - 1];
+
+    if (parent == session->opterrors || parent == session->poserrors || parent == session->scratch)
+        parent = end;
+    arg_register_error(end, parent, error, argval);
+}
+
+static void arg_session_scan(arg_session_t session, int tabindex) {
+    struct arg_hdr* hdr = session->table[tabindex];
+    struct arg_session_entry* entry = &session->entries[tabindex];
+    struct arg_session_values swap;
+    int i;
+
+    swap = entry->optargs;
+    entry->optargs = entry->next;
+    entry->next = swap;
+    entry->scan.count = 0;
+    entry->checked = 0;
+
+    if (hdr->resetfn)
+        hdr->resetfn(hdr->parent);
+    for (i = 0; i < entry->optargs.count; i++) {
+        int errorcode = hdr->scanfn(hdr->parent, entry->optargs.item[i]);
+        if (errorcode != 0) {
+            arg_register_error(session->scratch, hdr->parent, errorcode, entry->optargs.item[i]);
+            arg_session_keep(&entry->scan, session->scratch, i);
+        }
+    }
+}
+
+static int arg_session_update(arg_session_t session) {
+    struct arg_hdr** table = session->table;
+    struct arg_end* end = (struct arg_end*)table[session->ntable - 1];
+    int argi;
+    int changed;
+    int i, j;
+
+    session->argv[session->argc] = NULL;
+
+    /* response files and other layers change what each option depends on, so they are parsed in full */
+    if (session->argc == 0 || arg_end_hasrespfile(end) || arg_end_haslayers(end)) {
+        session->valid = 0;
+        return arg_parse(session->argc, session->argv, (void**)table);
+    }
+
+    if (!session->valid) {
+        arg_reset((void**)table);
+        for (i = 0; i < session->ntable; i++) {
+            session->entries[i].optargs.count = 0;
+            session->entries[i].scan.count = 0;
+            session->entries[i].checked = 0;
+        }
+        memset(session->present, 0, sizeof(arg_bits_t) * ARG_BITS_LEN(session->ntable));
+        session->positional.count = -1;
+        session->valid = 1;
+    }
+
+    /*
+     * Find which entry each option belongs to, without scanning any of them.
+     * This pass is not incremental: whether a token is an option, a value or
+     * an untagged argument depends on the tokens before it, and getopt
+     * permutes argv[] as it goes, so the whole line is tagged again.
+     */
+    memcpy(session->argvcopy, session->argv, sizeof(char*) * (size_t)(session->argc + 1));
+    session->events.count = 0;
+    session->opterrors->count = 0;
+#if ARG_REPLACE_GETOPT == 0
+    arg_global_lock();
+#endif
+    argi = arg_parse_tagged(session->argc, session->argvcopy, table, session->opterrors, NULL, &session->events);
+#if ARG_REPLACE_GETOPT == 0
+    arg_global_unlock();
+#endif
+
+    /* scan again only the entries whose options changed */
+    for (i = 0; i < session->ntable; i++)
+        session->entries[i].next.count = 0;
+    for (i = 0; i < session->events.count; i++) {
+        if (session->events.tabindex[i] >= 0)
+            arg_session_push(&session->entries[session->events.tabindex[i]].next, session->events.optarg[i]);
+    }
+    for (i = 0; i < session->ntable; i++) {
+        struct arg_session_entry* entry = &session->entries[i];
+
+        if (!table[i]->scanfn || (!table[i]->shortopts && !table[i]->longopts))
+            continue;
+        changed = entry->next.count != entry->optargs.count;
+        for (j = 0; !changed && j < entry->next.count; j++)
+            changed = entry->next.item[j] != entry->optargs.item[j];
+        if (changed)
+            arg_session_scan(session, i);
+        if (entry->optargs.count > 0)
+            ARG_BITS_SET(session->present, i);
+        else
+            ARG_BITS_CLEAR(session->present, i);
+    }
+
+    /* the untagged arguments are matched against the untagged entries in turn, so any change rescans them all */
+    changed = session->positional.count != session->argc - argi;
+    for (j = 0; !changed && j < session->positional.count; j++)
+        changed = session->positional.item[j] != session->argvcopy[argi + j];
+    if (changed) {
+        session->positional.count = 0;
+        for (j = argi; j < session->argc; j++)
+            arg_session_push(&session->positional, session->argvcopy[j]);
+        for (i = 0; i < session->ntable; i++) {
+            if (table[i]->shortopts || table[i]->longopts || !table[i]->scanfn)
+                continue;
+            if (table[i]->resetfn)
+                table[i]->resetfn(table[i]->parent);
+            session->entries[i].checked = 0;
+            ARG_BITS_CLEAR(session->present, i);
+        }
+        session->poserrors->count = 0;
+        arg_parse_untagged(session->argc, session->argvcopy, argi, table, session->poserrors, session->present);
+    }
+
+    /* collect the errors in the order a full parse finds them */
+    end->count = 0;
+    for (i = 0; i < session->ntable; i++)
+        session->entries[i].next.count = 0; /* counts the options of each entry seen so far */
+    for (i = 0, j = 0; i < session->events.count; i++) {
+        int tabindex = session->events.tabindex[i];
+        struct arg_session_entry* entry;
+        int k;
+
+        if (tabindex < 0) {
+            arg_session_error(session, session->opterrors->parent[j], session->opterrors->error[j], session->opterrors->argval[j]);
+            j++;
+            continue;
+        }
+        entry = &session->entries[tabindex];
+        for (k = 0; k < entry->scan.count; k++) {
+            if (entry->scan.item[k].occurrence == entry->next.count)
+                arg_session_error(session, entry->scan.item[k].parent, entry->scan.item[k].error, entry->scan.item[k].argval);
+        }
+        entry->next.count++;
+    }
+    for (i = 0; i < session->poserrors->count; i++)
+        arg_session_error(session, session->poserrors->parent[i], session->poserrors->error[i], session->poserrors->argval[i]);
+
+    /* run the checks of the entries that changed, unless there are errors already */
+    if (end->count == 0) {
+        for (i = 0; i < session->ntable; i++) {
+            struct arg_session_entry* entry = &session->entries[i];
+
+            if (!table[i]->checkfn)
+                continue;
+            if (!entry->checked) {
+                entry->check.count = 0;
+                arg_check_entry(table[i], session->scratch);
+                arg_session_keep(&entry->check, session->scratch, 0);
+                entry->checked = 1;
+            }
+            for (j = 0; j < entry->check.count; j++)
+                arg_session_error(session, entry->check.item[j].parent, entry->check.item[j].error, entry->check.item[j].argval);
+        }
+
+        /* the constraints depend on several entries, but only on their bits, so they are always evaluated */
+        if (arg_end_hasconstraints(end))
+            arg_end_checkconstraints(end, table, session->present);
+    }
+
+    return end->count;
+}
+
+arg_session_t arg_session_create(void** argtable) {
+    arg_session_t session;
+    int maxcount;
+
+    session = (arg_session_t)xcalloc(1, sizeof(struct _internal_arg_session));
+    session->table = (struct arg_hdr**)argtable;
+    session->ntable = arg_endindex(session->table) + 1;
+    maxcount = session->table[session->ntable - 1]->maxcount;
+    session->maxargs = 8;
+    session->argv = (char**)xmalloc(sizeof(char*) * (size_t)session->maxargs);
+    session->argvcopy = (char**)xmalloc(sizeof(char*) * (size_t)session->maxargs);
+    session->opterrors = arg_end(maxcount);
+    session->poserrors = arg_end(maxcount);
+    session->scratch = arg_end(maxcount);
+    session->opterrors->count = 0;
+    session->poserrors->count = 0;
+    session->scratch->count = 0;
+    session->present = (arg_bits_t*)xcalloc(ARG_BITS_LEN(session->ntable), sizeof(arg_bits_t));
+    session->entries = (struct arg_session_entry*)xcalloc((size_t)session->ntable, sizeof(struct arg_session_entry));
+    return session;
+}
+
+/* Makes room for one more argument */
+static void arg_session_grow(arg_session_t session) {
+    /* keep room for the NULL that terminates argv[] */
+    if (session->argc + 2 > session->maxargs) {
+        session->maxargs *= 2;
+        session->argv = (char**)xrealloc(session->argv, sizeof(char*) * (size_t)session->maxargs);
+        session->argvcopy = (char**)xrealloc(session->argvcopy, sizeof(char*) * (size_t)session->maxargs);
+    }
+}
+
+static char* arg_session_strdup(const char* token) {
+    size_t len = strlen(token) + 1;
+    return (char*)memcpy(xmalloc(len), token, len);
+}
+
+int arg_session_parse(arg_session_t session, int argc, char** argv) {
+    int i;
+
+    for (i = 0; i < session->argc; i++)
+        xfree(session->argv[i]);
+    session->argc = 0;
+    for (i = 0; i < argc; i++) {
+        arg_session_grow(session);
+        session->argv[session->argc++] = arg_session_strdup(argv[i]);
+    }
+    session->valid = 0;
+    return arg_session_update(session);
+}
+
+int arg_session_edit(arg_session_t session, int edit, int index, const char* token) {
+    /* a token can be inserted after the last one, but only existing ones removed or replaced */
+    if (edit != ARG_EDIT_INSERT && edit != ARG_EDIT_REMOVE && edit != ARG_EDIT_REPLACE)
+        return -1;
+    if (index < 0 || index > (edit == ARG_EDIT_INSERT ? session->argc : session->argc - 1))
+        return -1;
+    if (edit != ARG_EDIT_REMOVE && token == NULL)
+        return -1;
+
+    switch (edit) {
+        case ARG_EDIT_INSERT:
+            arg_session_grow(session);
+            memmove(&session->argv[index + 1], &session->argv[index], sizeof(char*) * (size_t)(session->argc - index));
+            session->argv[index] = arg_session_strdup(token);
+            session->argc++;
+            break;
+
+        case ARG_EDIT_REMOVE:
+            xfree(session->argv[index]);
+            memmove(&session->argv[index], &session->argv[index + 1], sizeof(char*) * (size_t)(session->argc - index - 1));
+            session->argc--;
+            break;
+
+        case ARG_EDIT_REPLACE: {
+            /* copy before freeing, so the new token cannot take the address the caches know the old one by */
+            char* copy = arg_session_strdup(token);
+            xfree(session->argv[index]);
+            session->argv[index] = copy;
+        } break;
+    }
+    return arg_session_update(session);
+}
+
+int arg_session_argc(arg_session_t session) {
+    return session->argc;
+}
+
+char** arg_session_argv(arg_session_t session) {
+    return session->argv;
+}
+
+void arg_session_destroy(arg_session_t session) {
+    int i;
+
+    if (session == NULL)
+        return;
+
+    for (i = 0; i < session->argc; i++)
+        xfree(session->argv[i]);
+    for (i = 0; i < session->ntable; i++) {
+        xfree((void*)session->entries[i].optargs.item);
+        xfree((void*)session->entries[i].next.item);
+        xfree(session->entries[i].scan.item);
+        xfree(session->entries[i].check.item);
+    }
+    xfree(session->entries);
+    xfree((void*)session->positional.item);
+    xfree(session->events.tabindex);
+    xfree((void*)session->events.optarg);
+    xfree(session->opterrors);
+    xfree(session->poserrors);
+    xfree(session->scratch);
+    xfree(session->present);
+    xfree(session->argvcopy);
+    xfree(session->argv);
+    xfree(session);
+}
+
+/*
+ * Concatenate contents of src[] string onto *pdest[] string.
+ * The *pdest pointer is altered to point to the end of the
+ * target string and *pndest is decremented by the same number
+ * of chars.
+ * Does not append more than *pndest chars into *pdest[]
+ * so as to prevent buffer overruns.
+ * Its something like strncat() but more efficient for repeated
+ * calls on the same destination string.
+ * Example of use:
+ *   char dest[30] = "good"
+ *   size_t ndest = sizeof(dest);
+ *   char *pdest = dest;
+ *   arg_char(&pdest,"bye ",&ndest);
+ *   arg_char(&pdest,"cruel ",&ndest);
+ *   arg_char(&pdest,"world!",&ndest);
+ * Results in:
+ *   dest[] == "goodbye cruel world!"
+ *   ndest  == 10
+ */
+static void arg_cat(char** pdest, const char* src, size_t* pndest) {
+    char* dest = *pdest;
+    char* end = dest + *pndest;
+
+    /*locate null terminator of dest string */
+    while (dest < end-1 && *dest != 0)
+        dest++;
+
+    /* concat src string to dest string */
+    while (dest < end-1 && *src != 0)
+        *dest++ = *src++;
+
+    /* null terminate dest string */
+    *dest = 0;
+
+    /* update *pdest and *pndest */
+    *pndest = (size_t)(end - dest);
+    *pdest = dest;
+}
+
+static void arg_cat_option(char* dest, size_t ndest, const char* shortopts, const char* longopts, const char* datatype, int optvalue) {
+    if (shortopts) {
+        char option[3];
+
+        /* note: option array[] is initialiazed dynamically here to satisfy   */
+        /* a deficiency in the watcom compiler wrt static array initializers. */
+        option[0] = '-';
+        option[1] = shortopts[0];
+        option[2] = 0;
+
+        arg_cat(&dest, option, &ndest);
+        if (datatype) {
+            arg_cat(&dest, " ", &ndest);
+            if (optvalue) {
+                arg_cat(&dest, "[", &ndest);
+                arg_cat(&dest, datatype, &ndest);
+                arg_cat(&dest, "]", &ndest);
+            } else
+                arg_cat(&dest, datatype, &ndest);
+        }
+    } else if (longopts) {
+        size_t ncspn;
+
+        /* add "--" tag prefix */
+        arg_cat(&dest, "--", &ndest);
+
+        /* add comma separated option tag */
+        ncspn = strcspn(longopts, ",");
+#if (defined(__STDC_LIB_EXT1__) && defined(__STDC_WANT_LIB_EXT1__)) || (defined(__STDC_SECURE_LIB__) && defined(__STDC_WANT_SECURE_LIB__))
+        strncat_s(dest, ndest, longopts, (ncspn < ndest) ? ncspn : ndest);
+#else
+        strncat(dest, longopts, (ncspn < ndest) ? ncspn : ndest);
+#endif
+
+        if (datatype) {
+            arg_cat(&dest, "=", &ndest);
+            if (optvalue) {
+                arg_cat(&dest, "[", &ndest);
+                arg_cat(&dest, datatype, &ndest);
+                arg_cat(&dest, "]", &ndest);
+            } else
+                arg_cat(&dest, datatype, &ndest);
+        }
+    } else if (datatype) {
+        if (optvalue) {
+            arg_cat(&dest, "[", &ndest);
+            arg_cat(&dest, datatype, &ndest);
+            arg_cat(&dest, "]", &ndest);
+        } else
+            arg_cat(&dest, datatype, &ndest);
+    }
+}
+
+static void arg_cat_optionv(char* dest, size_t ndest, const char* shortopts, const char* longopts, const char* datatype, int optvalue, const char* separator) {
+    separator = separator ? separator : "";
+
+    if (shortopts) {
+        const char* c = shortopts;
+        while (*c) {
+            /* "-a|-b|-c" */
+            char shortopt[3];
+
+            /* note: shortopt array[] is initialiazed dynamically here to satisfy */
+            /* a deficiency in the watcom compiler wrt static array initializers. */
+            shortopt[0] = '-';
+            shortopt[1] = *c;
+            shortopt[2] = 0;
+
+            arg_cat(&dest, shortopt, &ndest);
+            if (*++c)
+                arg_cat(&dest, separator, &ndest);
+        }
+    }
+
+    /* put separator between long opts and short opts */
+    if (shortopts && longopts)
+        arg_cat(&dest, separator, &ndest);
+
+    if (longopts) {
+        const char* c = longopts;
+        while (*c) {
+            size_t ncspn;
+
+            /* add "--" tag prefix */
+            arg_cat(&dest, "--", &ndest);
+
+            /* add comma separated option tag */
+            ncspn = strcspn(c, ",");
+#if (defined(__STDC_LIB_EXT1__) && defined(__STDC_WANT_LIB_EXT1__)) || (defined(__STDC_SECURE_LIB__) && defined(__STDC_WANT_SECURE_LIB__))
+            strncat_s(dest, ndest, c, (ncspn < ndest) ? ncspn : ndest);
+#else
+            strncat(dest, c, (ncspn < ndest) ? ncspn : ndest);
+#endif
+            c += ncspn;
+
+            /* add given separator in place of comma */
+            if (*c == ',') {
+                arg_cat(&dest, separator, &ndest);
+                c++;
+            }
+        }
+    }
+
+    if (datatype) {
+        if (longopts)
+            arg_cat(&dest, "=", &ndest);
+        else if (shortopts)
+            arg_cat(&dest, " ", &ndest);
+
+        if (optvalue) {
+            arg_cat(&dest, "[", &ndest);
+            arg_cat(&dest, datatype, &ndest);
+            arg_cat(&dest, "]", &ndest);
+        } else
+            arg_cat(&dest, datatype, &ndest);
+    }
+}
+
+void arg_print_option_ds(arg_dstr_t ds, const char* shortopts, const char* longopts, const char* datatype, const char* suffix) {
+    char syntax[200] = "";
+    suffix = suffix ? suffix : "";
+
+    /* there is no way of passing the proper optvalue for optional argument values here, so we must ignore it */
+    arg_cat_optionv(syntax, sizeof(syntax) - 1, shortopts, longopts, datatype, 0, "|");
+
+    arg_dstr_cat(ds, syntax);
+    arg_dstr_cat(ds, (char*)suffix);
+}
+
+/* this function should be deprecated because it doesn't consider optional argument values (ARG_HASOPTVALUE) */
+void arg_print_option(FILE* fp, const char* shortopts, const char* longopts, const char* datatype, const char* suffix) {
+    arg_dstr_t ds = arg_dstr_create();
+    arg_print_option_ds(ds, shortopts, longopts, datatype, suffix);
+    fputs(arg_dstr_cstr(ds), fp);
+    arg_dstr_destroy(ds);
+}
+
+/*
+ * Print a GNU style [OPTION] string in which all short options that
+ * do not take argument values are presented in abbreviated form, as
+ * in: -xvfsd, or -xvf[sd], or [-xvsfd]
+ */
+static void arg_print_gnuswitch_ds(arg_dstr_t ds, struct arg_hdr** table) {
+    int tabindex;
+    const char* format1 = " -%c";
+    const char* format2 = " [-%c";
+    const char* suffix = "";
+
+    /* print all mandatory switches that are without argument values */
+    for (tabindex = 0; table[tabindex] && !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        /* skip optional options */
+        if (table[tabindex]->mincount < 1)
+            continue;
+
+        /* skip non-short options */
+        if (table[tabindex]->shortopts == NULL)
+            continue;
+
+        /* skip options that take argument values */
+        if (table[tabindex]->flag & ARG_HASVALUE)
+            continue;
+
+        /* print the short option (only the first short option char, ignore multiple choices)*/
+        arg_dstr_catf(ds, format1, table[tabindex]->shortopts[0]);
+        format1 = "%c";
+        format2 = "[%c";
+    }
+
+    /* print all optional switches that are without argument values */
+    for (tabindex = 0; table[tabindex] && !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        /* skip mandatory args */
+        if (table[tabindex]->mincount > 0)
+            continue;
+
+        /* skip args without short options */
+        if (table[tabindex]->shortopts == NULL)
+            continue;
+
+        /* skip args with values */
+        if (table[tabindex]->flag & ARG_HASVALUE)
+            continue;
+
+        /* print first short option */
+        arg_dstr_catf(ds, format2, table[tabindex]->shortopts[0]);
+        format2 = "%c";
+        suffix = "]";
+    }
+
+    arg_dstr_catf(ds, "%s", suffix);
+}
+
+void arg_print_syntax_ds(arg_dstr_t ds, void** argtable, const char* suffix) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    int i, tabindex;
+
+    /* print GNU style [OPTION] string */
+    arg_print_gnuswitch_ds(ds, table);
+
+    /* print remaining options in abbreviated style */
+    for (tabindex = 0; table[tabindex] && !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        char syntax[200] = "";
+        const char *shortopts, *longopts, *datatype;
+
+        /* skip short options without arg values (they were printed by arg_print_gnu_switch) */
+        if (table[tabindex]->shortopts && !(table[tabindex]->flag & ARG_HASVALUE))
+            continue;
+
+        shortopts = table[tabindex]->shortopts;
+        longopts = table[tabindex]->longopts;
+        datatype = table[tabindex]->datatype;
+        arg_cat_option(syntax, sizeof(syntax) - 1, shortopts, longopts, datatype, table[tabindex]->flag & ARG_HASOPTVALUE);
+
+        if (strlen(syntax) > 0) {
+            /* print mandatory instances of this option */
+            for (i = 0; i < table[tabindex]->mincount; i++) {
+                arg_dstr_cat(ds, " ");
+                arg_dstr_cat(ds, syntax);
+            }
+
+            /* print optional instances enclosed in "[..]" */
+            switch (table[tabindex]->maxcount - table[tabindex]->mincount) {
+                case 0:
+                    break;
+                case 1:
+                    arg_dstr_cat(ds, " [");
+                    arg_dstr_cat(ds, syntax);
+                    arg_dstr_cat(ds, "]");
+                    break;
+                case 2:
+                    arg_dstr_cat(ds, " [");
+                    arg_dstr_cat(ds, syntax);
+                    arg_dstr_cat(ds, "]");
+                    arg_dstr_cat(ds, " [");
+                    arg_dstr_cat(ds, syntax);
+                    arg_dstr_cat(ds, "]");
+                    break;
+                default:
+                    arg_dstr_cat(ds, " [");
+                    arg_dstr_cat(ds, syntax);
+                    arg_dstr_cat(ds, "]...");
+                    break;
+            }
+        }
+    }
+
+    if (suffix) {
+        arg_dstr_cat(ds, (char*)suffix);
+    }
+}
+
+void arg_print_syntax(FILE* fp, void** argtable, const char* suffix) {
+    arg_dstr_t ds = arg_dstr_create();
+    arg_print_syntax_ds(ds, argtable, suffix);
+    fputs(arg_dstr_cstr(ds), fp);
+    arg_dstr_destroy(ds);
+}
+
+void arg_print_syntaxv_ds(arg_dstr_t ds, void** argtable, const char* suffix) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    int i, tabindex;
+
+    /* print remaining options in abbreviated style */
+    for (tabindex = 0; table[tabindex] && !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        char syntax[200] = "";
+        const char *shortopts, *longopts, *datatype;
+
+        shortopts = table[tabindex]->shortopts;
+        longopts = table[tabindex]->longopts;
+        datatype = table[tabindex]->datatype;
+        arg_cat_optionv(syntax, sizeof(syntax) - 1, shortopts, longopts, datatype, table[tabindex]->flag & ARG_HASOPTVALUE, "|");
+
+        /* print mandatory options */
+        for (i = 0; i < table[tabindex]->mincount; i++) {
+            arg_dstr_cat(ds, " ");
+            arg_dstr_cat(ds, syntax);
+        }
+
+        /* print optional args enclosed in "[..]" */
+        switch (table[tabindex]->maxcount - table[tabindex]->mincount) {
+            case 0:
+                break;
+            case 1:
+                arg_dstr_cat(ds, " [");
+                arg_dstr_cat(ds, syntax);
+                arg_dstr_cat(ds, "]");
+                break;
+            case 2:
+                arg_dstr_cat(ds, " [");
+                arg_dstr_cat(ds, syntax);
+                arg_dstr_cat(ds, "]");
+                arg_dstr_cat(ds, " [");
+                arg_dstr_cat(ds, syntax);
+                arg_dstr_cat(ds, "]");
+                break;
+            default:
+                arg_dstr_cat(ds, " [");
+                arg_dstr_cat(ds, syntax);
+                arg_dstr_cat(ds, "]...");
+                break;
+        }
+    }
+
+    if (suffix) {
+        arg_dstr_cat(ds, (char*)suffix);
+    }
+}
+
+void arg_print_syntaxv(FILE* fp, void** argtable, const char* suffix) {
+    arg_dstr_t ds = arg_dstr_create();
+    arg_print_syntaxv_ds(ds, argtable, suffix);
+    fputs(arg_dstr_cstr(ds), fp);
+    arg_dstr_destroy(ds);
+}
+
+void arg_print_glossary_ds(arg_dstr_t ds, void** argtable, const char* format) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    int tabindex;
+
+    format = format ? format : "  %-20s %s\n";
+    for (tabindex = 0; !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        if (table[tabindex]->glossary) {
+            char syntax[200] = "";
+            const char* shortopts = table[tabindex]->shortopts;
+            const char* longopts = table[tabindex]->longopts;
+            const char* datatype = table[tabindex]->datatype;
+            const char* glossary = table[tabindex]->glossary;
+            arg_cat_optionv(syntax, sizeof(syntax) - 1, shortopts, longopts, datatype, table[tabindex]->flag & ARG_HASOPTVALUE, ", ");
+            arg_dstr_catf(ds, format, syntax, glossary);
+        }
+    }
+}
+
+void arg_print_glossary(FILE* fp, void** argtable, const char* format) {
+    arg_dstr_t ds = arg_dstr_create();
+    arg_print_glossary_ds(ds, argtable, format);
+    fputs(arg_dstr_cstr(ds), fp);
+    arg_dstr_destroy(ds);
+}
+
+/**
+ * Print a piece of text formatted, which means in a column with a
+ * left and a right margin. The lines are wrapped at whitspaces next
+ * to right margin. The function does not indent the first line, but
+ * only the following ones.
+ *
+ * See description of arg_print_formatted below.
+ */
+static void arg_print_formatted_ds(arg_dstr_t ds, const unsigned lmargin, const unsigned rmargin, const char* text) {
+    const unsigned int textlen = (unsigned int)strlen(text);
+    unsigned int line_start = 0;
+    unsigned int line_end = textlen;
+    const unsigned int colwidth = (rmargin - lmargin) + 1;
+
+    assert(strlen(text) < UINT_MAX);
+
+    /* Someone doesn't like us... */
+    if (line_end < line_start) {
+        arg_dstr_catf(ds, "%s\n", text);
+    }
+
+    while (line_end > line_start) {
+        /* Eat leading white spaces. This is essential because while
+           wrapping lines, there will often be a whitespace at beginning
+           of line. Preserve newlines */
+        while (isspace((int)(*(text + line_start))) && *(text + line_start) != '\n') {
+            line_start++;
+        }
+
+        /* Find last whitespace, that fits into line */
+        if (line_end - line_start > colwidth) {
+            line_end = line_start + colwidth;
+
+            while ((line_end > line_start) && !isspace((int)(*(text + line_end)))) {
+                line_end--;
+            }
+
+            /* If no whitespace could be found, eg. the text is one long word, break the word */
+            if (line_end == line_start) {
+                /* Set line_end to previous value */
+                line_end = line_start + colwidth;
+            } else {
+                /* Consume trailing spaces, except newlines */
+                while ((line_end > line_start) && isspace((int)(*(text + line_end))) && *(text + line_start) != '\n') {
+                    line_end--;
+                }
+
+                /* Restore the last non-space character */
+                line_end++;
+            }
+        }
+
+        /* Output line of text */
+        while (line_start < line_end) {
+            char c = *(text + line_start);
+
+            /* If character is newline stop printing, skip this character, as a newline will be printed below. */
+            if (c == '\n') {
+                line_start++;
+                break;
+            }
+
+            arg_dstr_catc(ds, c);
+            line_start++;
+        }
+        arg_dstr_cat(ds, "\n");
+
+        /* Initialize another line */
+        if (line_end < textlen) {
+            unsigned i;
+
+            for (i = 0; i < lmargin; i++) {
+                arg_dstr_cat(ds, " ");
+            }
+
+            line_end = textlen;
+        }
+    } /* lines of text */
+}
+
+/**
+ * Print a piece of text formatted, which means in a column with a
+ * left and a right margin. The lines are wrapped at whitspaces next
+ * to right margin. The function does not indent the first line, but
+ * only the following ones.
+ *
+ * Example:
+ * arg_print_formatted( fp, 0, 5, "Some text that doesn't fit." )
+ * will result in the following output:
+ *
+ * Some
+ * text
+ * that
+ * doesn'
+ * t fit.
+ *
+ * Too long lines will be wrapped in the middle of a word.
+ *
+ * arg_print_formatted( fp, 2, 7, "Some text that doesn't fit." )
+ * will result in the following output:
+ *
+ * Some
+ *   text
+ *   that
+ *   doesn'
+ *   t fit.
+ *
+ * As you see, the first line is not indented. This enables output of
+ * lines, which start in a line where output already happened.
+ *
+ * Author: Uli Fouquet
+ */
+void arg_print_formatted(FILE* fp, const unsigned lmargin, const unsigned rmargin, const char* text) {
+    arg_dstr_t ds = arg_dstr_create();
+    arg_print_formatted_ds(ds, lmargin, rmargin, text);
+    fputs(arg_dstr_cstr(ds), fp);
+    arg_dstr_destroy(ds);
+}
+
+/**
+ * Prints the glossary in strict GNU format.
+ * Differences to arg_print_glossary() are:
+ *   - wraps lines after 80 chars
+ *   - indents lines without shortops
+ *   - does not accept formatstrings
+ *
+ * Contributed by Uli Fouquet
+ */
+void arg_print_glossary_gnu_ds(arg_dstr_t ds, void** argtable) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    int tabindex;
+
+    for (tabindex = 0; !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        if (table[tabindex]->glossary) {
+            char syntax[200] = "";
+            const char* shortopts = table[tabindex]->shortopts;
+            const char* longopts = table[tabindex]->longopts;
+            const char* datatype = table[tabindex]->datatype;
+            const char* glossary = table[tabindex]->glossary;
+
+            if (!shortopts && longopts) {
+                /* Indent trailing line by 4 spaces... */
+                memset(syntax, ' ', 4);
+                *(syntax + 4) = '\0';
+            }
+
+            arg_cat_optionv(syntax, sizeof(syntax) - 1, shortopts, longopts, datatype, table[tabindex]->flag & ARG_HASOPTVALUE, ", ");
+
+            /* If syntax fits not into column, print glossary in new line... */
+            if (strlen(syntax) > 25) {
+                arg_dstr_catf(ds, "  %-25s %s\n", syntax, "");
+                *syntax = '\0';
+            }
+
+            arg_dstr_catf(ds, "  %-25s ", syntax);
+            arg_print_formatted_ds(ds, 28, 79, glossary);
+        }
+    } /* for each table entry */
+
+    arg_dstr_cat(ds, "\n");
+}
+
+void arg_print_glossary_gnu(FILE* fp, void** argtable) {
+    arg_dstr_t ds = arg_dstr_create();
+    arg_print_glossary_gnu_ds(ds, argtable);
+    fputs(arg_dstr_cstr(ds), fp);
+    arg_dstr_destroy(ds);
+}
+
+/**
+ * Checks the argtable[] array for NULL entries and returns 1
+ * if any are found, zero otherwise.
+ */
+int arg_nullcheck(void** argtable) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    int tabindex;
+    /*printf("arg_nullcheck(%p)\n",argtable);*/
+
+    if (!table)
+        return 1;
+
+    tabindex = 0;
+    do {
+        /*printf("argtable[%d]=%p\n",tabindex,argtable[tabindex]);*/
+        if (!table[tabindex])
+            return 1;
+    } while (!(table[tabindex++]->flag & ARG_TERMINATOR));
+
+    return 0;
+}
+
+/*
+ * arg_free() is deprecated in favour of arg_freetable() due to a flaw in its design.
+ * The flaw results in memory leak in the (very rare) case that an intermediate
+ * entry in the argtable array failed its memory allocation while others following
+ * that entry were still allocated ok. Those subsequent allocations will not be
+ * deallocated by arg_free().
+ * Despite the unlikeliness of the problem occurring, and the even unlikelier event
+ * that it has any deliterious effect, it is fixed regardless by replacing arg_free()
+ * with the newer arg_freetable() function.
+ * We still keep arg_free() for backwards compatibility.
+ */
+void arg_free(void** argtable) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    const struct arg_hdr_ext* ext;
+    int tabindex = 0;
+    int flag;
+    /*printf("arg_free(%p)\n",argtable);*/
+    do {
+        /*
+           if we encounter a NULL entry then somewhat incorrectly we presume
+           we have come to the end of the array. It isnt strictly true because
+           an intermediate entry could be NULL with other non-NULL entries to follow.
+           The subsequent argtable entries would then not be freed as they should.
+         */
+        if (table[tabindex] == NULL)
+            break;
+
+        flag = table[tabindex]->flag;
+        ext = ARG_HDR_EXT(table[tabindex]);
+        if (ext && ext->freefn)
+            ext->freefn(table[tabindex]->parent);
+        xfree(table[tabindex]);
+        table[tabindex++] = NULL;
+
+    } while (!(flag & ARG_TERMINATOR));
+}
+
+/* frees each non-NULL element of argtable[], where n is the size of the number of entries in the array */
+void arg_freetable(void** argtable, size_t n) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    const struct arg_hdr_ext* ext;
+    size_t tabindex = 0;
+    /*printf("arg_freetable(%p)\n",argtable);*/
+    for (tabindex = 0; tabindex < n; tabindex++) {
+        if (table[tabindex] == NULL)
+            continue;
+
+        ext = ARG_HDR_EXT(table[tabindex]);
+        if (ext && ext->freefn)
+            ext->freefn(table[tabindex]->parent);
+        xfree(table[tabindex]);
+        table[tabindex] = NULL;
+    };
+}
+
+#ifdef _WIN32
+BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) {
+    return TRUE;
+    UNREFERENCED_PARAMETER(hinstDLL);
+    UNREFERENCED_PARAMETER(fdwReason);
+    UNREFERENCED_PARAMETER(lpvReserved);
+}
+#endif
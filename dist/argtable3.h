@@ -0,0 +1,4592 @@
+/*******************************************************************************
+ * argtable3: Declares the main interfaces of the library
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 1998-2001,2003-2011,2013 Stewart Heitmann
+ * <sheitmann@users.sourceforge.net>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#ifndef ARGTABLE3
+#define ARGTABLE3
+
+#include <stdint.h> /* int64_t, uint64_t */
+#include <stdio.h>  /* FILE */
+#include <time.h>   /* struct tm */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ARG_REX_ICASE 1
+#define ARG_ENUM_ICASE 1
+
+/* arg_file_validate checks */
+#define ARG_FILE_EXISTS 0x1   /* the path exists */
+#define ARG_FILE_REGULAR 0x2  /* the path is a regular file */
+#define ARG_FILE_DIR 0x4      /* the path is a directory */
+#define ARG_FILE_READABLE 0x8 /* the path can be read */
+
+/* arg_date format accepting ISO-8601 timestamps with optional fraction and UTC offset */
+#define ARG_DATE_ISO8601 "%Y-%m-%dT%H:%M:%S%z"
+
+/* Maximum length of the command name */
+#ifndef ARG_CMD_NAME_LEN
+#define ARG_CMD_NAME_LEN 100
+#endif /* ARG_CMD_NAME_LEN */
+
+/* Maximum length of the command description */
+#ifndef ARG_CMD_DESCRIPTION_LEN
+#define ARG_CMD_DESCRIPTION_LEN 256
+#endif /* ARG_CMD_DESCRIPTION_LEN */
+
+/*
+ * Store sub-command names and descriptions in a shared string arena instead of
+ * fixed-size arrays. This changes the layout of arg_cmd_info_t, so the library
+ * and the application must be built with the same setting.
+ */
+#ifndef ARG_CMD_COMPACT
+#define ARG_CMD_COMPACT 0
+#endif /* ARG_CMD_COMPACT */
+
+/**
+ * Error codes returned by argument parsing and validation.
+ *
+ * These error codes are used by Argtable3 to indicate specific problems
+ * encountered during command-line parsing and validation. They are typically
+ * stored in the `error` array of the `arg_end_t` struct and can be used to
+ * generate detailed error messages for the user.
+ */
+enum {
+    ARG_ELIMIT = 1,  /**< Too many occurrences of an option or argument */
+    ARG_EMALLOC,     /**< Memory allocation failure */
+    ARG_ENOMATCH,    /**< Argument value does not match the expected format or pattern */
+    ARG_ELONGOPT,    /**< Unknown or invalid long option encountered */
+    ARG_EMISSARG,    /**< Missing required argument value */
+    ARG_ERESPFILE,   /**< Response file cannot be read */
+    ARG_ERESPCYCLE,  /**< Response file refers to itself, directly or through other response files */
+    ARG_ECONFFILE,   /**< Configuration file cannot be read */
+    ARG_ECONFKEY,    /**< Configuration file sets an option that is not in the table */
+    ARG_ECONFSYNTAX, /**< Configuration file has a line that is not of the form `key = value` */
+    ARG_EEXCLUSIVE,  /**< More than one of a set of mutually exclusive options is given */
+    ARG_EREQUIRES,   /**< An option is given without an option it requires */
+    ARG_EANYOF       /**< None of a set of options of which one is required is given */
+};
+
+/**
+ * Bit masks for the `flag` field in the `arg_hdr` struct.
+ *
+ * The `arg_hdr_flag` enum defines bitwise flags that describe special
+ * properties of an argument entry in Argtable3. These flags are stored in the
+ * `flag` field of the `arg_hdr` struct and can be combined using bitwise OR.
+ *
+ * These flags help Argtable3 functions determine how to parse and process each
+ * argument entry.
+ */
+enum arg_hdr_flag {
+    ARG_TERMINATOR = 0x1,   /**< Marks the end of an argument table (sentinel entry) */
+    ARG_HASVALUE = 0x2,     /**< Argument expects a value (e.g., `--output <file>`) */
+    ARG_HASOPTVALUE = 0x4,  /**< Argument can optionally take a value (e.g., `--color[=WHEN]`) */
+    ARG_HASFILEVALUE = 0x8, /**< Argument value names a file or directory (used by shell completion) */
+    ARG_HASEXT = 0x10       /**< `priv` starts with an `arg_hdr_ext` struct of optional functions */
+};
+
+/**
+ * Target shells for the completion scripts generated by `arg_print_completion`.
+ */
+enum arg_shell {
+    ARG_SHELL_BASH = 1, /**< GNU bash, loaded with `source` or from `bash_completion.d` */
+    ARG_SHELL_ZSH,      /**< zsh, installed as `_progname` on `$fpath` or sourced after `compinit` */
+    ARG_SHELL_FISH      /**< fish, installed as `progname.fish` in a completions directory */
+};
+
+#if defined(_WIN32)
+#if defined(argtable3_EXPORTS)
+#define ARG_EXTERN __declspec(dllexport)
+#elif defined(argtable3_IMPORTS)
+#define ARG_EXTERN __declspec(dllimport)
+#else
+#define ARG_EXTERN
+#endif
+#else
+#define ARG_EXTERN
+#endif
+
+typedef struct _internal_arg_dstr* arg_dstr_t;
+typedef void* arg_cmd_itr_t;
+typedef struct _internal_arg_cmd_job* arg_cmd_job_t;
+typedef struct _internal_arg_cmd_batch* arg_cmd_batch_t;
+typedef struct _internal_arg_result* arg_result_t;
+typedef struct _internal_arg_session* arg_session_t;
+
+/**
+ * Function pointer type for resetting an argument structure to its initial state.
+ *
+ * The `arg_resetfn` type defines the signature for functions that reset an
+ * argument structure (such as `arg_lit_t`, `arg_int_t`, etc.) to its initial
+ * state. This is typically used internally by Argtable3 to clear any parsed
+ * values, counts, or state information before reusing the argument structure
+ * for another round of parsing.
+ *
+ * This function pointer is primarily intended for developers who want to
+ * implement and register new command-line option data types with Argtable3.
+ * If you are extending Argtable3 with custom argument types, you should
+ * provide a suitable reset function that matches this signature.
+ *
+ * The function receives a pointer to the parent argument structure and should
+ * reset all relevant fields to their default values.
+ *
+ * Example usage:
+ * ```
+ * void my_arg_reset(void* parent) {
+ *     arg_int_t* arg = (arg_int_t*)parent;
+ *     arg->count = 0;
+ *     // Reset other fields as needed...
+ * }
+ * ```
+ *
+ * @param parent Pointer to the argument structure to reset.
+ */
+typedef void(arg_resetfn)(void* parent);
+
+/**
+ * Function pointer type for scanning and parsing a command-line argument value.
+ *
+ * The `arg_scanfn` type defines the signature for functions that parse a
+ * command-line argument value and store the result in the parent argument
+ * structure (such as `arg_int_t`, `arg_str_t`, etc.). This function is called
+ * by Argtable3 during argument parsing to convert the input string (`argval`)
+ * into the appropriate data type and store it in the corresponding field of the
+ * parent struct.
+ *
+ * This function pointer is primarily intended for developers who want to
+ * implement and register new command-line option data types with Argtable3.
+ * If you are extending Argtable3 with custom argument types, you should provide
+ * a suitable scan function that matches this signature.
+ *
+ * @param parent Pointer to the argument structure where the parsed value should
+ *               be stored.
+ * @param argval The string value from the command line to be parsed.
+ * @return Returns 0 on success, or a nonzero error code if parsing fails.
+ */
+typedef int(arg_scanfn)(void* parent, const char* argval);
+
+/**
+ * Function pointer type for validating a parsed argument structure.
+ *
+ * The `arg_checkfn` type defines the signature for functions that perform
+ * post-parsing validation on an argument structure (such as `arg_int_t`,
+ * `arg_str_t`, etc.). This function is called by Argtable3 after all arguments
+ * have been parsed, allowing you to check for additional constraints or
+ * perform custom validation logic.
+ *
+ * This function pointer is primarily intended for developers who want to
+ * implement and register new command-line option data types with Argtable3.
+ * If you are extending Argtable3 with custom argument types, you should provide
+ * a suitable check function that matches this signature.
+ *
+ * @param parent Pointer to the argument structure to validate.
+ * @return Returns 0 if validation succeeds, or a nonzero error code if validation
+ *         fails.
+ */
+typedef int(arg_checkfn)(void* parent);
+
+/**
+ * Function pointer type for reporting argument parsing or validation errors.
+ *
+ * The `arg_errorfn` type defines the signature for functions that generate
+ * error messages when an argument fails to parse or validate. This function is
+ * called by Argtable3 when an error is detected for a specific argument, and it
+ * is responsible for formatting and appending a descriptive error message to
+ * the provided dynamic string object (`arg_dstr_t`).
+ *
+ * This function pointer is primarily intended for developers who want to
+ * implement and register new command-line option data types with Argtable3.
+ * If you are extending Argtable3 with custom argument types, you should provide
+ * a suitable error reporting function that matches this signature.
+ *
+ * @param parent   Pointer to the argument structure that caused the error.
+ * @param ds       Dynamic string object to which the error message should be
+ *                 appended.
+ * @param error    Error code indicating the type of error encountered.
+ * @param argval   The offending argument value from the command line, or NULL if
+ *                 not applicable.
+ * @param progname The name of the program or command, used for context in the
+ *                 error message.
+ */
+typedef void(arg_errorfn)(void* parent, arg_dstr_t ds, int error, const char* argval, const char* progname);
+
+/**
+ * Function pointer type for releasing memory owned by an argument structure.
+ *
+ * Most argument types keep their parsed values in the same memory block as
+ * the argument structure itself, so `arg_freetable` can release them with a
+ * single `free`. Types whose storage grows while parsing, such as the list
+ * types, allocate additional memory. Such types provide a free function in
+ * their `arg_hdr_ext` struct, which `arg_free` and `arg_freetable` call
+ * before releasing the argument structure.
+ *
+ * The function must only release the additional memory, not the argument
+ * structure itself.
+ *
+ * @param parent Pointer to the argument structure being freed.
+ */
+typedef void(arg_freefn)(void* parent);
+
+/**
+ * Function pointer type for copying an argument structure.
+ *
+ * Result objects created by `arg_result_create`, and the workers of
+ * `arg_parse_batch`, hold their own copy of each argument of the table.
+ * A clone function returns a new argument structure of the same type, with
+ * the same options, flags and current values as `parent`, but with its own
+ * storage for parsed values, so that parsing into the copy leaves `parent`
+ * untouched. The copy is released like any other argument, with
+ * `arg_freetable`.
+ *
+ * All argument types of the library provide a clone function in their
+ * `arg_hdr_ext` struct. Tables that contain a custom argument type without
+ * one cannot have result objects, and are parsed one job at a time by
+ * `arg_parse_batch`.
+ *
+ * @param parent Pointer to the argument structure to copy.
+ *
+ * @return Pointer to the new argument structure.
+ */
+typedef void*(arg_clonefn)(void* parent);
+
+/**
+ * Function pointer type for freeing a dynamically allocated string buffer.
+ *
+ * The `arg_dstr_freefn` type defines the signature for functions that release
+ * memory allocated for a string buffer managed by a dynamic string object
+ * (`arg_dstr_t`). This allows custom memory management strategies to be used
+ * when setting or replacing the contents of a dynamic string.
+ *
+ * You can provide a custom free function when calling `arg_dstr_set`, or use
+ * one of the standard macros (`ARG_DSTR_STATIC`, `ARG_DSTR_VOLATILE`,
+ * `ARG_DSTR_DYNAMIC`) to control how the buffer is released.
+ *
+ * @param buf Pointer to the string buffer to be freed.
+ *
+ * @see arg_dstr_set, ARG_DSTR_STATIC, ARG_DSTR_VOLATILE, ARG_DSTR_DYNAMIC
+ */
+typedef void(arg_dstr_freefn)(char* buf);
+
+/**
+ * Function pointer type for sub-command handler functions.
+ *
+ * The `arg_cmdfn` type defines the signature for functions that implement the
+ * logic of a sub-command in a multi-command command-line application. When a
+ * sub-command is dispatched (for example, via `arg_cmd_dispatch`), the
+ * corresponding handler function is called with the command-line arguments,
+ * a dynamic string buffer for output or error messages, and an optional
+ * user-defined context pointer.
+ *
+ * This function pointer is primarily intended for developers who want to
+ * implement custom sub-commands and register them with Argtable3. The handler
+ * should return 0 on success, or a nonzero error code on failure.
+ *
+ * @param argc The number of command-line arguments for the sub-command.
+ * @param argv The array of command-line arguments for the sub-command.
+ * @param res  Dynamic string buffer for output or error messages.
+ * @param ctx  User-defined context pointer, as provided during registration.
+ * @return 0 on success, or a nonzero error code on failure.
+ */
+typedef int (*arg_cmdfn)(int argc, char* argv[], arg_dstr_t res, void* ctx);
+
+/**
+ * Function pointer type for sub-command handlers that receive a parsed
+ * argument table.
+ *
+ * The `arg_cmdtablefn` type defines the signature of handlers registered with
+ * `arg_cmd_register_table`. Before the handler is called, the registry parses
+ * the command-line arguments into the sub-command's argument table with
+ * `arg_parse`, so the handler only has to check `nerrors` and read the results
+ * from the table. The last entry of the table is its `arg_end` struct, which
+ * can be passed to `arg_make_syntax_err_help_msg` or `arg_print_errors`.
+ *
+ * The table is owned by the registry. The handler must not free it, and must
+ * not keep pointers to its contents after returning, because the table is
+ * reset and reused by later dispatches.
+ *
+ * @param argc     The number of command-line arguments for the sub-command.
+ * @param argv     The array of command-line arguments for the sub-command.
+ * @param argtable The sub-command's argument table, already parsed.
+ * @param nerrors  The number of errors returned by `arg_parse`.
+ * @param res      Dynamic string buffer for output or error messages.
+ * @param ctx      User-defined context pointer, as provided during registration.
+ * @return 0 on success, or a nonzero error code on failure.
+ */
+typedef int (*arg_cmdtablefn)(int argc, char* argv[], void** argtable, int nerrors, arg_dstr_t res, void* ctx);
+
+/**
+ * Function pointer type for sub-command argument table factories.
+ *
+ * The `arg_cmdfactoryfn` type defines the signature of functions that build
+ * the argument table of a sub-command registered with `arg_cmd_register_table`.
+ * The factory is called the first time the sub-command is dispatched. It must
+ * return an array allocated with `malloc`, whose entries are created with the
+ * `arg_<type>` constructors and whose last entry is an `arg_end` struct. The
+ * registry releases the table with `arg_free` and `free`.
+ *
+ * If the factory returns NULL, or a table that fails `arg_nullcheck`, the
+ * handler is not called and the dispatch returns -1.
+ *
+ * @param ctx User-defined context pointer, as provided during registration.
+ * @return The new argument table, or NULL if it could not be allocated.
+ */
+typedef void** (*arg_cmdfactoryfn)(void* ctx);
+
+/**
+ * Function pointer type for custom comparison functions used in sorting.
+ *
+ * The `arg_comparefn` type defines the signature for functions that compare two
+ * elements, typically used with sorting algorithms such as `arg_mgsort`. The
+ * comparison function should return an integer less than, equal to, or greater
+ * than zero if the first argument is considered to be respectively less than,
+ * equal to, or greater than the second.
+ *
+ * This function pointer is primarily intended for developers who want to
+ * implement custom sorting or searching logic for arrays of arbitrary data
+ * types within Argtable3 or their own applications.
+ *
+ * @param k1 Pointer to the first element to compare.
+ * @param k2 Pointer to the second element to compare.
+ * @return Negative value if `k1` < `k2`, zero if `k1` == `k2`, positive value
+ *         if `k1` > `k2`.
+ *
+ * @see arg_mgsort
+ */
+typedef int(arg_comparefn)(const void* k1, const void* k2);
+
+/**
+ * Defines common properties shared by all `arg_<type>` structs.
+ *
+ * In the Argtable3 library, every `arg_<type>` struct must begin with an
+ * `arg_hdr` struct as its first member. This allows Argtable3 functions to
+ * access shared metadata about the command-line option, such as its option
+ * tags, data type string, glossary text, and other attributes.
+ *
+ * The `arg_hdr` struct also contains pointers to type-specific functions
+ * provided by each `arg_<type>` implementation. These functions handle tasks
+ * such as parsing the option, performing post-parse validation, and reporting
+ * errors. Although these function pointers are initialized by the constructor
+ * of the respective `arg_<type>` struct, they can be modified by the user after
+ * construction if necessary. However, they are intended to remain unchanged
+ * once initialized.
+ */
+typedef struct arg_hdr {
+    char flag;             /**< Modifier flags for this option (see `enum arg_hdr_flag`) */
+    const char* shortopts; /**< String listing the short option characters (e.g., "hv") */
+    const char* longopts;  /**< String listing the long option names, comma-separated (e.g., "verbose,debug") */
+    const char* datatype;  /**< Description of the argument data type (e.g., "<file>") */
+    const char* glossary;  /**< Description of the option as shown in the glossary/help output */
+    int mincount;          /**< Minimum number of occurrences of this option accepted */
+    int maxcount;          /**< Maximum number of occurrences of this option accepted */
+    void* parent;          /**< Pointer to the parent arg_<type> struct instance */
+    arg_resetfn* resetfn;  /**< Pointer to the type-specific reset function for this argument */
+    arg_scanfn* scanfn;    /**< Pointer to the type-specific scan (parsing) function */
+    arg_checkfn* checkfn;  /**< Pointer to the type-specific validation function */
+    arg_errorfn* errorfn;  /**< Pointer to the type-specific error reporting function */
+    void* priv;            /**< Pointer to private data for use by arg_<type> functions */
+} arg_hdr_t;
+
+/**
+ * Version of the `arg_hdr_ext` struct declared by this header.
+ */
+#define ARG_HDR_EXT_VERSION 1
+
+/**
+ * Optional type-specific functions of an argument entry.
+ *
+ * The `arg_hdr` struct is embedded at the start of every `arg_<type>` struct,
+ * so adding fields to it would move the fields of every argument type and
+ * break programs and custom argument types compiled against an older header.
+ * Functions that not every type needs are declared here instead. A type that
+ * provides them sets the `ARG_HASEXT` flag and points the `priv` field of its
+ * `arg_hdr` struct at a struct that starts with an `arg_hdr_ext` struct,
+ * either its own private data or, for types without private data, a static
+ * `arg_hdr_ext` struct shared by all its instances. Entries without the flag
+ * keep `priv` entirely to themselves, as before.
+ *
+ * The `version` field is set to `ARG_HDR_EXT_VERSION`. Fields added to this
+ * struct by later versions of the library are appended, and only read from
+ * structs whose version is high enough.
+ *
+ * Example usage:
+ * ```
+ * static const arg_hdr_ext_t my_ext = {ARG_HDR_EXT_VERSION, NULL, my_clonefn};
+ *
+ * my->hdr.flag |= ARG_HASEXT;
+ * my->hdr.priv = (void*)&my_ext;
+ * ```
+ */
+typedef struct arg_hdr_ext {
+    int version;          /**< `ARG_HDR_EXT_VERSION` of the header the type was compiled against */
+    arg_freefn* freefn;   /**< Function releasing the memory the argument owns, or NULL (see `arg_freefn`) */
+    arg_clonefn* clonefn; /**< Function copying the argument, or NULL (see `arg_clonefn`) */
+} arg_hdr_ext_t;
+
+/**
+ * Structure for storing remarks or custom lines in the syntax or glossary
+ * output.
+ *
+ * The `arg_rem` struct is used to add extra lines of text to the syntax or
+ * glossary output generated by Argtable3. Unlike other argument types,
+ * `arg_rem` does not correspond to a command-line argument and does not affect
+ * argument parsing. Instead, it is a dummy entry that allows you to insert
+ * remarks, explanations, or custom formatting into the help or usage messages.
+ *
+ * This is especially useful for providing additional context, grouping related
+ * options, or clarifying the usage of certain arguments in the generated
+ * documentation.
+ *
+ * Example usage:
+ * ```
+ * // Add extra lines to the glossary for the --update option
+ * arg_lit_t *update  = arg_litn("u", "update", 0, 1, "copy only when SOURCE files are");
+ * arg_rem_t *update1 = arg_rem(NULL,                 "  newer than destination files");
+ * arg_rem_t *update2 = arg_rem(NULL,                 "  or when destination files");
+ * arg_rem_t *update3 = arg_rem(NULL,                 "  are missing");
+ * void *argtable[] = { update, update1, update2, update3, ... };
+ *
+ * // Add a data type entry for a positional argument in the syntax
+ * arg_rem_t *dest = arg_rem("DEST|DIRECTORY", NULL);
+ * void *argtable[] = { ..., dest, ... };
+ * ```
+ *
+ * @see arg_rem()
+ */
+typedef struct arg_rem {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+} arg_rem_t;
+
+/**
+ * Structure for storing literal (boolean flag) argument information.
+ *
+ * The `arg_lit` struct is used to parse and store literal arguments (boolean
+ * flags) from the command line. It is suitable for options that do not take a
+ * value, such as `-h` for help or `--verbose` for enabling verbose output. Each
+ * occurrence of the flag increases the `count` field, allowing you to detect
+ * how many times the flag was specified.
+ *
+ * Example usage:
+ * ```
+ * // Accepts a help flag and a verbose flag (which can be specified multiple times)
+ * arg_lit_t *help    = arg_lit0("h", "help", "Display help");
+ * arg_lit_t *verbose = arg_litn("v", "verbose", 0, 3, "Increase verbosity");
+ * arg_end_t *end     = arg_end(20);
+ * void *argtable[] = { help, verbose, end };
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (help->count > 0) {
+ *     printf("Help requested\n");
+ * }
+ * if (verbose->count > 0) {
+ *     printf("Verbosity level: %d\n", verbose->count);
+ * }
+ * ```
+ *
+ * @see arg_lit0, arg_lit1, arg_litn
+ */
+typedef struct arg_lit {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this flag appears on the command line */
+} arg_lit_t;
+
+/**
+ * Structure for storing int-typed argument information.
+ *
+ * The `arg_int` struct is used to parse and store integer arguments from the
+ * command line. It is suitable for options that accept numeric values without
+ * fractional parts, such as counts, indices, or other whole-number parameters.
+ *
+ * The `count` field stores the number of successfully matched integer
+ * arguments, and the `ival` array holds the parsed integer values as provided
+ * by the user.
+ *
+ * Example usage:
+ * ```
+ * // Accepts one or more integer arguments
+ * arg_int_t *numbers = arg_intn("n", "number", "<int>", 1, 5, "Input numbers");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {numbers, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && numbers->count > 0) {
+ *     for (int i = 0; i < numbers->count; ++i) {
+ *         printf("Input number: %d\n", numbers->ival[i]);
+ *     }
+ * } else {
+ *     arg_print_errors(stdout, end, argv[0]);
+ * }
+ * ```
+ *
+ * @see arg_int0, arg_int1, arg_intn
+ */
+typedef struct arg_int {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this argument appears on the command line */
+    int* ival;          /**< Array of parsed integer argument values */
+} arg_int_t;
+
+/**
+ * Structure for storing 64-bit signed integer argument information.
+ *
+ * The `arg_int64` struct is the 64-bit counterpart of `arg_int`. It is meant
+ * for values that may exceed the range of `int`, such as byte counts, file
+ * offsets or identifiers, which would otherwise have to be taken as strings
+ * and converted a second time by the application.
+ *
+ * Values use the same grammar as `arg_int`: decimal, or hexadecimal, octal
+ * and binary with the `0x`, `0o` and `0b` prefixes, optionally followed by a
+ * `KB`, `MB`, `GB` or `TB` multiplier. Overflow is detected while the value
+ * is scanned, so out-of-range values are reported as errors instead of being
+ * silently clamped.
+ *
+ * Example usage:
+ * ```
+ * // Accepts an optional 64-bit offset, such as --offset=6GB
+ * arg_int64_t *offset = arg_int64n(NULL, "offset", "<n>", 0, 1, "Start offset");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {offset, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && offset->count > 0) {
+ *     printf("Offset: %lld\n", (long long)offset->ival[0]);
+ * }
+ * ```
+ *
+ * @see arg_int640, arg_int641, arg_int64n
+ */
+typedef struct arg_int64 {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this argument appears on the command line */
+    int64_t* ival;      /**< Array of parsed 64-bit integer argument values */
+} arg_int64_t;
+
+/**
+ * Structure for storing 64-bit unsigned integer argument information.
+ *
+ * The `arg_uint64` struct accepts the same grammar as `arg_int64`, but stores
+ * values in the range `0` to `2^64 - 1`. Negative values are rejected as
+ * invalid arguments rather than being wrapped around the way `strtoull()`
+ * would.
+ *
+ * Example usage:
+ * ```
+ * // Accepts up to 4 object identifiers, such as --id=0xFFFFFFFF00000000
+ * arg_uint64_t *ids = arg_uint64n(NULL, "id", "<id>", 0, 4, "Object identifier");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {ids, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0) {
+ *     for (int i = 0; i < ids->count; ++i) {
+ *         printf("Identifier: %llu\n", (unsigned long long)ids->uval[i]);
+ *     }
+ * }
+ * ```
+ *
+ * @see arg_uint640, arg_uint641, arg_uint64n
+ */
+typedef struct arg_uint64 {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this argument appears on the command line */
+    uint64_t* uval;     /**< Array of parsed 64-bit unsigned integer argument values */
+} arg_uint64_t;
+
+/**
+ * Structure for storing byte size argument information.
+ *
+ * The `arg_size` struct parses sizes such as `64MiB`, `10kB` or `4096`
+ * into a 64-bit byte count. Suffixes with an `i` are IEC binary multiples
+ * (`KiB`, `MiB`, `GiB`, `TiB`, `PiB`, `EiB`, powers of 1024); suffixes without
+ * it are SI decimal multiples (`kB`, `MB`, `GB`, `TB`, `PB`, `EB`, powers of
+ * 1000). A plain `B`, or no suffix at all, means bytes. Suffixes are case
+ * insensitive.
+ *
+ * Note that `arg_int` treats `KB`, `MB` and `GB` as powers of 1024 for
+ * historical reasons, whereas `arg_size` follows the SI meaning. Use the IEC
+ * suffixes when a binary multiple is intended.
+ *
+ * Example usage:
+ * ```
+ * arg_size_t *buffer = arg_size0("b", "buffer", "<size>", "Buffer size");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {buffer, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && buffer->count > 0) {
+ *     printf("Buffer: %llu bytes\n", (unsigned long long)buffer->bytes[0]);
+ * }
+ * ```
+ *
+ * @see arg_size0, arg_size1, arg_sizen
+ */
+typedef struct arg_size {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this argument appears on the command line */
+    uint64_t* bytes;    /**< Array of parsed sizes, in bytes */
+} arg_size_t;
+
+/**
+ * Structure for storing time duration argument information.
+ *
+ * The `arg_duration` struct parses durations such as `250ms`, `1.5s` or
+ * `1h30m` into a signed 64-bit count of nanoseconds. A duration is a sequence
+ * of decimal numbers, each with an optional fraction and a unit: `ns`, `us`
+ * (also written with a micro sign), `ms`, `s`, `m` or `h`. The whole duration
+ * may carry a leading `+` or `-` sign, and a plain `0` needs no unit. Units
+ * are case sensitive.
+ *
+ * Example usage:
+ * ```
+ * arg_duration_t *timeout = arg_duration0("t", "timeout", "<duration>", "Request timeout");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {timeout, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && timeout->count > 0) {
+ *     printf("Timeout: %lld ms\n", (long long)(timeout->nsec[0] / 1000000));
+ * }
+ * ```
+ *
+ * @see arg_duration0, arg_duration1, arg_durationn
+ */
+typedef struct arg_duration {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this argument appears on the command line */
+    int64_t* nsec;      /**< Array of parsed durations, in nanoseconds */
+} arg_duration_t;
+
+/**
+ * Structure describing a slice of a command-line string.
+ *
+ * A slice refers to `len` characters starting at `ptr`. The characters are not
+ * copied and are not NUL-terminated; they remain part of the original
+ * argument string, so a slice is valid for as long as that string is.
+ */
+typedef struct arg_slice {
+    const char* ptr; /**< First character of the slice */
+    size_t len;      /**< Number of characters in the slice */
+} arg_slice_t;
+
+/**
+ * Structure for storing integer list argument information.
+ *
+ * The `arg_intlist` struct parses values such as `--ids=1,2,3` into a list of
+ * integers. Each element accepts the same syntax as `arg_int`, including
+ * hexadecimal, octal and binary prefixes and the `KB`, `MB` and `GB` suffixes.
+ * The delimiter is chosen when the option is constructed.
+ *
+ * The elements of all occurrences of the option are stored one after another
+ * in the `ival` array, which holds `nvals` elements in total. The elements of
+ * the i-th occurrence are `ival[first[i]]` to `ival[first[i + 1] - 1]`, so
+ * `first[count]` always equals `nvals`.
+ *
+ * The `ival` array is allocated while parsing and released by
+ * `arg_freetable`. It may move when the option is parsed again, so pointers
+ * into it must not be kept across calls to `arg_parse`.
+ *
+ * Example usage:
+ * ```
+ * arg_intlist_t *ids = arg_intlist1(NULL, "ids", "<ids>", ',', "Job identifiers");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {ids, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0) {
+ *     for (int i = 0; i < ids->nvals; i++)
+ *         printf("job %d\n", ids->ival[i]);
+ * }
+ * ```
+ *
+ * @see arg_intlist0, arg_intlist1, arg_intlistn
+ */
+typedef struct arg_intlist {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this argument appears on the command line */
+    int nvals;          /**< Total number of list elements over all occurrences */
+    int* first;         /**< Index in `ival` of the first element of each occurrence */
+    int* ival;          /**< Array of the list elements of all occurrences */
+} arg_intlist_t;
+
+/**
+ * Structure for storing double list argument information.
+ *
+ * The `arg_dbllist` struct parses values such as `--weights=0.5,1.25` into a
+ * list of doubles. Each element accepts the same syntax as `arg_dbl`. The
+ * elements are stored in the `dval` array, laid out as described for
+ * `arg_intlist`.
+ *
+ * @see arg_dbllist0, arg_dbllist1, arg_dbllistn, arg_intlist
+ */
+typedef struct arg_dbllist {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this argument appears on the command line */
+    int nvals;          /**< Total number of list elements over all occurrences */
+    int* first;         /**< Index in `dval` of the first element of each occurrence */
+    double* dval;       /**< Array of the list elements of all occurrences */
+} arg_dbllist_t;
+
+/**
+ * Structure for storing string list argument information.
+ *
+ * The `arg_strlist` struct splits values such as `--tags=red,green,blue` into
+ * a list of strings. The elements are stored in the `sval` array, laid out as
+ * described for `arg_intlist`. Each element is a slice of the argument
+ * string it was found in, so no string is copied; the slices are valid for
+ * as long as the strings passed to `arg_parse` are. Empty elements are kept.
+ *
+ * Example usage:
+ * ```
+ * arg_strlist_t *tags = arg_strlist0(NULL, "tags", "<tags>", ',', "Tags to apply");
+ *
+ * // after parsing --tags=red,green
+ * for (int i = 0; i < tags->nvals; i++)
+ *     printf("%.*s\n", (int)tags->sval[i].len, tags->sval[i].ptr);
+ * ```
+ *
+ * @see arg_strlist0, arg_strlist1, arg_strlistn, arg_intlist
+ */
+typedef struct arg_strlist {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this argument appears on the command line */
+    int nvals;          /**< Total number of list elements over all occurrences */
+    int* first;         /**< Index in `sval` of the first element of each occurrence */
+    arg_slice_t* sval;  /**< Array of the list elements of all occurrences */
+} arg_strlist_t;
+
+/**
+ * Structure for storing double-typed argument information.
+ *
+ * The `arg_dbl` struct is used to parse and store double-precision
+ * floating-point arguments from the command line. It is suitable for options
+ * that accept numeric values with fractional parts, such as thresholds, ratios,
+ * or measurements.
+ *
+ * The `count` field stores the number of successfully matched double arguments,
+ * and the `dval` array holds the parsed double values as provided by the user.
+ *
+ * Example usage:
+ * ```
+ * // Accepts one or more double arguments
+ * arg_dbl_t *values = arg_dbln("v", "value", "<double>", 1, 5, "Input values");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {values, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && values->count > 0) {
+ *     for (int i = 0; i < values->count; ++i) {
+ *         printf("Input value: %f\n", values->dval[i]);
+ *     }
+ * } else {
+ *     arg_print_errors(stdout, end, argv[0]);
+ * }
+ * ```
+ *
+ * @see arg_dbl0, arg_dbl1, arg_dbln
+ */
+typedef struct arg_dbl {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this argument appears on the command line */
+    double* dval;       /**< Array of parsed double argument values */
+} arg_dbl_t;
+
+/**
+ * Structure for storing string-typed argument information.
+ *
+ * The `arg_str` struct is used to parse and store string arguments from the
+ * command line. It is suitable for options that accept arbitrary text input,
+ * such as file names, user names, or other string values.
+ *
+ * The `count` field stores the number of successfully matched string arguments,
+ * and the `sval` array holds the parsed string values as provided by the user.
+ *
+ * Example usage:
+ * ```
+ * // Accepts one or more string arguments
+ * arg_str_t *inputs = arg_strn(NULL, NULL, "<input>", 1, 10, "Input strings");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {inputs, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && inputs->count > 0) {
+ *     for (int i = 0; i < inputs->count; ++i) {
+ *         printf("Input string: %s\n", inputs->sval[i]);
+ *     }
+ * } else {
+ *     arg_print_errors(stdout, end, argv[0]);
+ * }
+ * ```
+ *
+ * @see arg_str0, arg_str1, arg_strn
+ */
+typedef struct arg_str {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this argument appears on the command line */
+    const char** sval;  /**< Array of parsed string argument values */
+} arg_str_t;
+
+/**
+ * Structure for storing regular expression-typed argument information.
+ *
+ * The `arg_rex` struct is used to parse and store command-line arguments that
+ * must match a specified regular expression pattern. This allows applications
+ * to validate input against complex patterns, such as email addresses,
+ * identifiers, or custom formats.
+ *
+ * The `pattern` is specified when constructing the argument and is used to
+ * check each input value. The `count` field stores the number of successfully
+ * matched arguments, and the `sval` array holds the matched strings.
+ *
+ * Example usage:
+ * ```
+ * // Accepts one or more arguments matching a simple email pattern
+ * arg_rex_t *emails = arg_rexn(NULL, "email", "^[^@]+@[^@]+\\.[^@]+$", "<email>", 1, 10, 0, "Email addresses");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {emails, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && emails->count > 0) {
+ *     for (int i = 0; i < emails->count; ++i) {
+ *         printf("Matched email: %s\n", emails->sval[i]);
+ *     }
+ * } else {
+ *     arg_print_errors(stdout, end, argv[0]);
+ * }
+ * ```
+ *
+ * @see arg_rex0, arg_rex1, arg_rexn
+ */
+typedef struct arg_rex {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this argument appears on the command line */
+    const char** sval;  /**< Array of parsed string argument values */
+} arg_rex_t;
+
+/**
+ * Structure for storing enumerated choice argument information.
+ *
+ * The `arg_enum` struct accepts one of a fixed set of strings, such as the
+ * `fast`, `safe` and `debug` values of a `--mode` option. Instead of the
+ * matched string, the `idx` array stores its index in the array of choices
+ * passed to the constructor, ready to be used in a `switch` statement.
+ *
+ * The choices are placed in a minimal perfect hash table when the argument is
+ * constructed, so each value is matched with one hash computation and one
+ * string comparison, however many choices there are.
+ *
+ * Example usage:
+ * ```
+ * static const char* modes[] = {"fast", "safe", "debug", NULL};
+ * arg_enum_t *mode = arg_enum0("m", "mode", modes, NULL, 0, "Run mode");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {mode, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && mode->count > 0) {
+ *     printf("Mode: %s\n", modes[mode->idx[0]]);
+ * }
+ * ```
+ *
+ * @see arg_enum0, arg_enum1, arg_enumn
+ */
+typedef struct arg_enum {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    int count;          /**< Number of times this argument appears on the command line */
+    int* idx;           /**< Array of indices of the matched values in the array of choices */
+} arg_enum_t;
+
+/**
+ * Structure describing where the parts of a file path lie.
+ *
+ * The offsets are in bytes from the start of the filename. The basename runs
+ * from `basename` to `length` and the extension from `extension` to `length`,
+ * so their lengths are `length - basename` and `length - extension`. An
+ * empty basename or extension starts at `length`.
+ */
+typedef struct arg_file_span {
+    size_t length;    /**< Length of the filename, in bytes */
+    size_t basename;  /**< Offset of the basename within the filename */
+    size_t extension; /**< Offset of the extension within the filename */
+} arg_file_span_t;
+
+/**
+ * Structure for storing file-typed argument information.
+ *
+ * The `arg_file` struct is used to parse and store file path arguments from the
+ * command line. It provides convenient access to the full filename, the
+ * basename (file name without path), and the file extension for each matched
+ * argument. This allows applications to easily process and validate
+ * file-related options.
+ *
+ * The `count` field stores the number of successfully matched file arguments.
+ * The `filename` array holds the full file paths as provided by the user, while
+ * the `basename` and `extension` arrays provide the corresponding file names
+ * and extensions, respectively.
+ *
+ * The `span` array holds the length of each filename and the offsets of its
+ * basename and extension, found with a single backward scan of the path when
+ * the argument is parsed. Code that needs these lengths can read them from
+ * `span` instead of calling `strlen` on the strings again.
+ *
+ * Example usage:
+ * ```
+ * // Accepts one or more file arguments
+ * arg_file_t *files = arg_filen(NULL, NULL, "<file>", 1, 100, "Input files");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {files, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && files->count > 0) {
+ *     for (int i = 0; i < files->count; ++i) {
+ *         printf("File: %s, Basename: %s, Extension: %s\n",
+ *             files->filename[i], files->basename[i], files->extension[i]);
+ *     }
+ * } else {
+ *     arg_print_errors(stdout, end, argv[0]);
+ * }
+ * ```
+ *
+ * @see arg_file0, arg_file1, arg_filen
+ */
+typedef struct arg_file {
+    struct arg_hdr hdr;     /**< The mandatory argtable header struct */
+    int count;              /**< Number of times this argument appears on the command line */
+    const char** filename;  /**< Array of parsed file path values (e.g., /home/foo.bar) */
+    const char** basename;  /**< Array of parsed base names (e.g., foo.bar) */
+    const char** extension; /**< Array of parsed file extensions (e.g., .bar) */
+    arg_file_span_t* span;  /**< Array of filename lengths and basename and extension offsets */
+} arg_file_t;
+
+/**
+ * Structure for storing date-typed argument information.
+ *
+ * The `arg_date` struct is used to parse and store date or time arguments from
+ * the command line. It supports flexible date/time formats, which are specified
+ * using a `strptime`-style format string. Each successfully parsed date
+ * argument is converted into a `struct tm` value and stored in the `tmval`
+ * array.
+ *
+ * The `format` field defines the expected input format for date arguments,
+ * allowing you to accept a wide range of date/time styles. The `count` field
+ * stores the number of successfully matched arguments, and the `tmval` array
+ * holds the parsed results.
+ *
+ * The format is compiled when the argument is constructed into a short
+ * program of literal runs and bounded numeric fields, so an invalid format is
+ * reported by the constructor rather than on every parse, and each value is
+ * scanned without interpreting the format string again. The common ISO-8601
+ * formats `"%Y-%m-%d"`, `"%H:%M:%S"` and `"%Y-%m-%dT%H:%M:%S"` (also with a
+ * space or `%T`) have a further fast path for values in canonical form.
+ * The `ARG_DATE_ISO8601` format additionally accepts fractional seconds and a
+ * UTC offset, as described for `arg_daten`.
+ *
+ * Arguments created with `arg_epochn` store each value in the `nsec` array as
+ * nanoseconds since 1970-01-01 00:00:00 UTC instead, and leave `tmval`
+ * `NULL`. This needs 8 bytes per value instead of a `struct tm`, which suits
+ * options that take many timestamps.
+ *
+ * Example usage:
+ * ```
+ * // Accepts one required date argument in YYYY-MM-DD format
+ * arg_date_t *date = arg_date1(NULL, "date", "%Y-%m-%d", "<date>", "Date in YYYY-MM-DD format");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {date, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && date->count > 0) {
+ *     printf("Parsed date: %04d-%02d-%02d\n",
+ *         date->tmval[0].tm_year + 1900, date->tmval[0].tm_mon + 1, date->tmval[0].tm_mday);
+ * } else {
+ *     arg_print_errors(stdout, end, argv[0]);
+ * }
+ * ```
+ *
+ * @see arg_date0, arg_date1, arg_daten
+ */
+typedef struct arg_date {
+    struct arg_hdr hdr; /**< The mandatory argtable header struct */
+    const char* format; /**< strptime format string used to parse the date */
+    int count;          /**< Number of times this argument appears on the command line */
+    struct tm* tmval;   /**< Array of parsed time values, or NULL for `arg_epochn` */
+    int64_t* nsec;      /**< Array of parsed times in nanoseconds since the epoch, or NULL for `arg_daten` */
+} arg_date_t;
+
+/**
+ * Structure for collecting parser errors and terminating an argument table.
+ *
+ * The `arg_end` struct is used in Argtable3 to mark the end of an argument
+ * table and to collect information about any errors encountered during
+ * command-line parsing. It stores pointers to offending arguments in the input
+ * array, allowing the application to report detailed error messages to the
+ * user.
+ *
+ * Typically, an `arg_end_t` instance is created using the `arg_end` function
+ * and placed as the last element in the argument table array. After parsing,
+ * the structure contains information about missing required arguments, invalid
+ * values, or other parsing errors.
+ *
+ * Example usage:
+ * ```
+ * arg_lit_t *help = arg_lit0("h", "help", "Display help");
+ * arg_int_t *count = arg_int0("c", "count", "<n>", "Number of times");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {help, count, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors > 0) {
+ *     arg_print_errors(stdout, end, argv[0]); // handle errors...
+ * }
+ * ```
+ */
+typedef struct arg_end {
+    struct arg_hdr hdr;  /**< The mandatory argtable header struct */
+    int count;           /**< Number of errors encountered */
+    int* error;          /**< Array of error codes */
+    void** parent;       /**< Array of pointers to offending arg_<type> struct */
+    const char** argval; /**< Array of pointers to offending argv[] string */
+} arg_end_t;
+
+/**
+ * Structure for collecting the results of one argument over a batch parse.
+ *
+ * An `arg_column` tells `arg_parse_batch` which member of an argument struct
+ * to copy out after each job, and where to store it. The results of all jobs
+ * are laid out as a struct-of-arrays: `counts[j]` receives the count of job
+ * `j`, and `values[j * nvalues]` to `values[j * nvalues + nvalues - 1]`
+ * receive its first `nvalues` values, with unused slots zero-filled.
+ *
+ * Columns are filled in with the `ARG_COLUMN`, `ARG_COLUMN_LIST` and
+ * `ARG_COLUMN_COUNT` macros, which take the address of the `count` and value
+ * array members of the argument, so any argument type works, including the
+ * `arg_end` of the table to collect the error codes of each job:
+ * ```
+ * arg_column_t cols[3];
+ * ARG_COLUMN(&cols[0], level, ival, 1, nlevel, levels);   // int levels[njobs]
+ * ARG_COLUMN_COUNT(&cols[1], verbose, nverbose);          // flag counts only
+ * ARG_COLUMN(&cols[2], end, error, 4, nerrors, errors);   // int errors[njobs * 4]
+ * ```
+ *
+ * @see arg_parse_batch
+ */
+typedef struct arg_column {
+    void* arg;         /**< Argument of the table whose results are collected */
+    const int* count;  /**< Address of the member of `arg` holding the number of values */
+    const void* field; /**< Address of the member of `arg` pointing to the value array, or NULL */
+    size_t size;       /**< Size of one value, in bytes */
+    int nvalues;       /**< Number of values kept per job */
+    int* counts;       /**< Receives the number of values of each job, or NULL */
+    void* values;      /**< Receives `nvalues` values per job, or NULL */
+} arg_column_t;
+
+/**
+ * Describes a column of counts and values of an argument, for
+ * `arg_parse_batch`. `member` names the value array of the argument struct,
+ * such as `ival`, `dval` or `sval`.
+ */
+#define ARG_COLUMN(column, parg, member, n, pcounts, pvalues)                                                                          \
+    ((column)->arg = (parg), (column)->count = &(parg)->count, (column)->field = (const void*)&(parg)->member,                         \
+     (column)->size = sizeof(*(parg)->member), (column)->nvalues = (n), (column)->counts = (pcounts), (column)->values = (pvalues))
+
+/**
+ * Describes a column of a list argument, for `arg_parse_batch`. The counts
+ * are the number of list elements over all occurrences rather than the
+ * number of occurrences.
+ */
+#define ARG_COLUMN_LIST(column, parg, member, n, pcounts, pvalues)                                                                     \
+    ((column)->arg = (parg), (column)->count = &(parg)->nvals, (column)->field = (const void*)&(parg)->member,                         \
+     (column)->size = sizeof(*(parg)->member), (column)->nvalues = (n), (column)->counts = (pcounts), (column)->values = (pvalues))
+
+/**
+ * Describes a column of the counts of an argument, for `arg_parse_batch`.
+ */
+#define ARG_COLUMN_COUNT(column, parg, pcounts)                                                                                        \
+    ((column)->arg = (parg), (column)->count = &(parg)->count, (column)->field = NULL, (column)->size = 0, (column)->nvalues = 0,      \
+     (column)->counts = (pcounts), (column)->values = NULL)
+
+/**
+ * Edits of the command line of an incremental parse.
+ *
+ * @see arg_session_edit
+ */
+enum arg_edit {
+    ARG_EDIT_INSERT, /**< Insert a token before `argv[index]`, or after the last one if `index` is `argc` */
+    ARG_EDIT_REMOVE, /**< Remove `argv[index]` */
+    ARG_EDIT_REPLACE /**< Replace `argv[index]` with a new token */
+};
+
+/**
+ * Kinds of constraints between the options of an argument table.
+ *
+ * @see arg_end_constrain
+ */
+enum arg_constraint {
+    ARG_CONSTRAINT_EXCLUSIVE = 1, /**< At most one of the options may be given */
+    ARG_CONSTRAINT_REQUIRES,      /**< The first option may only be given together with all the others */
+    ARG_CONSTRAINT_ANYOF          /**< At least one of the options must be given */
+};
+
+/**
+ * Structure for storing sub-command information.
+ *
+ * The `arg_cmd_info` struct is used to represent metadata and handler
+ * information for a sub-command in a multi-command command-line application.
+ * Each sub-command can have its own name, description, handler function, and
+ * context pointer, allowing you to build flexible interfaces similar to tools
+ * like `git` or `docker`.
+ *
+ * The `name` field stores the sub-command name, while the `description`
+ * provides a short summary for help and usage messages. The `proc` field is a
+ * pointer to the function that implements the sub-command's behavior, and `ctx`
+ * is a user-defined context pointer that can be used to pass additional data to
+ * the handler.
+ *
+ * By default, `name` and `description` are fixed-size arrays of
+ * `ARG_CMD_NAME_LEN` and `ARG_CMD_DESCRIPTION_LEN` bytes. When the library is
+ * built with `ARG_CMD_COMPACT` set to 1, they are instead pointers to strings
+ * interned in a string arena owned by the registry. Identical strings are
+ * stored once, there is no length limit, and the strings remain valid until
+ * `arg_cmd_uninit` is called. This mode is intended for applications that
+ * register very large numbers of commands.
+ *
+ * Example usage:
+ * ```
+ * // Define a handler function for the "list" sub-command
+ * int list_cmd(int argc, char* argv[], arg_dstr_t res, void* ctx) {
+ *     // Implementation for the "list" command
+ *     return 0;
+ * }
+ *
+ * // Register the sub-command
+ * arg_cmd_register("list", list_cmd, "List all items", NULL);
+ *
+ * // Retrieve sub-command info
+ * arg_cmd_info_t* info = arg_cmd_info("list");
+ * if (info) {
+ *     printf("Sub-command: %s - %s\n", info->name, info->description);
+ * }
+ * ```
+ *
+ * @see arg_cmd_register, arg_cmd_info, arg_cmd_dispatch
+ */
+typedef struct arg_cmd_info {
+#if ARG_CMD_COMPACT
+    const char* name;                          /**< Sub-command name, interned in the registry */
+    const char* description;                   /**< Short description of the sub-command, interned in the registry */
+#else
+    char name[ARG_CMD_NAME_LEN];               /**< Sub-command name */
+    char description[ARG_CMD_DESCRIPTION_LEN]; /**< Short description of the sub-command */
+#endif
+    arg_cmdfn proc;                            /**< Sub-command handler function */
+    void* ctx;                                 /**< Context pointer passed to `proc` (the user-defined one, or the registry's state for `arg_cmd_register_table`) */
+    int flags;                                 /**< Sub-command attributes (see `enum arg_cmd_flag`) */
+    void* priv;                                /**< Private data of the registry (argument table state, see `arg_cmd_register_table`) */
+} arg_cmd_info_t;
+
+/**
+ * Attributes of a registered sub-command.
+ *
+ * @see arg_cmd_set_flags, arg_cmd_batch_run
+ */
+enum arg_cmd_flag {
+    ARG_CMD_INDEPENDENT = 0x1 /**< The command neither depends on nor affects other commands, so batches may run it in parallel */
+};
+
+/**
+ * Structure for storing one command of a batch script.
+ *
+ * The `arg_cmd_batch_entry` struct describes a single command line of a
+ * script loaded with `arg_cmd_batch_load` or `arg_cmd_batch_create`. The
+ * `argv` strings point into the script buffer, and `argv[0]` is the name of
+ * the sub-command. After `arg_cmd_batch_run`, `ret` and `res` hold the
+ * handler's return code and output, and `elapsed` holds the time the handler
+ * took, in seconds.
+ *
+ * @see arg_cmd_batch_load, arg_cmd_batch_run, arg_cmd_batch_entry
+ */
+typedef struct arg_cmd_batch_entry {
+    int line;       /**< Line number of the command in the script, starting at 1 */
+    int argc;       /**< Number of words on the command line */
+    char** argv;    /**< Null-terminated array of words, argv[0] is the sub-command name */
+    int ret;        /**< Return code of the sub-command handler */
+    arg_dstr_t res; /**< Output written by the sub-command handler */
+    double elapsed; /**< Wall-clock time spent in the handler, in seconds */
+} arg_cmd_batch_entry_t;
+
+/**** arg_<type> constructor functions *********************************/
+
+/**
+ * Adds a remark or custom line to the syntax or glossary output.
+ *
+ * The `arg_rem` function allows you to insert extra lines of text into the
+ * syntax or glossary output generated by Argtable3. Instead of embedding
+ * newline characters directly in your argument table strings—which can make
+ * the code messy—you can add `arg_rem` structs to your argument table. These
+ * are dummy entries: they do not affect argument parsing, but their `datatype`
+ * and `glossary` strings are included in the output of `arg_print_syntax` and
+ * `arg_print_glossary`.
+ *
+ * The name `arg_rem` stands for *remark*, inspired by the `REM` statement in
+ * the BASIC programming language.
+ *
+ * For example, in the `mv` example program, we use `arg_rem` to add additional
+ * lines for the `-u|--update` option in the glossary:
+ * ```
+ * arg_lit_t *update  = arg_litn("u", "update", 0, 1, "copy only when SOURCE files are");
+ * arg_rem_t *update1 = arg_rem(NULL,                 "  newer than destination files");
+ * arg_rem_t *update1 = arg_rem(NULL,                 "  or when destination files");
+ * arg_rem_t *update2 = arg_rem(NULL,                 "  are missing");
+ * ```
+ *
+ * which will make the glossay look like:
+ * ```
+ *   -u, --update                   copy only when SOURCE files are
+ *                                    newer than destination files
+ *                                    or when the destination files
+ *                                    are missing
+ * ```
+ *
+ * We also use `arg_rem` to add a data type entry for the ordinary argument in
+ * the syntax:
+ * ```
+ * arg_rem_t *dest = arg_rem ("DEST|DIRECTORY", NULL);
+ * ```
+ *
+ * which will make the syntax look like:
+ * ```
+ * $ mv --help
+ * Usage: mv [-bfiuv] [--backup=[CONTROL]] [--reply={yes,no,query}]
+ * [--strip-trailing-slashes] [-S SUFFIX] [--target-directory=DIRECTORY]
+ * [--help] [--version] SOURCE [SOURCE]... DEST|DIRECTORY
+ * ```
+ *
+ * @param datatype  The data type or positional argument string to display in the
+ *                  syntax output, or NULL if not needed.
+ * @param glossary  The remark or extra line to display in the glossary output,
+ *                  or NULL if not needed.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_rem_t`. Otherwise,
+ *   returns `NULL` if there is insufficient memory available.
+ */
+ARG_EXTERN arg_rem_t* arg_rem(const char* datatype, const char* glossary);
+
+/**
+ * Creates a literal (boolean flag) argument for the command-line parser.
+ *
+ * The `arg_litn` function defines an option that does not take a value, such as
+ * a boolean flag (e.g., `-h` for help or `--verbose` for verbosity). You can
+ * specify the minimum and maximum number of times the flag can appear, making
+ * it suitable for optional, required, or repeatable flags. Each occurrence of
+ * the flag increases the `count` field in the resulting `arg_lit_t` struct.
+ *
+ * A classic example is the `tar` utility, which uses `--verbose` or `-v` to
+ * show the files being worked on as `tar` is creating an archive:
+ * ```
+ * $ tar -cvf afiles.tar apple angst aspic
+ * apple
+ * angst
+ * aspic
+ * ```
+ *
+ * Each occurrence of `--verbose` or `-v` on the command line increases the
+ * verbosity level by one. Therefore, if you need more details on the output,
+ * specify it twice:
+ * ```
+ * $ tar -cvvf afiles.tar apple angst aspic
+ * -rw-r--r-- gray/staff    62373 2006-06-09 12:06 apple
+ * -rw-r--r-- gray/staff    11481 2006-06-09 12:06 angst
+ * -rw-r--r-- gray/staff    23152 2006-06-09 12:06 aspic
+ * ```
+ *
+ * The `arg_litn` function allows you to specify both the minimum and maximum
+ * number of times a flag can appear. For convenience and backward
+ * compatibility, `arg_lit0` is provided as a helper for optional flags
+ * (where `mincount = 0` and `maxcount = 1`), and `arg_lit1` is a helper for
+ * required flags (where `mincount = 1` and `maxcount = 1`). While `arg_lit0`
+ * and `arg_lit1` are available, it is recommended to use `arg_litn` in new
+ * code as it is more explicit and flexible.
+ *
+ * Example usage:
+ * ```
+ * arg_lit_t *list    = arg_litn("lL",NULL,           0, 1, "list files");
+ * arg_lit_t *verbose = arg_litn("v","verbose,debug", 0, 3, "verbosity level");
+ * arg_lit_t *help    = arg_litn("h","help",          0, 1, "print this help");
+ * arg_lit_t *version = arg_litn(NULL,"version",      0, 1, "print version info");
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short option
+ *                  name (e.g., `"v"` for `-v`). Pass `NULL` if no short option is
+ *                  desired.
+ * @param longopts  A string of comma-separated long option names (e.g.,
+ *                  `"verbose"` for `--verbose`). Pass `NULL` if no long option is
+ *                  desired.
+ * @param mincount  The minimum number of times the flag must appear (set to 0 for
+ *                  optional).
+ * @param maxcount  The maximum number of times the flag can appear (controls memory
+ *                  allocation).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_lit_t`. Returns
+ *   `NULL` if there is insufficient memory.
+ */
+ARG_EXTERN arg_lit_t* arg_litn(const char* shortopts, const char* longopts, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_lit_t* arg_lit0(const char* shortopts, const char* longopts, const char* glossary);
+ARG_EXTERN arg_lit_t* arg_lit1(const char* shortopts, const char* longopts, const char* glossary);
+
+/**
+ * Creates an integer argument for the command-line parser.
+ *
+ * The `arg_intn` function defines an option that accepts integer values from
+ * the command line. You can specify the minimum and maximum number of times the
+ * argument can appear, making it suitable for optional, required, or repeatable
+ * integer options. Each occurrence of the option is parsed and stored in the
+ * `ival` array of the resulting `arg_int_t` struct, allowing you to retrieve
+ * all provided integer values after parsing.
+ *
+ * For convenience and backward compatibility, `arg_int0` is provided as a
+ * helper for optional integer arguments (where `mincount = 0` and
+ * `maxcount = 1`), and `arg_int1` is a helper for required integer arguments
+ * (where `mincount = 1` and `maxcount = 1`). While `arg_int0` and `arg_int1`
+ * are available, it is recommended to use `arg_intn` in new code as it is more
+ * explicit and flexible.
+ *
+ * Example usage:
+ * ```
+ * // Accepts one or more integer arguments
+ * arg_int_t *numbers = arg_intn("n", "number", "<int>", 1, 5, "Input numbers");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = { numbers, end };
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && numbers->count > 0) {
+ *     for (int i = 0; i < numbers->count; ++i) {
+ *         printf("Input number: %d\n", numbers->ival[i]);
+ *     }
+ * } else {
+ *     arg_print_errors(stdout, end, argv[0]);
+ * }
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name (e.g., `"n"` for `-n`). Pass `NULL` if no short
+ *                  option is desired.
+ * @param longopts  A string of comma-separated long option names (e.g.,
+ *                  `"number"` for `--number`). Pass `NULL` if no long option is
+ *                  desired.
+ * @param datatype  A string describing the expected data type (e.g., `"<int>"`),
+ *                  shown in help messages.
+ * @param mincount  The minimum number of times the argument must appear (set to 0
+ *                  for optional).
+ * @param maxcount  The maximum number of times the argument can appear (controls
+ *                  memory allocation).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_int_t`. Returns
+ *   `NULL` if there is insufficient memory.
+ */
+ARG_EXTERN arg_int_t* arg_intn(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_int_t* arg_int0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+ARG_EXTERN arg_int_t* arg_int1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+
+/**
+ * Creates a 64-bit signed integer argument for the command-line parser.
+ *
+ * The `arg_int64n` function works like `arg_intn`, but stores each value in
+ * the `int64_t` array `ival` of the resulting `arg_int64_t` struct. Values may
+ * use the hexadecimal (`0x`), octal (`0o`) and binary (`0b`) prefixes, and the
+ * `KB`, `MB`, `GB` and `TB` multipliers (powers of 1024). A value that does not
+ * fit in 64 bits, including after the multiplier is applied, is reported as
+ * an integer overflow error.
+ *
+ * `arg_int640` and `arg_int641` are helpers for optional and required
+ * arguments that may appear at most once.
+ *
+ * Example usage:
+ * ```
+ * arg_int64_t *limit = arg_int64n("l", "limit", "<bytes>", 1, 1, "Size limit");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {limit, end};
+ *
+ * // --limit=8GB stores 8589934592 in limit->ival[0]
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name. Pass `NULL` if no short option is desired.
+ * @param longopts  A string of comma-separated long option names. Pass `NULL`
+ *                  if no long option is desired.
+ * @param datatype  A string describing the expected data type, shown in help
+ *                  messages. Defaults to `"<int64>"` if `NULL`.
+ * @param mincount  The minimum number of times the argument must appear (set to 0
+ *                  for optional).
+ * @param maxcount  The maximum number of times the argument can appear (controls
+ *                  memory allocation).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_int64_t`. Returns
+ *   `NULL` if there is insufficient memory.
+ */
+ARG_EXTERN arg_int64_t* arg_int64n(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_int64_t* arg_int640(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+ARG_EXTERN arg_int64_t* arg_int641(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+
+/**
+ * Creates a 64-bit unsigned integer argument for the command-line parser.
+ *
+ * The `arg_uint64n` function accepts the same value grammar as `arg_int64n`
+ * and stores each value in the `uint64_t` array `uval` of the resulting
+ * `arg_uint64_t` struct. Values up to `2^64 - 1` are accepted. A negative
+ * value (other than `-0`) is reported as an invalid argument, and a value
+ * larger than `2^64 - 1` as an integer overflow.
+ *
+ * `arg_uint640` and `arg_uint641` are helpers for optional and required
+ * arguments that may appear at most once.
+ *
+ * Example usage:
+ * ```
+ * arg_uint64_t *seed = arg_uint640(NULL, "seed", "<n>", "Random seed");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {seed, end};
+ *
+ * // --seed=0xFFFFFFFFFFFFFFFF stores 18446744073709551615 in seed->uval[0]
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name. Pass `NULL` if no short option is desired.
+ * @param longopts  A string of comma-separated long option names. Pass `NULL`
+ *                  if no long option is desired.
+ * @param datatype  A string describing the expected data type, shown in help
+ *                  messages. Defaults to `"<uint64>"` if `NULL`.
+ * @param mincount  The minimum number of times the argument must appear (set to 0
+ *                  for optional).
+ * @param maxcount  The maximum number of times the argument can appear (controls
+ *                  memory allocation).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_uint64_t`. Returns
+ *   `NULL` if there is insufficient memory.
+ */
+ARG_EXTERN arg_uint64_t* arg_uint64n(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_uint64_t* arg_uint640(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+ARG_EXTERN arg_uint64_t* arg_uint641(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+
+/**
+ * Creates a byte size argument for the command-line parser.
+ *
+ * The `arg_sizen` function defines an option that accepts sizes written as a
+ * whole decimal number with an optional SI (`kB`, `MB`, ... `EB`) or IEC
+ * (`KiB`, `MiB`, ... `EiB`) suffix.
+ * Each value is converted to a byte count and stored in the `bytes` array of
+ * the resulting `arg_size_t` struct. A size that does not fit in 64 bits is
+ * reported as an integer overflow error, and malformed text, including a
+ * negative size, as an invalid argument.
+ *
+ * `arg_size0` and `arg_size1` are helpers for optional and required
+ * arguments that may appear at most once.
+ *
+ * Example usage:
+ * ```
+ * arg_size_t *cache = arg_sizen(NULL, "cache", "<size>", 0, 1, "Cache size");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {cache, end};
+ *
+ * // --cache=64MiB stores 67108864 in cache->bytes[0]
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name. Pass `NULL` if no short option is desired.
+ * @param longopts  A string of comma-separated long option names. Pass `NULL`
+ *                  if no long option is desired.
+ * @param datatype  A string describing the expected data type, shown in help
+ *                  messages. Defaults to `"<size>"` if `NULL`.
+ * @param mincount  The minimum number of times the argument must appear (set to 0
+ *                  for optional).
+ * @param maxcount  The maximum number of times the argument can appear (controls
+ *                  memory allocation).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_size_t`. Returns
+ *   `NULL` if there is insufficient memory.
+ */
+ARG_EXTERN arg_size_t* arg_sizen(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_size_t* arg_size0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+ARG_EXTERN arg_size_t* arg_size1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+
+/**
+ * Creates a time duration argument for the command-line parser.
+ *
+ * The `arg_durationn` function defines an option that accepts durations made
+ * of one or more number and unit pairs, such as `90s`, `1h30m` or `0.25ms`.
+ * Each value is converted to nanoseconds and stored in the `nsec` array of the
+ * resulting `arg_duration_t` struct. Fractions of any length are resolved
+ * exactly to whole nanoseconds, rounding toward zero. A duration outside the range of
+ * `int64_t` (about 292 years) is reported as an integer overflow error, and
+ * malformed text, such as a missing or unknown unit, as an invalid argument.
+ *
+ * `arg_duration0` and `arg_duration1` are helpers for optional and required
+ * arguments that may appear at most once.
+ *
+ * Example usage:
+ * ```
+ * arg_duration_t *ttl = arg_durationn(NULL, "ttl", "<duration>", 0, 1, "Time to live");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {ttl, end};
+ *
+ * // --ttl=1h30m stores 5400000000000 in ttl->nsec[0]
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name. Pass `NULL` if no short option is desired.
+ * @param longopts  A string of comma-separated long option names. Pass `NULL`
+ *                  if no long option is desired.
+ * @param datatype  A string describing the expected data type, shown in help
+ *                  messages. Defaults to `"<duration>"` if `NULL`.
+ * @param mincount  The minimum number of times the argument must appear (set to 0
+ *                  for optional).
+ * @param maxcount  The maximum number of times the argument can appear (controls
+ *                  memory allocation).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_duration_t`. Returns
+ *   `NULL` if there is insufficient memory.
+ */
+ARG_EXTERN arg_duration_t* arg_durationn(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_duration_t* arg_duration0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+ARG_EXTERN arg_duration_t* arg_duration1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+
+/**
+ * Creates an integer list argument for the command-line parser.
+ *
+ * The `arg_intlistn` function defines an option whose value is a list of
+ * integers separated by `delim`, such as `--ids=1,2,3`. The elements are
+ * stored in the `ival` array of the resulting `arg_intlist_t` struct. If any
+ * element is malformed or out of range, the whole value is rejected with the
+ * same errors `arg_int` reports.
+ *
+ * The value is split in a single pass that examines eight characters at a
+ * time, and the element array grows geometrically, so lists with tens of
+ * thousands of elements need only a handful of allocations.
+ *
+ * `arg_intlist0` and `arg_intlist1` are helpers for optional and required
+ * arguments that may appear at most once.
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name. Pass `NULL` if no short option is desired.
+ * @param longopts  A string of comma-separated long option names. Pass `NULL`
+ *                  if no long option is desired.
+ * @param datatype  A string describing the expected data type, shown in help
+ *                  messages. Defaults to `"<ints>"` if `NULL`.
+ * @param delim     The character separating the list elements. Pass `'\0'`
+ *                  for the default, a comma.
+ * @param mincount  The minimum number of times the argument must appear (set to 0
+ *                  for optional).
+ * @param maxcount  The maximum number of times the argument can appear (controls
+ *                  memory allocation).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_intlist_t`. Returns
+ *   `NULL` if there is insufficient memory.
+ *
+ * @see arg_intlist_t, arg_freetable
+ */
+ARG_EXTERN arg_intlist_t* arg_intlistn(const char* shortopts, const char* longopts, const char* datatype, char delim, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_intlist_t* arg_intlist0(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary);
+ARG_EXTERN arg_intlist_t* arg_intlist1(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary);
+
+/**
+ * Creates a double list argument for the command-line parser.
+ *
+ * The `arg_dbllistn` function works like `arg_intlistn`, but each element is
+ * parsed as a double, always with `.` as the decimal point, and stored in the
+ * `dval` array of the resulting `arg_dbllist_t` struct. The datatype defaults
+ * to `"<doubles>"`.
+ *
+ * @see arg_intlistn, arg_dbllist_t
+ */
+ARG_EXTERN arg_dbllist_t* arg_dbllistn(const char* shortopts, const char* longopts, const char* datatype, char delim, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_dbllist_t* arg_dbllist0(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary);
+ARG_EXTERN arg_dbllist_t* arg_dbllist1(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary);
+
+/**
+ * Creates a string list argument for the command-line parser.
+ *
+ * The `arg_strlistn` function works like `arg_intlistn`, but stores each
+ * element as a slice of the argument string in the `sval` array of the
+ * resulting `arg_strlist_t` struct, without copying it. Any element is
+ * accepted, including an empty one. The datatype defaults to `"<strings>"`.
+ *
+ * @see arg_intlistn, arg_strlist_t, arg_slice_t
+ */
+ARG_EXTERN arg_strlist_t* arg_strlistn(const char* shortopts, const char* longopts, const char* datatype, char delim, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_strlist_t* arg_strlist0(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary);
+ARG_EXTERN arg_strlist_t* arg_strlist1(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary);
+
+/**
+ * Creates a double-precision floating-point argument for the command-line parser.
+ *
+ * The `arg_dbln` function defines an option that accepts double-precision
+ * floating-point values from the command line. You can specify the minimum and
+ * maximum number of times the argument can appear, making it suitable for
+ * optional, required, or repeatable floating-point options. Each occurrence of
+ * the option is parsed and stored in the `dval` array of the resulting
+ * `arg_dbl_t` struct, allowing you to retrieve all provided double values after
+ * parsing.
+ *
+ * Values are accepted in the same forms as the C library `strtod()` function,
+ * but the decimal point is always `.` regardless of the current locale, so
+ * `1.5` is parsed the same way in every locale. Decimal values are converted
+ * to the nearest double (correctly rounded) by a built-in parser.
+ *
+ * For convenience and backward compatibility, `arg_dbl0` is provided as a
+ * helper for optional double arguments (where `mincount = 0` and
+ * `maxcount = 1`), and `arg_dbl1` is a helper for required double arguments
+ * (where `mincount = 1` and `maxcount = 1`). While `arg_dbl0` and `arg_dbl1`
+ * are available, it is recommended to use `arg_dbln` in new code as it is more
+ * explicit and flexible.
+ *
+ * Example usage:
+ * ```
+ * // Accepts one or more double arguments
+ * arg_dbl_t *values = arg_dbln("v", "value", "<double>", 1, 5, "Input values");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {values, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && values->count > 0) {
+ *     for (int i = 0; i < values->count; ++i) {
+ *         printf("Input value: %f\n", values->dval[i]);
+ *     }
+ * } else {
+ *     arg_print_errors(stdout, end, argv[0]);
+ * }
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name (e.g., `"v"` for `-v`). Pass `NULL` if no short
+ *                  option is desired.
+ * @param longopts  A string of comma-separated long option names (e.g.,
+ *                  `"value"` for `--value`). Pass `NULL` if no long option is
+ *                  desired.
+ * @param datatype  A string describing the expected data type (e.g.,
+ *                  `"<double>"`), shown in help messages.
+ * @param mincount  The minimum number of times the argument must appear (set to
+ *                  0 for optional).
+ * @param maxcount  The maximum number of times the argument can appear
+ *                  (controls memory allocation).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_dbl_t`. Returns
+ *   `NULL` if there is insufficient memory.
+ */
+ARG_EXTERN arg_dbl_t* arg_dbln(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_dbl_t* arg_dbl0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+ARG_EXTERN arg_dbl_t* arg_dbl1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+
+/**
+ * Creates a string argument for the command-line parser.
+ *
+ * The `arg_strn` function defines an option that accepts string values from the
+ * command line. You can specify the minimum and maximum number of times the
+ * argument can appear, making it suitable for optional, required, or repeatable
+ * string options. Each occurrence of the option is parsed and stored in the
+ * `sval` array of the resulting `arg_str_t` struct, allowing you to retrieve
+ * all provided string values after parsing.
+ *
+ * For convenience and backward compatibility, `arg_str0` is provided as a
+ * helper for optional string arguments (where `mincount = 0` and
+ * `maxcount = 1`), and `arg_str1` is a helper for required string arguments
+ * (where `mincount = 1` and `maxcount = 1`). While `arg_str0` and `arg_str1`
+ * are available, it is recommended to use `arg_strn` in new code as it is more
+ * explicit and flexible.
+ *
+ * Example usage:
+ * ```
+ * // Accepts one or more string arguments
+ * arg_str_t *inputs = arg_strn(NULL, NULL, "<input>", 1, 10, "Input strings");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = { inputs, end };
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && inputs->count > 0) {
+ *     for (int i = 0; i < inputs->count; ++i) {
+ *         printf("Input string: %s\n", inputs->sval[i]);
+ *     }
+ * } else {
+ *     arg_print_errors(stdout, end, argv[0]);
+ * }
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name (e.g., `"i"` for `-i`). Pass `NULL` if no short
+ *                  option is desired.
+ * @param longopts  A string of comma-separated long option names (e.g.,
+ *                  `"input"` for `--input`). Pass `NULL` if no long option is
+ *                  desired.
+ * @param datatype  A string describing the expected data type (e.g.,
+ *                  `"<input>"`), shown in help messages.
+ * @param mincount  The minimum number of times the argument must appear (set to
+ *                  0 for optional).
+ * @param maxcount  The maximum number of times the argument can appear
+ *                  (controls memory allocation).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_str_t`. Returns
+ *   `NULL` if there is insufficient memory.
+ */
+ARG_EXTERN arg_str_t* arg_strn(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_str_t* arg_str0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+ARG_EXTERN arg_str_t* arg_str1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+
+/**
+ * Creates a regular expression argument for the command-line parser.
+ *
+ * The `arg_rexn` function defines an option that accepts values matching a
+ * specified regular expression pattern. You can specify the minimum and maximum
+ * number of times the argument can appear, making it suitable for optional,
+ * required, or repeatable regex-matched options. Each occurrence of the option
+ * is parsed and stored in the `sval` array of the resulting `arg_rex_t` struct,
+ * allowing you to retrieve all provided values that match the regular expression
+ * after parsing.
+ *
+ * The constructor also finds the literals that every match of the pattern
+ * contains: the characters it must start and end with, such as `img-` and
+ * `.raw` in `"^img-[0-9]+\\.raw$"`, and other characters it must contain,
+ * such as the `@` in an email pattern. Values without them are rejected with
+ * a few byte comparisons before the full match is run. Patterns that are an
+ * alternation at the top level, such as `"ab|cd"`, or that use
+ * `ARG_REX_ICASE` have no such literals and are always matched in full.
+ *
+ * For convenience and backward compatibility, `arg_rex0` is provided as a
+ * helper for optional regex arguments (where `mincount = 0` and `maxcount = 1`),
+ * and `arg_rex1` is a helper for required regex arguments (where `mincount = 1`
+ * and `maxcount = 1`). While `arg_rex0` and `arg_rex1` are available, it is
+ * recommended to use `arg_rexn` in new code as it is more explicit and flexible.
+ *
+ * Example usage:
+ * ```
+ * // Accepts one or more arguments matching a simple email pattern
+ * arg_rex_t *emails = arg_rexn(NULL, "email", "^[^@]+@[^@]+\\.[^@]+$", "<email>", 1, 10, 0, "Email addresses");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = { emails, end };
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && emails->count > 0) {
+ *     for (int i = 0; i < emails->count; ++i) {
+ *         printf("Matched email: %s\n", emails->sval[i]);
+ *     }
+ * } else {
+ *     arg_print_errors(stdout, end, argv[0]);
+ * }
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name (e.g., `"e"` for `-e`). Pass `NULL` if no short
+ *                  option is desired.
+ * @param longopts  A string of comma-separated long option names (e.g.,
+ *                  `"email"` for `--email`). Pass `NULL` if no long option is
+ *                  desired.
+ * @param pattern   The regular expression pattern to match input values.
+ * @param datatype  A string describing the expected data type (e.g.,
+ *                  `"<email>"`), shown in help messages.
+ * @param mincount  The minimum number of times the argument must appear (set to
+ *                  0 for optional).
+ * @param maxcount  The maximum number of times the argument can appear
+ *                  (controls memory allocation).
+ * @param flags     Flags to modify regex matching behavior (e.g.,
+ *                  `ARG_REX_ICASE` for case-insensitive).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_rex_t`. Returns
+ *   `NULL` if there is insufficient memory.
+ */
+ARG_EXTERN arg_rex_t* arg_rexn(const char* shortopts,
+                               const char* longopts,
+                               const char* pattern,
+                               const char* datatype,
+                               int mincount,
+                               int maxcount,
+                               int flags,
+                               const char* glossary);
+ARG_EXTERN arg_rex_t* arg_rex0(const char* shortopts,
+                               const char* longopts,
+                               const char* pattern,
+                               const char* datatype,
+                               int flags,
+                               const char* glossary);
+ARG_EXTERN arg_rex_t* arg_rex1(const char* shortopts,
+                               const char* longopts,
+                               const char* pattern,
+                               const char* datatype,
+                               int flags,
+                               const char* glossary);
+
+/**
+ * Creates an enumerated choice argument for the command-line parser.
+ *
+ * The `arg_enumn` function defines an option whose value must be one of the
+ * strings in `choices`. Each occurrence of the option stores the index of the
+ * matched choice in the `idx` array of the resulting `arg_enum_t` struct. A
+ * value that is not one of the choices is reported as an invalid argument,
+ * and the error message lists the valid choices.
+ *
+ * If `datatype` is `NULL`, the choices themselves are listed in the syntax
+ * and glossary output, as in `--mode={fast,safe,debug}`.
+ *
+ * `arg_enum0` and `arg_enum1` are helpers for optional and required arguments
+ * that may appear at most once.
+ *
+ * Example usage:
+ * ```
+ * static const char* levels[] = {"error", "warn", "info", "debug", NULL};
+ * arg_enum_t *level = arg_enumn(NULL, "log-level", levels, NULL, 0, 1, ARG_ENUM_ICASE, "Log level");
+ *
+ * // --log-level=WARN stores 1 in level->idx[0]
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name. Pass `NULL` if no short option is desired.
+ * @param longopts  A string of comma-separated long option names. Pass `NULL`
+ *                  if no long option is desired.
+ * @param choices   A `NULL`-terminated array of the accepted strings. The array
+ *                  and the strings are not copied, so they must remain valid
+ *                  for the lifetime of the argument. The choices must be
+ *                  distinct.
+ * @param datatype  A string describing the expected data type, shown in help
+ *                  messages. Pass `NULL` to list the choices instead.
+ * @param mincount  The minimum number of times the argument must appear (set to 0
+ *                  for optional).
+ * @param maxcount  The maximum number of times the argument can appear (controls
+ *                  memory allocation).
+ * @param flags     Flags to modify matching behavior (`ARG_ENUM_ICASE` for
+ *                  case-insensitive matching of ASCII letters).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_enum_t`. Returns
+ *   `NULL` if there is insufficient memory, or if `choices` is `NULL`, empty
+ *   or contains the same string twice.
+ */
+ARG_EXTERN arg_enum_t* arg_enumn(const char* shortopts,
+                                 const char* longopts,
+                                 const char* const* choices,
+                                 const char* datatype,
+                                 int mincount,
+                                 int maxcount,
+                                 int flags,
+                                 const char* glossary);
+ARG_EXTERN arg_enum_t* arg_enum0(const char* shortopts,
+                                 const char* longopts,
+                                 const char* const* choices,
+                                 const char* datatype,
+                                 int flags,
+                                 const char* glossary);
+ARG_EXTERN arg_enum_t* arg_enum1(const char* shortopts,
+                                 const char* longopts,
+                                 const char* const* choices,
+                                 const char* datatype,
+                                 int flags,
+                                 const char* glossary);
+
+/**
+ * Creates a file path argument for the command-line parser.
+ *
+ * The `arg_filen` function defines an option that accepts file path values from
+ * the command line. You can specify the minimum and maximum number of times the
+ * argument can appear, making it suitable for optional, required, or repeatable
+ * file arguments. Each occurrence of the option is parsed and stored in the
+ * `filename` array of the resulting `arg_file_t` struct. The struct also
+ * provides convenient access to the basename and extension for each file.
+ *
+ * For convenience and backward compatibility, `arg_file0` is provided as a
+ * helper for optional file arguments (where `mincount = 0` and `maxcount = 1`),
+ * and `arg_file1` is a helper for required file arguments (where `mincount = 1`
+ * and `maxcount = 1`). While `arg_file0` and `arg_file1` are available, it is
+ * recommended to use `arg_filen` in new code as it is more explicit and flexible.
+ *
+ * Example usage:
+ * ```
+ * // Accepts one or more file arguments
+ * arg_file_t *files = arg_filen(NULL, NULL, "<file>", 1, 100, "Input files");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = { files, end };
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && files->count > 0) {
+ *     for (int i = 0; i < files->count; ++i) {
+ *         printf("File: %s, Basename: %s, Extension: %s\n",
+ *             files->filename[i], files->basename[i], files->extension[i]);
+ *     }
+ * } else {
+ *     arg_print_errors(stdout, end, argv[0]);
+ * }
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name (e.g., `"f"` for `-f`). Pass `NULL` if no short
+ *                  option is desired.
+ * @param longopts  A string of comma-separated long option names (e.g.,
+ *                  `"file"` for `--file`). Pass `NULL` if no long option is
+ *                  desired.
+ * @param datatype  A string describing the expected data type (e.g.,
+ *                  `"<file>"`), shown in help messages.
+ * @param mincount  The minimum number of times the argument must appear (set to
+ *                  0 for optional).
+ * @param maxcount  The maximum number of times the argument can appear
+ *                  (controls memory allocation).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_file_t`. Returns
+ *   `NULL` if there is insufficient memory.
+ */
+ARG_EXTERN arg_file_t* arg_filen(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_file_t* arg_file0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+ARG_EXTERN arg_file_t* arg_file1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary);
+
+struct stat;
+
+/**
+ * Makes a file argument check its paths against the filesystem.
+ *
+ * By default `arg_filen` only records the paths it is given. After
+ * `arg_file_validate`, every path is also checked when `arg_parse` performs
+ * its post-parse checks, and the `struct stat` of each path is kept so that
+ * it can be retrieved with `arg_file_stat` without calling `stat` again.
+ *
+ * The `flags` combine the following checks:
+ * - `ARG_FILE_EXISTS`: the path must exist.
+ * - `ARG_FILE_REGULAR`: the path must be a regular file.
+ * - `ARG_FILE_DIR`: the path must be a directory. Together with
+ *   `ARG_FILE_REGULAR`, either kind is accepted.
+ * - `ARG_FILE_READABLE`: the path must be readable by the process.
+ *
+ * Each check implies `ARG_FILE_EXISTS`. The checks run on a pool of at most
+ * `nworkers` threads that lives for the duration of the checks, so that slow
+ * storage, such as a network file system, is queried for many paths at once.
+ * A path that fails a check is reported through `arg_end` with the path as
+ * its argument value, one error per path, in the order in which the paths
+ * appear on the command line. The paths are only checked if the command line
+ * parsed without errors, like the other post-parse checks.
+ *
+ * Example usage:
+ * ```
+ * arg_file_t *inputs = arg_filen(NULL, NULL, "<file>", 1, 100000, "Input files");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {inputs, end};
+ *
+ * arg_file_validate(inputs, ARG_FILE_REGULAR | ARG_FILE_READABLE, 32);
+ * if (arg_parse(argc, argv, argtable) == 0)
+ *     printf("%s has %ld bytes\n", inputs->filename[0], (long)arg_file_stat(inputs, 0)->st_size);
+ * ```
+ *
+ * @param parent   The file argument to validate.
+ * @param flags    The checks to perform, or `0` to stop checking the paths.
+ * @param nworkers The largest number of worker threads, or a negative value to
+ *                 use one per online processor. With `0`, or when the library
+ *                 is built without thread support (`ARG_ENABLE_THREADS`), the
+ *                 paths are checked one after another by `arg_parse`.
+ *
+ * @see arg_file_stat, arg_filen
+ */
+ARG_EXTERN void arg_file_validate(arg_file_t* parent, int flags, int nworkers);
+
+/**
+ * Returns the file status of a validated path.
+ *
+ * After a successful `arg_parse` of a file argument with validation enabled
+ * by `arg_file_validate`, this function returns the `struct stat` that was
+ * obtained for `parent->filename[index]`.
+ *
+ * @param parent The file argument.
+ * @param index  The index of the path, from `0` to `parent->count - 1`.
+ *
+ * @return
+ *   The status of the path, or `NULL` if the argument is not validated, the
+ *   index is out of range, or the path could not be queried.
+ */
+ARG_EXTERN const struct stat* arg_file_stat(const arg_file_t* parent, int index);
+
+/**
+ * Makes a file argument expand glob patterns itself.
+ *
+ * A shell expands patterns such as `*.log` before a program sees them, but
+ * a program started directly with `execve` receives them unexpanded.
+ * After `arg_file_glob`, every value of the argument that contains `*`, `?`
+ * or `[` is expanded by `arg_parse` into the paths that match it, and each
+ * path is stored as a separate entry of `filename`, in sorted order.
+ *
+ * Within a path component, `*` matches any run of characters, `?` matches
+ * one character, and `[...]` matches one character of a set, such as
+ * `[a-z]`, or of its complement, such as `[!0-9]`. A component that is just
+ * `**` matches any number of directories, including none, so a pattern made
+ * of the components `logs`, `**` and `*.gz` finds every `.gz` file below
+ * `logs`. Names starting with a `.` are only matched by a component that
+ * starts with a `.`, and `**` does not follow symbolic links. The directories
+ * found at each depth of the search are read in parallel on a pool of at most
+ * `nworkers` threads.
+ *
+ * A pattern that matches nothing is reported as an error, as is a pattern
+ * with more than `maxmatches` matches, or with more matches than the argument
+ * has room for. The search gives up as soon as one depth of it holds more
+ * than `maxmatches` paths, including the directories that a `**` passes
+ * through, so the limit also bounds the time and memory a pattern can use.
+ *
+ * Example usage:
+ * ```
+ * arg_file_t *logs = arg_filen(NULL, NULL, "<file>", 1, 100000, "Log files");
+ *
+ * arg_file_glob(logs, 10000, -1);
+ * ```
+ *
+ * @param parent     The file argument.
+ * @param maxmatches The largest number of matches of one pattern, or `0` to
+ *                   store patterns as they are again.
+ * @param nworkers   The largest number of worker threads, or a negative value
+ *                   to use one per online processor. With `0`, or when the
+ *                   library is built without thread support, the directories
+ *                   are read one after another.
+ *
+ * @see arg_filen, arg_file_validate
+ */
+ARG_EXTERN void arg_file_glob(arg_file_t* parent, int maxmatches, int nworkers);
+
+/**
+ * Returns the contents of a parsed file.
+ *
+ * The file `parent->filename[index]` is opened on the first call and mapped
+ * into memory, or read into the heap where it cannot be mapped, so a
+ * program can read its input files without opening them itself. Later calls
+ * return the same view. The path `-` stands for the standard input, which is
+ * read to its end; all `-` paths of the argument share that one copy.
+ *
+ * The contents are followed by a `'\0'`, which is not included in the
+ * length, and must not be modified. The view remains valid until the next
+ * `arg_parse` of the argument table, or until `arg_freetable` releases the
+ * argument. The standard input is kept until `arg_freetable`.
+ *
+ * Example usage:
+ * ```
+ * size_t len;
+ * const char *data = arg_file_map(inputs, 0, &len);
+ * if (data == NULL)
+ *     perror(inputs->filename[0]);
+ * else
+ *     fwrite(data, 1, len, stdout);
+ * ```
+ *
+ * @param parent The file argument.
+ * @param index  The index of the path, from `0` to `parent->count - 1`.
+ * @param len    Receives the length of the contents in bytes, if not `NULL`.
+ *
+ * @return
+ *   The contents of the file, or `NULL` if the index is out of range or the
+ *   file cannot be read, in which case `errno` describes the reason.
+ *
+ * @see arg_filen, arg_freetable
+ */
+ARG_EXTERN const char* arg_file_map(arg_file_t* parent, int index, size_t* len);
+
+/**
+ * Creates a date/time argument for the command-line parser.
+ *
+ * The `arg_daten` function defines an option that accepts date or time values
+ * from the command line. You can specify the minimum and maximum number of
+ * times the argument can appear, making it suitable for optional, required, or
+ * repeatable date/time arguments. Each occurrence of the option is parsed using
+ * the specified `format` (a `strptime`-style format string) and stored as a
+ * `struct tm` value in the `tmval` array of the resulting `arg_date_t` struct,
+ * allowing you to retrieve all provided date/time values after parsing.
+ *
+ * With the `ARG_DATE_ISO8601` format, a value is a date `YYYY-MM-DD`,
+ * optionally followed by `T` (or a space) and a time `hh:mm` or `hh:mm:ss`.
+ * The seconds may have a fraction after a `.` or `,`, and the time may end
+ * with `Z` or a UTC offset `+hh:mm`, `+hhmm` or `+hh` (or with `-`). The day
+ * is checked against the length of the month. The resulting `struct tm` holds
+ * the time in UTC, with `tm_wday` and `tm_yday` filled in; the fraction is
+ * only kept by `arg_epochn`.
+ *
+ * For convenience and backward compatibility, `arg_date0` is provided as a
+ * helper for optional date arguments (where `mincount = 0` and `maxcount = 1`),
+ * and `arg_date1` is a helper for required date arguments (where `mincount = 1`
+ * and `maxcount = 1`). While `arg_date0` and `arg_date1` are available, it is
+ * recommended to use `arg_daten` in new code as it is more explicit and flexible.
+ *
+ * Example usage:
+ * ```
+ * // Accepts one required date argument in YYYY-MM-DD format
+ * arg_date_t *date = arg_date1(NULL, "date", "%Y-%m-%d", "<date>", "Date in YYYY-MM-DD format");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = { date, end };
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors == 0 && date->count > 0) {
+ *     printf("Parsed date: %04d-%02d-%02d\n",
+ *         date->tmval[0].tm_year + 1900, date->tmval[0].tm_mon + 1, date->tmval[0].tm_mday);
+ * } else {
+ *     arg_print_errors(stdout, end, argv[0]);
+ * }
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name (e.g., `"d"` for `-d`). Pass `NULL` if no short
+ *                  option is desired.
+ * @param longopts  A string of comma-separated long option names (e.g.,
+ *                  `"date"` for `--date`). Pass `NULL` if no long option is
+ *                  desired.
+ * @param format    A `strptime`-style format string describing the expected
+ *                  date/time input (e.g., `"%Y-%m-%d"`), or `ARG_DATE_ISO8601`.
+ * @param datatype  A string describing the expected data type (e.g.,
+ *                  `"<date>"`), shown in help messages.
+ * @param mincount  The minimum number of times the argument must appear (set to
+ *                  0 for optional).
+ * @param maxcount  The maximum number of times the argument can appear
+ *                  (controls memory allocation).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_date_t`. Returns
+ *   `NULL` if there is insufficient memory, or if `format` has an unknown
+ *   conversion or an illegal `E` or `O` modifier.
+ */
+ARG_EXTERN arg_date_t*
+arg_daten(const char* shortopts, const char* longopts, const char* format, const char* datatype, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_date_t* arg_date0(const char* shortopts, const char* longopts, const char* format, const char* datatype, const char* glossary);
+ARG_EXTERN arg_date_t* arg_date1(const char* shortopts, const char* longopts, const char* format, const char* datatype, const char* glossary);
+
+/**
+ * Creates a date argument that stores nanoseconds since the epoch.
+ *
+ * The `arg_epochn` function accepts the same formats as `arg_daten`, but
+ * converts each value to a signed 64-bit count of nanoseconds since
+ * 1970-01-01 00:00:00 UTC and stores it in the `nsec` array of the resulting
+ * `arg_date_t` struct; its `tmval` array is `NULL`. Fields that the format
+ * does not set default to the epoch, so a `"%H:%M:%S"` format yields the time
+ * of day. Values without a UTC offset are taken to be in UTC. A time that does
+ * not fit in 64 bits, roughly outside the years 1677 to 2262, is reported as
+ * an error.
+ *
+ * `arg_epoch0` and `arg_epoch1` are helpers for optional and required
+ * arguments that may appear at most once.
+ *
+ * Example usage:
+ * ```
+ * arg_date_t *at = arg_epochn(NULL, "at", ARG_DATE_ISO8601, "<time>", 0, 1000, "Event times");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {at, end};
+ *
+ * // --at=2024-03-01T12:00:00.5+01:00 stores 1709290800500000000 in at->nsec[0]
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * ```
+ *
+ * @param shortopts A string of single characters, each representing a short
+ *                  option name. Pass `NULL` if no short option is desired.
+ * @param longopts  A string of comma-separated long option names. Pass `NULL`
+ *                  if no long option is desired.
+ * @param format    A `strptime`-style format string, or `ARG_DATE_ISO8601`.
+ * @param datatype  A string describing the expected data type, shown in help
+ *                  messages. Defaults to the format string if `NULL`.
+ * @param mincount  The minimum number of times the argument must appear (set to 0
+ *                  for optional).
+ * @param maxcount  The maximum number of times the argument can appear (controls
+ *                  memory allocation).
+ * @param glossary  A short description of the argument for the glossary/help
+ *                  output. Pass `NULL` to omit.
+ *
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_date_t`. Returns
+ *   `NULL` if there is insufficient memory, or if `format` has an unknown
+ *   conversion or an illegal `E` or `O` modifier.
+ *
+ * @see arg_daten, arg_date_t
+ */
+ARG_EXTERN arg_date_t*
+arg_epochn(const char* shortopts, const char* longopts, const char* format, const char* datatype, int mincount, int maxcount, const char* glossary);
+ARG_EXTERN arg_date_t* arg_epoch0(const char* shortopts, const char* longopts, const char* format, const char* datatype, const char* glossary);
+ARG_EXTERN arg_date_t* arg_epoch1(const char* shortopts, const char* longopts, const char* format, const char* datatype, const char* glossary);
+
+/**
+ * Creates an end-of-table marker and error collector for the argument table.
+ *
+ * The `arg_end` function is used to create an `arg_end_t` struct, which should
+ * be placed as the last element in the argument table array. This structure
+ * serves two purposes: it marks the end of the argument table for the parser,
+ * and it collects information about any errors encountered during command-line
+ * parsing.
+ *
+ * The `maxcount` parameter specifies the maximum number of errors that can be
+ * recorded. After parsing, the `arg_end_t` struct contains details about
+ * missing required arguments, invalid values, or other parsing errors, which
+ * can be reported to the user using functions like `arg_print_errors`.
+ *
+ * Example usage:
+ * ```
+ * arg_lit_t *help = arg_lit0("h", "help", "Display help");
+ * arg_int_t *count = arg_int0("c", "count", "<n>", "Number of times");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {help, count, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors > 0) {
+ *     arg_print_errors(stdout, end, argv[0]);
+ *     // handle errors...
+ * }
+ * ```
+ *
+ * @param maxcount The maximum number of errors to record during parsing.
+ *                 Choose a value large enough to capture all possible errors.
+ * @return
+ *   If successful, returns a pointer to the allocated `arg_end_t`. Returns
+ *   `NULL` if there is insufficient memory.
+ *
+ * @see arg_end_t, arg_parse, arg_print_errors
+ */
+ARG_EXTERN arg_end_t* arg_end(int maxcount);
+
+/**
+ * Enables response files for the argument table that `end` terminates.
+ *
+ * Build systems often pass long command lines through a response file, to
+ * stay below the operating system's limit on the length of a command line.
+ * Once response files are enabled, `arg_parse` replaces every argument of
+ * the form `@path`, other than `argv[0]`, with the arguments stored in the
+ * file `path`, before any option is parsed.
+ *
+ * The arguments in a response file are separated by white space, including
+ * line breaks. Single quotes preserve everything between them literally;
+ * inside double quotes, a backslash escapes `"`, `\` and a line break;
+ * outside quotes, a backslash escapes any character. An argument of the form
+ * `@path` inside a response file refers to another response file, and is
+ * expanded in turn, unless its `@` is quoted or escaped, as in `'@user'`.
+ * Arguments after `--`, on the command line or in a response file, are
+ * operands, so an operand such as `@handle` is passed on unchanged. A
+ * response file that cannot be read, or that refers to itself, directly or
+ * through other response files, is reported as an error in `end`, like other
+ * parse errors.
+ *
+ * The file is mapped into memory and split into arguments in place, so the
+ * values that `arg_parse` stores for the arguments read from it point into
+ * the mapping. The mapping stays valid until the table is parsed again or
+ * released with `arg_freetable`.
+ *
+ * Example usage:
+ * ```
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {verbose, inputs, end};
+ *
+ * arg_end_respfile(end, 1);
+ * nerrors = arg_parse(argc, argv, argtable); // "prog @args.rsp" works
+ * ```
+ *
+ * @param end    The `arg_end` of the argument table.
+ * @param enable Non-zero to expand response files, or `0` to stop expanding
+ *               them, which also releases the files of the last parse.
+ *
+ * @see arg_end, arg_parse, arg_freetable
+ */
+ARG_EXTERN void arg_end_respfile(arg_end_t* end, int enable);
+
+/**
+ * Reads the options of an argument table from environment variables named
+ * after their long options.
+ *
+ * With a prefix such as `MYTOOL_`, `arg_parse` reads `--threads` from
+ * `MYTOOL_THREADS` and `--dry-run` from `MYTOOL_DRY_RUN`: the first long
+ * option of each entry is converted to upper case, with `-` replaced by `_`,
+ * and appended to the prefix. A variable only provides a value for an option
+ * that does not appear on the command line, so the command line always takes
+ * precedence. Positional arguments, which have no options, are never read
+ * from the environment.
+ *
+ * The value of the variable is scanned by the option as if it had been given
+ * on the command line, so an invalid value is reported through `arg_end`,
+ * with the value of the variable as the offending argument. A flag without a
+ * value, such as an `arg_lit`, is set unless its variable is empty or one of
+ * `0`, `false`, `no` and `off`, in any case.
+ *
+ * The environment is indexed once per `arg_parse`, so reading many options
+ * from a large environment costs one hash lookup per option.
+ *
+ * Example usage:
+ * ```
+ * arg_int_t *threads = arg_int0("t", "threads", "<n>", "Worker threads");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {threads, end};
+ *
+ * arg_end_envprefix(end, "MYTOOL_");   // MYTOOL_THREADS=8 is --threads=8
+ * ```
+ *
+ * @param end    The `arg_end` of the argument table.
+ * @param prefix The prefix of the variable names, or `NULL` to stop deriving
+ *               names from long options. The string is not copied, and must
+ *               stay valid while the table is in use.
+ *
+ * @see arg_end_envbind, arg_parse
+ */
+ARG_EXTERN void arg_end_envprefix(arg_end_t* end, const char* prefix);
+
+/**
+ * Binds an option of an argument table to an environment variable.
+ *
+ * The option is read from the variable `name` when the command line does not
+ * give it, in the same way as with `arg_end_envprefix`. A binding takes the
+ * place of the name derived from the prefix, which makes it possible to read
+ * options that have only a short option, or to use a conventional name such
+ * as `NO_COLOR`.
+ *
+ * Example usage:
+ * ```
+ * arg_end_envbind(end, threads, "OMP_NUM_THREADS");
+ * arg_end_envbind(end, password, NULL);  // never read from the environment
+ * ```
+ *
+ * @param end  The `arg_end` of the argument table.
+ * @param arg  The option, which must be an entry of the same table.
+ * @param name The name of the variable, or `NULL` to keep the option from
+ *             being read from the environment at all. The string is not
+ *             copied, and must stay valid while the table is in use.
+ *
+ * @see arg_end_envprefix, arg_parse
+ */
+ARG_EXTERN void arg_end_envbind(arg_end_t* end, void* arg, const char* name);
+
+/**
+ * Adds a configuration file to the layers that an argument table is read from.
+ *
+ * `arg_parse` takes the value of each option from the first of these layers
+ * that sets it: the command line, then the environment (see
+ * `arg_end_envprefix`), then the configuration files, from the last one
+ * added to the first, and finally the defaults the program stores in the
+ * option before parsing. A typical program adds a system-wide file before a
+ * user file, so that the user file takes precedence. A file that does not
+ * exist is skipped.
+ *
+ * A configuration file consists of lines of the form `key = value`, where
+ * `key` is a long option of the table, and `value` is scanned by the option
+ * as if it had been given on the command line. A line with just a key sets a
+ * flag, and a flag can also be set with a value such as `true`, or left
+ * unset with one of `0`, `false`, `no` and `off`. A value can be enclosed in
+ * single or double quotes to keep blanks at its ends. Empty lines, lines
+ * starting with `#` or `;`, and `[section]` headers are ignored. An option
+ * that accepts several values can be set on several lines of the same file.
+ *
+ * ```
+ * # mytool.conf
+ * threads = 8
+ * log-file = "/var/log/my tool.log"
+ * verbose
+ * ```
+ *
+ * The file is mapped into memory and read in a single pass, and the values
+ * of the options point into the mapping, which stays valid until the table is
+ * parsed again or released with `arg_freetable`. An unknown key, a malformed
+ * line or an invalid value is reported through `arg_end`, and
+ * `arg_print_errors` names the file and line of the error after the program
+ * name.
+ *
+ * @param end  The `arg_end` of the argument table.
+ * @param path The path of the file, or `NULL` to remove all configuration
+ *             files. The string is not copied, and must stay valid while the
+ *             table is in use.
+ *
+ * @see arg_end_envprefix, arg_parse, arg_print_errors
+ */
+ARG_EXTERN void arg_end_config(arg_end_t* end, const char* path);
+
+/**
+ * Adds a constraint between options to an argument table.
+ *
+ * Many programs check after `arg_parse` that options which cannot be used
+ * together were not, or that an option that needs another one has it.
+ * Constraints declare such rules with the table instead, and `arg_parse`
+ * checks them after the checks of the individual options, with the other
+ * post-parse checks. An option counts as given when the command line, the
+ * environment or a configuration file sets it at least once.
+ *
+ * - `ARG_CONSTRAINT_EXCLUSIVE`: at most one of `args` may be given, otherwise
+ *   `ARG_EEXCLUSIVE` is reported.
+ * - `ARG_CONSTRAINT_REQUIRES`: if `args[0]` is given, all of the others must
+ *   be given too, otherwise `ARG_EREQUIRES` is reported.
+ * - `ARG_CONSTRAINT_ANYOF`: at least one of `args` must be given, otherwise
+ *   `ARG_EANYOF` is reported.
+ *
+ * Each violated constraint is reported once, and the `argval` of the error
+ * names its options, so `arg_print_errors` prints messages such as
+ * `only one of -i|--input, --stdin may be given`. The options of each
+ * constraint are looked up in the table by their position, so checking all
+ * constraints takes time linear in their total number of options.
+ *
+ * Example usage:
+ * ```
+ * arg_file_t *input = arg_file0("i", "input", "<file>", "Input file");
+ * arg_lit_t *use_stdin = arg_lit0(NULL, "stdin", "Read standard input");
+ * arg_str_t *key = arg_str0(NULL, "key", "<file>", "Private key");
+ * arg_str_t *cert = arg_str0(NULL, "cert", "<file>", "Certificate");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {input, use_stdin, key, cert, end};
+ * void *sources[] = {input, use_stdin};
+ * void *tls[] = {key, cert};
+ *
+ * arg_end_constrain(argtable, ARG_CONSTRAINT_EXCLUSIVE, sources, 2);
+ * arg_end_constrain(argtable, ARG_CONSTRAINT_ANYOF, sources, 2);
+ * arg_end_constrain(argtable, ARG_CONSTRAINT_REQUIRES, tls, 2);
+ * ```
+ *
+ * @param argtable The argument table, terminated by the `arg_end` struct
+ *                 that keeps the constraint.
+ * @param kind     One of `enum arg_constraint`.
+ * @param args     The options the constraint applies to. Each must be an
+ *                 entry of `argtable`, other than its `arg_end`. The array is
+ *                 copied.
+ * @param nargs    The number of options in `args`: at least 1 for
+ *                 `ARG_CONSTRAINT_ANYOF`, and at least 2 for the other kinds.
+ *
+ * @return `0` if the constraint was added, or `-1` if `kind` is unknown,
+ *         there are too few options, or one of them is not an entry of the
+ *         table. An invalid constraint is not added, and the reason is
+ *         logged with `ARG_LOG`.
+ *
+ * @see arg_parse, arg_print_errors
+ */
+ARG_EXTERN int arg_end_constrain(void** argtable, int kind, void** args, int nargs);
+
+/**** other functions *******************************************/
+
+/**
+ * Checks the argument table for null entries.
+ *
+ * The `arg_nullcheck` function scans the provided argument table array and
+ * returns 1 if any entry is NULL, or 0 if all entries are valid. This is useful
+ * for detecting memory allocation failures after constructing all argument
+ * table entries with `arg_<type>` constructor functions, such as `arg_litn`.
+ *
+ * Instead of checking the return value of each constructor individually, you
+ * can call `arg_nullcheck` once after building the argument table to ensure
+ * that all arguments were allocated successfully. This helps make your code
+ * cleaner and more robust.
+ *
+ * Example usage:
+ * ```
+ * arg_lit_t *list    = arg_lit0("lL",NULL,           "list files");
+ * arg_lit_t *verbose = arg_lit0("v","verbose,debug", "verbose messages");
+ * arg_lit_t *help    = arg_lit0(NULL,"help",         "print this help and exit");
+ * arg_lit_t *version = arg_lit0(NULL,"version",      "print version and exit");
+ * arg_end_t *end     = arg_end(20);
+ * void *argtable[] = {list, verbose, help, version, end};
+ * const char *progname = "myprog";
+ * int exitcode = 0;
+ *
+ * if (arg_nullcheck(argtable) != 0) {
+ *     printf("%s: insufficient memory\n", progname);
+ *     exitcode = 1;
+ *     goto exit;
+ * }
+ * ```
+ *
+ * @param argtable Array of pointers to argument table structs.
+ *
+ * @return Returns 1 if any entry is NULL, 0 if all entries are valid.
+ */
+ARG_EXTERN int arg_nullcheck(void** argtable);
+
+/**
+ * Parses the command-line arguments according to the specified argument table.
+ *
+ * The `arg_parse` function processes the command-line arguments provided in
+ * `argv` and populates the fields of each argument structure in the `argtable`
+ * array. It checks for the presence, validity, and value of each option or
+ * positional argument as defined by the argument table. Any errors encountered
+ * during parsing, such as missing required arguments or invalid values, are
+ * recorded in the `arg_end_t` structure (typically the last entry in the table).
+ *
+ * After calling `arg_parse`, you can inspect the fields of each argument struct
+ * (such as `count`, `ival`, `dval`, `sval`, etc.) to retrieve the parsed
+ * values. If errors are detected (i.e., the return value is greater than zero),
+ * you can use `arg_print_errors` to display detailed error messages to the user.
+ *
+ * Example usage:
+ * ```
+ * arg_lit_t *help = arg_lit0("h", "help", "Display help");
+ * arg_int_t *count = arg_int0("c", "count", "<n>", "Number of times");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {help, count, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors > 0) {
+ *     arg_print_errors(stdout, end, argv[0]);
+ *     // handle errors...
+ * }
+ * ```
+ *
+ * @param argc     The number of command-line arguments passed to the program.
+ *                 The value is always greater than or equal to 1.
+ * @param argv     An array of null-terminated strings representing the
+ *                 command-line arguments. By convention, `argv[0]` is the
+ *                 program name, and `argv[1]` to `argv[argc-1]` are the
+ *                 arguments. `argv[argc]` is always NULL.
+ * @param argtable An array of pointers to argument table structs, each created
+ *                 by an `arg_<type>` constructor. The last entry should be an
+ *                 `arg_end` struct.
+ *
+ * @return The number of errors found during parsing. Returns 0 if parsing was
+ *         successful and no errors were detected.
+ */
+ARG_EXTERN int arg_parse(int argc, char** argv, void** argtable);
+
+/**
+ * Parses many command lines against one argument table, in parallel.
+ *
+ * The `arg_parse_batch` function parses each of the `njobs` command lines
+ * `argvs[j]` (with `argcs[j]` arguments) as `arg_parse` would, and copies the
+ * results each job leaves in the arguments described by `columns` into the
+ * caller's buffers before the next job is parsed. The table itself is never
+ * written to: the jobs are split into one contiguous range per worker thread,
+ * and each worker parses its range into a private copy of the table, so the
+ * buffers of every column must be large enough for `njobs` jobs.
+ *
+ * Options bound to environment variables and configuration files are read as
+ * for `arg_parse`. Values are copied as they are, so strings point into the
+ * `argvs` strings, which must outlive the results; strings that came from a
+ * response file, a configuration file or the expansion of a file pattern are
+ * released when the worker parses its next job and are not kept. Post-parse
+ * state such as `arg_file_validate` checks and `arg_file_map` contents is not
+ * collected.
+ *
+ * Parsing is only spread over threads when every argument of the table
+ * supports copies, which is the case for all the built-in types, and when the
+ * bundled getopt is used (the default `ARGTABLE3_REPLACE_GETOPT=ON`).
+ * Otherwise the jobs are parsed one after another on the calling thread, and
+ * a table whose arguments cannot all be copied is parsed into directly.
+ *
+ * Example usage:
+ * ```
+ * arg_int_t *level = arg_int0("l", "level", "<n>", "Level");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {level, end};
+ * arg_column_t cols[2];
+ * int nlevel[NJOBS], levels[NJOBS], nerrors[NJOBS], errors[NJOBS];
+ *
+ * ARG_COLUMN(&cols[0], level, ival, 1, nlevel, levels);
+ * ARG_COLUMN(&cols[1], end, error, 1, nerrors, errors);
+ * int nfailed = arg_parse_batch(argtable, NJOBS, argcs, argvs, cols, 2, -1);
+ * ```
+ *
+ * @param argtable An array of pointers to argument table structs, terminated
+ *                 by an `arg_end` struct.
+ * @param njobs    The number of command lines to parse.
+ * @param argcs    The number of arguments of each command line.
+ * @param argvs    The command lines, each laid out like the `argv` of
+ *                 `arg_parse`.
+ * @param columns  The results to collect from each job. The `arg` of every
+ *                 column must be an entry of `argtable`.
+ * @param ncolumns The number of columns.
+ * @param nworkers The number of worker threads, `-1` for one per processor,
+ *                 or `0` to parse on the calling thread.
+ *
+ * @return The number of jobs with at least one error, or -1 without parsing
+ *         any job if a column refers to an argument that is not in
+ *         `argtable`.
+ *
+ * @see arg_column_t, arg_parse
+ */
+ARG_EXTERN int arg_parse_batch(void** argtable, int njobs, const int* argcs, char*** argvs, const arg_column_t* columns, int ncolumns, int nworkers);
+
+/**
+ * Creates a result object for parsing against an argument table.
+ *
+ * The arguments of a table hold both their definition (options, data type,
+ * minimum and maximum counts) and the results of the last parse, so a table
+ * can only be parsed by one thread at a time. A result object separates the
+ * two: it is created once from a table, which then serves as a read-only
+ * definition, and holds its own copy of every argument to store the results
+ * in. `arg_parse_result` parses into the result object instead of the
+ * table, and `arg_result_get` returns the results of a table entry.
+ *
+ * A result object owns a full copy of every entry of the table, made with
+ * the entry's `clonefn`, because the `scanfn` and `checkfn` of each argument
+ * type store their results in the argument struct itself. Each copy is one
+ * block the size of the entry, including its value arrays of `maxcount`
+ * elements, while the option names, data types and glossaries stay shared
+ * with the table. Creating a result object therefore costs about as much
+ * memory as the table, so create one per thread, or per parse whose results
+ * must be kept, and reuse it for any number of parses; nothing is allocated
+ * per parse beyond what `arg_parse` allocates. Threads parsing into different
+ * result objects of the same table do not interfere, and the table can still
+ * be parsed directly with `arg_parse`. The definitions are taken from the
+ * table when the result object is created, so later changes to the table,
+ * such as `arg_end_envbind` or `arg_end_config`, do not affect it.
+ *
+ * Example usage:
+ * ```
+ * arg_int_t *level = arg_int0("l", "level", "<n>", "Level");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {level, end};
+ *
+ * // on each thread
+ * arg_result_t res = arg_result_create(argtable);
+ * if (arg_parse_result(argc, argv, res) > 0)
+ *     arg_print_errors(stderr, arg_result_end(res), argv[0]);
+ * else if (((arg_int_t*)arg_result_get(res, level))->count > 0)
+ *     printf("level %d\n", ((arg_int_t*)arg_result_get(res, level))->ival[0]);
+ * arg_result_destroy(res);
+ * ```
+ *
+ * @param argtable An array of pointers to argument table structs, terminated
+ *                 by an `arg_end` struct.
+ *
+ * @return A new result object, or `NULL` if an argument of the table has a
+ *         custom type that does not support copies (see `arg_clonefn`).
+ *
+ * @see arg_parse_result, arg_result_get, arg_result_destroy
+ */
+ARG_EXTERN arg_result_t arg_result_create(void** argtable);
+
+/**
+ * Parses the command-line arguments into a result object.
+ *
+ * This function behaves like `arg_parse`, but stores the counts, values and
+ * errors in the result object instead of the argument table it was created
+ * from. The results of the previous parse into the same object are
+ * discarded.
+ *
+ * @param argc   The number of command-line arguments.
+ * @param argv   The command-line arguments, as for `arg_parse`.
+ * @param result A result object created by `arg_result_create`.
+ *
+ * @return The number of errors found during parsing.
+ *
+ * @see arg_result_create, arg_result_get, arg_result_end
+ */
+ARG_EXTERN int arg_parse_result(int argc, char** argv, arg_result_t result);
+
+/**
+ * Returns the results of a table entry in a result object.
+ *
+ * The results have the same type as the table entry, so the fields filled in
+ * by `arg_parse` (`count`, `ival`, `sval`, ...) are read the same way. They
+ * stay valid until the next parse into the result object.
+ *
+ * @param result A result object created by `arg_result_create`.
+ * @param arg    An entry of the table the result object was created from.
+ *
+ * @return The results of `arg`, or `NULL` if `arg` is not in the table.
+ *
+ * @see arg_result_create, arg_parse_result
+ */
+ARG_EXTERN void* arg_result_get(arg_result_t result, const void* arg);
+
+/**
+ * Returns the errors of the last parse into a result object.
+ *
+ * The returned `arg_end_t` is the copy of the table terminator that
+ * `arg_parse_result` records errors in, and can be passed to
+ * `arg_print_errors`.
+ *
+ * @param result A result object created by `arg_result_create`.
+ *
+ * @return The errors of the last parse.
+ *
+ * @see arg_parse_result, arg_print_errors
+ */
+ARG_EXTERN arg_end_t* arg_result_end(arg_result_t result);
+
+/**
+ * Destroys a result object and releases its results.
+ *
+ * @param result A result object created by `arg_result_create`, or `NULL`.
+ *
+ * @see arg_result_create
+ */
+ARG_EXTERN void arg_result_destroy(arg_result_t result);
+
+/**
+ * Creates an incremental parse session for an argument table.
+ *
+ * A session keeps a command line and the state of its last parse, so that an
+ * interactive shell can validate the line while the user edits it. After the
+ * line is set with `arg_session_parse`, each call to `arg_session_edit`
+ * inserts, removes or replaces one token and parses the line again, but only
+ * runs the `scanfn` of the table entries whose options or values changed,
+ * and only re-checks those entries. Everything else, including the errors of
+ * unchanged entries, is taken from the previous parse, so the costly part of
+ * an edit, converting and validating values, depends on what it touches.
+ *
+ * Finding which entry each token belongs to still takes one pass of the
+ * option parser over the whole line, and a copy of `argv`, because whether a
+ * token is an option, an option's value or an untagged argument depends on
+ * the tokens before it. Each edit therefore still takes time proportional to
+ * the number of tokens; what the session saves is the scanning and checking
+ * of the entries the edit leaves alone.
+ *
+ * The results are stored in the table, as by `arg_parse`, and are the same as
+ * a full parse of the edited line would give. While the session exists, the
+ * table must only be parsed through it. A change to the untagged arguments
+ * rescans all the untagged entries, since they take the arguments in turn.
+ * Tables that expand response files, or read options from the environment or
+ * from configuration files, are parsed in full on every edit.
+ *
+ * Example usage:
+ * ```
+ * arg_session_t s = arg_session_create(argtable);
+ * arg_session_parse(s, argc, argv);
+ * // the user changes the third word
+ * if (arg_session_edit(s, ARG_EDIT_REPLACE, 2, "--level=3") > 0)
+ *     arg_print_errors(stdout, end, "shell");
+ * arg_session_destroy(s);
+ * ```
+ *
+ * @param argtable An array of pointers to argument table structs, terminated
+ *                 by an `arg_end` struct.
+ *
+ * @return A new session with an empty command line.
+ *
+ * @see arg_session_parse, arg_session_edit, arg_session_destroy
+ */
+ARG_EXTERN arg_session_t arg_session_create(void** argtable);
+
+/**
+ * Sets the command line of a session and parses it in full.
+ *
+ * The session keeps a copy of the arguments, so `argv` does not need to
+ * outlive the call. String values in the table point into the session's
+ * copies, and stay valid until their token is edited.
+ *
+ * @param session The session.
+ * @param argc    The number of command-line arguments.
+ * @param argv    The command-line arguments, as for `arg_parse`.
+ *
+ * @return The number of errors found during parsing.
+ *
+ * @see arg_session_create, arg_session_edit
+ */
+ARG_EXTERN int arg_session_parse(arg_session_t session, int argc, char** argv);
+
+/**
+ * Edits one token of the command line of a session and parses it again.
+ *
+ * @param session The session.
+ * @param edit    One of `enum arg_edit`.
+ * @param index   The position of the token in the command line, where 0 is
+ *                the program name.
+ * @param token   The new token, ignored by `ARG_EDIT_REMOVE`. The session
+ *                keeps a copy.
+ *
+ * @return The number of errors found in the edited command line, or -1 if
+ *         `edit` is not one of `enum arg_edit`, `index` is out of range, or
+ *         `token` is `NULL` for an insertion or replacement. The session is
+ *         left unchanged in that case.
+ *
+ * @see arg_session_parse, arg_session_argv
+ */
+ARG_EXTERN int arg_session_edit(arg_session_t session, int edit, int index, const char* token);
+
+/**
+ * Returns the number of tokens of the command line of a session.
+ */
+ARG_EXTERN int arg_session_argc(arg_session_t session);
+
+/**
+ * Returns the command line of a session, terminated by a NULL pointer.
+ *
+ * The array and its strings belong to the session, and change with each
+ * edit.
+ */
+ARG_EXTERN char** arg_session_argv(arg_session_t session);
+
+/**
+ * Destroys a session. The results of its last parse stay in the table.
+ *
+ * @param session A session created by `arg_session_create`, or `NULL`.
+ */
+ARG_EXTERN void arg_session_destroy(arg_session_t session);
+
+/**
+ * Prints a formatted command-line option specification to a file stream.
+ *
+ * The `arg_print_option` function generates a formatted representation of a
+ * command-line option, including its short options, long options, data type,
+ * and an optional suffix. This is useful for displaying option syntax in help
+ * messages, usage output, or documentation.
+ *
+ * The formatted option is written to the specified file stream (`fp`). You can
+ * control the appearance of the option specification, making it easy to
+ * integrate with custom help or documentation systems.
+ *
+ * Example usage:
+ * ```
+ * // Print option to stdout
+ * arg_print_option(stdout, "h", "help", NULL, NULL);
+ * ```
+ *
+ * @param fp        Output file stream to write to (e.g., `stdout` or `stderr`).
+ * @param shortopts String of short option characters (e.g., `"h"` for `-h`).
+ * @param longopts  String of long option names, comma-separated (e.g., `"help"` for `--help`).
+ * @param datatype  String describing the expected data type (e.g., `"<file>"`).
+ * @param suffix    Optional string to append after the option specification.
+ */
+ARG_EXTERN void arg_print_option(FILE* fp, const char* shortopts, const char* longopts, const char* datatype, const char* suffix);
+
+/**
+ * Prints a formatted command-line option specification to a dynamic string.
+ *
+ * The `arg_print_option_ds` function generates a formatted representation of a
+ * command-line option, including its short options, long options, data type,
+ * and an optional suffix. This is useful for displaying option syntax in help
+ * messages, usage output, or documentation that is built using dynamic string
+ * buffers.
+ *
+ * The formatted option is written to the specified dynamic string object
+ * (`arg_dstr_t`). You can control the appearance of the option specification,
+ * making it easy to integrate with custom help or documentation systems that
+ * require string-based output.
+ *
+ * Example usage:
+ * ```
+ * // Print option to a dynamic string
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_print_option_ds(ds, "v", "verbose", "<level>", NULL);
+ * printf("%s", arg_dstr_cstr(ds));
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds        Dynamic string object to write to.
+ * @param shortopts String of short option characters (e.g., `"h"` for `-h`).
+ * @param longopts  String of long option names, comma-separated (e.g., `"help"` for `--help`).
+ * @param datatype  String describing the expected data type (e.g., `"<file>"`).
+ * @param suffix    Optional string to append after the option specification.
+ */
+ARG_EXTERN void arg_print_option_ds(arg_dstr_t ds, const char* shortopts, const char* longopts, const char* datatype, const char* suffix);
+
+/**
+ * Prints a compact, single-line command-line syntax summary to a file stream.
+ *
+ * The `arg_print_syntax` function generates a concise, single-line usage
+ * summary for the command-line options and arguments defined in the argument
+ * table. This summary is useful for displaying quick usage information to
+ * users, such as in the output of a `--help` or usage message.
+ *
+ * The formatted syntax summary is written to the specified file stream (`fp`).
+ * You can append a custom `suffix` string to the end of the summary, for
+ * example, to indicate positional arguments.
+ *
+ * Example usage:
+ * ```
+ * // Print compact syntax summary to stdout
+ * arg_print_syntax(stdout, argtable, "[FILES...]");
+ * ```
+ *
+ * @param fp      Output file stream to write to (e.g., `stdout` or `stderr`).
+ * @param argtable Array of argument table structs describing the available
+ *                 options and arguments.
+ * @param suffix  String to append at the end of the syntax summary (e.g., for
+ *                positional arguments).
+ */
+ARG_EXTERN void arg_print_syntax(FILE* fp, void** argtable, const char* suffix);
+
+/**
+ * Prints a compact, single-line command-line syntax summary to a dynamic string.
+ *
+ * The `arg_print_syntax_ds` function generates a concise, single-line usage
+ * summary for the command-line options and arguments defined in the argument
+ * table. This summary is useful for displaying quick usage information to
+ * users, such as in the output of a `--help` or usage message, and is written
+ * to a dynamic string object (`arg_dstr_t`).
+ *
+ * You can append a custom `suffix` string to the end of the summary, for
+ * example, to indicate positional arguments.
+ *
+ * Example usage:
+ * ```
+ * // Print compact syntax summary to a dynamic string
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_print_syntax_ds(ds, argtable, "[FILES...]");
+ * printf("%s", arg_dstr_cstr(ds));
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds      Dynamic string object to write to.
+ * @param argtable Array of argument table structs describing the available
+ *                 options and arguments.
+ * @param suffix  String to append at the end of the syntax summary (e.g., for
+ *                positional arguments).
+ */
+ARG_EXTERN void arg_print_syntax_ds(arg_dstr_t ds, void** argtable, const char* suffix);
+
+/**
+ * Prints a verbose, multi-line command-line syntax summary to a file stream.
+ *
+ * The `arg_print_syntaxv` function generates a detailed, multi-line usage
+ * summary for the command-line options and arguments defined in the argument
+ * table. This verbose style provides more clarity than the compact single-line
+ * form, making it easier for users to understand complex command-line
+ * interfaces.
+ *
+ * The formatted syntax summary is written to the specified file stream (`fp`).
+ * You can append a custom `suffix` string to the end of the summary, for
+ * example, to indicate positional arguments.
+ *
+ * Example usage:
+ * ```
+ * // Print verbose syntax summary to stdout
+ * arg_print_syntaxv(stdout, argtable, "[FILES...]");
+ * ```
+ *
+ * @param fp      Output file stream to write to (e.g., `stdout` or `stderr`).
+ * @param argtable Array of argument table structs describing the available
+ *                 options and arguments.
+ * @param suffix  String to append at the end of the syntax summary (e.g., for
+ *                positional arguments).
+ */
+ARG_EXTERN void arg_print_syntaxv(FILE* fp, void** argtable, const char* suffix);
+
+/**
+ * Prints a verbose, multi-line command-line syntax summary to a dynamic string.
+ *
+ * The `arg_print_syntaxv_ds` function generates a detailed, multi-line usage
+ * summary for the command-line options and arguments defined in the argument
+ * table. This verbose style provides more clarity than the compact single-line
+ * form, making it easier for users to understand complex command-line
+ * interfaces.
+ *
+ * The formatted syntax summary is written to the specified dynamic string
+ * object (`arg_dstr_t`). You can append a custom `suffix` string to the end of
+ * the summary, for example, to indicate positional arguments.
+ *
+ * Example usage:
+ * ```
+ * // Print verbose syntax summary to a dynamic string
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_print_syntaxv_ds(ds, argtable, "[FILES...]");
+ * printf("%s", arg_dstr_cstr(ds));
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds      Dynamic string object to write to.
+ * @param argtable Array of argument table structs describing the available
+ *                 options and arguments.
+ * @param suffix  String to append at the end of the syntax summary (e.g., for
+ *                positional arguments).
+ */
+ARG_EXTERN void arg_print_syntaxv_ds(arg_dstr_t ds, void** argtable, const char* suffix);
+
+/**
+ * Prints the argument glossary in a customizable format to a file stream.
+ *
+ * The `arg_print_glossary` function generates a glossary of command-line
+ * options and arguments, formatted according to the specified format string.
+ * This glossary provides users with a summary of available options, their data
+ * types, and descriptions, making it easier to understand the command-line
+ * interface.
+ *
+ * The formatted glossary is written to the specified file stream (`fp`). The
+ * format string allows you to control the layout and appearance of each
+ * glossary entry, enabling integration with custom help or documentation
+ * systems.
+ *
+ * Example usage:
+ * ```
+ * // Print glossary to stdout with a custom format
+ * arg_print_glossary(stdout, argtable, "  %-20s %s\n");
+ * ```
+ *
+ * @param fp      Output file stream to write to (e.g., `stdout` or `stderr`).
+ * @param argtable Array of argument table structs describing the available
+ *                 options and arguments.
+ * @param format  Format string controlling the layout of each glossary entry.
+ */
+ARG_EXTERN void arg_print_glossary(FILE* fp, void** argtable, const char* format);
+
+/**
+ * Prints the argument glossary in a customizable format to a dynamic string.
+ *
+ * The `arg_print_glossary_ds` function generates a glossary of command-line
+ * options and arguments, formatted according to the specified format string.
+ * This glossary provides users with a summary of available options, their data
+ * types, and descriptions, making it easier to understand the command-line
+ * interface.
+ *
+ * The formatted glossary is written to the specified dynamic string object
+ * (`arg_dstr_t`). The format string allows you to control the layout and
+ * appearance of each glossary entry, enabling integration with custom help or
+ * documentation systems.
+ *
+ * Example usage:
+ * ```
+ * // Print glossary to a dynamic string with a custom format
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_print_glossary_ds(ds, argtable, "  %-20s %s\n");
+ * printf("%s", arg_dstr_cstr(ds));
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds      Dynamic string object to write to.
+ * @param argtable Array of argument table structs describing the available
+ *                 options and arguments.
+ * @param format  Format string controlling the layout of each glossary entry.
+ */
+ARG_EXTERN void arg_print_glossary_ds(arg_dstr_t ds, void** argtable, const char* format);
+
+/**
+ * Prints the argument glossary using strict GNU formatting conventions to a file
+ * stream.
+ *
+ * The `arg_print_glossary_gnu` function generates a glossary of command-line
+ * options and arguments, formatted to comply with GNU style conventions. In this
+ * format, long options are vertically aligned in a second column, and lines are
+ * wrapped at 80 characters for improved readability and consistency with GNU
+ * command-line tool documentation.
+ *
+ * The formatted glossary is written to the specified file stream (`fp`). This
+ * function is useful for generating help output that matches the look and feel
+ * of standard GNU utilities.
+ *
+ * Example usage:
+ * ```
+ * // Print GNU-style glossary to stdout
+ * arg_print_glossary_gnu(stdout, argtable);
+ * ```
+ *
+ * @param fp      Output file stream to write to (e.g., `stdout` or `stderr`).
+ * @param argtable Array of argument table structs describing the available
+ *                 options and arguments.
+ */
+ARG_EXTERN void arg_print_glossary_gnu(FILE* fp, void** argtable);
+
+/**
+ * Prints the argument glossary using strict GNU formatting conventions to a
+ * dynamic string.
+ *
+ * The `arg_print_glossary_gnu_ds` function generates a glossary of command-line
+ * options and arguments, formatted to comply with GNU style conventions. In
+ * this format, long options are vertically aligned in a second column, and
+ * lines are wrapped at 80 characters for improved readability and consistency
+ * with GNU command-line tool documentation.
+ *
+ * The formatted glossary is written to the specified dynamic string object
+ * (`arg_dstr_t`). This function is useful for generating help output that
+ * matches the look and feel of standard GNU utilities, especially when you need
+ * the output as a string for further processing, logging, or GUI display.
+ *
+ * Example usage:
+ * ```
+ * // Print GNU-style glossary to a dynamic string
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_print_glossary_gnu_ds(ds, argtable);
+ * printf("%s", arg_dstr_cstr(ds));
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds      Dynamic string object to write to.
+ * @param argtable Array of argument table structs describing the available
+ *                 options and arguments.
+ */
+ARG_EXTERN void arg_print_glossary_gnu_ds(arg_dstr_t ds, void** argtable);
+
+/**
+ * Prints a static shell completion script to a file stream.
+ *
+ * The `arg_print_completion` function generates a self-contained completion
+ * script for the shell selected by `shell` (see `enum arg_shell`). The script
+ * is derived from the short and long option names in the argument table, from
+ * whether each option takes a value, and from the names and descriptions of the
+ * sub-commands in the `arg_cmd` registry. Options and positional arguments
+ * created with `arg_file0`, `arg_file1`, or `arg_filen` (or any entry whose
+ * header carries the `ARG_HASFILEVALUE` flag) complete file names; other values
+ * are left to the user. The zsh and fish scripts also show the glossary text
+ * next to each option.
+ *
+ * Because the script contains everything it needs, completion runs in the
+ * shell alone: the program is never executed while the user presses TAB. A
+ * typical use is a hidden `--completion=SHELL` option, or a build step that
+ * installs the scripts next to the program.
+ *
+ * Registered sub-commands are offered as the first positional word. Their own
+ * options are not known to the registry, so words after a sub-command complete
+ * file names.
+ *
+ * Example usage:
+ * ```
+ * // Write a bash completion script for "mytool"
+ * arg_print_completion(stdout, argtable, "mytool", ARG_SHELL_BASH);
+ * ```
+ *
+ * @param fp       Output file stream to write to (e.g., `stdout` or a file).
+ * @param argtable Array of argument table structs describing the available
+ *                 options and arguments, or NULL to complete only the
+ *                 sub-commands.
+ * @param progname Name of the program the script completes.
+ * @param shell    Target shell, one of `ARG_SHELL_BASH`, `ARG_SHELL_ZSH`, or
+ *                 `ARG_SHELL_FISH`.
+ */
+ARG_EXTERN void arg_print_completion(FILE* fp, void** argtable, const char* progname, int shell);
+
+/**
+ * Prints a static shell completion script to a dynamic string.
+ *
+ * The `arg_print_completion_ds` function generates the same script as
+ * `arg_print_completion`, but appends it to the specified dynamic string object
+ * (`arg_dstr_t`). This is useful when the script is returned from a
+ * sub-command handler or written to a file by the caller.
+ *
+ * Example usage:
+ * ```
+ * // Generate a fish completion script for "mytool"
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_print_completion_ds(ds, argtable, "mytool", ARG_SHELL_FISH);
+ * printf("%s", arg_dstr_cstr(ds));
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds       Dynamic string object to write to.
+ * @param argtable Array of argument table structs describing the available
+ *                 options and arguments, or NULL to complete only the
+ *                 sub-commands.
+ * @param progname Name of the program the script completes.
+ * @param shell    Target shell, one of `ARG_SHELL_BASH`, `ARG_SHELL_ZSH`, or
+ *                 `ARG_SHELL_FISH`.
+ */
+ARG_EXTERN void arg_print_completion_ds(arg_dstr_t ds, void** argtable, const char* progname, int shell);
+
+/**
+ * Prints the details of all errors stored in the end data structure.
+ *
+ * The `arg_print_errors` function writes formatted error messages for all
+ * errors recorded in the specified `arg_end_t` structure to the given file
+ * stream (`fp`). The `progname` string is prepended to each error message,
+ * making it suitable for displaying or logging error output in command-line
+ * applications.
+ *
+ * This function is useful for reporting parsing errors to the user after
+ * calling `arg_parse`. It provides clear feedback about missing required
+ * arguments, invalid values, or other issues encountered during command-line
+ * parsing.
+ *
+ * Example usage:
+ * ```
+ * arg_lit_t *help = arg_lit0("h", "help", "Display help");
+ * arg_int_t *count = arg_int0("c", "count", "<n>", "Number of times");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = {help, count, end};
+ *
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors > 0) {
+ *     arg_print_errors(stderr, end, argv[0]);
+ * }
+ * ```
+ *
+ * @param fp       Output file stream to write to (e.g., `stdout` or `stderr`).
+ * @param end      Pointer to the `arg_end` structure containing error details.
+ * @param progname The name of the program to prepend to each error message.
+ *
+ * @see arg_parse, arg_print_errors_ds, arg_dstr_create, arg_dstr_cstr
+ */
+ARG_EXTERN void arg_print_errors(FILE* fp, arg_end_t* end, const char* progname);
+
+/**
+ * Prints the details of all errors stored in the end data structure to a dynamic
+ * string.
+ *
+ * The `arg_print_errors_ds` function writes formatted error messages for all
+ * errors recorded in the specified `arg_end_t` structure to the provided
+ * dynamic string object (`arg_dstr_t`). The `progname` string is prepended to
+ * each error message, making it suitable for displaying or logging error output
+ * in applications that use dynamic string buffers instead of standard output
+ * streams.
+ *
+ * This function is useful for applications that want to capture error messages
+ * for later display, logging, or integration with GUI or web interfaces.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors > 0) {
+ *     arg_print_errors_ds(ds, end, argv[0]);
+ *     fprintf(stderr, "%s", arg_dstr_cstr(ds));
+ * }
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds       Pointer to the dynamic string object to which the error
+ *                 messages are written.
+ * @param end      Pointer to the `arg_end` structure containing error details.
+ * @param progname The name of the program to prepend to each error message.
+ *
+ * @see arg_print_errors, arg_parse, arg_dstr_create, arg_dstr_cstr
+ */
+ARG_EXTERN void arg_print_errors_ds(arg_dstr_t ds, arg_end_t* end, const char* progname);
+
+/**
+ * Prints a formatted block of text with specified left and right margins.
+ *
+ * The `arg_print_formatted` function outputs the given text to the specified
+ * file stream (`fp`), arranging it in a column with the provided left and right
+ * margins. This is useful for generating neatly aligned help messages,
+ * glossaries, or any output where column formatting is desired.
+ *
+ * The function automatically wraps lines as needed to ensure that text does not
+ * exceed the specified right margin, and indents each line according to the
+ * left margin.
+ *
+ * Example usage:
+ * ```
+ * const char* msg = "This is a long help message that will be wrapped and "
+ *                   "indented according to the specified margins.";
+ * arg_print_formatted(stdout, 4, 60, msg);
+ * ```
+ *
+ * @param fp      Output file stream to write to (e.g., `stdout` or `stderr`).
+ * @param lmargin Left margin (number of spaces to indent each line).
+ * @param rmargin Right margin (maximum line width).
+ * @param text    Text to be printed and formatted.
+ */
+ARG_EXTERN void arg_print_formatted(FILE* fp, const unsigned lmargin, const unsigned rmargin, const char* text);
+
+/**
+ * Deallocates or frees all non-null entries in the argument table.
+ *
+ * The `arg_freetable` function iterates over the specified argument table array
+ * and frees any non-null entries, releasing the memory allocated for each
+ * argument structure. This is useful for cleaning up all argument objects
+ * created by `arg_<type>` constructor functions after you are done parsing and
+ * processing command-line arguments. Entries that own additional memory, such
+ * as the element arrays of the list types, release it through their
+ * `freefn` first.
+ *
+ * You should call this function once for each argument table array before your
+ * program exits to prevent memory leaks.
+ *
+ * Example usage:
+ * ```
+ * arg_lit_t *help = arg_lit0("h", "help", "Display help");
+ * arg_int_t *count = arg_int0("c", "count", "<n>", "Number of times");
+ * arg_end_t *end = arg_end(20);
+ * void *argtable[] = { help, count, end };
+ *
+ * // ... use argtable ...
+ *
+ * arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+ * ```
+ *
+ * @param argtable An array of pointers to argument table structs.
+ * @param n        The number of structs in the argument table.
+ *
+ * @see arg_free
+ */
+ARG_EXTERN void arg_freetable(void** argtable, size_t n);
+
+/**
+ * Creates a new dynamic string object.
+ *
+ * The `arg_dstr_create` function allocates and initializes a new dynamic string
+ * object (`arg_dstr_t`). This object can be used to efficiently build, modify,
+ * and manage strings of arbitrary length, such as help messages, error
+ * messages, or logs.
+ *
+ * The dynamic string automatically grows as needed to accommodate additional
+ * content appended via functions like `arg_dstr_cat`, `arg_dstr_catc`, or
+ * `arg_dstr_catf`. When you are finished using the dynamic string, release its
+ * resources with `arg_dstr_destroy` or `arg_dstr_free`.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_dstr_cat(ds, "Hello, ");
+ * arg_dstr_cat(ds, "world!");
+ * printf("%s\n", arg_dstr_cstr(ds)); // Output: Hello, world!
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @return A handle to the newly created dynamic string object, or `NULL` if
+ *         allocation fails.
+ *
+ * @see arg_dstr_destroy, arg_dstr_cat, arg_dstr_catc, arg_dstr_catf,
+ *      arg_dstr_cstr
+ */
+ARG_EXTERN arg_dstr_t arg_dstr_create(void);
+
+/**
+ * Destroys a dynamic string object and releases its resources.
+ *
+ * The `arg_dstr_destroy` function frees all memory and resources associated
+ * with the specified dynamic string object (`arg_dstr_t`). After calling this
+ * function, the dynamic string handle becomes invalid and must not be used
+ * unless reinitialized with `arg_dstr_create`.
+ *
+ * This function should be called when you are finished using a dynamic string
+ * to prevent memory leaks and ensure proper cleanup.
+ *
+ * The difference between `arg_dstr_destroy` and `arg_dstr_free` is that
+ * `arg_dstr_destroy` both frees the memory and invalidates the handle, making
+ * it safe for typical use cases where you want to fully release the dynamic
+ * string. `arg_dstr_free` only releases the memory, but does not necessarily
+ * invalidate the handle, and is intended for advanced or custom memory
+ * management scenarios. For most applications, `arg_dstr_destroy` is the
+ * preferred function to use.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_dstr_cat(ds, "Temporary string");
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds Pointer to the dynamic string object to destroy.
+ *
+ * @see arg_dstr_create, arg_dstr_free, arg_dstr_reset, arg_dstr_set
+ */
+ARG_EXTERN void arg_dstr_destroy(arg_dstr_t ds);
+
+/**
+ * Resets the dynamic string object to an empty state.
+ *
+ * The `arg_dstr_reset` function clears the contents of the specified dynamic
+ * string object (`arg_dstr_t`), making it an empty string but retaining the
+ * allocated memory for future use. This is useful when you want to reuse a
+ * dynamic string buffer without reallocating memory, such as when building
+ * multiple messages in a loop.
+ *
+ * Any previously stored string data is discarded, and the dynamic string is
+ * ready to accept new content via `arg_dstr_cat`, `arg_dstr_catc`, or
+ * `arg_dstr_catf`.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_dstr_cat(ds, "First message");
+ * printf("%s\n", arg_dstr_cstr(ds)); // Output: First message
+ * arg_dstr_reset(ds);
+ * arg_dstr_cat(ds, "Second message");
+ * printf("%s\n", arg_dstr_cstr(ds)); // Output: Second message
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds Pointer to the dynamic string object to reset.
+ *
+ * @see arg_dstr_create, arg_dstr_cat, arg_dstr_catc, arg_dstr_catf,
+ *      arg_dstr_cstr, arg_dstr_destroy
+ */
+ARG_EXTERN void arg_dstr_reset(arg_dstr_t ds);
+
+/**
+ * Frees the memory associated with a dynamic string object.
+ *
+ * The `arg_dstr_free` function releases all memory and resources allocated for
+ * the specified dynamic string object (`arg_dstr_t`). After calling this
+ * function, the dynamic string handle becomes invalid and must not be used
+ * unless reinitialized.
+ *
+ * The difference between `arg_dstr_free` and `arg_dstr_destroy` is that
+ * `arg_dstr_free` only releases the memory, but does not necessarily invalidate
+ * the handle. This is intended for advanced or custom memory management
+ * scenarios. In contrast, `arg_dstr_destroy` both frees the memory and
+ * invalidates the handle, making it safer and preferred for typical use cases
+ * where you want to fully release the dynamic string.
+ *
+ * For most applications, use `arg_dstr_destroy` to ensure proper cleanup and
+ * avoid accidental use of an invalid handle.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_dstr_cat(ds, "Temporary string");
+ * arg_dstr_free(ds); // Frees the memory associated with ds
+ * ```
+ *
+ * @param ds Pointer to the dynamic string object to free.
+ *
+ * @see arg_dstr_create, arg_dstr_destroy, arg_dstr_reset, arg_dstr_set
+ */
+ARG_EXTERN void arg_dstr_free(arg_dstr_t ds);
+
+#define ARG_DSTR_STATIC ((arg_dstr_freefn*)0)
+#define ARG_DSTR_VOLATILE ((arg_dstr_freefn*)1)
+#define ARG_DSTR_DYNAMIC ((arg_dstr_freefn*)3)
+
+/**
+ * Sets the contents of the dynamic string object to a specified string.
+ *
+ * The `arg_dstr_set` function replaces the current contents of the dynamic
+ * string object (`arg_dstr_t`) with the provided string. You can also specify a
+ * custom free function to control how the memory for the string is managed.
+ * This is useful when you want to take ownership of an existing string buffer
+ * or integrate with custom memory management schemes.
+ *
+ * The `free_proc` parameter determines how the memory for the string will be
+ * released when the dynamic string is reset or destroyed. You can use one of
+ * the following standard macros:
+ *
+ * - `ARG_DSTR_STATIC`: Indicates that the string is statically allocated or
+ *   should not be freed. Use this when the string is a string literal or
+ *   managed elsewhere and does not need to be freed by Argtable3.
+ * - `ARG_DSTR_VOLATILE`: Indicates that the string is temporary and should not
+ *   be freed. Use this when the string is only valid for the current scope or
+ *   will be replaced soon, and you do not want Argtable3 to free it.
+ * - `ARG_DSTR_DYNAMIC`: Indicates that the string was dynamically allocated
+ *   (e.g., with `malloc` or `strdup`) and should be freed by Argtable3. Use
+ *   this when you want Argtable3 to take ownership and automatically free the
+ *   memory when the dynamic string is reset or destroyed.
+ *
+ * If you provide a custom free function, it will be called to release the
+ * string when appropriate.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * char* buf = strdup("Hello, Argtable!");
+ * arg_dstr_set(ds, buf, ARG_DSTR_DYNAMIC); // ds takes ownership of buf
+ * printf("%s\n", arg_dstr_cstr(ds)); // Output: Hello, Argtable!
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds        Pointer to the dynamic string object.
+ * @param str       Pointer to the string to set as the new content.
+ * @param free_proc Pointer to a function that will be used to free the string,
+ *                  or one of the standard macros (`ARG_DSTR_STATIC`,
+ *                  `ARG_DSTR_VOLATILE`, `ARG_DSTR_DYNAMIC`).
+ *
+ * @see arg_dstr_create, arg_dstr_cat, arg_dstr_cstr, arg_dstr_destroy
+ */
+ARG_EXTERN void arg_dstr_set(arg_dstr_t ds, char* str, arg_dstr_freefn* free_proc);
+
+/**
+ * Appends a string to the dynamic string object.
+ *
+ * The `arg_dstr_cat` function appends the specified null-terminated string to
+ * the end of the dynamic string object (`arg_dstr_t`). This is useful for
+ * building up complex strings incrementally, such as constructing help
+ * messages, error messages, or logs.
+ *
+ * The dynamic string automatically grows as needed to accommodate the
+ * additional content.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_dstr_cat(ds, "Hello, ");
+ * arg_dstr_cat(ds, "world!");
+ * printf("%s\n", arg_dstr_cstr(ds)); // Output: Hello, world!
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds  Pointer to the dynamic string object.
+ * @param str Null-terminated string to append.
+ *
+ * @see arg_dstr_create, arg_dstr_catc, arg_dstr_catf, arg_dstr_cstr,
+ *      arg_dstr_destroy
+ */
+ARG_EXTERN void arg_dstr_cat(arg_dstr_t ds, const char* str);
+
+/**
+ * Appends a single character to the dynamic string object.
+ *
+ * The `arg_dstr_catc` function appends the specified character to the end of
+ * the dynamic string object (`arg_dstr_t`). This is useful for building up
+ * strings character by character, such as when formatting output, constructing
+ * error messages, or processing input streams.
+ *
+ * The dynamic string automatically grows as needed to accommodate additional
+ * characters.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_dstr_catc(ds, 'A');
+ * arg_dstr_catc(ds, 'B');
+ * arg_dstr_catc(ds, 'C');
+ * printf("%s\n", arg_dstr_cstr(ds)); // Output: ABC
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds Pointer to the dynamic string object.
+ * @param c  The character to append.
+ *
+ * @see arg_dstr_create, arg_dstr_cat, arg_dstr_catf, arg_dstr_cstr,
+ *      arg_dstr_destroy
+ */
+ARG_EXTERN void arg_dstr_catc(arg_dstr_t ds, char c);
+
+/**
+ * Appends a formatted string to the dynamic string object.
+ *
+ * The `arg_dstr_catf` function appends a formatted string, generated using
+ * `printf`-style formatting, to the end of the specified dynamic string object
+ * (`arg_dstr_t`). This allows you to efficiently build up complex strings with
+ * variable content, such as error messages, help text, or logs.
+ *
+ * The function accepts a format string and a variable number of arguments,
+ * similar to `printf`. The resulting formatted string is concatenated to the
+ * current contents of the dynamic string.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_dstr_catf(ds, "Error: invalid value '%s' for option --%s\n", value, optname);
+ * printf("%s", arg_dstr_cstr(ds));
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds  Pointer to the dynamic string object.
+ * @param fmt Format string (as in `printf`).
+ * @param ... Additional arguments to format.
+ *
+ * @see arg_dstr_create, arg_dstr_cat, arg_dstr_cstr, arg_dstr_destroy
+ */
+ARG_EXTERN void arg_dstr_catf(arg_dstr_t ds, const char* fmt, ...);
+
+/**
+ * Retrieves the null-terminated string from a dynamic string object.
+ *
+ * The `arg_dstr_cstr` function returns a pointer to the internal
+ * null-terminated character buffer managed by the dynamic string object
+ * (`arg_dstr_t`). This allows you to access the current contents of the dynamic
+ * string for printing, logging, or further processing.
+ *
+ * The returned pointer remains valid until the dynamic string is reset,
+ * modified, or destroyed. Do not modify or free the returned string directly;
+ * use the appropriate Argtable3 dynamic string functions for memory management.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_dstr_cat(ds, "Hello, ");
+ * arg_dstr_cat(ds, "world!");
+ * printf("%s\n", arg_dstr_cstr(ds)); // Output: Hello, world!
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds Dynamic string object.
+ * @return   Pointer to the internal null-terminated string buffer.
+ *
+ * @see arg_dstr_create, arg_dstr_cat, arg_dstr_destroy
+ */
+ARG_EXTERN char* arg_dstr_cstr(arg_dstr_t ds);
+
+/**
+ * Initializes the sub-command mechanism.
+ *
+ * The `arg_cmd_init` function sets up the internal data structures required for
+ * sub-command support in Argtable3. It must be called before registering,
+ * dispatching, or iterating over sub-commands in your application.
+ *
+ * This function is typically called once at program startup, before any
+ * sub-commands are registered. It ensures that the sub-command API is ready for
+ * use. After initialization, you can use functions such as `arg_cmd_register`,
+ * `arg_cmd_dispatch`, and `arg_cmd_itr_create`.
+ *
+ * When sub-command support is no longer needed (e.g., at program shutdown),
+ * call `arg_cmd_uninit` to release resources and prevent memory leaks.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_init();
+ * // Register and use sub-commands...
+ * arg_cmd_uninit();
+ * ```
+ *
+ * @see arg_cmd_uninit, arg_cmd_register, arg_cmd_unregister, arg_cmd_count
+ */
+ARG_EXTERN void arg_cmd_init(void);
+
+/**
+ * Releases resources and cleans up the sub-command mechanism.
+ *
+ * The `arg_cmd_uninit` function deinitializes the sub-command infrastructure,
+ * freeing any memory or resources allocated for sub-command registration,
+ * lookup, and iteration. After calling this function, all registered
+ * sub-commands are removed, and the sub-command API can no longer be used until
+ * `arg_cmd_init` is called again.
+ *
+ * This function should be called at program shutdown or when you no longer need
+ * sub-command support, to prevent memory leaks and ensure proper cleanup.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_init();
+ * // Register and use sub-commands...
+ * arg_cmd_uninit();
+ * ```
+ *
+ * @see arg_cmd_init, arg_cmd_register, arg_cmd_unregister, arg_cmd_count
+ */
+ARG_EXTERN void arg_cmd_uninit(void);
+
+/**
+ * Registers a new sub-command with the application.
+ *
+ * The `arg_cmd_register` function adds a sub-command to the application's
+ * sub-command table, associating it with a handler function, a description, and
+ * an optional context pointer. This enables applications to support multiple
+ * commands (such as `git` or `docker`-style interfaces), where each sub-command
+ * can have its own logic and help text.
+ *
+ * The handler function (`proc`) will be called when the sub-command is
+ * dispatched via `arg_cmd_dispatch`. The description is used in help and usage
+ * messages. The context pointer (`ctx`) can be used to pass user-defined data
+ * to the handler.
+ *
+ * If a sub-command with the same name already exists, its registration will be
+ * replaced with the new handler, description, and context.
+ *
+ * Unless the library is built with `ARG_CMD_COMPACT`, the name must be shorter
+ * than `ARG_CMD_NAME_LEN` and the description shorter than
+ * `ARG_CMD_DESCRIPTION_LEN` bytes. In compact mode both strings are copied into
+ * the registry's string arena and may have any length.
+ *
+ * Example usage:
+ * ```
+ * // Register a "list" sub-command
+ * arg_cmd_register("list", list_cmd, "List all items", NULL);
+ *
+ * // Register a "remove" sub-command with context
+ * arg_cmd_register("remove", remove_cmd, "Remove an item", my_context_ptr);
+ * ```
+ *
+ * @param name        The name of the sub-command (null-terminated string).
+ * @param proc        Pointer to the handler function for the sub-command.
+ * @param description A short description of the sub-command for help output.
+ * @param ctx         Optional user-defined context pointer (may be NULL).
+ *
+ * @see arg_cmd_unregister, arg_cmd_dispatch, arg_cmd_info, arg_cmd_count
+ */
+ARG_EXTERN void arg_cmd_register(const char* name, arg_cmdfn proc, const char* description, void* ctx);
+
+/**
+ * Registers a sub-command whose argument table is owned by the registry.
+ *
+ * The `arg_cmd_register_table` function registers a sub-command like
+ * `arg_cmd_register`, but instead of building and freeing its own argument
+ * table on every call, the handler receives a table that has already been
+ * parsed. The table is created lazily: `factory` is called the first time the
+ * sub-command is dispatched, and the result is cached. Later dispatches reset
+ * and re-parse the cached table, so repeated commands no longer pay the cost of
+ * constructing it, and commands that are never used cost nothing.
+ *
+ * Because the table is reused, values that the factory stores into it as
+ * defaults are overwritten by the first parse that supplies the option. A
+ * handler that needs a default should check the `count` field of the option
+ * instead.
+ *
+ * If the cached table is in use when the sub-command is dispatched again, for
+ * example by `arg_cmd_dispatch_async` or by a parallel batch, the dispatch
+ * builds a temporary table with the factory and frees it afterwards. The cached
+ * table is freed when the sub-command is unregistered or replaced, or when
+ * `arg_cmd_uninit` is called, but not before the dispatches that are queued or
+ * running for it have finished.
+ *
+ * The `proc` field of the sub-command's `arg_cmd_info_t` is a handler provided
+ * by the registry, and its `ctx` field points to the registry's state for the
+ * sub-command, so `info->proc(argc, argv, res, info->ctx)` runs the sub-command
+ * just as `arg_cmd_dispatch` does. The `ctx` given here is passed on to
+ * `proc` and `factory`.
+ *
+ * Example usage:
+ * ```
+ * enum { LIST_VERBOSE, LIST_HELP, LIST_END, LIST_NARGS };
+ *
+ * void** list_table(void* ctx) {
+ *     void** argtable = malloc(LIST_NARGS * sizeof(void*));
+ *     argtable[LIST_VERBOSE] = arg_lit0("v", "verbose", "verbose output");
+ *     argtable[LIST_HELP] = arg_lit0("h", "help", "print this help");
+ *     argtable[LIST_END] = arg_end(20);
+ *     return argtable;
+ * }
+ *
+ * int list_cmd(int argc, char* argv[], void** argtable, int nerrors, arg_dstr_t res, void* ctx) {
+ *     arg_lit_t* verbose = argtable[LIST_VERBOSE];
+ *     if (nerrors > 0) {
+ *         arg_print_errors_ds(res, argtable[LIST_END], argv[0]);
+ *         return 1;
+ *     }
+ *     // Implementation for the "list" command
+ *     return 0;
+ * }
+ *
+ * arg_cmd_register_table("list", list_cmd, list_table, "List all items", NULL);
+ * ```
+ *
+ * @param name        The name of the sub-command (null-terminated string).
+ * @param proc        Pointer to the handler function for the sub-command.
+ * @param factory     Function that builds the sub-command's argument table.
+ * @param description A short description of the sub-command for help output.
+ * @param ctx         Optional user-defined context pointer (may be NULL),
+ *                    passed to both `proc` and `factory`.
+ *
+ * @see arg_cmd_register, arg_cmd_dispatch, arg_cmdtablefn, arg_cmdfactoryfn
+ */
+ARG_EXTERN void arg_cmd_register_table(const char* name, arg_cmdtablefn proc, arg_cmdfactoryfn factory, const char* description, void* ctx);
+
+/**
+ * Unregisters a sub-command by name.
+ *
+ * The `arg_cmd_unregister` function removes a previously registered sub-command
+ * from the application's sub-command table. After calling this function, the
+ * specified sub-command will no longer be available for dispatch, iteration, or
+ * help output.
+ *
+ * This function is useful for applications that support dynamic registration
+ * and removal of sub-commands at runtime, such as plugin-based tools or
+ * interactive shells.
+ *
+ * If the sub-command with the given name does not exist, the function has no
+ * effect.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_register("remove", remove_cmd, "Remove an item", NULL);
+ * // ... later ...
+ * arg_cmd_unregister("remove");
+ * ```
+ *
+ * @param name The name of the sub-command to unregister (null-terminated
+ * string).
+ *
+ * @see arg_cmd_register, arg_cmd_dispatch, arg_cmd_count, arg_cmd_info
+ */
+ARG_EXTERN void arg_cmd_unregister(const char* name);
+
+/**
+ * Dispatches a registered sub-command by name.
+ *
+ * The `arg_cmd_dispatch` function locates the sub-command with the specified
+ * name and invokes its handler function, passing the provided command-line
+ * arguments and a dynamic string buffer for output or error messages.
+ *
+ * This function is typically used in applications that support multiple
+ * sub-commands (such as `git` or `docker`-style interfaces), allowing you to
+ * delegate command-line processing to the appropriate handler based on the
+ * user's input.
+ *
+ * If the sub-command is found, its handler function is called with the given
+ * arguments and context. If the sub-command is not found, an error message may
+ * be written to the result buffer, and a nonzero error code is returned.
+ *
+ * Example usage:
+ * ```
+ * // Register sub-commands
+ * arg_cmd_register("list", list_cmd, "List items", NULL);
+ * arg_cmd_register("add", add_cmd, "Add an item", NULL);
+ *
+ * // Dispatch based on argv[1]
+ * arg_dstr_t res = arg_dstr_create();
+ * int ret = arg_cmd_dispatch(argv[1], argc - 1, argv + 1, res);
+ * if (ret != 0) {
+ *     fprintf(stderr, "%s\n", arg_dstr_cstr(res));
+ * }
+ * arg_dstr_destroy(res);
+ * ```
+ *
+ * @param name The name of the sub-command to dispatch (null-terminated string).
+ * @param argc The number of command-line arguments for the sub-command.
+ * @param argv The array of command-line arguments for the sub-command.
+ * @param res  Pointer to a dynamic string buffer for output or error messages.
+ *
+ * @return 0 if the sub-command was found and executed successfully, nonzero if
+ *         the sub-command was not found or an error occurred.
+ *
+ * @see arg_cmd_register, arg_cmd_info, arg_cmd_count, arg_dstr_create,
+ *      arg_dstr_cstr
+ */
+ARG_EXTERN int arg_cmd_dispatch(const char* name, int argc, char* argv[], arg_dstr_t res);
+
+/**
+ * Sets the number of worker threads used by `arg_cmd_dispatch_async`.
+ *
+ * The asynchronous dispatcher runs sub-command handlers on a pool of worker
+ * threads that is created on the first call to `arg_cmd_dispatch_async`. By
+ * default the pool starts one worker per online processor. Call this function
+ * before dispatching to choose a different size, for example to match the
+ * number of I/O-bound commands you want to overlap.
+ *
+ * If a pool is already running, all jobs queued on it are finished first, and
+ * the new size takes effect with the next asynchronous dispatch. Passing `0`
+ * starts no workers at all: each job then runs on the thread that first waits
+ * for it. The same happens when the library is built without thread support
+ * (`ARG_ENABLE_THREADS`).
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_init();
+ * arg_cmd_set_workers(4);
+ * // Register and dispatch sub-commands...
+ * arg_cmd_uninit();
+ * ```
+ *
+ * @param nworkers Number of worker threads, or a negative value to use one
+ *                 worker per online processor.
+ *
+ * @see arg_cmd_dispatch_async, arg_cmd_job_wait
+ */
+ARG_EXTERN void arg_cmd_set_workers(int nworkers);
+
+/**
+ * Queues a registered sub-command for execution on a worker thread.
+ *
+ * The `arg_cmd_dispatch_async` function is the asynchronous counterpart of
+ * `arg_cmd_dispatch`. It looks up the sub-command, queues a call to its handler
+ * on the worker pool, and returns immediately with a job handle. Each job owns
+ * its own result buffer, so independent commands can run side by side and
+ * their output never interleaves.
+ *
+ * Use `arg_cmd_job_poll` to check whether a job has finished,
+ * `arg_cmd_job_wait` to block until it has and fetch the handler's return code,
+ * and `arg_cmd_job_result` to read its output. Release the job with
+ * `arg_cmd_job_destroy`. A job that has not been picked up by a worker when
+ * you wait for it is run directly on the waiting thread.
+ *
+ * The `argv` array and the strings it points to must stay valid until the job
+ * has finished. The job takes the handler and context of the sub-command when
+ * it is queued, so the sub-command may be replaced or unregistered while the
+ * job is pending. Handlers must be safe to run concurrently with each other.
+ * Handlers that parse their own argument tables do so in parallel, unless the
+ * library uses the getopt of the C library (`ARGTABLE3_REPLACE_GETOPT=OFF`),
+ * whose global state makes `arg_parse` serialize the calls.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_job_t jobs[2];
+ * jobs[0] = arg_cmd_dispatch_async("fetch", argc1, argv1);
+ * jobs[1] = arg_cmd_dispatch_async("fetch", argc2, argv2);
+ * for (int i = 0; i < 2; i++) {
+ *     int ret = arg_cmd_job_wait(jobs[i]);
+ *     printf("%d: %s\n", ret, arg_dstr_cstr(arg_cmd_job_result(jobs[i])));
+ *     arg_cmd_job_destroy(jobs[i]);
+ * }
+ * ```
+ *
+ * @param name The name of the sub-command to dispatch (null-terminated string).
+ * @param argc The number of command-line arguments for the sub-command.
+ * @param argv The array of command-line arguments for the sub-command.
+ *
+ * @return A handle to the queued job.
+ *
+ * @see arg_cmd_dispatch, arg_cmd_set_workers, arg_cmd_job_poll,
+ *      arg_cmd_job_wait, arg_cmd_job_result, arg_cmd_job_destroy
+ */
+ARG_EXTERN arg_cmd_job_t arg_cmd_dispatch_async(const char* name, int argc, char* argv[]);
+
+/**
+ * Checks whether an asynchronous job has finished without blocking.
+ *
+ * @param job The job handle returned by `arg_cmd_dispatch_async`.
+ *
+ * @return 1 if the handler has returned, 0 if it is still queued or running.
+ *
+ * @see arg_cmd_dispatch_async, arg_cmd_job_wait
+ */
+ARG_EXTERN int arg_cmd_job_poll(arg_cmd_job_t job);
+
+/**
+ * Waits for an asynchronous job to finish.
+ *
+ * @param job The job handle returned by `arg_cmd_dispatch_async`.
+ *
+ * @return The return code of the sub-command handler.
+ *
+ * @see arg_cmd_dispatch_async, arg_cmd_job_poll, arg_cmd_job_result
+ */
+ARG_EXTERN int arg_cmd_job_wait(arg_cmd_job_t job);
+
+/**
+ * Returns the output of an asynchronous job, waiting for it if necessary.
+ *
+ * The returned dynamic string is owned by the job and stays valid until
+ * `arg_cmd_job_destroy` is called.
+ *
+ * @param job The job handle returned by `arg_cmd_dispatch_async`.
+ *
+ * @return The result buffer the handler wrote to.
+ *
+ * @see arg_cmd_dispatch_async, arg_cmd_job_wait, arg_cmd_job_destroy
+ */
+ARG_EXTERN arg_dstr_t arg_cmd_job_result(arg_cmd_job_t job);
+
+/**
+ * Releases an asynchronous job, waiting for it first if it is still pending.
+ *
+ * @param job The job handle returned by `arg_cmd_dispatch_async`.
+ *
+ * @see arg_cmd_dispatch_async, arg_cmd_job_wait
+ */
+ARG_EXTERN void arg_cmd_job_destroy(arg_cmd_job_t job);
+
+/**
+ * Sets the attributes of a registered sub-command.
+ *
+ * Attributes tell the library how a sub-command may be scheduled. Currently
+ * the only attribute is `ARG_CMD_INDEPENDENT`, which marks a command whose
+ * result does not depend on, and does not affect, the commands around it.
+ * `arg_cmd_batch_run` runs consecutive independent commands in parallel on
+ * the worker pool.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_register("checksum", checksum_cmd, "Print a file checksum", NULL);
+ * arg_cmd_set_flags("checksum", ARG_CMD_INDEPENDENT);
+ * ```
+ *
+ * @param name  The name of a registered sub-command.
+ * @param flags A bitwise OR of `enum arg_cmd_flag` values.
+ *
+ * @see arg_cmd_register, arg_cmd_batch_run
+ */
+ARG_EXTERN void arg_cmd_set_flags(const char* name, int flags);
+
+/**
+ * Loads a batch script of sub-commands from a file.
+ *
+ * The `arg_cmd_batch_load` function memory-maps the script and splits it into
+ * command lines in a single pass. Each non-empty line is one command, whose
+ * first word names the sub-command. Words are separated by white space and
+ * follow shell-like quoting rules: single quotes keep their contents
+ * literally, double quotes honour `\"` and `\\` escapes, and an unquoted
+ * backslash escapes the next character or, at the end of a line, continues the
+ * command on the next line. A `#` at the start of a word comments out the rest
+ * of the line.
+ *
+ * Words are unquoted in place inside the mapping, so loading a script
+ * allocates memory per command line but never per word.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_batch_t batch = arg_cmd_batch_load("setup.script");
+ * if (batch) {
+ *     int nfailed = arg_cmd_batch_run(batch);
+ *     for (int i = 0; i < arg_cmd_batch_count(batch); i++) {
+ *         arg_cmd_batch_entry_t* e = arg_cmd_batch_entry(batch, i);
+ *         printf("%d: %s (%.3f ms)\n", e->line, arg_dstr_cstr(e->res), e->elapsed * 1000);
+ *     }
+ *     arg_cmd_batch_destroy(batch);
+ * }
+ * ```
+ *
+ * @param path Path of the script file.
+ *
+ * @return A new batch, or `NULL` if the file could not be read.
+ *
+ * @see arg_cmd_batch_create, arg_cmd_batch_run, arg_cmd_batch_destroy
+ */
+ARG_EXTERN arg_cmd_batch_t arg_cmd_batch_load(const char* path);
+
+/**
+ * Creates a batch of sub-commands from script text held in memory.
+ *
+ * This function behaves like `arg_cmd_batch_load`, but takes a copy of the
+ * given text instead of mapping a file.
+ *
+ * @param script The script text, which does not need to be null-terminated.
+ * @param len    The length of the script text in bytes.
+ *
+ * @return A new batch.
+ *
+ * @see arg_cmd_batch_load, arg_cmd_batch_run, arg_cmd_batch_destroy
+ */
+ARG_EXTERN arg_cmd_batch_t arg_cmd_batch_create(const char* script, size_t len);
+
+/**
+ * Runs every command of a batch in script order.
+ *
+ * Each command is dispatched to its registered handler, and its return code,
+ * output and run time are stored in the corresponding batch entry. Commands
+ * marked `ARG_CMD_INDEPENDENT` are queued on the worker pool used by
+ * `arg_cmd_dispatch_async`, so a run of consecutive independent commands
+ * executes in parallel. Any other command waits for all earlier commands to
+ * finish and then runs on the calling thread. Results are always reported in
+ * input order.
+ *
+ * A line naming an unregistered sub-command gets a return code of `-1` and an
+ * error message in its result buffer. A batch can be run more than once.
+ *
+ * @param batch The batch to run.
+ *
+ * @return The number of commands whose return code was not zero.
+ *
+ * @see arg_cmd_batch_load, arg_cmd_batch_entry, arg_cmd_set_flags
+ */
+ARG_EXTERN int arg_cmd_batch_run(arg_cmd_batch_t batch);
+
+/**
+ * Returns the number of commands in a batch.
+ *
+ * @param batch The batch to query.
+ *
+ * @return The number of non-empty command lines in the script.
+ *
+ * @see arg_cmd_batch_entry
+ */
+ARG_EXTERN int arg_cmd_batch_count(arg_cmd_batch_t batch);
+
+/**
+ * Returns a command of a batch by index.
+ *
+ * @param batch The batch to query.
+ * @param i     Index of the command, from 0 to `arg_cmd_batch_count() - 1`.
+ *
+ * @return Pointer to the entry, owned by the batch.
+ *
+ * @see arg_cmd_batch_count, arg_cmd_batch_run
+ */
+ARG_EXTERN arg_cmd_batch_entry_t* arg_cmd_batch_entry(arg_cmd_batch_t batch, int i);
+
+/**
+ * Releases a batch, its script buffer and all results.
+ *
+ * @param batch The batch to destroy. May be `NULL`.
+ *
+ * @see arg_cmd_batch_load, arg_cmd_batch_create
+ */
+ARG_EXTERN void arg_cmd_batch_destroy(arg_cmd_batch_t batch);
+
+/**
+ * Returns the number of registered sub-commands.
+ *
+ * The `arg_cmd_count` function returns the total number of sub-commands
+ * currently registered in the application. This is useful for applications that
+ * support multiple commands (such as `git` or `docker`-style interfaces) and
+ * need to enumerate, display, or manage the available sub-commands.
+ *
+ * You can use this function to determine the size of the sub-command table,
+ * iterate over all registered sub-commands, or display a summary of available
+ * commands to the user.
+ *
+ * Example usage:
+ * ```
+ * unsigned int count = arg_cmd_count();
+ * printf("There are %u sub-commands registered.\n", count);
+ * ```
+ *
+ * @return The number of sub-commands currently registered.
+ *
+ * @see arg_cmd_register, arg_cmd_info, arg_cmd_itr_create
+ */
+ARG_EXTERN unsigned int arg_cmd_count(void);
+
+/**
+ * Retrieves information about a registered sub-command by name.
+ *
+ * The `arg_cmd_info` function returns a pointer to the `arg_cmd_info_t`
+ * structure for the sub-command with the specified name. This structure
+ * contains metadata such as the sub-command's name, description, handler
+ * function, and context pointer.
+ *
+ * This function is useful for querying details about a specific sub-command,
+ * such as when generating help output, dispatching commands, or inspecting
+ * available sub-commands in applications that support multiple commands (e.g.,
+ * `git` or `docker`-style interfaces).
+ *
+ * If the sub-command is not found, the function returns `NULL`.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_info_t* info = arg_cmd_info("list");
+ * if (info) {
+ *     printf("Sub-command: %s - %s\n", info->name, info->description);
+ * }
+ * ```
+ *
+ * @param name The name of the sub-command to look up (null-terminated string).
+ * @return     Pointer to the `arg_cmd_info_t` structure for the sub-command, or
+ *             `NULL` if the sub-command is not found.
+ *
+ * @see arg_cmd_register, arg_cmd_count, arg_cmd_itr_create, arg_cmd_info_t
+ */
+ARG_EXTERN arg_cmd_info_t* arg_cmd_info(const char* name);
+
+/**
+ * Creates a new sub-command iterator for traversing registered sub-commands.
+ *
+ * The `arg_cmd_itr_create` function allocates and initializes a sub-command
+ * iterator, which can be used to traverse all registered sub-commands in the
+ * application. This iterator provides a convenient way to enumerate, search, or
+ * process sub-commands, especially in applications that support multiple
+ * commands (such as `git` or `docker`-style interfaces).
+ *
+ * After creating the iterator, you can use functions like `arg_cmd_itr_advance`
+ * to move through the sub-command table, and `arg_cmd_itr_key` or
+ * `arg_cmd_itr_value` to access the current sub-command's name or metadata.
+ * When finished, call `arg_cmd_itr_destroy` to release resources.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_itr_t itr = arg_cmd_itr_create();
+ * while (arg_cmd_itr_advance(itr)) {
+ *     const char* key = arg_cmd_itr_key(itr);
+ *     printf("Sub-command: %s\n", key);
+ * }
+ * arg_cmd_itr_destroy(itr);
+ * ```
+ *
+ * @return A handle to the newly created sub-command iterator, or `NULL` if
+ *         allocation fails.
+ *
+ * @see arg_cmd_itr_destroy, arg_cmd_itr_advance, arg_cmd_itr_key,
+ *      arg_cmd_itr_value
+ */
+ARG_EXTERN arg_cmd_itr_t arg_cmd_itr_create(void);
+
+/**
+ * Destroys the sub-command iterator and releases associated resources.
+ *
+ * The `arg_cmd_itr_destroy` function deallocates any memory or resources
+ * associated with a sub-command iterator created by `arg_cmd_itr_create`. After
+ * calling this function, the iterator is no longer valid and must not be used.
+ *
+ * This function should be called when you are finished iterating over
+ * sub-commands to prevent memory leaks and ensure proper cleanup.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_itr_t itr = arg_cmd_itr_create();
+ * while (arg_cmd_itr_advance(itr)) {
+ *     // process sub-commands
+ * }
+ * arg_cmd_itr_destroy(itr);
+ * ```
+ *
+ * @param itr The sub-command iterator to destroy.
+ *
+ * @see arg_cmd_itr_create, arg_cmd_itr_advance, arg_cmd_itr_key,
+ *      arg_cmd_itr_value
+ */
+ARG_EXTERN void arg_cmd_itr_destroy(arg_cmd_itr_t itr);
+
+/**
+ * Advances the sub-command iterator to the next entry.
+ *
+ * The `arg_cmd_itr_advance` function moves the sub-command iterator to the next
+ * sub-command in the table. This allows you to iterate over all registered
+ * sub-commands in your application, enabling tasks such as listing available
+ * commands, generating help output, or performing batch operations.
+ *
+ * This function is typically used in a loop, where you repeatedly call
+ * `arg_cmd_itr_advance` and retrieve the current sub-command's key or value
+ * using `arg_cmd_itr_key` or `arg_cmd_itr_value`.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_itr_t itr = arg_cmd_itr_create();
+ * while (arg_cmd_itr_advance(itr)) {
+ *     const char* key = arg_cmd_itr_key(itr);
+ *     printf("Sub-command: %s\n", key);
+ * }
+ * arg_cmd_itr_destroy(itr);
+ * ```
+ *
+ * @param itr The sub-command iterator.
+ * @return    1 if the iterator was advanced to a valid entry, 0 if there are no
+ *            more entries (end of the sub-command table).
+ *
+ * @see arg_cmd_itr_create, arg_cmd_itr_key, arg_cmd_itr_value, arg_cmd_info_t
+ */
+ARG_EXTERN int arg_cmd_itr_advance(arg_cmd_itr_t itr);
+
+/**
+ * Retrieves the key (name) of the sub-command at the current iterator position.
+ *
+ * The `arg_cmd_itr_key` function returns a pointer to the key (typically the
+ * sub-command name as a null-terminated string) at the current position of the
+ * sub-command iterator. This allows you to access the identifier for the
+ * sub-command currently referenced by the iterator, which is useful for
+ * displaying, comparing, or processing sub-commands in applications that
+ * support multiple commands.
+ *
+ * This function is typically used when iterating over all registered
+ * sub-commands or after searching for a specific sub-command using the
+ * iterator.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_itr_t itr = arg_cmd_itr_create();
+ * while (arg_cmd_itr_advance(itr)) {
+ *     const char* key = arg_cmd_itr_key(itr);
+ *     printf("Sub-command: %s\n", key);
+ * }
+ * arg_cmd_itr_destroy(itr);
+ * ```
+ *
+ * @param itr The sub-command iterator.
+ * @return    Pointer to the key (sub-command name) at the current iterator
+ *            position, or `NULL` if the iterator is not valid or at the end.
+ *
+ * @see arg_cmd_itr_create, arg_cmd_itr_advance, arg_cmd_itr_value,
+ *      arg_cmd_info_t
+ */
+ARG_EXTERN char* arg_cmd_itr_key(arg_cmd_itr_t itr);
+
+/**
+ * Retrieves the value (sub-command information) at the current iterator
+ * position.
+ *
+ * The `arg_cmd_itr_value` function returns a pointer to the `arg_cmd_info_t`
+ * structure at the current position of the sub-command iterator. This allows
+ * you to access metadata and handler information for the sub-command found or
+ * iterated to by the iterator.
+ *
+ * This function is typically used after advancing the iterator or searching for
+ * a specific sub-command, enabling you to inspect the sub-command's name,
+ * description, handler function, and context pointer.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_itr_t itr = arg_cmd_itr_create();
+ * if (arg_cmd_itr_search(itr, "list")) {
+ *     arg_cmd_info_t* info = arg_cmd_itr_value(itr);
+ *     printf("Found sub-command: %s - %s\n", info->name, info->description);
+ * }
+ * arg_cmd_itr_destroy(itr);
+ * ```
+ *
+ * @param itr The sub-command iterator.
+ * @return    Pointer to the `arg_cmd_info_t` structure at the current iterator
+ *            position, or `NULL` if the iterator is not valid or at the end.
+ *
+ * @see arg_cmd_itr_create, arg_cmd_itr_advance, arg_cmd_itr_search,
+ *      arg_cmd_info_t
+ */
+ARG_EXTERN arg_cmd_info_t* arg_cmd_itr_value(arg_cmd_itr_t itr);
+
+/**
+ * Searches for a sub-command by key using the sub-command iterator.
+ *
+ * The `arg_cmd_itr_search` function searches the sub-command table for a
+ * sub-command whose key matches the specified value, starting from the current
+ * position of the iterator. If a match is found, the iterator is positioned at
+ * the found entry.
+ *
+ * This function is useful for efficiently locating a specific sub-command in
+ * applications that support multiple commands (such as `git` or `docker`-style
+ * interfaces), especially when iterating over or managing a dynamic set of
+ * sub-commands.
+ *
+ * Example usage:
+ * ```
+ * arg_cmd_itr_t itr = arg_cmd_itr_create();
+ * if (arg_cmd_itr_search(itr, "list")) {
+ *     arg_cmd_info_t* info = arg_cmd_itr_value(itr);
+ *     printf("Found sub-command: %s - %s\n", info->name, info->description);
+ * }
+ * arg_cmd_itr_destroy(itr);
+ * ```
+ *
+ * @param itr The sub-command iterator.
+ * @param k   The key to search for (typically a string with the sub-command
+ * name).
+ * @return    1 if the key is found and the iterator is positioned at the entry,
+ *            0 otherwise.
+ *
+ * @see arg_cmd_itr_create, arg_cmd_itr_value, arg_cmd_info_t
+ */
+ARG_EXTERN int arg_cmd_itr_search(arg_cmd_itr_t itr, void* k);
+
+/**
+ * Sorts an array using a custom comparison function.
+ *
+ * The `arg_mgsort` function performs a merge sort on the specified array,
+ * allowing you to sort elements of any type using a user-provided comparison
+ * function. This is useful for sorting sub-command tables, argument arrays, or
+ * any other data structures used within Argtable3 or your application.
+ *
+ * The function is flexible and can sort arrays of arbitrary element size. The
+ * comparison function should return an integer less than, equal to, or greater
+ * than zero if the first argument is considered to be respectively less than,
+ * equal to, or greater than the second.
+ *
+ * Example usage:
+ * ```
+ * // Sort an array of sub-command info structures by name
+ * arg_mgsort(cmd_array, cmd_count, sizeof(arg_cmd_info_t), 0, cmd_count - 1, compare_cmd_info);
+ * ```
+ *
+ * @param data      Pointer to the array to be sorted.
+ * @param size      Number of elements in the array.
+ * @param esize     Size of each element in bytes.
+ * @param i         Starting index of the range to sort (typically 0).
+ * @param k         Ending index of the range to sort (typically size - 1).
+ * @param comparefn Pointer to a comparison function that takes two `const
+ *                  void*` arguments and returns an int (like `strcmp` or
+ *                  `memcmp`).
+ *
+ * @see arg_cmd_info_t, arg_cmd_itr_t
+ */
+ARG_EXTERN void arg_mgsort(void* data, int size, int esize, int i, int k, arg_comparefn* comparefn);
+
+/**
+ * Generates and retrieves the default help message for the application.
+ *
+ * The `arg_make_get_help_msg` function constructs a standard help message
+ * describing the usage, options, and arguments for the main application or
+ * module. The generated help text is written to a dynamic string buffer, which
+ * can be displayed to the user, printed to the console, or included in
+ * documentation.
+ *
+ * This function is typically used to provide users with a quick reference to
+ * the application's command-line interface, especially when no specific command
+ * or argument table is provided. It is useful for displaying help output in
+ * response to `--help` or similar flags.
+ *
+ * The help message typically includes the application name and its usage
+ * syntax, a glossary of available options and arguments with descriptions, and
+ * any additional remarks or formatting defined in the argument table.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_make_get_help_msg(ds);
+ * printf("%s", arg_dstr_cstr(ds));
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param res Dynamic string handle to store the generated help message.
+ *
+ * @see arg_make_help_msg, arg_dstr_create, arg_dstr_cstr
+ */
+ARG_EXTERN void arg_make_get_help_msg(arg_dstr_t res);
+
+/**
+ * Generates a formatted help message for the command-line interface.
+ *
+ * The `arg_make_help_msg` function constructs a comprehensive help message
+ * describing the usage, options, and arguments for a command-line application
+ * or sub-command. The generated help text is written to a dynamic string
+ * buffer, which can be displayed to the user, printed to the console, or
+ * included in documentation.
+ *
+ * The help message typically includes the command or sub-command name and its
+ * usage syntax, a glossary of available options and arguments with descriptions,
+ * and any additional formatting or custom remarks defined in the argument table.
+ *
+ * This function is useful for providing users with clear guidance on how to
+ * invoke the application and what options are available. It is commonly called
+ * when the user requests help (e.g., with `-h` or `--help`).
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * arg_make_help_msg(ds, "myapp", argtable);
+ * printf("%s", arg_dstr_cstr(ds));
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds        Dynamic string to store the generated help message.
+ * @param cmd_name  Name of the command or sub-command to display in the usage
+ *                  line.
+ * @param argtable  Array of argument table structs describing the available
+ *                  options and arguments.
+ *
+ * @see arg_dstr_create, arg_dstr_cstr, arg_rem, arg_print_glossary
+ */
+ARG_EXTERN void arg_make_help_msg(arg_dstr_t ds, const char* cmd_name, void** argtable);
+
+/**
+ * Generates a concise syntax error message for command-line parsing errors.
+ *
+ * The `arg_make_syntax_err_msg` function constructs a brief error message
+ * summarizing the syntax errors detected during argument parsing. The message
+ * is written to a dynamic string buffer, which can then be displayed to the
+ * user or logged for diagnostics. This function is useful for applications that
+ * want to provide immediate feedback about what went wrong, without including
+ * full usage or help information.
+ *
+ * The generated message typically includes a summary of the errors encountered
+ * and the relevant arguments or options that caused the error.
+ *
+ * For a more comprehensive help message that includes usage and glossary
+ * information, use `arg_make_syntax_err_help_msg`.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors > 0) {
+ *     arg_make_syntax_err_msg(ds, argtable, end);
+ *     fprintf(stderr, "%s", arg_dstr_cstr(ds));
+ * }
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds       Pointer to a dynamic string object to store the generated
+ *                 message.
+ * @param argtable An array of argument table structs describing the expected
+ *                 arguments.
+ * @param end      Pointer to the `arg_end` structure containing error details.
+ *
+ * @see arg_make_syntax_err_help_msg, arg_parse, arg_print_errors,
+ *      arg_dstr_create, arg_dstr_cstr
+ */
+ARG_EXTERN void arg_make_syntax_err_msg(arg_dstr_t ds, void** argtable, arg_end_t* end);
+
+/**
+ * Generates a detailed syntax error help message for command-line parsing errors.
+ *
+ * The `arg_make_syntax_err_help_msg` function constructs a comprehensive help
+ * message when syntax errors are detected during argument parsing. It combines
+ * error details, usage information, and optional help text into a dynamic string
+ * buffer, which can then be displayed to the user or logged for diagnostics.
+ *
+ * This function is typically used in applications that want to provide users
+ * with clear feedback about what went wrong, what the correct syntax is, and
+ * how to get further help. It is especially useful for CLI tools that need to
+ * guide users through complex argument requirements.
+ *
+ * The generated message may include the command name and a summary of the
+ * errors, the correct usage syntax for the command, a glossary of available
+ * options and arguments, and additional help text if the help flag is set.
+ *
+ * Example usage:
+ * ```
+ * arg_dstr_t ds = arg_dstr_create();
+ * int exitcode = 0;
+ * int nerrors = arg_parse(argc, argv, argtable);
+ * if (nerrors > 0) {
+ *     arg_make_syntax_err_help_msg(ds, argv[0], 0, nerrors, argtable, end,
+ *                                  &exitcode);
+ *     fprintf(stderr, "%s", arg_dstr_cstr(ds));
+ * }
+ * arg_dstr_destroy(ds);
+ * ```
+ *
+ * @param ds       Pointer to a dynamic string object to store the generated
+ *                 message.
+ * @param name     The name of the command or application.
+ * @param help     Nonzero if the help flag was specified; zero otherwise.
+ * @param nerrors  The number of syntax errors detected during parsing.
+ * @param argtable An array of argument table structs describing the expected
+ *                 arguments.
+ * @param end      Pointer to the `arg_end` structure containing error details.
+ * @param exitcode Pointer to an integer where the recommended exit code will be
+ *                 stored.
+ *
+ * @return Returns 0 on success, or a nonzero error code on failure.
+ *
+ * @see arg_parse, arg_print_errors, arg_dstr_create, arg_dstr_cstr
+ */
+ARG_EXTERN int arg_make_syntax_err_help_msg(arg_dstr_t ds, const char* name, int help, int nerrors, void** argtable, arg_end_t* end, int* exitcode);
+
+/**
+ * Sets the module (application) name.
+ *
+ * The `arg_set_module_name` function allows you to specify the name of your
+ * application or module. This name can be displayed in help messages, version
+ * output, and error messages generated by Argtable3. It is typically called at
+ * program startup, before parsing command-line arguments, to ensure that the
+ * module name is available for reporting to the user.
+ *
+ * Setting a meaningful module name helps users identify the application in
+ * command-line output and documentation, especially when distributing binaries
+ * or providing support.
+ *
+ * Example usage:
+ * ```
+ * arg_set_module_name("myapp");
+ * ```
+ *
+ * @param name The module or application name as a null-terminated string. Pass
+ *             a descriptive name that will be shown in help and version output.
+ */
+ARG_EXTERN void arg_set_module_name(const char* name);
+
+/**
+ * Sets the module (application) version information.
+ *
+ * The `arg_set_module_version` function allows you to specify the version
+ * information for your application or module, which can be displayed in help or
+ * version output. This function is typically called at program startup, before
+ * parsing command-line arguments, to ensure that version information is
+ * available for reporting to the user.
+ *
+ * The version is specified using three integer components (major, minor, patch)
+ * and an optional string tag (such as a commit hash or build identifier). This
+ * enables you to provide detailed versioning information, which is useful for
+ * debugging, support, and user reference.
+ *
+ * Example usage:
+ * ```
+ * arg_set_module_version(3, 1, 5, "githash-abc123");
+ * ```
+ *
+ * @param[in] major The major version number (e.g., 3 in version 3.1.5).
+ * @param[in] minor The minor version number (e.g., 1 in version 3.1.5).
+ * @param[in] patch The patch version number (e.g., 5 in version 3.1.5).
+ * @param[in] tag   An optional string identifying a version control commit,
+ *                  build tag, or other metadata. Pass `NULL` if not needed.
+ */
+ARG_EXTERN void arg_set_module_version(int major, int minor, int patch, const char* tag);
+
+/**** deprecated functions, for back-compatibility only ********/
+
+/**
+ * Deallocates or frees non-null entries of the argument table.
+ *
+ * The `arg_free` function is deprecated in favour of the `arg_freetable`
+ * function due to a flaw in its design. The flaw results in memory leak in the
+ * (very rare) case that an intermediate entry in the argtable array failed its
+ * memory allocation while others following that entry were still allocated ok.
+ * Those subsequent allocations will not be deallocated by `arg_free`.
+ *
+ * Despite the unlikeliness of the problem occurring, and the even unlikelier
+ * event that it has any deliterious effect, it is fixed regardless by replacing
+ * `arg_free` with the newer `arg_freetable` function. We still keep `arg_free`
+ * for backwards compatibility.
+ *
+ * @param argtable An array of argument table structs.
+ * @deprecated Use `arg_freetable` instead.
+ */
+ARG_EXTERN void arg_free(void** argtable);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2016-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "cmdlist.h"
+
+#include "app.h"
+#include "argtable3.h"
+
+#include <stdlib.h>
+
+const char* cmdlist_name() {
+    static char name[] = "list";
+    return name;
+}
+
+const char* cmdlist_description() {
+    static char description[] = "list all command-line options";
+    return description;
+}
+
+enum { LIST_CMD, LIST_INTOPT, LIST_STROPT, LIST_DBLOPT, LIST_BOOLOPT, LIST_FILEOPT, LIST_HELP, LIST_END, LIST_NARGS };
+
+void** cmdlist_table(void* ctx) {
+    void** argtable = malloc(LIST_NARGS * sizeof(void*));
+
+    (void)ctx;
+    if (argtable == NULL) {
+        return NULL;
+    }
+
+    argtable[LIST_CMD] = arg_str1(NULL, NULL, cmdlist_name(), NULL);
+    argtable[LIST_INTOPT] = arg_int0("i", "intopt", "<n>", "an integer option");
+    argtable[LIST_STROPT] = arg_str0("s", "stropt", "<s>", "a string option");
+    argtable[LIST_DBLOPT] = arg_dbl0("d", "dblopt", "<f>", "a double option");
+    argtable[LIST_BOOLOPT] = arg_lit0("b", "boolopt", "a boolean option");
+    argtable[LIST_FILEOPT] = arg_file0("f", "fileopt", "<file>", "a file option");
+    argtable[LIST_HELP] = arg_lit0("h", "help", "output usage information");
+    argtable[LIST_END] = arg_end(20);
+    return argtable;
+}
+
+int cmdlist_proc(int argc, char* argv[], void** argtable, int nerrors, arg_dstr_t res, void* ctx) {
+    arg_int_t* intopt = argtable[LIST_INTOPT];
+    arg_str_t* stropt = argtable[LIST_STROPT];
+    arg_dbl_t* dblopt = argtable[LIST_DBLOPT];
+    arg_lit_t* boolopt = argtable[LIST_BOOLOPT];
+    arg_file_t* fileopt = argtable[LIST_FILEOPT];
+    arg_lit_t* help = argtable[LIST_HELP];
+    arg_end_t* end = argtable[LIST_END];
+
+    (void)argc;
+    (void)argv;
+    (void)ctx;
+
+    /*
+     * The registry builds the argtable once and reuses it for every dispatch,
+     * so default values are applied here rather than stored in the table.
+     */
+    int exitcode = APP_OK;
+    if (arg_make_syntax_err_help_msg(res, cmdlist_name(), help->count, nerrors, argtable, end, &exitcode)) {
+        return exitcode;
+    }
+
+    /****************************************************************************/
+    /* process the command                                                      */
+    /****************************************************************************/
+
+    arg_dstr_catf(res, "intopt = %d\n", intopt->count > 0 ? intopt->ival[0] : 42);
+    arg_dstr_catf(res, "stropt = %s\n", stropt->count > 0 ? stropt->sval[0] : "default");
+    arg_dstr_catf(res, "dblopt = %.2f\n", dblopt->count > 0 ? dblopt->dval[0] : 3.14);
+    arg_dstr_catf(res, "boolopt = %s\n", boolopt->count > 0 ? "true" : "false");
+    arg_dstr_catf(res, "fileopt = %s\n", fileopt->count > 0 ? fileopt->filename[0] : "no file");
+
+    return exitcode;
+}
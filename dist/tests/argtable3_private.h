@@ -0,0 +1,608 @@
+/*******************************************************************************
+ * argtable3_private: Declares private types, constants, and interfaces
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2019 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#ifndef ARG_UTILS_H
+#define ARG_UTILS_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef ARG_ENABLE_TRACE
+#define ARG_ENABLE_TRACE 0
+#endif /* ARG_ENABLE_TRACE */
+
+#ifndef ARG_ENABLE_LOG
+#define ARG_ENABLE_LOG 1
+#endif /* ARG_ENABLE_LOG */
+
+/* Use the embedded getopt as the system getopt(3) */
+#ifndef ARG_REPLACE_GETOPT
+#define ARG_REPLACE_GETOPT 1
+#endif /* ARG_REPLACE_GETOPT */
+
+/* Size of the buffer pre-allocated for dynamic strings.
+ * If the length exceeds this size, the buffer will be dynamically allocated.
+ */
+#ifndef ARG_DSTR_SIZE
+#define ARG_DSTR_SIZE 200
+#endif /* ARG_DSTR_SIZE */
+
+/* Run worker pool tasks on background threads.
+ * If disabled, tasks are executed on the thread that waits for them.
+ */
+#ifndef ARG_ENABLE_THREADS
+#define ARG_ENABLE_THREADS 0
+#endif /* ARG_ENABLE_THREADS */
+
+/* storage class of state that each thread keeps its own copy of */
+#if !ARG_ENABLE_THREADS
+#define ARG_TLS
+#elif defined(_MSC_VER)
+#define ARG_TLS __declspec(thread)
+#else
+#define ARG_TLS __thread
+#endif
+
+/* Use memory-mapped I/O to read script, response and configuration files,
+ * and the contents of file arguments.
+ * If disabled, or if a file cannot be mapped, the file is read into the heap.
+ */
+#ifndef ARG_ENABLE_MMAP
+#if defined(_WIN32) || defined(__unix__) || defined(__APPLE__)
+#define ARG_ENABLE_MMAP 1
+#else
+#define ARG_ENABLE_MMAP 0
+#endif
+#endif /* ARG_ENABLE_MMAP */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+    ARG_ERR_MINCOUNT = 1,
+    ARG_ERR_MAXCOUNT,
+    ARG_ERR_BADINT,
+    ARG_ERR_OVERFLOW,
+    ARG_ERR_BADDOUBLE,
+    ARG_ERR_BADDATE,
+    ARG_ERR_REGNOMATCH,
+    ARG_ERR_BADENUM,
+    ARG_ERR_FILESTAT,
+    ARG_ERR_FILETYPE,
+    ARG_ERR_FILEACCESS,
+    ARG_ERR_GLOBNOMATCH,
+    ARG_ERR_GLOBLIMIT
+};
+
+typedef void(arg_panicfn)(const char* fmt, ...);
+
+#if defined(_MSC_VER)
+#define ARG_TRACE(x)                                               \
+    __pragma(warning(push)) __pragma(warning(disable : 4127)) do { \
+        if (ARG_ENABLE_TRACE)                                      \
+            dbg_printf x;                                          \
+    }                                                              \
+    while (0)                                                      \
+    __pragma(warning(pop))
+
+#define ARG_LOG(x)                                                 \
+    __pragma(warning(push)) __pragma(warning(disable : 4127)) do { \
+        if (ARG_ENABLE_LOG)                                        \
+            dbg_printf x;                                          \
+    }                                                              \
+    while (0)                                                      \
+    __pragma(warning(pop))
+#else
+#define ARG_TRACE(x)          \
+    do {                      \
+        if (ARG_ENABLE_TRACE) \
+            dbg_printf x;     \
+    } while (0)
+
+#define ARG_LOG(x)          \
+    do {                    \
+        if (ARG_ENABLE_LOG) \
+            dbg_printf x;   \
+    } while (0)
+#endif
+
+/*
+ * Rename a few generic names to unique names.
+ * They can be a problem for the platforms like NuttX, where
+ * the namespace is flat for everything including apps and libraries.
+ */
+#define	xmalloc argtable3_xmalloc
+#define	xcalloc argtable3_xcalloc
+#define	xrealloc argtable3_xrealloc
+#define	xfree argtable3_xfree
+
+extern void dbg_printf(const char* fmt, ...);
+extern void arg_set_panic(arg_panicfn* proc);
+extern void* xmalloc(size_t size);
+extern void* xcalloc(size_t count, size_t size);
+extern void* xrealloc(void* ptr, size_t size);
+extern void xfree(void* ptr);
+
+/*
+ * A private, writable view of a file's contents. The byte at data[len] is
+ * always a writable '\0', so the contents can be tokenized in place.
+ */
+typedef struct arg_mmap {
+    char* data;
+    size_t len;
+    int mapped; /* non-zero if data is a memory mapping rather than a heap buffer */
+} arg_mmap_t;
+
+/**
+ * @brief Map a file into memory, falling back to reading it into the heap.
+ *
+ * @param   map   the view to initialize
+ * @param   path  the file to map
+ * @return        zero on success, non-zero if the file could not be read
+ */
+int arg_mmap_open(arg_mmap_t* map, const char* path);
+
+/**
+ * @brief Read a stream, such as stdin, to its end into a heap buffer.
+ *
+ * @param   map   the view to initialize
+ * @param   fp    the stream to read
+ * @return        zero on success, non-zero on a read error
+ */
+int arg_mmap_read(arg_mmap_t* map, FILE* fp);
+
+/**
+ * @brief Initialize a view with a heap copy of the given buffer.
+ */
+void arg_mmap_copy(arg_mmap_t* map, const char* buf, size_t len);
+
+/**
+ * @brief Release the memory behind a view. Safe to call on a zeroed view.
+ */
+void arg_mmap_close(arg_mmap_t* map);
+
+/*
+ * In-place scanner for shell-like words. Words are separated by unquoted
+ * white space; single quotes preserve everything literally, double quotes
+ * honour backslash escapes for '"', '\\' and newlines, and an unquoted
+ * backslash escapes any character (a backslash-newline joins two lines).
+ * Unquoted text is compacted over the quote and escape characters and each
+ * word is null-terminated inside the buffer, so no memory is allocated.
+ * An unterminated quote extends to the end of the input.
+ */
+typedef struct arg_scanner {
+    char* p;      /* current read position */
+    char* end;    /* end of the buffer, *end must be writable */
+    int line;     /* line on which the last word started, 1-based */
+    int newline;  /* non-zero if an unescaped line break precedes the last word */
+    int comments; /* if non-zero, '#' at the start of a word comments out the rest of the line */
+    int pending;  /* line breaks inside or right after the last word, not yet counted */
+    int eol;      /* non-zero if the last word was delimited by a line break */
+    int quoted;   /* non-zero if the first character of the last word was quoted or escaped */
+} arg_scanner_t;
+
+void arg_scanner_init(arg_scanner_t* s, char* buf, size_t len, int comments);
+
+/**
+ * @brief Scan the next word.
+ *
+ * @param   s     the scanner
+ * @param   word  receives the null-terminated word
+ * @return        non-zero if a word was found, zero at the end of the input
+ */
+int arg_scan_word(arg_scanner_t* s, char** word);
+
+/**
+ * @brief Return a monotonic timestamp in seconds, for measuring intervals.
+ */
+double arg_clock(void);
+
+/**
+ * @brief Scan the magnitude and sign of an integer argument value.
+ *
+ * Accepts the `arg_int` grammar: an optional sign, an optional `0x`, `0o` or
+ * `0b` radix prefix, the digits and an optional `KB`, `MB` or `GB` suffix
+ * (also `TB` if `tb` is non-zero), surrounded by optional white space.
+ *
+ * @param   str   the null-terminated value to scan
+ * @param   tb    non-zero to accept the `TB` suffix
+ * @param   mag   receives the magnitude, including the suffix multiplier
+ * @param   neg   receives non-zero if the value is negative
+ * @return        0 on success, ARG_ERR_BADINT if `str` is malformed, or
+ *                ARG_ERR_OVERFLOW if the magnitude does not fit in 64 bits
+ */
+int arg_int_scanmag(const char* str, int tb, uint64_t* mag, int* neg);
+
+/**
+ * @brief Convert decimal text to the nearest double, ignoring the locale.
+ *
+ * Accepts the same text as strtod(), but always uses '.' as the decimal
+ * point. Decimal input is converted without calling the C library in all
+ * but rare cases.
+ *
+ * @param   str     the null-terminated text to convert
+ * @param   endptr  if not NULL, receives a pointer past the converted text,
+ *                  or `str` if no conversion could be performed
+ * @return          the converted value
+ */
+double arg_strtod(const char* str, char** endptr);
+
+struct arg_hashtable_entry {
+    void *k, *v;
+    unsigned int h;
+    struct arg_hashtable_entry* next;
+};
+
+typedef struct arg_hashtable {
+    unsigned int tablelength;
+    struct arg_hashtable_entry** table;
+    unsigned int entrycount;
+    unsigned int loadlimit;
+    unsigned int primeindex;
+    unsigned int (*hashfn)(const void* k);
+    int (*eqfn)(const void* k1, const void* k2);
+    int freekeys; /* keys are freed with their entries (default) */
+} arg_hashtable_t;
+
+/**
+ * @brief Create a hash table.
+ *
+ * @param   minsize   minimum initial size of hash table
+ * @param   hashfn    function for hashing keys
+ * @param   eqfn      function for determining key equality
+ * @return            newly created hash table or NULL on failure
+ */
+arg_hashtable_t* arg_hashtable_create(unsigned int minsize, unsigned int (*hashfn)(const void*), int (*eqfn)(const void*, const void*));
+
+/**
+ * @brief This function will cause the table to expand if the insertion would take
+ * the ratio of entries to table size over the maximum load factor.
+ *
+ * This function does not check for repeated insertions with a duplicate key.
+ * The value returned when using a duplicate key is undefined -- when
+ * the hash table changes size, the order of retrieval of duplicate key
+ * entries is reversed.
+ * If in doubt, remove before insert.
+ *
+ * @param   h   the hash table to insert into
+ * @param   k   the key - hash table claims ownership and will free on removal
+ * @param   v   the value - does not claim ownership
+ * @return      non-zero for successful insertion
+ */
+void arg_hashtable_insert(arg_hashtable_t* h, void* k, void* v);
+
+#define ARG_DEFINE_HASHTABLE_INSERT(fnname, keytype, valuetype) \
+    int fnname(arg_hashtable_t* h, keytype* k, valuetype* v) { return arg_hashtable_insert(h, k, v); }
+
+/**
+ * @brief Search the specified key in the hash table.
+ *
+ * @param   h   the hash table to search
+ * @param   k   the key to search for  - does not claim ownership
+ * @return      the value associated with the key, or NULL if none found
+ */
+void* arg_hashtable_search(arg_hashtable_t* h, const void* k);
+
+#define ARG_DEFINE_HASHTABLE_SEARCH(fnname, keytype, valuetype) \
+    valuetype* fnname(arg_hashtable_t* h, keytype* k) { return (valuetype*)(arg_hashtable_search(h, k)); }
+
+/**
+ * @brief Remove the specified key from the hash table.
+ *
+ * @param   h   the hash table to remove the item from
+ * @param   k   the key to search for  - does not claim ownership
+ */
+void arg_hashtable_remove(arg_hashtable_t* h, const void* k);
+
+#define ARG_DEFINE_HASHTABLE_REMOVE(fnname, keytype, valuetype) \
+    void fnname(arg_hashtable_t* h, keytype* k) { arg_hashtable_remove(h, k); }
+
+/**
+ * @brief Return the number of keys in the hash table.
+ *
+ * @param   h   the hash table
+ * @return      the number of items stored in the hash table
+ */
+unsigned int arg_hashtable_count(arg_hashtable_t* h);
+
+/**
+ * @brief Change the value associated with the key.
+ *
+ * function to change the value associated with a key, where there already
+ * exists a value bound to the key in the hash table.
+ * Source due to Holger Schemel.
+ *
+ * @name        hashtable_change
+ * @param   h   the hash table
+ * @param       key
+ * @param       value
+ */
+int arg_hashtable_change(arg_hashtable_t* h, void* k, void* v);
+
+/**
+ * @brief Free the hash table and the memory allocated for each key-value pair.
+ *
+ * @param   h            the hash table
+ * @param   free_values  whether to call 'free' on the remaining values
+ */
+void arg_hashtable_destroy(arg_hashtable_t* h, int free_values);
+
+typedef struct arg_hashtable_itr {
+    arg_hashtable_t* h;
+    struct arg_hashtable_entry* e;
+    struct arg_hashtable_entry* parent;
+    unsigned int index;
+} arg_hashtable_itr_t;
+
+arg_hashtable_itr_t* arg_hashtable_itr_create(arg_hashtable_t* h);
+
+void arg_hashtable_itr_destroy(arg_hashtable_itr_t* itr);
+
+/**
+ * @brief Return the value of the (key,value) pair at the current position.
+ */
+extern void* arg_hashtable_itr_key(arg_hashtable_itr_t* i);
+
+/**
+ * @brief Return the value of the (key,value) pair at the current position.
+ */
+extern void* arg_hashtable_itr_value(arg_hashtable_itr_t* i);
+
+/**
+ * @brief Advance the iterator to the next element. Returns zero if advanced to end of table.
+ */
+int arg_hashtable_itr_advance(arg_hashtable_itr_t* itr);
+
+/**
+ * @brief Remove current element and advance the iterator to the next element.
+ */
+int arg_hashtable_itr_remove(arg_hashtable_itr_t* itr);
+
+/**
+ * @brief Search and overwrite the supplied iterator, to point to the entry matching the supplied key.
+ *
+ * @return  Zero if not found.
+ */
+int arg_hashtable_itr_search(arg_hashtable_itr_t* itr, arg_hashtable_t* h, void* k);
+
+#define ARG_DEFINE_HASHTABLE_ITERATOR_SEARCH(fnname, keytype) \
+    int fnname(arg_hashtable_itr_t* i, arg_hashtable_t* h, keytype* k) { return (arg_hashtable_iterator_search(i, h, k)); }
+
+typedef void(arg_taskfn)(void* arg);
+
+enum { ARG_TASK_QUEUED = 1, ARG_TASK_RUNNING, ARG_TASK_DONE };
+
+/*
+ * A unit of work for the worker pool. The storage is owned by the caller and
+ * must stay valid until arg_tpool_join() returns for the task.
+ */
+typedef struct arg_task {
+    arg_taskfn* fn;
+    void* arg;
+    int state;
+    struct arg_task* next;
+} arg_task_t;
+
+typedef struct arg_tpool arg_tpool_t;
+
+/**
+ * @brief Create a worker pool.
+ *
+ * @param   nthreads  number of worker threads, 0 runs every task on the
+ *                    thread that joins it
+ * @return            newly created worker pool
+ */
+arg_tpool_t* arg_tpool_create(int nthreads);
+
+/**
+ * @brief Run any tasks still queued, stop the workers and free the pool.
+ */
+void arg_tpool_destroy(arg_tpool_t* pool);
+
+/**
+ * @brief Return the number of worker threads actually running in the pool.
+ */
+int arg_tpool_size(arg_tpool_t* pool);
+
+/**
+ * @brief Queue a task for execution.
+ *
+ * @param   pool  the worker pool
+ * @param   task  caller-owned task storage
+ * @param   fn    function to run
+ * @param   arg   argument passed to fn
+ */
+void arg_tpool_submit(arg_tpool_t* pool, arg_task_t* task, arg_taskfn* fn, void* arg);
+
+/**
+ * @brief Return non-zero if the task has finished.
+ */
+int arg_tpool_done(arg_tpool_t* pool, arg_task_t* task);
+
+/**
+ * @brief Wait until the task has finished.
+ *
+ * A task that has not been picked up by a worker yet is removed from the
+ * queue and executed on the calling thread.
+ */
+void arg_tpool_join(arg_tpool_t* pool, arg_task_t* task);
+
+/**
+ * @brief Return the number of online processors, or 1 if unknown.
+ */
+int arg_thread_ncpu(void);
+
+/**
+ * @brief Expand a glob pattern into the paths that match it.
+ *
+ * Supports '*', '?' and bracket expressions within a path component, and
+ * "**" as a whole component for any number of directories. Hidden entries
+ * only match a component that starts with a '.'. Directories of one level of
+ * the walk are read in parallel on a worker pool.
+ *
+ * @param   pattern   the pattern to expand
+ * @param   limit     the largest number of matches accepted
+ * @param   nworkers  worker threads, negative for one per processor
+ * @param   paths     receives the matches in strcmp() order, as one block
+ *                    to be released with xfree()
+ * @return            the number of matches, 0 if nothing matches, or -1 if
+ *                    there are more than limit matches, or more than limit
+ *                    paths at any level of the walk
+ */
+int arg_glob(const char* pattern, int limit, int nworkers, char*** paths);
+
+struct arg_end;
+struct arg_hdr;
+
+/**
+ * @brief Record an error in the arg_end of a table.
+ *
+ * If the arg_end is full, its last error is replaced by ARG_ELIMIT.
+ */
+void arg_register_error(struct arg_end* end, void* parent, int error, const char* argval);
+
+/**
+ * @brief Expand the response files of a command line, if the table allows it.
+ *
+ * Each argument after argv[0] of the form "@path" is replaced by the words
+ * of the file, tokenized in place in its mapping. Files that cannot be read
+ * or that refer to themselves are reported as errors in end.
+ *
+ * @param   end       the arg_end of the table
+ * @param   argc      number of arguments in argv
+ * @param   argv      the command line
+ * @param   expanded  receives the expanded command line, or argv if nothing
+ *                    was expanded; it stays valid until the next parse
+ * @return            the number of arguments in the expanded command line
+ */
+int arg_end_expand(struct arg_end* end, int argc, char** argv, char*** expanded);
+
+/* The optional functions of an argument, or NULL if it provides none */
+#define ARG_HDR_EXT(hdr) (((hdr)->flag & ARG_HASEXT) ? (const struct arg_hdr_ext*)(hdr)->priv : NULL)
+
+/**
+ * @brief Copy the memory block of an argument struct for its clonefn.
+ *
+ * The copy's hdr.parent points to the copy. Pointers into the block must be
+ * moved to the copy with ARG_CLONE_PTR().
+ *
+ * @param   parent  the argument struct
+ * @param   nbytes  the size of the block allocated by the constructor
+ * @return          the copy
+ */
+void* arg_clone_block(const void* parent, size_t nbytes);
+
+#define ARG_CLONE_PTR(clone, parent, ptr) ((void*)((char*)(clone) + ((const char*)(ptr) - (const char*)(parent))))
+
+/**
+ * @brief Move the environment binding of an argument to its copy.
+ *
+ * The clonefn of arg_end copies the bindings of the original arguments, which
+ * the copy of the table must then point to its own arguments.
+ */
+void arg_end_rebind(struct arg_end* end, void* from, void* to);
+
+/* A set of table entries, one bit per entry */
+typedef unsigned int arg_bits_t;
+
+#define ARG_BITS_WIDTH (sizeof(arg_bits_t) * 8)
+#define ARG_BITS_LEN(n) (((size_t)(n) + ARG_BITS_WIDTH - 1) / ARG_BITS_WIDTH)
+#define ARG_BITS_SET(bits, i) ((bits)[(size_t)(i) / ARG_BITS_WIDTH] |= 1u << ((size_t)(i) % ARG_BITS_WIDTH))
+#define ARG_BITS_CLEAR(bits, i) ((bits)[(size_t)(i) / ARG_BITS_WIDTH] &= ~(1u << ((size_t)(i) % ARG_BITS_WIDTH)))
+#define ARG_BITS_TEST(bits, i) (((bits)[(size_t)(i) / ARG_BITS_WIDTH] >> ((size_t)(i) % ARG_BITS_WIDTH)) & 1u)
+
+/**
+ * @brief Return non-zero if response files are expanded.
+ */
+int arg_end_hasrespfile(struct arg_end* end);
+
+/**
+ * @brief Return non-zero if options of the table can also be read from the
+ * environment or from configuration files.
+ */
+int arg_end_haslayers(struct arg_end* end);
+
+/**
+ * @brief Scan the options the command line left out from the other layers.
+ *
+ * The environment is indexed once, and the value of each bound option is
+ * passed to its scanfn. The configuration files are then read from the last
+ * one added to the first, each one only setting the options that no layer
+ * of higher precedence has set. Errors are recorded in end, with the file
+ * and line of errors from configuration files.
+ *
+ * @param   end    the arg_end of the table
+ * @param   table  the argument table
+ * @param   given  the table entries the command line gave, updated with the
+ *                 entries set by each layer
+ */
+void arg_end_scanlayers(struct arg_end* end, struct arg_hdr** table, arg_bits_t* given);
+
+/**
+ * @brief Return non-zero if constraints between options were registered.
+ */
+int arg_end_hasconstraints(struct arg_end* end);
+
+/**
+ * @brief Check the constraints registered with arg_end_constrain().
+ *
+ * Each constraint is evaluated by testing the bits of its options, so the
+ * cost is linear in the total size of the constraints. Violations are
+ * registered in end, with the names of the options as their argval.
+ *
+ * @param   end      the arg_end of the table
+ * @param   table    the argument table
+ * @param   present  the table entries that were given
+ */
+void arg_end_checkconstraints(struct arg_end* end, struct arg_hdr** table, const arg_bits_t* present);
+
+/**
+ * @brief Register an error from a checkfn that reports more than one error.
+ *
+ * Only valid while arg_parse() runs the post-parse checks. The error is added
+ * to the arg_end of the table being checked, with argval as its argument.
+ */
+void arg_check_error(void* parent, int error, const char* argval);
+
+/**
+ * @brief Serialize access to process-wide state such as the getopt variables.
+ */
+void arg_global_lock(void);
+void arg_global_unlock(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
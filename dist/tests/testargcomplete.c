@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "CuTest.h"
+#include "argtable3.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4204)
+#endif
+
+static int complete_cmd_proc(int argc, char* argv[], arg_dstr_t res, void* ctx) {
+    (void)argc;
+    (void)argv;
+    (void)res;
+    (void)ctx;
+    return 0;
+}
+
+void test_argcomplete_bash_001(CuTest* tc) {
+    struct arg_lit* verbose = arg_litn("v", "verbose", 0, 3, "more output");
+    struct arg_file* output = arg_file0("o", "output", "<file>", "output file");
+    struct arg_int* level = arg_int0("l", "level,lvl", "<n>", "level");
+    struct arg_str* color = arg_str0(NULL, "color", "<when>", "colorize");
+    struct arg_file* infiles = arg_filen(NULL, NULL, "<file>", 0, 10, "input files");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {verbose, output, level, color, infiles, end};
+    arg_dstr_t ds = arg_dstr_create();
+    const char* s;
+
+    color->hdr.flag |= ARG_HASOPTVALUE;
+    arg_print_completion_ds(ds, argtable, "my-tool", ARG_SHELL_BASH);
+    s = arg_dstr_cstr(ds);
+
+    CuAssertTrue(tc, strstr(s, "_my_tool()\n{\n") != NULL);
+    CuAssertTrue(tc, strstr(s, "complete -F _my_tool 'my-tool'\n") != NULL);
+    CuAssertTrue(tc, strstr(s, "compgen -W ' -v --verbose -o --output -l --level --lvl --color'") != NULL);
+    CuAssertTrue(tc, strstr(s, "        -o|--output)\n            local IFS=$'\\n'\n") != NULL);
+    CuAssertTrue(tc, strstr(s, "        -l|--level|--lvl)\n            return 0\n") != NULL);
+    CuAssertTrue(tc, strstr(s, "        --color)\n            if [ -n \"$eq\" ]; then\n") != NULL);
+    CuAssertTrue(tc, strstr(s, "-v|--verbose)") == NULL);
+    CuAssertTrue(tc, strstr(s, "}\n\ncomplete") != NULL);
+
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argcomplete_bash_002(CuTest* tc) {
+    struct arg_lit* help = arg_lit0("h", "help", "print help");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {help, end};
+    arg_dstr_t ds = arg_dstr_create();
+    const char* s;
+
+    arg_cmd_init();
+    arg_cmd_register("remove", complete_cmd_proc, "remove a thing", NULL);
+    arg_cmd_register("add", complete_cmd_proc, "add a thing", NULL);
+    arg_print_completion_ds(ds, argtable, "tool", ARG_SHELL_BASH);
+    s = arg_dstr_cstr(ds);
+
+    /* sub-commands are sorted by name */
+    CuAssertTrue(tc, strstr(s, "            add|remove)\n") != NULL);
+    CuAssertTrue(tc, strstr(s, "compgen -W ' add remove'") != NULL);
+    CuAssertTrue(tc, strstr(s, "compgen -f") != NULL);
+
+    arg_cmd_uninit();
+    arg_dstr_reset(ds);
+
+    /* no positional files and no sub-commands: only options complete */
+    arg_print_completion_ds(ds, argtable, "tool", ARG_SHELL_BASH);
+    s = arg_dstr_cstr(ds);
+    CuAssertTrue(tc, strstr(s, "compgen -f") == NULL);
+    CuAssertTrue(tc, strstr(s, "compgen -W ' -h --help'") != NULL);
+
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argcomplete_zsh_001(CuTest* tc) {
+    struct arg_lit* verbose = arg_litn("v", "verbose", 0, 3, "more [very] output");
+    struct arg_file* output = arg_file0("o", "output", "<file>", "it's the output");
+    struct arg_int* level = arg_int0(NULL, "level", "<n>", NULL);
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {verbose, output, level, end};
+    arg_dstr_t ds = arg_dstr_create();
+    const char* s;
+
+    arg_cmd_init();
+    arg_cmd_register("sync", complete_cmd_proc, "sync: all of it", NULL);
+    arg_print_completion_ds(ds, argtable, "tool", ARG_SHELL_ZSH);
+    s = arg_dstr_cstr(ds);
+
+    CuAssertTrue(tc, strncmp(s, "#compdef tool\n", 14) == 0);
+    CuAssertTrue(tc, strstr(s, "'*-v[more \\[very\\] output]'") != NULL);
+    CuAssertTrue(tc, strstr(s, "'*--verbose[more \\[very\\] output]'") != NULL);
+    CuAssertTrue(tc, strstr(s, "'-o+[it'\\''s the output]:<file>:_files'") != NULL);
+    CuAssertTrue(tc, strstr(s, "'--output=[it'\\''s the output]:<file>:_files'") != NULL);
+    CuAssertTrue(tc, strstr(s, "'--level=:<n>: '") != NULL);
+    CuAssertTrue(tc, strstr(s, "        'sync:sync: all of it'\n") != NULL);
+    CuAssertTrue(tc, strstr(s, "'1: :_tool_commands'") != NULL);
+    CuAssertTrue(tc, strstr(s, "    compdef _tool 'tool'\n") != NULL);
+
+    arg_cmd_uninit();
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argcomplete_fish_001(CuTest* tc) {
+    struct arg_lit* help = arg_lit0("hH", "help", "print 'help'");
+    struct arg_file* output = arg_file0("o", "output", "<file>", "output file");
+    struct arg_int* level = arg_int0(NULL, "level", "<n>", "level\nof detail");
+    struct arg_rem* rem = arg_rem(NULL, "remark");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {help, output, level, rem, end};
+    arg_dstr_t ds = arg_dstr_create();
+    const char* s;
+
+    arg_print_completion_ds(ds, argtable, "tool", ARG_SHELL_FISH);
+    s = arg_dstr_cstr(ds);
+
+    CuAssertTrue(tc, strstr(s, "complete -c 'tool' -f\n") != NULL);
+    CuAssertTrue(tc, strstr(s, "complete -c 'tool' -s 'h' -s 'H' -l 'help' -d 'print \\'help\\''\n") != NULL);
+    CuAssertTrue(tc, strstr(s, "complete -c 'tool' -s 'o' -l 'output' -r -F -d 'output file'\n") != NULL);
+    CuAssertTrue(tc, strstr(s, "complete -c 'tool' -l 'level' -x -d 'level of detail'\n") != NULL);
+    CuAssertTrue(tc, strstr(s, "remark") == NULL);
+
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argcomplete_fish_002(CuTest* tc) {
+    arg_dstr_t ds = arg_dstr_create();
+    const char* s;
+
+    arg_cmd_init();
+    arg_cmd_register("add", complete_cmd_proc, "add a thing", NULL);
+    arg_print_completion_ds(ds, NULL, "tool", ARG_SHELL_FISH);
+    s = arg_dstr_cstr(ds);
+
+    CuAssertTrue(tc, strstr(s, "complete -c 'tool' -n __fish_use_subcommand -f\n") != NULL);
+    CuAssertTrue(tc, strstr(s, "complete -c 'tool' -n __fish_use_subcommand -a 'add' -d 'add a thing'\n") != NULL);
+
+    arg_cmd_uninit();
+    arg_dstr_destroy(ds);
+}
+
+CuSuite* get_argcomplete_testsuite() {
+    CuSuite* suite = CuSuiteNew();
+    SUITE_ADD_TEST(suite, test_argcomplete_bash_001);
+    SUITE_ADD_TEST(suite, test_argcomplete_bash_002);
+    SUITE_ADD_TEST(suite, test_argcomplete_zsh_001);
+    SUITE_ADD_TEST(suite, test_argcomplete_fish_001);
+    SUITE_ADD_TEST(suite, test_argcomplete_fish_002);
+    return suite;
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
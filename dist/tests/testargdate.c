@@ -0,0 +1,615 @@
+/*******************************************************************************
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2019 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <string.h>
+#include <time.h>
+
+#include "CuTest.h"
+#include "argtable3.h"
+#include "argtable3_private.h"
+
+/*
+    printf("tm_sec   = %d\n", c->tmval->tm_sec);
+    printf("tm_min   = %d\n", c->tmval->tm_min);
+    printf("tm_hour  = %d\n", c->tmval->tm_hour);
+    printf("tm_mday  = %d\n", c->tmval->tm_mday);
+    printf("tm_mon   = %d\n", c->tmval->tm_mon);
+    printf("tm_year  = %d\n", c->tmval->tm_year);
+    printf("tm_wday  = %d\n", c->tmval->tm_wday);
+    printf("tm_yday  = %d\n", c->tmval->tm_yday);
+    printf("tm_isdst = %d\n", c->tmval->tm_isdst);
+
+*/
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4204)
+#endif
+
+void test_argdate_basic_001(CuTest* tc) {
+    struct arg_date* a = arg_date1(NULL, NULL, "%H:%M", NULL, "time 23:59");
+    struct arg_date* b = arg_date0("b", NULL, "%Y-%m-%d", NULL, "date YYYY-MM-DD");
+    struct arg_date* c = arg_daten(NULL, "date", "%D", NULL, 1, 2, "MM/DD/YY");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, c, end};
+    int nerrors;
+
+    char* argv[] = {"program", "23:59", "--date", "12/31/04", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertIntEquals(tc, a->tmval->tm_sec, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_min, 59);
+    CuAssertIntEquals(tc, a->tmval->tm_hour, 23);
+    CuAssertIntEquals(tc, a->tmval->tm_mday, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_mon, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_year, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_wday, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_yday, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_isdst, 0);
+    CuAssertTrue(tc, b->count == 0);
+    CuAssertTrue(tc, c->count == 1);
+    CuAssertIntEquals(tc, c->tmval->tm_sec, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_min, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_hour, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_mday, 31);
+    CuAssertIntEquals(tc, c->tmval->tm_mon, 11);
+    CuAssertIntEquals(tc, c->tmval->tm_year, 104);
+    CuAssertIntEquals(tc, c->tmval->tm_wday, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_yday, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_isdst, 0);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argdate_basic_002(CuTest* tc) {
+    struct arg_date* a = arg_date1(NULL, NULL, "%H:%M", NULL, "time 23:59");
+    struct arg_date* b = arg_date0("b", NULL, "%Y-%m-%d", NULL, "date YYYY-MM-DD");
+    struct arg_date* c = arg_daten(NULL, "date", "%D", NULL, 1, 2, "MM/DD/YY");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, c, end};
+    int nerrors;
+
+    char* argv[] = {"program", "--date", "12/31/04", "20:15", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertIntEquals(tc, a->tmval->tm_sec, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_min, 15);
+    CuAssertIntEquals(tc, a->tmval->tm_hour, 20);
+    CuAssertIntEquals(tc, a->tmval->tm_mday, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_mon, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_year, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_wday, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_yday, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_isdst, 0);
+    CuAssertTrue(tc, b->count == 0);
+    CuAssertTrue(tc, c->count == 1);
+    CuAssertIntEquals(tc, c->tmval->tm_sec, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_min, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_hour, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_mday, 31);
+    CuAssertIntEquals(tc, c->tmval->tm_mon, 11);
+    CuAssertIntEquals(tc, c->tmval->tm_year, 104);
+    CuAssertIntEquals(tc, c->tmval->tm_wday, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_yday, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_isdst, 0);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argdate_basic_003(CuTest* tc) {
+    struct arg_date* a = arg_date1(NULL, NULL, "%H:%M", NULL, "time 23:59");
+    struct arg_date* b = arg_date0("b", NULL, "%Y-%m-%d", NULL, "date YYYY-MM-DD");
+    struct arg_date* c = arg_daten(NULL, "date", "%D", NULL, 1, 2, "MM/DD/YY");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, c, end};
+    int nerrors;
+
+    char* argv[] = {"program", "--date", "12/31/04", "20:15", "--date", "06/07/84", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertIntEquals(tc, a->tmval->tm_sec, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_min, 15);
+    CuAssertIntEquals(tc, a->tmval->tm_hour, 20);
+    CuAssertIntEquals(tc, a->tmval->tm_mday, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_mon, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_year, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_wday, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_yday, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_isdst, 0);
+    CuAssertTrue(tc, b->count == 0);
+    CuAssertTrue(tc, c->count == 2);
+    CuAssertIntEquals(tc, c->tmval->tm_sec, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_min, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_hour, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_mday, 31);
+    CuAssertIntEquals(tc, c->tmval->tm_mon, 11);
+    CuAssertIntEquals(tc, c->tmval->tm_year, 104);
+    CuAssertIntEquals(tc, c->tmval->tm_wday, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_yday, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_isdst, 0);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_sec, 0);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_min, 0);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_hour, 0);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_mday, 7);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_mon, 5);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_year, 84);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_wday, 0);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_yday, 0);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_isdst, 0);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argdate_basic_004(CuTest* tc) {
+    struct arg_date* a = arg_date1(NULL, NULL, "%H:%M", NULL, "time 23:59");
+    struct arg_date* b = arg_date0("b", NULL, "%Y-%m-%d", NULL, "date YYYY-MM-DD");
+    struct arg_date* c = arg_daten(NULL, "date", "%D", NULL, 1, 2, "MM/DD/YY");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, c, end};
+    int nerrors;
+
+    char* argv[] = {"program", "--date", "12/31/04", "20:15", "-b", "1982-11-28", "--date", "06/07/84", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertIntEquals(tc, a->tmval->tm_sec, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_min, 15);
+    CuAssertIntEquals(tc, a->tmval->tm_hour, 20);
+    CuAssertIntEquals(tc, a->tmval->tm_mday, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_mon, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_year, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_wday, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_yday, 0);
+    CuAssertIntEquals(tc, a->tmval->tm_isdst, 0);
+    CuAssertTrue(tc, b->count == 1);
+    CuAssertIntEquals(tc, b->tmval->tm_sec, 0);
+    CuAssertIntEquals(tc, b->tmval->tm_min, 0);
+    CuAssertIntEquals(tc, b->tmval->tm_hour, 0);
+    CuAssertIntEquals(tc, b->tmval->tm_mday, 28);
+    CuAssertIntEquals(tc, b->tmval->tm_mon, 10);
+    CuAssertIntEquals(tc, b->tmval->tm_year, 82);
+    CuAssertIntEquals(tc, b->tmval->tm_wday, 0);
+    CuAssertIntEquals(tc, b->tmval->tm_yday, 0);
+    CuAssertIntEquals(tc, b->tmval->tm_isdst, 0);
+    CuAssertTrue(tc, c->count == 2);
+    CuAssertIntEquals(tc, c->tmval->tm_sec, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_min, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_hour, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_mday, 31);
+    CuAssertIntEquals(tc, c->tmval->tm_mon, 11);
+    CuAssertIntEquals(tc, c->tmval->tm_year, 104);
+    CuAssertIntEquals(tc, c->tmval->tm_wday, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_yday, 0);
+    CuAssertIntEquals(tc, c->tmval->tm_isdst, 0);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_sec, 0);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_min, 0);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_hour, 0);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_mday, 7);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_mon, 5);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_year, 84);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_wday, 0);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_yday, 0);
+    CuAssertIntEquals(tc, (c->tmval + 1)->tm_isdst, 0);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argdate_basic_005(CuTest* tc) {
+    struct arg_date* a = arg_date1(NULL, NULL, "%H:%M", NULL, "time 23:59");
+    struct arg_date* b = arg_date0("b", NULL, "%Y-%m-%d", NULL, "date YYYY-MM-DD");
+    struct arg_date* c = arg_daten(NULL, "date", "%D", NULL, 1, 2, "MM/DD/YY");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, c, end};
+    int nerrors;
+
+    char* argv[] = {"program", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertTrue(tc, nerrors == 2);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argdate_basic_006(CuTest* tc) {
+    struct arg_date* a = arg_date1(NULL, NULL, "%H:%M", NULL, "time 23:59");
+    struct arg_date* b = arg_date0("b", NULL, "%Y-%m-%d", NULL, "date YYYY-MM-DD");
+    struct arg_date* c = arg_daten(NULL, "date", "%D", NULL, 1, 2, "MM/DD/YY");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, c, end};
+    int nerrors;
+
+    char* argv[] = {"program", "25:59", "--date", "12/31/04", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertTrue(tc, nerrors == 1);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argdate_basic_007(CuTest* tc) {
+    struct arg_date* a = arg_date1(NULL, NULL, "%H:%M", NULL, "time 23:59");
+    struct arg_date* b = arg_date0("b", NULL, "%Y-%m-%d", NULL, "date YYYY-MM-DD");
+    struct arg_date* c = arg_daten(NULL, "date", "%D", NULL, 1, 2, "MM/DD/YY");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, c, end};
+    int nerrors;
+
+    char* argv[] = {"program", "23:59", "--date", "12/32/04", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertTrue(tc, nerrors == 1);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argdate_basic_008(CuTest* tc) {
+    struct arg_date* a = arg_date1(NULL, NULL, "%H:%M", NULL, "time 23:59");
+    struct arg_date* b = arg_date0("b", NULL, "%Y-%m-%d", NULL, "date YYYY-MM-DD");
+    struct arg_date* c = arg_daten(NULL, "date", "%D", NULL, 1, 2, "MM/DD/YY");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, c, end};
+    int nerrors;
+
+    char* argv[] = {"program", "23:59", "--date", "12/31/04", "22:58", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertTrue(tc, nerrors == 1);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argdate_basic_009(CuTest* tc) {
+    struct arg_date* a = arg_date1(NULL, NULL, "%H:%M", NULL, "time 23:59");
+    struct arg_date* b = arg_date0("b", NULL, "%Y-%m-%d", NULL, "date YYYY-MM-DD");
+    struct arg_date* c = arg_daten(NULL, "date", "%D", NULL, 1, 2, "MM/DD/YY");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, c, end};
+    int nerrors;
+
+    char* argv[] = {"program", "--date", "12/31/04", "20:15", "--date", "26/07/84", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertTrue(tc, nerrors == 1);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argdate_basic_010(CuTest* tc) {
+    struct arg_date* a = arg_date1(NULL, NULL, "%H:%M", NULL, "time 23:59");
+    struct arg_date* b = arg_date0("b", NULL, "%Y-%m-%d", NULL, "date YYYY-MM-DD");
+    struct arg_date* c = arg_daten(NULL, "date", "%D", NULL, 1, 2, "MM/DD/YY");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, c, end};
+    int nerrors;
+
+    char* argv[] = {"program", "-b", "1982-11-28", "-b", "1976-11-11", "--date", "12/07/84", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertTrue(tc, nerrors == 1);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argdate_basic_011(CuTest* tc) {
+    static const struct {
+        const char* format;
+        const char* arg;
+        int year, mon, mday, hour, min, sec;
+    } cases[] = {
+        {"%Y-%m-%d", "--x=2024-03-01", 124, 2, 1, 0, 0, 0},
+        {"%Y-%m-%d", "--x=2024-3-1", 124, 2, 1, 0, 0, 0},
+        {"%H:%M:%S", "--x=23:59:60", 0, 0, 0, 23, 59, 60},
+        {"%T", "--x=07:08:09", 0, 0, 0, 7, 8, 9},
+        {"%Y-%m-%dT%H:%M:%S", "--x=1999-12-31T23:59:59", 99, 11, 31, 23, 59, 59},
+        {"%Y-%m-%d %T", "--x=0001-01-01 00:00:00", -1899, 0, 1, 0, 0, 0},
+        {"%Y-%m-%d %H:%M:%S", "--x=2024-02-30 1:2:3", 124, 1, 30, 1, 2, 3},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_date* x = arg_date0(NULL, "x", cases[i].format, NULL, "x is <date>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, x->count);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].year, x->tmval[0].tm_year);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].mon, x->tmval[0].tm_mon);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].mday, x->tmval[0].tm_mday);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].hour, x->tmval[0].tm_hour);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].min, x->tmval[0].tm_min);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].sec, x->tmval[0].tm_sec);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argdate_basic_012(CuTest* tc) {
+    struct arg_date* a = arg_daten(NULL, "at", ARG_DATE_ISO8601, NULL, 0, 3, "event time");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[] = {"program", "--at=2024-03-01T00:30:00+01:00", "--at=2023-12-31 23:59Z", "--at=2000-01-01", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    int nerrors;
+
+    CuAssertTrue(tc, a->nsec == NULL);
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 3, a->count);
+
+    /* the offset is folded into the time, which ends up on a leap day */
+    CuAssertIntEquals(tc, 124, a->tmval[0].tm_year);
+    CuAssertIntEquals(tc, 1, a->tmval[0].tm_mon);
+    CuAssertIntEquals(tc, 29, a->tmval[0].tm_mday);
+    CuAssertIntEquals(tc, 23, a->tmval[0].tm_hour);
+    CuAssertIntEquals(tc, 30, a->tmval[0].tm_min);
+    CuAssertIntEquals(tc, 4, a->tmval[0].tm_wday);
+    CuAssertIntEquals(tc, 59, a->tmval[0].tm_yday);
+
+    CuAssertIntEquals(tc, 123, a->tmval[1].tm_year);
+    CuAssertIntEquals(tc, 0, a->tmval[1].tm_wday);
+    CuAssertIntEquals(tc, 364, a->tmval[1].tm_yday);
+    CuAssertIntEquals(tc, 0, a->tmval[1].tm_sec);
+
+    CuAssertIntEquals(tc, 100, a->tmval[2].tm_year);
+    CuAssertIntEquals(tc, 6, a->tmval[2].tm_wday);
+    CuAssertIntEquals(tc, 0, a->tmval[2].tm_hour);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argdate_basic_013(CuTest* tc) {
+    static const struct {
+        const char* format;
+        const char* arg;
+        int64_t value;
+    } cases[] = {
+        {ARG_DATE_ISO8601, "--x=1970-01-01T00:00:00Z", 0},
+        {ARG_DATE_ISO8601, "--x=2024-03-01T12:00:00.5+01:00", (int64_t)1709290800 * 1000000000 + 500000000},
+        {ARG_DATE_ISO8601, "--x=2024-03-01T12:00:00,5+0100", (int64_t)1709290800 * 1000000000 + 500000000},
+        {ARG_DATE_ISO8601, "--x=2024-03-01t06:30-05", (int64_t)1709292600 * 1000000000},
+        {ARG_DATE_ISO8601, "--x=1969-12-31T23:59:59.999999999Z", -1},
+        {ARG_DATE_ISO8601, "--x=2000-02-29", (int64_t)951782400 * 1000000000},
+        {"%H:%M:%S", "--x=01:02:03", (int64_t)3723 * 1000000000},
+        {"%Y-%m-%d", "--x=1677-09-22", (int64_t)-9223286400 * 1000000000},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_date* x = arg_epoch0(NULL, "x", cases[i].format, NULL, "x is <date>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        CuAssertTrue(tc, x->tmval == NULL);
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, x->count);
+        CuAssert(tc, cases[i].arg, x->nsec[0] == cases[i].value);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argdate_basic_014(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        int error;
+    } cases[] = {
+        {"--x=2023-02-29", ARG_ERR_BADDATE},
+        {"--x=2024-04-31", ARG_ERR_BADDATE},
+        {"--x=2024-13-01", ARG_ERR_BADDATE},
+        {"--x=2024-3-01", ARG_ERR_BADDATE},
+        {"--x=2024-03-01T24:00", ARG_ERR_BADDATE},
+        {"--x=2024-03-01T12", ARG_ERR_BADDATE},
+        {"--x=2024-03-01T12:00:00.", ARG_ERR_BADDATE},
+        {"--x=2024-03-01T12:00+01:", ARG_ERR_BADDATE},
+        {"--x=2024-03-01T12:00+1", ARG_ERR_BADDATE},
+        {"--x=2024-03-01T12:00Zx", ARG_ERR_BADDATE},
+        {"--x=2024-03-01x", ARG_ERR_BADDATE},
+        {"--x=2263-01-01", ARG_ERR_OVERFLOW},
+        {"--x=1677-09-21T00:00Z", ARG_ERR_OVERFLOW},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_date* x = arg_epoch0(NULL, "x", ARG_DATE_ISO8601, NULL, "x is <date>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, x->count);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].error, end->error[0]);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argdate_basic_015(CuTest* tc) {
+    struct arg_date* a = arg_epoch1("t", "at", ARG_DATE_ISO8601, "<time>", "event time");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[] = {"program", "--at=2262-04-12T00:00:00Z", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    arg_dstr_t ds = arg_dstr_create();
+    int nerrors;
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 1, nerrors);
+
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc, "program: timestamp \"2262-04-12T00:00:00Z\" is out of range at option -t|--at=<time>\n", arg_dstr_cstr(ds));
+
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argdate_basic_016(CuTest* tc) {
+    static const struct {
+        const char* format;
+        const char* arg;
+        int year, mon, mday, hour, min, wday;
+    } cases[] = {
+        {"%d/%m/%Y %I:%M %p", "--x=05/11/2023 07:45 PM", 123, 10, 5, 19, 45, 0},
+        {"%d/%m/%Y %I:%M %p", "--x=5/11/2023    12:05am", 123, 10, 5, 0, 5, 0},
+        {"%a %b %e %H:%M %Y", "--x=tuesday MAR 5 09:30 2024", 124, 2, 5, 9, 30, 2},
+        {"%D %R", "--x=12/07/84 23:01", 84, 11, 7, 23, 1, 0},
+        {"%Ey%%%Od", "--x=68%31", 168, 0, 31, 0, 0, 0},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_date* x = arg_date0(NULL, "x", cases[i].format, NULL, "x is <date>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, x->count);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].year, x->tmval[0].tm_year);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].mon, x->tmval[0].tm_mon);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].mday, x->tmval[0].tm_mday);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].hour, x->tmval[0].tm_hour);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].min, x->tmval[0].tm_min);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].wday, x->tmval[0].tm_wday);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argdate_basic_017(CuTest* tc) {
+    static const char* formats[] = {"%Y-%q", "%Y%", "%Ed", "%EEy", "%OY", "%Ek", "%E"};
+    struct arg_date* a = arg_date0(NULL, "x", "%d/%m/%Y %I:%M %p", NULL, "x is <date>");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[] = {"program", "--x=05/11/2023 13:45 PM", NULL};
+    size_t i;
+
+    for (i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+        CuAssertPtrEquals_Msg(tc, formats[i], NULL, arg_date0(NULL, "x", formats[i], NULL, NULL));
+        CuAssertPtrEquals_Msg(tc, formats[i], NULL, arg_epoch0(NULL, "x", formats[i], NULL, NULL));
+    }
+
+    /* a valid format still rejects values outside the bounds of its fields */
+    CuAssertIntEquals(tc, 1, arg_parse(2, argv, argtable));
+    CuAssertIntEquals(tc, ARG_ERR_BADDATE, end->error[0]);
+
+    argv[1] = "--x=05/11/2023 01:45 PM extra";
+    CuAssertIntEquals(tc, 1, arg_parse(2, argv, argtable));
+    CuAssertIntEquals(tc, ARG_ERR_BADDATE, end->error[0]);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+CuSuite* get_argdate_testsuite() {
+    CuSuite* suite = CuSuiteNew();
+    SUITE_ADD_TEST(suite, test_argdate_basic_001);
+    SUITE_ADD_TEST(suite, test_argdate_basic_002);
+    SUITE_ADD_TEST(suite, test_argdate_basic_003);
+    SUITE_ADD_TEST(suite, test_argdate_basic_004);
+    SUITE_ADD_TEST(suite, test_argdate_basic_005);
+    SUITE_ADD_TEST(suite, test_argdate_basic_006);
+    SUITE_ADD_TEST(suite, test_argdate_basic_007);
+    SUITE_ADD_TEST(suite, test_argdate_basic_008);
+    SUITE_ADD_TEST(suite, test_argdate_basic_009);
+    SUITE_ADD_TEST(suite, test_argdate_basic_010);
+    SUITE_ADD_TEST(suite, test_argdate_basic_011);
+    SUITE_ADD_TEST(suite, test_argdate_basic_012);
+    SUITE_ADD_TEST(suite, test_argdate_basic_013);
+    SUITE_ADD_TEST(suite, test_argdate_basic_014);
+    SUITE_ADD_TEST(suite, test_argdate_basic_015);
+    SUITE_ADD_TEST(suite, test_argdate_basic_016);
+    SUITE_ADD_TEST(suite, test_argdate_basic_017);
+    return suite;
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
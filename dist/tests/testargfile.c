@@ -0,0 +1,1215 @@
+/*******************************************************************************
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2019 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "CuTest.h"
+#include "argtable3.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#define TEST_MKDIR(path) _mkdir(path)
+#define TEST_RMDIR(path) _rmdir(path)
+#else
+#include <unistd.h>
+#define TEST_MKDIR(path) mkdir(path, 0755)
+#define TEST_RMDIR(path) rmdir(path)
+#endif
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4204)
+#endif
+
+void test_argfile_basic_001(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "foo.bar", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "foo.bar");
+    CuAssertStrEquals(tc, a->basename[0], "foo.bar");
+    CuAssertStrEquals(tc, a->extension[0], ".bar");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_002(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "/foo.bar", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "/foo.bar");
+    CuAssertStrEquals(tc, a->basename[0], "foo.bar");
+    CuAssertStrEquals(tc, a->extension[0], ".bar");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_003(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "./foo.bar", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "./foo.bar");
+    CuAssertStrEquals(tc, a->basename[0], "foo.bar");
+    CuAssertStrEquals(tc, a->extension[0], ".bar");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_004(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "././foo.bar", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "././foo.bar");
+    CuAssertStrEquals(tc, a->basename[0], "foo.bar");
+    CuAssertStrEquals(tc, a->extension[0], ".bar");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_005(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "./././foo.bar", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "./././foo.bar");
+    CuAssertStrEquals(tc, a->basename[0], "foo.bar");
+    CuAssertStrEquals(tc, a->extension[0], ".bar");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_006(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "../foo.bar", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "../foo.bar");
+    CuAssertStrEquals(tc, a->basename[0], "foo.bar");
+    CuAssertStrEquals(tc, a->extension[0], ".bar");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_007(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "../../foo.bar", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "../../foo.bar");
+    CuAssertStrEquals(tc, a->basename[0], "foo.bar");
+    CuAssertStrEquals(tc, a->extension[0], ".bar");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_008(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "foo", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "foo");
+    CuAssertStrEquals(tc, a->basename[0], "foo");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_009(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "/foo", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "/foo");
+    CuAssertStrEquals(tc, a->basename[0], "foo");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_010(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "./foo", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "./foo");
+    CuAssertStrEquals(tc, a->basename[0], "foo");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_011(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "././foo", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "././foo");
+    CuAssertStrEquals(tc, a->basename[0], "foo");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_012(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "./././foo", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "./././foo");
+    CuAssertStrEquals(tc, a->basename[0], "foo");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_013(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "../foo", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "../foo");
+    CuAssertStrEquals(tc, a->basename[0], "foo");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_014(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "../../foo", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "../../foo");
+    CuAssertStrEquals(tc, a->basename[0], "foo");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_015(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", ".foo", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], ".foo");
+    CuAssertStrEquals(tc, a->basename[0], ".foo");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_016(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "/.foo", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "/.foo");
+    CuAssertStrEquals(tc, a->basename[0], ".foo");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_017(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "./.foo", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "./.foo");
+    CuAssertStrEquals(tc, a->basename[0], ".foo");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_018(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "../.foo", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "../.foo");
+    CuAssertStrEquals(tc, a->basename[0], ".foo");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_019(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "foo.", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "foo.");
+    CuAssertStrEquals(tc, a->basename[0], "foo.");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_020(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "/foo.", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "/foo.");
+    CuAssertStrEquals(tc, a->basename[0], "foo.");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_021(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "./foo.", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "./foo.");
+    CuAssertStrEquals(tc, a->basename[0], "foo.");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_022(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "../foo.", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "../foo.");
+    CuAssertStrEquals(tc, a->basename[0], "foo.");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_023(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "/.foo.", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "/.foo.");
+    CuAssertStrEquals(tc, a->basename[0], ".foo.");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_024(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "/.foo.c", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "/.foo.c");
+    CuAssertStrEquals(tc, a->basename[0], ".foo.c");
+    CuAssertStrEquals(tc, a->extension[0], ".c");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_025(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "/.foo..b.c", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "/.foo..b.c");
+    CuAssertStrEquals(tc, a->basename[0], ".foo..b.c");
+    CuAssertStrEquals(tc, a->extension[0], ".c");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_026(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "/", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "/");
+    CuAssertStrEquals(tc, a->basename[0], "");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_027(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", ".", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], ".");
+    CuAssertStrEquals(tc, a->basename[0], "");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_028(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "..", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "..");
+    CuAssertStrEquals(tc, a->basename[0], "");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_029(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "/.", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "/.");
+    CuAssertStrEquals(tc, a->basename[0], "");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_030(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "/..", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "/..");
+    CuAssertStrEquals(tc, a->basename[0], "");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_031(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "./", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "./");
+    CuAssertStrEquals(tc, a->basename[0], "");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_032(CuTest* tc) {
+    struct arg_file* a = arg_file1(NULL, NULL, "<file>", "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "../", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "../");
+    CuAssertStrEquals(tc, a->basename[0], "");
+    CuAssertStrEquals(tc, a->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+#if defined(WIN32) && !defined(__MINGW32__)
+void test_argfile_basic_033(CuTest* tc) {
+    struct arg_file* a = arg_filen(NULL, NULL, "<file>", 0, 3, "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "C:\\test folder\\", "C:\\test folder2", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 2);
+    CuAssertStrEquals(tc, a->filename[0], "C:\\test folder\\");
+    CuAssertStrEquals(tc, a->basename[0], "");
+    CuAssertStrEquals(tc, a->extension[0], "");
+    CuAssertStrEquals(tc, a->filename[1], "C:\\test folder2");
+    CuAssertStrEquals(tc, a->basename[1], "test folder2");
+    CuAssertStrEquals(tc, a->extension[1], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_034(CuTest* tc) {
+    struct arg_file* a = arg_filen(NULL, NULL, "<file>", 1, 1, "path a");
+    struct arg_file* b = arg_filen(NULL, NULL, "<file>", 1, 1, "path b");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, end};
+    int nerrors;
+
+    char* argv[] = {"program", "C:\\test folder\\", "C:\\test folder2", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "C:\\test folder\\");
+    CuAssertStrEquals(tc, a->basename[0], "");
+    CuAssertStrEquals(tc, a->extension[0], "");
+    CuAssertTrue(tc, b->count == 1);
+    CuAssertStrEquals(tc, b->filename[0], "C:\\test folder2");
+    CuAssertStrEquals(tc, b->basename[0], "test folder2");
+    CuAssertStrEquals(tc, b->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+#else
+void test_argfile_basic_033(CuTest* tc) {
+    struct arg_file* a = arg_filen(NULL, NULL, "<file>", 0, 3, "filename to test");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    int nerrors;
+
+    char* argv[] = {"program", "/test folder/", "/test folder2", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 2);
+    CuAssertStrEquals(tc, a->filename[0], "/test folder/");
+    CuAssertStrEquals(tc, a->basename[0], "");
+    CuAssertStrEquals(tc, a->extension[0], "");
+    CuAssertStrEquals(tc, a->filename[1], "/test folder2");
+    CuAssertStrEquals(tc, a->basename[1], "test folder2");
+    CuAssertStrEquals(tc, a->extension[1], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_034(CuTest* tc) {
+    struct arg_file* a = arg_filen(NULL, NULL, "<file>", 1, 1, "path a");
+    struct arg_file* b = arg_filen(NULL, NULL, "<file>", 1, 1, "path b");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, end};
+    int nerrors;
+
+    char* argv[] = {"program", "/test folder/", "/test folder2", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertTrue(tc, nerrors == 0);
+    CuAssertTrue(tc, a->count == 1);
+    CuAssertStrEquals(tc, a->filename[0], "/test folder/");
+    CuAssertStrEquals(tc, a->basename[0], "");
+    CuAssertStrEquals(tc, a->extension[0], "");
+    CuAssertTrue(tc, b->count == 1);
+    CuAssertStrEquals(tc, b->filename[0], "/test folder2");
+    CuAssertStrEquals(tc, b->basename[0], "test folder2");
+    CuAssertStrEquals(tc, b->extension[0], "");
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+#endif /* #if defined(WIN32) && !defined(__MINGW32__) */
+
+void test_argfile_basic_035(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        size_t length, basename, extension;
+    } cases[] = {
+        {"foo.bar", 7, 0, 3},
+        {"/home/user/foo.tar.gz", 21, 11, 18},
+        {"dir.d/file", 10, 6, 10},
+        {".profile", 8, 0, 8},
+        {"foo.", 4, 0, 4},
+        {"foo..", 5, 0, 5},
+        {"a/..", 4, 4, 4},
+        {"a/.", 3, 3, 3},
+        {"a/", 2, 2, 2},
+        {"/", 1, 1, 1},
+        {"x", 1, 0, 1},
+    };
+    struct arg_file* a = arg_filen(NULL, NULL, "<file>", 0, 20, "files");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[sizeof(cases) / sizeof(cases[0]) + 2];
+    int argc = 1;
+    size_t i;
+
+    argv[0] = "program";
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+        argv[argc++] = (char*)cases[i].arg;
+    argv[argc] = NULL;
+
+    CuAssertIntEquals(tc, 0, arg_parse(argc, argv, argtable));
+    CuAssertIntEquals(tc, argc - 1, a->count);
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        CuAssertIntEquals_Msg(tc, cases[i].arg, (int)cases[i].length, (int)a->span[i].length);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, (int)cases[i].basename, (int)a->span[i].basename);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, (int)cases[i].extension, (int)a->span[i].extension);
+        CuAssertPtrEquals_Msg(tc, cases[i].arg, (void*)(cases[i].arg + cases[i].basename), (void*)a->basename[i]);
+        CuAssertPtrEquals_Msg(tc, cases[i].arg, (void*)(cases[i].arg + cases[i].extension), (void*)a->extension[i]);
+    }
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_036(CuTest* tc) {
+    static const char* tmpname = "testargfile_036.tmp";
+    struct arg_file* a = arg_filen("f", "file", "<file>", 0, 10, "input files");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[] = {"program", "-f", (char*)tmpname, "-f", "testargfile_036.missing", "-f", ".", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    arg_dstr_t ds = arg_dstr_create();
+    FILE* fp;
+    int nerrors;
+
+    fp = fopen(tmpname, "w");
+    CuAssertPtrNotNull(tc, fp);
+    fputs("hello", fp);
+    fclose(fp);
+
+    /* without validation the paths are only recorded */
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertPtrEquals(tc, NULL, (void*)arg_file_stat(a, 0));
+
+    arg_file_validate(a, ARG_FILE_REGULAR | ARG_FILE_READABLE, 0);
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 2, nerrors);
+    CuAssertIntEquals(tc, 3, a->count);
+    CuAssertPtrEquals(tc, (void*)a, end->parent[0]);
+    CuAssertStrEquals(tc, "testargfile_036.missing", end->argval[0]);
+    CuAssertPtrEquals(tc, (void*)a, end->parent[1]);
+    CuAssertStrEquals(tc, ".", end->argval[1]);
+
+    CuAssertPtrNotNull(tc, arg_file_stat(a, 0));
+    CuAssertIntEquals(tc, 5, (int)arg_file_stat(a, 0)->st_size);
+    CuAssertPtrEquals(tc, NULL, (void*)arg_file_stat(a, 1));
+    CuAssertPtrNotNull(tc, arg_file_stat(a, 2));
+    CuAssertPtrEquals(tc, NULL, (void*)arg_file_stat(a, 3));
+
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc,
+                      "program: cannot access \"testargfile_036.missing\" (No such file or directory) at option -f|--file=<file>\n"
+                      "program: \".\" is not a regular file at option -f|--file=<file>\n",
+                      arg_dstr_cstr(ds));
+
+    /* flags of 0 turn the checks off again */
+    arg_file_validate(a, 0, 0);
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+
+    remove(tmpname);
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_037(CuTest* tc) {
+    struct arg_file* a = arg_filen(NULL, NULL, "<path>", 0, 400, "paths");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[402];
+    int argc = 1;
+    int nerrors;
+    int i;
+
+    /* enough paths for several chunks, with a missing path in the middle of the last one */
+    argv[0] = "program";
+    for (i = 0; i < 300; i++)
+        argv[argc++] = (i == 250) ? "testargfile_037.missing" : ".";
+    argv[argc] = NULL;
+
+    arg_file_validate(a, ARG_FILE_DIR, 4);
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 1, nerrors);
+    CuAssertStrEquals(tc, "testargfile_037.missing", end->argval[0]);
+    for (i = 0; i < 300; i++) {
+        if (i == 250)
+            CuAssertPtrEquals(tc, NULL, (void*)arg_file_stat(a, i));
+        else
+            CuAssertTrue(tc, arg_file_stat(a, i) != NULL && (arg_file_stat(a, i)->st_mode & S_IFMT) == S_IFDIR);
+    }
+
+    /* one worker per CPU */
+    arg_file_validate(a, ARG_FILE_DIR | ARG_FILE_REGULAR, -1);
+    argv[251] = ".";
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 300, a->count);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+/* Files of the tree used by the glob tests, directories end with a separator */
+static const char* glob_tree[] = {
+    "testargfile_glob/",           "testargfile_glob/a.gz",           "testargfile_glob/b.txt",
+    "testargfile_glob/.hidden.gz", "testargfile_glob/sub/",           "testargfile_glob/sub/c.gz",
+    "testargfile_glob/sub/deep/",  "testargfile_glob/sub/deep/d.gz", "testargfile_glob/sub/.h/",
+    "testargfile_glob/sub/.h/e.gz",
+};
+#define GLOB_TREE_SIZE (int)(sizeof(glob_tree) / sizeof(glob_tree[0]))
+
+static void glob_tree_create(void) {
+    char path[64];
+    int i;
+
+    for (i = 0; i < GLOB_TREE_SIZE; i++) {
+        size_t len = strlen(glob_tree[i]);
+        if (glob_tree[i][len - 1] == '/') {
+            memcpy(path, glob_tree[i], len - 1);
+            path[len - 1] = '\0';
+            TEST_MKDIR(path);
+        } else {
+            FILE* fp = fopen(glob_tree[i], "w");
+            if (fp)
+                fclose(fp);
+        }
+    }
+}
+
+static void glob_tree_remove(void) {
+    char path[64];
+    int i;
+
+    for (i = GLOB_TREE_SIZE - 1; i >= 0; i--) {
+        size_t len = strlen(glob_tree[i]);
+        if (glob_tree[i][len - 1] == '/') {
+            memcpy(path, glob_tree[i], len - 1);
+            path[len - 1] = '\0';
+            TEST_RMDIR(path);
+        } else {
+            remove(glob_tree[i]);
+        }
+    }
+}
+
+void test_argfile_basic_038(CuTest* tc) {
+    static const struct {
+        const char* pattern;
+        const char* matches; /* matches joined by spaces */
+    } cases[] = {
+        {"testargfile_glob/*.gz", "testargfile_glob/a.gz"},
+        {"testargfile_glob/.*.gz", "testargfile_glob/.hidden.gz"},
+        {"testargfile_glob/?.*", "testargfile_glob/a.gz testargfile_glob/b.txt"},
+        {"testargfile_glob/[!a]*", "testargfile_glob/b.txt testargfile_glob/sub"},
+        {"testargfile_glob/[a-b].t[x]t", "testargfile_glob/b.txt"},
+        {"testargfile_glob/*/", "testargfile_glob/sub/"},
+        {"testargfile_glob/*/c.gz", "testargfile_glob/sub/c.gz"},
+        {"testargfile_glob/**/*.gz", "testargfile_glob/a.gz testargfile_glob/sub/c.gz testargfile_glob/sub/deep/d.gz"},
+        {"testargfile_glob//sub/**", "testargfile_glob//sub/c.gz testargfile_glob//sub/deep testargfile_glob//sub/deep/d.gz"},
+        {"test*_glob/sub/*/*", "testargfile_glob/sub/deep/d.gz"},
+    };
+    struct arg_file* a = arg_filen(NULL, NULL, "<file>", 0, 100, "files");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    arg_dstr_t ds = arg_dstr_create();
+    size_t i;
+    int j;
+
+    glob_tree_create();
+    arg_file_glob(a, 100, -1);
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        char* argv[] = {"program", (char*)cases[i].pattern, NULL};
+
+        CuAssertIntEquals_Msg(tc, cases[i].pattern, 0, arg_parse(2, argv, argtable));
+        arg_dstr_reset(ds);
+        for (j = 0; j < a->count; j++)
+            arg_dstr_catf(ds, "%s%s", j ? " " : "", a->filename[j]);
+        CuAssertStrEquals_Msg(tc, cases[i].pattern, cases[i].matches, arg_dstr_cstr(ds));
+    }
+
+    /* matches keep the order of the patterns, and values without wildcards are stored as they are */
+    {
+        char* argv[] = {"program", "testargfile_glob/*.txt", "nonexistent.file", "testargfile_glob/sub/*.gz", NULL};
+
+        CuAssertIntEquals(tc, 0, arg_parse(4, argv, argtable));
+        CuAssertIntEquals(tc, 3, a->count);
+        CuAssertStrEquals(tc, "testargfile_glob/b.txt", a->filename[0]);
+        CuAssertStrEquals(tc, "b.txt", a->basename[0]);
+        CuAssertStrEquals(tc, ".txt", a->extension[0]);
+        CuAssertStrEquals(tc, "nonexistent.file", a->filename[1]);
+        CuAssertStrEquals(tc, "testargfile_glob/sub/c.gz", a->filename[2]);
+    }
+
+    /* with the expansion turned off again the pattern itself is stored */
+    {
+        char* argv[] = {"program", "testargfile_glob/*.gz", NULL};
+
+        arg_file_glob(a, 0, 0);
+        CuAssertIntEquals(tc, 0, arg_parse(2, argv, argtable));
+        CuAssertIntEquals(tc, 1, a->count);
+        CuAssertStrEquals(tc, "testargfile_glob/*.gz", a->filename[0]);
+    }
+
+    glob_tree_remove();
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_039(CuTest* tc) {
+    struct arg_file* a = arg_filen("f", NULL, "<file>", 0, 3, "files");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[] = {"program", "-f", "testargfile_glob/*.none", "-f", "testargfile_glob/**", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    arg_dstr_t ds = arg_dstr_create();
+    int nerrors;
+
+    glob_tree_create();
+    arg_file_glob(a, 4, 0);
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 2, nerrors);
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc,
+                      "program: no files match \"testargfile_glob/*.none\" at option -f <file>\n"
+                      "program: \"testargfile_glob/**\" matches more than 4 files at option -f <file>\n",
+                      arg_dstr_cstr(ds));
+
+    /* more matches than the argument has room for */
+    arg_file_glob(a, 10, 0);
+    argv[2] = "testargfile_glob/*";
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 1, nerrors);
+    CuAssertIntEquals(tc, 3, a->count);
+    CuAssertStrEquals(tc, "testargfile_glob/**", end->argval[0]);
+
+    /* the limit also applies to the directories that "**" walks through */
+    argv[2] = "testargfile_glob/a.gz";
+    argv[4] = "testargfile_glob/**/d.gz";
+    arg_file_glob(a, 2, 0);
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 1, nerrors);
+    CuAssertStrEquals(tc, "testargfile_glob/**/d.gz", end->argval[0]);
+    arg_file_glob(a, 3, 0);
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 2, a->count);
+    CuAssertStrEquals(tc, "testargfile_glob/sub/deep/d.gz", a->filename[1]);
+
+    glob_tree_remove();
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argfile_basic_040(CuTest* tc) {
+    static const char* tmpname = "testargfile_040.tmp";
+    static const char* emptyname = "testargfile_040.empty";
+    struct arg_file* a = arg_filen(NULL, NULL, "<file>", 0, 10, "input files");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[] = {"program", (char*)tmpname, (char*)emptyname, "testargfile_040.missing", "-", "-", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    const char* data;
+    size_t len = 0;
+    FILE* fp;
+
+    fp = fopen(tmpname, "wb");
+    CuAssertPtrNotNull(tc, fp);
+    fputs("hello, world\n", fp);
+    fclose(fp);
+    fp = fopen(emptyname, "wb");
+    CuAssertPtrNotNull(tc, fp);
+    fclose(fp);
+
+    CuAssertIntEquals(tc, 0, arg_parse(argc, argv, argtable));
+
+    data = arg_file_map(a, 0, &len);
+    CuAssertPtrNotNull(tc, data);
+    CuAssertIntEquals(tc, 13, (int)len);
+    CuAssertStrEquals(tc, "hello, world\n", data);
+    CuAssertPtrEquals(tc, (void*)data, (void*)arg_file_map(a, 0, NULL));
+
+    data = arg_file_map(a, 1, &len);
+    CuAssertPtrNotNull(tc, data);
+    CuAssertIntEquals(tc, 0, (int)len);
+    CuAssertStrEquals(tc, "", data);
+
+    CuAssertPtrEquals(tc, NULL, (void*)arg_file_map(a, 2, &len));
+    CuAssertPtrEquals(tc, NULL, (void*)arg_file_map(a, -1, &len));
+    CuAssertPtrEquals(tc, NULL, (void*)arg_file_map(a, 5, &len));
+
+    /* "-" reads stdin once, and every "-" shares the contents */
+    CuAssertPtrNotNull(tc, freopen(tmpname, "rb", stdin));
+    data = arg_file_map(a, 3, &len);
+    CuAssertPtrNotNull(tc, data);
+    CuAssertIntEquals(tc, 13, (int)len);
+    CuAssertStrEquals(tc, "hello, world\n", data);
+    CuAssertPtrEquals(tc, (void*)data, (void*)arg_file_map(a, 4, NULL));
+
+    /* parsing again releases the contents of the previous paths */
+    argv[1] = (char*)emptyname;
+    CuAssertIntEquals(tc, 0, arg_parse(argc, argv, argtable));
+    data = arg_file_map(a, 0, &len);
+    CuAssertPtrNotNull(tc, data);
+    CuAssertIntEquals(tc, 0, (int)len);
+
+    remove(tmpname);
+    remove(emptyname);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+CuSuite* get_argfile_testsuite() {
+    CuSuite* suite = CuSuiteNew();
+    SUITE_ADD_TEST(suite, test_argfile_basic_001);
+    SUITE_ADD_TEST(suite, test_argfile_basic_002);
+    SUITE_ADD_TEST(suite, test_argfile_basic_003);
+    SUITE_ADD_TEST(suite, test_argfile_basic_004);
+    SUITE_ADD_TEST(suite, test_argfile_basic_005);
+    SUITE_ADD_TEST(suite, test_argfile_basic_006);
+    SUITE_ADD_TEST(suite, test_argfile_basic_007);
+    SUITE_ADD_TEST(suite, test_argfile_basic_008);
+    SUITE_ADD_TEST(suite, test_argfile_basic_009);
+    SUITE_ADD_TEST(suite, test_argfile_basic_010);
+    SUITE_ADD_TEST(suite, test_argfile_basic_011);
+    SUITE_ADD_TEST(suite, test_argfile_basic_012);
+    SUITE_ADD_TEST(suite, test_argfile_basic_013);
+    SUITE_ADD_TEST(suite, test_argfile_basic_014);
+    SUITE_ADD_TEST(suite, test_argfile_basic_015);
+    SUITE_ADD_TEST(suite, test_argfile_basic_016);
+    SUITE_ADD_TEST(suite, test_argfile_basic_017);
+    SUITE_ADD_TEST(suite, test_argfile_basic_018);
+    SUITE_ADD_TEST(suite, test_argfile_basic_019);
+    SUITE_ADD_TEST(suite, test_argfile_basic_020);
+    SUITE_ADD_TEST(suite, test_argfile_basic_021);
+    SUITE_ADD_TEST(suite, test_argfile_basic_022);
+    SUITE_ADD_TEST(suite, test_argfile_basic_023);
+    SUITE_ADD_TEST(suite, test_argfile_basic_024);
+    SUITE_ADD_TEST(suite, test_argfile_basic_025);
+    SUITE_ADD_TEST(suite, test_argfile_basic_026);
+    SUITE_ADD_TEST(suite, test_argfile_basic_027);
+    SUITE_ADD_TEST(suite, test_argfile_basic_028);
+    SUITE_ADD_TEST(suite, test_argfile_basic_029);
+    SUITE_ADD_TEST(suite, test_argfile_basic_030);
+    SUITE_ADD_TEST(suite, test_argfile_basic_031);
+    SUITE_ADD_TEST(suite, test_argfile_basic_032);
+    SUITE_ADD_TEST(suite, test_argfile_basic_033);
+    SUITE_ADD_TEST(suite, test_argfile_basic_034);
+    SUITE_ADD_TEST(suite, test_argfile_basic_035);
+    SUITE_ADD_TEST(suite, test_argfile_basic_036);
+    SUITE_ADD_TEST(suite, test_argfile_basic_037);
+    SUITE_ADD_TEST(suite, test_argfile_basic_038);
+    SUITE_ADD_TEST(suite, test_argfile_basic_039);
+    SUITE_ADD_TEST(suite, test_argfile_basic_040);
+    return suite;
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
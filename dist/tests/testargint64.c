@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "CuTest.h"
+#include "argtable3.h"
+#include "argtable3_private.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4204)
+#endif
+
+void test_argint64_basic_001(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        int hi;      /* expected value is hi * 2^32 + lo */
+        unsigned lo; /* (C89 has no 64-bit integer literals) */
+    } cases[] = {
+        {"--x=0", 0, 0},
+        {"--x=-1", -1, 0xFFFFFFFFu},
+        {"--x=4294967296", 1, 0},
+        {"--x=-4294967296", -1, 0},
+        {"--x=6GB", 1, 0x80000000u},
+        {"--x=2TB", 512, 0},
+        {"--x=0x123456789ABCDEF0", 0x12345678, 0x9ABCDEF0u},
+        {"--x=-0o1", -1, 0xFFFFFFFFu},
+        {"--x= 0b100000000000000000000000000000000 ", 1, 0},
+        {"--x=9223372036854775807", 0x7FFFFFFF, 0xFFFFFFFFu},
+        {"--x=-9223372036854775808", (int)0x80000000, 0},
+        {"--x=-0x8000000000000000", (int)0x80000000, 0},
+        {"--x=-8388608TB", (int)0x80000000, 0},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_int64* x = arg_int641(NULL, "x", NULL, "x is <int64>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int64_t expected = (int64_t)(((uint64_t)(int64_t)cases[i].hi << 32) | cases[i].lo);
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, x->count);
+        CuAssert(tc, cases[i].arg, x->ival[0] == expected);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argint64_basic_002(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        int error;
+    } cases[] = {
+        {"--x=9223372036854775808", ARG_ERR_OVERFLOW},
+        {"--x=-9223372036854775809", ARG_ERR_OVERFLOW},
+        {"--x=0x8000000000000000", ARG_ERR_OVERFLOW},
+        {"--x=8388608TB", ARG_ERR_OVERFLOW},
+        {"--x=99999999999999999999999999", ARG_ERR_OVERFLOW},
+        {"--x=99999999999999999999999999z", ARG_ERR_BADINT},
+        {"--x=1PB", ARG_ERR_BADINT},
+        {"--x=1 TB", ARG_ERR_BADINT},
+        {"--x=0x", ARG_ERR_BADINT},
+        {"--x=abc", ARG_ERR_BADINT},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_int64* x = arg_int640(NULL, "x", NULL, "x is <int64>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, x->count);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].error, end->error[0]);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argint64_basic_003(CuTest* tc) {
+    struct arg_int64* a = arg_int64n("a", NULL, NULL, 1, 3, "a is <int64>");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[] = {"program", "-a", "5000000000", "-a", "-1KB", "-a", "7", "-a", "8", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    arg_dstr_t ds = arg_dstr_create();
+    int nerrors;
+
+    CuAssertTrue(tc, arg_nullcheck(argtable) == 0);
+    CuAssertStrEquals(tc, "<int64>", a->hdr.datatype);
+
+    nerrors = arg_parse(argc, argv, argtable);
+
+    CuAssertIntEquals(tc, 1, nerrors);
+    CuAssertIntEquals(tc, 3, a->count);
+    CuAssertTrue(tc, a->ival[0] == (int64_t)5000000 * 1000);
+    CuAssertTrue(tc, a->ival[1] == -1024);
+    CuAssertTrue(tc, a->ival[2] == 7);
+    CuAssertTrue(tc, ((size_t)a->ival % sizeof(int64_t)) == 0);
+
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc, "program: excess option -a 8\n", arg_dstr_cstr(ds));
+
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_arguint64_basic_001(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        unsigned hi; /* expected value is hi * 2^32 + lo */
+        unsigned lo;
+    } cases[] = {
+        {"--x=0", 0, 0},
+        {"--x=-0", 0, 0},
+        {"--x=+42", 0, 42},
+        {"--x=18446744073709551615", 0xFFFFFFFFu, 0xFFFFFFFFu},
+        {"--x=0xFFFFFFFFFFFFFFFF", 0xFFFFFFFFu, 0xFFFFFFFFu},
+        {"--x=0x8000000000000000", 0x80000000u, 0},
+        {"--x=16777215TB", 0xFFFFFF00u, 0},
+        {"--x=0o1777777777777777777777", 0xFFFFFFFFu, 0xFFFFFFFFu},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_uint64* x = arg_uint641(NULL, "x", NULL, "x is <uint64>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        uint64_t expected = ((uint64_t)cases[i].hi << 32) | cases[i].lo;
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, x->count);
+        CuAssert(tc, cases[i].arg, x->uval[0] == expected);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_arguint64_basic_002(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        int error;
+    } cases[] = {
+        {"--x=18446744073709551616", ARG_ERR_OVERFLOW},
+        {"--x=0x10000000000000000", ARG_ERR_OVERFLOW},
+        {"--x=16777216TB", ARG_ERR_OVERFLOW},
+        {"--x=-1", ARG_ERR_BADINT},
+        {"--x=0x-1", ARG_ERR_BADINT},
+        {"--x=-99999999999999999999999", ARG_ERR_BADINT},
+        {"--x=12QB", ARG_ERR_BADINT},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_uint64* x = arg_uint640(NULL, "x", NULL, "x is <uint64>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, x->count);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].error, end->error[0]);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_arguint64_basic_003(CuTest* tc) {
+    struct arg_uint64* x = arg_uint64n(NULL, "x", "<id>", 0, 2, "x is <id>");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {x, end};
+    char* argv[] = {"program", "--x=-5", NULL};
+    arg_dstr_t ds = arg_dstr_create();
+    int nerrors;
+
+    nerrors = arg_parse(2, argv, argtable);
+    CuAssertIntEquals(tc, 1, nerrors);
+
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc, "program: invalid argument \"-5\" to option --x=<id>\n", arg_dstr_cstr(ds));
+
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+CuSuite* get_argint64_testsuite() {
+    CuSuite* suite = CuSuiteNew();
+    SUITE_ADD_TEST(suite, test_argint64_basic_001);
+    SUITE_ADD_TEST(suite, test_argint64_basic_002);
+    SUITE_ADD_TEST(suite, test_argint64_basic_003);
+    SUITE_ADD_TEST(suite, test_arguint64_basic_001);
+    SUITE_ADD_TEST(suite, test_arguint64_basic_002);
+    SUITE_ADD_TEST(suite, test_arguint64_basic_003);
+    return suite;
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
@@ -0,0 +1,277 @@
+/*******************************************************************************
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CuTest.h"
+#include "argtable3.h"
+#include "argtable3_private.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4204)
+#endif
+
+void test_arglist_basic_001(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        int nvals;
+        int value[4];
+    } cases[] = {
+        {"--x=1", 1, {1}},
+        {"--x=1,2,3", 3, {1, 2, 3}},
+        {"--x=-2147483648,2147483647", 2, {-2147483647 - 1, 2147483647}},
+        {"--x= 0x10 , 0o17,0b101,1KB", 4, {16, 15, 5, 1024}},
+        {"--x=10,20,30,40", 4, {10, 20, 30, 40}},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_intlist* x = arg_intlist1(NULL, "x", NULL, ',', "x is <ints>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+        int j;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, x->count);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].nvals, x->nvals);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, x->first[0]);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].nvals, x->first[1]);
+        for (j = 0; j < cases[i].nvals; j++)
+            CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].value[j], x->ival[j]);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_arglist_basic_002(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        int error;
+    } cases[] = {
+        {"--x=1,,2", ARG_ERR_BADINT},
+        {"--x=1,2,", ARG_ERR_BADINT},
+        {",1", ARG_ERR_BADINT},
+        {"--x=1,x", ARG_ERR_BADINT},
+        {"--x=1;2", ARG_ERR_BADINT},
+        {"--x=1,2147483648", ARG_ERR_OVERFLOW},
+        {"--x=-2147483649", ARG_ERR_OVERFLOW},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_intlist* x = arg_intlist0(NULL, "x", NULL, ',', "x is <ints>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        /* ",1" is a value for --x in the next argument */
+        argv[1] = (char*)cases[i].arg;
+        if (cases[i].arg[0] == ',') {
+            char* argv2[] = {"program", "--x", NULL, NULL};
+            argv2[2] = (char*)cases[i].arg;
+            nerrors = arg_parse(3, argv2, argtable);
+        } else {
+            nerrors = arg_parse(2, argv, argtable);
+        }
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, x->count);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, x->nvals);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].error, end->error[0]);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_arglist_basic_003(CuTest* tc) {
+    struct arg_intlist* a = arg_intlistn("a", NULL, "<ids>", ':', 0, 3, "a list");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[] = {"program", "-a", "1:2", "-a5", "-a", "7:8:9", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    arg_dstr_t ds = arg_dstr_create();
+    int nerrors;
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 3, a->count);
+    CuAssertIntEquals(tc, 6, a->nvals);
+    CuAssertIntEquals(tc, 0, a->first[0]);
+    CuAssertIntEquals(tc, 2, a->first[1]);
+    CuAssertIntEquals(tc, 3, a->first[2]);
+    CuAssertIntEquals(tc, 6, a->first[3]);
+    CuAssertIntEquals(tc, 2, a->ival[1]);
+    CuAssertIntEquals(tc, 5, a->ival[2]);
+    CuAssertIntEquals(tc, 9, a->ival[5]);
+
+    /* a bad element rejects its whole occurrence but keeps the earlier ones */
+    argv[4] = "-a";
+    argv[5] = "7:x:9";
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 1, nerrors);
+    CuAssertIntEquals(tc, 2, a->count);
+    CuAssertIntEquals(tc, 3, a->nvals);
+    CuAssertIntEquals(tc, 3, a->first[2]);
+
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc, "program: invalid argument \"7:x:9\" to option -a <ids>\n", arg_dstr_cstr(ds));
+
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_arglist_basic_004(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        int nvals;
+        double value[3];
+        int error;
+    } cases[] = {
+        {"--x=1.5", 1, {1.5}, 0},
+        {"--x=0.25,-2,1e3", 3, {0.25, -2.0, 1000.0}, 0},
+        {"--x=.5, 1.", 2, {0.5, 1.0}, 0},
+        {"--x=1.5,,2", 0, {0}, ARG_ERR_BADDOUBLE},
+        {"--x=1.5,2,", 0, {0}, ARG_ERR_BADDOUBLE},
+        {"--x=1,5x", 0, {0}, ARG_ERR_BADDOUBLE},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_dbllist* x = arg_dbllist0(NULL, "x", NULL, '\0', "x is <doubles>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+        int j;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].error ? 1 : 0, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].nvals, x->nvals);
+        if (cases[i].error)
+            CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].error, end->error[0]);
+        for (j = 0; j < cases[i].nvals; j++)
+            CuAssertDblEquals_Msg(tc, cases[i].arg, cases[i].value[j], x->dval[j], 0);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_arglist_basic_005(CuTest* tc) {
+    struct arg_strlist* a = arg_strlist1(NULL, "tags", NULL, ',', "tags to apply");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[] = {"program", "--tags=red,,green-and-blue,", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    int nerrors;
+
+    CuAssertStrEquals(tc, "<strings>", a->hdr.datatype);
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 1, a->count);
+    CuAssertIntEquals(tc, 4, a->nvals);
+
+    /* the slices point into argv itself */
+    CuAssertPtrEquals(tc, argv[1] + 7, (void*)a->sval[0].ptr);
+    CuAssertIntEquals(tc, 3, (int)a->sval[0].len);
+    CuAssertIntEquals(tc, 0, (int)a->sval[1].len);
+    CuAssertIntEquals(tc, 0, strncmp(a->sval[2].ptr, "green-and-blue", a->sval[2].len));
+    CuAssertIntEquals(tc, 14, (int)a->sval[2].len);
+    CuAssertIntEquals(tc, 0, (int)a->sval[3].len);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_arglist_basic_006(CuTest* tc) {
+    struct arg_intlist* a = arg_intlist1(NULL, "ids", NULL, ',', "job identifiers");
+    struct arg_strlist* b = arg_strlist0(NULL, "names", NULL, '/', "names");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, end};
+    char* argv[] = {"program", NULL, NULL, NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    char* ids = (char*)malloc(20000 * 8 + 8);
+    char* names = (char*)malloc(20000 * 8 + 16);
+    char* ptr;
+    int nerrors;
+    int i;
+
+    /* long lists exercise the word-at-a-time scan and the element array growth */
+    ptr = ids + sprintf(ids, "--ids=");
+    for (i = 0; i < 20000; i++)
+        ptr += sprintf(ptr, i ? ",%d" : "%d", i * 7 - 1000);
+    ptr = names + sprintf(names, "--names=");
+    for (i = 0; i < 20000; i++)
+        ptr += sprintf(ptr, i ? "/%d" : "%d", i % 1000000);
+    argv[1] = ids;
+    argv[2] = names;
+
+    /* parse twice to check that the arrays are reused */
+    for (i = 0; i < 2; i++) {
+        nerrors = arg_parse(argc, argv, argtable);
+        CuAssertIntEquals(tc, 0, nerrors);
+        CuAssertIntEquals(tc, 20000, a->nvals);
+        CuAssertIntEquals(tc, -1000, a->ival[0]);
+        CuAssertIntEquals(tc, 12345 * 7 - 1000, a->ival[12345]);
+        CuAssertIntEquals(tc, 19999 * 7 - 1000, a->ival[19999]);
+        CuAssertIntEquals(tc, 20000, b->nvals);
+        CuAssertIntEquals(tc, 5, (int)b->sval[12345].len);
+        CuAssertIntEquals(tc, 0, strncmp(b->sval[12345].ptr, "12345/", 6));
+    }
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    free(ids);
+    free(names);
+}
+
+CuSuite* get_arglist_testsuite() {
+    CuSuite* suite = CuSuiteNew();
+    SUITE_ADD_TEST(suite, test_arglist_basic_001);
+    SUITE_ADD_TEST(suite, test_arglist_basic_002);
+    SUITE_ADD_TEST(suite, test_arglist_basic_003);
+    SUITE_ADD_TEST(suite, test_arglist_basic_004);
+    SUITE_ADD_TEST(suite, test_arglist_basic_005);
+    SUITE_ADD_TEST(suite, test_arglist_basic_006);
+    return suite;
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
@@ -48,7 +48,7 @@ int main(int argc, char* argv[]) {
     arg_cmd_init();
     arg_cmd_register(cmdhelp_name(), cmdhelp_proc, cmdhelp_description(), NULL);
     arg_cmd_register(cmdversion_name(), cmdversion_proc, cmdversion_description(), NULL);
-    arg_cmd_register(cmdlist_name(), cmdlist_proc, cmdlist_description(), NULL);
+    arg_cmd_register_table(cmdlist_name(), cmdlist_proc, cmdlist_table, cmdlist_description(), NULL);
 
     arg_dstr_t res = arg_dstr_create();
     if (argc == 1) {
@@ -62,6 +62,8 @@ int cmdhelp_proc(int argc, char* argv[], arg_dstr_t res, void* ctx) {
     void* argtable[] = {cmd, cmd_name, help, end};
 
     int exitcode = APP_OK;
+
+    (void)ctx;
     if (arg_nullcheck(argtable) != 0) {
         fprintf(stderr, "failed to allocate argtable\n");
         exitcode = APP_ERR_OUTOFMEMORY;
@@ -123,7 +125,7 @@ int cmdhelp_proc(int argc, char* argv[], arg_dstr_t res, void* ctx) {
         arg_cmd_info_t* cmd_info = arg_cmd_info(cmd_name->sval[0]);
         int tmp_argc = 3;
         char* tmp_argv[] = {APP_NAME, cmd_info->name, "--help"};
-        cmd_info->proc(tmp_argc, tmp_argv, res, ctx);
+        cmd_info->proc(tmp_argc, tmp_argv, res, cmd_info->ctx);
     }
 
 exit:
@@ -33,6 +33,8 @@
 #include "app.h"
 #include "argtable3.h"
 
+#include <stdlib.h>
+
 const char* cmdlist_name() {
     static char name[] = "list";
     return name;
@@ -43,45 +45,58 @@ const char* cmdlist_description() {
     return description;
 }
 
-int cmdlist_proc(int argc, char* argv[], arg_dstr_t res, void* ctx) {
-    arg_str_t* cmd = arg_str1(NULL, NULL, cmdlist_name(), NULL);
-    arg_int_t* intopt = arg_int0("i", "intopt", "<n>", "an integer option");
-    arg_str_t* stropt = arg_str0("s", "stropt", "<s>", "a string option");
-    arg_dbl_t* dblopt = arg_dbl0("d", "dblopt", "<f>", "a double option");
-    arg_lit_t* boolopt = arg_lit0("b", "boolopt", "a boolean option");
-    arg_file_t* fileopt = arg_file0("f", "fileopt", "<file>", "a file option");
-    arg_lit_t* help = arg_lit0("h", "help", "output usage information");
-    arg_end_t* end = arg_end(20);
-    void* argtable[] = {cmd, intopt, stropt, dblopt, boolopt, fileopt, help, end};
+enum { LIST_CMD, LIST_INTOPT, LIST_STROPT, LIST_DBLOPT, LIST_BOOLOPT, LIST_FILEOPT, LIST_HELP, LIST_END, LIST_NARGS };
 
-    int exitcode = APP_OK;
-    if (arg_nullcheck(argtable) != 0) {
-        fprintf(stderr, "failed to allocate argtable\n");
-        exitcode = APP_ERR_OUTOFMEMORY;
-        goto exit;
+void** cmdlist_table(void* ctx) {
+    void** argtable = malloc(LIST_NARGS * sizeof(void*));
+
+    (void)ctx;
+    if (argtable == NULL) {
+        return NULL;
     }
 
-    intopt->ival[0] = 42;                  /* Default value for integer option */
-    stropt->sval[0] = "default";           /* Default value for string option */
-    dblopt->dval[0] = 3.14;                /* Default value for double option */
-    fileopt->filename[0] = "default.txt";  /* Default value for file option */
+    argtable[LIST_CMD] = arg_str1(NULL, NULL, cmdlist_name(), NULL);
+    argtable[LIST_INTOPT] = arg_int0("i", "intopt", "<n>", "an integer option");
+    argtable[LIST_STROPT] = arg_str0("s", "stropt", "<s>", "a string option");
+    argtable[LIST_DBLOPT] = arg_dbl0("d", "dblopt", "<f>", "a double option");
+    argtable[LIST_BOOLOPT] = arg_lit0("b", "boolopt", "a boolean option");
+    argtable[LIST_FILEOPT] = arg_file0("f", "fileopt", "<file>", "a file option");
+    argtable[LIST_HELP] = arg_lit0("h", "help", "output usage information");
+    argtable[LIST_END] = arg_end(20);
+    return argtable;
+}
 
-    int nerrors = arg_parse(argc, argv, argtable);
+int cmdlist_proc(int argc, char* argv[], void** argtable, int nerrors, arg_dstr_t res, void* ctx) {
+    arg_int_t* intopt = argtable[LIST_INTOPT];
+    arg_str_t* stropt = argtable[LIST_STROPT];
+    arg_dbl_t* dblopt = argtable[LIST_DBLOPT];
+    arg_lit_t* boolopt = argtable[LIST_BOOLOPT];
+    arg_file_t* fileopt = argtable[LIST_FILEOPT];
+    arg_lit_t* help = argtable[LIST_HELP];
+    arg_end_t* end = argtable[LIST_END];
+
+    (void)argc;
+    (void)argv;
+    (void)ctx;
+
+    /*
+     * The registry builds the argtable once and reuses it for every dispatch,
+     * so default values are applied here rather than stored in the table.
+     */
+    int exitcode = APP_OK;
     if (arg_make_syntax_err_help_msg(res, cmdlist_name(), help->count, nerrors, argtable, end, &exitcode)) {
-        goto exit;
+        return exitcode;
     }
 
     /****************************************************************************/
     /* process the command                                                      */
     /****************************************************************************/
 
-    arg_dstr_catf(res, "intopt = %d\n", intopt->ival[0]);
-    arg_dstr_catf(res, "stropt = %s\n", stropt->sval[0]);
-    arg_dstr_catf(res, "dblopt = %.2f\n", dblopt->dval[0]);
+    arg_dstr_catf(res, "intopt = %d\n", intopt->count > 0 ? intopt->ival[0] : 42);
+    arg_dstr_catf(res, "stropt = %s\n", stropt->count > 0 ? stropt->sval[0] : "default");
+    arg_dstr_catf(res, "dblopt = %.2f\n", dblopt->count > 0 ? dblopt->dval[0] : 3.14);
     arg_dstr_catf(res, "boolopt = %s\n", boolopt->count > 0 ? "true" : "false");
     arg_dstr_catf(res, "fileopt = %s\n", fileopt->count > 0 ? fileopt->filename[0] : "no file");
 
-exit:
-    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
     return exitcode;
 }
@@ -35,6 +35,7 @@
 
 const char* cmdlist_name();
 const char* cmdlist_description();
-int cmdlist_proc(int argc, char* argv[], arg_dstr_t res, void* ctx);
+void** cmdlist_table(void* ctx);
+int cmdlist_proc(int argc, char* argv[], void** argtable, int nerrors, arg_dstr_t res, void* ctx);
 
 #endif  // #ifndef CMDLIST_H_60753EEF_6B02_4514_BF13_59B4C923AB5A_INCLUDED
@@ -50,6 +50,8 @@ int cmdversion_proc(int argc, char* argv[], arg_dstr_t res, void* ctx) {
     void* argtable[] = {cmd, help, end};
 
     int exitcode = APP_OK;
+
+    (void)ctx;
     if (arg_nullcheck(argtable) != 0) {
         fprintf(stderr, "failed to allocate argtable\n");
         exitcode = APP_ERR_OUTOFMEMORY;
@@ -43,6 +43,9 @@
 #define MAX_MODULE_VERSION_SIZE 128
 
 static arg_hashtable_t* s_hashtable = NULL;
+static arg_tpool_t* s_cmd_pool = NULL;
+static unsigned int s_cmd_pool_gen = 0;
+static int s_cmd_workers = -1;
 static char* s_module_name = NULL;
 static int s_mod_ver_major = 0;
 static int s_mod_ver_minor = 0;
@@ -121,27 +124,203 @@ static int equal_keys(const void* key1, const void* key2) {
     return (0 == strcmp(k1, k2));
 }
 
+#if ARG_CMD_COMPACT
+/*
+ * In compact mode the names and descriptions of all sub-commands live in a
+ * string arena: a chain of large blocks that are neither moved nor freed before
+ * arg_cmd_uninit(). Strings are interned through an open-addressing set of
+ * pointers into the arena, so each distinct string is stored once and the keys
+ * of s_hashtable point straight into the arena.
+ */
+#define ARG_CMD_ARENA_BLOCK_SIZE 16384
+
+struct arg_cmd_arena_block {
+    struct arg_cmd_arena_block* next;
+    size_t used;
+    size_t size;
+};
+
+static struct arg_cmd_arena_block* s_arena = NULL;
+static const char** s_intern = NULL;
+static size_t s_intern_size = 0;
+static size_t s_intern_count = 0;
+
+static char* arg_cmd_arena_alloc(size_t len) {
+    struct arg_cmd_arena_block* block = s_arena;
+    char* p;
+
+    if (block == NULL || block->size - block->used < len) {
+        size_t size = len > ARG_CMD_ARENA_BLOCK_SIZE ? len : ARG_CMD_ARENA_BLOCK_SIZE;
+
+        block = (struct arg_cmd_arena_block*)xmalloc(sizeof(struct arg_cmd_arena_block) + size);
+        block->used = 0;
+        block->size = size;
+        if (s_arena && size == len) {
+            /* an oversized string gets its own block; keep filling the current one */
+            block->next = s_arena->next;
+            s_arena->next = block;
+        } else {
+            block->next = s_arena;
+            s_arena = block;
+        }
+    }
+
+    p = (char*)(block + 1) + block->used;
+    block->used += len;
+    return p;
+}
+
+static void arg_cmd_intern_insert(const char** table, size_t size, const char* str) {
+    size_t i = (size_t)hash_key(str) & (size - 1);
+
+    while (table[i])
+        i = (i + 1) & (size - 1);
+    table[i] = str;
+}
+
+static const char* arg_cmd_intern(const char* str) {
+    size_t len;
+    size_t i;
+    char* p;
+
+    /* keep the load factor at or below 1/2 */
+    if (2 * (s_intern_count + 1) > s_intern_size) {
+        size_t size = s_intern_size ? 2 * s_intern_size : 64;
+        const char** table = (const char**)xcalloc(size, sizeof(const char*));
+
+        for (i = 0; i < s_intern_size; i++) {
+            if (s_intern[i])
+                arg_cmd_intern_insert(table, size, s_intern[i]);
+        }
+        xfree((void*)s_intern);
+        s_intern = table;
+        s_intern_size = size;
+    }
+
+    for (i = (size_t)hash_key(str) & (s_intern_size - 1); s_intern[i]; i = (i + 1) & (s_intern_size - 1)) {
+        if (strcmp(s_intern[i], str) == 0)
+            return s_intern[i];
+    }
+
+    len = strlen(str);
+    p = arg_cmd_arena_alloc(len + 1);
+    memcpy(p, str, len + 1);
+    s_intern[i] = p;
+    s_intern_count++;
+    return p;
+}
+
+static void arg_cmd_intern_free(void) {
+    while (s_arena) {
+        struct arg_cmd_arena_block* next = s_arena->next;
+        xfree(s_arena);
+        s_arena = next;
+    }
+    xfree((void*)s_intern);
+    s_intern = NULL;
+    s_intern_size = 0;
+    s_intern_count = 0;
+}
+#endif
+
+/*
+ * State of a command registered with arg_cmd_register_table(), kept in both
+ * arg_cmd_info_t.priv and arg_cmd_info_t.ctx so that calling the trampoline in
+ * arg_cmd_info_t.proc with arg_cmd_info_t.ctx runs the command. The registry
+ * holds one reference, and every dispatch holds another while it is queued or
+ * running, so replacing or removing the command does not free the state under
+ * a dispatch.
+ */
+struct arg_cmd_table {
+    arg_cmdtablefn proc;
+    arg_cmdfactoryfn factory;
+    void* ctx;       /* user context passed to proc and factory */
+    void** argtable; /* built on first dispatch, then reused */
+    int busy;        /* argtable is being used by a dispatch */
+    int refs;
+};
+
+static void arg_cmd_argtable_free(void** argtable) {
+    if (argtable == NULL)
+        return;
+
+    arg_free(argtable);
+    free(argtable);
+}
+
+static struct arg_cmd_table* arg_cmd_table_retain(struct arg_cmd_table* table) {
+    if (table) {
+        arg_global_lock();
+        table->refs++;
+        arg_global_unlock();
+    }
+    return table;
+}
+
+static void arg_cmd_table_release(struct arg_cmd_table* table) {
+    int refs;
+
+    if (table == NULL)
+        return;
+
+    arg_global_lock();
+    refs = --table->refs;
+    arg_global_unlock();
+
+    if (refs == 0) {
+        arg_cmd_argtable_free(table->argtable);
+        xfree(table);
+    }
+}
+
+static void arg_cmd_table_free(arg_cmd_info_t* cmd_info) {
+    arg_cmd_table_release((struct arg_cmd_table*)cmd_info->priv);
+    cmd_info->priv = NULL;
+}
+
 void arg_cmd_init(void) {
     s_hashtable = arg_hashtable_create(32, hash_key, equal_keys);
+#if ARG_CMD_COMPACT
+    /* the keys are the interned names */
+    s_hashtable->freekeys = 0;
+#endif
 }
 
 void arg_cmd_uninit(void) {
+    arg_tpool_destroy(s_cmd_pool);
+    s_cmd_pool = NULL;
+    s_cmd_pool_gen++;
+    if (s_hashtable && arg_hashtable_count(s_hashtable) > 0) {
+        arg_hashtable_itr_t* itr = arg_hashtable_itr_create(s_hashtable);
+        do {
+            arg_cmd_table_free((arg_cmd_info_t*)arg_hashtable_itr_value(itr));
+        } while (arg_hashtable_itr_advance(itr));
+        arg_hashtable_itr_destroy(itr);
+    }
     arg_hashtable_destroy(s_hashtable, 1);
+    s_hashtable = NULL;
+#if ARG_CMD_COMPACT
+    arg_cmd_intern_free();
+#endif
 }
 
-void arg_cmd_register(const char* name, arg_cmdfn proc, const char* description, void* ctx) {
+/* Add a command, or replace the command of the same name, and return its info */
+static arg_cmd_info_t* arg_cmd_insert(const char* name, const char* description, void* ctx) {
     arg_cmd_info_t* cmd_info;
+#if !ARG_CMD_COMPACT
     size_t slen_name;
     void* k;
 
     assert(strlen(name) < ARG_CMD_NAME_LEN);
     assert(strlen(description) < ARG_CMD_DESCRIPTION_LEN);
+#endif
 
     /* Check if the command already exists. */
     /* If the command exists, replace the existing command. */
     /* If the command doesn't exist, insert the command. */
     cmd_info = (arg_cmd_info_t*)arg_hashtable_search(s_hashtable, name);
     if (cmd_info) {
+        arg_cmd_table_free(cmd_info);
         arg_hashtable_remove(s_hashtable, name);
         cmd_info = NULL;
     }
@@ -149,6 +328,13 @@ void arg_cmd_register(const char* name, arg_cmdfn proc, const char* description,
     cmd_info = (arg_cmd_info_t*)xmalloc(sizeof(arg_cmd_info_t));
     memset(cmd_info, 0, sizeof(arg_cmd_info_t));
 
+#if ARG_CMD_COMPACT
+    cmd_info->name = arg_cmd_intern(name);
+    cmd_info->description = arg_cmd_intern(description);
+    cmd_info->ctx = ctx;
+
+    arg_hashtable_insert(s_hashtable, (void*)cmd_info->name, cmd_info);
+#else
 #if (defined(__STDC_LIB_EXT1__) && defined(__STDC_WANT_LIB_EXT1__)) || (defined(__STDC_SECURE_LIB__) && defined(__STDC_WANT_SECURE_LIB__))
     strncpy_s(cmd_info->name, ARG_CMD_NAME_LEN, name, strlen(name));
     strncpy_s(cmd_info->description, ARG_CMD_DESCRIPTION_LEN, description, strlen(description));
@@ -157,7 +343,6 @@ void arg_cmd_register(const char* name, arg_cmdfn proc, const char* description,
     memcpy(cmd_info->description, description, strlen(description));
 #endif
 
-    cmd_info->proc = proc;
     cmd_info->ctx = ctx;
 
     slen_name = strlen(name);
@@ -171,9 +356,91 @@ void arg_cmd_register(const char* name, arg_cmdfn proc, const char* description,
 #endif
 
     arg_hashtable_insert(s_hashtable, k, cmd_info);
+#endif
+    return cmd_info;
+}
+
+/*
+ * The handler of table-driven commands. It parses into the cached argtable,
+ * which is built by the factory on first use. A dispatch that finds the cached
+ * table in use by another thread (or by a nested dispatch of the same command)
+ * gets a temporary table instead.
+ */
+static int arg_cmd_table_proc(int argc, char* argv[], arg_dstr_t res, void* ctx) {
+    struct arg_cmd_table* table = arg_cmd_table_retain((struct arg_cmd_table*)ctx);
+    void** argtable = NULL;
+    int cached = 0;
+    int nerrors;
+    int ret;
+
+    arg_global_lock();
+    if (!table->busy) {
+        table->busy = 1;
+        argtable = table->argtable;
+        cached = 1;
+    }
+    arg_global_unlock();
+
+    if (argtable == NULL) {
+        argtable = table->factory(table->ctx);
+        if (argtable == NULL || arg_nullcheck(argtable) != 0) {
+            arg_cmd_argtable_free(argtable);
+            argtable = NULL;
+        }
+    }
+
+    if (argtable) {
+        /* arg_parse() resets the table before parsing */
+        nerrors = arg_parse(argc, argv, argtable);
+        ret = table->proc(argc, argv, argtable, nerrors, res, table->ctx);
+    } else {
+        arg_dstr_cat(res, "failed to allocate argtable\n");
+        ret = -1;
+    }
+
+    if (cached) {
+        arg_global_lock();
+        table->argtable = argtable;
+        table->busy = 0;
+        arg_global_unlock();
+    } else {
+        arg_cmd_argtable_free(argtable);
+    }
+
+    arg_cmd_table_release(table);
+    return ret;
+}
+
+void arg_cmd_register(const char* name, arg_cmdfn proc, const char* description, void* ctx) {
+    arg_cmd_info_t* cmd_info = arg_cmd_insert(name, description, ctx);
+    cmd_info->proc = proc;
+}
+
+void arg_cmd_register_table(const char* name, arg_cmdtablefn proc, arg_cmdfactoryfn factory, const char* description, void* ctx) {
+    arg_cmd_info_t* cmd_info;
+    struct arg_cmd_table* table;
+
+    assert(proc != NULL);
+    assert(factory != NULL);
+
+    table = (struct arg_cmd_table*)xmalloc(sizeof(struct arg_cmd_table));
+    table->proc = proc;
+    table->factory = factory;
+    table->ctx = ctx;
+    table->argtable = NULL;
+    table->busy = 0;
+    table->refs = 1;
+
+    cmd_info = arg_cmd_insert(name, description, table);
+    cmd_info->proc = arg_cmd_table_proc;
+    cmd_info->priv = table;
 }
 
 void arg_cmd_unregister(const char* name) {
+    arg_cmd_info_t* cmd_info = arg_cmd_info(name);
+
+    if (cmd_info)
+        arg_cmd_table_free(cmd_info);
     arg_hashtable_remove(s_hashtable, name);
 }
 
@@ -186,12 +453,292 @@ int arg_cmd_dispatch(const char* name, int argc, char* argv[], arg_dstr_t res) {
     return cmd_info->proc(argc, argv, res, cmd_info->ctx);
 }
 
+/*
+ * Queued work copies the handler and context out of the registry, which may
+ * replace or remove the command before the work runs, and keeps the state of
+ * a table-driven command alive until it has run.
+ */
+struct _internal_arg_cmd_job {
+    arg_task_t task;
+    unsigned int pool_gen;
+    arg_cmdfn proc;
+    void* ctx;
+    struct arg_cmd_table* table;
+    int argc;
+    char** argv;
+    arg_dstr_t res;
+    int ret;
+};
+
+static void arg_cmd_job_run(void* arg) {
+    struct _internal_arg_cmd_job* job = (struct _internal_arg_cmd_job*)arg;
+    job->ret = job->proc(job->argc, job->argv, job->res, job->ctx);
+    arg_cmd_table_release(job->table);
+    job->table = NULL;
+}
+
+void arg_cmd_set_workers(int nworkers) {
+    /* finish the work queued on the old pool before resizing */
+    arg_tpool_destroy(s_cmd_pool);
+    s_cmd_pool = NULL;
+    s_cmd_pool_gen++;
+    s_cmd_workers = nworkers;
+}
+
+/* Return the worker pool, starting it on first use. */
+static arg_tpool_t* arg_cmd_pool(void) {
+    if (s_cmd_pool == NULL)
+        s_cmd_pool = arg_tpool_create(s_cmd_workers < 0 ? arg_thread_ncpu() : s_cmd_workers);
+    return s_cmd_pool;
+}
+
+/* Wait for a job. Jobs of a pool that has since been destroyed have already run. */
+static void arg_cmd_job_join(arg_cmd_job_t job) {
+    if (job->pool_gen == s_cmd_pool_gen)
+        arg_tpool_join(s_cmd_pool, &job->task);
+}
+
+arg_cmd_job_t arg_cmd_dispatch_async(const char* name, int argc, char* argv[]) {
+    arg_cmd_info_t* cmd_info = arg_cmd_info(name);
+    struct _internal_arg_cmd_job* job;
+
+    assert(cmd_info != NULL);
+    assert(cmd_info->proc != NULL);
+
+    job = (struct _internal_arg_cmd_job*)xmalloc(sizeof(struct _internal_arg_cmd_job));
+    job->proc = cmd_info->proc;
+    job->ctx = cmd_info->ctx;
+    job->table = arg_cmd_table_retain((struct arg_cmd_table*)cmd_info->priv);
+    job->argc = argc;
+    job->argv = argv;
+    job->res = arg_dstr_create();
+    job->ret = 0;
+    job->pool_gen = s_cmd_pool_gen;
+
+    arg_tpool_submit(arg_cmd_pool(), &job->task, arg_cmd_job_run, job);
+    return job;
+}
+
+int arg_cmd_job_poll(arg_cmd_job_t job) {
+    if (job->pool_gen != s_cmd_pool_gen)
+        return 1;
+    return arg_tpool_done(s_cmd_pool, &job->task);
+}
+
+int arg_cmd_job_wait(arg_cmd_job_t job) {
+    arg_cmd_job_join(job);
+    return job->ret;
+}
+
+arg_dstr_t arg_cmd_job_result(arg_cmd_job_t job) {
+    arg_cmd_job_join(job);
+    return job->res;
+}
+
+void arg_cmd_job_destroy(arg_cmd_job_t job) {
+    if (job == NULL)
+        return;
+
+    arg_cmd_job_join(job);
+    arg_dstr_destroy(job->res);
+    xfree(job);
+}
+
+void arg_cmd_set_flags(const char* name, int flags) {
+    arg_cmd_info_t* cmd_info = arg_cmd_info(name);
+
+    assert(cmd_info != NULL);
+    cmd_info->flags = flags;
+}
+
+struct arg_cmd_batch_item {
+    arg_task_t task;
+    arg_cmdfn proc; /* NULL for unknown commands */
+    void* ctx;
+    struct arg_cmd_table* table;
+    arg_cmd_batch_entry_t* entry;
+};
+
+struct _internal_arg_cmd_batch {
+    arg_mmap_t script;
+    char** words;
+    int count;
+    arg_cmd_batch_entry_t* entries;
+    struct arg_cmd_batch_item* items;
+};
+
+static arg_cmd_batch_t arg_cmd_batch_parse(arg_mmap_t* script) {
+    arg_cmd_batch_t batch;
+    arg_scanner_t scanner;
+    char* word;
+    int* first; /* index of each command's first word, later turned into argv pointers */
+    int nwords = 0, maxwords = 64;
+    int maxcount = 16;
+    int i;
+
+    batch = (arg_cmd_batch_t)xmalloc(sizeof(struct _internal_arg_cmd_batch));
+    batch->script = *script;
+    batch->count = 0;
+    batch->words = (char**)xmalloc(sizeof(char*) * (size_t)maxwords);
+    batch->entries = (arg_cmd_batch_entry_t*)xmalloc(sizeof(arg_cmd_batch_entry_t) * (size_t)maxcount);
+    first = (int*)xmalloc(sizeof(int) * (size_t)maxcount);
+
+    /* one pass over the script: each line break that precedes a word starts a new command */
+    arg_scanner_init(&scanner, batch->script.data, batch->script.len, 1);
+    while (arg_scan_word(&scanner, &word)) {
+        /* reserve room for this word and the NULL that terminates its command */
+        if (nwords + 2 > maxwords) {
+            maxwords *= 2;
+            batch->words = (char**)xrealloc(batch->words, sizeof(char*) * (size_t)maxwords);
+        }
+
+        if (scanner.newline) {
+            if (batch->count > 0)
+                batch->words[nwords++] = NULL;
+
+            if (batch->count == maxcount) {
+                maxcount *= 2;
+                batch->entries = (arg_cmd_batch_entry_t*)xrealloc(batch->entries, sizeof(arg_cmd_batch_entry_t) * (size_t)maxcount);
+                first = (int*)xrealloc(first, sizeof(int) * (size_t)maxcount);
+            }
+
+            first[batch->count] = nwords;
+            batch->entries[batch->count].line = scanner.line;
+            batch->entries[batch->count].argc = 0;
+            batch->count++;
+        }
+
+        batch->words[nwords++] = word;
+        batch->entries[batch->count - 1].argc++;
+    }
+    if (batch->count > 0)
+        batch->words[nwords++] = NULL;
+
+    batch->items = (struct arg_cmd_batch_item*)xmalloc(sizeof(struct arg_cmd_batch_item) * (size_t)(batch->count > 0 ? batch->count : 1));
+    for (i = 0; i < batch->count; i++) {
+        arg_cmd_batch_entry_t* entry = &batch->entries[i];
+        entry->argv = batch->words + first[i];
+        entry->ret = 0;
+        entry->res = arg_dstr_create();
+        entry->elapsed = 0;
+        batch->items[i].entry = entry;
+    }
+
+    xfree(first);
+    return batch;
+}
+
+arg_cmd_batch_t arg_cmd_batch_load(const char* path) {
+    arg_mmap_t script;
+
+    if (arg_mmap_open(&script, path) != 0)
+        return NULL;
+
+    return arg_cmd_batch_parse(&script);
+}
+
+arg_cmd_batch_t arg_cmd_batch_create(const char* text, size_t len) {
+    arg_mmap_t script;
+
+    arg_mmap_copy(&script, text, len);
+    return arg_cmd_batch_parse(&script);
+}
+
+static void arg_cmd_batch_item_run(void* arg) {
+    struct arg_cmd_batch_item* item = (struct arg_cmd_batch_item*)arg;
+    arg_cmd_batch_entry_t* entry = item->entry;
+    double start = arg_clock();
+
+    entry->ret = item->proc(entry->argc, entry->argv, entry->res, item->ctx);
+    entry->elapsed = arg_clock() - start;
+    arg_cmd_table_release(item->table);
+    item->table = NULL;
+}
+
+int arg_cmd_batch_run(arg_cmd_batch_t batch) {
+    arg_tpool_t* pool = NULL;
+    int pending = 0; /* first command that may still be running on the pool */
+    int nfailed = 0;
+    int i, j;
+
+    for (i = 0; i < batch->count; i++) {
+        struct arg_cmd_batch_item* item = &batch->items[i];
+        arg_cmd_batch_entry_t* entry = item->entry;
+        arg_cmd_info_t* cmd_info = arg_cmd_info(entry->argv[0]);
+
+        arg_dstr_reset(entry->res);
+        entry->elapsed = 0;
+        item->proc = NULL;
+
+        if (cmd_info == NULL || cmd_info->proc == NULL) {
+            arg_dstr_catf(entry->res, "unknown command \"%s\"\n", entry->argv[0]);
+            entry->ret = -1;
+            continue;
+        }
+
+        item->proc = cmd_info->proc;
+        item->ctx = cmd_info->ctx;
+        item->table = arg_cmd_table_retain((struct arg_cmd_table*)cmd_info->priv);
+
+        if (cmd_info->flags & ARG_CMD_INDEPENDENT) {
+            pool = arg_cmd_pool();
+            arg_tpool_submit(pool, &item->task, arg_cmd_batch_item_run, item);
+            continue;
+        }
+
+        /* a dependent command is a barrier: everything before it has to finish first */
+        for (j = pending; j < i; j++) {
+            if (batch->items[j].proc && pool)
+                arg_tpool_join(pool, &batch->items[j].task);
+        }
+        pending = i + 1;
+        arg_cmd_batch_item_run(item);
+    }
+
+    for (j = pending; j < batch->count; j++) {
+        if (batch->items[j].proc && pool)
+            arg_tpool_join(pool, &batch->items[j].task);
+    }
+
+    for (i = 0; i < batch->count; i++) {
+        if (batch->entries[i].ret != 0)
+            nfailed++;
+    }
+
+    return nfailed;
+}
+
+int arg_cmd_batch_count(arg_cmd_batch_t batch) {
+    return batch->count;
+}
+
+arg_cmd_batch_entry_t* arg_cmd_batch_entry(arg_cmd_batch_t batch, int i) {
+    assert(i >= 0 && i < batch->count);
+    return &batch->entries[i];
+}
+
+void arg_cmd_batch_destroy(arg_cmd_batch_t batch) {
+    int i;
+
+    if (batch == NULL)
+        return;
+
+    for (i = 0; i < batch->count; i++)
+        arg_dstr_destroy(batch->entries[i].res);
+
+    arg_mmap_close(&batch->script);
+    xfree(batch->items);
+    xfree(batch->entries);
+    xfree(batch->words);
+    xfree(batch);
+}
+
 arg_cmd_info_t* arg_cmd_info(const char* name) {
     return (arg_cmd_info_t*)arg_hashtable_search(s_hashtable, name);
 }
 
 unsigned int arg_cmd_count(void) {
-    return arg_hashtable_count(s_hashtable);
+    return s_hashtable ? arg_hashtable_count(s_hashtable) : 0;
 }
 
 arg_cmd_itr_t arg_cmd_itr_create(void) {
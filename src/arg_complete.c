@@ -0,0 +1,462 @@
+/*******************************************************************************
+ * arg_complete: Generates static shell completion scripts
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The generators below only look at the static parts of an argtable: the
+ * option names, the ARG_HASVALUE/ARG_HASOPTVALUE/ARG_HASFILEVALUE flags and
+ * the glossary text. Untagged entries (no short or long options) are
+ * positional arguments; entries without a scanfn, such as arg_rem, are
+ * ignored. Registered sub-commands are completed as the first positional
+ * word, in name order so that the generated script is reproducible.
+ */
+
+struct arg_complete_ctx {
+    struct arg_hdr** table;
+    arg_cmd_info_t** cmds;
+    unsigned int ncmds;
+    int posfile; /* positional words name files */
+    const char* progname;
+    char* fname; /* progname mangled into a shell function name */
+};
+
+static int arg_complete_isopt(const struct arg_hdr* hdr) {
+    return (hdr->shortopts && *hdr->shortopts) || (hdr->longopts && *hdr->longopts);
+}
+
+/* Returns the length of the long option name starting at p */
+static size_t arg_complete_optlen(const char* p) {
+    const char* q = strchr(p, ',');
+    return q ? (size_t)(q - p) : strlen(p);
+}
+
+/*
+ * Appends len bytes of src for use inside a single-quoted word. Quotes are
+ * written as '\'' unless bsquote is set, in which case quotes and backslashes
+ * are backslash-escaped as fish requires. Characters listed in special are
+ * always prefixed with a backslash, and control characters become spaces so
+ * that a multi-line glossary cannot break the script.
+ */
+static void arg_complete_catq(arg_dstr_t ds, const char* src, size_t len, int bsquote, const char* special) {
+    size_t i;
+
+    for (i = 0; i < len && src[i]; i++) {
+        char c = src[i];
+        if ((unsigned char)c < 0x20 || c == 0x7f) {
+            arg_dstr_catc(ds, ' ');
+        } else if ((bsquote && (c == '\\' || c == '\'')) || (special && strchr(special, c))) {
+            arg_dstr_catc(ds, '\\');
+            arg_dstr_catc(ds, c);
+        } else if (c == '\'') {
+            arg_dstr_cat(ds, "'\\''");
+        } else {
+            arg_dstr_catc(ds, c);
+        }
+    }
+}
+
+static int arg_complete_cmdcmp(const void* a, const void* b) {
+    const arg_cmd_info_t* x = *(arg_cmd_info_t* const*)a;
+    const arg_cmd_info_t* y = *(arg_cmd_info_t* const*)b;
+    return strcmp(x->name, y->name);
+}
+
+static void arg_complete_init(struct arg_complete_ctx* ctx, void** argtable, const char* progname) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    size_t i;
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->table = table;
+    ctx->progname = progname;
+
+    if (table) {
+        int tabindex;
+        for (tabindex = 0; !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+            if (table[tabindex]->scanfn && !arg_complete_isopt(table[tabindex]) && (table[tabindex]->flag & ARG_HASFILEVALUE))
+                ctx->posfile = 1;
+        }
+    }
+
+    ctx->ncmds = arg_cmd_count();
+    if (ctx->ncmds > 0) {
+        arg_cmd_itr_t itr = arg_cmd_itr_create();
+        unsigned int n = 0;
+
+        ctx->cmds = (arg_cmd_info_t**)xmalloc(sizeof(arg_cmd_info_t*) * ctx->ncmds);
+        do {
+            ctx->cmds[n++] = arg_cmd_itr_value(itr);
+        } while (n < ctx->ncmds && arg_cmd_itr_advance(itr));
+        arg_cmd_itr_destroy(itr);
+        ctx->ncmds = n;
+        qsort(ctx->cmds, ctx->ncmds, sizeof(arg_cmd_info_t*), arg_complete_cmdcmp);
+    }
+
+    ctx->fname = (char*)xmalloc(strlen(progname) + 2);
+    ctx->fname[0] = '_';
+    for (i = 0; progname[i]; i++) {
+        char c = progname[i];
+        int alnum = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+        ctx->fname[i + 1] = alnum ? c : '_';
+    }
+    ctx->fname[i + 1] = '\0';
+}
+
+static void arg_complete_free(struct arg_complete_ctx* ctx) {
+    xfree(ctx->cmds);
+    xfree(ctx->fname);
+}
+
+/* Appends the option names of hdr as a bash case pattern, eg -o|--output */
+static void arg_complete_bash_pattern(arg_dstr_t ds, const struct arg_hdr* hdr) {
+    const char* p;
+    int first = 1;
+
+    for (p = hdr->shortopts; p && *p; p++) {
+        arg_dstr_cat(ds, first ? "" : "|");
+        arg_dstr_catc(ds, '-');
+        arg_complete_catq(ds, p, 1, 0, "|*?[]()$`'\"\\ ");
+        first = 0;
+    }
+    for (p = hdr->longopts; p && *p;) {
+        size_t len = arg_complete_optlen(p);
+        arg_dstr_cat(ds, first ? "--" : "|--");
+        arg_complete_catq(ds, p, len, 0, "|*?[]()$`'\"\\ ");
+        first = 0;
+        p += len;
+        if (*p == ',')
+            p++;
+    }
+}
+
+static void arg_complete_bash_files(arg_dstr_t ds, const char* indent) {
+    arg_dstr_catf(ds, "%slocal IFS=$'\\n'\n", indent);
+    arg_dstr_catf(ds, "%scompopt -o filenames 2>/dev/null\n", indent);
+    arg_dstr_catf(ds, "%sCOMPREPLY=( $(compgen -f -- \"$cur\") )\n", indent);
+}
+
+static void arg_complete_bash(arg_dstr_t ds, struct arg_complete_ctx* ctx) {
+    struct arg_hdr** table = ctx->table;
+    int tabindex;
+    unsigned int i;
+
+    arg_dstr_catf(ds, "# bash completion for %s\n", ctx->progname);
+    arg_dstr_cat(ds, "# generated by argtable3; do not edit\n\n");
+    arg_dstr_catf(ds, "%s()\n{\n", ctx->fname);
+    arg_dstr_cat(ds, "    local cur prev eq= cmd= i\n");
+    arg_dstr_cat(ds, "    COMPREPLY=()\n");
+    arg_dstr_cat(ds, "    cur=\"${COMP_WORDS[COMP_CWORD]}\"\n");
+    arg_dstr_cat(ds, "    prev=\"${COMP_WORDS[COMP_CWORD-1]}\"\n");
+    arg_dstr_cat(ds, "    if [ \"$cur\" = \"=\" ]; then\n");
+    arg_dstr_cat(ds, "        cur=\n");
+    arg_dstr_cat(ds, "        eq=1\n");
+    arg_dstr_cat(ds, "    elif [ \"$prev\" = \"=\" ] && [ \"$COMP_CWORD\" -gt 1 ]; then\n");
+    arg_dstr_cat(ds, "        prev=\"${COMP_WORDS[COMP_CWORD-2]}\"\n");
+    arg_dstr_cat(ds, "        eq=1\n");
+    arg_dstr_cat(ds, "    fi\n\n");
+
+    /* values of options */
+    arg_dstr_cat(ds, "    case \"$prev\" in\n");
+    for (tabindex = 0; table && !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        struct arg_hdr* hdr = table[tabindex];
+        const char* indent = "            ";
+
+        if (!hdr->scanfn || !arg_complete_isopt(hdr) || !(hdr->flag & (ARG_HASVALUE | ARG_HASOPTVALUE)))
+            continue;
+
+        arg_dstr_cat(ds, "        ");
+        arg_complete_bash_pattern(ds, hdr);
+        arg_dstr_cat(ds, ")\n");
+        if (hdr->flag & ARG_HASOPTVALUE) {
+            /* an optional value must be attached with '=' */
+            arg_dstr_cat(ds, "            if [ -n \"$eq\" ]; then\n");
+            indent = "                ";
+        }
+        if (hdr->flag & ARG_HASFILEVALUE)
+            arg_complete_bash_files(ds, indent);
+        arg_dstr_catf(ds, "%sreturn 0\n", indent);
+        if (hdr->flag & ARG_HASOPTVALUE)
+            arg_dstr_cat(ds, "            fi\n");
+        arg_dstr_cat(ds, "            ;;\n");
+    }
+    arg_dstr_cat(ds, "    esac\n\n");
+
+    /* option names */
+    arg_dstr_cat(ds, "    case \"$cur\" in\n");
+    arg_dstr_cat(ds, "        -*)\n");
+    arg_dstr_cat(ds, "            COMPREPLY=( $(compgen -W '");
+    for (tabindex = 0; table && !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        struct arg_hdr* hdr = table[tabindex];
+        const char* p;
+
+        if (!hdr->scanfn)
+            continue;
+        for (p = hdr->shortopts; p && *p; p++) {
+            arg_dstr_cat(ds, " -");
+            arg_complete_catq(ds, p, 1, 0, NULL);
+        }
+        for (p = hdr->longopts; p && *p;) {
+            size_t len = arg_complete_optlen(p);
+            arg_dstr_cat(ds, " --");
+            arg_complete_catq(ds, p, len, 0, NULL);
+            p += len;
+            if (*p == ',')
+                p++;
+        }
+    }
+    arg_dstr_cat(ds, "' -- \"$cur\") )\n");
+    arg_dstr_cat(ds, "            return 0\n");
+    arg_dstr_cat(ds, "            ;;\n");
+    arg_dstr_cat(ds, "    esac\n");
+
+    /* sub-command names */
+    if (ctx->ncmds > 0) {
+        arg_dstr_cat(ds, "\n    for ((i = 1; i < COMP_CWORD; i++)); do\n");
+        arg_dstr_cat(ds, "        case \"${COMP_WORDS[i]}\" in\n");
+        arg_dstr_cat(ds, "            ");
+        for (i = 0; i < ctx->ncmds; i++) {
+            arg_dstr_cat(ds, i == 0 ? "" : "|");
+            arg_complete_catq(ds, ctx->cmds[i]->name, strlen(ctx->cmds[i]->name), 0, "|*?[]()$`'\"\\ ");
+        }
+        arg_dstr_cat(ds, ")\n");
+        arg_dstr_cat(ds, "                cmd=\"${COMP_WORDS[i]}\"\n");
+        arg_dstr_cat(ds, "                break\n");
+        arg_dstr_cat(ds, "                ;;\n");
+        arg_dstr_cat(ds, "        esac\n");
+        arg_dstr_cat(ds, "    done\n");
+        arg_dstr_cat(ds, "    if [ -z \"$cmd\" ]; then\n");
+        arg_dstr_cat(ds, "        COMPREPLY=( $(compgen -W '");
+        for (i = 0; i < ctx->ncmds; i++) {
+            arg_dstr_catc(ds, ' ');
+            arg_complete_catq(ds, ctx->cmds[i]->name, strlen(ctx->cmds[i]->name), 0, NULL);
+        }
+        arg_dstr_cat(ds, "' -- \"$cur\") )\n");
+        arg_dstr_cat(ds, "        return 0\n");
+        arg_dstr_cat(ds, "    fi\n");
+    }
+
+    /* positional arguments */
+    if (ctx->posfile || ctx->ncmds > 0) {
+        arg_dstr_cat(ds, "\n");
+        arg_complete_bash_files(ds, "    ");
+    }
+    arg_dstr_cat(ds, "}\n\n");
+
+    arg_dstr_catf(ds, "complete -F %s '", ctx->fname);
+    arg_complete_catq(ds, ctx->progname, strlen(ctx->progname), 0, NULL);
+    arg_dstr_cat(ds, "'\n");
+}
+
+/* Appends one _arguments spec for the option name in opt[0..len) */
+static void arg_complete_zsh_spec(arg_dstr_t ds, const struct arg_hdr* hdr, const char* prefix, const char* opt, size_t len) {
+    int longopt = prefix[1] == '-';
+
+    arg_dstr_catf(ds, " \\\n        '%s%s", hdr->maxcount > 1 ? "*" : "", prefix);
+    arg_complete_catq(ds, opt, len, 0, NULL);
+    if (hdr->flag & ARG_HASOPTVALUE)
+        arg_dstr_cat(ds, longopt ? "=-" : "-");
+    else if (hdr->flag & ARG_HASVALUE)
+        arg_dstr_cat(ds, longopt ? "=" : "+");
+
+    if (hdr->glossary) {
+        arg_dstr_catc(ds, '[');
+        arg_complete_catq(ds, hdr->glossary, strlen(hdr->glossary), 0, "[]\\");
+        arg_dstr_catc(ds, ']');
+    }
+
+    if (hdr->flag & (ARG_HASVALUE | ARG_HASOPTVALUE)) {
+        const char* datatype = hdr->datatype ? hdr->datatype : "value";
+        arg_dstr_catc(ds, ':');
+        arg_complete_catq(ds, datatype, strlen(datatype), 0, ":\\");
+        arg_dstr_cat(ds, (hdr->flag & ARG_HASFILEVALUE) ? ":_files" : ": ");
+    }
+    arg_dstr_catc(ds, '\'');
+}
+
+static void arg_complete_zsh(arg_dstr_t ds, struct arg_complete_ctx* ctx) {
+    struct arg_hdr** table = ctx->table;
+    int tabindex;
+    unsigned int i;
+
+    arg_dstr_catf(ds, "#compdef %s\n", ctx->progname);
+    arg_dstr_cat(ds, "# zsh completion; generated by argtable3; do not edit\n\n");
+
+    if (ctx->ncmds > 0) {
+        arg_dstr_catf(ds, "%s_commands() {\n", ctx->fname);
+        arg_dstr_cat(ds, "    local -a commands\n");
+        arg_dstr_cat(ds, "    commands=(\n");
+        for (i = 0; i < ctx->ncmds; i++) {
+            arg_dstr_cat(ds, "        '");
+            arg_complete_catq(ds, ctx->cmds[i]->name, strlen(ctx->cmds[i]->name), 0, ":\\");
+            arg_dstr_catc(ds, ':');
+            arg_complete_catq(ds, ctx->cmds[i]->description, strlen(ctx->cmds[i]->description), 0, NULL);
+            arg_dstr_cat(ds, "'\n");
+        }
+        arg_dstr_cat(ds, "    )\n");
+        arg_dstr_cat(ds, "    _describe -t commands command commands\n");
+        arg_dstr_cat(ds, "}\n\n");
+    }
+
+    arg_dstr_catf(ds, "%s() {\n", ctx->fname);
+    arg_dstr_cat(ds, "    _arguments -s -S");
+    for (tabindex = 0; table && !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        struct arg_hdr* hdr = table[tabindex];
+        const char* p;
+
+        if (!hdr->scanfn || !arg_complete_isopt(hdr))
+            continue;
+        for (p = hdr->shortopts; p && *p; p++)
+            arg_complete_zsh_spec(ds, hdr, "-", p, 1);
+        for (p = hdr->longopts; p && *p;) {
+            size_t len = arg_complete_optlen(p);
+            arg_complete_zsh_spec(ds, hdr, "--", p, len);
+            p += len;
+            if (*p == ',')
+                p++;
+        }
+    }
+    if (ctx->ncmds > 0) {
+        arg_dstr_catf(ds, " \\\n        '1: :%s_commands'", ctx->fname);
+        arg_dstr_cat(ds, " \\\n        '*:: :_files'");
+    } else if (ctx->posfile) {
+        arg_dstr_cat(ds, " \\\n        '*:file:_files'");
+    }
+    arg_dstr_cat(ds, "\n}\n\n");
+
+    arg_dstr_catf(ds, "if [ \"$funcstack[1]\" = \"%s\" ]; then\n", ctx->fname);
+    arg_dstr_catf(ds, "    %s \"$@\"\n", ctx->fname);
+    arg_dstr_cat(ds, "else\n");
+    arg_dstr_catf(ds, "    compdef %s '", ctx->fname);
+    arg_complete_catq(ds, ctx->progname, strlen(ctx->progname), 0, NULL);
+    arg_dstr_cat(ds, "'\n");
+    arg_dstr_cat(ds, "fi\n");
+}
+
+static void arg_complete_fish_cmd(arg_dstr_t ds, struct arg_complete_ctx* ctx) {
+    arg_dstr_cat(ds, "complete -c '");
+    arg_complete_catq(ds, ctx->progname, strlen(ctx->progname), 1, NULL);
+    arg_dstr_catc(ds, '\'');
+}
+
+static void arg_complete_fish(arg_dstr_t ds, struct arg_complete_ctx* ctx) {
+    struct arg_hdr** table = ctx->table;
+    int tabindex;
+    unsigned int i;
+
+    arg_dstr_catf(ds, "# fish completion for %s\n", ctx->progname);
+    arg_dstr_cat(ds, "# generated by argtable3; do not edit\n\n");
+
+    /* positional arguments */
+    if (ctx->ncmds > 0) {
+        arg_complete_fish_cmd(ds, ctx);
+        arg_dstr_cat(ds, " -n __fish_use_subcommand -f\n");
+        for (i = 0; i < ctx->ncmds; i++) {
+            arg_complete_fish_cmd(ds, ctx);
+            arg_dstr_cat(ds, " -n __fish_use_subcommand -a '");
+            arg_complete_catq(ds, ctx->cmds[i]->name, strlen(ctx->cmds[i]->name), 1, NULL);
+            arg_dstr_cat(ds, "' -d '");
+            arg_complete_catq(ds, ctx->cmds[i]->description, strlen(ctx->cmds[i]->description), 1, NULL);
+            arg_dstr_cat(ds, "'\n");
+        }
+    } else if (!ctx->posfile) {
+        arg_complete_fish_cmd(ds, ctx);
+        arg_dstr_cat(ds, " -f\n");
+    }
+
+    for (tabindex = 0; table && !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        struct arg_hdr* hdr = table[tabindex];
+        const char* p;
+
+        if (!hdr->scanfn || !arg_complete_isopt(hdr))
+            continue;
+
+        arg_complete_fish_cmd(ds, ctx);
+        for (p = hdr->shortopts; p && *p; p++) {
+            arg_dstr_cat(ds, " -s '");
+            arg_complete_catq(ds, p, 1, 1, NULL);
+            arg_dstr_catc(ds, '\'');
+        }
+        for (p = hdr->longopts; p && *p;) {
+            size_t len = arg_complete_optlen(p);
+            arg_dstr_cat(ds, " -l '");
+            arg_complete_catq(ds, p, len, 1, NULL);
+            arg_dstr_catc(ds, '\'');
+            p += len;
+            if (*p == ',')
+                p++;
+        }
+        if (hdr->flag & ARG_HASVALUE)
+            arg_dstr_cat(ds, (hdr->flag & ARG_HASFILEVALUE) ? " -r -F" : " -x");
+        else if (hdr->flag & ARG_HASOPTVALUE)
+            arg_dstr_cat(ds, (hdr->flag & ARG_HASFILEVALUE) ? " -F" : " -f");
+        if (hdr->glossary) {
+            arg_dstr_cat(ds, " -d '");
+            arg_complete_catq(ds, hdr->glossary, strlen(hdr->glossary), 1, NULL);
+            arg_dstr_catc(ds, '\'');
+        }
+        arg_dstr_catc(ds, '\n');
+    }
+}
+
+void arg_print_completion_ds(arg_dstr_t ds, void** argtable, const char* progname, int shell) {
+    struct arg_complete_ctx ctx;
+
+    arg_complete_init(&ctx, argtable, progname);
+    switch (shell) {
+        case ARG_SHELL_BASH:
+            arg_complete_bash(ds, &ctx);
+            break;
+        case ARG_SHELL_ZSH:
+            arg_complete_zsh(ds, &ctx);
+            break;
+        case ARG_SHELL_FISH:
+            arg_complete_fish(ds, &ctx);
+            break;
+        default:
+            break;
+    }
+    arg_complete_free(&ctx);
+}
+
+void arg_print_completion(FILE* fp, void** argtable, const char* progname, int shell) {
+    arg_dstr_t ds = arg_dstr_create();
+    arg_print_completion_ds(ds, argtable, progname, shell);
+    fputs(arg_dstr_cstr(ds), fp);
+    arg_dstr_destroy(ds);
+}
@@ -36,11 +36,283 @@
 #include "argtable3_private.h"
 #endif
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
 char* arg_strptime(const char* buf, const char* fmt, struct tm* tm);
 
+#define ARG_DATE_NSEC_PER_SEC ((int64_t)1000000000)
+
+/*
+ * A format string is compiled once by arg_daten() into a program of these
+ * instructions, which arg_date_exec() runs for every value. Each instruction
+ * carries the literal run that follows it in the format, so "%d/%m/%Y" takes
+ * three instructions. The program accepts exactly the values that
+ * arg_strptime() accepts for the format.
+ */
+enum {
+    ARG_DATE_OP_END,     /* end of the program */
+    ARG_DATE_OP_SPACE,   /* skip any white-space */
+    ARG_DATE_OP_LIT,     /* nothing but the literal run, for a format that starts with one */
+    ARG_DATE_OP_WDAY,    /* read a day of week name */
+    ARG_DATE_OP_MONTH,   /* read a month name */
+    ARG_DATE_OP_AMPM,    /* read AM or PM, which must end the value */
+    ARG_DATE_OP_NUM,     /* read a number and store it plus delta at offset in struct tm */
+    ARG_DATE_OP_RANGE,   /* read a number and only check its bounds (%U, %W) */
+    ARG_DATE_OP_HOUR12,  /* read a 12-hour clock hour (%I, %l) */
+    ARG_DATE_OP_YEAR2,   /* read a year within 100 years of the epoch (%y) */
+    ARG_DATE_OP_YEAR2X,  /* %y inside %c, %D or %x, which never combines with %C */
+    ARG_DATE_OP_CENTURY  /* read a century (%C) */
+};
+
+struct arg_date_op {
+    int code;        /* ARG_DATE_OP_* */
+    int lo, hi;      /* bounds of a number, read from ARG_DATE_OP_NUM on */
+    int width;       /* the most digits of a number, which is the number of digits of hi */
+    int offset;      /* offset of the int field of struct tm for ARG_DATE_OP_NUM */
+    int delta;       /* added to the number for ARG_DATE_OP_NUM */
+    const char* lit; /* literal run that must follow, pointing into the format */
+    int len;         /* number of characters of the literal run, or 0 */
+};
+
+static int arg_date_compile(const char* fmt, int depth, struct arg_date_op* prog, int n, int* tail);
+static const char* arg_date_exec(const struct arg_date_op* op, const char* bp, struct tm* tm);
+
+/*
+ * Formats recognized by arg_daten() that are parsed without running a format
+ * program. For the fixed formats, only values in their canonical form, with
+ * every field written with all its digits, take the fast path; anything else
+ * is left to the format program, so the accepted values do not change.
+ */
+enum {
+    ARG_DATE_GENERIC,   /* any other format, parsed by the format program */
+    ARG_DATE_YMD,       /* %Y-%m-%d */
+    ARG_DATE_HMS,       /* %H:%M:%S or %T */
+    ARG_DATE_YMD_T_HMS, /* %Y-%m-%dT%H:%M:%S or %Y-%m-%dT%T */
+    ARG_DATE_YMD_HMS,   /* %Y-%m-%d %H:%M:%S or %Y-%m-%d %T */
+    ARG_DATE_ISO        /* ARG_DATE_ISO8601 */
+};
+
+static const struct {
+    const char* format;
+    int kind;
+} arg_date_formats[] = {
+    {"%Y-%m-%d", ARG_DATE_YMD},
+    {"%H:%M:%S", ARG_DATE_HMS},
+    {"%T", ARG_DATE_HMS},
+    {"%Y-%m-%dT%H:%M:%S", ARG_DATE_YMD_T_HMS},
+    {"%Y-%m-%dT%T", ARG_DATE_YMD_T_HMS},
+    {"%Y-%m-%d %H:%M:%S", ARG_DATE_YMD_HMS},
+    {"%Y-%m-%d %T", ARG_DATE_YMD_HMS},
+    {ARG_DATE_ISO8601, ARG_DATE_ISO},
+};
+
+/* private data of arg_date, stored after the tmval[] or nsec[] array */
+struct arg_date_priv {
+    struct arg_hdr_ext ext; /* must come first, see ARG_HASEXT */
+    int kind;
+    struct arg_date_op* prog; /* compiled format, or NULL for ARG_DATE_ISO */
+};
+
+/* Reads exactly n digits from *str into *val, returns 0 if there are fewer */
+static int arg_date_digits(const char** str, int n, int* val) {
+    const char* ptr = *str;
+    int result = 0;
+
+    for (; n > 0; n--, ptr++) {
+        if (*ptr < '0' || *ptr > '9')
+            return 0;
+        result = result * 10 + (*ptr - '0');
+    }
+
+    *str = ptr;
+    *val = result;
+    return 1;
+}
+
+/* Reads the canonical "YYYY-MM-DD" into the date fields of tm, with the ranges of %Y, %m and %d */
+static int arg_date_scanymd(const char** str, struct tm* tm) {
+    const char* ptr = *str;
+    int y, m, d;
+
+    if (!arg_date_digits(&ptr, 4, &y) || *ptr++ != '-' || !arg_date_digits(&ptr, 2, &m) || *ptr++ != '-' || !arg_date_digits(&ptr, 2, &d))
+        return 0;
+    if (m < 1 || m > 12 || d < 1 || d > 31)
+        return 0;
+
+    tm->tm_year = y - 1900;
+    tm->tm_mon = m - 1;
+    tm->tm_mday = d;
+    *str = ptr;
+    return 1;
+}
+
+/* Reads the canonical "hh:mm:ss" into the time fields of tm, with the ranges of %H, %M and %S */
+static int arg_date_scanhms(const char** str, struct tm* tm) {
+    const char* ptr = *str;
+    int h, m, sec;
+
+    if (!arg_date_digits(&ptr, 2, &h) || *ptr++ != ':' || !arg_date_digits(&ptr, 2, &m) || *ptr++ != ':' || !arg_date_digits(&ptr, 2, &sec))
+        return 0;
+    if (h > 23 || m > 59 || sec > 61)
+        return 0;
+
+    tm->tm_hour = h;
+    tm->tm_min = m;
+    tm->tm_sec = sec;
+    *str = ptr;
+    return 1;
+}
+
+/*
+ * Parses str in one of the fixed formats. Returns 1 and updates tm only if
+ * str is a valid value in canonical form; otherwise returns 0 and leaves the
+ * value to the format program.
+ */
+static int arg_date_scanfixed(const char* str, int kind, struct tm* tm) {
+    struct tm result = *tm;
+
+    switch (kind) {
+        case ARG_DATE_YMD:
+            if (!arg_date_scanymd(&str, &result))
+                return 0;
+            break;
+
+        case ARG_DATE_HMS:
+            if (!arg_date_scanhms(&str, &result))
+                return 0;
+            break;
+
+        case ARG_DATE_YMD_T_HMS:
+        case ARG_DATE_YMD_HMS:
+            if (!arg_date_scanymd(&str, &result) || *str++ != (kind == ARG_DATE_YMD_HMS ? ' ' : 'T') || !arg_date_scanhms(&str, &result))
+                return 0;
+            break;
+
+        default:
+            return 0;
+    }
+
+    if (*str != '\0')
+        return 0;
+
+    *tm = result;
+    return 1;
+}
+
+/* Returns the number of days from 1970-01-01 to the given date of the proleptic Gregorian calendar */
+static int64_t arg_date_days(int64_t y, int m, int d) {
+    int64_t era;
+    int yoe;
+    int doy;
+
+    y -= (m <= 2);
+    era = (y >= 0 ? y : y - 399) / 400;
+    yoe = (int)(y - era * 400);
+    doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    return era * 146097 + yoe * 365 + yoe / 4 - yoe / 100 + doy - 719468;
+}
+
+/* Sets the calendar fields of tm, in UTC, to the time secs seconds after 1970-01-01 00:00:00 */
+static void arg_date_civil(int64_t secs, struct tm* tm) {
+    int64_t days = (secs >= 0 ? secs : secs - 86399) / 86400;
+    int64_t rem = secs - days * 86400;
+    int64_t z = days + 719468;
+    int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    int doe = (int)(z - era * 146097);
+    int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int mp = (5 * doy + 2) / 153;
+    int m = mp < 10 ? mp + 3 : mp - 9;
+    int64_t y = era * 400 + yoe + (m <= 2);
+
+    tm->tm_year = (int)(y - 1900);
+    tm->tm_mon = m - 1;
+    tm->tm_mday = doy - (153 * mp + 2) / 5 + 1;
+    tm->tm_hour = (int)(rem / 3600);
+    tm->tm_min = (int)(rem / 60 % 60);
+    tm->tm_sec = (int)(rem % 60);
+    tm->tm_wday = (int)((days % 7 + 11) % 7); /* 1970-01-01 was a Thursday */
+    tm->tm_yday = (int)(days - arg_date_days(y, 1, 1));
+    tm->tm_isdst = 0;
+}
+
+/*
+ * Parses an ARG_DATE_ISO8601 value. On success stores the time in UTC in tm,
+ * the seconds since the epoch in secs and the fraction in frac (nanoseconds).
+ */
+static int arg_date_scaniso(const char* str, struct tm* tm, int64_t* secs, long* frac) {
+    static const int mdays[12] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    int y, m, d;
+    int h = 0, min = 0, sec = 0;
+    int offset = 0;
+    long ns = 0;
+
+    if (!arg_date_digits(&str, 4, &y) || *str++ != '-' || !arg_date_digits(&str, 2, &m) || *str++ != '-' || !arg_date_digits(&str, 2, &d))
+        return ARG_ERR_BADDATE;
+    if (m < 1 || m > 12 || d < 1 || d > mdays[m - 1] || (m == 2 && d == 29 && (y % 4 != 0 || (y % 100 == 0 && y % 400 != 0))))
+        return ARG_ERR_BADDATE;
+
+    if (*str == 'T' || *str == 't' || *str == ' ') {
+        str++;
+        if (!arg_date_digits(&str, 2, &h) || *str++ != ':' || !arg_date_digits(&str, 2, &min) || h > 23 || min > 59)
+            return ARG_ERR_BADDATE;
+
+        if (*str == ':') {
+            str++;
+            if (!arg_date_digits(&str, 2, &sec) || sec > 60)
+                return ARG_ERR_BADDATE;
+
+            if ((*str == '.' || *str == ',') && str[1] >= '0' && str[1] <= '9') {
+                long scale = 100000000L;
+                for (str++; *str >= '0' && *str <= '9'; str++, scale /= 10)
+                    ns += (*str - '0') * scale; /* digits beyond nanoseconds add zero */
+            }
+        }
+
+        if (*str == 'Z' || *str == 'z') {
+            str++;
+        } else if (*str == '+' || *str == '-') {
+            int sign = (*str++ == '-') ? -1 : 1;
+            int oh;
+            int om = 0;
+
+            if (!arg_date_digits(&str, 2, &oh) || oh > 23)
+                return ARG_ERR_BADDATE;
+            if (*str != '\0') {
+                if (*str == ':')
+                    str++;
+                if (!arg_date_digits(&str, 2, &om) || om > 59)
+                    return ARG_ERR_BADDATE;
+            }
+            offset = sign * (oh * 3600 + om * 60);
+        }
+    }
+
+    if (*str != '\0')
+        return ARG_ERR_BADDATE;
+
+    *secs = arg_date_days(y, m, d) * 86400 + h * 3600 + min * 60 + sec - offset;
+    *frac = ns;
+    arg_date_civil(*secs, tm);
+    return 0;
+}
+
+/* Converts secs seconds and frac nanoseconds since the epoch to nanoseconds, if that fits in 64 bits */
+static int arg_date_nsec(int64_t secs, long frac, int64_t* nsec) {
+    int64_t max = (int64_t)(~(uint64_t)0 >> 1);
+    int64_t min = -max - 1;
+
+    /* min / 10^9 rounds toward zero, so the smallest whole second is always in range */
+    if (secs > max / ARG_DATE_NSEC_PER_SEC || secs < min / ARG_DATE_NSEC_PER_SEC ||
+        (secs == max / ARG_DATE_NSEC_PER_SEC && frac > max % ARG_DATE_NSEC_PER_SEC))
+        return ARG_ERR_OVERFLOW;
+
+    *nsec = secs * ARG_DATE_NSEC_PER_SEC + frac;
+    return 0;
+}
+
 static void arg_date_resetfn(void* parent_) {
     struct arg_date* parent = parent_;
     ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
@@ -57,15 +329,41 @@ static int arg_date_scanfn(void* parent_, const char* argval) {
         /* no argument value was given, leave parent->tmval[] unaltered but still count it */
         parent->count++;
     } else {
+        struct arg_date_priv* priv = (struct arg_date_priv*)parent->hdr.priv;
         const char* pend;
-        struct tm tm = parent->tmval[parent->count];
-
-        /* parse the given argument value, store result in parent->tmval[] */
-        pend = arg_strptime(argval, parent->format, &tm);
-        if (pend && pend[0] == '\0')
-            parent->tmval[parent->count++] = tm;
-        else
-            errorcode = ARG_ERR_BADDATE;
+        struct tm tm;
+        int64_t secs = 0;
+        long frac = 0;
+
+        /* start from the previous value, or from the epoch when storing nanoseconds */
+        if (parent->tmval) {
+            tm = parent->tmval[parent->count];
+        } else {
+            memset(&tm, 0, sizeof(tm));
+            tm.tm_year = 70;
+            tm.tm_mday = 1;
+        }
+
+        /* parse the given argument value, with a fast path for the ISO-8601 formats */
+        if (priv->kind == ARG_DATE_ISO) {
+            errorcode = arg_date_scaniso(argval, &tm, &secs, &frac);
+        } else if (priv->kind == ARG_DATE_GENERIC || !arg_date_scanfixed(argval, priv->kind, &tm)) {
+            pend = arg_date_exec(priv->prog, argval, &tm);
+            if (!pend || pend[0] != '\0')
+                errorcode = ARG_ERR_BADDATE;
+        }
+
+        /* store result in parent->tmval[] or parent->nsec[] */
+        if (errorcode == 0 && parent->nsec) {
+            if (priv->kind != ARG_DATE_ISO)
+                secs = arg_date_days(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday) * 86400 + tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+            errorcode = arg_date_nsec(secs, frac, &parent->nsec[parent->count]);
+        }
+        if (errorcode == 0) {
+            if (parent->tmval)
+                parent->tmval[parent->count] = tm;
+            parent->count++;
+        }
     }
 
     ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
@@ -112,9 +410,44 @@ static void arg_date_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const
             arg_dstr_catf(ds, "correct format is \"%s\"\n", buff);
             break;
         }
+
+        case ARG_ERR_OVERFLOW:
+            arg_dstr_catf(ds, "timestamp \"%s\" is out of range at option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+    }
+}
+
+static void* arg_date_clonefn(void* parent_) {
+    struct arg_date* parent = parent_;
+    struct arg_date_priv* priv = (struct arg_date_priv*)parent->hdr.priv;
+    size_t valsize = parent->tmval ? sizeof(struct tm) : sizeof(int64_t);
+    size_t nops = 0;
+    struct arg_date* result;
+    struct arg_date_priv* rpriv;
+
+    /* the format program ends with its ARG_DATE_OP_END instruction */
+    if (priv->prog) {
+        while (priv->prog[nops].code != ARG_DATE_OP_END)
+            nops++;
+        nops++;
     }
+
+    result = (struct arg_date*)arg_clone_block(parent, sizeof(struct arg_date) + (size_t)parent->hdr.maxcount * valsize + sizeof(struct arg_date_priv) +
+                                                           nops * sizeof(struct arg_date_op));
+    result->hdr.priv = ARG_CLONE_PTR(result, parent, priv);
+    rpriv = (struct arg_date_priv*)result->hdr.priv;
+    if (priv->prog)
+        rpriv->prog = (struct arg_date_op*)ARG_CLONE_PTR(result, parent, priv->prog);
+    if (parent->tmval)
+        result->tmval = (struct tm*)ARG_CLONE_PTR(result, parent, parent->tmval);
+    else
+        result->nsec = (int64_t*)ARG_CLONE_PTR(result, parent, parent->nsec);
+    return result;
 }
 
+static const struct arg_hdr_ext arg_date_ext = {ARG_HDR_EXT_VERSION, NULL, arg_date_clonefn};
+
 struct arg_date* arg_date0(const char* shortopts, const char* longopts, const char* format, const char* datatype, const char* glossary) {
     return arg_daten(shortopts, longopts, format, datatype, 0, 1, glossary);
 }
@@ -123,10 +456,26 @@ struct arg_date* arg_date1(const char* shortopts, const char* longopts, const ch
     return arg_daten(shortopts, longopts, format, datatype, 1, 1, glossary);
 }
 
-struct arg_date*
-arg_daten(const char* shortopts, const char* longopts, const char* format, const char* datatype, int mincount, int maxcount, const char* glossary) {
+/*
+ * Creates an arg_date that stores struct tm values in tmval[], or, if epoch
+ * is nonzero, nanoseconds since the epoch in nsec[].
+ */
+static struct arg_date* arg_date_create(const char* shortopts,
+                                        const char* longopts,
+                                        const char* format,
+                                        const char* datatype,
+                                        int mincount,
+                                        int maxcount,
+                                        const char* glossary,
+                                        int epoch) {
     size_t nbytes;
+    size_t valsize = epoch ? sizeof(int64_t) : sizeof(struct tm);
     struct arg_date* result;
+    struct arg_date_priv* priv;
+    int kind = ARG_DATE_GENERIC;
+    int nops = 0;
+    int tail = 0;
+    size_t i;
 
     /* foolproof things by ensuring maxcount is not less than mincount */
     maxcount = (maxcount < mincount) ? mincount : maxcount;
@@ -135,15 +484,34 @@ arg_daten(const char* shortopts, const char* longopts, const char* format, const
     if (!format)
         format = "%x";
 
-    nbytes = sizeof(struct arg_date)         /* storage for struct arg_date */
-             + (size_t)maxcount * sizeof(struct tm); /* storage for tmval[maxcount] array */
+    /* recognize the formats that have a fast path */
+    for (i = 0; i < sizeof(arg_date_formats) / sizeof(arg_date_formats[0]); i++) {
+        if (strcmp(format, arg_date_formats[i].format) == 0)
+            kind = arg_date_formats[i].kind;
+    }
+
+    /* count the instructions of the format program, which also validates the format */
+    if (kind != ARG_DATE_ISO) {
+        nops = arg_date_compile(format, 0, NULL, 0, &tail);
+        if (nops < 0) {
+            ARG_LOG(("argtable: ERROR - invalid date format \"%s\"\n", format));
+            ARG_LOG(("argtable: Bad argument table.\n"));
+            return NULL;
+        }
+        nops++; /* room for the ARG_DATE_OP_END instruction */
+    }
+
+    nbytes = sizeof(struct arg_date)                      /* storage for struct arg_date */
+             + (size_t)maxcount * valsize                 /* storage for tmval[maxcount] or nsec[maxcount] array */
+             + sizeof(struct arg_date_priv)               /* storage for private arg_date data */
+             + (size_t)nops * sizeof(struct arg_date_op); /* storage for the format program */
 
     /* allocate storage for the arg_date struct + tmval[] array.    */
     /* we use calloc because we want the tmval[] array zero filled. */
     result = (struct arg_date*)xcalloc(1, nbytes);
 
     /* init the arg_hdr struct */
-    result->hdr.flag = ARG_HASVALUE;
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
     result->hdr.shortopts = shortopts;
     result->hdr.longopts = longopts;
     result->hdr.datatype = datatype ? datatype : format;
@@ -156,17 +524,59 @@ arg_daten(const char* shortopts, const char* longopts, const char* format, const
     result->hdr.checkfn = arg_date_checkfn;
     result->hdr.errorfn = arg_date_errorfn;
 
-    /* store the tmval[maxcount] array immediately after the arg_date struct */
-    result->tmval = (struct tm*)(result + 1);
+    /* store the tmval[maxcount] or nsec[maxcount] array immediately after the arg_date struct */
+    if (epoch) {
+        result->tmval = NULL;
+        result->nsec = (int64_t*)(result + 1);
+    } else {
+        result->tmval = (struct tm*)(result + 1);
+        result->nsec = NULL;
+    }
+
+    /* store the arg_date_priv struct after the array */
+    priv = (struct arg_date_priv*)((char*)(result + 1) + (size_t)maxcount * valsize);
+    result->hdr.priv = priv;
+    priv->ext = arg_date_ext;
+    priv->kind = kind;
+
+    /* compile the format program after the arg_date_priv struct */
+    if (nops > 0) {
+        priv->prog = (struct arg_date_op*)(priv + 1);
+        tail = 0;
+        priv->prog[arg_date_compile(format, 0, priv->prog, 0, &tail)].code = ARG_DATE_OP_END;
+    } else {
+        priv->prog = NULL;
+    }
 
     /* init the remaining arg_date member variables */
     result->count = 0;
     result->format = format;
 
+    return result;
+}
+
+struct arg_date*
+arg_daten(const char* shortopts, const char* longopts, const char* format, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    struct arg_date* result = arg_date_create(shortopts, longopts, format, datatype, mincount, maxcount, glossary, 0);
     ARG_TRACE(("arg_daten() returns %p\n", result));
     return result;
 }
 
+struct arg_date* arg_epoch0(const char* shortopts, const char* longopts, const char* format, const char* datatype, const char* glossary) {
+    return arg_epochn(shortopts, longopts, format, datatype, 0, 1, glossary);
+}
+
+struct arg_date* arg_epoch1(const char* shortopts, const char* longopts, const char* format, const char* datatype, const char* glossary) {
+    return arg_epochn(shortopts, longopts, format, datatype, 1, 1, glossary);
+}
+
+struct arg_date*
+arg_epochn(const char* shortopts, const char* longopts, const char* format, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    struct arg_date* result = arg_date_create(shortopts, longopts, format, datatype, mincount, maxcount, glossary, 1);
+    ARG_TRACE(("arg_epochn() returns %p\n", result));
+    return result;
+}
+
 /*-
  * Copyright (c) 1997, 1998, 2005, 2008 The NetBSD Foundation, Inc.
  * All rights reserved.
@@ -572,3 +982,257 @@ static int conv_num(const char** buf, int* dest, int llim, int ulim) {
     *dest = result;
     return (1);
 }
+
+/*
+ * Conversions understood by arg_date_compile(), with the same meaning and the
+ * same alternative modifiers as in arg_strptime(). The composite conversions
+ * are compiled from their expansion.
+ */
+static const struct {
+    char conv;          /* conversion character */
+    int alt;            /* permitted ALT_E and ALT_O modifiers */
+    const char* expand; /* expansion of a composite conversion, or NULL */
+    int code;
+    int lo, hi;
+    int offset, delta;
+} arg_date_convs[] = {
+    {'c', ALT_E, "%x %X", 0, 0, 0, 0, 0},
+    {'D', 0, "%m/%d/%y", 0, 0, 0, 0, 0},
+    {'R', 0, "%H:%M", 0, 0, 0, 0, 0},
+    {'r', 0, "%I:%M:%S %p", 0, 0, 0, 0, 0},
+    {'T', 0, "%H:%M:%S", 0, 0, 0, 0, 0},
+    {'X', ALT_E, "%H:%M:%S", 0, 0, 0, 0, 0},
+    {'x', ALT_E, "%m/%d/%y", 0, 0, 0, 0, 0},
+    {'A', 0, NULL, ARG_DATE_OP_WDAY, 0, 0, 0, 0},
+    {'a', 0, NULL, ARG_DATE_OP_WDAY, 0, 0, 0, 0},
+    {'B', 0, NULL, ARG_DATE_OP_MONTH, 0, 0, 0, 0},
+    {'b', 0, NULL, ARG_DATE_OP_MONTH, 0, 0, 0, 0},
+    {'h', 0, NULL, ARG_DATE_OP_MONTH, 0, 0, 0, 0},
+    {'p', 0, NULL, ARG_DATE_OP_AMPM, 0, 0, 0, 0},
+    {'n', 0, NULL, ARG_DATE_OP_SPACE, 0, 0, 0, 0},
+    {'t', 0, NULL, ARG_DATE_OP_SPACE, 0, 0, 0, 0},
+    {'C', ALT_E, NULL, ARG_DATE_OP_CENTURY, 0, 99, 0, 0},
+    {'d', ALT_O, NULL, ARG_DATE_OP_NUM, 1, 31, offsetof(struct tm, tm_mday), 0},
+    {'e', ALT_O, NULL, ARG_DATE_OP_NUM, 1, 31, offsetof(struct tm, tm_mday), 0},
+    {'k', 0, NULL, ARG_DATE_OP_NUM, 0, 23, offsetof(struct tm, tm_hour), 0},
+    {'H', ALT_O, NULL, ARG_DATE_OP_NUM, 0, 23, offsetof(struct tm, tm_hour), 0},
+    {'l', 0, NULL, ARG_DATE_OP_HOUR12, 1, 12, 0, 0},
+    {'I', ALT_O, NULL, ARG_DATE_OP_HOUR12, 1, 12, 0, 0},
+    {'j', 0, NULL, ARG_DATE_OP_NUM, 1, 366, offsetof(struct tm, tm_yday), -1},
+    {'M', ALT_O, NULL, ARG_DATE_OP_NUM, 0, 59, offsetof(struct tm, tm_min), 0},
+    {'m', ALT_O, NULL, ARG_DATE_OP_NUM, 1, 12, offsetof(struct tm, tm_mon), -1},
+    {'S', ALT_O, NULL, ARG_DATE_OP_NUM, 0, 61, offsetof(struct tm, tm_sec), 0},
+    {'U', ALT_O, NULL, ARG_DATE_OP_RANGE, 0, 53, 0, 0},
+    {'W', ALT_O, NULL, ARG_DATE_OP_RANGE, 0, 53, 0, 0},
+    {'w', ALT_O, NULL, ARG_DATE_OP_NUM, 0, 6, offsetof(struct tm, tm_wday), 0},
+    {'Y', ALT_E, NULL, ARG_DATE_OP_NUM, 0, 9999, offsetof(struct tm, tm_year), -TM_YEAR_BASE},
+    {'y', ALT_E | ALT_O, NULL, ARG_DATE_OP_YEAR2, 0, 99, 0, 0},
+};
+
+/*
+ * Compiles fmt into prog, starting at instruction n, and returns the index
+ * after the last instruction, or -1 if fmt has an unknown conversion or an
+ * illegal modifier. With prog NULL the instructions are only counted. The
+ * depth is nonzero for the expansion of a composite conversion, and *tail is
+ * nonzero while instruction n-1 can still take a literal run.
+ */
+static int arg_date_compile(const char* fmt, int depth, struct arg_date_op* prog, int n, int* tail) {
+    while (*fmt != '\0') {
+        struct arg_date_op op;
+        const char* lit = NULL;
+        int alt = 0;
+        int lim;
+        size_t i;
+
+        memset(&op, 0, sizeof(op));
+        if (isspace((unsigned char)*fmt)) {
+            /* a run of white-space skips any white-space, like a single one */
+            while (isspace((unsigned char)*fmt))
+                fmt++;
+            op.code = ARG_DATE_OP_SPACE;
+        } else if (*fmt != '%') {
+            lit = fmt;
+            while (*fmt != '\0' && *fmt != '%' && !isspace((unsigned char)*fmt))
+                fmt++;
+        } else {
+            /* at most one of the "%E?" and "%O?" modifiers */
+            for (fmt++; *fmt == 'E' || *fmt == 'O'; fmt++) {
+                if (alt)
+                    return -1;
+                alt = (*fmt == 'E') ? ALT_E : ALT_O;
+            }
+
+            if (*fmt == '%') {
+                lit = fmt++;
+            } else {
+                for (i = 0; i < sizeof(arg_date_convs) / sizeof(arg_date_convs[0]); i++) {
+                    if (arg_date_convs[i].conv == *fmt)
+                        break;
+                }
+                if (*fmt == '\0' || i == sizeof(arg_date_convs) / sizeof(arg_date_convs[0]) || (alt & ~arg_date_convs[i].alt))
+                    return -1;
+                fmt++;
+
+                if (arg_date_convs[i].expand) {
+                    n = arg_date_compile(arg_date_convs[i].expand, depth + 1, prog, n, tail);
+                    continue;
+                }
+
+                op.code = arg_date_convs[i].code;
+                op.lo = arg_date_convs[i].lo;
+                op.hi = arg_date_convs[i].hi;
+                op.offset = (int)arg_date_convs[i].offset;
+                op.delta = arg_date_convs[i].delta;
+                /* conv_num() reads at most as many digits as hi has */
+                for (op.width = 1, lim = op.hi; lim >= 10; lim /= 10)
+                    op.width++;
+                if (op.code == ARG_DATE_OP_YEAR2 && depth > 0)
+                    op.code = ARG_DATE_OP_YEAR2X;
+            }
+        }
+
+        /* attach a literal run to the previous instruction, or start the program with it */
+        if (lit) {
+            op.code = ARG_DATE_OP_LIT;
+            op.lit = lit;
+            op.len = (int)(fmt - lit);
+            if (*tail) {
+                if (prog) {
+                    prog[n - 1].lit = op.lit;
+                    prog[n - 1].len = op.len;
+                }
+                *tail = 0;
+                continue;
+            }
+        } else {
+            *tail = 1;
+        }
+
+        if (prog)
+            prog[n] = op;
+        n++;
+    }
+
+    return n;
+}
+
+/* Matches a day or month name, full or abbreviated, and returns its index or -1 */
+static int arg_date_name(const char** bp, const char** full, const char** abbr, int count) {
+    size_t len;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        len = strlen(full[i]);
+        if (arg_strncasecmp(full[i], *bp, len) == 0)
+            break;
+
+        len = strlen(abbr[i]);
+        if (arg_strncasecmp(abbr[i], *bp, len) == 0)
+            break;
+    }
+
+    if (i == count)
+        return -1;
+
+    *bp += len;
+    return i;
+}
+
+/*
+ * Runs a format program over the value in bp, updating tm. Returns a pointer
+ * to the first unparsed character, or NULL if the value does not match.
+ */
+static const char* arg_date_exec(const struct arg_date_op* op, const char* bp, struct tm* tm) {
+    int split_year = 0;
+    int i = 0;
+
+    for (;; op++) {
+        /* read the number of a numeric conversion, with the same digits as conv_num() */
+        if (op->code >= ARG_DATE_OP_NUM) {
+            int width = op->width;
+
+            if (*bp < '0' || *bp > '9')
+                return NULL;
+            i = *bp++ - '0';
+            while (--width > 0 && i * 10 <= op->hi && *bp >= '0' && *bp <= '9')
+                i = i * 10 + (*bp++ - '0');
+            if (i < op->lo || i > op->hi)
+                return NULL;
+        }
+
+        switch (op->code) {
+            case ARG_DATE_OP_END:
+                return bp;
+
+            case ARG_DATE_OP_SPACE:
+                while (isspace((unsigned char)*bp))
+                    bp++;
+                break;
+
+            case ARG_DATE_OP_LIT:
+            case ARG_DATE_OP_RANGE:
+                break;
+
+            case ARG_DATE_OP_WDAY:
+                if ((i = arg_date_name(&bp, day, abday, 7)) < 0)
+                    return NULL;
+                tm->tm_wday = i;
+                break;
+
+            case ARG_DATE_OP_MONTH:
+                if ((i = arg_date_name(&bp, mon, abmon, 12)) < 0)
+                    return NULL;
+                tm->tm_mon = i;
+                break;
+
+            case ARG_DATE_OP_AMPM:
+                /* as in arg_strptime(), AM or PM is compared with the rest of the value */
+                if (tm->tm_hour > 11)
+                    return NULL;
+                if (arg_strcasecmp(am_pm[0], bp) == 0) {
+                    bp += strlen(am_pm[0]);
+                } else if (arg_strcasecmp(am_pm[1], bp) == 0) {
+                    tm->tm_hour += 12;
+                    bp += strlen(am_pm[1]);
+                } else {
+                    return NULL;
+                }
+                break;
+
+            case ARG_DATE_OP_NUM:
+                *(int*)((char*)tm + op->offset) = i + op->delta;
+                break;
+
+            case ARG_DATE_OP_HOUR12:
+                tm->tm_hour = (i == 12) ? 0 : i;
+                break;
+
+            case ARG_DATE_OP_YEAR2:
+                if (split_year) {
+                    tm->tm_year = ((tm->tm_year / 100) * 100) + i;
+                    break;
+                }
+                split_year = 1;
+            /* FALLTHROUGH */
+            case ARG_DATE_OP_YEAR2X:
+                tm->tm_year = (i <= 68) ? i + 2000 - TM_YEAR_BASE : i + 1900 - TM_YEAR_BASE;
+                break;
+
+            case ARG_DATE_OP_CENTURY:
+                if (split_year) {
+                    tm->tm_year = (tm->tm_year % 100) + (i * 100);
+                } else {
+                    tm->tm_year = i * 100;
+                    split_year = 1;
+                }
+                break;
+        }
+
+        /* literal runs are short, so compare them in place rather than calling strncmp() */
+        for (i = 0; i < op->len; i++) {
+            if (bp[i] != op->lit[i])
+                return NULL;
+        }
+        bp += op->len;
+    }
+}
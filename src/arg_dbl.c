@@ -36,8 +36,6 @@
 #include "argtable3_private.h"
 #endif
 
-#include <stdlib.h>
-
 static void arg_dbl_resetfn(void* parent_) {
     struct arg_dbl* parent = parent_;
     ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
@@ -60,8 +58,8 @@ static int arg_dbl_scanfn(void* parent_, const char* argval) {
         double val;
         char* end;
 
-        /* extract double from argval into val */
-        val = strtod(argval, &end);
+        /* extract double from argval into val, always with '.' as the decimal point */
+        val = arg_strtod(argval, &end);
 
         /* if success then store result in parent->dval[] array otherwise return error*/
         if (*end == 0)
@@ -110,6 +108,15 @@ static void arg_dbl_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const c
     }
 }
 
+static void* arg_dbl_clonefn(void* parent_) {
+    struct arg_dbl* parent = parent_;
+    struct arg_dbl* result = (struct arg_dbl*)arg_clone_block(parent, sizeof(struct arg_dbl) + (size_t)(parent->hdr.maxcount + 1) * sizeof(double));
+    result->dval = (double*)ARG_CLONE_PTR(result, parent, parent->dval);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_dbl_ext = {ARG_HDR_EXT_VERSION, NULL, arg_dbl_clonefn};
+
 struct arg_dbl* arg_dbl0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
     return arg_dbln(shortopts, longopts, datatype, 0, 1, glossary);
 }
@@ -133,7 +140,7 @@ struct arg_dbl* arg_dbln(const char* shortopts, const char* longopts, const char
     result = (struct arg_dbl*)xmalloc(nbytes);
 
     /* init the arg_hdr struct */
-    result->hdr.flag = ARG_HASVALUE;
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
     result->hdr.shortopts = shortopts;
     result->hdr.longopts = longopts;
     result->hdr.datatype = datatype ? datatype : "<double>";
@@ -145,6 +152,7 @@ struct arg_dbl* arg_dbln(const char* shortopts, const char* longopts, const char
     result->hdr.scanfn = arg_dbl_scanfn;
     result->hdr.checkfn = arg_dbl_checkfn;
     result->hdr.errorfn = arg_dbl_errorfn;
+    result->hdr.priv = (void*)&arg_dbl_ext;
 
     /* Store the dval[maxcount] array on the first double boundary that
      * immediately follows the arg_dbl struct. We do the memory alignment
@@ -0,0 +1,307 @@
+/*******************************************************************************
+ * arg_duration: Implements the time duration command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <ctype.h>
+#include <string.h>
+
+static void arg_duration_resetfn(void* parent_) {
+    struct arg_duration* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+/* Duration units and their length in nanoseconds. */
+static const struct {
+    const char* name;
+    uint64_t nsec;
+} arg_duration_units[] = {
+    {"ns", 1},
+    {"us", 1000},
+    {"\xC2\xB5s", 1000}, /* U+00B5 MICRO SIGN */
+    {"\xCE\xBCs", 1000}, /* U+03BC GREEK SMALL LETTER MU */
+    {"ms", 1000000},
+    {"s", 1000000000UL},
+    {"m", (uint64_t)60 * 1000000000UL},
+    {"h", (uint64_t)3600 * 1000000000UL},
+};
+
+/* Returns the whole nanoseconds in the fraction digits [digit, end) of */
+/* the given unit, rounding toward zero. Every unit is c * 10^e with a   */
+/* small c, so the first e digits scale to whole nanoseconds, and the    */
+/* rest add floor(c * 0.ddd), found by long multiplication from the      */
+/* right. No digit is lost and no intermediate value can overflow.       */
+static uint64_t arg_duration_frac(const unsigned char* digit, const unsigned char* end, uint64_t unit) {
+    uint64_t whole = 0;
+    unsigned int carry = 0;
+    unsigned int c;
+    int e = 0;
+
+    while (unit % 10 == 0) {
+        unit /= 10;
+        e++;
+    }
+    c = (unsigned int)unit;
+
+    for (; digit < end && e > 0; digit++, e--)
+        whole = whole * 10 + (uint64_t)(*digit - '0');
+    for (; e > 0; e--)
+        whole *= 10;
+    while (end > digit)
+        carry = (c * (unsigned int)(*--end - '0') + carry) / 10;
+
+    return whole * c + carry;
+}
+
+/* arg_duration_scan() converts a duration such as "250ms", "1.5s" or    */
+/* "1h30m" to nanoseconds in a single pass. The grammar is               */
+/*                                                                       */
+/*   [ws] [+|-] (number unit)+ [ws]     or     [ws] [+|-] 0 [ws]         */
+/*                                                                       */
+/* where number is a decimal with an optional fraction (eg: 1, 1.5, .5)  */
+/* and unit is one of ns, us (also with a micro sign), ms, s, m and h.   */
+/* Units are case sensitive, since "m" and "M" are easily confused.      */
+/* Fractions are resolved to whole nanoseconds, rounding toward zero.    */
+/* Returns 0 on success, ARG_ERR_BADINT for malformed input, or          */
+/* ARG_ERR_OVERFLOW if the total does not fit in an int64_t.             */
+static int arg_duration_scan(const char* str, int64_t* result) {
+    const unsigned char* ptr = (const unsigned char*)str;
+    uint64_t limit = (~(uint64_t)0 >> 1) + 1; /* magnitude of the most negative value */
+    uint64_t total = 0;
+    int overflow = 0;
+    int neg = 0;
+
+    while (isspace(*ptr))
+        ptr++;
+    if (*ptr == '+' || *ptr == '-')
+        neg = (*ptr++ == '-');
+
+    /* a lone zero needs no unit */
+    if (ptr[0] == '0' && (ptr[1] == '\0' || isspace(ptr[1]))) {
+        ptr++;
+    } else {
+        do {
+            const unsigned char* start = ptr;
+            const unsigned char* frac = NULL;
+            const unsigned char* fracend = NULL;
+            uint64_t val = 0;
+            uint64_t unit = 0;
+            size_t i;
+
+            /* whole part */
+            for (; *ptr >= '0' && *ptr <= '9'; ptr++) {
+                unsigned int d = (unsigned int)(*ptr - '0');
+                if (val > (limit - d) / 10)
+                    overflow = 1;
+                else
+                    val = val * 10 + d;
+            }
+
+            /* fraction, resolved once the unit is known */
+            if (*ptr == '.') {
+                frac = ++ptr;
+                while (*ptr >= '0' && *ptr <= '9')
+                    ptr++;
+                fracend = ptr;
+            }
+            if (ptr == start || (ptr - start == 1 && *start == '.'))
+                return ARG_ERR_BADINT;
+
+            /* unit; "ms" is listed before "m" so the first match is the right one */
+            for (i = 0; i < sizeof(arg_duration_units) / sizeof(arg_duration_units[0]); i++) {
+                size_t len = strlen(arg_duration_units[i].name);
+                if (strncmp((const char*)ptr, arg_duration_units[i].name, len) == 0) {
+                    unit = arg_duration_units[i].nsec;
+                    ptr += len;
+                    break;
+                }
+            }
+            if (unit == 0)
+                return ARG_ERR_BADINT;
+
+            /* accumulate, saturating at the limit */
+            if (val > limit / unit) {
+                overflow = 1;
+            } else {
+                val *= unit;
+                if (frac)
+                    val += arg_duration_frac(frac, fracend, unit);
+                if (val > limit - total)
+                    overflow = 1;
+                else
+                    total += val;
+            }
+        } while ((*ptr >= '0' && *ptr <= '9') || *ptr == '.');
+    }
+
+    while (isspace(*ptr))
+        ptr++;
+    if (*ptr != '\0')
+        return ARG_ERR_BADINT;
+
+    if (overflow || total > limit - (neg ? 0 : 1))
+        return ARG_ERR_OVERFLOW;
+
+    *result = neg && total ? -(int64_t)(total - 1) - 1 : (int64_t)total;
+    return 0;
+}
+
+static int arg_duration_scanfn(void* parent_, const char* argval) {
+    struct arg_duration* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent argument value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        int64_t nsec;
+
+        errorcode = arg_duration_scan(argval, &nsec);
+
+        /* if success then store result in parent->nsec[] array */
+        if (errorcode == 0)
+            parent->nsec[parent->count++] = nsec;
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_duration_checkfn(void* parent_) {
+    struct arg_duration* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_duration_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_duration* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADINT:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_OVERFLOW:
+            arg_dstr_cat(ds, "integer overflow at option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, " ");
+            arg_dstr_catf(ds, "(%s is too large)\n", argval);
+            break;
+    }
+}
+
+static void* arg_duration_clonefn(void* parent_) {
+    struct arg_duration* parent = parent_;
+    struct arg_duration* result = (struct arg_duration*)arg_clone_block(parent, sizeof(struct arg_duration) + (size_t)(parent->hdr.maxcount + 1) * sizeof(int64_t));
+    result->nsec = (int64_t*)ARG_CLONE_PTR(result, parent, parent->nsec);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_duration_ext = {ARG_HDR_EXT_VERSION, NULL, arg_duration_clonefn};
+
+arg_duration_t* arg_duration0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_durationn(shortopts, longopts, datatype, 0, 1, glossary);
+}
+
+arg_duration_t* arg_duration1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_durationn(shortopts, longopts, datatype, 1, 1, glossary);
+}
+
+arg_duration_t* arg_durationn(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    size_t nbytes;
+    struct arg_duration* result;
+    size_t addr;
+    size_t rem;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_duration)                    /* storage for struct arg_duration */
+             + (size_t)(maxcount + 1) * sizeof(int64_t); /* storage for nsec[maxcount] array plus one extra for padding to memory boundary */
+
+    result = (struct arg_duration*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype ? datatype : "<duration>";
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_duration_resetfn;
+    result->hdr.scanfn = arg_duration_scanfn;
+    result->hdr.checkfn = arg_duration_checkfn;
+    result->hdr.errorfn = arg_duration_errorfn;
+    result->hdr.priv = (void*)&arg_duration_ext;
+
+    /* Store the nsec[maxcount] array on the first int64_t boundary that
+     * follows the arg_duration struct, as some platforms require 64-bit
+     * integers to be aligned on natural boundaries.
+     */
+    addr = (size_t)(result + 1);
+    rem = addr % sizeof(int64_t);
+    result->nsec = (int64_t*)(addr + sizeof(int64_t) - rem);
+    result->count = 0;
+
+    ARG_TRACE(("arg_durationn() returns %p\n", result));
+    return result;
+}
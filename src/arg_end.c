@@ -36,12 +36,668 @@
 #include "argtable3_private.h"
 #endif
 
+#include <ctype.h>
+#include <errno.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#if defined(_WIN32)
+#define ARG_ENVIRON _environ
+#elif defined(__APPLE__)
+#include <crt_externs.h>
+#define ARG_ENVIRON (*_NSGetEnviron())
+#else
+extern char** environ;
+#define ARG_ENVIRON environ
+#endif
+
+/* An option bound to an environment variable by arg_end_envbind() */
+struct arg_end_binding {
+    void* parent;
+    const char* name;
+};
+
+/* Where in a configuration file an error was found */
+struct arg_end_where {
+    const char* path;
+    int line;
+};
+
+/* A constraint between options, registered by arg_end_constrain() */
+struct arg_end_constraint {
+    int kind;
+    int nargs;
+    void** args; /* the options, args[0] being the one that requires the others for ARG_CONSTRAINT_REQUIRES */
+    int* index;  /* table index of each option, found on first use */
+    char* text;  /* names of the options, for error messages */
+};
+
+/* Response file expansion, allocated by arg_end_respfile() */
+struct arg_end_resp {
+    char** argv; /* expanded command line */
+    int maxargs;
+    int operands; /* non-zero once "--" has been seen, after which '@' is not special */
+};
+
+/* Options read from the environment, allocated by arg_end_envprefix() or arg_end_envbind() */
+struct arg_end_env {
+    const char* prefix; /* prefix of the variables derived from long options, or NULL */
+    struct arg_end_binding* bindings;
+    int nbindings;
+    int maxbindings;
+};
+
+/* Options read from configuration files, allocated by arg_end_config() */
+struct arg_end_conf {
+    const char** configs; /* configuration files, lowest precedence first */
+    int nconfigs;
+    int maxconfigs;
+    struct arg_end_where* where; /* location of each error[] from a configuration file */
+};
+
+/* Constraints between options, allocated by arg_end_constrain() */
+struct arg_end_rules {
+    struct arg_end_constraint* constraints;
+    int nconstraints;
+    int maxconstraints;
+};
+
+/*
+ * Private data of an arg_end, stored between the struct and its error[]
+ * array. Each feature keeps its state in a struct of its own, allocated when
+ * the feature is set up, so an arg_end that uses none of them only carries
+ * the pointers. The response and configuration files of the last parse stay
+ * mapped, because the expanded argv[] and the values of the options point
+ * into them.
+ */
+struct arg_end_priv {
+    struct arg_hdr_ext ext; /* must come first, see ARG_HASEXT */
+    arg_mmap_t* files;      /* response and configuration files of the last parse */
+    int nfiles;
+    int maxfiles;
+    struct arg_end_resp* resp; /* NULL unless response files are expanded */
+    struct arg_end_env* env;
+    struct arg_end_conf* conf;
+    struct arg_end_rules* rules;
+};
+
+/* A response file being expanded, linked to the one that refers to it */
+struct arg_end_frame {
+    const struct arg_end_frame* up;
+#ifdef _WIN32
+    const char* path; /* st_ino is always 0 on Windows */
+#else
+    dev_t dev;
+    ino_t ino;
+#endif
+};
+
+/* Releases the response and configuration files of the last parse */
+static void arg_end_release(struct arg_end* parent) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)parent->hdr.priv;
+
+    while (priv->nfiles > 0)
+        arg_mmap_close(&priv->files[--priv->nfiles]);
+}
+
+/* Maps a response or configuration file for the rest of the parse */
+static arg_mmap_t* arg_end_map(struct arg_end_priv* priv, const char* path) {
+    arg_mmap_t* map;
+
+    if (priv->nfiles == priv->maxfiles) {
+        priv->maxfiles = priv->maxfiles ? priv->maxfiles * 2 : 4;
+        priv->files = (arg_mmap_t*)xrealloc(priv->files, sizeof(arg_mmap_t) * (size_t)priv->maxfiles);
+    }
+    map = &priv->files[priv->nfiles];
+    if (arg_mmap_open(map, path) != 0)
+        return NULL;
+    priv->nfiles++;
+    return map;
+}
 
 static void arg_end_resetfn(void* parent_) {
     struct arg_end* parent = parent_;
+    struct arg_end_priv* priv = (struct arg_end_priv*)parent->hdr.priv;
     ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
     parent->count = 0;
+    arg_end_release(parent);
+    if (priv->conf)
+        memset(priv->conf->where, 0, sizeof(struct arg_end_where) * (size_t)parent->hdr.maxcount);
+}
+
+static void arg_end_freefn(void* parent_) {
+    struct arg_end* parent = parent_;
+    struct arg_end_priv* priv = (struct arg_end_priv*)parent->hdr.priv;
+    ARG_TRACE(("%s:freefn(%p)\n", __FILE__, parent));
+    arg_end_release(parent);
+    xfree(priv->files);
+    if (priv->resp) {
+        xfree(priv->resp->argv);
+        xfree(priv->resp);
+    }
+    if (priv->env) {
+        xfree(priv->env->bindings);
+        xfree(priv->env);
+    }
+    if (priv->conf) {
+        xfree(priv->conf->configs);
+        xfree(priv->conf->where);
+        xfree(priv->conf);
+    }
+    if (priv->rules) {
+        while (priv->rules->nconstraints > 0)
+            xfree(priv->rules->constraints[--priv->rules->nconstraints].args);
+        xfree(priv->rules->constraints);
+        xfree(priv->rules);
+    }
+}
+
+/* Returns the environment settings, allocating them on first use */
+static struct arg_end_env* arg_end_env(struct arg_end* end) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+
+    if (!priv->env)
+        priv->env = (struct arg_end_env*)xcalloc(1, sizeof(struct arg_end_env));
+    return priv->env;
+}
+
+static void arg_end_push(struct arg_end_resp* resp, int* argc, char* arg) {
+    /* keep room for the NULL that terminates argv[] */
+    if (*argc + 1 >= resp->maxargs) {
+        resp->maxargs *= 2;
+        resp->argv = (char**)xrealloc(resp->argv, sizeof(char*) * (size_t)resp->maxargs);
+    }
+    resp->argv[(*argc)++] = arg;
+}
+
+/*
+ * Appends the words of the response file named by ref, which is "@path", to
+ * the expanded argv[]. The words are tokenized in place in the mapping, and
+ * words that start with '@' are expanded in turn, unless the file they name
+ * is already being expanded.
+ */
+static void arg_end_include(struct arg_end* end, char* ref, const struct arg_end_frame* up, int* argc) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    const struct arg_end_frame* frame;
+    struct arg_end_frame self;
+    arg_scanner_t scanner;
+    arg_mmap_t* map;
+    struct stat st;
+    char* word;
+
+    if (stat(ref + 1, &st) != 0) {
+        arg_register_error(end, end, ARG_ERESPFILE, ref);
+        return;
+    }
+
+    self.up = up;
+#ifdef _WIN32
+    self.path = ref + 1;
+    for (frame = up; frame; frame = frame->up) {
+        if (strcmp(frame->path, self.path) == 0)
+            break;
+    }
+#else
+    self.dev = st.st_dev;
+    self.ino = st.st_ino;
+    for (frame = up; frame; frame = frame->up) {
+        if (frame->dev == self.dev && frame->ino == self.ino)
+            break;
+    }
+#endif
+    if (frame) {
+        arg_register_error(end, end, ARG_ERESPCYCLE, ref);
+        return;
+    }
+
+    map = arg_end_map(priv, ref + 1);
+    if (!map) {
+        arg_register_error(end, end, ARG_ERESPFILE, ref);
+        return;
+    }
+
+    arg_scanner_init(&scanner, map->data, map->len, 0);
+    while (arg_scan_word(&scanner, &word)) {
+        if (!priv->resp->operands && !scanner.quoted && word[0] == '@' && word[1] != '\0') {
+            arg_end_include(end, word, &self, argc);
+        } else {
+            if (strcmp(word, "--") == 0)
+                priv->resp->operands = 1;
+            arg_end_push(priv->resp, argc, word);
+        }
+    }
+}
+
+int arg_end_expand(struct arg_end* end, int argc, char** argv, char*** expanded) {
+    struct arg_end_resp* resp = ((struct arg_end_priv*)end->hdr.priv)->resp;
+    int n = 0;
+    int i;
+
+    *expanded = argv;
+    if (!resp)
+        return argc;
+
+    /*
+     * Leave argv[] alone unless it refers to a response file, argv[0] being
+     * the program name. Words after "--" are operands, so "@name" there is
+     * passed on as it is, as is a quoted "@name" inside a response file.
+     */
+    for (i = 1; i < argc && strcmp(argv[i], "--") != 0; i++) {
+        if (argv[i][0] == '@' && argv[i][1] != '\0')
+            break;
+    }
+    if (i == argc || argv[i][0] != '@')
+        return argc;
+
+    resp->operands = 0;
+    for (i = 0; i < argc; i++) {
+        if (i > 0 && !resp->operands && argv[i][0] == '@' && argv[i][1] != '\0') {
+            arg_end_include(end, argv[i], NULL, &n);
+        } else {
+            if (i > 0 && strcmp(argv[i], "--") == 0)
+                resp->operands = 1;
+            arg_end_push(resp, &n, argv[i]);
+        }
+    }
+    resp->argv[n] = NULL;
+
+    *expanded = resp->argv;
+    return n;
+}
+
+/* Hashes an environment variable name, which ends at the '=' of an environ[] entry */
+static unsigned int arg_end_envhash(const void* key) {
+    const unsigned char* p = (const unsigned char*)key;
+    unsigned int hash = 5381;
+
+    while (*p && *p != '=')
+        hash = hash * 33 + *p++;
+    return hash;
+}
+
+static int arg_end_enveq(const void* k1, const void* k2) {
+    const char* a = (const char*)k1;
+    const char* b = (const char*)k2;
+
+    while (*a && *a != '=' && *a == *b) {
+        a++;
+        b++;
+    }
+    return (*a == '\0' || *a == '=') && (*b == '\0' || *b == '=');
+}
+
+/* Returns non-zero unless a flag's variable is empty or one of 0, false, no and off */
+static int arg_end_envtrue(const char* value) {
+    static const char* const off[] = {"", "0", "false", "no", "off"};
+    size_t i;
+
+    for (i = 0; i < sizeof(off) / sizeof(off[0]); i++) {
+        const char* a = value;
+        const char* b = off[i];
+        while (*a && tolower((unsigned char)*a) == *b) {
+            a++;
+            b++;
+        }
+        if (*a == '\0' && *b == '\0')
+            return 0;
+    }
+    return 1;
+}
+
+/* Hashes the parent of an option, as bound by arg_end_envbind() */
+static unsigned int arg_end_parenthash(const void* key) {
+    return (unsigned int)((size_t)key >> 3);
+}
+
+static int arg_end_parenteq(const void* k1, const void* k2) {
+    return k1 == k2;
+}
+
+/* Returns the variable an option is bound to, building a name from the prefix in buf if needed */
+static const char* arg_end_envname(const struct arg_end_env* env, arg_hashtable_t* bound, struct arg_hdr* hdr, arg_dstr_t buf) {
+    const struct arg_end_binding* binding;
+    const char* p;
+
+    /* a binding with a NULL name keeps the option out of the environment */
+    binding = bound ? (const struct arg_end_binding*)arg_hashtable_search(bound, hdr->parent) : NULL;
+    if (binding)
+        return binding->name;
+    if (!env->prefix || !hdr->longopts || !*hdr->longopts)
+        return NULL;
+
+    /* --dry-run with the prefix MYTOOL_ is read from MYTOOL_DRY_RUN */
+    arg_dstr_reset(buf);
+    arg_dstr_cat(buf, env->prefix);
+    for (p = hdr->longopts; *p && *p != ','; p++)
+        arg_dstr_catc(buf, *p == '-' ? '_' : (char)toupper((unsigned char)*p));
+    return arg_dstr_cstr(buf);
+}
+
+/*
+ * Scans a value from the environment or a configuration file. A flag without
+ * a value is set, or left alone if the value turns it off. Returns non-zero
+ * if the option was scanned, with the error of its scanfn in *errorcode.
+ */
+static int arg_end_scan(struct arg_hdr* hdr, const char* value, int* errorcode) {
+    if (hdr->flag & ARG_HASVALUE)
+        *errorcode = hdr->scanfn(hdr->parent, value);
+    else if (!value || arg_end_envtrue(value))
+        *errorcode = hdr->scanfn(hdr->parent, NULL);
+    else
+        return 0;
+    return 1;
+}
+
+/* Reads the options the command line left out from the environment, marking them in given */
+static void arg_end_envscan(struct arg_end* end, struct arg_hdr** table, arg_bits_t* given) {
+    const struct arg_end_env* settings = ((struct arg_end_priv*)end->hdr.priv)->env;
+    char** env = ARG_ENVIRON;
+    size_t prefixlen = (settings->nbindings == 0 && settings->prefix) ? strlen(settings->prefix) : 0;
+    arg_hashtable_t* index;
+    arg_hashtable_t* bound = NULL;
+    arg_dstr_t buf;
+    int tabindex;
+    int n = 0;
+    int i;
+
+    /*
+     * Index environ[] once, so each option costs one lookup rather than a
+     * getenv() scan. The keys and values point into environ[] itself.
+     * Entries are inserted last to first, so the first of two variables
+     * with the same name is found, as with getenv().
+     */
+    while (env && env[n])
+        n++;
+    index = arg_hashtable_create((unsigned int)(n + n / 2), arg_end_envhash, arg_end_enveq);
+    index->freekeys = 0;
+    for (i = n - 1; i >= 0; i--) {
+        char* eq;
+
+        /* with only a prefix rule, other variables can never match */
+        if (prefixlen && strncmp(env[i], settings->prefix, prefixlen) != 0)
+            continue;
+        eq = strchr(env[i], '=');
+        if (eq)
+            arg_hashtable_insert(index, env[i], eq + 1);
+    }
+
+    /* likewise the bindings, so finding the name of an option does not depend on their number */
+    if (settings->nbindings > 0) {
+        bound = arg_hashtable_create((unsigned int)(settings->nbindings + settings->nbindings / 2), arg_end_parenthash, arg_end_parenteq);
+        bound->freekeys = 0;
+        for (i = 0; i < settings->nbindings; i++)
+            arg_hashtable_insert(bound, settings->bindings[i].parent, &settings->bindings[i]);
+    }
+
+    buf = arg_dstr_create();
+    for (tabindex = 0; !(table[tabindex]->flag & ARG_TERMINATOR); tabindex++) {
+        struct arg_hdr* hdr = table[tabindex];
+        const char* name;
+        const char* value;
+        int errorcode;
+
+        /* options given on the command line take precedence over the environment */
+        if (ARG_BITS_TEST(given, tabindex) || !hdr->scanfn || (!hdr->shortopts && !hdr->longopts))
+            continue;
+
+        name = arg_end_envname(settings, bound, hdr, buf);
+        value = name ? (const char*)arg_hashtable_search(index, name) : NULL;
+        if (!value || !arg_end_scan(hdr, value, &errorcode))
+            continue;
+
+        ARG_BITS_SET(given, tabindex);
+        if (errorcode != 0)
+            arg_register_error(end, hdr->parent, errorcode, value);
+    }
+
+    arg_dstr_destroy(buf);
+    if (bound)
+        arg_hashtable_destroy(bound, 0);
+    arg_hashtable_destroy(index, 0);
+}
+
+/* Hashes a long option name, which ends at the ',' before the next alias in longopts */
+static unsigned int arg_end_opthash(const void* key) {
+    const unsigned char* p = (const unsigned char*)key;
+    unsigned int hash = 5381;
+
+    while (*p && *p != ',')
+        hash = hash * 33 + *p++;
+    return hash;
+}
+
+static int arg_end_opteq(const void* k1, const void* k2) {
+    const char* a = (const char*)k1;
+    const char* b = (const char*)k2;
+
+    while (*a && *a != ',' && *a == *b) {
+        a++;
+        b++;
+    }
+    return (*a == '\0' || *a == ',') && (*b == '\0' || *b == ',');
+}
+
+/* Records an error found in a configuration file, with its location */
+static void arg_end_configerror(struct arg_end* end, void* parent, int error, const char* argval, const char* path, int line) {
+    struct arg_end_where* where = ((struct arg_end_priv*)end->hdr.priv)->conf->where;
+    int i = end->count;
+
+    arg_register_error(end, parent, error, argval);
+    if (end->count > i) {
+        where[i].path = path;
+        where[i].line = line;
+    }
+}
+
+#define ARG_END_ISBLANK(c) ((c) == ' ' || (c) == '\t' || (c) == '\r' || (c) == '\f' || (c) == '\v')
+#define ARG_END_ISKEY(c) (isalnum((unsigned char)(c)) || (c) == '-' || (c) == '_' || (c) == '.')
+
+/*
+ * Reads one configuration file in a single pass over its mapping. Each line
+ * is empty, a comment starting with '#' or ';', a "[section]" header, which
+ * is ignored, or "key = value", where key is a long option. A value can be
+ * enclosed in single or double quotes to keep leading or trailing blanks,
+ * and a key without "= value" sets a flag. Keys and values are terminated
+ * in place, so the values of the options point into the mapping. Options
+ * marked in given are skipped, and the options the file sets are marked in
+ * seen.
+ */
+static void arg_end_configscan(struct arg_end* end, struct arg_hdr** table, arg_hashtable_t* keys, const char* path, const arg_bits_t* given,
+                               arg_bits_t* seen) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    arg_mmap_t* map;
+    char* p;
+    char* eof;
+    int line = 0;
+
+    errno = 0;
+    map = arg_end_map(priv, path);
+    if (!map) {
+        /* a layer that does not exist is simply left out */
+        if (errno != ENOENT)
+            arg_end_configerror(end, end, ARG_ECONFFILE, path, path, 0);
+        return;
+    }
+
+    p = map->data;
+    eof = map->data + map->len;
+    while (p < eof) {
+        char* eol = (char*)memchr(p, '\n', (size_t)(eof - p));
+        char* next;
+        char* key;
+        char* keyend;
+        char* value = NULL;
+        struct arg_hdr** slot;
+        int tabindex;
+        int errorcode;
+
+        if (!eol)
+            eol = eof;
+        next = eol < eof ? eol + 1 : eof;
+        line++;
+
+        /* trim the line */
+        while (p < eol && ARG_END_ISBLANK(*p))
+            p++;
+        while (eol > p && ARG_END_ISBLANK(eol[-1]))
+            eol--;
+        if (p == eol || *p == '#' || *p == ';' || (*p == '[' && eol[-1] == ']')) {
+            p = next;
+            continue;
+        }
+
+        key = p;
+        while (p < eol && ARG_END_ISKEY(*p))
+            p++;
+        keyend = p;
+        while (p < eol && ARG_END_ISBLANK(*p))
+            p++;
+
+        *eol = '\0';
+        if (keyend == key || (p < eol && *p != '=')) {
+            arg_end_configerror(end, end, ARG_ECONFSYNTAX, key, path, line);
+            p = next;
+            continue;
+        }
+
+        if (p < eol) {
+            for (p++; p < eol && ARG_END_ISBLANK(*p); p++)
+                ;
+            value = p;
+            if (eol - value >= 2 && (*value == '"' || *value == '\'') && eol[-1] == *value) {
+                value++;
+                eol[-1] = '\0';
+            }
+        }
+        *keyend = '\0';
+        p = next;
+
+        slot = (struct arg_hdr**)arg_hashtable_search(keys, key);
+        if (!slot) {
+            arg_end_configerror(end, end, ARG_ECONFKEY, key, path, line);
+            continue;
+        }
+
+        /* options from a layer of higher precedence are kept */
+        tabindex = (int)(slot - table);
+        if (ARG_BITS_TEST(given, tabindex))
+            continue;
+        ARG_BITS_SET(seen, tabindex);
+
+        if (!value && ((*slot)->flag & ARG_HASVALUE))
+            arg_end_configerror(end, end, ARG_EMISSARG, key, path, line);
+        else if (arg_end_scan(*slot, value, &errorcode) && errorcode != 0)
+            arg_end_configerror(end, (*slot)->parent, errorcode, value, path, line);
+    }
+}
+
+int arg_end_hasrespfile(struct arg_end* end) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    return priv->resp != NULL;
+}
+
+int arg_end_haslayers(struct arg_end* end) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    return (priv->env && (priv->env->prefix || priv->env->nbindings > 0)) || (priv->conf && priv->conf->nconfigs > 0);
+}
+
+int arg_end_hasconstraints(struct arg_end* end) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    return priv->rules && priv->rules->nconstraints > 0;
+}
+
+void arg_end_checkconstraints(struct arg_end* end, struct arg_hdr** table, const arg_bits_t* present) {
+    struct arg_end_rules* rules = ((struct arg_end_priv*)end->hdr.priv)->rules;
+    int ntable;
+    int i, j;
+
+    for (ntable = 0; !(table[ntable]->flag & ARG_TERMINATOR); ntable++)
+        ;
+
+    for (i = 0; i < rules->nconstraints; i++) {
+        struct arg_end_constraint* c = &rules->constraints[i];
+        int npresent = 0;
+        int first = 0;
+
+        for (j = 0; j < c->nargs; j++) {
+            int* index = &c->index[j];
+
+            /* the index is kept from the last parse, unless the option has moved */
+            if (*index < 0 || *index >= ntable || table[*index] != c->args[j]) {
+                for (*index = 0; *index < ntable && table[*index] != c->args[j]; (*index)++)
+                    ;
+            }
+            if (*index < ntable && ARG_BITS_TEST(present, *index)) {
+                npresent++;
+                if (j == 0)
+                    first = 1;
+            }
+        }
+
+        switch (c->kind) {
+            case ARG_CONSTRAINT_EXCLUSIVE:
+                if (npresent > 1)
+                    arg_register_error(end, end, ARG_EEXCLUSIVE, c->text);
+                break;
+            case ARG_CONSTRAINT_REQUIRES:
+                if (first && npresent < c->nargs)
+                    arg_register_error(end, end, ARG_EREQUIRES, c->text);
+                break;
+            case ARG_CONSTRAINT_ANYOF:
+                if (npresent == 0)
+                    arg_register_error(end, end, ARG_EANYOF, c->text);
+                break;
+        }
+    }
+}
+
+void arg_end_scanlayers(struct arg_end* end, struct arg_hdr** table, arg_bits_t* given) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    arg_hashtable_t* keys;
+    arg_bits_t* seen;
+    size_t nwords;
+    size_t w;
+    int ntable;
+    int tabindex;
+    int i;
+
+    if (priv->env && (priv->env->prefix || priv->env->nbindings > 0))
+        arg_end_envscan(end, table, given);
+    if (!priv->conf || priv->conf->nconfigs == 0)
+        return;
+
+    /* index the long options of the table, and each of their aliases, once for all files */
+    for (ntable = 0; !(table[ntable]->flag & ARG_TERMINATOR); ntable++)
+        ;
+    keys = arg_hashtable_create((unsigned int)(2 * ntable), arg_end_opthash, arg_end_opteq);
+    keys->freekeys = 0;
+    for (tabindex = 0; tabindex < ntable; tabindex++) {
+        const char* p = table[tabindex]->longopts;
+        if (!p || !table[tabindex]->scanfn)
+            continue;
+        while (*p) {
+            if (*p != ',')
+                arg_hashtable_insert(keys, (void*)p, &table[tabindex]);
+            while (*p && *p != ',')
+                p++;
+            if (*p)
+                p++;
+        }
+    }
+
+    /* read the files from the highest precedence down, each keeping what the ones before it set */
+    nwords = ARG_BITS_LEN(ntable + 1);
+    seen = (arg_bits_t*)xcalloc(nwords, sizeof(arg_bits_t));
+    for (i = priv->conf->nconfigs - 1; i >= 0; i--) {
+        arg_end_configscan(end, table, keys, priv->conf->configs[i], given, seen);
+        for (w = 0; w < nwords; w++)
+            given[w] |= seen[w];
+    }
+
+    xfree(seen);
+    arg_hashtable_destroy(keys, 0);
 }
 
 static void arg_end_errorfn(void* parent, arg_dstr_t ds, int error, const char* argval, const char* progname) {
@@ -65,6 +721,30 @@ static void arg_end_errorfn(void* parent, arg_dstr_t ds, int error, const char*
         case ARG_EMISSARG:
             arg_dstr_catf(ds, "option \"%s\" requires an argument", argval);
             break;
+        case ARG_ERESPFILE:
+            arg_dstr_catf(ds, "cannot read response file \"%s\"", argval + (*argval == '@'));
+            break;
+        case ARG_ERESPCYCLE:
+            arg_dstr_catf(ds, "response file \"%s\" refers to itself", argval + (*argval == '@'));
+            break;
+        case ARG_ECONFFILE:
+            arg_dstr_catf(ds, "cannot read configuration file \"%s\"", argval);
+            break;
+        case ARG_ECONFKEY:
+            arg_dstr_catf(ds, "unknown option \"%s\"", argval);
+            break;
+        case ARG_ECONFSYNTAX:
+            arg_dstr_catf(ds, "invalid line \"%s\"", argval);
+            break;
+        case ARG_EEXCLUSIVE:
+            arg_dstr_catf(ds, "only one of %s may be given", argval);
+            break;
+        case ARG_EREQUIRES:
+            arg_dstr_catf(ds, "option %s", argval);
+            break;
+        case ARG_EANYOF:
+            arg_dstr_catf(ds, "one of %s is required", argval);
+            break;
         case ARG_ELONGOPT:
             arg_dstr_catf(ds, "invalid option \"%s\"", argval);
             break;
@@ -76,18 +756,131 @@ static void arg_end_errorfn(void* parent, arg_dstr_t ds, int error, const char*
     arg_dstr_cat(ds, "\n");
 }
 
+/* Registers a constraint that arg_end_constrain() has validated */
+static void arg_end_addconstraint(struct arg_end* end, int kind, void** args, int nargs) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    struct arg_end_rules* rules;
+    struct arg_end_constraint* c;
+    arg_dstr_t ds = arg_dstr_create();
+    size_t len;
+    int i;
+
+    for (i = 0; i < nargs; i++) {
+        struct arg_hdr* hdr = (struct arg_hdr*)args[i];
+
+        if (i > 0)
+            arg_dstr_cat(ds, (kind == ARG_CONSTRAINT_REQUIRES && i == 1) ? " requires " : ", ");
+        arg_print_option_ds(ds, hdr->shortopts, hdr->longopts, (hdr->shortopts || hdr->longopts) ? NULL : hdr->datatype, NULL);
+    }
+    len = strlen(arg_dstr_cstr(ds)) + 1;
+
+    if (!priv->rules)
+        priv->rules = (struct arg_end_rules*)xcalloc(1, sizeof(struct arg_end_rules));
+    rules = priv->rules;
+    if (rules->nconstraints == rules->maxconstraints) {
+        rules->maxconstraints = rules->maxconstraints ? rules->maxconstraints * 2 : 4;
+        rules->constraints =
+            (struct arg_end_constraint*)xrealloc(rules->constraints, sizeof(struct arg_end_constraint) * (size_t)rules->maxconstraints);
+    }
+    c = &rules->constraints[rules->nconstraints++];
+    c->kind = kind;
+    c->nargs = nargs;
+
+    /* the options, their indexes and the text share one block */
+    c->args = (void**)xmalloc((sizeof(void*) + sizeof(int)) * (size_t)nargs + len);
+    c->index = (int*)(c->args + nargs);
+    c->text = (char*)(c->index + nargs);
+    for (i = 0; i < nargs; i++) {
+        c->args[i] = args[i];
+        c->index[i] = -1;
+    }
+    memcpy(c->text, arg_dstr_cstr(ds), len);
+    arg_dstr_destroy(ds);
+}
+
+/* Copies the terminator with its settings, but none of the errors or files of the last parse */
+static void* arg_end_clonefn(void* parent_) {
+    struct arg_end* parent = parent_;
+    struct arg_end_priv* priv = (struct arg_end_priv*)parent->hdr.priv;
+    struct arg_end_priv* rpriv;
+    struct arg_end* result;
+    size_t maxcount = (size_t)parent->hdr.maxcount;
+    int i;
+
+    result = (struct arg_end*)arg_clone_block(
+        parent, sizeof(struct arg_end) + sizeof(struct arg_end_priv) + maxcount * (sizeof(int) + sizeof(void*) + sizeof(char*)));
+    result->error = (int*)ARG_CLONE_PTR(result, parent, parent->error);
+    result->parent = (void**)ARG_CLONE_PTR(result, parent, parent->parent);
+    result->argval = (const char**)ARG_CLONE_PTR(result, parent, parent->argval);
+    result->count = 0;
+
+    /* the features are set up again rather than sharing the parent's state */
+    rpriv = (struct arg_end_priv*)ARG_CLONE_PTR(result, parent, priv);
+    rpriv->files = NULL;
+    rpriv->nfiles = 0;
+    rpriv->maxfiles = 0;
+    rpriv->resp = NULL;
+    rpriv->env = NULL;
+    rpriv->conf = NULL;
+    rpriv->rules = NULL;
+    result->hdr.priv = rpriv;
+
+    if (priv->resp)
+        arg_end_respfile(result, 1);
+    if (priv->env) {
+        arg_end_envprefix(result, priv->env->prefix);
+        for (i = 0; i < priv->env->nbindings; i++)
+            arg_end_envbind(result, priv->env->bindings[i].parent, priv->env->bindings[i].name);
+    }
+    if (priv->conf) {
+        for (i = 0; i < priv->conf->nconfigs; i++)
+            arg_end_config(result, priv->conf->configs[i]);
+    }
+    if (priv->rules) {
+        for (i = 0; i < priv->rules->nconstraints; i++) {
+            struct arg_end_constraint* c = &priv->rules->constraints[i];
+            arg_end_addconstraint(result, c->kind, c->args, c->nargs);
+        }
+    }
+    return result;
+}
+
+void arg_end_rebind(struct arg_end* end, void* from, void* to) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    int i;
+
+    for (i = 0; priv->env && i < priv->env->nbindings; i++) {
+        if (priv->env->bindings[i].parent == from)
+            priv->env->bindings[i].parent = to;
+    }
+    for (i = 0; priv->rules && i < priv->rules->nconstraints; i++) {
+        struct arg_end_constraint* c = &priv->rules->constraints[i];
+        int j;
+
+        for (j = 0; j < c->nargs; j++) {
+            if (c->args[j] == from)
+                c->args[j] = to;
+        }
+    }
+}
+
+/* The optional functions of an arg_end */
+static const struct arg_hdr_ext arg_end_ext = {ARG_HDR_EXT_VERSION, arg_end_freefn, arg_end_clonefn};
+
 struct arg_end* arg_end(int maxcount) {
     size_t nbytes;
     struct arg_end* result;
+    struct arg_end_priv* priv;
 
-    nbytes = sizeof(struct arg_end) + (size_t)maxcount * sizeof(int) /* storage for int error[maxcount] array*/
-             + (size_t)maxcount * sizeof(void*)                      /* storage for void* parent[maxcount] array */
-             + (size_t)maxcount * sizeof(char*);                     /* storage for char* argval[maxcount] array */
+    nbytes = sizeof(struct arg_end) + sizeof(struct arg_end_priv) /* storage for the private data */
+             + (size_t)maxcount * sizeof(int)                      /* storage for int error[maxcount] array*/
+             + (size_t)maxcount * sizeof(void*)                    /* storage for void* parent[maxcount] array */
+             + (size_t)maxcount * sizeof(char*);                   /* storage for char* argval[maxcount] array */
 
     result = (struct arg_end*)xmalloc(nbytes);
 
     /* init the arg_hdr struct */
-    result->hdr.flag = ARG_TERMINATOR;
+    result->hdr.flag = ARG_TERMINATOR | ARG_HASEXT;
     result->hdr.shortopts = NULL;
     result->hdr.longopts = NULL;
     result->hdr.datatype = NULL;
@@ -100,8 +893,14 @@ struct arg_end* arg_end(int maxcount) {
     result->hdr.checkfn = NULL;
     result->hdr.errorfn = arg_end_errorfn;
 
-    /* store error[maxcount] array immediately after struct arg_end */
-    result->error = (int*)(result + 1);
+    /* store the private data immediately after struct arg_end */
+    priv = (struct arg_end_priv*)(result + 1);
+    memset(priv, 0, sizeof(struct arg_end_priv));
+    priv->ext = arg_end_ext;
+    result->hdr.priv = priv;
+
+    /* store error[maxcount] array immediately after the private data */
+    result->error = (int*)(priv + 1);
 
     /* store parent[maxcount] array immediately after error[] array */
     result->parent = (void**)(result->error + maxcount);
@@ -114,13 +913,31 @@ struct arg_end* arg_end(int maxcount) {
 }
 
 void arg_print_errors_ds(arg_dstr_t ds, struct arg_end* end, const char* progname) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    struct arg_end_where* where = priv->conf ? priv->conf->where : NULL;
+    arg_dstr_t located = NULL;
     int i;
     ARG_TRACE(("arg_errors()\n"));
     for (i = 0; i < end->count; i++) {
         struct arg_hdr* errorparent = (struct arg_hdr*)(end->parent[i]);
+        const char* name = progname;
+
+        /* errors from a configuration file name the file and line after the program */
+        if (where && where[i].path && end->error[i] != ARG_ELIMIT) {
+            if (!located)
+                located = arg_dstr_create();
+            arg_dstr_reset(located);
+            arg_dstr_catf(located, "%s%s%s", progname ? progname : "", progname && *progname ? ": " : "", where[i].path);
+            if (where[i].line > 0)
+                arg_dstr_catf(located, ":%d", where[i].line);
+            name = arg_dstr_cstr(located);
+        }
+
         if (errorparent->errorfn)
-            errorparent->errorfn(end->parent[i], ds, end->error[i], end->argval[i], progname);
+            errorparent->errorfn(end->parent[i], ds, end->error[i], end->argval[i], name);
     }
+    if (located)
+        arg_dstr_destroy(located);
 }
 
 void arg_print_errors(FILE* fp, struct arg_end* end, const char* progname) {
@@ -129,3 +946,100 @@ void arg_print_errors(FILE* fp, struct arg_end* end, const char* progname) {
     fputs(arg_dstr_cstr(ds), fp);
     arg_dstr_destroy(ds);
 }
+
+void arg_end_respfile(struct arg_end* end, int enable) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+
+    if (enable && !priv->resp) {
+        priv->resp = (struct arg_end_resp*)xmalloc(sizeof(struct arg_end_resp));
+        priv->resp->maxargs = 64;
+        priv->resp->operands = 0;
+        priv->resp->argv = (char**)xmalloc(sizeof(char*) * (size_t)priv->resp->maxargs);
+    } else if (!enable && priv->resp) {
+        arg_end_release(end);
+        xfree(priv->resp->argv);
+        xfree(priv->resp);
+        priv->resp = NULL;
+    }
+}
+
+void arg_end_envprefix(struct arg_end* end, const char* prefix) {
+    arg_end_env(end)->prefix = prefix;
+}
+
+void arg_end_envbind(struct arg_end* end, void* arg, const char* name) {
+    struct arg_end_env* env = arg_end_env(end);
+    int i;
+
+    for (i = 0; i < env->nbindings; i++) {
+        if (env->bindings[i].parent == arg) {
+            env->bindings[i].name = name;
+            return;
+        }
+    }
+
+    if (env->nbindings == env->maxbindings) {
+        env->maxbindings = env->maxbindings ? env->maxbindings * 2 : 8;
+        env->bindings = (struct arg_end_binding*)xrealloc(env->bindings, sizeof(struct arg_end_binding) * (size_t)env->maxbindings);
+    }
+    env->bindings[env->nbindings].parent = arg;
+    env->bindings[env->nbindings].name = name;
+    env->nbindings++;
+}
+
+void arg_end_config(struct arg_end* end, const char* path) {
+    struct arg_end_priv* priv = (struct arg_end_priv*)end->hdr.priv;
+    struct arg_end_conf* conf = priv->conf;
+
+    if (!path) {
+        if (conf)
+            conf->nconfigs = 0;
+        return;
+    }
+
+    if (!conf) {
+        conf = (struct arg_end_conf*)xcalloc(1, sizeof(struct arg_end_conf));
+        conf->where = (struct arg_end_where*)xcalloc((size_t)end->hdr.maxcount, sizeof(struct arg_end_where));
+        priv->conf = conf;
+    }
+    if (conf->nconfigs == conf->maxconfigs) {
+        conf->maxconfigs = conf->maxconfigs ? conf->maxconfigs * 2 : 4;
+        conf->configs = (const char**)xrealloc((void*)conf->configs, sizeof(const char*) * (size_t)conf->maxconfigs);
+    }
+    conf->configs[conf->nconfigs++] = path;
+}
+
+int arg_end_constrain(void** argtable, int kind, void** args, int nargs) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    int ntable;
+    int i, j;
+
+    for (ntable = 0; !(table[ntable]->flag & ARG_TERMINATOR); ntable++)
+        ;
+
+    if (kind != ARG_CONSTRAINT_EXCLUSIVE && kind != ARG_CONSTRAINT_REQUIRES && kind != ARG_CONSTRAINT_ANYOF) {
+        ARG_LOG(("argtable: ERROR - unknown constraint kind %d\n", kind));
+        ARG_LOG(("argtable: Bad argument table.\n"));
+        return -1;
+    }
+
+    /* with fewer options, an exclusion or a requirement could never be violated */
+    if (!args || nargs < (kind == ARG_CONSTRAINT_ANYOF ? 1 : 2)) {
+        ARG_LOG(("argtable: ERROR - too few options (%d) for a constraint\n", nargs));
+        ARG_LOG(("argtable: Bad argument table.\n"));
+        return -1;
+    }
+
+    for (i = 0; i < nargs; i++) {
+        for (j = 0; j < ntable && argtable[j] != args[i]; j++)
+            ;
+        if (j == ntable) {
+            ARG_LOG(("argtable: ERROR - option %d of a constraint is not an entry of the table\n", i));
+            ARG_LOG(("argtable: Bad argument table.\n"));
+            return -1;
+        }
+    }
+
+    arg_end_addconstraint((struct arg_end*)table[ntable], kind, args, nargs);
+    return 0;
+}
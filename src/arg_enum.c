@@ -0,0 +1,392 @@
+/*******************************************************************************
+ * arg_enum: Implements the enumerated choice command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <ctype.h>
+#include <string.h>
+
+/*
+ * The choices are stored in a minimal perfect hash table built with the
+ * "hash, displace" method: every key is first hashed into one of n buckets,
+ * and each bucket then records how to place its keys in the n slots. For a
+ * bucket with several keys, disp[] holds the seed of a second hash that sends
+ * all of them to free slots; for a bucket with a single key, disp[] holds
+ * -(slot + 1) so that the key lands in that slot directly. Looking a value up
+ * takes at most two hashes and one string comparison.
+ */
+struct arg_enum_priv {
+    struct arg_hdr_ext ext;     /* must come first, see ARG_HASEXT */
+    const char* const* choices; /* NULL terminated array of choices */
+    int nchoices;               /* number of choices, which is also the table size */
+    int flags;                  /* ARG_ENUM_ICASE */
+    int* disp;                  /* disp[nchoices] displacement of each bucket */
+    int* slot;                  /* slot[nchoices] index of the choice in each slot */
+};
+
+/* FNV-1a over the (optionally case folded) bytes of str, varied by seed and finished with the MurmurHash3 mixer */
+static unsigned int arg_enum_hash(const char* str, unsigned int seed, int icase) {
+    const unsigned char* ptr = (const unsigned char*)str;
+    unsigned int hash = 2166136261u ^ (seed * 2654435761u);
+
+    if (icase) {
+        for (; *ptr; ptr++)
+            hash = (hash ^ (unsigned int)tolower(*ptr)) * 16777619u;
+    } else {
+        for (; *ptr; ptr++)
+            hash = (hash ^ *ptr) * 16777619u;
+    }
+
+    /* the low bits of FNV-1a depend only on the low bits of the input, mix in the high ones */
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static int arg_enum_equal(const char* s1, const char* s2, int icase) {
+    const unsigned char* us1 = (const unsigned char*)s1;
+    const unsigned char* us2 = (const unsigned char*)s2;
+
+    if (!icase)
+        return strcmp(s1, s2) == 0;
+
+    while (tolower(*us1) == tolower(*us2)) {
+        if (*us1 == '\0')
+            return 1;
+        us1++;
+        us2++;
+    }
+    return 0;
+}
+
+/* Returns the index of the choice equal to str, or -1 if there is none */
+static int arg_enum_lookup(const struct arg_enum_priv* priv, const char* str) {
+    unsigned int n = (unsigned int)priv->nchoices;
+    int icase = priv->flags & ARG_ENUM_ICASE;
+    int d = priv->disp[arg_enum_hash(str, 0, icase) % n];
+    int i = priv->slot[d < 0 ? -d - 1 : (int)(arg_enum_hash(str, (unsigned int)d, icase) % n)];
+
+    return arg_enum_equal(priv->choices[i], str, icase) ? i : -1;
+}
+
+/*
+ * Builds the perfect hash table of priv->choices in priv->disp[] and
+ * priv->slot[]. Returns -1 on success, or the index of a choice equal to an
+ * earlier one, in which case no table can be built.
+ */
+static int arg_enum_build(struct arg_enum_priv* priv) {
+    int n = priv->nchoices;
+    int icase = priv->flags & ARG_ENUM_ICASE;
+    int* first = (int*)xmalloc(sizeof(int) * (size_t)n * 3); /* first key of each bucket */
+    int* next = first + n;                                   /* next key in the same bucket */
+    int* size = next + n;                                    /* number of keys in each bucket */
+    int maxsize = 0;
+    int duplicate = -1;
+    int b;
+    int i;
+    int s;
+
+    for (b = 0; b < n; b++) {
+        first[b] = -1;
+        size[b] = 0;
+        priv->disp[b] = 0;
+        priv->slot[b] = -1;
+    }
+
+    /* hash every key into its bucket, equal keys end up in the same one */
+    for (i = n - 1; i >= 0; i--) {
+        b = (int)(arg_enum_hash(priv->choices[i], 0, icase) % (unsigned int)n);
+        next[i] = first[b];
+        first[b] = i;
+        if (++size[b] > maxsize)
+            maxsize = size[b];
+    }
+
+    /* place the buckets with several keys first, largest first, as they are the hardest to place */
+    for (; maxsize > 1 && duplicate < 0; maxsize--) {
+        for (b = 0; b < n && duplicate < 0; b++) {
+            unsigned int seed;
+            int key;
+
+            if (size[b] != maxsize)
+                continue;
+
+            for (key = first[b]; key >= 0; key = next[key]) {
+                for (i = next[key]; i >= 0; i = next[i]) {
+                    if (arg_enum_equal(priv->choices[key], priv->choices[i], icase))
+                        duplicate = i;
+                }
+            }
+            if (duplicate >= 0)
+                break;
+
+            /* find a seed that sends every key of the bucket to a distinct free slot */
+            for (seed = 1;; seed++) {
+                for (key = first[b]; key >= 0; key = next[key]) {
+                    s = (int)(arg_enum_hash(priv->choices[key], seed, icase) % (unsigned int)n);
+                    if (priv->slot[s] >= 0)
+                        break;
+                    priv->slot[s] = key;
+                }
+                if (key < 0)
+                    break;
+
+                /* take back the keys placed with this seed */
+                for (key = first[b]; key >= 0; key = next[key]) {
+                    s = (int)(arg_enum_hash(priv->choices[key], seed, icase) % (unsigned int)n);
+                    if (priv->slot[s] == key)
+                        priv->slot[s] = -1;
+                }
+            }
+            priv->disp[b] = (int)seed;
+        }
+    }
+
+    /* the buckets with a single key go straight to the remaining free slots */
+    for (b = 0, s = 0; b < n && duplicate < 0; b++) {
+        if (size[b] != 1)
+            continue;
+        while (priv->slot[s] >= 0)
+            s++;
+        priv->slot[s] = first[b];
+        priv->disp[b] = -s - 1;
+    }
+
+    /* empty buckets keep a seed of 0, only values that are not choices hash to them */
+    xfree(first);
+    return duplicate;
+}
+
+static void arg_enum_resetfn(void* parent_) {
+    struct arg_enum* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+static int arg_enum_scanfn(void* parent_, const char* argval) {
+    struct arg_enum* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent argument value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        int i = arg_enum_lookup((const struct arg_enum_priv*)parent->hdr.priv, argval);
+
+        /* if success then store the index of the choice in parent->idx[] array */
+        if (i >= 0)
+            parent->idx[parent->count++] = i;
+        else
+            errorcode = ARG_ERR_BADENUM;
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_enum_checkfn(void* parent_) {
+    struct arg_enum* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_enum_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_enum* parent = parent_;
+    struct arg_enum_priv* priv = (struct arg_enum_priv*)parent->hdr.priv;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+    int i;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADENUM:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, " ");
+            arg_dstr_cat(ds, "(expected one of ");
+            for (i = 0; i < priv->nchoices; i++)
+                arg_dstr_catf(ds, i ? ", %s" : "%s", priv->choices[i]);
+            arg_dstr_cat(ds, ")\n");
+            break;
+    }
+}
+
+static void* arg_enum_clonefn(void* parent_) {
+    struct arg_enum* parent = parent_;
+    struct arg_enum_priv* priv = (struct arg_enum_priv*)parent->hdr.priv;
+    const char* str = (const char*)(priv->slot + priv->nchoices);
+    size_t nbytes;
+    struct arg_enum* result;
+    struct arg_enum_priv* rpriv;
+
+    nbytes = sizeof(struct arg_enum) + sizeof(struct arg_enum_priv) + (size_t)parent->hdr.maxcount * sizeof(int) +
+             (size_t)priv->nchoices * 2 * sizeof(int) + (parent->hdr.datatype == str ? strlen(str) + 1 : 0);
+    result = (struct arg_enum*)arg_clone_block(parent, nbytes);
+
+    /* the lookup table is only read while parsing, but lives in the same block */
+    result->hdr.priv = ARG_CLONE_PTR(result, parent, priv);
+    rpriv = (struct arg_enum_priv*)result->hdr.priv;
+    rpriv->disp = (int*)ARG_CLONE_PTR(result, parent, priv->disp);
+    rpriv->slot = (int*)ARG_CLONE_PTR(result, parent, priv->slot);
+    result->idx = (int*)ARG_CLONE_PTR(result, parent, parent->idx);
+    if (parent->hdr.datatype == str)
+        result->hdr.datatype = (const char*)ARG_CLONE_PTR(result, parent, str);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_enum_ext = {ARG_HDR_EXT_VERSION, NULL, arg_enum_clonefn};
+
+arg_enum_t* arg_enum0(const char* shortopts, const char* longopts, const char* const* choices, const char* datatype, int flags, const char* glossary) {
+    return arg_enumn(shortopts, longopts, choices, datatype, 0, 1, flags, glossary);
+}
+
+arg_enum_t* arg_enum1(const char* shortopts, const char* longopts, const char* const* choices, const char* datatype, int flags, const char* glossary) {
+    return arg_enumn(shortopts, longopts, choices, datatype, 1, 1, flags, glossary);
+}
+
+arg_enum_t* arg_enumn(const char* shortopts,
+                      const char* longopts,
+                      const char* const* choices,
+                      const char* datatype,
+                      int mincount,
+                      int maxcount,
+                      int flags,
+                      const char* glossary) {
+    size_t nbytes;
+    size_t len = 0;
+    struct arg_enum* result;
+    struct arg_enum_priv* priv;
+    int nchoices = 0;
+    int duplicate;
+
+    if (!choices || !choices[0]) {
+        ARG_LOG(("argtable: ERROR - no choices given for enumerated option\n"));
+        ARG_LOG(("argtable: Bad argument table.\n"));
+        return NULL;
+    }
+
+    /* count the choices and the length of the "{a,b,c}" datatype listing them */
+    for (nchoices = 0; choices[nchoices]; nchoices++)
+        len += strlen(choices[nchoices]) + 1;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_enum)                    /* storage for struct arg_enum */
+             + sizeof(struct arg_enum_priv)             /* storage for private arg_enum data */
+             + (size_t)maxcount * sizeof(int)           /* storage for idx[maxcount] array */
+             + (size_t)nchoices * 2 * sizeof(int)       /* storage for disp[] and slot[] arrays */
+             + (datatype ? 0 : len + 2);                /* storage for the datatype string */
+
+    result = (struct arg_enum*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype;
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_enum_resetfn;
+    result->hdr.scanfn = arg_enum_scanfn;
+    result->hdr.checkfn = arg_enum_checkfn;
+    result->hdr.errorfn = arg_enum_errorfn;
+
+    /* store the arg_enum_priv struct immediately after the arg_enum struct */
+    result->hdr.priv = result + 1;
+    priv = (struct arg_enum_priv*)(result->hdr.priv);
+    priv->ext = arg_enum_ext;
+    priv->choices = choices;
+    priv->nchoices = nchoices;
+    priv->flags = flags;
+
+    /* store the idx[maxcount], disp[nchoices] and slot[nchoices] arrays after it */
+    result->idx = (int*)(priv + 1);
+    result->count = 0;
+    priv->disp = result->idx + maxcount;
+    priv->slot = priv->disp + nchoices;
+
+    /* list the choices as the datatype unless one was given */
+    if (!datatype) {
+        char* str = (char*)(priv->slot + nchoices);
+        int i;
+
+        result->hdr.datatype = str;
+        *str++ = '{';
+        for (i = 0; i < nchoices; i++) {
+            size_t n = strlen(choices[i]);
+            memcpy(str, choices[i], n);
+            str += n;
+            *str++ = (i + 1 < nchoices) ? ',' : '}';
+        }
+        *str = '\0';
+    }
+
+    duplicate = arg_enum_build(priv);
+    if (duplicate >= 0) {
+        ARG_LOG(("argtable: ERROR - duplicate choice \"%s\" for enumerated option\n", choices[duplicate]));
+        ARG_LOG(("argtable: Bad argument table.\n"));
+        xfree(result);
+        return NULL;
+    }
+
+    ARG_TRACE(("arg_enumn() returns %p\n", result));
+    return result;
+}
@@ -36,8 +36,26 @@
 #include "argtable3_private.h"
 #endif
 
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _WIN32
+#include <io.h>
+#define ARG_FILE_ACCESS(path) _access(path, 4)
+#else
+#include <unistd.h>
+#define ARG_FILE_ACCESS(path) access(path, R_OK)
+#endif
+
+#ifndef S_ISREG
+#define S_ISREG(m) (((m) & S_IFMT) == S_IFREG)
+#endif
+#ifndef S_ISDIR
+#define S_ISDIR(m) (((m) & S_IFMT) == S_IFDIR)
+#endif
 
 #ifdef WIN32
 #define FILESEPARATOR1 '\\'
@@ -47,60 +65,137 @@
 #define FILESEPARATOR2 '/'
 #endif
 
+/* Number of paths checked by one task of the validation pool */
+#define ARG_FILE_CHUNK 64
+
+/*
+ * Private data of an arg_file, allocated by arg_file_validate(),
+ * arg_file_glob() or arg_file_map(). The st[], maps[], err[], errnum[] and
+ * globs[] arrays have maxcount entries and follow the struct.
+ */
+struct arg_file_priv {
+    struct arg_hdr_ext ext; /* must come first, see ARG_HASEXT */
+    int flags;
+    int nworkers;
+    int checked;     /* number of paths whose st[] and err[] are valid */
+    struct stat* st; /* status of each path */
+    int* err;        /* 0, or the ARG_ERR_FILE* error of each path */
+    int* errnum;     /* errno of a failed stat() or access() */
+    int globlimit;   /* largest number of matches of one pattern, 0 if patterns are not expanded */
+    int globworkers;
+    int nglobs;
+    char*** globs; /* matches of each expanded pattern, which filename[] points into */
+    arg_mmap_t* maps;  /* contents of each path, opened by arg_file_map() */
+    arg_mmap_t stdin_; /* contents of stdin, shared by every "-" path and kept until the argument is freed */
+};
+
+static void arg_file_freefn(void* parent_);
+static void* arg_file_clonefn(void* parent_);
+
+/* The optional functions of an arg_file, without and with private data */
+static const struct arg_hdr_ext arg_file_ext = {ARG_HDR_EXT_VERSION, NULL, arg_file_clonefn};
+static const struct arg_hdr_ext arg_file_privext = {ARG_HDR_EXT_VERSION, arg_file_freefn, arg_file_clonefn};
+
+/* Returns the private data, or NULL until arg_file_priv() allocates it */
+static struct arg_file_priv* arg_file_getpriv(const struct arg_file* parent) {
+    return parent->hdr.priv == (const void*)&arg_file_ext ? NULL : (struct arg_file_priv*)parent->hdr.priv;
+}
+
+/* A range of paths checked by one task */
+struct arg_file_chunk {
+    struct arg_file* parent;
+    int begin;
+    int end;
+    arg_task_t task;
+};
+
+/* Releases the contents mapped and the patterns expanded since the last parse */
+static void arg_file_release(struct arg_file* parent) {
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    int i;
+
+    if (!priv)
+        return;
+    for (i = 0; i < parent->count; i++)
+        arg_mmap_close(&priv->maps[i]);
+    while (priv->nglobs > 0)
+        xfree(priv->globs[--priv->nglobs]);
+}
+
 static void arg_file_resetfn(void* parent_) {
     struct arg_file* parent = parent_;
     ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    arg_file_release(parent);
     parent->count = 0;
 }
 
-/* Returns ptr to the base filename within *filename */
-static const char* arg_basename(const char* filename) {
-    const char *result = NULL, *result1, *result2;
-
-    /* Find the last occurrence of eother file separator character. */
-    /* Two alternative file separator chars are supported as legal  */
-    /* file separators but not both together in the same filename.  */
-    result1 = (filename ? strrchr(filename, FILESEPARATOR1) : NULL);
-    result2 = (filename ? strrchr(filename, FILESEPARATOR2) : NULL);
-
-    if (result2)
-        result = result2 + 1; /* using FILESEPARATOR2 (the alternative file separator) */
-
-    if (result1)
-        result = result1 + 1; /* using FILESEPARATOR1 (the preferred file separator) */
-
-    if (!result)
-        result = filename; /* neither file separator was found so basename is the whole filename */
+/*
+ * Finds the length, basename and extension of filename. The basename follows
+ * the last FILESEPARATOR1, or else the last FILESEPARATOR2, as two alternative
+ * separators are not supported together in the same filename. The extension
+ * is found by scanning the basename backwards, so only the characters after
+ * the last separator are looked at twice.
+ */
+static void arg_file_split(const char* filename, struct arg_file_span* span) {
+    const char* sep = strrchr(filename, FILESEPARATOR1);
+    size_t base, len, dot;
+
+    if (!sep)
+        sep = strrchr(filename, FILESEPARATOR2);
+    base = sep ? (size_t)(sep - filename) + 1 : 0;
+    len = base + strlen(filename + base);
 
     /* special cases of "." and ".." are not considered basenames */
-    if (result && (strcmp(".", result) == 0 || strcmp("..", result) == 0))
-        result = filename + strlen(filename);
-
-    return result;
+    if (filename[base] == '.' && (len - base == 1 || (len - base == 2 && filename[base + 1] == '.')))
+        base = len;
+
+    /* find the last '.' in the basename */
+    dot = len;
+    while (dot > base && filename[dot - 1] != '.')
+        dot--;
+
+    /* neither a leading dot (eg ".foo") nor a trailing one (eg "foo.", "foo..") starts a true extension */
+    span->length = len;
+    span->basename = base;
+    span->extension = (dot > base + 1 && dot < len) ? dot - 1 : len;
 }
 
-/* Returns ptr to the file extension within *basename */
-static const char* arg_extension(const char* basename) {
-    /* find the last occurrence of '.' in basename */
-    const char* result = (basename ? strrchr(basename, '.') : NULL);
+/* Stores a path, which must outlive the parse, in the next free entry */
+static void arg_file_store(struct arg_file* parent, const char* path) {
+    struct arg_file_span* span = &parent->span[parent->count];
 
-    /* if no '.' was found then return pointer to end of basename */
-    if (basename && !result)
-        result = basename + strlen(basename);
+    arg_file_split(path, span);
+    parent->filename[parent->count] = path;
+    parent->basename[parent->count] = path + span->basename;
+    parent->extension[parent->count] = path + span->extension;
+    parent->count++;
+}
 
-    /* special case: basenames with a single leading dot (eg ".foo") are not considered as true extensions */
-    if (basename && result == basename)
-        result = basename + strlen(basename);
+/* Stores the paths that match a pattern, in sorted order */
+static int arg_file_expand(struct arg_file* parent, const char* pattern) {
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    char** paths;
+    int n = arg_glob(pattern, priv->globlimit, priv->globworkers, &paths);
+    int i;
 
-    /* special case: empty extensions (eg "foo.","foo..") are not considered as true extensions */
-    if (basename && result && strlen(result) == 1)
-        result = basename + strlen(basename);
+    if (n < 0)
+        return ARG_ERR_GLOBLIMIT;
+    if (n == 0)
+        return ARG_ERR_GLOBNOMATCH;
+    if (n > parent->hdr.maxcount - parent->count) {
+        xfree(paths);
+        return ARG_ERR_MAXCOUNT;
+    }
 
-    return result;
+    priv->globs[priv->nglobs++] = paths;
+    for (i = 0; i < n; i++)
+        arg_file_store(parent, paths[i]);
+    return 0;
 }
 
 static int arg_file_scanfn(void* parent_, const char* argval) {
     struct arg_file* parent = parent_;
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
     int errorcode = 0;
 
     if (parent->count == parent->hdr.maxcount) {
@@ -111,21 +206,91 @@ static int arg_file_scanfn(void* parent_, const char* argval) {
         /* This happens when an optional argument value was invoked. */
         /* leave parent arguiment value unaltered but still count the argument. */
         parent->count++;
+    } else if (priv && priv->globlimit > 0 && strpbrk(argval, "*?[")) {
+        errorcode = arg_file_expand(parent, argval);
     } else {
-        parent->filename[parent->count] = argval;
-        parent->basename[parent->count] = arg_basename(argval);
-        parent->extension[parent->count] =
-                arg_extension(parent->basename[parent->count]); /* only seek extensions within the basename (not the file path)*/
-        parent->count++;
+        arg_file_store(parent, argval);
     }
 
     ARG_TRACE(("%s4:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
     return errorcode;
 }
 
+/* Checks one path against the filesystem, storing its status, error and errno */
+static void arg_file_check(struct arg_file* parent, int i) {
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    int flags = priv->flags;
+    int err = 0;
+
+    errno = 0;
+    if (stat(parent->filename[i], &priv->st[i]) != 0) {
+        err = ARG_ERR_FILESTAT;
+    } else if ((flags & (ARG_FILE_REGULAR | ARG_FILE_DIR)) && !((flags & ARG_FILE_REGULAR) && S_ISREG(priv->st[i].st_mode)) &&
+               !((flags & ARG_FILE_DIR) && S_ISDIR(priv->st[i].st_mode))) {
+        err = ARG_ERR_FILETYPE;
+    } else if ((flags & ARG_FILE_READABLE) && ARG_FILE_ACCESS(parent->filename[i]) != 0) {
+        err = ARG_ERR_FILEACCESS;
+    }
+
+    priv->err[i] = err;
+    priv->errnum[i] = err ? errno : 0;
+}
+
+static void arg_file_chunkfn(void* arg) {
+    struct arg_file_chunk* chunk = (struct arg_file_chunk*)arg;
+    int i;
+
+    for (i = chunk->begin; i < chunk->end; i++)
+        arg_file_check(chunk->parent, i);
+}
+
+/* Checks all paths, splitting them into chunks for a worker pool when there are enough of them */
+static void arg_file_checkall(struct arg_file* parent) {
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    int nchunks = (parent->count + ARG_FILE_CHUNK - 1) / ARG_FILE_CHUNK;
+    int nworkers = priv->nworkers < 0 ? arg_thread_ncpu() : priv->nworkers;
+    struct arg_file_chunk* chunks;
+    arg_tpool_t* pool;
+    int i;
+
+    /* the calling thread works on the chunks too, so one chunk needs no pool */
+    if (nworkers > nchunks - 1)
+        nworkers = nchunks - 1;
+    if (nworkers <= 0) {
+        for (i = 0; i < parent->count; i++)
+            arg_file_check(parent, i);
+        return;
+    }
+
+    chunks = (struct arg_file_chunk*)xmalloc(sizeof(struct arg_file_chunk) * (size_t)nchunks);
+    pool = arg_tpool_create(nworkers);
+    for (i = 0; i < nchunks; i++) {
+        chunks[i].parent = parent;
+        chunks[i].begin = i * ARG_FILE_CHUNK;
+        chunks[i].end = (i == nchunks - 1) ? parent->count : (i + 1) * ARG_FILE_CHUNK;
+        arg_tpool_submit(pool, &chunks[i].task, arg_file_chunkfn, &chunks[i]);
+    }
+    for (i = 0; i < nchunks; i++)
+        arg_tpool_join(pool, &chunks[i].task);
+    arg_tpool_destroy(pool);
+    xfree(chunks);
+}
+
 static int arg_file_checkfn(void* parent_) {
     struct arg_file* parent = parent_;
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
     int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    int i;
+
+    /* check the paths in parallel, then report the failures in command line order */
+    if (priv && priv->flags) {
+        arg_file_checkall(parent);
+        priv->checked = parent->count;
+        for (i = 0; i < parent->count; i++) {
+            if (priv->err[i])
+                arg_check_error(parent, priv->err[i], parent->filename[i]);
+        }
+    }
 
     ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
     return errorcode;
@@ -152,11 +317,156 @@ static void arg_file_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const
             arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
             break;
 
+        case ARG_ERR_FILESTAT:
+        case ARG_ERR_FILEACCESS: {
+            struct arg_file_priv* priv = arg_file_getpriv(parent);
+            int errnum = 0;
+            int i;
+
+            /* find the errno that was saved for this path */
+            for (i = 0; priv && i < priv->checked; i++) {
+                if (parent->filename[i] == argval) {
+                    errnum = priv->errnum[i];
+                    break;
+                }
+            }
+
+            arg_dstr_catf(ds, "cannot %s \"%s\"", errorcode == ARG_ERR_FILESTAT ? "access" : "read", argval);
+            if (errnum)
+                arg_dstr_catf(ds, " (%s)", strerror(errnum));
+            arg_dstr_cat(ds, " at option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+        }
+
+        case ARG_ERR_FILETYPE: {
+            struct arg_file_priv* priv = arg_file_getpriv(parent);
+            int flags = priv ? priv->flags & (ARG_FILE_REGULAR | ARG_FILE_DIR) : 0;
+
+            arg_dstr_catf(ds, "\"%s\" is not a %s at option ", argval,
+                          flags == ARG_FILE_REGULAR ? "regular file" : (flags == ARG_FILE_DIR ? "directory" : "regular file or directory"));
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+        }
+
+        case ARG_ERR_GLOBNOMATCH:
+            arg_dstr_catf(ds, "no files match \"%s\" at option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_GLOBLIMIT: {
+            struct arg_file_priv* priv = arg_file_getpriv(parent);
+            arg_dstr_catf(ds, "\"%s\" matches more than %d files at option ", argval, priv ? priv->globlimit : 0);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+        }
+
         default:
             arg_dstr_catf(ds, "unknown error at \"%s\"\n", argval);
     }
 }
 
+static void arg_file_freefn(void* parent_) {
+    struct arg_file* parent = parent_;
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    ARG_TRACE(("%s:freefn(%p)\n", __FILE__, parent));
+    arg_file_release(parent);
+    if (priv)
+        arg_mmap_close(&priv->stdin_);
+    xfree(priv);
+    parent->hdr.priv = (void*)&arg_file_ext;
+}
+
+/* Returns the private data, allocating it with its arrays on first use */
+static struct arg_file_priv* arg_file_priv(struct arg_file* parent) {
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    size_t maxcount = (size_t)parent->hdr.maxcount;
+
+    if (!priv) {
+        priv = (struct arg_file_priv*)xcalloc(
+            1, sizeof(struct arg_file_priv) + maxcount * (sizeof(struct stat) + sizeof(arg_mmap_t) + sizeof(char**) + 2 * sizeof(int)));
+        priv->st = (struct stat*)(priv + 1);
+        priv->maps = (arg_mmap_t*)(priv->st + maxcount);
+        priv->globs = (char***)(priv->maps + maxcount);
+        priv->err = (int*)(priv->globs + maxcount);
+        priv->errnum = priv->err + maxcount;
+        priv->ext = arg_file_privext;
+        parent->hdr.priv = priv;
+    }
+    return priv;
+}
+
+/* Copies the argument with its settings, but none of the checks, expansions or contents of the last parse */
+static void* arg_file_clonefn(void* parent_) {
+    struct arg_file* parent = parent_;
+    struct arg_file_priv* priv = arg_file_getpriv(parent);
+    size_t maxcount = (size_t)parent->hdr.maxcount;
+    struct arg_file* result;
+
+    result = (struct arg_file*)arg_clone_block(parent, sizeof(struct arg_file) + 3 * maxcount * sizeof(char*) + maxcount * sizeof(struct arg_file_span));
+    result->filename = (const char**)ARG_CLONE_PTR(result, parent, parent->filename);
+    result->basename = (const char**)ARG_CLONE_PTR(result, parent, parent->basename);
+    result->extension = (const char**)ARG_CLONE_PTR(result, parent, parent->extension);
+    result->span = (struct arg_file_span*)ARG_CLONE_PTR(result, parent, parent->span);
+    result->hdr.priv = (void*)&arg_file_ext;
+    if (priv) {
+        struct arg_file_priv* rpriv = arg_file_priv(result);
+        rpriv->flags = priv->flags;
+        rpriv->nworkers = priv->nworkers;
+        rpriv->globlimit = priv->globlimit;
+        rpriv->globworkers = priv->globworkers;
+    }
+    return result;
+}
+
+void arg_file_validate(struct arg_file* parent, int flags, int nworkers) {
+    struct arg_file_priv* priv = arg_file_priv(parent);
+
+    /* every check needs the path to exist */
+    priv->flags = flags ? (flags | ARG_FILE_EXISTS) : 0;
+    priv->nworkers = nworkers;
+    priv->checked = 0;
+}
+
+void arg_file_glob(struct arg_file* parent, int maxmatches, int nworkers) {
+    struct arg_file_priv* priv = arg_file_priv(parent);
+
+    priv->globlimit = maxmatches > 0 ? maxmatches : 0;
+    priv->globworkers = nworkers;
+}
+
+const char* arg_file_map(struct arg_file* parent, int index, size_t* len) {
+    struct arg_file_priv* priv;
+    arg_mmap_t* map;
+
+    if (index < 0 || index >= parent->count)
+        return NULL;
+
+    priv = arg_file_priv(parent);
+    if (strcmp(parent->filename[index], "-") == 0) {
+        /* stdin can only be read once, so every "-" shares one copy */
+        map = &priv->stdin_;
+        if (!map->data && arg_mmap_read(map, stdin) != 0)
+            return NULL;
+    } else {
+        map = &priv->maps[index];
+        if (!map->data && arg_mmap_open(map, parent->filename[index]) != 0)
+            return NULL;
+    }
+
+    if (len)
+        *len = map->len;
+    return map->data;
+}
+
+const struct stat* arg_file_stat(const struct arg_file* parent, int index) {
+    const struct arg_file_priv* priv = arg_file_getpriv(parent);
+
+    if (!priv || !priv->flags || index < 0 || index >= priv->checked || index >= parent->count || priv->err[index] == ARG_ERR_FILESTAT)
+        return NULL;
+    return &priv->st[index];
+}
+
 struct arg_file* arg_file0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
     return arg_filen(shortopts, longopts, datatype, 0, 1, glossary);
 }
@@ -173,15 +483,16 @@ struct arg_file* arg_filen(const char* shortopts, const char* longopts, const ch
     /* foolproof things by ensuring maxcount is not less than mincount */
     maxcount = (maxcount < mincount) ? mincount : maxcount;
 
-    nbytes = sizeof(struct arg_file)     /* storage for struct arg_file */
-             + sizeof(char*) * (size_t)maxcount  /* storage for filename[maxcount] array */
-             + sizeof(char*) * (size_t)maxcount  /* storage for basename[maxcount] array */
-             + sizeof(char*) * (size_t)maxcount; /* storage for extension[maxcount] array */
+    nbytes = sizeof(struct arg_file)                            /* storage for struct arg_file */
+             + sizeof(char*) * (size_t)maxcount                 /* storage for filename[maxcount] array */
+             + sizeof(char*) * (size_t)maxcount                 /* storage for basename[maxcount] array */
+             + sizeof(char*) * (size_t)maxcount                 /* storage for extension[maxcount] array */
+             + sizeof(struct arg_file_span) * (size_t)maxcount; /* storage for span[maxcount] array */
 
     result = (struct arg_file*)xmalloc(nbytes);
 
     /* init the arg_hdr struct */
-    result->hdr.flag = ARG_HASVALUE;
+    result->hdr.flag = ARG_HASVALUE | ARG_HASFILEVALUE | ARG_HASEXT;
     result->hdr.shortopts = shortopts;
     result->hdr.longopts = longopts;
     result->hdr.glossary = glossary;
@@ -193,11 +504,13 @@ struct arg_file* arg_filen(const char* shortopts, const char* longopts, const ch
     result->hdr.scanfn = arg_file_scanfn;
     result->hdr.checkfn = arg_file_checkfn;
     result->hdr.errorfn = arg_file_errorfn;
+    result->hdr.priv = (void*)&arg_file_ext;
 
-    /* store the filename,basename,extension arrays immediately after the arg_file struct */
+    /* store the filename,basename,extension,span arrays immediately after the arg_file struct */
     result->filename = (const char**)(result + 1);
     result->basename = result->filename + maxcount;
     result->extension = result->basename + maxcount;
+    result->span = (struct arg_file_span*)(result->extension + maxcount);
     result->count = 0;
 
     /* foolproof the string pointers by initialising them with empty strings */
@@ -205,6 +518,9 @@ struct arg_file* arg_filen(const char* shortopts, const char* longopts, const ch
         result->filename[i] = "";
         result->basename[i] = "";
         result->extension[i] = "";
+        result->span[i].length = 0;
+        result->span[i].basename = 0;
+        result->span[i].extension = 0;
     }
 
     ARG_TRACE(("arg_filen() returns %p\n", result));
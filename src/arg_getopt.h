@@ -67,6 +67,30 @@ int	getopt_long(int, char * const *, const char *,
 	const struct option *, int *);
 int	getopt_long_only(int, char * const *, const char *,
 	const struct option *, int *);
+
+/*
+ * Reentrant interface used by argtable. The scanner keeps its position in a
+ * struct arg_getopt instead of the getopt(3) external variables, so several
+ * threads can scan their own argument vectors at once.
+ */
+struct arg_getopt {
+	int ind;		/* index into parent argv vector */
+	int err;		/* if error message should be printed */
+	int opt;		/* character checked for validity */
+	int reset;		/* reset getopt */
+	char *arg;		/* argument associated with option */
+	char *place;		/* option letter processing */
+	int nonopt_start;	/* first non option argument (for permute) */
+	int nonopt_end;		/* first option after non options (for permute) */
+	int dash_prefix;
+	int posixly_correct;
+};
+
+void	arg_getopt_init(struct arg_getopt *);
+int	arg_getopt_long(struct arg_getopt *, int, char * const *, const char *,
+	const struct option *, int *);
+int	arg_getopt_long_only(struct arg_getopt *, int, char * const *,
+	const char *, const struct option *, int *);
 #ifndef _GETOPT_DECLARED
 #define	_GETOPT_DECLARED
 int getopt(int, char * const [], const char *);
@@ -92,24 +92,18 @@ char *optarg;		/* argument associated with option */
 #define W_PREFIX	2
 #endif
 
-static int getopt_internal(int, char * const *, const char *,
-			   const struct option *, int *, int);
-static int parse_long_options(char * const *, const char *,
-			      const struct option *, int *, int, int);
+static int getopt_internal(struct arg_getopt *, int, char * const *,
+			   const char *, const struct option *, int *, int);
+static int parse_long_options(struct arg_getopt *, char * const *,
+			      const char *, const struct option *, int *, int,
+			      int);
 static int gcd(int, int);
 static void permute_args(int, int, int, char * const *);
 
-static char *place = EMSG; /* option letter processing */
-
-/* XXX: set optreset to 1 rather than these two */
-static int nonopt_start = -1; /* first non option argument (for permute) */
-static int nonopt_end = -1;   /* first option after non options (for permute) */
-
 /* Error messages */
 static const char recargchar[] = "option requires an argument -- %c";
 static const char illoptchar[] = "illegal option -- %c"; /* From P1003.2 */
 #ifdef GNU_COMPATIBLE
-static int dash_prefix = NO_PREFIX;
 static const char gnuoptchar[] = "invalid option -- %c";
 
 static const char recargstring[] = "option `%s%s' requires an argument";
@@ -223,14 +217,30 @@ permute_args(int panonopt_start, int panonopt_end, int opt_end,
 	}
 }
 
+/*
+ * The scanner below works on the state passed to it, which the getopt(3)
+ * names refer to until the end of getopt_internal().
+ */
+#define optind		(st->ind)
+#define opterr		(st->err)
+#define optopt		(st->opt)
+#define optreset	(st->reset)
+#define optarg		(st->arg)
+#define place		(st->place)
+#define nonopt_start	(st->nonopt_start)
+#define nonopt_end	(st->nonopt_end)
+#define dash_prefix	(st->dash_prefix)
+#define posixly_correct	(st->posixly_correct)
+
 /*
  * parse_long_options --
  *	Parse long options in argc/argv argument vector.
  * Returns -1 if short_too is set and the option does not match long_options.
  */
 static int
-parse_long_options(char * const *nargv, const char *options,
-	const struct option *long_options, int *idx, int short_too, int flags)
+parse_long_options(struct arg_getopt *st, char * const *nargv,
+	const char *options, const struct option *long_options, int *idx,
+	int short_too, int flags)
 {
 	char *current_argv, *has_equal;
 #ifdef GNU_COMPATIBLE
@@ -394,12 +404,12 @@ parse_long_options(char * const *nargv, const char *options,
  *	Parse argc/argv argument vector.  Called by user level routines.
  */
 static int
-getopt_internal(int nargc, char * const *nargv, const char *options,
-	const struct option *long_options, int *idx, int flags)
+getopt_internal(struct arg_getopt *st, int nargc, char * const *nargv,
+	const char *options, const struct option *long_options, int *idx,
+	int flags)
 {
 	char *oli;				/* option letter list index */
 	int optchar, short_too;
-	static int posixly_correct = -1;
 
 	if (options == NULL)
 		return (-1);
@@ -537,7 +547,7 @@ start:
 		} else if (*place != ':' && strchr(options, *place) != NULL)
 			short_too = 1;		/* could be short option too */
 
-		optchar = parse_long_options(nargv, options, long_options,
+		optchar = parse_long_options(st, nargv, options, long_options,
 		    idx, short_too, flags);
 		if (optchar != -1) {
 			place = EMSG;
@@ -583,7 +593,7 @@ start:
 #ifdef GNU_COMPATIBLE
 		dash_prefix = W_PREFIX;
 #endif
-		optchar = parse_long_options(nargv, options, long_options,
+		optchar = parse_long_options(st, nargv, options, long_options,
 		    idx, 0, flags);
 		place = EMSG;
 		return (optchar);
@@ -612,6 +622,90 @@ start:
 	return (optchar);
 }
 
+#undef optind
+#undef opterr
+#undef optopt
+#undef optreset
+#undef optarg
+#undef place
+#undef nonopt_start
+#undef nonopt_end
+#undef dash_prefix
+#undef posixly_correct
+
+/*
+ * arg_getopt_init --
+ *	Prepare a scanner state for a new argument vector.
+ */
+void
+arg_getopt_init(struct arg_getopt *st)
+{
+
+	st->ind = 0;
+	st->err = 1;
+	st->opt = '?';
+	st->reset = 0;
+	st->arg = NULL;
+	st->place = EMSG;
+	st->nonopt_start = -1;
+	st->nonopt_end = -1;
+	st->dash_prefix = NO_PREFIX;
+	st->posixly_correct = -1;
+}
+
+/*
+ * arg_getopt_long --
+ *	Parse argc/argv argument vector, keeping the position in st.
+ */
+int
+arg_getopt_long(struct arg_getopt *st, int nargc, char * const *nargv,
+	const char *options, const struct option *long_options, int *idx)
+{
+
+	return (getopt_internal(st, nargc, nargv, options, long_options, idx,
+	    FLAG_PERMUTE));
+}
+
+/*
+ * arg_getopt_long_only --
+ *	Parse argc/argv argument vector, keeping the position in st.
+ */
+int
+arg_getopt_long_only(struct arg_getopt *st, int nargc, char * const *nargv,
+	const char *options, const struct option *long_options, int *idx)
+{
+
+	return (getopt_internal(st, nargc, nargv, options, long_options, idx,
+	    FLAG_PERMUTE|FLAG_LONGONLY));
+}
+
+/*
+ * The state of getopt(), getopt_long() and getopt_long_only(), which is
+ * copied from and back to the getopt(3) external variables around each call.
+ */
+static struct arg_getopt getopt_state = {
+	1, 1, '?', 0, NULL, EMSG, -1, -1, NO_PREFIX, -1
+};
+
+static int
+getopt_global(int nargc, char * const *nargv, const char *options,
+	const struct option *long_options, int *idx, int flags)
+{
+	int ret;
+
+	getopt_state.ind = optind;
+	getopt_state.err = opterr;
+	getopt_state.opt = optopt;
+	getopt_state.reset = optreset;
+	ret = getopt_internal(&getopt_state, nargc, nargv, options,
+	    long_options, idx, flags);
+	optind = getopt_state.ind;
+	optopt = getopt_state.opt;
+	optreset = getopt_state.reset;
+	optarg = getopt_state.arg;
+	return (ret);
+}
+
 /*
  * getopt --
  *	Parse argc/argv argument vector.
@@ -630,7 +724,7 @@ getopt(int nargc, char * const *nargv, const char *options)
 	 * before dropping privileges it makes sense to keep things
 	 * as simple (and bug-free) as possible.
 	 */
-	return (getopt_internal(nargc, nargv, options, NULL, NULL, 0));
+	return (getopt_global(nargc, nargv, options, NULL, NULL, 0));
 }
 
 /*
@@ -642,7 +736,7 @@ getopt_long(int nargc, char * const *nargv, const char *options,
 	const struct option *long_options, int *idx)
 {
 
-	return (getopt_internal(nargc, nargv, options, long_options, idx,
+	return (getopt_global(nargc, nargv, options, long_options, idx,
 	    FLAG_PERMUTE));
 }
 
@@ -655,7 +749,7 @@ getopt_long_only(int nargc, char * const *nargv, const char *options,
 	const struct option *long_options, int *idx)
 {
 
-	return (getopt_internal(nargc, nargv, options, long_options, idx,
+	return (getopt_global(nargc, nargv, options, long_options, idx,
 	    FLAG_PERMUTE|FLAG_LONGONLY));
 }
 
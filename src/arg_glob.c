@@ -0,0 +1,481 @@
+/*******************************************************************************
+ * arg_glob: Implements glob pattern expansion for file arguments
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+/* lstat() and d_type are POSIX and BSD extensions that strict C modes hide */
+#if !defined(_WIN32) && !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE 700
+#endif
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE
+#endif
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _WIN32
+#include <io.h>
+#define ARG_GLOB_ISSEP(c) ((c) == '/' || (c) == '\\')
+#else
+#include <dirent.h>
+#define ARG_GLOB_ISSEP(c) ((c) == '/')
+#endif
+
+#ifndef S_ISDIR
+#define S_ISDIR(m) (((m) & S_IFMT) == S_IFDIR)
+#endif
+
+/* A growable list of heap allocated paths */
+struct arg_glob_list {
+    char** items;
+    int count;
+    int alloc;
+};
+
+/*
+ * Reads one directory. With a pattern, the task keeps the entries whose names
+ * match it; without one, it keeps every subdirectory, which is how "**"
+ * descends. Directories are kept with a trailing separator so that the next
+ * component can be appended directly.
+ */
+struct arg_glob_task {
+    const char* dir; /* directory to read, "" for the current directory */
+    const char* pat; /* pattern of the component, not null-terminated, or NULL */
+    size_t patlen;
+    int dirsonly; /* only keep directories */
+    int limit;    /* stop reading once more than this many entries are kept */
+    struct arg_glob_list out;
+    arg_task_t task;
+};
+
+/* The worker pool, created when a level of the walk first has more than one directory to read */
+struct arg_glob_ctx {
+    int nworkers;
+    int limit;
+    arg_tpool_t* pool;
+};
+
+static char* arg_glob_push(struct arg_glob_list* list, const char* dir, const char* name, size_t namelen, int sep) {
+    size_t dirlen = strlen(dir);
+    char* path = (char*)xmalloc(dirlen + namelen + 2);
+
+    memcpy(path, dir, dirlen);
+    memcpy(path + dirlen, name, namelen);
+    if (sep)
+        path[dirlen + namelen++] = '/';
+    path[dirlen + namelen] = '\0';
+
+    if (list->count == list->alloc) {
+        list->alloc = list->alloc ? list->alloc * 2 : 16;
+        list->items = (char**)xrealloc(list->items, sizeof(char*) * (size_t)list->alloc);
+    }
+    list->items[list->count++] = path;
+    return path;
+}
+
+static void arg_glob_clear(struct arg_glob_list* list) {
+    int i;
+
+    for (i = 0; i < list->count; i++)
+        xfree(list->items[i]);
+    xfree(list->items);
+    list->items = NULL;
+    list->count = list->alloc = 0;
+}
+
+/* Moves the paths of src to the end of dst */
+static void arg_glob_append(struct arg_glob_list* dst, struct arg_glob_list* src) {
+    if (dst->count + src->count > dst->alloc) {
+        dst->alloc = dst->count + src->count;
+        dst->items = (char**)xrealloc(dst->items, sizeof(char*) * (size_t)dst->alloc);
+    }
+    if (src->count > 0)
+        memcpy(dst->items + dst->count, src->items, sizeof(char*) * (size_t)src->count);
+    dst->count += src->count;
+    src->count = 0;
+    arg_glob_clear(src);
+}
+
+/*
+ * Matches c against the bracket expression that starts after the '[' at p.
+ * Returns the character after the closing ']', or NULL if there is none, in
+ * which case the '[' is an ordinary character.
+ */
+static const char* arg_glob_class(const char* p, const char* pend, unsigned char c, int* matched) {
+    int negate = 0;
+    int hit = 0;
+
+    if (p < pend && (*p == '!' || *p == '^')) {
+        negate = 1;
+        p++;
+    }
+
+    /* a ']' right after the '[' or the negation is an ordinary character */
+    if (p < pend && *p == ']') {
+        hit = (c == ']');
+        p++;
+    }
+
+    while (p < pend && *p != ']') {
+        if (p + 2 < pend && p[1] == '-' && p[2] != ']') {
+            if ((unsigned char)p[0] <= c && c <= (unsigned char)p[2])
+                hit = 1;
+            p += 3;
+        } else {
+            if ((unsigned char)*p == c)
+                hit = 1;
+            p++;
+        }
+    }
+
+    if (p == pend)
+        return NULL;
+    *matched = (hit != negate);
+    return p + 1;
+}
+
+/*
+ * Matches a name against the pattern [p, pend). A '*' is matched by
+ * remembering where it was seen and retrying one character further on a
+ * mismatch, so only the last '*' is ever backtracked to.
+ */
+static int arg_glob_match(const char* p, const char* pend, const char* s) {
+    const char* star = NULL;
+    const char* retry = NULL;
+
+    while (*s) {
+        if (p < pend) {
+            if (*p == '*') {
+                star = ++p;
+                retry = s;
+                continue;
+            }
+            if (*p == '?') {
+                p++;
+                s++;
+                continue;
+            }
+            if (*p == '[') {
+                int matched = 0;
+                const char* next = arg_glob_class(p + 1, pend, (unsigned char)*s, &matched);
+                if (next ? matched : (*s == '[')) {
+                    p = next ? next : p + 1;
+                    s++;
+                    continue;
+                }
+            } else if (*p == *s) {
+                p++;
+                s++;
+                continue;
+            }
+        }
+
+        if (!star)
+            return 0;
+        p = star;
+        s = ++retry;
+    }
+
+    while (p < pend && *p == '*')
+        p++;
+    return p == pend;
+}
+
+static int arg_glob_haswild(const char* p, const char* pend) {
+    for (; p < pend; p++) {
+        if (*p == '*' || *p == '?' || *p == '[')
+            return 1;
+    }
+    return 0;
+}
+
+/* Handles one directory entry; isdir is negative when the entry type is not known yet */
+static void arg_glob_entry(struct arg_glob_task* t, const char* name, int isdir) {
+    char* path;
+
+    /* "." and ".." never match, and hidden entries only match a pattern that starts with a '.' */
+    if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+        return;
+    if (name[0] == '.' && (!t->pat || *t->pat != '.'))
+        return;
+    if (t->pat && !arg_glob_match(t->pat, t->pat + t->patlen, name))
+        return;
+    if (t->dirsonly && isdir == 0)
+        return;
+
+    path = arg_glob_push(&t->out, t->dir, name, strlen(name), t->dirsonly);
+
+#ifndef _WIN32
+    if (t->dirsonly && isdir < 0) {
+        struct stat st;
+        int rc;
+
+        /* "**" does not follow symbolic links, so that a link cannot make the walk loop */
+        path[strlen(path) - 1] = '\0';
+        rc = t->pat ? stat(path, &st) : lstat(path, &st);
+        if (rc != 0 || !S_ISDIR(st.st_mode)) {
+            xfree(path);
+            t->out.count--;
+            return;
+        }
+        path[strlen(path)] = '/';
+    }
+#endif
+}
+
+static void arg_glob_taskfn(void* arg) {
+    struct arg_glob_task* t = (struct arg_glob_task*)arg;
+
+#ifdef _WIN32
+    struct _finddata_t fd;
+    intptr_t handle;
+    size_t len = strlen(t->dir);
+    char* spec = (char*)xmalloc(len + 2);
+
+    memcpy(spec, t->dir, len);
+    spec[len] = '*';
+    spec[len + 1] = '\0';
+    handle = _findfirst(spec, &fd);
+    xfree(spec);
+    if (handle == -1)
+        return;
+    do {
+        arg_glob_entry(t, fd.name, (fd.attrib & _A_SUBDIR) != 0);
+    } while (t->out.count <= t->limit && _findnext(handle, &fd) == 0);
+    _findclose(handle);
+#else
+    DIR* dir = opendir(*t->dir ? t->dir : ".");
+    struct dirent* entry;
+
+    if (!dir)
+        return;
+    while (t->out.count <= t->limit && (entry = readdir(dir)) != NULL) {
+        int isdir = -1;
+#ifdef DT_DIR
+        /* symbolic links and unknown types are resolved with stat() when it matters */
+        if (entry->d_type == DT_DIR)
+            isdir = 1;
+        else if (entry->d_type != DT_UNKNOWN && entry->d_type != DT_LNK)
+            isdir = 0;
+#endif
+        arg_glob_entry(t, entry->d_name, isdir);
+    }
+    closedir(dir);
+#endif
+}
+
+/*
+ * Reads every directory of in, one task per directory, and returns what the
+ * tasks kept in out. The results are concatenated in the order of in, so the
+ * outcome does not depend on how the tasks were scheduled.
+ */
+static void arg_glob_level(struct arg_glob_ctx* ctx, const struct arg_glob_list* in, const char* pat, size_t patlen, int dirsonly,
+                           struct arg_glob_list* out) {
+    struct arg_glob_task* tasks = (struct arg_glob_task*)xcalloc((size_t)in->count, sizeof(struct arg_glob_task));
+    int i;
+
+    if (in->count > 1 && ctx->nworkers != 0 && !ctx->pool)
+        ctx->pool = arg_tpool_create(ctx->nworkers < 0 ? arg_thread_ncpu() : ctx->nworkers);
+
+    for (i = 0; i < in->count; i++) {
+        tasks[i].dir = in->items[i];
+        tasks[i].pat = pat;
+        tasks[i].patlen = patlen;
+        tasks[i].dirsonly = dirsonly;
+        tasks[i].limit = ctx->limit;
+        if (in->count > 1 && ctx->pool)
+            arg_tpool_submit(ctx->pool, &tasks[i].task, arg_glob_taskfn, &tasks[i]);
+        else
+            arg_glob_taskfn(&tasks[i]);
+    }
+
+    for (i = 0; i < in->count; i++) {
+        if (in->count > 1 && ctx->pool)
+            arg_tpool_join(ctx->pool, &tasks[i].task);
+        arg_glob_append(out, &tasks[i].out);
+    }
+    xfree(tasks);
+}
+
+/* Returns the number of paths of list, not counting the current directory that a leading "**" starts from */
+static int arg_glob_count(const struct arg_glob_list* list) {
+    return list->count - (list->count > 0 && list->items[0][0] == '\0');
+}
+
+/*
+ * Replaces the directories of list with themselves and all their subdirectories,
+ * for "**". The walk stops as soon as list has more than the limit of paths.
+ */
+static void arg_glob_descend(struct arg_glob_ctx* ctx, struct arg_glob_list* list) {
+    struct arg_glob_list frontier = {NULL, 0, 0};
+    int i;
+
+    for (i = 0; i < list->count; i++)
+        arg_glob_push(&frontier, list->items[i], "", 0, 0);
+
+    /* walk the tree breadth first, so each level is read in parallel */
+    while (frontier.count > 0 && arg_glob_count(list) <= ctx->limit) {
+        struct arg_glob_list next = {NULL, 0, 0};
+
+        arg_glob_level(ctx, &frontier, NULL, 0, 1, &next);
+        arg_glob_clear(&frontier);
+        if (arg_glob_count(list) + next.count <= ctx->limit) {
+            for (i = 0; i < next.count; i++)
+                arg_glob_push(&frontier, next.items[i], "", 0, 0);
+        }
+        arg_glob_append(list, &next);
+    }
+    arg_glob_clear(&frontier);
+}
+
+static int arg_glob_cmp(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+int arg_glob(const char* pattern, int limit, int nworkers, char*** paths) {
+    struct arg_glob_ctx ctx;
+    struct arg_glob_list cur = {NULL, 0, 0};
+    const char* p = pattern;
+    const char* start = pattern;
+    size_t total;
+    char** result;
+    char* text;
+    int i;
+
+    ARG_TRACE(("arg_glob(\"%s\", %d, %d)\n", pattern, limit, nworkers));
+    *paths = NULL;
+    ctx.nworkers = nworkers;
+    ctx.limit = limit;
+    ctx.pool = NULL;
+
+    /* the components before the first one with a wildcard are the starting directory */
+    while (*p) {
+        const char* end = p;
+        while (*end && !ARG_GLOB_ISSEP(*end))
+            end++;
+        if (arg_glob_haswild(p, end))
+            break;
+        while (*end && ARG_GLOB_ISSEP(*end))
+            end++;
+        p = end;
+    }
+    arg_glob_push(&cur, "", start, (size_t)(p - start), 0);
+
+    /* give up as soon as a level of the walk holds more paths than the limit */
+    while (*p && cur.count > 0 && arg_glob_count(&cur) <= limit) {
+        struct arg_glob_list next = {NULL, 0, 0};
+        const char* end = p;
+        const char* comp = p;
+        size_t complen;
+        int last;
+
+        while (*end && !ARG_GLOB_ISSEP(*end))
+            end++;
+        complen = (size_t)(end - comp);
+        p = end;
+        while (*p && ARG_GLOB_ISSEP(*p))
+            p++;
+
+        /* a trailing separator keeps only directories, like in the shell */
+        last = (*end == '\0');
+
+        if (complen == 2 && comp[0] == '*' && comp[1] == '*') {
+            arg_glob_descend(&ctx, &cur);
+            if (!last || arg_glob_count(&cur) > limit)
+                continue;
+            /* a final "**" matches everything below the directory */
+            comp = "*";
+            complen = 1;
+        }
+
+        if (arg_glob_haswild(comp, comp + complen)) {
+            arg_glob_level(&ctx, &cur, comp, complen, !last, &next);
+        } else {
+            for (i = 0; i < cur.count; i++) {
+                struct stat st;
+                char* path = arg_glob_push(&next, cur.items[i], comp, complen, !last);
+
+                /* literal components of the last level come from the pattern, not from a directory listing */
+                if (last && stat(path, &st) != 0) {
+                    xfree(path);
+                    next.count--;
+                }
+            }
+        }
+        arg_glob_clear(&cur);
+        cur = next;
+    }
+
+    if (ctx.pool)
+        arg_tpool_destroy(ctx.pool);
+
+    /* a pattern ending in "**" followed by a separator also yields the starting directory, which may be empty */
+    for (i = 0; i < cur.count; i++) {
+        if (cur.items[i][0] == '\0') {
+            xfree(cur.items[i]);
+            cur.items[i--] = cur.items[--cur.count];
+        }
+    }
+
+    if (cur.count <= 0 || cur.count > limit) {
+        i = cur.count;
+        arg_glob_clear(&cur);
+        return i == 0 ? 0 : -1;
+    }
+
+    /* sort the matches, then pack them into one block with the pointer array first */
+    qsort(cur.items, (size_t)cur.count, sizeof(char*), arg_glob_cmp);
+    total = sizeof(char*) * (size_t)cur.count;
+    for (i = 0; i < cur.count; i++)
+        total += strlen(cur.items[i]) + 1;
+
+    result = (char**)xmalloc(total);
+    text = (char*)(result + cur.count);
+    for (i = 0; i < cur.count; i++) {
+        size_t len = strlen(cur.items[i]) + 1;
+        memcpy(text, cur.items[i], len);
+        result[i] = text;
+        text += len;
+    }
+
+    i = cur.count;
+    arg_glob_clear(&cur);
+    *paths = result;
+    return i;
+}
@@ -132,6 +132,7 @@ arg_hashtable_t* arg_hashtable_create(unsigned int minsize, unsigned int (*hashf
     h->entrycount = 0;
     h->hashfn = hashfn;
     h->eqfn = eqfn;
+    h->freekeys = 1;
     h->loadlimit = (unsigned int)ceil(size * (double)max_load_factor);
     return h;
 }
@@ -235,7 +236,8 @@ void arg_hashtable_remove(arg_hashtable_t* h, const void* k) {
         if ((hashvalue == e->h) && (h->eqfn(k, e->k))) {
             *pE = e->next;
             h->entrycount--;
-            xfree(e->k);
+            if (h->freekeys)
+                xfree(e->k);
             xfree(e->v);
             xfree(e);
             return;
@@ -255,7 +257,8 @@ void arg_hashtable_destroy(arg_hashtable_t* h, int free_values) {
             while (NULL != e) {
                 f = e;
                 e = e->next;
-                xfree(f->k);
+                if (h->freekeys)
+                    xfree(f->k);
                 xfree(f->v);
                 xfree(f);
             }
@@ -266,7 +269,8 @@ void arg_hashtable_destroy(arg_hashtable_t* h, int free_values) {
             while (NULL != e) {
                 f = e;
                 e = e->next;
-                xfree(f->k);
+                if (h->freekeys)
+                    xfree(f->k);
                 xfree(f);
             }
         }
@@ -363,7 +367,8 @@ int arg_hashtable_itr_remove(arg_hashtable_itr_t* itr) {
     /* itr->e is now outside the hashtable */
     remember_e = itr->e;
     itr->h->entrycount--;
-    xfree(remember_e->k);
+    if (itr->h->freekeys)
+        xfree(remember_e->k);
     xfree(remember_e->v);
 
     /* Advance the iterator, correcting the parent */
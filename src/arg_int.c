@@ -46,95 +46,127 @@ static void arg_int_resetfn(void* parent_) {
     parent->count = 0;
 }
 
-/* strtol0x() is like strtol() except that the numeric string is    */
-/* expected to be prefixed by "0X" where X is a user supplied char. */
-/* The string may optionally be prefixed by white space and + or -  */
-/* as in +0X123 or -0X123.                                          */
-/* Once the prefix has been scanned, the remainder of the numeric   */
-/* string is converted using strtol() with the given base.          */
-/* eg: to parse hex str="-0X12324", specify X='X' and base=16.      */
-/* eg: to parse oct str="+0o12324", specify X='O' and base=8.       */
-/* eg: to parse bin str="-0B01010", specify X='B' and base=2.       */
-/* Failure of conversion is indicated by result where *endptr==str. */
-static long int strtol0X(const char* str, const char** endptr, char X, int base) {
-    long int val;          /* stores result */
-    int s = 1;             /* sign is +1 or -1 */
-    const char* ptr = str; /* ptr to current position in str */
-
-    /* skip leading whitespace */
-    while (isspace((int)(*ptr)))
+/* Returns the value of the alphanumeric digit c, or 36 for anything else. */
+static unsigned int arg_int_digit(int c) {
+    if (c >= '0' && c <= '9')
+        return (unsigned int)(c - '0');
+    if (c >= 'a' && c <= 'z')
+        return (unsigned int)(c - 'a' + 10);
+    if (c >= 'A' && c <= 'Z')
+        return (unsigned int)(c - 'A' + 10);
+    return 36;
+}
+
+/* arg_int_scanmag() scans an integer in a single pass over its bytes,     */
+/* returning its magnitude and sign separately so that the int, int64 and   */
+/* uint64 argument types can apply their own range checks. It accepts the   */
+/* same grammar as the strtol() based chain that arg_int originally used:   */
+/*                                                                          */
+/*   [ws] [+|-] digits                            decimal, eg: -1234        */
+/*   [ws] [+|-] 0X [ws] [+|-] [0X] xdigits        hex, eg: +0x12AB          */
+/*   [ws] [+|-] 0O [ws] [+|-] odigits             octal, eg: 0o755          */
+/*   [ws] [+|-] 0B [ws] [+|-] bdigits             binary, eg: -0b1010       */
+/*                                                                          */
+/* followed by an optional KB, MB or GB suffix (and TB if tb is non-zero)   */
+/* and trailing white space. Prefixes and suffixes are case insensitive.    */
+/* The part after a radix prefix follows strtol() rules, so it may carry    */
+/* its own sign. Returns 0 on success, ARG_ERR_BADINT for malformed input,  */
+/* or ARG_ERR_OVERFLOW when the magnitude (after the suffix multiplier)     */
+/* does not fit in 64 bits. Malformed input takes precedence over overflow. */
+int arg_int_scanmag(const char* str, int tb, uint64_t* mag, int* neg) {
+    const unsigned char* ptr = (const unsigned char*)str;
+    const unsigned char* digits;
+    uint64_t max = ~(uint64_t)0;
+    uint64_t val = 0;
+    uint64_t cutoff;
+    uint64_t mult = 1;
+    unsigned int cutlim;
+    unsigned int radix = 10;
+    int overflow = 0;
+
+    *neg = 0;
+
+    /* skip leading whitespace and scan optional sign character */
+    while (isspace(*ptr))
         ptr++;
-    /* printf("1) %s\n",ptr); */
+    if (*ptr == '+' || *ptr == '-')
+        *neg = (*ptr++ == '-');
+
+    /* '0X', '0O' or '0B' radix prefix */
+    if (ptr[0] == '0') {
+        switch (toupper(ptr[1])) {
+            case 'X':
+                radix = 16;
+                break;
+            case 'O':
+                radix = 8;
+                break;
+            case 'B':
+                radix = 2;
+                break;
+        }
 
-    /* scan optional sign character */
-    switch (*ptr) {
-        case '+':
-            ptr++;
-            s = 1;
-            break;
-        case '-':
-            ptr++;
-            s = -1;
-            break;
-        default:
-            s = 1;
-            break;
+        if (radix != 10) {
+            /* the remainder is scanned the way strtol() would scan it */
+            ptr += 2;
+            while (isspace(*ptr))
+                ptr++;
+            if (*ptr == '+' || *ptr == '-')
+                *neg ^= (*ptr++ == '-');
+            if (radix == 16 && ptr[0] == '0' && toupper(ptr[1]) == 'X' && isxdigit(ptr[2]))
+                ptr += 2;
+        }
     }
-    /* printf("2) %s\n",ptr); */
 
-    /* '0X' prefix */
-    if ((*ptr++) != '0') {
-        /* printf("failed to detect '0'\n"); */
-        *endptr = str;
-        return 0;
-    }
-    /* printf("3) %s\n",ptr); */
-    if (toupper(*ptr++) != toupper(X)) {
-        /* printf("failed to detect '%c'\n",X); */
-        *endptr = str;
-        return 0;
-    }
-    /* printf("4) %s\n",ptr); */
-
-    /* attempt conversion on remainder of string using strtol() */
-    val = strtol(ptr, (char**)endptr, base);
-    if (*endptr == ptr) {
-        /* conversion failed */
-        *endptr = str;
-        return 0;
+    /* accumulate the magnitude, noting overflow but consuming every digit */
+    cutoff = max / radix;
+    cutlim = (unsigned int)(max % radix);
+    digits = ptr;
+    for (;;) {
+        unsigned int d = arg_int_digit(*ptr);
+        if (d >= radix)
+            break;
+        if (val > cutoff || (val == cutoff && d > cutlim))
+            overflow = 1;
+        else
+            val = val * radix + d;
+        ptr++;
     }
+    if (ptr == digits)
+        return ARG_ERR_BADINT;
 
-    /* success */
-    return s * val;
-}
-
-/* Returns 1 if str matches suffix (case insensitive).    */
-/* Str may contain trailing whitespace, but nothing else. */
-static int detectsuffix(const char* str, const char* suffix) {
-    /* scan pairwise through strings until mismatch detected */
-    while (toupper(*str) == toupper(*suffix)) {
-        /* printf("'%c' '%c'\n", *str, *suffix); */
-
-        /* return 1 (success) if match persists until the string terminator */
-        if (*str == '\0')
-            return 1;
-
-        /* next chars */
-        str++;
-        suffix++;
+    /* optional KB, MB, GB or TB suffix */
+    switch (toupper(*ptr)) {
+        case 'K':
+            mult = (uint64_t)1 << 10;
+            break;
+        case 'M':
+            mult = (uint64_t)1 << 20;
+            break;
+        case 'G':
+            mult = (uint64_t)1 << 30;
+            break;
+        case 'T':
+            if (tb)
+                mult = (uint64_t)1 << 40;
+            break;
     }
-    /* printf("'%c' '%c' mismatch\n", *str, *suffix); */
+    if (mult != 1 && toupper(ptr[1]) == 'B')
+        ptr += 2;
+    else
+        mult = 1;
 
-    /* return 0 (fail) if the matching did not consume the entire suffix */
-    if (*suffix != 0)
-        return 0; /* failed to consume entire suffix */
+    /* nothing but whitespace may follow */
+    while (isspace(*ptr))
+        ptr++;
+    if (*ptr != '\0')
+        return ARG_ERR_BADINT;
 
-    /* skip any remaining whitespace in str */
-    while (isspace((int)(*str)))
-        str++;
+    if (overflow || val > max / mult)
+        return ARG_ERR_OVERFLOW;
 
-    /* return 1 (success) if we have reached end of str else return 0 (fail) */
-    return (*str == '\0') ? 1 : 0;
+    *mag = val * mult;
+    return 0;
 }
 
 static int arg_int_scanfn(void* parent_, const char* argval) {
@@ -150,59 +182,18 @@ static int arg_int_scanfn(void* parent_, const char* argval) {
         /* leave parent arguiment value unaltered but still count the argument. */
         parent->count++;
     } else {
-        long int val;
-        const char* end;
-
-        /* attempt to extract hex integer (eg: +0x123) from argval into val conversion */
-        val = strtol0X(argval, &end, 'X', 16);
-        if (end == argval) {
-            /* hex failed, attempt octal conversion (eg +0o123) */
-            val = strtol0X(argval, &end, 'O', 8);
-            if (end == argval) {
-                /* octal failed, attempt binary conversion (eg +0B101) */
-                val = strtol0X(argval, &end, 'B', 2);
-                if (end == argval) {
-                    /* binary failed, attempt decimal conversion with no prefix (eg 1234) */
-                    val = strtol(argval, (char**)&end, 10);
-                    if (end == argval) {
-                        /* all supported number formats failed */
-                        return ARG_ERR_BADINT;
-                    }
-                }
-            }
-        }
+        uint64_t mag;
+        int neg;
 
-        /* Safety check for integer overflow. WARNING: this check    */
-        /* achieves nothing on machines where size(int)==size(long). */
-        if (val > INT_MAX || val < INT_MIN)
-            errorcode = ARG_ERR_OVERFLOW;
+        errorcode = arg_int_scanmag(argval, 0, &mag, &neg);
 
-        /* Detect any suffixes (KB,MB,GB) and multiply argument value appropriately. */
-        /* We need to be mindful of integer overflows when using such big numbers.   */
-        if (detectsuffix(end, "KB")) /* kilobytes */
-        {
-            if (val > (INT_MAX / 1024) || val < (INT_MIN / 1024))
-                errorcode = ARG_ERR_OVERFLOW; /* Overflow would occur if we proceed */
-            else
-                val *= 1024;                /* 1KB = 1024 */
-        } else if (detectsuffix(end, "MB")) /* megabytes */
-        {
-            if (val > (INT_MAX / 1048576) || val < (INT_MIN / 1048576))
-                errorcode = ARG_ERR_OVERFLOW; /* Overflow would occur if we proceed */
-            else
-                val *= 1048576;             /* 1MB = 1024*1024 */
-        } else if (detectsuffix(end, "GB")) /* gigabytes */
-        {
-            if (val > (INT_MAX / 1073741824) || val < (INT_MIN / 1073741824))
-                errorcode = ARG_ERR_OVERFLOW; /* Overflow would occur if we proceed */
-            else
-                val *= 1073741824; /* 1GB = 1024*1024*1024 */
-        } else if (!detectsuffix(end, ""))
-            errorcode = ARG_ERR_BADINT; /* invalid suffix detected */
+        /* the magnitude of INT_MIN is one more than INT_MAX */
+        if (errorcode == 0 && mag > (uint64_t)INT_MAX + (neg ? 1 : 0))
+            errorcode = ARG_ERR_OVERFLOW;
 
         /* if success then store result in parent->ival[] array */
         if (errorcode == 0)
-            parent->ival[parent->count++] = (int)val;
+            parent->ival[parent->count++] = neg && mag ? -(int)(mag - 1) - 1 : (int)mag;
     }
 
     /* printf("%s:scanfn(%p,%p) returns %d\n",__FILE__,parent,argval,errorcode); */
@@ -250,6 +241,15 @@ static void arg_int_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const c
     }
 }
 
+static void* arg_int_clonefn(void* parent_) {
+    struct arg_int* parent = parent_;
+    struct arg_int* result = (struct arg_int*)arg_clone_block(parent, sizeof(struct arg_int) + (size_t)parent->hdr.maxcount * sizeof(int));
+    result->ival = (int*)ARG_CLONE_PTR(result, parent, parent->ival);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_int_ext = {ARG_HDR_EXT_VERSION, NULL, arg_int_clonefn};
+
 struct arg_int* arg_int0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
     return arg_intn(shortopts, longopts, datatype, 0, 1, glossary);
 }
@@ -271,7 +271,7 @@ struct arg_int* arg_intn(const char* shortopts, const char* longopts, const char
     result = (struct arg_int*)xmalloc(nbytes);
 
     /* init the arg_hdr struct */
-    result->hdr.flag = ARG_HASVALUE;
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
     result->hdr.shortopts = shortopts;
     result->hdr.longopts = longopts;
     result->hdr.datatype = datatype ? datatype : "<int>";
@@ -283,6 +283,7 @@ struct arg_int* arg_intn(const char* shortopts, const char* longopts, const char
     result->hdr.scanfn = arg_int_scanfn;
     result->hdr.checkfn = arg_int_checkfn;
     result->hdr.errorfn = arg_int_errorfn;
+    result->hdr.priv = (void*)&arg_int_ext;
 
     /* store the ival[maxcount] array immediately after the arg_int struct */
     result->ival = (int*)(result + 1);
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * arg_int64: Implements the 64-bit signed integer command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+static void arg_int64_resetfn(void* parent_) {
+    struct arg_int64* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+static int arg_int64_scanfn(void* parent_, const char* argval) {
+    struct arg_int64* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent argument value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        uint64_t mag;
+        int neg;
+
+        errorcode = arg_int_scanmag(argval, 1, &mag, &neg);
+
+        /* the magnitude of the most negative value is one more than the largest */
+        if (errorcode == 0 && mag > (~(uint64_t)0 >> 1) + (neg ? 1 : 0))
+            errorcode = ARG_ERR_OVERFLOW;
+
+        /* if success then store result in parent->ival[] array */
+        if (errorcode == 0)
+            parent->ival[parent->count++] = neg && mag ? -(int64_t)(mag - 1) - 1 : (int64_t)mag;
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_int64_checkfn(void* parent_) {
+    struct arg_int64* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_int64_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_int64* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADINT:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_OVERFLOW:
+            arg_dstr_cat(ds, "integer overflow at option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, " ");
+            arg_dstr_catf(ds, "(%s is too large)\n", argval);
+            break;
+    }
+}
+
+static void* arg_int64_clonefn(void* parent_) {
+    struct arg_int64* parent = parent_;
+    struct arg_int64* result = (struct arg_int64*)arg_clone_block(parent, sizeof(struct arg_int64) + (size_t)(parent->hdr.maxcount + 1) * sizeof(int64_t));
+    result->ival = (int64_t*)ARG_CLONE_PTR(result, parent, parent->ival);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_int64_ext = {ARG_HDR_EXT_VERSION, NULL, arg_int64_clonefn};
+
+arg_int64_t* arg_int640(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_int64n(shortopts, longopts, datatype, 0, 1, glossary);
+}
+
+arg_int64_t* arg_int641(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_int64n(shortopts, longopts, datatype, 1, 1, glossary);
+}
+
+arg_int64_t* arg_int64n(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    size_t nbytes;
+    struct arg_int64* result;
+    size_t addr;
+    size_t rem;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_int64)                    /* storage for struct arg_int64 */
+             + (size_t)(maxcount + 1) * sizeof(int64_t); /* storage for ival[maxcount] array plus one extra for padding to memory boundary */
+
+    result = (struct arg_int64*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype ? datatype : "<int64>";
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_int64_resetfn;
+    result->hdr.scanfn = arg_int64_scanfn;
+    result->hdr.checkfn = arg_int64_checkfn;
+    result->hdr.errorfn = arg_int64_errorfn;
+    result->hdr.priv = (void*)&arg_int64_ext;
+
+    /* Store the ival[maxcount] array on the first int64_t boundary that
+     * follows the arg_int64 struct, as some platforms require 64-bit
+     * integers to be aligned on natural boundaries.
+     */
+    addr = (size_t)(result + 1);
+    rem = addr % sizeof(int64_t);
+    result->ival = (int64_t*)(addr + sizeof(int64_t) - rem);
+    result->count = 0;
+
+    ARG_TRACE(("arg_int64n() returns %p\n", result));
+    return result;
+}
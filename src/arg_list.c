@@ -0,0 +1,561 @@
+/*******************************************************************************
+ * arg_list: Implements the list-valued command-line options
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The list types share one layout: the count of occurrences, the total
+ * number of elements, the first[] index array and a growable element array.
+ * The delimiter and the capacity of the element array are kept in a private
+ * struct stored immediately after the parent struct, like the private data of
+ * arg_rex.
+ */
+struct arg_list_priv {
+    struct arg_hdr_ext ext; /* must come first, see ARG_HASEXT */
+    int capacity;
+    char delim;
+};
+
+/* 0x0101010101010101 and 0x8080808080808080, spelled out without 64-bit literals */
+#define ARG_LIST_ONES (~(uint64_t)0 / 0xFF)
+#define ARG_LIST_HIGHS (ARG_LIST_ONES * 0x80)
+
+/*
+ * Returns a word with the high bit set in every byte of word that equals the
+ * byte replicated in pattern, and all other bits clear. Unlike the common
+ * "has zero byte" test, this one has no false positives, so the result can
+ * also be used to count matches.
+ */
+static uint64_t arg_list_match(uint64_t word, uint64_t pattern) {
+    uint64_t x = word ^ pattern;
+    return ~(((x & ~ARG_LIST_HIGHS) + ~ARG_LIST_HIGHS) | x) & ARG_LIST_HIGHS;
+}
+
+/* Returns the number of elements in [str, end), which is one more than the number of delimiters */
+static size_t arg_list_count(const char* str, const char* end, char delim) {
+    uint64_t pattern = ARG_LIST_ONES * (unsigned char)delim;
+    size_t n = 1;
+
+    for (; end - str >= 8; str += 8) {
+        uint64_t word;
+        memcpy(&word, str, 8);
+        /* each match contributes one to the top byte of the product */
+        n += (size_t)(((arg_list_match(word, pattern) >> 7) * ARG_LIST_ONES) >> 56);
+    }
+    for (; str < end; str++)
+        n += (*str == delim);
+
+    return n;
+}
+
+/* Returns the first delimiter in [str, end), or end if there is none */
+static const char* arg_list_find(const char* str, const char* end, char delim) {
+    uint64_t pattern = ARG_LIST_ONES * (unsigned char)delim;
+
+    /* skip eight characters at a time until a word contains the delimiter */
+    for (; end - str >= 8; str += 8) {
+        uint64_t word;
+        memcpy(&word, str, 8);
+        if (arg_list_match(word, pattern))
+            break;
+    }
+    while (str < end && *str != delim)
+        str++;
+
+    return str;
+}
+
+/* Returns vals, grown if needed to hold total elements of elemsize bytes */
+static void* arg_list_grow(struct arg_list_priv* priv, void* vals, size_t elemsize, int total) {
+    int capacity = priv->capacity < 16 ? 16 : priv->capacity;
+
+    if (total <= priv->capacity)
+        return vals;
+
+    while (capacity < total)
+        capacity = capacity <= INT_MAX / 2 ? capacity * 2 : INT_MAX;
+
+    priv->capacity = capacity;
+    return xrealloc(vals, (size_t)capacity * elemsize);
+}
+
+/*
+ * Copies the element [ptr, end) into buf if it fits, or into a new block
+ * otherwise, so that it can be handed to the NUL-terminated scanners.
+ */
+static char* arg_list_strndup(char* buf, size_t size, const char* ptr, const char* end) {
+    size_t len = (size_t)(end - ptr);
+    char* str = len < size ? buf : (char*)xmalloc(len + 1);
+    memcpy(str, ptr, len);
+    str[len] = '\0';
+    return str;
+}
+
+static int arg_intlist_scanelem(const char* ptr, const char* end, int* val) {
+    char buf[64];
+    char* str = arg_list_strndup(buf, sizeof(buf), ptr, end);
+    uint64_t mag;
+    int neg;
+    int errorcode;
+
+    errorcode = arg_int_scanmag(str, 0, &mag, &neg);
+
+    /* the magnitude of INT_MIN is one more than INT_MAX */
+    if (errorcode == 0 && mag > (uint64_t)INT_MAX + (neg ? 1 : 0))
+        errorcode = ARG_ERR_OVERFLOW;
+
+    if (errorcode == 0)
+        *val = neg && mag ? -(int)(mag - 1) - 1 : (int)mag;
+
+    if (str != buf)
+        xfree(str);
+    return errorcode;
+}
+
+static int arg_dbllist_scanelem(const char* ptr, const char* end, double* val) {
+    char buf[64];
+    char* str = arg_list_strndup(buf, sizeof(buf), ptr, end);
+    char* last;
+    int errorcode = 0;
+
+    /* extract double from the element, always with '.' as the decimal point */
+    *val = arg_strtod(str, &last);
+    if (*last != 0 || last == str)
+        errorcode = ARG_ERR_BADDOUBLE;
+
+    if (str != buf)
+        xfree(str);
+    return errorcode;
+}
+
+static void arg_intlist_resetfn(void* parent_) {
+    struct arg_intlist* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+    parent->nvals = 0;
+}
+
+static void arg_dbllist_resetfn(void* parent_) {
+    struct arg_dbllist* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+    parent->nvals = 0;
+}
+
+static void arg_strlist_resetfn(void* parent_) {
+    struct arg_strlist* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+    parent->nvals = 0;
+}
+
+static int arg_intlist_scanfn(void* parent_, const char* argval) {
+    struct arg_intlist* parent = parent_;
+    struct arg_list_priv* priv = (struct arg_list_priv*)parent->hdr.priv;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval || *argval == '\0') {
+        /* no value or an empty value gives an empty list */
+        parent->first[++parent->count] = parent->nvals;
+    } else {
+        const char* end = argval + strlen(argval);
+        size_t n = arg_list_count(argval, end, priv->delim);
+        int i = parent->nvals;
+
+        /* make room for all elements up front */
+        if (n > (size_t)(INT_MAX - i))
+            errorcode = ARG_ERR_OVERFLOW;
+        else
+            parent->ival = (int*)arg_list_grow(priv, parent->ival, sizeof(int), i + (int)n);
+
+        while (errorcode == 0 && argval <= end) {
+            const char* next = arg_list_find(argval, end, priv->delim);
+            errorcode = arg_intlist_scanelem(argval, next, &parent->ival[i++]);
+            argval = next + 1;
+        }
+
+        /* keep the elements only if all of them were valid */
+        if (errorcode == 0) {
+            parent->nvals = i;
+            parent->first[++parent->count] = i;
+        }
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_dbllist_scanfn(void* parent_, const char* argval) {
+    struct arg_dbllist* parent = parent_;
+    struct arg_list_priv* priv = (struct arg_list_priv*)parent->hdr.priv;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval || *argval == '\0') {
+        /* no value or an empty value gives an empty list */
+        parent->first[++parent->count] = parent->nvals;
+    } else {
+        const char* end = argval + strlen(argval);
+        size_t n = arg_list_count(argval, end, priv->delim);
+        int i = parent->nvals;
+
+        /* make room for all elements up front */
+        if (n > (size_t)(INT_MAX - i))
+            errorcode = ARG_ERR_OVERFLOW;
+        else
+            parent->dval = (double*)arg_list_grow(priv, parent->dval, sizeof(double), i + (int)n);
+
+        while (errorcode == 0 && argval <= end) {
+            const char* next = arg_list_find(argval, end, priv->delim);
+            errorcode = arg_dbllist_scanelem(argval, next, &parent->dval[i++]);
+            argval = next + 1;
+        }
+
+        /* keep the elements only if all of them were valid */
+        if (errorcode == 0) {
+            parent->nvals = i;
+            parent->first[++parent->count] = i;
+        }
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_strlist_scanfn(void* parent_, const char* argval) {
+    struct arg_strlist* parent = parent_;
+    struct arg_list_priv* priv = (struct arg_list_priv*)parent->hdr.priv;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval || *argval == '\0') {
+        /* no value or an empty value gives an empty list */
+        parent->first[++parent->count] = parent->nvals;
+    } else {
+        const char* end = argval + strlen(argval);
+        size_t n = arg_list_count(argval, end, priv->delim);
+        int i = parent->nvals;
+
+        /* make room for all elements up front */
+        if (n > (size_t)(INT_MAX - i))
+            errorcode = ARG_ERR_OVERFLOW;
+        else
+            parent->sval = (arg_slice_t*)arg_list_grow(priv, parent->sval, sizeof(arg_slice_t), i + (int)n);
+
+        if (errorcode == 0) {
+            /* the elements are slices of argval itself, nothing is copied */
+            while (argval <= end) {
+                const char* next = arg_list_find(argval, end, priv->delim);
+                parent->sval[i].ptr = argval;
+                parent->sval[i++].len = (size_t)(next - argval);
+                argval = next + 1;
+            }
+            parent->nvals = i;
+            parent->first[++parent->count] = i;
+        }
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_intlist_checkfn(void* parent_) {
+    struct arg_intlist* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_dbllist_checkfn(void* parent_) {
+    struct arg_dbllist* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_strlist_checkfn(void* parent_) {
+    struct arg_strlist* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+/* every list type starts with its arg_hdr, which is all the error messages need */
+static void arg_list_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_hdr* hdr = parent_;
+    const char* shortopts = hdr->shortopts;
+    const char* longopts = hdr->longopts;
+    const char* datatype = hdr->datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADINT:
+        case ARG_ERR_BADDOUBLE:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_OVERFLOW:
+            arg_dstr_cat(ds, "integer overflow at option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, " ");
+            arg_dstr_catf(ds, "(%s is too large)\n", argval);
+            break;
+    }
+}
+
+static void arg_intlist_freefn(void* parent_) {
+    struct arg_intlist* parent = parent_;
+    ARG_TRACE(("%s:freefn(%p)\n", __FILE__, parent));
+    xfree(parent->ival);
+}
+
+static void arg_dbllist_freefn(void* parent_) {
+    struct arg_dbllist* parent = parent_;
+    ARG_TRACE(("%s:freefn(%p)\n", __FILE__, parent));
+    xfree(parent->dval);
+}
+
+static void arg_strlist_freefn(void* parent_) {
+    struct arg_strlist* parent = parent_;
+    ARG_TRACE(("%s:freefn(%p)\n", __FILE__, parent));
+    xfree(parent->sval);
+}
+
+/*
+ * Copies a list struct of nbytes with its private struct and first[] array.
+ * The caller moves first[] and copies the values.
+ */
+static struct arg_hdr* arg_list_clone(void* parent, size_t nbytes) {
+    struct arg_hdr* hdr = (struct arg_hdr*)parent;
+    struct arg_hdr* result;
+
+    result = (struct arg_hdr*)arg_clone_block(parent, nbytes + sizeof(struct arg_list_priv) + (size_t)(hdr->maxcount + 1) * sizeof(int));
+    result->priv = ARG_CLONE_PTR(result, parent, hdr->priv);
+    return result;
+}
+
+/* Returns a copy of the nvals values of a list for its clone */
+static void* arg_list_dupvals(struct arg_hdr* clone, const void* vals, size_t elemsize, int nvals) {
+    struct arg_list_priv* priv = (struct arg_list_priv*)clone->priv;
+    void* result = NULL;
+
+    priv->capacity = 0;
+    if (nvals > 0) {
+        result = xmalloc((size_t)nvals * elemsize);
+        memcpy(result, vals, (size_t)nvals * elemsize);
+        priv->capacity = nvals;
+    }
+    return result;
+}
+
+static void* arg_intlist_clonefn(void* parent_) {
+    struct arg_intlist* parent = parent_;
+    struct arg_intlist* result = (struct arg_intlist*)arg_list_clone(parent, sizeof(struct arg_intlist));
+    result->first = (int*)ARG_CLONE_PTR(result, parent, parent->first);
+    result->ival = (int*)arg_list_dupvals(&result->hdr, parent->ival, sizeof(int), parent->nvals);
+    return result;
+}
+
+static void* arg_dbllist_clonefn(void* parent_) {
+    struct arg_dbllist* parent = parent_;
+    struct arg_dbllist* result = (struct arg_dbllist*)arg_list_clone(parent, sizeof(struct arg_dbllist));
+    result->first = (int*)ARG_CLONE_PTR(result, parent, parent->first);
+    result->dval = (double*)arg_list_dupvals(&result->hdr, parent->dval, sizeof(double), parent->nvals);
+    return result;
+}
+
+static void* arg_strlist_clonefn(void* parent_) {
+    struct arg_strlist* parent = parent_;
+    struct arg_strlist* result = (struct arg_strlist*)arg_list_clone(parent, sizeof(struct arg_strlist));
+    result->first = (int*)ARG_CLONE_PTR(result, parent, parent->first);
+    result->sval = (arg_slice_t*)arg_list_dupvals(&result->hdr, parent->sval, sizeof(arg_slice_t), parent->nvals);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_intlist_ext = {ARG_HDR_EXT_VERSION, arg_intlist_freefn, arg_intlist_clonefn};
+static const struct arg_hdr_ext arg_dbllist_ext = {ARG_HDR_EXT_VERSION, arg_dbllist_freefn, arg_dbllist_clonefn};
+static const struct arg_hdr_ext arg_strlist_ext = {ARG_HDR_EXT_VERSION, arg_strlist_freefn, arg_strlist_clonefn};
+
+/*
+ * Allocates a list struct of nbytes followed by the private struct and the
+ * first[maxcount + 1] array, and initializes its arg_hdr with the free and
+ * clone functions of ext. Returns the address of the first[] array through
+ * first. The caller sets the other type-specific functions and members.
+ */
+static struct arg_hdr* arg_list_create(size_t nbytes,
+                                       const struct arg_hdr_ext* ext,
+                                       const char* shortopts,
+                                       const char* longopts,
+                                       const char* datatype,
+                                       char delim,
+                                       int mincount,
+                                       int maxcount,
+                                       const char* glossary,
+                                       int** first) {
+    struct arg_hdr* hdr;
+    struct arg_list_priv* priv;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    hdr = (struct arg_hdr*)xmalloc(nbytes                                   /* storage for the list struct */
+                                   + sizeof(struct arg_list_priv)           /* storage for private list data */
+                                   + (size_t)(maxcount + 1) * sizeof(int)); /* storage for first[maxcount + 1] array */
+
+    /* init the arg_hdr struct, which is the first member of every list struct */
+    hdr->flag = ARG_HASVALUE | ARG_HASEXT;
+    hdr->shortopts = shortopts;
+    hdr->longopts = longopts;
+    hdr->datatype = datatype;
+    hdr->glossary = glossary;
+    hdr->mincount = mincount;
+    hdr->maxcount = maxcount;
+    hdr->parent = hdr;
+    hdr->errorfn = arg_list_errorfn;
+
+    /* store the private struct and then the first[] array after the list struct */
+    priv = (struct arg_list_priv*)((char*)hdr + nbytes);
+    priv->ext = *ext;
+    priv->capacity = 0;
+    priv->delim = delim ? delim : ',';
+    hdr->priv = priv;
+    *first = (int*)(priv + 1);
+    (*first)[0] = 0;
+
+    return hdr;
+}
+
+arg_intlist_t* arg_intlist0(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary) {
+    return arg_intlistn(shortopts, longopts, datatype, delim, 0, 1, glossary);
+}
+
+arg_intlist_t* arg_intlist1(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary) {
+    return arg_intlistn(shortopts, longopts, datatype, delim, 1, 1, glossary);
+}
+
+arg_intlist_t* arg_intlistn(const char* shortopts, const char* longopts, const char* datatype, char delim, int mincount, int maxcount, const char* glossary) {
+    struct arg_intlist* result;
+    int* first;
+
+    result = (struct arg_intlist*)arg_list_create(sizeof(struct arg_intlist), &arg_intlist_ext, shortopts, longopts,
+                                                 datatype ? datatype : "<ints>", delim, mincount, maxcount, glossary, &first);
+    result->hdr.resetfn = arg_intlist_resetfn;
+    result->hdr.scanfn = arg_intlist_scanfn;
+    result->hdr.checkfn = arg_intlist_checkfn;
+    result->first = first;
+    result->count = 0;
+    result->nvals = 0;
+    result->ival = NULL;
+
+    ARG_TRACE(("arg_intlistn() returns %p\n", result));
+    return result;
+}
+
+arg_dbllist_t* arg_dbllist0(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary) {
+    return arg_dbllistn(shortopts, longopts, datatype, delim, 0, 1, glossary);
+}
+
+arg_dbllist_t* arg_dbllist1(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary) {
+    return arg_dbllistn(shortopts, longopts, datatype, delim, 1, 1, glossary);
+}
+
+arg_dbllist_t* arg_dbllistn(const char* shortopts, const char* longopts, const char* datatype, char delim, int mincount, int maxcount, const char* glossary) {
+    struct arg_dbllist* result;
+    int* first;
+
+    result = (struct arg_dbllist*)arg_list_create(sizeof(struct arg_dbllist), &arg_dbllist_ext, shortopts, longopts,
+                                                 datatype ? datatype : "<doubles>", delim, mincount, maxcount, glossary, &first);
+    result->hdr.resetfn = arg_dbllist_resetfn;
+    result->hdr.scanfn = arg_dbllist_scanfn;
+    result->hdr.checkfn = arg_dbllist_checkfn;
+    result->first = first;
+    result->count = 0;
+    result->nvals = 0;
+    result->dval = NULL;
+
+    ARG_TRACE(("arg_dbllistn() returns %p\n", result));
+    return result;
+}
+
+arg_strlist_t* arg_strlist0(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary) {
+    return arg_strlistn(shortopts, longopts, datatype, delim, 0, 1, glossary);
+}
+
+arg_strlist_t* arg_strlist1(const char* shortopts, const char* longopts, const char* datatype, char delim, const char* glossary) {
+    return arg_strlistn(shortopts, longopts, datatype, delim, 1, 1, glossary);
+}
+
+arg_strlist_t* arg_strlistn(const char* shortopts, const char* longopts, const char* datatype, char delim, int mincount, int maxcount, const char* glossary) {
+    struct arg_strlist* result;
+    int* first;
+
+    result = (struct arg_strlist*)arg_list_create(sizeof(struct arg_strlist), &arg_strlist_ext, shortopts, longopts,
+                                                 datatype ? datatype : "<strings>", delim, mincount, maxcount, glossary, &first);
+    result->hdr.resetfn = arg_strlist_resetfn;
+    result->hdr.scanfn = arg_strlist_scanfn;
+    result->hdr.checkfn = arg_strlist_checkfn;
+    result->first = first;
+    result->count = 0;
+    result->nvals = 0;
+    result->sval = NULL;
+
+    ARG_TRACE(("arg_strlistn() returns %p\n", result));
+    return result;
+}
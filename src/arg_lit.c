@@ -85,6 +85,12 @@ static void arg_lit_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const c
     ARG_TRACE(("%s:errorfn(%p, %p, %d, %s, %s)\n", __FILE__, parent, ds, errorcode, argval, progname));
 }
 
+static void* arg_lit_clonefn(void* parent) {
+    return arg_clone_block(parent, sizeof(struct arg_lit));
+}
+
+static const struct arg_hdr_ext arg_lit_ext = {ARG_HDR_EXT_VERSION, NULL, arg_lit_clonefn};
+
 struct arg_lit* arg_lit0(const char* shortopts, const char* longopts, const char* glossary) {
     return arg_litn(shortopts, longopts, 0, 1, glossary);
 }
@@ -102,7 +108,7 @@ struct arg_lit* arg_litn(const char* shortopts, const char* longopts, int mincou
     result = (struct arg_lit*)xmalloc(sizeof(struct arg_lit));
 
     /* init the arg_hdr struct */
-    result->hdr.flag = 0;
+    result->hdr.flag = ARG_HASEXT;
     result->hdr.shortopts = shortopts;
     result->hdr.longopts = longopts;
     result->hdr.datatype = NULL;
@@ -114,6 +120,7 @@ struct arg_lit* arg_litn(const char* shortopts, const char* longopts, int mincou
     result->hdr.scanfn = arg_lit_scanfn;
     result->hdr.checkfn = arg_lit_checkfn;
     result->hdr.errorfn = arg_lit_errorfn;
+    result->hdr.priv = (void*)&arg_lit_ext;
 
     /* init local variables */
     result->count = 0;
@@ -38,10 +38,16 @@
 
 #include <stdlib.h>
 
+static void* arg_rem_clonefn(void* parent) {
+    return arg_clone_block(parent, sizeof(struct arg_rem));
+}
+
+static const struct arg_hdr_ext arg_rem_ext = {ARG_HDR_EXT_VERSION, NULL, arg_rem_clonefn};
+
 struct arg_rem* arg_rem(const char* datatype, const char* glossary) {
     struct arg_rem* result = (struct arg_rem*)xmalloc(sizeof(struct arg_rem));
 
-    result->hdr.flag = 0;
+    result->hdr.flag = ARG_HASEXT;
     result->hdr.shortopts = NULL;
     result->hdr.longopts = NULL;
     result->hdr.datatype = datatype;
@@ -53,6 +59,7 @@ struct arg_rem* arg_rem(const char* datatype, const char* glossary) {
     result->hdr.scanfn = NULL;
     result->hdr.checkfn = NULL;
     result->hdr.errorfn = NULL;
+    result->hdr.priv = (void*)&arg_rem_ext;
 
     ARG_TRACE(("arg_rem() returns %p\n", result));
     return result;
@@ -110,6 +110,7 @@ TREX_API TRexBool
 trex_searchrange(TRex* exp, const TRexChar* text_begin, const TRexChar* text_end, const TRexChar** out_begin, const TRexChar** out_end);
 TREX_API int trex_getsubexpcount(TRex* exp);
 TREX_API TRexBool trex_getsubexp(TRex* exp, int n, TRexMatch* subexp);
+TREX_API void trex_literals(TRex* exp, TRexChar* prefix, TRexChar* suffix, TRexChar* required);
 
 #ifdef __cplusplus
 }
@@ -118,10 +119,47 @@ TREX_API TRexBool trex_getsubexp(TRex* exp, int n, TRexMatch* subexp);
 #endif
 
 struct privhdr {
+    struct arg_hdr_ext ext; /* must come first, see ARG_HASEXT */
     const char* pattern;
     int flags;
+    const char* prefix;   /* bytes every match starts with */
+    const char* suffix;   /* bytes every match ends with */
+    const char* required; /* other bytes every match contains */
+    size_t prefixlen;
+    size_t suffixlen;
 };
 
+/* Returns the size of an arg_rex block, which ends with room for the
+ * prefix, suffix and required bytes. None of them can be longer than the
+ * pattern, as each of their bytes comes from a different literal in it.
+ */
+static size_t arg_rex_nbytes(const char* pattern, int maxcount) {
+    return sizeof(struct arg_rex)             /* storage for struct arg_rex */
+           + sizeof(struct privhdr)           /* storage for private arg_rex data */
+           + (size_t)maxcount * sizeof(char*) /* storage for sval[maxcount] array */
+           + 3 * (strlen(pattern) + 1);       /* storage for the literals */
+}
+
+/* Rejects values that lack a literal every match of the pattern has, which
+ * is much cheaper than compiling and running the pattern.
+ */
+static int arg_rex_prefilter(const struct privhdr* priv, const char* argval) {
+    size_t len = strlen(argval);
+    const char* c;
+
+    if (len < priv->prefixlen || len < priv->suffixlen)
+        return 0;
+    if (memcmp(argval, priv->prefix, priv->prefixlen) != 0)
+        return 0;
+    if (memcmp(argval + len - priv->suffixlen, priv->suffix, priv->suffixlen) != 0)
+        return 0;
+    for (c = priv->required; *c; c++) {
+        if (!memchr(argval, *c, len))
+            return 0;
+    }
+    return 1;
+}
+
 static void arg_rex_resetfn(void* parent_) {
     struct arg_rex* parent = parent_;
     ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
@@ -149,14 +187,15 @@ static int arg_rex_scanfn(void* parent_, const char* argval) {
         /* test the current argument value for a match with the regular expression */
         /* if a match is detected, record the argument value in the arg_rex struct */
 
-        rex = trex_compile(priv->pattern, &error, priv->flags);
-        is_match = trex_match(rex, argval);
+        if (arg_rex_prefilter(priv, argval)) {
+            rex = trex_compile(priv->pattern, &error, priv->flags);
+            is_match = trex_match(rex, argval);
+            trex_free(rex);
+        }
         if (!is_match)
             errorcode = ARG_ERR_REGNOMATCH;
         else
             parent->sval[parent->count++] = argval;
-
-        trex_free(rex);
     }
 
     ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
@@ -213,6 +252,25 @@ static void arg_rex_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const c
     }
 }
 
+static void* arg_rex_clonefn(void* parent_) {
+    struct arg_rex* parent = parent_;
+    struct arg_rex* result;
+
+    struct privhdr* priv = (struct privhdr*)parent->hdr.priv;
+    struct privhdr* clonepriv;
+
+    result = (struct arg_rex*)arg_clone_block(parent, arg_rex_nbytes(priv->pattern, parent->hdr.maxcount));
+    result->hdr.priv = ARG_CLONE_PTR(result, parent, parent->hdr.priv);
+    result->sval = (const char**)ARG_CLONE_PTR(result, parent, parent->sval);
+    clonepriv = (struct privhdr*)result->hdr.priv;
+    clonepriv->prefix = (const char*)ARG_CLONE_PTR(result, parent, priv->prefix);
+    clonepriv->suffix = (const char*)ARG_CLONE_PTR(result, parent, priv->suffix);
+    clonepriv->required = (const char*)ARG_CLONE_PTR(result, parent, priv->required);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_rex_ext = {ARG_HDR_EXT_VERSION, NULL, arg_rex_clonefn};
+
 struct arg_rex* arg_rex0(const char* shortopts, const char* longopts, const char* pattern, const char* datatype, int flags, const char* glossary) {
     return arg_rexn(shortopts, longopts, pattern, datatype, 0, 1, flags, glossary);
 }
@@ -232,6 +290,8 @@ struct arg_rex* arg_rexn(const char* shortopts,
     size_t nbytes;
     struct arg_rex* result;
     struct privhdr* priv;
+    char* literals;
+    size_t litlen;
     int i;
     const TRexChar* error = NULL;
     TRex* rex = NULL;
@@ -245,13 +305,11 @@ struct arg_rex* arg_rexn(const char* shortopts,
     /* foolproof things by ensuring maxcount is not less than mincount */
     maxcount = (maxcount < mincount) ? mincount : maxcount;
 
-    nbytes = sizeof(struct arg_rex)      /* storage for struct arg_rex */
-             + sizeof(struct privhdr)    /* storage for private arg_rex data */
-             + (size_t)maxcount * sizeof(char*); /* storage for sval[maxcount] array */
+    nbytes = arg_rex_nbytes(pattern, maxcount);
 
     /* init the arg_hdr struct */
     result = (struct arg_rex*)xmalloc(nbytes);
-    result->hdr.flag = ARG_HASVALUE;
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
     result->hdr.shortopts = shortopts;
     result->hdr.longopts = longopts;
     result->hdr.datatype = datatype ? datatype : pattern;
@@ -267,6 +325,7 @@ struct arg_rex* arg_rexn(const char* shortopts,
     /* store the arg_rex_priv struct immediately after the arg_rex struct */
     result->hdr.priv = result + 1;
     priv = (struct privhdr*)(result->hdr.priv);
+    priv->ext = arg_rex_ext;
     priv->pattern = pattern;
     priv->flags = flags;
 
@@ -278,17 +337,30 @@ struct arg_rex* arg_rexn(const char* shortopts,
     for (i = 0; i < maxcount; i++)
         result->sval[i] = "";
 
+    /* store the prefix, suffix and required bytes after the sval[] array */
+    litlen = strlen(pattern) + 1;
+    literals = (char*)(result->sval + maxcount);
+    memset(literals, 0, 3 * litlen);
+    priv->prefix = literals;
+    priv->suffix = literals + litlen;
+    priv->required = literals + 2 * litlen;
+
     /* here we construct and destroy a regex representation of the regular
      * expression for no other reason than to force any regex errors to be
      * trapped now rather than later. If we don't, then errors may go undetected
-     * until an argument is actually parsed.
+     * until an argument is actually parsed. The compiled program also gives
+     * the literals that scanfn checks before it runs the full match.
      */
 
     rex = trex_compile(priv->pattern, &error, priv->flags);
     if (rex == NULL) {
         ARG_LOG(("argtable: %s \"%s\"\n", error ? error : _TREXC("undefined"), priv->pattern));
         ARG_LOG(("argtable: Bad argument table.\n"));
+    } else {
+        trex_literals(rex, literals, literals + litlen, literals + 2 * litlen);
     }
+    priv->prefixlen = strlen(priv->prefix);
+    priv->suffixlen = strlen(priv->suffix);
 
     trex_free(rex);
 
@@ -1012,3 +1084,65 @@ TRexBool trex_getsubexp(TRex* exp, int n, TRexMatch* subexp) {
     *subexp = exp->_matches[n];
     return TRex_True;
 }
+
+/* Marks the characters that every match of the node chain has to contain.
+ * A chain starting with an alternation guarantees nothing, and a repeated
+ * node only contributes when it has to match at least once.
+ */
+static void trex_required(TRex* exp, int node, unsigned char* seen) {
+    if (node == -1 || exp->_nodes[node].type == OP_OR)
+        return;
+    for (; node != -1; node = exp->_nodes[node].next) {
+        TRexNode* n = &exp->_nodes[node];
+        if (n->type <= MAX_CHAR)
+            seen[(unsigned char)n->type] = 1;
+        else if (n->type == OP_EXPR || n->type == OP_NOCAPEXPR)
+            trex_required(exp, n->left, seen);
+        else if (n->type == OP_GREEDY && ((n->right >> 16) & 0x0000FFFF) > 0)
+            trex_required(exp, n->left, seen);
+    }
+}
+
+/* Extracts the literals of the top-level node chain that every text accepted
+ * by trex_match has: the characters it starts with, those it ends with, and
+ * the other characters it contains, each as a NUL terminated string. Since
+ * trex_match consumes the text from its start to its end, one node after the
+ * other, the characters matched by a leading run of character nodes are a
+ * prefix of the text and those of a trailing run are a suffix. Anchors and
+ * word boundaries consume nothing and do not break a run. Case insensitive
+ * programs yield no literals.
+ */
+void trex_literals(TRex* exp, TRexChar* prefix, TRexChar* suffix, TRexChar* required) {
+    unsigned char seen[MAX_CHAR + 1];
+    int node = exp->_nodes[exp->_first].left;
+    int inprefix = 1;
+    int np = 0, ns = 0, nr = 0;
+    int c, i;
+
+    memset(seen, 0, sizeof(seen));
+    if (!(exp->_flags & TREX_ICASE) && node != -1 && exp->_nodes[node].type != OP_OR) {
+        for (; node != -1; node = exp->_nodes[node].next) {
+            TRexNodeType type = exp->_nodes[node].type;
+            if (type <= MAX_CHAR) {
+                if (inprefix)
+                    prefix[np++] = (TRexChar)type;
+                suffix[ns++] = (TRexChar)type;
+            } else if (type != OP_BOL && type != OP_EOL && type != OP_WB) {
+                inprefix = 0;
+                ns = 0;
+            }
+        }
+        trex_required(exp, exp->_nodes[exp->_first].left, seen);
+    }
+
+    /* the prefix and suffix are compared as a whole, so their characters need no search */
+    for (i = 0; i < np; i++)
+        seen[(unsigned char)prefix[i]] = 0;
+    for (i = 0; i < ns; i++)
+        seen[(unsigned char)suffix[i]] = 0;
+    for (c = 1; c <= MAX_CHAR; c++) {
+        if (seen[c])
+            required[nr++] = (TRexChar)c;
+    }
+    prefix[np] = suffix[ns] = required[nr] = 0;
+}
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * arg_size: Implements the byte size command-line option
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <ctype.h>
+#include <string.h>
+
+static void arg_size_resetfn(void* parent_) {
+    struct arg_size* parent = parent_;
+    ARG_TRACE(("%s:resetfn(%p)\n", __FILE__, parent));
+    parent->count = 0;
+}
+
+/* Multipliers for the SI (powers of 1000) and IEC (powers of 1024) */
+/* prefixes, in the order k, M, G, T, P, E.                          */
+static const char arg_size_prefixes[] = "KMGTPE";
+
+/* arg_size_scan() converts a byte count such as "64MiB", "10kB" or   */
+/* "512" in a single pass. The grammar is                              */
+/*                                                                     */
+/*   [ws] [+] digits [B | prefix B | prefix iB] [ws]                   */
+/*                                                                     */
+/* where prefix is one of k, M, G, T, P or E. "kB" style suffixes are  */
+/* SI multiples (1kB = 1000 bytes), "KiB" style suffixes are IEC       */
+/* multiples (1KiB = 1024 bytes). Suffixes are case insensitive.       */
+/* Returns 0 on success, ARG_ERR_BADINT for malformed input, or        */
+/* ARG_ERR_OVERFLOW if the size does not fit in 64 bits.               */
+static int arg_size_scan(const char* str, uint64_t* result) {
+    const unsigned char* ptr = (const unsigned char*)str;
+    const unsigned char* digits;
+    const char* prefix;
+    uint64_t max = ~(uint64_t)0;
+    uint64_t val = 0;
+    uint64_t mult = 1;
+    int overflow = 0;
+
+    while (isspace(*ptr))
+        ptr++;
+    if (*ptr == '+')
+        ptr++;
+
+    digits = ptr;
+    for (; *ptr >= '0' && *ptr <= '9'; ptr++) {
+        unsigned int d = (unsigned int)(*ptr - '0');
+        if (val > (max - d) / 10)
+            overflow = 1;
+        else
+            val = val * 10 + d;
+    }
+    if (ptr == digits)
+        return ARG_ERR_BADINT;
+
+    /* optional unit suffix */
+    prefix = *ptr ? strchr(arg_size_prefixes, toupper(*ptr)) : NULL;
+    if (prefix) {
+        uint64_t base = 1000;
+        int n;
+
+        ptr++;
+        if (*ptr == 'i' || *ptr == 'I') {
+            base = 1024;
+            ptr++;
+        }
+        for (n = 0; n <= prefix - arg_size_prefixes; n++)
+            mult *= base;
+        if (*ptr != 'B' && *ptr != 'b')
+            return ARG_ERR_BADINT;
+    }
+    if (*ptr == 'B' || *ptr == 'b')
+        ptr++;
+
+    while (isspace(*ptr))
+        ptr++;
+    if (*ptr != '\0')
+        return ARG_ERR_BADINT;
+
+    if (overflow || val > max / mult)
+        return ARG_ERR_OVERFLOW;
+
+    *result = val * mult;
+    return 0;
+}
+
+static int arg_size_scanfn(void* parent_, const char* argval) {
+    struct arg_size* parent = parent_;
+    int errorcode = 0;
+
+    if (parent->count == parent->hdr.maxcount) {
+        /* maximum number of arguments exceeded */
+        errorcode = ARG_ERR_MAXCOUNT;
+    } else if (!argval) {
+        /* a valid argument with no argument value was given. */
+        /* This happens when an optional argument value was invoked. */
+        /* leave parent argument value unaltered but still count the argument. */
+        parent->count++;
+    } else {
+        uint64_t bytes;
+
+        errorcode = arg_size_scan(argval, &bytes);
+
+        /* if success then store result in parent->bytes[] array */
+        if (errorcode == 0)
+            parent->bytes[parent->count++] = bytes;
+    }
+
+    ARG_TRACE(("%s:scanfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static int arg_size_checkfn(void* parent_) {
+    struct arg_size* parent = parent_;
+    int errorcode = (parent->count < parent->hdr.mincount) ? ARG_ERR_MINCOUNT : 0;
+    ARG_TRACE(("%s:checkfn(%p) returns %d\n", __FILE__, parent, errorcode));
+    return errorcode;
+}
+
+static void arg_size_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const char* argval, const char* progname) {
+    struct arg_size* parent = parent_;
+    const char* shortopts = parent->hdr.shortopts;
+    const char* longopts = parent->hdr.longopts;
+    const char* datatype = parent->hdr.datatype;
+
+    /* make argval NULL safe */
+    argval = argval ? argval : "";
+
+    arg_dstr_catf(ds, "%s: ", progname);
+    switch (errorcode) {
+        case ARG_ERR_MINCOUNT:
+            arg_dstr_cat(ds, "missing option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_MAXCOUNT:
+            arg_dstr_cat(ds, "excess option ");
+            arg_print_option_ds(ds, shortopts, longopts, argval, "\n");
+            break;
+
+        case ARG_ERR_BADINT:
+            arg_dstr_catf(ds, "invalid argument \"%s\" to option ", argval);
+            arg_print_option_ds(ds, shortopts, longopts, datatype, "\n");
+            break;
+
+        case ARG_ERR_OVERFLOW:
+            arg_dstr_cat(ds, "integer overflow at option ");
+            arg_print_option_ds(ds, shortopts, longopts, datatype, " ");
+            arg_dstr_catf(ds, "(%s is too large)\n", argval);
+            break;
+    }
+}
+
+static void* arg_size_clonefn(void* parent_) {
+    struct arg_size* parent = parent_;
+    struct arg_size* result = (struct arg_size*)arg_clone_block(parent, sizeof(struct arg_size) + (size_t)(parent->hdr.maxcount + 1) * sizeof(uint64_t));
+    result->bytes = (uint64_t*)ARG_CLONE_PTR(result, parent, parent->bytes);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_size_ext = {ARG_HDR_EXT_VERSION, NULL, arg_size_clonefn};
+
+arg_size_t* arg_size0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_sizen(shortopts, longopts, datatype, 0, 1, glossary);
+}
+
+arg_size_t* arg_size1(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
+    return arg_sizen(shortopts, longopts, datatype, 1, 1, glossary);
+}
+
+arg_size_t* arg_sizen(const char* shortopts, const char* longopts, const char* datatype, int mincount, int maxcount, const char* glossary) {
+    size_t nbytes;
+    struct arg_size* result;
+    size_t addr;
+    size_t rem;
+
+    /* foolproof things by ensuring maxcount is not less than mincount */
+    maxcount = (maxcount < mincount) ? mincount : maxcount;
+
+    nbytes = sizeof(struct arg_size)                    /* storage for struct arg_size */
+             + (size_t)(maxcount + 1) * sizeof(uint64_t); /* storage for bytes[maxcount] array plus one extra for padding to memory boundary */
+
+    result = (struct arg_size*)xmalloc(nbytes);
+
+    /* init the arg_hdr struct */
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
+    result->hdr.shortopts = shortopts;
+    result->hdr.longopts = longopts;
+    result->hdr.datatype = datatype ? datatype : "<size>";
+    result->hdr.glossary = glossary;
+    result->hdr.mincount = mincount;
+    result->hdr.maxcount = maxcount;
+    result->hdr.parent = result;
+    result->hdr.resetfn = arg_size_resetfn;
+    result->hdr.scanfn = arg_size_scanfn;
+    result->hdr.checkfn = arg_size_checkfn;
+    result->hdr.errorfn = arg_size_errorfn;
+    result->hdr.priv = (void*)&arg_size_ext;
+
+    /* Store the bytes[maxcount] array on the first uint64_t boundary that
+     * follows the arg_size struct, as some platforms require 64-bit
+     * integers to be aligned on natural boundaries.
+     */
+    addr = (size_t)(result + 1);
+    rem = addr % sizeof(uint64_t);
+    result->bytes = (uint64_t*)(addr + sizeof(uint64_t) - rem);
+    result->count = 0;
+
+    ARG_TRACE(("arg_sizen() returns %p\n", result));
+    return result;
+}
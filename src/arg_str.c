@@ -100,6 +100,15 @@ static void arg_str_errorfn(void* parent_, arg_dstr_t ds, int errorcode, const c
     }
 }
 
+static void* arg_str_clonefn(void* parent_) {
+    struct arg_str* parent = parent_;
+    struct arg_str* result = (struct arg_str*)arg_clone_block(parent, sizeof(struct arg_str) + (size_t)parent->hdr.maxcount * sizeof(char*));
+    result->sval = (const char**)ARG_CLONE_PTR(result, parent, parent->sval);
+    return result;
+}
+
+static const struct arg_hdr_ext arg_str_ext = {ARG_HDR_EXT_VERSION, NULL, arg_str_clonefn};
+
 struct arg_str* arg_str0(const char* shortopts, const char* longopts, const char* datatype, const char* glossary) {
     return arg_strn(shortopts, longopts, datatype, 0, 1, glossary);
 }
@@ -124,7 +133,7 @@ struct arg_str* arg_strn(const char* shortopts, const char* longopts, const char
     result = (struct arg_str*)xmalloc(nbytes);
 
     /* init the arg_hdr struct */
-    result->hdr.flag = ARG_HASVALUE;
+    result->hdr.flag = ARG_HASVALUE | ARG_HASEXT;
     result->hdr.shortopts = shortopts;
     result->hdr.longopts = longopts;
     result->hdr.datatype = datatype ? datatype : "<string>";
@@ -136,6 +145,7 @@ struct arg_str* arg_strn(const char* shortopts, const char* longopts, const char
     result->hdr.scanfn = arg_str_scanfn;
     result->hdr.checkfn = arg_str_checkfn;
     result->hdr.errorfn = arg_str_errorfn;
+    result->hdr.priv = (void*)&arg_str_ext;
 
     /* store the sval[maxcount] array immediately after the arg_str struct */
     result->sval = (const char**)(result + 1);
@@ -0,0 +1,450 @@
+/*******************************************************************************
+ * arg_thread: Implements the threading primitives and the worker pool
+ *
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+
+#include "argtable3.h"
+
+#ifndef ARG_AMALGAMATION
+#include "argtable3_private.h"
+#endif
+
+#include <stdlib.h>
+
+#if ARG_ENABLE_THREADS
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#undef WIN32_LEAN_AND_MEAN
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
+#if ARG_ENABLE_THREADS && defined(_WIN32)
+
+typedef SRWLOCK arg_mutex_t;
+typedef CONDITION_VARIABLE arg_cond_t;
+typedef HANDLE arg_thread_t;
+
+#define ARG_MUTEX_INITIALIZER SRWLOCK_INIT
+
+static void arg_mutex_init(arg_mutex_t* m) {
+    InitializeSRWLock(m);
+}
+
+static void arg_mutex_destroy(arg_mutex_t* m) {
+    (void)m;
+}
+
+static void arg_mutex_lock(arg_mutex_t* m) {
+    AcquireSRWLockExclusive(m);
+}
+
+static void arg_mutex_unlock(arg_mutex_t* m) {
+    ReleaseSRWLockExclusive(m);
+}
+
+static void arg_cond_init(arg_cond_t* c) {
+    InitializeConditionVariable(c);
+}
+
+static void arg_cond_destroy(arg_cond_t* c) {
+    (void)c;
+}
+
+static void arg_cond_wait(arg_cond_t* c, arg_mutex_t* m) {
+    SleepConditionVariableSRW(c, m, INFINITE, 0);
+}
+
+static void arg_cond_broadcast(arg_cond_t* c) {
+    WakeAllConditionVariable(c);
+}
+
+static void arg_cond_signal(arg_cond_t* c) {
+    WakeConditionVariable(c);
+}
+
+struct arg_thread_start {
+    void (*proc)(void*);
+    void* arg;
+};
+
+static DWORD WINAPI arg_thread_main(LPVOID param) {
+    struct arg_thread_start start = *(struct arg_thread_start*)param;
+    xfree(param);
+    start.proc(start.arg);
+    return 0;
+}
+
+static int arg_thread_create(arg_thread_t* t, void (*proc)(void*), void* arg) {
+    struct arg_thread_start* start = (struct arg_thread_start*)xmalloc(sizeof(struct arg_thread_start));
+    start->proc = proc;
+    start->arg = arg;
+    *t = CreateThread(NULL, 0, arg_thread_main, start, 0, NULL);
+    if (*t == NULL) {
+        xfree(start);
+        return -1;
+    }
+    return 0;
+}
+
+static void arg_thread_join(arg_thread_t t) {
+    WaitForSingleObject(t, INFINITE);
+    CloseHandle(t);
+}
+
+int arg_thread_ncpu(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+}
+
+#elif ARG_ENABLE_THREADS
+
+typedef pthread_mutex_t arg_mutex_t;
+typedef pthread_cond_t arg_cond_t;
+typedef pthread_t arg_thread_t;
+
+#define ARG_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+
+static void arg_mutex_init(arg_mutex_t* m) {
+    pthread_mutex_init(m, NULL);
+}
+
+static void arg_mutex_destroy(arg_mutex_t* m) {
+    pthread_mutex_destroy(m);
+}
+
+static void arg_mutex_lock(arg_mutex_t* m) {
+    pthread_mutex_lock(m);
+}
+
+static void arg_mutex_unlock(arg_mutex_t* m) {
+    pthread_mutex_unlock(m);
+}
+
+static void arg_cond_init(arg_cond_t* c) {
+    pthread_cond_init(c, NULL);
+}
+
+static void arg_cond_destroy(arg_cond_t* c) {
+    pthread_cond_destroy(c);
+}
+
+static void arg_cond_wait(arg_cond_t* c, arg_mutex_t* m) {
+    pthread_cond_wait(c, m);
+}
+
+static void arg_cond_broadcast(arg_cond_t* c) {
+    pthread_cond_broadcast(c);
+}
+
+static void arg_cond_signal(arg_cond_t* c) {
+    pthread_cond_signal(c);
+}
+
+struct arg_thread_start {
+    void (*proc)(void*);
+    void* arg;
+};
+
+static void* arg_thread_main(void* param) {
+    struct arg_thread_start start = *(struct arg_thread_start*)param;
+    xfree(param);
+    start.proc(start.arg);
+    return NULL;
+}
+
+static int arg_thread_create(arg_thread_t* t, void (*proc)(void*), void* arg) {
+    struct arg_thread_start* start = (struct arg_thread_start*)xmalloc(sizeof(struct arg_thread_start));
+    start->proc = proc;
+    start->arg = arg;
+    if (pthread_create(t, NULL, arg_thread_main, start) != 0) {
+        xfree(start);
+        return -1;
+    }
+    return 0;
+}
+
+static void arg_thread_join(arg_thread_t t) {
+    pthread_join(t, NULL);
+}
+
+int arg_thread_ncpu(void) {
+#ifdef _SC_NPROCESSORS_ONLN
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#else
+    return 1;
+#endif
+}
+
+#else
+
+/*
+ * Without thread support the pool never starts any workers, so every task is
+ * still queued when it is joined and runs on the joining thread. The locking
+ * primitives have nothing to protect and compile to no-ops.
+ */
+typedef int arg_mutex_t;
+typedef int arg_cond_t;
+typedef int arg_thread_t;
+
+#define ARG_MUTEX_INITIALIZER 0
+
+static void arg_mutex_init(arg_mutex_t* m) {
+    *m = 0;
+}
+
+static void arg_mutex_destroy(arg_mutex_t* m) {
+    (void)m;
+}
+
+static void arg_mutex_lock(arg_mutex_t* m) {
+    (void)m;
+}
+
+static void arg_mutex_unlock(arg_mutex_t* m) {
+    (void)m;
+}
+
+static void arg_cond_init(arg_cond_t* c) {
+    *c = 0;
+}
+
+static void arg_cond_destroy(arg_cond_t* c) {
+    (void)c;
+}
+
+static void arg_cond_wait(arg_cond_t* c, arg_mutex_t* m) {
+    (void)c;
+    (void)m;
+}
+
+static void arg_cond_broadcast(arg_cond_t* c) {
+    (void)c;
+}
+
+static void arg_cond_signal(arg_cond_t* c) {
+    (void)c;
+}
+
+static int arg_thread_create(arg_thread_t* t, void (*proc)(void*), void* arg) {
+    (void)t;
+    (void)proc;
+    (void)arg;
+    return -1;
+}
+
+static void arg_thread_join(arg_thread_t t) {
+    (void)t;
+}
+
+int arg_thread_ncpu(void) {
+    return 1;
+}
+
+#endif
+
+static arg_mutex_t s_global_lock = ARG_MUTEX_INITIALIZER;
+
+void arg_global_lock(void) {
+    arg_mutex_lock(&s_global_lock);
+}
+
+void arg_global_unlock(void) {
+    arg_mutex_unlock(&s_global_lock);
+}
+
+struct arg_tpool {
+    arg_mutex_t lock;
+    arg_cond_t work; /* signalled when a task is queued or the pool shuts down */
+    arg_cond_t done; /* broadcast whenever a task finishes */
+    arg_task_t* head;
+    arg_task_t* tail;
+    int shutdown;
+    int nthreads;
+    arg_thread_t* threads;
+};
+
+/* Run a task that has already been taken off the queue. Called without the lock held. */
+static void arg_tpool_run(arg_tpool_t* pool, arg_task_t* task) {
+    task->fn(task->arg);
+
+    arg_mutex_lock(&pool->lock);
+    task->state = ARG_TASK_DONE;
+    arg_cond_broadcast(&pool->done);
+    arg_mutex_unlock(&pool->lock);
+}
+
+/* Remove the first queued task. Called with the lock held. */
+static arg_task_t* arg_tpool_pop(arg_tpool_t* pool) {
+    arg_task_t* task = pool->head;
+    if (task) {
+        pool->head = task->next;
+        if (pool->head == NULL)
+            pool->tail = NULL;
+        task->next = NULL;
+        task->state = ARG_TASK_RUNNING;
+    }
+    return task;
+}
+
+static void arg_tpool_worker(void* arg) {
+    arg_tpool_t* pool = (arg_tpool_t*)arg;
+    arg_task_t* task;
+
+    arg_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->head == NULL && !pool->shutdown)
+            arg_cond_wait(&pool->work, &pool->lock);
+
+        /* the queue is drained before a worker honours a shutdown request */
+        task = arg_tpool_pop(pool);
+        if (task == NULL)
+            break;
+
+        arg_mutex_unlock(&pool->lock);
+        arg_tpool_run(pool, task);
+        arg_mutex_lock(&pool->lock);
+    }
+    arg_mutex_unlock(&pool->lock);
+}
+
+arg_tpool_t* arg_tpool_create(int nthreads) {
+    arg_tpool_t* pool;
+    int i;
+
+    nthreads = nthreads < 0 ? 0 : nthreads;
+
+    pool = (arg_tpool_t*)xmalloc(sizeof(arg_tpool_t));
+    arg_mutex_init(&pool->lock);
+    arg_cond_init(&pool->work);
+    arg_cond_init(&pool->done);
+    pool->head = NULL;
+    pool->tail = NULL;
+    pool->shutdown = 0;
+    pool->nthreads = 0;
+    pool->threads = (arg_thread_t*)xcalloc((size_t)(nthreads > 0 ? nthreads : 1), sizeof(arg_thread_t));
+
+    /* a thread that fails to start just leaves the pool smaller */
+    for (i = 0; i < nthreads; i++) {
+        if (arg_thread_create(&pool->threads[pool->nthreads], arg_tpool_worker, pool) == 0)
+            pool->nthreads++;
+    }
+
+    return pool;
+}
+
+void arg_tpool_destroy(arg_tpool_t* pool) {
+    arg_task_t* task;
+    int i;
+
+    if (pool == NULL)
+        return;
+
+    arg_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    arg_cond_broadcast(&pool->work);
+    arg_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < pool->nthreads; i++)
+        arg_thread_join(pool->threads[i]);
+
+    /* a pool without workers still owes its queued tasks a run */
+    while ((task = arg_tpool_pop(pool)) != NULL)
+        arg_tpool_run(pool, task);
+
+    arg_cond_destroy(&pool->done);
+    arg_cond_destroy(&pool->work);
+    arg_mutex_destroy(&pool->lock);
+    xfree(pool->threads);
+    xfree(pool);
+}
+
+int arg_tpool_size(arg_tpool_t* pool) {
+    return pool->nthreads;
+}
+
+void arg_tpool_submit(arg_tpool_t* pool, arg_task_t* task, arg_taskfn* fn, void* arg) {
+    task->fn = fn;
+    task->arg = arg;
+    task->state = ARG_TASK_QUEUED;
+    task->next = NULL;
+
+    arg_mutex_lock(&pool->lock);
+    if (pool->tail)
+        pool->tail->next = task;
+    else
+        pool->head = task;
+    pool->tail = task;
+    arg_cond_signal(&pool->work);
+    arg_mutex_unlock(&pool->lock);
+}
+
+int arg_tpool_done(arg_tpool_t* pool, arg_task_t* task) {
+    int done;
+
+    arg_mutex_lock(&pool->lock);
+    done = (task->state == ARG_TASK_DONE);
+    arg_mutex_unlock(&pool->lock);
+    return done;
+}
+
+void arg_tpool_join(arg_tpool_t* pool, arg_task_t* task) {
+    arg_mutex_lock(&pool->lock);
+
+    /* nobody has started the task yet, so run it here instead of idling */
+    if (task->state == ARG_TASK_QUEUED) {
+        arg_task_t** link = &pool->head;
+        arg_task_t* prev = NULL;
+
+        while (*link != task) {
+            prev = *link;
+            link = &(*link)->next;
+        }
+        *link = task->next;
+        if (pool->tail == task)
+            pool->tail = prev;
+        task->next = NULL;
+        task->state = ARG_TASK_RUNNING;
+
+        arg_mutex_unlock(&pool->lock);
+        arg_tpool_run(pool, task);
+        return;
+    }
+
+    while (task->state != ARG_TASK_DONE)
+        arg_cond_wait(&pool->done, &pool->lock);
+    arg_mutex_unlock(&pool->lock);
+}
@@ -40,6 +40,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#undef WIN32_LEAN_AND_MEAN
+#elif ARG_ENABLE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 static void panic(const char* fmt, ...);
 static arg_panicfn* s_panic = panic;
@@ -110,6 +122,14 @@ void xfree(void* ptr) {
     free(ptr);
 }
 
+void* arg_clone_block(const void* parent, size_t nbytes) {
+    struct arg_hdr* result = (struct arg_hdr*)xmalloc(nbytes);
+
+    memcpy(result, parent, nbytes);
+    result->parent = result;
+    return result;
+}
+
 static void merge(void* data, int esize, int i, int j, int k, arg_comparefn* comparefn) {
     char* a = (char*)data;
     char* m;
@@ -176,3 +196,266 @@ void arg_mgsort(void* data, int size, int esize, int i, int k, arg_comparefn* co
         merge(data, esize, i, j, k, comparefn);
     }
 }
+
+/* Read a whole stream into a heap buffer with one spare byte for the terminator. */
+int arg_mmap_read(arg_mmap_t* map, FILE* fp) {
+    size_t cap = 4096;
+    size_t len = 0;
+    char* buf = (char*)xmalloc(cap + 1);
+
+    for (;;) {
+        size_t n = fread(buf + len, 1, cap - len, fp);
+        len += n;
+        if (len < cap)
+            break;
+        cap *= 2;
+        buf = (char*)xrealloc(buf, cap + 1);
+    }
+
+    if (ferror(fp)) {
+        xfree(buf);
+        return -1;
+    }
+
+    buf[len] = '\0';
+    map->data = buf;
+    map->len = len;
+    map->mapped = 0;
+    return 0;
+}
+
+int arg_mmap_open(arg_mmap_t* map, const char* path) {
+    FILE* fp;
+    int err;
+
+    map->data = NULL;
+    map->len = 0;
+    map->mapped = 0;
+
+#if ARG_ENABLE_MMAP && defined(_WIN32)
+    {
+        HANDLE file, mapping;
+        LARGE_INTEGER size;
+        SYSTEM_INFO info;
+        void* view = NULL;
+
+        GetSystemInfo(&info);
+        file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file != INVALID_HANDLE_VALUE) {
+            /* the terminator lives in the zero-filled tail of the last page, so whole pages can't be mapped */
+            if (GetFileSizeEx(file, &size) && size.QuadPart > 0 && (size_t)size.QuadPart == (SIZE_T)size.QuadPart &&
+                (size.QuadPart % info.dwPageSize) != 0) {
+                mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+                if (mapping != NULL) {
+                    view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+                    CloseHandle(mapping);
+                }
+            }
+            CloseHandle(file);
+        }
+
+        if (view != NULL) {
+            map->data = (char*)view;
+            map->len = (size_t)size.QuadPart;
+            map->mapped = 1;
+            return 0;
+        }
+    }
+#elif ARG_ENABLE_MMAP
+    {
+        struct stat st;
+        void* view = MAP_FAILED;
+        long pagesize = sysconf(_SC_PAGESIZE);
+        int fd = open(path, O_RDONLY);
+
+        if (fd >= 0) {
+            /* the terminator lives in the zero-filled tail of the last page, so whole pages can't be mapped */
+            if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 && pagesize > 0 && (st.st_size % pagesize) != 0)
+                view = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            close(fd);
+        }
+
+        if (view != MAP_FAILED) {
+            map->data = (char*)view;
+            map->len = (size_t)st.st_size;
+            map->mapped = 1;
+            return 0;
+        }
+    }
+#endif
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4996)
+#endif
+    fp = fopen(path, "rb");
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+    if (fp == NULL)
+        return -1;
+
+    err = arg_mmap_read(map, fp);
+    fclose(fp);
+    return err;
+}
+
+void arg_mmap_copy(arg_mmap_t* map, const char* buf, size_t len) {
+    map->data = (char*)xmalloc(len + 1);
+    memcpy(map->data, buf, len);
+    map->data[len] = '\0';
+    map->len = len;
+    map->mapped = 0;
+}
+
+void arg_mmap_close(arg_mmap_t* map) {
+    if (map->data == NULL)
+        return;
+
+#if ARG_ENABLE_MMAP && defined(_WIN32)
+    if (map->mapped)
+        UnmapViewOfFile(map->data);
+    else
+        xfree(map->data);
+#elif ARG_ENABLE_MMAP
+    if (map->mapped)
+        munmap(map->data, map->len);
+    else
+        xfree(map->data);
+#else
+    xfree(map->data);
+#endif
+
+    map->data = NULL;
+    map->len = 0;
+    map->mapped = 0;
+}
+
+void arg_scanner_init(arg_scanner_t* s, char* buf, size_t len, int comments) {
+    s->p = buf;
+    s->end = buf + len;
+    s->line = 1;
+    s->newline = 1;
+    s->comments = comments;
+    s->pending = 0;
+    s->eol = 1;
+    s->quoted = 0;
+}
+
+#define ARG_ISBLANK(c) ((c) == ' ' || (c) == '\t' || (c) == '\r' || (c) == '\f' || (c) == '\v')
+
+int arg_scan_word(arg_scanner_t* s, char** word) {
+    char* r = s->p;
+    char* w;
+    char* end = s->end;
+    int quote = 0;
+    int plain = 0;
+
+    s->line += s->pending;
+    s->newline = s->eol;
+    s->pending = 0;
+    s->eol = 0;
+
+    /* skip white space, comments and line continuations up to the next word */
+    for (;;) {
+        while (r < end && ARG_ISBLANK(*r))
+            r++;
+        if (r == end)
+            break;
+        if (*r == '\n') {
+            s->line++;
+            s->newline = 1;
+            r++;
+        } else if (*r == '\\' && r + 1 < end && r[1] == '\n') {
+            s->line++;
+            r += 2;
+        } else if (*r == '#' && s->comments) {
+            while (r < end && *r != '\n')
+                r++;
+        } else {
+            break;
+        }
+    }
+
+    if (r == end) {
+        s->p = r;
+        return 0;
+    }
+
+    /* copy the word onto itself, dropping quotes and escapes */
+    *word = w = r;
+    while (r < end) {
+        char c = *r;
+        if (quote == '\'') {
+            if (c == '\'')
+                quote = 0;
+            else {
+                if (c == '\n')
+                    s->pending++;
+                *w++ = c;
+            }
+            r++;
+        } else if (quote == '"') {
+            if (c == '"') {
+                quote = 0;
+                r++;
+            } else if (c == '\\' && r + 1 < end && (r[1] == '"' || r[1] == '\\' || r[1] == '\n')) {
+                if (r[1] == '\n')
+                    s->pending++;
+                else
+                    *w++ = r[1];
+                r += 2;
+            } else {
+                if (c == '\n')
+                    s->pending++;
+                *w++ = c;
+                r++;
+            }
+        } else if (c == '\'' || c == '"') {
+            quote = c;
+            r++;
+        } else if (c == '\\' && r + 1 < end) {
+            if (r[1] == '\n')
+                s->pending++;
+            else
+                *w++ = r[1];
+            r += 2;
+        } else if (ARG_ISBLANK(c) || c == '\n') {
+            break;
+        } else {
+            if (w == *word)
+                plain = 1;
+            *w++ = c;
+            r++;
+        }
+    }
+    s->quoted = w > *word && !plain;
+
+    /* consume the delimiter, remembering a line break for the next word */
+    if (r < end) {
+        if (*r == '\n') {
+            s->pending++;
+            s->eol = 1;
+        }
+        r++;
+    }
+    s->p = r;
+    *w = '\0';
+
+    return 1;
+}
+
+double arg_clock(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart / (double)freq.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
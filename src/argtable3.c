@@ -57,7 +57,7 @@
 #include <stdlib.h>
 #include <string.h>
 
-static void arg_register_error(struct arg_end* end, void* parent, int error, const char* argval) {
+void arg_register_error(struct arg_end* end, void* parent, int error, const char* argval) {
     /* printf("arg_register_error(%p,%p,%d,%s)\n",end,parent,error,argval); */
     if (end->count < end->hdr.maxcount) {
         end->error[end->count] = error;
@@ -224,6 +224,52 @@ static char* alloc_shortoptions(struct arg_hdr** table) {
     return result;
 }
 
+#if ARG_REPLACE_GETOPT == 0
+/*
+ * The getopt of the C library keeps its state in the getopt(3) external
+ * variables, so this shim copies them to and from a struct arg_getopt around
+ * each call, and arg_parse() holds the global lock while it scans.
+ */
+struct arg_getopt {
+    int ind;
+    int err;
+    int opt;
+    char* arg;
+};
+
+static void arg_getopt_init(struct arg_getopt* st) {
+    st->ind = 0;
+    st->err = 1;
+    st->opt = '?';
+    st->arg = NULL;
+}
+#endif
+
+/* fetch the next option with getopt_long, or getopt_long_only for ARG_LONG_ONLY */
+static int arg_getopt_next(struct arg_getopt* st, int argc, char** argv, const char* shortoptions, const struct option* longoptions) {
+#if ARG_REPLACE_GETOPT == 1
+#ifdef ARG_LONG_ONLY
+    return arg_getopt_long_only(st, argc, argv, shortoptions, longoptions, NULL);
+#else
+    return arg_getopt_long(st, argc, argv, shortoptions, longoptions, NULL);
+#endif
+#else
+    int copt;
+
+    optind = st->ind;
+    opterr = st->err;
+#ifdef ARG_LONG_ONLY
+    copt = getopt_long_only(argc, argv, shortoptions, longoptions, NULL);
+#else
+    copt = getopt_long(argc, argv, shortoptions, longoptions, NULL);
+#endif
+    st->ind = optind;
+    st->opt = optopt;
+    st->arg = optarg;
+    return copt;
+#endif
+}
+
 /* return index of the table terminator entry */
 static int arg_endindex(struct arg_hdr** table) {
     int tabindex = 0;
@@ -232,9 +278,38 @@ static int arg_endindex(struct arg_hdr** table) {
     return tabindex;
 }
 
-static void arg_parse_tagged(int argc, char** argv, struct arg_hdr** table, struct arg_end* endtable) {
+/*
+ * Options found by the tagged pass of an incremental parse, in command line
+ * order, which are recorded instead of scanned
+ */
+struct arg_events {
+    int* tabindex; /* entry of each option, or -1 for the next error registered in the end table */
+    const char** optarg;
+    int count;
+    int maxcount;
+};
+
+static void arg_event(struct arg_events* events, int tabindex, const char* optarg) {
+    if (!events)
+        return;
+    if (events->count == events->maxcount) {
+        events->maxcount = events->maxcount ? events->maxcount * 2 : 16;
+        events->tabindex = (int*)xrealloc(events->tabindex, sizeof(int) * (size_t)events->maxcount);
+        events->optarg = (const char**)xrealloc((void*)events->optarg, sizeof(char*) * (size_t)events->maxcount);
+    }
+    events->tabindex[events->count] = tabindex;
+    events->optarg[events->count] = optarg;
+    events->count++;
+}
+
+/*
+ * Parses the tagged options, and returns the index in argv[] of the first untagged argument.
+ * If events is not NULL, the options are recorded there rather than scanned.
+ */
+static int arg_parse_tagged(int argc, char** argv, struct arg_hdr** table, struct arg_end* endtable, arg_bits_t* given, struct arg_events* events) {
     struct longoptions* longoptions;
     char* shortoptions;
+    struct arg_getopt st;
     int copt;
 
     /*printf("arg_parse_tagged(%d,%p,%p,%p)\n",argc,argv,table,endtable);*/
@@ -246,53 +321,56 @@ static void arg_parse_tagged(int argc, char** argv, struct arg_hdr** table, stru
 
     /*dump_longoptions(longoptions);*/
 
-    /* reset getopts internal option-index to zero, and disable error reporting */
-    optind = 0;
-    opterr = 0;
+    /* start getopt at the beginning of argv[], and disable error reporting */
+    arg_getopt_init(&st);
+    st.err = 0;
 
     /* fetch and process args using getopt_long */
-#ifdef ARG_LONG_ONLY
-    while ((copt = getopt_long_only(argc, argv, shortoptions, longoptions->options, NULL)) != -1) {
-#else
-    while ((copt = getopt_long(argc, argv, shortoptions, longoptions->options, NULL)) != -1) {
-#endif
+    while ((copt = arg_getopt_next(&st, argc, argv, shortoptions, longoptions->options)) != -1) {
         /*
-           printf("optarg='%s'\n",optarg);
-           printf("optind=%d\n",optind);
+           printf("optarg='%s'\n",st.arg);
+           printf("optind=%d\n",st.ind);
            printf("copt=%c\n",(char)copt);
-           printf("optopt=%c (%d)\n",optopt, (int)(optopt));
+           printf("optopt=%c (%d)\n",st.opt, (int)(st.opt));
          */
         switch (copt) {
             case 0: {
                 int tabindex = longoptions->getoptval;
                 void* parent = table[tabindex]->parent;
                 /*printf("long option detected from argtable[%d]\n", tabindex);*/
-                if (optarg && optarg[0] == 0 && (table[tabindex]->flag & ARG_HASVALUE)) {
-                    /* printf(": long option %s requires an argument\n",argv[optind-1]); */
-                    arg_register_error(endtable, endtable, ARG_EMISSARG, argv[optind - 1]);
+                if (st.arg && st.arg[0] == 0 && (table[tabindex]->flag & ARG_HASVALUE)) {
+                    /* printf(": long option %s requires an argument\n",argv[st.ind-1]); */
+                    arg_register_error(endtable, endtable, ARG_EMISSARG, argv[st.ind - 1]);
+                    arg_event(events, -1, NULL);
                     /* continue to scan the (empty) argument value to enforce argument count checking */
                 }
-                if (table[tabindex]->scanfn) {
-                    int errorcode = table[tabindex]->scanfn(parent, optarg);
+                if (events) {
+                    arg_event(events, tabindex, st.arg);
+                } else if (table[tabindex]->scanfn) {
+                    int errorcode = table[tabindex]->scanfn(parent, st.arg);
                     if (errorcode != 0)
-                        arg_register_error(endtable, parent, errorcode, optarg);
+                        arg_register_error(endtable, parent, errorcode, st.arg);
                 }
+                if (given)
+                    ARG_BITS_SET(given, tabindex);
             } break;
 
             case '?':
                 /*
                  * getopt_long() found an unrecognised short option.
-                 * if it was a short option its value is in optopt
-                 * if it was a long option then optopt=0
+                 * if it was a short option its value is in st.opt
+                 * if it was a long option then st.opt=0
                  */
-                switch (optopt) {
+                switch (st.opt) {
                     case 0:
-                        /*printf("?0 unrecognised long option %s\n",argv[optind-1]);*/
-                        arg_register_error(endtable, endtable, ARG_ELONGOPT, argv[optind - 1]);
+                        /*printf("?0 unrecognised long option %s\n",argv[st.ind-1]);*/
+                        arg_register_error(endtable, endtable, ARG_ELONGOPT, argv[st.ind - 1]);
+                        arg_event(events, -1, NULL);
                         break;
                     default:
-                        /*printf("?* unrecognised short option '%c'\n",optopt);*/
-                        arg_register_error(endtable, endtable, optopt, NULL);
+                        /*printf("?* unrecognised short option '%c'\n",st.opt);*/
+                        arg_register_error(endtable, endtable, st.opt, NULL);
+                        arg_event(events, -1, NULL);
                         break;
                 }
                 break;
@@ -301,8 +379,9 @@ static void arg_parse_tagged(int argc, char** argv, struct arg_hdr** table, stru
                 /*
                  * getopt_long() found an option with its argument missing.
                  */
-                /*printf(": option %s requires an argument\n",argv[optind-1]); */
-                arg_register_error(endtable, endtable, ARG_EMISSARG, argv[optind - 1]);
+                /*printf(": option %s requires an argument\n",argv[st.ind-1]); */
+                arg_register_error(endtable, endtable, ARG_EMISSARG, argv[st.ind - 1]);
+                arg_event(events, -1, NULL);
                 break;
 
             default: {
@@ -313,13 +392,18 @@ static void arg_parse_tagged(int argc, char** argv, struct arg_hdr** table, stru
                     /* should never get here - but handle it just in case */
                     /*printf("unrecognised short option %d\n",copt);*/
                     arg_register_error(endtable, endtable, copt, NULL);
+                    arg_event(events, -1, NULL);
+                } else if (events) {
+                    arg_event(events, tabindex, st.arg);
                 } else {
                     if (table[tabindex]->scanfn) {
                         void* parent = table[tabindex]->parent;
-                        int errorcode = table[tabindex]->scanfn(parent, optarg);
+                        int errorcode = table[tabindex]->scanfn(parent, st.arg);
                         if (errorcode != 0)
-                            arg_register_error(endtable, parent, errorcode, optarg);
+                            arg_register_error(endtable, parent, errorcode, st.arg);
                     }
+                    if (given)
+                        ARG_BITS_SET(given, tabindex);
                 }
                 break;
             }
@@ -328,9 +412,11 @@ static void arg_parse_tagged(int argc, char** argv, struct arg_hdr** table, stru
 
     xfree(shortoptions);
     xfree(longoptions);
+    return st.ind;
 }
 
-static void arg_parse_untagged(int argc, char** argv, struct arg_hdr** table, struct arg_end* endtable) {
+/* Parses the untagged arguments, from argv[argi] on, marking the entries that take one in given if it is not NULL */
+static void arg_parse_untagged(int argc, char** argv, int argi, struct arg_hdr** table, struct arg_end* endtable, arg_bits_t* given) {
     int tabindex = 0;
     int errorlast = 0;
     const char* optarglast = NULL;
@@ -341,8 +427,8 @@ static void arg_parse_untagged(int argc, char** argv, struct arg_hdr** table, st
         void* parent;
         int errorcode;
 
-        /* if we have exhausted our argv[optind] entries then we have finished */
-        if (optind >= argc) {
+        /* if we have exhausted our argv[argi] entries then we have finished */
+        if (argi >= argc) {
             /*printf("arg_parse_untagged(): argv[] exhausted\n");*/
             return;
         }
@@ -361,26 +447,28 @@ static void arg_parse_untagged(int argc, char** argv, struct arg_hdr** table, st
             continue;
         }
 
-        /* attempt to scan the current argv[optind] with the current     */
+        /* attempt to scan the current argv[argi] with the current     */
         /* table[tabindex] entry. If it succeeds then keep it, otherwise */
         /* try again with the next table[] entry.                        */
         parent = table[tabindex]->parent;
-        errorcode = table[tabindex]->scanfn(parent, argv[optind]);
+        errorcode = table[tabindex]->scanfn(parent, argv[argi]);
         if (errorcode == 0) {
-            /* success, move onto next argv[optind] but stay with same table[tabindex] */
+            /* success, move onto next argv[argi] but stay with same table[tabindex] */
             /*printf("arg_parse_untagged(): argtable[%d] successfully matched\n",tabindex);*/
-            optind++;
+            argi++;
+            if (given)
+                ARG_BITS_SET(given, tabindex);
 
             /* clear the last tentative error */
             errorlast = 0;
         } else {
-            /* failure, try same argv[optind] with next table[tabindex] entry */
+            /* failure, try same argv[argi] with next table[tabindex] entry */
             /*printf("arg_parse_untagged(): argtable[%d] failed match\n",tabindex);*/
             tabindex++;
 
             /* remember this as a tentative error we may wish to reinstate later */
             errorlast = errorcode;
-            optarglast = argv[optind];
+            optarglast = argv[argi];
             parentlast = parent;
         }
     }
@@ -388,30 +476,50 @@ static void arg_parse_untagged(int argc, char** argv, struct arg_hdr** table, st
     /* if a tenative error still remains at this point then register it as a proper error */
     if (errorlast) {
         arg_register_error(endtable, parentlast, errorlast, optarglast);
-        optind++;
+        argi++;
     }
 
     /* only get here when not all argv[] entries were consumed */
     /* register an error for each unused argv[] entry */
-    while (optind < argc) {
-        /*printf("arg_parse_untagged(): argv[%d]=\"%s\" not consumed\n",optind,argv[optind]);*/
-        arg_register_error(endtable, endtable, ARG_ENOMATCH, argv[optind++]);
+    while (argi < argc) {
+        /*printf("arg_parse_untagged(): argv[%d]=\"%s\" not consumed\n",argi,argv[argi]);*/
+        arg_register_error(endtable, endtable, ARG_ENOMATCH, argv[argi++]);
     }
 
     return;
 }
 
-static void arg_parse_check(struct arg_hdr** table, struct arg_end* endtable) {
+/* the arg_end of the table whose post-parse checks are running on this thread, for arg_check_error() */
+static ARG_TLS struct arg_end* s_check_endtable = NULL;
+
+void arg_check_error(void* parent, int error, const char* argval) {
+    if (s_check_endtable)
+        arg_register_error(s_check_endtable, parent, error, argval);
+}
+
+static void arg_check_entry(struct arg_hdr* hdr, struct arg_end* endtable) {
+    void* parent = hdr->parent;
+    int errorcode;
+
+    s_check_endtable = endtable;
+    errorcode = hdr->checkfn(parent);
+    if (errorcode != 0)
+        arg_register_error(endtable, parent, errorcode, NULL);
+    s_check_endtable = NULL;
+}
+
+static void arg_parse_check(struct arg_hdr** table, struct arg_end* endtable, const arg_bits_t* given) {
     int tabindex = 0;
     /* printf("arg_parse_check()\n"); */
+
     do {
-        if (table[tabindex]->checkfn) {
-            void* parent = table[tabindex]->parent;
-            int errorcode = table[tabindex]->checkfn(parent);
-            if (errorcode != 0)
-                arg_register_error(endtable, parent, errorcode, NULL);
-        }
+        if (table[tabindex]->checkfn)
+            arg_check_entry(table[tabindex], endtable);
     } while (!(table[tabindex++]->flag & ARG_TERMINATOR));
+
+    /* then the constraints between entries, against the set of entries given */
+    if (given && arg_end_hasconstraints(endtable))
+        arg_end_checkconstraints(endtable, table, given);
 }
 
 static void arg_reset(void** argtable) {
@@ -424,11 +532,13 @@ static void arg_reset(void** argtable) {
     } while (!(table[tabindex++]->flag & ARG_TERMINATOR));
 }
 
-int arg_parse(int argc, char** argv, void** argtable) {
+static int arg_parse_impl(int argc, char** argv, void** argtable) {
     struct arg_hdr** table = (struct arg_hdr**)argtable;
     struct arg_end* endtable;
     int endindex;
     char** argvcopy = NULL;
+    arg_bits_t* given = NULL;
+    int argi;
     int i;
 
     /*printf("arg_parse(%d,%p,%p)\n",argc,argv,argtable);*/
@@ -440,12 +550,26 @@ int arg_parse(int argc, char** argv, void** argtable) {
     endindex = arg_endindex(table);
     endtable = (struct arg_end*)table[endindex];
 
+    /* replace @file arguments with the contents of the response files, if enabled */
+    argc = arg_end_expand(endtable, argc, argv, &argv);
+
+    /*
+     * remember which options the command line gives, if the environment or
+     * configuration files can give them too, or constraints depend on them
+     */
+    if (arg_end_haslayers(endtable) || arg_end_hasconstraints(endtable))
+        given = (arg_bits_t*)xcalloc(ARG_BITS_LEN(endindex + 1), sizeof(arg_bits_t));
+
     /* Special case of argc==0.  This can occur on Texas Instruments DSP. */
     /* Failure to trap this case results in an unwanted NULL result from  */
     /* the malloc for argvcopy (next code block).                         */
     if (argc == 0) {
+        if (given && arg_end_haslayers(endtable))
+            arg_end_scanlayers(endtable, table, given);
+
         /* We must still perform post-parse checks despite the absence of command line arguments */
-        arg_parse_check(table, endtable);
+        arg_parse_check(table, endtable, given);
+        xfree(given);
 
         /* Now we are finished */
         return endtable->count;
@@ -464,14 +588,19 @@ int arg_parse(int argc, char** argv, void** argtable) {
     argvcopy[argc] = NULL;
 
     /* parse the command line (local copy) for tagged options */
-    arg_parse_tagged(argc, argvcopy, table, endtable);
+    argi = arg_parse_tagged(argc, argvcopy, table, endtable, given, NULL);
 
     /* parse the command line (local copy) for untagged options */
-    arg_parse_untagged(argc, argvcopy, table, endtable);
+    arg_parse_untagged(argc, argvcopy, argi, table, endtable, given);
+
+    /* fill in the options that the command line left out from the environment, then the configuration files */
+    if (given && arg_end_haslayers(endtable))
+        arg_end_scanlayers(endtable, table, given);
 
     /* if no errors so far then perform post-parse checks otherwise dont bother */
     if (endtable->count == 0)
-        arg_parse_check(table, endtable);
+        arg_parse_check(table, endtable, given);
+    xfree(given);
 
     /* release the local copt of argv[] */
     xfree(argvcopy);
@@ -479,6 +608,591 @@ int arg_parse(int argc, char** argv, void** argtable) {
     return endtable->count;
 }
 
+int arg_parse(int argc, char** argv, void** argtable) {
+#if ARG_REPLACE_GETOPT == 1
+    return arg_parse_impl(argc, argv, argtable);
+#else
+    int nerrors;
+
+    /* the getopt of the C library keeps its state in globals, so parses from different threads must take turns */
+    arg_global_lock();
+    nerrors = arg_parse_impl(argc, argv, argtable);
+    arg_global_unlock();
+
+    return nerrors;
+#endif
+}
+
+/* Copies each argument of the table into clone[], and returns non-zero if an argument cannot be copied */
+static int arg_clonetable(void** argtable, int n, void** clone) {
+    struct arg_hdr** table = (struct arg_hdr**)argtable;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        const struct arg_hdr_ext* ext = ARG_HDR_EXT(table[i]);
+        if (!ext || !ext->clonefn)
+            return -1;
+    }
+
+    for (i = 0; i < n; i++)
+        clone[i] = ARG_HDR_EXT(table[i])->clonefn(table[i]->parent);
+
+    /* options bound to environment variables are matched by their struct */
+    for (i = 0; i < n; i++)
+        arg_end_rebind((struct arg_end*)clone[n - 1], argtable[i], clone[i]);
+    return 0;
+}
+
+struct _internal_arg_result {
+    int n;
+    void** defs; /* entries of the table the result was created from */
+    void** args; /* copy of each entry, which parses store their results in */
+};
+
+arg_result_t arg_result_create(void** argtable) {
+    arg_result_t result;
+    int n = arg_endindex((struct arg_hdr**)argtable) + 1;
+
+    result = (arg_result_t)xmalloc(sizeof(struct _internal_arg_result) + 2 * sizeof(void*) * (size_t)n);
+    result->n = n;
+    result->defs = (void**)(result + 1);
+    result->args = result->defs + n;
+    memcpy(result->defs, argtable, sizeof(void*) * (size_t)n);
+    if (arg_clonetable(argtable, n, result->args) != 0) {
+        xfree(result);
+        return NULL;
+    }
+    return result;
+}
+
+int arg_parse_result(int argc, char** argv, arg_result_t result) {
+    return arg_parse(argc, argv, result->args);
+}
+
+void* arg_result_get(arg_result_t result, const void* arg) {
+    int i;
+
+    for (i = 0; i < result->n; i++) {
+        if (result->defs[i] == arg)
+            return result->args[i];
+    }
+    return NULL;
+}
+
+arg_end_t* arg_result_end(arg_result_t result) {
+    return (arg_end_t*)result->args[result->n - 1];
+}
+
+void arg_result_destroy(arg_result_t result) {
+    if (result == NULL)
+        return;
+
+    arg_freetable(result->args, (size_t)result->n);
+    xfree(result);
+}
+
+/* The jobs of a batch and the results to collect */
+struct arg_batch {
+    int njobs;
+    const int* argcs;
+    char*** argvs;
+    const arg_column_t* columns;
+    int ncolumns;
+    int* index; /* table index of the argument of each column */
+};
+
+/* A range of jobs parsed by one worker into its own copy of the table */
+struct arg_batch_chunk {
+    const struct arg_batch* batch;
+    arg_result_t result;
+    void** table; /* the arguments the jobs are parsed into */
+    int begin;
+    int end;
+    int nfailed;
+    arg_task_t task;
+};
+
+/* Copies the count and values a job left in an argument into the column buffers */
+static void arg_batch_collect(const arg_column_t* column, void* arg, int job) {
+    int count = *(const int*)ARG_CLONE_PTR(arg, column->arg, column->count);
+    const char* src = NULL;
+    char* dest;
+    int n;
+
+    if (column->counts)
+        column->counts[job] = count;
+    if (!column->values)
+        return;
+
+    dest = (char*)column->values + (size_t)job * (size_t)column->nvalues * column->size;
+    if (column->field)
+        src = *(const char* const*)ARG_CLONE_PTR(arg, column->arg, column->field);
+    n = (src && count < column->nvalues) ? count : (src ? column->nvalues : 0);
+    if (n > 0)
+        memcpy(dest, src, (size_t)n * column->size);
+    memset(dest + (size_t)n * column->size, 0, (size_t)(column->nvalues - n) * column->size);
+}
+
+static void arg_batch_run(void* arg) {
+    struct arg_batch_chunk* chunk = (struct arg_batch_chunk*)arg;
+    const struct arg_batch* batch = chunk->batch;
+    int i, j;
+
+    for (i = chunk->begin; i < chunk->end; i++) {
+        if (arg_parse(batch->argcs[i], batch->argvs[i], chunk->table) > 0)
+            chunk->nfailed++;
+        for (j = 0; j < batch->ncolumns; j++)
+            arg_batch_collect(&batch->columns[j], chunk->table[batch->index[j]], i);
+    }
+}
+
+int arg_parse_batch(void** argtable, int njobs, const int* argcs, char*** argvs, const arg_column_t* columns, int ncolumns, int nworkers) {
+    struct arg_batch batch;
+    struct arg_batch_chunk* chunks;
+    arg_tpool_t* pool;
+    int ntable = arg_endindex((struct arg_hdr**)argtable) + 1;
+    int nchunks;
+    int nfailed = 0;
+    int i, j;
+
+    if (ncolumns < 0)
+        return -1;
+
+    /* every column must describe an entry of the table, or there is nothing to copy its results from */
+    batch.index = (int*)xmalloc(sizeof(int) * (size_t)(ncolumns > 0 ? ncolumns : 1));
+    for (j = 0; j < ncolumns; j++) {
+        for (i = 0; i < ntable && argtable[i] != columns[j].arg; i++)
+            ;
+        if (i == ntable) {
+            xfree(batch.index);
+            return -1;
+        }
+        batch.index[j] = i;
+    }
+
+    if (njobs <= 0) {
+        xfree(batch.index);
+        return 0;
+    }
+
+    batch.njobs = njobs;
+    batch.argcs = argcs;
+    batch.argvs = argvs;
+    batch.columns = columns;
+    batch.ncolumns = ncolumns;
+
+    /* the getopt of the C library cannot run on several threads at once, so its parses are not spread */
+    if (nworkers < 0)
+        nworkers = arg_thread_ncpu();
+#if ARG_REPLACE_GETOPT == 0
+    nworkers = 0;
+#endif
+    nchunks = nworkers < 1 ? 1 : (nworkers < njobs ? nworkers : njobs);
+
+    chunks = (struct arg_batch_chunk*)xcalloc((size_t)nchunks, sizeof(struct arg_batch_chunk));
+    for (i = 0; i < nchunks; i++) {
+        chunks[i].batch = &batch;
+        chunks[i].begin = i * (njobs / nchunks) + (i < njobs % nchunks ? i : njobs % nchunks);
+        chunks[i].end = chunks[i].begin + njobs / nchunks + (i < njobs % nchunks ? 1 : 0);
+        chunks[i].result = arg_result_create(argtable);
+        if (!chunks[i].result)
+            break;
+        chunks[i].table = chunks[i].result->args;
+    }
+
+    if (i < nchunks) {
+        /* an argument without a clonefn: parse every job in the caller's table, one after another */
+        while (i-- > 0)
+            arg_result_destroy(chunks[i].result);
+        chunks[0].begin = 0;
+        chunks[0].end = njobs;
+        chunks[0].table = argtable;
+        arg_batch_run(&chunks[0]);
+        nfailed = chunks[0].nfailed;
+    } else {
+        pool = arg_tpool_create(nchunks > 1 ? nchunks : 0);
+        for (i = 0; i < nchunks; i++)
+            arg_tpool_submit(pool, &chunks[i].task, arg_batch_run, &chunks[i]);
+        for (i = 0; i < nchunks; i++) {
+            arg_tpool_join(pool, &chunks[i].task);
+            nfailed += chunks[i].nfailed;
+            arg_result_destroy(chunks[i].result);
+        }
+        arg_tpool_destroy(pool);
+    }
+
+    xfree(chunks);
+    xfree(batch.index);
+    return nfailed;
+}
+
+/* An error kept by an incremental parse until the entry it belongs to is scanned or checked again */
+struct arg_session_error {
+    void* parent;
+    int error;
+    const char* argval;
+    int occurrence; /* option the error was found in, counted from 0 for each entry */
+};
+
+struct arg_session_errors {
+    struct arg_session_error* item;
+    int count;
+    int maxcount;
+};
+
+struct arg_session_values {
+    const char** item;
+    int count;
+    int maxcount;
+};
+
+/* What an incremental parse remembers of a table entry */
+struct arg_session_entry {
+    struct arg_session_values optargs; /* values the entry was last scanned with, in order */
+    struct arg_session_values next;    /* values the current command line gives it */
+    struct arg_session_errors scan;    /* errors of its last scan */
+    struct arg_session_errors check;   /* errors of its last check */
+    int checked;                       /* non-zero if check is up to date */
+};
+
+/*
+ * State of an incremental parse. Options and arguments are recognized by the
+ * address of their token, so an edit never allocates a token after freeing
+ * one: a token that is unchanged keeps its address, and a new one cannot
+ * reuse the address of a token the caches still refer to.
+ */
+struct _internal_arg_session {
+    struct arg_hdr** table;
+    int ntable;
+    char** argv; /* the command line, as copies owned by the session */
+    int argc;
+    int maxargs;
+    char** argvcopy; /* argv[] for getopt to permute */
+    struct arg_session_values positional; /* untagged arguments last scanned */
+    int valid; /* non-zero if the caches match the table */
+    struct arg_events events;
+    struct arg_end* opterrors; /* errors of the tagged pass that belong to no entry */
+    struct arg_end* poserrors; /* errors of the untagged pass */
+    struct arg_end* scratch;   /* errors of the scan or check being run */
+    arg_bits_t* present;       /* entries given by the command line, for the constraints */
+    struct arg_session_entry* entries;
+};
+
+static void arg_session_push(struct arg_session_values* values, const char* value) {
+    if (values->count == values->maxcount) {
+        values->maxcount = values->maxcount ? values->maxcount * 2 : 4;
+        values->item = (const char**)xrealloc((void*)values->item, sizeof(char*) * (size_t)values->maxcount);
+    }
+    values->item[values->count++] = value;
+}
+
+/* Moves the errors registered in a scratch arg_end to an entry's cache, tagged with the option they belong to */
+static void arg_session_keep(struct arg_session_errors* errors, struct arg_end* scratch, int occurrence) {
+    int i;
+
+    for (i = 0; i < scratch->count; i++) {
+        struct arg_session_error* e;
+
+        if (errors->count == errors->maxcount) {
+            errors->maxcount = errors->maxcount ? errors->maxcount * 2 : 4;
+            errors->item = (struct arg_session_error*)xrealloc(errors->item, sizeof(struct arg_session_error) * (size_t)errors->maxcount);
+        }
+        e = &errors->item[errors->count++];
+        e->parent = scratch->parent[i];
+        e->error = scratch->error[i];
+        e->argval = scratch->argval[i];
+        e->occurrence = occurrence;
+    }
+    scratch->count = 0;
+}
+
+/* Registers an error in the table's arg_end, moving errors about a scratch arg_end to the real one */
+static void arg_session_error(arg_session_t session, void* parent, int error, const char* argval) {
+    struct arg_end* end = (struct arg_end*)session->table[session->ntable - 1];
+
+    if (parent == session->opterrors || parent == session->poserrors || parent == session->scratch)
+        parent = end;
+    arg_register_error(end, parent, error, argval);
+}
+
+static void arg_session_scan(arg_session_t session, int tabindex) {
+    struct arg_hdr* hdr = session->table[tabindex];
+    struct arg_session_entry* entry = &session->entries[tabindex];
+    struct arg_session_values swap;
+    int i;
+
+    swap = entry->optargs;
+    entry->optargs = entry->next;
+    entry->next = swap;
+    entry->scan.count = 0;
+    entry->checked = 0;
+
+    if (hdr->resetfn)
+        hdr->resetfn(hdr->parent);
+    for (i = 0; i < entry->optargs.count; i++) {
+        int errorcode = hdr->scanfn(hdr->parent, entry->optargs.item[i]);
+        if (errorcode != 0) {
+            arg_register_error(session->scratch, hdr->parent, errorcode, entry->optargs.item[i]);
+            arg_session_keep(&entry->scan, session->scratch, i);
+        }
+    }
+}
+
+static int arg_session_update(arg_session_t session) {
+    struct arg_hdr** table = session->table;
+    struct arg_end* end = (struct arg_end*)table[session->ntable - 1];
+    int argi;
+    int changed;
+    int i, j;
+
+    session->argv[session->argc] = NULL;
+
+    /* response files and other layers change what each option depends on, so they are parsed in full */
+    if (session->argc == 0 || arg_end_hasrespfile(end) || arg_end_haslayers(end)) {
+        session->valid = 0;
+        return arg_parse(session->argc, session->argv, (void**)table);
+    }
+
+    if (!session->valid) {
+        arg_reset((void**)table);
+        for (i = 0; i < session->ntable; i++) {
+            session->entries[i].optargs.count = 0;
+            session->entries[i].scan.count = 0;
+            session->entries[i].checked = 0;
+        }
+        memset(session->present, 0, sizeof(arg_bits_t) * ARG_BITS_LEN(session->ntable));
+        session->positional.count = -1;
+        session->valid = 1;
+    }
+
+    /*
+     * Find which entry each option belongs to, without scanning any of them.
+     * This pass is not incremental: whether a token is an option, a value or
+     * an untagged argument depends on the tokens before it, and getopt
+     * permutes argv[] as it goes, so the whole line is tagged again.
+     */
+    memcpy(session->argvcopy, session->argv, sizeof(char*) * (size_t)(session->argc + 1));
+    session->events.count = 0;
+    session->opterrors->count = 0;
+#if ARG_REPLACE_GETOPT == 0
+    arg_global_lock();
+#endif
+    argi = arg_parse_tagged(session->argc, session->argvcopy, table, session->opterrors, NULL, &session->events);
+#if ARG_REPLACE_GETOPT == 0
+    arg_global_unlock();
+#endif
+
+    /* scan again only the entries whose options changed */
+    for (i = 0; i < session->ntable; i++)
+        session->entries[i].next.count = 0;
+    for (i = 0; i < session->events.count; i++) {
+        if (session->events.tabindex[i] >= 0)
+            arg_session_push(&session->entries[session->events.tabindex[i]].next, session->events.optarg[i]);
+    }
+    for (i = 0; i < session->ntable; i++) {
+        struct arg_session_entry* entry = &session->entries[i];
+
+        if (!table[i]->scanfn || (!table[i]->shortopts && !table[i]->longopts))
+            continue;
+        changed = entry->next.count != entry->optargs.count;
+        for (j = 0; !changed && j < entry->next.count; j++)
+            changed = entry->next.item[j] != entry->optargs.item[j];
+        if (changed)
+            arg_session_scan(session, i);
+        if (entry->optargs.count > 0)
+            ARG_BITS_SET(session->present, i);
+        else
+            ARG_BITS_CLEAR(session->present, i);
+    }
+
+    /* the untagged arguments are matched against the untagged entries in turn, so any change rescans them all */
+    changed = session->positional.count != session->argc - argi;
+    for (j = 0; !changed && j < session->positional.count; j++)
+        changed = session->positional.item[j] != session->argvcopy[argi + j];
+    if (changed) {
+        session->positional.count = 0;
+        for (j = argi; j < session->argc; j++)
+            arg_session_push(&session->positional, session->argvcopy[j]);
+        for (i = 0; i < session->ntable; i++) {
+            if (table[i]->shortopts || table[i]->longopts || !table[i]->scanfn)
+                continue;
+            if (table[i]->resetfn)
+                table[i]->resetfn(table[i]->parent);
+            session->entries[i].checked = 0;
+            ARG_BITS_CLEAR(session->present, i);
+        }
+        session->poserrors->count = 0;
+        arg_parse_untagged(session->argc, session->argvcopy, argi, table, session->poserrors, session->present);
+    }
+
+    /* collect the errors in the order a full parse finds them */
+    end->count = 0;
+    for (i = 0; i < session->ntable; i++)
+        session->entries[i].next.count = 0; /* counts the options of each entry seen so far */
+    for (i = 0, j = 0; i < session->events.count; i++) {
+        int tabindex = session->events.tabindex[i];
+        struct arg_session_entry* entry;
+        int k;
+
+        if (tabindex < 0) {
+            arg_session_error(session, session->opterrors->parent[j], session->opterrors->error[j], session->opterrors->argval[j]);
+            j++;
+            continue;
+        }
+        entry = &session->entries[tabindex];
+        for (k = 0; k < entry->scan.count; k++) {
+            if (entry->scan.item[k].occurrence == entry->next.count)
+                arg_session_error(session, entry->scan.item[k].parent, entry->scan.item[k].error, entry->scan.item[k].argval);
+        }
+        entry->next.count++;
+    }
+    for (i = 0; i < session->poserrors->count; i++)
+        arg_session_error(session, session->poserrors->parent[i], session->poserrors->error[i], session->poserrors->argval[i]);
+
+    /* run the checks of the entries that changed, unless there are errors already */
+    if (end->count == 0) {
+        for (i = 0; i < session->ntable; i++) {
+            struct arg_session_entry* entry = &session->entries[i];
+
+            if (!table[i]->checkfn)
+                continue;
+            if (!entry->checked) {
+                entry->check.count = 0;
+                arg_check_entry(table[i], session->scratch);
+                arg_session_keep(&entry->check, session->scratch, 0);
+                entry->checked = 1;
+            }
+            for (j = 0; j < entry->check.count; j++)
+                arg_session_error(session, entry->check.item[j].parent, entry->check.item[j].error, entry->check.item[j].argval);
+        }
+
+        /* the constraints depend on several entries, but only on their bits, so they are always evaluated */
+        if (arg_end_hasconstraints(end))
+            arg_end_checkconstraints(end, table, session->present);
+    }
+
+    return end->count;
+}
+
+arg_session_t arg_session_create(void** argtable) {
+    arg_session_t session;
+    int maxcount;
+
+    session = (arg_session_t)xcalloc(1, sizeof(struct _internal_arg_session));
+    session->table = (struct arg_hdr**)argtable;
+    session->ntable = arg_endindex(session->table) + 1;
+    maxcount = session->table[session->ntable - 1]->maxcount;
+    session->maxargs = 8;
+    session->argv = (char**)xmalloc(sizeof(char*) * (size_t)session->maxargs);
+    session->argvcopy = (char**)xmalloc(sizeof(char*) * (size_t)session->maxargs);
+    session->opterrors = arg_end(maxcount);
+    session->poserrors = arg_end(maxcount);
+    session->scratch = arg_end(maxcount);
+    session->opterrors->count = 0;
+    session->poserrors->count = 0;
+    session->scratch->count = 0;
+    session->present = (arg_bits_t*)xcalloc(ARG_BITS_LEN(session->ntable), sizeof(arg_bits_t));
+    session->entries = (struct arg_session_entry*)xcalloc((size_t)session->ntable, sizeof(struct arg_session_entry));
+    return session;
+}
+
+/* Makes room for one more argument */
+static void arg_session_grow(arg_session_t session) {
+    /* keep room for the NULL that terminates argv[] */
+    if (session->argc + 2 > session->maxargs) {
+        session->maxargs *= 2;
+        session->argv = (char**)xrealloc(session->argv, sizeof(char*) * (size_t)session->maxargs);
+        session->argvcopy = (char**)xrealloc(session->argvcopy, sizeof(char*) * (size_t)session->maxargs);
+    }
+}
+
+static char* arg_session_strdup(const char* token) {
+    size_t len = strlen(token) + 1;
+    return (char*)memcpy(xmalloc(len), token, len);
+}
+
+int arg_session_parse(arg_session_t session, int argc, char** argv) {
+    int i;
+
+    for (i = 0; i < session->argc; i++)
+        xfree(session->argv[i]);
+    session->argc = 0;
+    for (i = 0; i < argc; i++) {
+        arg_session_grow(session);
+        session->argv[session->argc++] = arg_session_strdup(argv[i]);
+    }
+    session->valid = 0;
+    return arg_session_update(session);
+}
+
+int arg_session_edit(arg_session_t session, int edit, int index, const char* token) {
+    /* a token can be inserted after the last one, but only existing ones removed or replaced */
+    if (edit != ARG_EDIT_INSERT && edit != ARG_EDIT_REMOVE && edit != ARG_EDIT_REPLACE)
+        return -1;
+    if (index < 0 || index > (edit == ARG_EDIT_INSERT ? session->argc : session->argc - 1))
+        return -1;
+    if (edit != ARG_EDIT_REMOVE && token == NULL)
+        return -1;
+
+    switch (edit) {
+        case ARG_EDIT_INSERT:
+            arg_session_grow(session);
+            memmove(&session->argv[index + 1], &session->argv[index], sizeof(char*) * (size_t)(session->argc - index));
+            session->argv[index] = arg_session_strdup(token);
+            session->argc++;
+            break;
+
+        case ARG_EDIT_REMOVE:
+            xfree(session->argv[index]);
+            memmove(&session->argv[index], &session->argv[index + 1], sizeof(char*) * (size_t)(session->argc - index - 1));
+            session->argc--;
+            break;
+
+        case ARG_EDIT_REPLACE: {
+            /* copy before freeing, so the new token cannot take the address the caches know the old one by */
+            char* copy = arg_session_strdup(token);
+            xfree(session->argv[index]);
+            session->argv[index] = copy;
+        } break;
+    }
+    return arg_session_update(session);
+}
+
+int arg_session_argc(arg_session_t session) {
+    return session->argc;
+}
+
+char** arg_session_argv(arg_session_t session) {
+    return session->argv;
+}
+
+void arg_session_destroy(arg_session_t session) {
+    int i;
+
+    if (session == NULL)
+        return;
+
+    for (i = 0; i < session->argc; i++)
+        xfree(session->argv[i]);
+    for (i = 0; i < session->ntable; i++) {
+        xfree((void*)session->entries[i].optargs.item);
+        xfree((void*)session->entries[i].next.item);
+        xfree(session->entries[i].scan.item);
+        xfree(session->entries[i].check.item);
+    }
+    xfree(session->entries);
+    xfree((void*)session->positional.item);
+    xfree(session->events.tabindex);
+    xfree((void*)session->events.optarg);
+    xfree(session->opterrors);
+    xfree(session->poserrors);
+    xfree(session->scratch);
+    xfree(session->present);
+    xfree(session->argvcopy);
+    xfree(session->argv);
+    xfree(session);
+}
+
 /*
  * Concatenate contents of src[] string onto *pdest[] string.
  * The *pdest pointer is altered to point to the end of the
@@ -1062,6 +1776,7 @@ int arg_nullcheck(void** argtable) {
  */
 void arg_free(void** argtable) {
     struct arg_hdr** table = (struct arg_hdr**)argtable;
+    const struct arg_hdr_ext* ext;
     int tabindex = 0;
     int flag;
     /*printf("arg_free(%p)\n",argtable);*/
@@ -1076,6 +1791,9 @@ void arg_free(void** argtable) {
             break;
 
         flag = table[tabindex]->flag;
+        ext = ARG_HDR_EXT(table[tabindex]);
+        if (ext && ext->freefn)
+            ext->freefn(table[tabindex]->parent);
         xfree(table[tabindex]);
         table[tabindex++] = NULL;
 
@@ -1085,12 +1803,16 @@ void arg_free(void** argtable) {
 /* frees each non-NULL element of argtable[], where n is the size of the number of entries in the array */
 void arg_freetable(void** argtable, size_t n) {
     struct arg_hdr** table = (struct arg_hdr**)argtable;
+    const struct arg_hdr_ext* ext;
     size_t tabindex = 0;
     /*printf("arg_freetable(%p)\n",argtable);*/
     for (tabindex = 0; tabindex < n; tabindex++) {
         if (table[tabindex] == NULL)
             continue;
 
+        ext = ARG_HDR_EXT(table[tabindex]);
+        if (ext && ext->freefn)
+            ext->freefn(table[tabindex]->parent);
         xfree(table[tabindex]);
         table[tabindex] = NULL;
     };
@@ -33,6 +33,8 @@
 #ifndef ARG_UTILS_H
 #define ARG_UTILS_H
 
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 
 #ifndef ARG_ENABLE_TRACE
@@ -55,11 +57,53 @@
 #define ARG_DSTR_SIZE 200
 #endif /* ARG_DSTR_SIZE */
 
+/* Run worker pool tasks on background threads.
+ * If disabled, tasks are executed on the thread that waits for them.
+ */
+#ifndef ARG_ENABLE_THREADS
+#define ARG_ENABLE_THREADS 0
+#endif /* ARG_ENABLE_THREADS */
+
+/* storage class of state that each thread keeps its own copy of */
+#if !ARG_ENABLE_THREADS
+#define ARG_TLS
+#elif defined(_MSC_VER)
+#define ARG_TLS __declspec(thread)
+#else
+#define ARG_TLS __thread
+#endif
+
+/* Use memory-mapped I/O to read script, response and configuration files,
+ * and the contents of file arguments.
+ * If disabled, or if a file cannot be mapped, the file is read into the heap.
+ */
+#ifndef ARG_ENABLE_MMAP
+#if defined(_WIN32) || defined(__unix__) || defined(__APPLE__)
+#define ARG_ENABLE_MMAP 1
+#else
+#define ARG_ENABLE_MMAP 0
+#endif
+#endif /* ARG_ENABLE_MMAP */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-enum { ARG_ERR_MINCOUNT = 1, ARG_ERR_MAXCOUNT, ARG_ERR_BADINT, ARG_ERR_OVERFLOW, ARG_ERR_BADDOUBLE, ARG_ERR_BADDATE, ARG_ERR_REGNOMATCH };
+enum {
+    ARG_ERR_MINCOUNT = 1,
+    ARG_ERR_MAXCOUNT,
+    ARG_ERR_BADINT,
+    ARG_ERR_OVERFLOW,
+    ARG_ERR_BADDOUBLE,
+    ARG_ERR_BADDATE,
+    ARG_ERR_REGNOMATCH,
+    ARG_ERR_BADENUM,
+    ARG_ERR_FILESTAT,
+    ARG_ERR_FILETYPE,
+    ARG_ERR_FILEACCESS,
+    ARG_ERR_GLOBNOMATCH,
+    ARG_ERR_GLOBLIMIT
+};
 
 typedef void(arg_panicfn)(const char* fmt, ...);
 
@@ -110,6 +154,110 @@ extern void* xcalloc(size_t count, size_t size);
 extern void* xrealloc(void* ptr, size_t size);
 extern void xfree(void* ptr);
 
+/*
+ * A private, writable view of a file's contents. The byte at data[len] is
+ * always a writable '\0', so the contents can be tokenized in place.
+ */
+typedef struct arg_mmap {
+    char* data;
+    size_t len;
+    int mapped; /* non-zero if data is a memory mapping rather than a heap buffer */
+} arg_mmap_t;
+
+/**
+ * @brief Map a file into memory, falling back to reading it into the heap.
+ *
+ * @param   map   the view to initialize
+ * @param   path  the file to map
+ * @return        zero on success, non-zero if the file could not be read
+ */
+int arg_mmap_open(arg_mmap_t* map, const char* path);
+
+/**
+ * @brief Read a stream, such as stdin, to its end into a heap buffer.
+ *
+ * @param   map   the view to initialize
+ * @param   fp    the stream to read
+ * @return        zero on success, non-zero on a read error
+ */
+int arg_mmap_read(arg_mmap_t* map, FILE* fp);
+
+/**
+ * @brief Initialize a view with a heap copy of the given buffer.
+ */
+void arg_mmap_copy(arg_mmap_t* map, const char* buf, size_t len);
+
+/**
+ * @brief Release the memory behind a view. Safe to call on a zeroed view.
+ */
+void arg_mmap_close(arg_mmap_t* map);
+
+/*
+ * In-place scanner for shell-like words. Words are separated by unquoted
+ * white space; single quotes preserve everything literally, double quotes
+ * honour backslash escapes for '"', '\\' and newlines, and an unquoted
+ * backslash escapes any character (a backslash-newline joins two lines).
+ * Unquoted text is compacted over the quote and escape characters and each
+ * word is null-terminated inside the buffer, so no memory is allocated.
+ * An unterminated quote extends to the end of the input.
+ */
+typedef struct arg_scanner {
+    char* p;      /* current read position */
+    char* end;    /* end of the buffer, *end must be writable */
+    int line;     /* line on which the last word started, 1-based */
+    int newline;  /* non-zero if an unescaped line break precedes the last word */
+    int comments; /* if non-zero, '#' at the start of a word comments out the rest of the line */
+    int pending;  /* line breaks inside or right after the last word, not yet counted */
+    int eol;      /* non-zero if the last word was delimited by a line break */
+    int quoted;   /* non-zero if the first character of the last word was quoted or escaped */
+} arg_scanner_t;
+
+void arg_scanner_init(arg_scanner_t* s, char* buf, size_t len, int comments);
+
+/**
+ * @brief Scan the next word.
+ *
+ * @param   s     the scanner
+ * @param   word  receives the null-terminated word
+ * @return        non-zero if a word was found, zero at the end of the input
+ */
+int arg_scan_word(arg_scanner_t* s, char** word);
+
+/**
+ * @brief Return a monotonic timestamp in seconds, for measuring intervals.
+ */
+double arg_clock(void);
+
+/**
+ * @brief Scan the magnitude and sign of an integer argument value.
+ *
+ * Accepts the `arg_int` grammar: an optional sign, an optional `0x`, `0o` or
+ * `0b` radix prefix, the digits and an optional `KB`, `MB` or `GB` suffix
+ * (also `TB` if `tb` is non-zero), surrounded by optional white space.
+ *
+ * @param   str   the null-terminated value to scan
+ * @param   tb    non-zero to accept the `TB` suffix
+ * @param   mag   receives the magnitude, including the suffix multiplier
+ * @param   neg   receives non-zero if the value is negative
+ * @return        0 on success, ARG_ERR_BADINT if `str` is malformed, or
+ *                ARG_ERR_OVERFLOW if the magnitude does not fit in 64 bits
+ */
+int arg_int_scanmag(const char* str, int tb, uint64_t* mag, int* neg);
+
+/**
+ * @brief Convert decimal text to the nearest double, ignoring the locale.
+ *
+ * Accepts the same text as strtod(), but always uses '.' as the decimal
+ * point. Decimal input is converted without calling the C library in all
+ * but rare cases.
+ *
+ * @param   str     the null-terminated text to convert
+ * @param   endptr  if not NULL, receives a pointer past the converted text,
+ *                  or `str` if no conversion could be performed
+ * @return          the converted value
+ */
+double arg_strtod(const char* str, char** endptr);
+
 struct arg_hashtable_entry {
     void *k, *v;
     unsigned int h;
@@ -124,6 +272,7 @@ typedef struct arg_hashtable {
     unsigned int primeindex;
     unsigned int (*hashfn)(const void* k);
     int (*eqfn)(const void* k1, const void* k2);
+    int freekeys; /* keys are freed with their entries (default) */
 } arg_hashtable_t;
 
 /**
@@ -250,6 +399,208 @@ int arg_hashtable_itr_search(arg_hashtable_itr_t* itr, arg_hashtable_t* h, void*
 #define ARG_DEFINE_HASHTABLE_ITERATOR_SEARCH(fnname, keytype) \
     int fnname(arg_hashtable_itr_t* i, arg_hashtable_t* h, keytype* k) { return (arg_hashtable_iterator_search(i, h, k)); }
 
+typedef void(arg_taskfn)(void* arg);
+
+enum { ARG_TASK_QUEUED = 1, ARG_TASK_RUNNING, ARG_TASK_DONE };
+
+/*
+ * A unit of work for the worker pool. The storage is owned by the caller and
+ * must stay valid until arg_tpool_join() returns for the task.
+ */
+typedef struct arg_task {
+    arg_taskfn* fn;
+    void* arg;
+    int state;
+    struct arg_task* next;
+} arg_task_t;
+
+typedef struct arg_tpool arg_tpool_t;
+
+/**
+ * @brief Create a worker pool.
+ *
+ * @param   nthreads  number of worker threads, 0 runs every task on the
+ *                    thread that joins it
+ * @return            newly created worker pool
+ */
+arg_tpool_t* arg_tpool_create(int nthreads);
+
+/**
+ * @brief Run any tasks still queued, stop the workers and free the pool.
+ */
+void arg_tpool_destroy(arg_tpool_t* pool);
+
+/**
+ * @brief Return the number of worker threads actually running in the pool.
+ */
+int arg_tpool_size(arg_tpool_t* pool);
+
+/**
+ * @brief Queue a task for execution.
+ *
+ * @param   pool  the worker pool
+ * @param   task  caller-owned task storage
+ * @param   fn    function to run
+ * @param   arg   argument passed to fn
+ */
+void arg_tpool_submit(arg_tpool_t* pool, arg_task_t* task, arg_taskfn* fn, void* arg);
+
+/**
+ * @brief Return non-zero if the task has finished.
+ */
+int arg_tpool_done(arg_tpool_t* pool, arg_task_t* task);
+
+/**
+ * @brief Wait until the task has finished.
+ *
+ * A task that has not been picked up by a worker yet is removed from the
+ * queue and executed on the calling thread.
+ */
+void arg_tpool_join(arg_tpool_t* pool, arg_task_t* task);
+
+/**
+ * @brief Return the number of online processors, or 1 if unknown.
+ */
+int arg_thread_ncpu(void);
+
+/**
+ * @brief Expand a glob pattern into the paths that match it.
+ *
+ * Supports '*', '?' and bracket expressions within a path component, and
+ * "**" as a whole component for any number of directories. Hidden entries
+ * only match a component that starts with a '.'. Directories of one level of
+ * the walk are read in parallel on a worker pool.
+ *
+ * @param   pattern   the pattern to expand
+ * @param   limit     the largest number of matches accepted
+ * @param   nworkers  worker threads, negative for one per processor
+ * @param   paths     receives the matches in strcmp() order, as one block
+ *                    to be released with xfree()
+ * @return            the number of matches, 0 if nothing matches, or -1 if
+ *                    there are more than limit matches, or more than limit
+ *                    paths at any level of the walk
+ */
+int arg_glob(const char* pattern, int limit, int nworkers, char*** paths);
+
+struct arg_end;
+struct arg_hdr;
+
+/**
+ * @brief Record an error in the arg_end of a table.
+ *
+ * If the arg_end is full, its last error is replaced by ARG_ELIMIT.
+ */
+void arg_register_error(struct arg_end* end, void* parent, int error, const char* argval);
+
+/**
+ * @brief Expand the response files of a command line, if the table allows it.
+ *
+ * Each argument after argv[0] of the form "@path" is replaced by the words
+ * of the file, tokenized in place in its mapping. Files that cannot be read
+ * or that refer to themselves are reported as errors in end.
+ *
+ * @param   end       the arg_end of the table
+ * @param   argc      number of arguments in argv
+ * @param   argv      the command line
+ * @param   expanded  receives the expanded command line, or argv if nothing
+ *                    was expanded; it stays valid until the next parse
+ * @return            the number of arguments in the expanded command line
+ */
+int arg_end_expand(struct arg_end* end, int argc, char** argv, char*** expanded);
+
+/* The optional functions of an argument, or NULL if it provides none */
+#define ARG_HDR_EXT(hdr) (((hdr)->flag & ARG_HASEXT) ? (const struct arg_hdr_ext*)(hdr)->priv : NULL)
+
+/**
+ * @brief Copy the memory block of an argument struct for its clonefn.
+ *
+ * The copy's hdr.parent points to the copy. Pointers into the block must be
+ * moved to the copy with ARG_CLONE_PTR().
+ *
+ * @param   parent  the argument struct
+ * @param   nbytes  the size of the block allocated by the constructor
+ * @return          the copy
+ */
+void* arg_clone_block(const void* parent, size_t nbytes);
+
+#define ARG_CLONE_PTR(clone, parent, ptr) ((void*)((char*)(clone) + ((const char*)(ptr) - (const char*)(parent))))
+
+/**
+ * @brief Move the environment binding of an argument to its copy.
+ *
+ * The clonefn of arg_end copies the bindings of the original arguments, which
+ * the copy of the table must then point to its own arguments.
+ */
+void arg_end_rebind(struct arg_end* end, void* from, void* to);
+
+/* A set of table entries, one bit per entry */
+typedef unsigned int arg_bits_t;
+
+#define ARG_BITS_WIDTH (sizeof(arg_bits_t) * 8)
+#define ARG_BITS_LEN(n) (((size_t)(n) + ARG_BITS_WIDTH - 1) / ARG_BITS_WIDTH)
+#define ARG_BITS_SET(bits, i) ((bits)[(size_t)(i) / ARG_BITS_WIDTH] |= 1u << ((size_t)(i) % ARG_BITS_WIDTH))
+#define ARG_BITS_CLEAR(bits, i) ((bits)[(size_t)(i) / ARG_BITS_WIDTH] &= ~(1u << ((size_t)(i) % ARG_BITS_WIDTH)))
+#define ARG_BITS_TEST(bits, i) (((bits)[(size_t)(i) / ARG_BITS_WIDTH] >> ((size_t)(i) % ARG_BITS_WIDTH)) & 1u)
+
+/**
+ * @brief Return non-zero if response files are expanded.
+ */
+int arg_end_hasrespfile(struct arg_end* end);
+
+/**
+ * @brief Return non-zero if options of the table can also be read from the
+ * environment or from configuration files.
+ */
+int arg_end_haslayers(struct arg_end* end);
+
+/**
+ * @brief Scan the options the command line left out from the other layers.
+ *
+ * The environment is indexed once, and the value of each bound option is
+ * passed to its scanfn. The configuration files are then read from the last
+ * one added to the first, each one only setting the options that no layer
+ * of higher precedence has set. Errors are recorded in end, with the file
+ * and line of errors from configuration files.
+ *
+ * @param   end    the arg_end of the table
+ * @param   table  the argument table
+ * @param   given  the table entries the command line gave, updated with the
+ *                 entries set by each layer
+ */
+void arg_end_scanlayers(struct arg_end* end, struct arg_hdr** table, arg_bits_t* given);
+
+/**
+ * @brief Return non-zero if constraints between options were registered.
+ */
+int arg_end_hasconstraints(struct arg_end* end);
+
+/**
+ * @brief Check the constraints registered with arg_end_constrain().
+ *
+ * Each constraint is evaluated by testing the bits of its options, so the
+ * cost is linear in the total size of the constraints. Violations are
+ * registered in end, with the names of the options as their argval.
+ *
+ * @param   end      the arg_end of the table
+ * @param   table    the argument table
+ * @param   present  the table entries that were given
+ */
+void arg_end_checkconstraints(struct arg_end* end, struct arg_hdr** table, const arg_bits_t* present);
+
+/**
+ * @brief Register an error from a checkfn that reports more than one error.
+ *
+ * Only valid while arg_parse() runs the post-parse checks. The error is added
+ * to the arg_end of the table being checked, with argval as its argument.
+ */
+void arg_check_error(void* parent, int error, const char* argval);
+
+/**
+ * @brief Serialize access to process-wide state such as the getopt variables.
+ */
+void arg_global_lock(void);
+void arg_global_unlock(void);
+
 #ifdef __cplusplus
 }
 #endif
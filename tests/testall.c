@@ -35,12 +35,19 @@
 CuSuite* get_arglit_testsuite();
 CuSuite* get_argstr_testsuite();
 CuSuite* get_argint_testsuite();
+CuSuite* get_argint64_testsuite();
+CuSuite* get_argsize_testsuite();
+CuSuite* get_argduration_testsuite();
+CuSuite* get_arglist_testsuite();
+CuSuite* get_argenum_testsuite();
 CuSuite* get_argdate_testsuite();
 CuSuite* get_argdbl_testsuite();
 CuSuite* get_argfile_testsuite();
 CuSuite* get_argrex_testsuite();
 CuSuite* get_argdstr_testsuite();
 CuSuite* get_argcmd_testsuite();
+CuSuite* get_argcomplete_testsuite();
+CuSuite* get_argparse_testsuite();
 
 #ifndef ARGTABLE3_TEST_PUBLIC_ONLY
 CuSuite* get_arghashtable_testsuite();
@@ -53,12 +60,19 @@ int RunAllTests(void) {
     CuSuiteAddSuite(suite, get_arglit_testsuite());
     CuSuiteAddSuite(suite, get_argstr_testsuite());
     CuSuiteAddSuite(suite, get_argint_testsuite());
+    CuSuiteAddSuite(suite, get_argint64_testsuite());
+    CuSuiteAddSuite(suite, get_argsize_testsuite());
+    CuSuiteAddSuite(suite, get_argduration_testsuite());
+    CuSuiteAddSuite(suite, get_arglist_testsuite());
+    CuSuiteAddSuite(suite, get_argenum_testsuite());
     CuSuiteAddSuite(suite, get_argdate_testsuite());
     CuSuiteAddSuite(suite, get_argdbl_testsuite());
     CuSuiteAddSuite(suite, get_argfile_testsuite());
     CuSuiteAddSuite(suite, get_argrex_testsuite());
     CuSuiteAddSuite(suite, get_argdstr_testsuite());
     CuSuiteAddSuite(suite, get_argcmd_testsuite());
+    CuSuiteAddSuite(suite, get_argcomplete_testsuite());
+    CuSuiteAddSuite(suite, get_argparse_testsuite());
 #ifndef ARGTABLE3_TEST_PUBLIC_ONLY
     CuSuiteAddSuite(suite, get_arghashtable_testsuite());
 #endif
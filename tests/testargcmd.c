@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  ******************************************************************************/
 
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
@@ -36,6 +37,15 @@
 #include "CuTest.h"
 #include "argtable3.h"
 
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define HAVE_HEAP_INUSE 1
+static size_t heap_inuse(void) {
+    struct mallinfo2 mi = mallinfo2();
+    return mi.uordblks + mi.hblkhd;
+}
+#endif
+
 #if defined(_MSC_VER)
 #pragma warning(push)
 #pragma warning(disable : 4204)
@@ -82,9 +92,428 @@ void test_argcmd_basic_001(CuTest* tc) {
     arg_cmd_uninit();
 }
 
+int cmd2_proc(int argc, char* argv[], arg_dstr_t res, void* ctx) {
+    struct arg_int* n = arg_int1("n", NULL, "<n>", "number");
+    struct arg_end* end = arg_end(5);
+    void* argtable[] = {n, end};
+    int nerrors;
+    int ret = 1;
+
+    (void)ctx;
+    nerrors = arg_parse(argc, argv, argtable);
+    if (nerrors == 0) {
+        arg_dstr_catf(res, "n=%d", n->ival[0]);
+        ret = 0;
+    }
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    return ret;
+}
+
+void test_argcmd_async_001(CuTest* tc) {
+    char* argv1[] = {"cmd1", "-o", "file1"};
+    char* argv2[][3] = {
+            {"cmd2", "-n", "0"}, {"cmd2", "-n", "1"}, {"cmd2", "-n", "2"}, {"cmd2", "-n", "3"},
+            {"cmd2", "-n", "4"}, {"cmd2", "-n", "5"}, {"cmd2", "-n", "6"}, {"cmd2", "-n", "7"},
+    };
+    arg_cmd_job_t jobs[8];
+    arg_cmd_job_t job;
+    int i;
+
+    arg_cmd_init();
+    arg_cmd_set_workers(3);
+    arg_cmd_register("cmd1", cmd1_proc, "description of cmd1", NULL);
+    arg_cmd_register("cmd2", cmd2_proc, "description of cmd2", NULL);
+
+    job = arg_cmd_dispatch_async("cmd1", 3, argv1);
+    CuAssertIntEquals(tc, 0, arg_cmd_job_wait(job));
+    CuAssertIntEquals(tc, 1, arg_cmd_job_poll(job));
+    CuAssertStrEquals(tc, "3 cmd1", arg_dstr_cstr(arg_cmd_job_result(job)));
+    arg_cmd_job_destroy(job);
+
+    /* handlers calling arg_parse() may run side by side */
+    for (i = 0; i < 8; i++)
+        jobs[i] = arg_cmd_dispatch_async("cmd2", 3, argv2[i]);
+
+    for (i = 0; i < 8; i++) {
+        char expected[16];
+        sprintf(expected, "n=%d", i);
+        CuAssertIntEquals(tc, 0, arg_cmd_job_wait(jobs[i]));
+        CuAssertStrEquals(tc, expected, arg_dstr_cstr(arg_cmd_job_result(jobs[i])));
+        arg_cmd_job_destroy(jobs[i]);
+    }
+
+    arg_cmd_set_workers(-1);
+    arg_cmd_uninit();
+}
+
+void test_argcmd_async_002(CuTest* tc) {
+    arg_cmd_job_t job1, job2;
+
+    arg_cmd_init();
+    arg_cmd_set_workers(0);
+    arg_cmd_register("cmd1", cmd1_proc, "description of cmd1", NULL);
+
+    /* without workers, jobs run on the thread that waits for them */
+    job1 = arg_cmd_dispatch_async("cmd1", 0, NULL);
+    job2 = arg_cmd_dispatch_async("cmd1", 0, NULL);
+    CuAssertIntEquals(tc, 0, arg_cmd_job_poll(job1));
+    CuAssertIntEquals(tc, 0, arg_cmd_job_poll(job2));
+
+    CuAssertIntEquals(tc, 1, arg_cmd_job_wait(job2));
+    CuAssertIntEquals(tc, 0, arg_cmd_job_poll(job1));
+    CuAssertIntEquals(tc, 1, arg_cmd_job_poll(job2));
+    CuAssertStrEquals(tc, "cmd1 fail", arg_dstr_cstr(arg_cmd_job_result(job2)));
+    arg_cmd_job_destroy(job2);
+
+    /* shutting the registry down still runs the queued job */
+    arg_cmd_set_workers(-1);
+    arg_cmd_uninit();
+    CuAssertIntEquals(tc, 1, arg_cmd_job_poll(job1));
+    CuAssertIntEquals(tc, 1, arg_cmd_job_wait(job1));
+    arg_cmd_job_destroy(job1);
+}
+
+int cmd3_proc(int argc, char* argv[], arg_dstr_t res, void* ctx) {
+    int i;
+
+    (void)ctx;
+    for (i = 0; i < argc; i++)
+        arg_dstr_catf(res, "[%s]", argv[i]);
+    return argc > 1 && strcmp(argv[1], "fail") == 0;
+}
+
+void test_argcmd_batch_001(CuTest* tc) {
+    const char* script = "# setup\n"
+                         "cmd3 a 'b c' \"d \\\"e\\\"\"\n"
+                         "\n"
+                         "   cmd3   x\\ y  # trailing comment\r\n"
+                         "cmd3 long \\\n"
+                         "  continued\n"
+                         "nosuchcmd 1\n"
+                         "cmd3 fail";
+    arg_cmd_batch_t batch;
+    arg_cmd_batch_entry_t* e;
+
+    arg_cmd_init();
+    arg_cmd_register("cmd3", cmd3_proc, "description of cmd3", NULL);
+
+    batch = arg_cmd_batch_create(script, strlen(script));
+    CuAssertIntEquals(tc, 5, arg_cmd_batch_count(batch));
+    CuAssertIntEquals(tc, 2, arg_cmd_batch_run(batch));
+
+    e = arg_cmd_batch_entry(batch, 0);
+    CuAssertIntEquals(tc, 2, e->line);
+    CuAssertIntEquals(tc, 4, e->argc);
+    CuAssertTrue(tc, e->argv[4] == NULL);
+    CuAssertIntEquals(tc, 0, e->ret);
+    CuAssertStrEquals(tc, "[cmd3][a][b c][d \"e\"]", arg_dstr_cstr(e->res));
+    CuAssertTrue(tc, e->elapsed >= 0);
+
+    e = arg_cmd_batch_entry(batch, 1);
+    CuAssertIntEquals(tc, 4, e->line);
+    CuAssertStrEquals(tc, "[cmd3][x y]", arg_dstr_cstr(e->res));
+
+    e = arg_cmd_batch_entry(batch, 2);
+    CuAssertIntEquals(tc, 5, e->line);
+    CuAssertIntEquals(tc, 3, e->argc);
+    CuAssertStrEquals(tc, "[cmd3][long][continued]", arg_dstr_cstr(e->res));
+
+    e = arg_cmd_batch_entry(batch, 3);
+    CuAssertIntEquals(tc, 7, e->line);
+    CuAssertIntEquals(tc, -1, e->ret);
+
+    e = arg_cmd_batch_entry(batch, 4);
+    CuAssertIntEquals(tc, 8, e->line);
+    CuAssertIntEquals(tc, 1, e->ret);
+    CuAssertStrEquals(tc, "[cmd3][fail]", arg_dstr_cstr(e->res));
+
+    /* a batch can be run again */
+    CuAssertIntEquals(tc, 2, arg_cmd_batch_run(batch));
+    CuAssertStrEquals(tc, "[cmd3][x y]", arg_dstr_cstr(arg_cmd_batch_entry(batch, 1)->res));
+
+    arg_cmd_batch_destroy(batch);
+    arg_cmd_uninit();
+}
+
+void test_argcmd_batch_002(CuTest* tc) {
+    const char* path = "testargcmd_batch.tmp";
+    arg_cmd_batch_t batch;
+    FILE* fp;
+    int i;
+
+    arg_cmd_init();
+    arg_cmd_set_workers(4);
+    arg_cmd_register("cmd2", cmd2_proc, "description of cmd2", NULL);
+    arg_cmd_register("cmd3", cmd3_proc, "description of cmd3", NULL);
+    arg_cmd_set_flags("cmd2", ARG_CMD_INDEPENDENT);
+
+    fp = fopen(path, "wb");
+    for (i = 0; i < 100; i++) {
+        if (i % 10 == 9)
+            fprintf(fp, "cmd3 %d\n", i);
+        else
+            fprintf(fp, "cmd2 -n %d\n", i);
+    }
+    fclose(fp);
+
+    CuAssertTrue(tc, arg_cmd_batch_load("testargcmd_nosuchfile.tmp") == NULL);
+    batch = arg_cmd_batch_load(path);
+    CuAssertTrue(tc, batch != NULL);
+    CuAssertIntEquals(tc, 100, arg_cmd_batch_count(batch));
+    CuAssertIntEquals(tc, 0, arg_cmd_batch_run(batch));
+
+    /* results come back in script order even when commands ran in parallel */
+    for (i = 0; i < 100; i++) {
+        arg_cmd_batch_entry_t* e = arg_cmd_batch_entry(batch, i);
+        char expected[32];
+        if (i % 10 == 9)
+            sprintf(expected, "[cmd3][%d]", i);
+        else
+            sprintf(expected, "n=%d", i);
+        CuAssertIntEquals(tc, i + 1, e->line);
+        CuAssertStrEquals(tc, expected, arg_dstr_cstr(e->res));
+    }
+
+    arg_cmd_batch_destroy(batch);
+    remove(path);
+    arg_cmd_set_workers(-1);
+    arg_cmd_uninit();
+}
+
+void test_argcmd_memory_001(CuTest* tc) {
+    /* registers many generated commands and measures the heap cost of each */
+    const int ncmds = 20000;
+    char name[64];
+    arg_cmd_info_t* info;
+    int i;
+#ifdef HAVE_HEAP_INUSE
+    size_t before, per_cmd;
+#else
+    size_t per_cmd = 0; /* not measurable here */
+#endif
+
+    arg_cmd_init();
+#ifdef HAVE_HEAP_INUSE
+    before = heap_inuse();
+#endif
+    for (i = 0; i < ncmds; i++) {
+        sprintf(name, "generated-command-%d", i);
+        arg_cmd_register(name, cmd1_proc, (i % 2) ? "odd generated command" : "even generated command", NULL);
+    }
+#ifdef HAVE_HEAP_INUSE
+    /* interposed allocators (e.g. sanitizers) report nothing to mallinfo2 */
+    per_cmd = (heap_inuse() - before) / (size_t)ncmds;
+#endif
+
+    CuAssertIntEquals(tc, ncmds, (int)arg_cmd_count());
+    sprintf(name, "generated-command-%d", 12345);
+    info = arg_cmd_info(name);
+    CuAssertTrue(tc, info != NULL);
+    CuAssertStrEquals(tc, name, info->name);
+    CuAssertStrEquals(tc, "odd generated command", info->description);
+
+#if ARG_CMD_COMPACT
+    /* identical descriptions are stored once */
+    CuAssertTrue(tc, arg_cmd_info("generated-command-1")->description == arg_cmd_info("generated-command-3")->description);
+    if (per_cmd > 0)
+        CuAssertTrue(tc, per_cmd < 256);
+#else
+    if (per_cmd > 0)
+        CuAssertTrue(tc, per_cmd >= sizeof(arg_cmd_info_t));
+#endif
+
+    arg_cmd_uninit();
+}
+
+void test_argcmd_memory_002(CuTest* tc) {
+    char name[300];
+    char description[600];
+    arg_cmd_info_t* info;
+
+    memset(name, 'n', sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+    memset(description, 'd', sizeof(description) - 1);
+    description[sizeof(description) - 1] = '\0';
+
+    arg_cmd_init();
+    arg_cmd_register("cmd1", cmd1_proc, "description of cmd1", NULL);
+    arg_cmd_register("cmd1", cmd1_proc, "new description of cmd1", NULL);
+    CuAssertIntEquals(tc, 1, (int)arg_cmd_count());
+    CuAssertStrEquals(tc, "new description of cmd1", arg_cmd_info("cmd1")->description);
+    arg_cmd_unregister("cmd1");
+    CuAssertIntEquals(tc, 0, (int)arg_cmd_count());
+    CuAssertTrue(tc, arg_cmd_info("cmd1") == NULL);
+
+#if ARG_CMD_COMPACT
+    /* compact mode has no length limits */
+    arg_cmd_register(name, cmd1_proc, description, NULL);
+    info = arg_cmd_info(name);
+    CuAssertTrue(tc, info != NULL);
+    CuAssertStrEquals(tc, name, info->name);
+    CuAssertStrEquals(tc, description, info->description);
+#else
+    (void)info;
+#endif
+
+    arg_cmd_uninit();
+}
+
+enum { TBL_CMD, TBL_N, TBL_VERBOSE, TBL_END, TBL_NARGS };
+
+void** tbl_factory(void* ctx) {
+    void** argtable = (void**)malloc(TBL_NARGS * sizeof(void*));
+
+    (*(int*)ctx)++;
+    argtable[TBL_CMD] = arg_str1(NULL, NULL, "tbl", NULL);
+    argtable[TBL_N] = arg_int1("n", NULL, "<n>", "number");
+    argtable[TBL_VERBOSE] = arg_lit0("v", NULL, "verbose");
+    argtable[TBL_END] = arg_end(5);
+    return argtable;
+}
+
+int tbl_proc(int argc, char* argv[], void** argtable, int nerrors, arg_dstr_t res, void* ctx) {
+    struct arg_int* n = (struct arg_int*)argtable[TBL_N];
+    struct arg_lit* verbose = (struct arg_lit*)argtable[TBL_VERBOSE];
+
+    (void)argc;
+    (void)ctx;
+    if (nerrors > 0) {
+        arg_print_errors_ds(res, (struct arg_end*)argtable[TBL_END], argv[0]);
+        return 1;
+    }
+    arg_dstr_catf(res, "n=%d v=%d", n->ival[0], verbose->count);
+    return 0;
+}
+
+void test_argcmd_table_001(CuTest* tc) {
+    char* argv1[] = {"app", "tbl", "-n", "1", "-v", NULL};
+    char* argv2[] = {"app", "tbl", "-n", "2", NULL};
+    char* argv3[] = {"app", "tbl", "-x", NULL};
+    int nbuilt = 0;
+    arg_dstr_t res = arg_dstr_create();
+    arg_cmd_info_t* info;
+
+    arg_cmd_init();
+    arg_cmd_register_table("tbl", tbl_proc, tbl_factory, "table command", &nbuilt);
+    CuAssertIntEquals(tc, 1, (int)arg_cmd_count());
+    info = arg_cmd_info("tbl");
+    CuAssertTrue(tc, info != NULL);
+    CuAssertStrEquals(tc, "table command", info->description);
+
+    /* the table is built lazily, on first dispatch */
+    CuAssertIntEquals(tc, 0, nbuilt);
+    CuAssertIntEquals(tc, 0, arg_cmd_dispatch("tbl", 5, argv1, res));
+    CuAssertStrEquals(tc, "n=1 v=1", arg_dstr_cstr(res));
+    CuAssertIntEquals(tc, 1, nbuilt);
+
+    /* later dispatches reset and reuse it */
+    arg_dstr_reset(res);
+    CuAssertIntEquals(tc, 0, arg_cmd_dispatch("tbl", 4, argv2, res));
+    CuAssertStrEquals(tc, "n=2 v=0", arg_dstr_cstr(res));
+    CuAssertIntEquals(tc, 1, nbuilt);
+
+    arg_dstr_reset(res);
+    CuAssertIntEquals(tc, 1, arg_cmd_dispatch("tbl", 3, argv3, res));
+    CuAssertTrue(tc, strstr(arg_dstr_cstr(res), "invalid option") != NULL);
+    CuAssertIntEquals(tc, 1, nbuilt);
+
+    /* replacing the command drops the cached table */
+    arg_cmd_register_table("tbl", tbl_proc, tbl_factory, "table command", &nbuilt);
+    arg_dstr_reset(res);
+    CuAssertIntEquals(tc, 0, arg_cmd_dispatch("tbl", 4, argv2, res));
+    CuAssertIntEquals(tc, 2, nbuilt);
+
+    arg_cmd_unregister("tbl");
+    CuAssertIntEquals(tc, 0, (int)arg_cmd_count());
+
+    arg_dstr_destroy(res);
+    arg_cmd_uninit();
+}
+
+void test_argcmd_table_002(CuTest* tc) {
+    char* argvs[32][5];
+    char nums[32][8];
+    arg_cmd_job_t jobs[32];
+    int nbuilt = 0;
+    int i;
+
+    arg_cmd_init();
+    arg_cmd_set_workers(4);
+    arg_cmd_register_table("tbl", tbl_proc, tbl_factory, "table command", &nbuilt);
+
+    /* concurrent dispatches of one command never share a table */
+    for (i = 0; i < 32; i++) {
+        sprintf(nums[i], "%d", i);
+        argvs[i][0] = "app";
+        argvs[i][1] = "tbl";
+        argvs[i][2] = "-n";
+        argvs[i][3] = nums[i];
+        argvs[i][4] = NULL;
+        jobs[i] = arg_cmd_dispatch_async("tbl", 4, argvs[i]);
+    }
+    for (i = 0; i < 32; i++) {
+        char expected[16];
+        sprintf(expected, "n=%d v=0", i);
+        CuAssertIntEquals(tc, 0, arg_cmd_job_wait(jobs[i]));
+        CuAssertStrEquals(tc, expected, arg_dstr_cstr(arg_cmd_job_result(jobs[i])));
+        arg_cmd_job_destroy(jobs[i]);
+    }
+    CuAssertTrue(tc, nbuilt >= 1 && nbuilt <= 32);
+
+    arg_cmd_set_workers(-1);
+    arg_cmd_uninit();
+}
+
+void test_argcmd_table_003(CuTest* tc) {
+    char* argv1[] = {"app", "tbl", "-n", "1", NULL};
+    char* argv2[] = {"app", "tbl", "-n", "2", NULL};
+    arg_dstr_t res = arg_dstr_create();
+    arg_cmd_info_t* info;
+    arg_cmd_job_t job1;
+    arg_cmd_job_t job2;
+    int nbuilt = 0;
+
+    arg_cmd_init();
+    arg_cmd_register_table("tbl", tbl_proc, tbl_factory, "table command", &nbuilt);
+
+    /* the handler in the registry runs table commands too */
+    info = arg_cmd_info("tbl");
+    CuAssertTrue(tc, info->proc != NULL);
+    CuAssertIntEquals(tc, 0, info->proc(4, argv1, res, info->ctx));
+    CuAssertStrEquals(tc, "n=1 v=0", arg_dstr_cstr(res));
+    CuAssertIntEquals(tc, 1, nbuilt);
+
+    /* without workers, queued jobs run when they are waited for, after the command is replaced or removed */
+    arg_cmd_set_workers(0);
+    job1 = arg_cmd_dispatch_async("tbl", 4, argv1);
+    arg_cmd_register_table("tbl", tbl_proc, tbl_factory, "table command", &nbuilt);
+    job2 = arg_cmd_dispatch_async("tbl", 4, argv2);
+    arg_cmd_unregister("tbl");
+    CuAssertIntEquals(tc, 0, arg_cmd_job_wait(job1));
+    CuAssertStrEquals(tc, "n=1 v=0", arg_dstr_cstr(arg_cmd_job_result(job1)));
+    CuAssertIntEquals(tc, 0, arg_cmd_job_wait(job2));
+    CuAssertStrEquals(tc, "n=2 v=0", arg_dstr_cstr(arg_cmd_job_result(job2)));
+    arg_cmd_job_destroy(job1);
+    arg_cmd_job_destroy(job2);
+
+    arg_cmd_set_workers(-1);
+    arg_dstr_destroy(res);
+    arg_cmd_uninit();
+}
+
 CuSuite* get_argcmd_testsuite() {
     CuSuite* suite = CuSuiteNew();
     SUITE_ADD_TEST(suite, test_argcmd_basic_001);
+    SUITE_ADD_TEST(suite, test_argcmd_async_001);
+    SUITE_ADD_TEST(suite, test_argcmd_async_002);
+    SUITE_ADD_TEST(suite, test_argcmd_batch_001);
+    SUITE_ADD_TEST(suite, test_argcmd_batch_002);
+    SUITE_ADD_TEST(suite, test_argcmd_memory_001);
+    SUITE_ADD_TEST(suite, test_argcmd_memory_002);
+    SUITE_ADD_TEST(suite, test_argcmd_table_001);
+    SUITE_ADD_TEST(suite, test_argcmd_table_002);
+    SUITE_ADD_TEST(suite, test_argcmd_table_003);
     return suite;
 }
 
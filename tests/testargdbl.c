@@ -29,10 +29,14 @@
  ******************************************************************************/
 
 #include <float.h>
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "CuTest.h"
 #include "argtable3.h"
+#include "argtable3_private.h"
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -426,6 +430,121 @@ void test_argdbl_basic_015(CuTest* tc) {
     arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
 }
 
+static int dbl_same(double a, double b) {
+    return memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+void test_argdbl_basic_016(CuTest* tc) {
+    /* values that exercise every conversion path agree with strtod() in the C locale */
+    static const char* values[] = {
+        "0",
+        "-0",
+        "1.5",
+        " +.5",
+        "5.",
+        "1e22",
+        "1e23",
+        "9007199254740993",
+        "123456789012345678901234567890",
+        "0.000000000000000000000000000000000000001",
+        "2.2250738585072011e-308",
+        "2.2250738585072014e-308",
+        "4.9e-324",
+        "2.4703282292062327e-324",
+        "2.4703282292062328e-324",
+        "1.7976931348623157e308",
+        "1.7976931348623158e308",
+        "1e-400",
+        "1.00000000000000011102230246251565404236316680908203125",
+        "1.00000000000000011102230246251565404236316680908203124",
+        "1.00000000000000011102230246251565404236316680908203126",
+        "0x1.8p3",
+        "-inf",
+        "1e",
+        "1e+",
+        "1.5x",
+        ".",
+    };
+    struct arg_dbl* a = arg_dbl0(NULL, NULL, "a", "a is <double>");
+    size_t i;
+
+    for (i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        char* end;
+        double expected = strtod(values[i], &end);
+        int errorcode;
+
+        a->hdr.resetfn(a);
+        errorcode = a->hdr.scanfn(a, values[i]);
+        CuAssertIntEquals_Msg(tc, values[i], *end == '\0' ? 0 : ARG_ERR_BADDOUBLE, errorcode);
+        if (errorcode == 0)
+            CuAssert(tc, values[i], dbl_same(expected, a->dval[0]));
+    }
+
+    arg_freetable((void**)&a, 1);
+}
+
+void test_argdbl_basic_017(CuTest* tc) {
+    /* random doubles printed with 17 significant digits round-trip exactly, */
+    /* and shorter forms round to the same value as strtod()                 */
+    struct arg_dbl* a = arg_dbl0(NULL, NULL, "a", "a is <double>");
+    unsigned long seed = 12345;
+    char buf[64];
+    int i;
+
+    for (i = 0; i < 100000; i++) {
+        unsigned char bytes[sizeof(double)];
+        double d;
+        size_t j;
+
+        for (j = 0; j < sizeof(bytes); j++) {
+            seed = (seed * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+            bytes[j] = (unsigned char)(seed >> 16);
+        }
+        memcpy(&d, bytes, sizeof(d));
+        if (d != d || d - d != 0)
+            continue; /* NaN or infinity */
+
+        sprintf(buf, "%.17g", d);
+        a->hdr.resetfn(a);
+        CuAssertIntEquals_Msg(tc, buf, 0, a->hdr.scanfn(a, buf));
+        CuAssert(tc, buf, dbl_same(d, a->dval[0]));
+
+        sprintf(buf, "%.*e", i % 20, d);
+        a->hdr.resetfn(a);
+        CuAssertIntEquals_Msg(tc, buf, 0, a->hdr.scanfn(a, buf));
+        CuAssert(tc, buf, dbl_same(strtod(buf, NULL), a->dval[0]));
+    }
+
+    arg_freetable((void**)&a, 1);
+}
+
+void test_argdbl_basic_018(CuTest* tc) {
+    /* the decimal point is always '.', whatever the locale */
+    static const char* locales[] = {"de_DE.UTF-8", "de_DE", "fr_FR.UTF-8", "fr_FR", "German", NULL};
+    struct arg_dbl* a = arg_dbl0(NULL, NULL, "a", "a is <double>");
+    char saved[64];
+    int i;
+
+    strncpy(saved, setlocale(LC_NUMERIC, NULL), sizeof(saved) - 1);
+    saved[sizeof(saved) - 1] = '\0';
+    for (i = 0; locales[i]; i++) {
+        if (setlocale(LC_NUMERIC, locales[i]))
+            break;
+    }
+
+    a->hdr.resetfn(a);
+    CuAssertIntEquals(tc, 0, a->hdr.scanfn(a, "1.5"));
+    CuAssertDblEquals(tc, 1.5, a->dval[0], 0);
+    a->hdr.resetfn(a);
+    CuAssertIntEquals(tc, 0, a->hdr.scanfn(a, "-2.5e-3"));
+    CuAssertDblEquals(tc, -2.5e-3, a->dval[0], 0);
+    a->hdr.resetfn(a);
+    CuAssertIntEquals(tc, ARG_ERR_BADDOUBLE, a->hdr.scanfn(a, "1,5"));
+
+    setlocale(LC_NUMERIC, saved);
+    arg_freetable((void**)&a, 1);
+}
+
 CuSuite* get_argdbl_testsuite() {
     CuSuite* suite = CuSuiteNew();
     SUITE_ADD_TEST(suite, test_argdbl_basic_001);
@@ -443,6 +562,9 @@ CuSuite* get_argdbl_testsuite() {
     SUITE_ADD_TEST(suite, test_argdbl_basic_013);
     SUITE_ADD_TEST(suite, test_argdbl_basic_014);
     SUITE_ADD_TEST(suite, test_argdbl_basic_015);
+    SUITE_ADD_TEST(suite, test_argdbl_basic_016);
+    SUITE_ADD_TEST(suite, test_argdbl_basic_017);
+    SUITE_ADD_TEST(suite, test_argdbl_basic_018);
     return suite;
 }
 
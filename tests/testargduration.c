@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "CuTest.h"
+#include "argtable3.h"
+#include "argtable3_private.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4204)
+#endif
+
+#define NSEC_PER_SEC ((int64_t)1000000000)
+
+void test_argduration_basic_001(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        int64_t value;
+    } cases[] = {
+        {"--x=0", 0},
+        {"--x=-0", 0},
+        {"--x=0s", 0},
+        {"--x=250ms", 250000000},
+        {"--x=1.5s", 1500000000},
+        {"--x=1.s", NSEC_PER_SEC},
+        {"--x=.5us", 500},
+        {"--x=1\xC2\xB5s", 1000},
+        {"--x=1\xCE\xBCs", 1000},
+        {"--x=90s", 90 * NSEC_PER_SEC},
+        {"--x=1h30m", 5400 * NSEC_PER_SEC},
+        {"--x=-1m", -60 * NSEC_PER_SEC},
+        {"--x= +2h ", 7200 * NSEC_PER_SEC},
+        {"--x=1.25h", 4500 * NSEC_PER_SEC},
+        {"--x=1h1m1s1ms1us1ns", 3661 * NSEC_PER_SEC + 1001001},
+        {"--x=0.0000000019s", 1},
+        {"--x=0.1s", NSEC_PER_SEC / 10},
+        {"--x=0.7ms", 700000},
+        {"--x=0.1m", 6 * NSEC_PER_SEC},
+        {"--x=0.3h", 1080 * NSEC_PER_SEC},
+        {"--x=1.000000001s", NSEC_PER_SEC + 1},
+        {"--x=2.675m", 160500000000},
+        {"--x=0.55913665165m", 33548199099},
+        {"--x=0.52715088639250h", 1897743191013},
+        {"--x=0.33333333333333333333333333h", 1200 * NSEC_PER_SEC - 1},
+        {"--x=0.00000000000000000000000001h", 0},
+        {"--x=9223372036854775807ns", (int64_t)(~(uint64_t)0 >> 1)},
+        {"--x=-9223372036854775808ns", -(int64_t)(~(uint64_t)0 >> 1) - 1},
+        {"--x=2562047h", (int64_t)2562047 * 3600 * NSEC_PER_SEC},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_duration* x = arg_duration1(NULL, "x", NULL, "x is <duration>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, x->count);
+        CuAssert(tc, cases[i].arg, x->nsec[0] == cases[i].value);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argduration_basic_002(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        int error;
+    } cases[] = {
+        {"--x=9223372036854775808ns", ARG_ERR_OVERFLOW},
+        {"--x=-9223372036854775809ns", ARG_ERR_OVERFLOW},
+        {"--x=2562048h", ARG_ERR_OVERFLOW},
+        {"--x=2562047h47m17s", ARG_ERR_OVERFLOW},
+        {"--x=99999999999999999999999s", ARG_ERR_OVERFLOW},
+        {"--x=1", ARG_ERR_BADINT},
+        {"--x=00", ARG_ERR_BADINT},
+        {"--x=h", ARG_ERR_BADINT},
+        {"--x=.s", ARG_ERR_BADINT},
+        {"--x=1x", ARG_ERR_BADINT},
+        {"--x=1M", ARG_ERR_BADINT},
+        {"--x=1h30", ARG_ERR_BADINT},
+        {"--x=1h 30m", ARG_ERR_BADINT},
+        {"--x=--1s", ARG_ERR_BADINT},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_duration* x = arg_duration0(NULL, "x", NULL, "x is <duration>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, x->count);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].error, end->error[0]);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argduration_basic_003(CuTest* tc) {
+    struct arg_duration* a = arg_durationn("t", "timeout", NULL, 0, 1, "a timeout");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[] = {"program", "--timeout=300000h", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    arg_dstr_t ds = arg_dstr_create();
+    int nerrors;
+
+    CuAssertStrEquals(tc, "<duration>", a->hdr.datatype);
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertTrue(tc, a->nsec[0] == (int64_t)300000 * 3600 * NSEC_PER_SEC);
+
+    argv[1] = "--timeout=3000000h";
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 1, nerrors);
+
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc, "program: integer overflow at option -t|--timeout=<duration> (3000000h is too large)\n", arg_dstr_cstr(ds));
+
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+CuSuite* get_argduration_testsuite() {
+    CuSuite* suite = CuSuiteNew();
+    SUITE_ADD_TEST(suite, test_argduration_basic_001);
+    SUITE_ADD_TEST(suite, test_argduration_basic_002);
+    SUITE_ADD_TEST(suite, test_argduration_basic_003);
+    return suite;
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "CuTest.h"
+#include "argtable3.h"
+#include "argtable3_private.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4204)
+#endif
+
+static const char* modes[] = {"fast", "safe", "debug", NULL};
+
+void test_argenum_basic_001(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        int idx;
+    } cases[] = {
+        {"--mode=fast", 0},
+        {"--mode=safe", 1},
+        {"--mode=debug", 2},
+        {"-mdebug", 2},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_enum* a = arg_enum1("m", "mode", modes, NULL, 0, "run mode");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {a, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, a->count);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].idx, a->idx[0]);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argenum_basic_002(CuTest* tc) {
+    static const char* cases[] = {"--mode=fas", "--mode=fastx", "--mode=FAST", "--mode=Safe", "--mode= fast", "--mode=x"};
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_enum* a = arg_enum0("m", "mode", modes, NULL, 0, "run mode");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {a, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i];
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i], 1, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i], 0, a->count);
+        CuAssertIntEquals_Msg(tc, cases[i], ARG_ERR_BADENUM, end->error[0]);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argenum_basic_003(CuTest* tc) {
+    struct arg_enum* a = arg_enumn("m", "mode", modes, NULL, 0, 3, ARG_ENUM_ICASE, "run mode");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[] = {"program", "--mode=FAST", "-mDebug", "--mode=sAfE", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    arg_dstr_t ds = arg_dstr_create();
+    int nerrors;
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 3, a->count);
+    CuAssertIntEquals(tc, 0, a->idx[0]);
+    CuAssertIntEquals(tc, 2, a->idx[1]);
+    CuAssertIntEquals(tc, 1, a->idx[2]);
+
+    argv[2] = "-mturbo";
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 1, nerrors);
+    CuAssertIntEquals(tc, 2, a->count);
+
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc, "program: invalid argument \"turbo\" to option -m|--mode={fast,safe,debug} (expected one of fast, safe, debug)\n",
+                      arg_dstr_cstr(ds));
+
+    arg_dstr_reset(ds);
+    arg_print_glossary_ds(ds, argtable, "%-30s %s\n");
+    CuAssertStrEquals(tc, "-m, --mode={fast,safe,debug}   run mode\n", arg_dstr_cstr(ds));
+
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argenum_basic_004(CuTest* tc) {
+    static const char* dup[] = {"red", "green", "red", NULL};
+    static const char* dupcase[] = {"red", "green", "Red", NULL};
+    static const char* none[] = {NULL};
+    struct arg_enum* a;
+
+    CuAssertPtrEquals(tc, NULL, arg_enum0(NULL, "color", dup, NULL, 0, NULL));
+    CuAssertPtrEquals(tc, NULL, arg_enum0(NULL, "color", dupcase, NULL, ARG_ENUM_ICASE, NULL));
+    CuAssertPtrEquals(tc, NULL, arg_enum0(NULL, "color", none, NULL, 0, NULL));
+    CuAssertPtrEquals(tc, NULL, arg_enum0(NULL, "color", NULL, NULL, 0, NULL));
+
+    /* choices that differ only in case are distinct when matching is case sensitive */
+    a = arg_enum0(NULL, "color", dupcase, "<color>", 0, NULL);
+    CuAssertTrue(tc, a != NULL);
+    CuAssertStrEquals(tc, "<color>", a->hdr.datatype);
+    arg_freetable((void**)&a, 1);
+}
+
+void test_argenum_basic_005(CuTest* tc) {
+    static char names[500][16];
+    static const char* choices[501];
+    struct arg_enum* a;
+    struct arg_end* end = arg_end(20);
+    void* argtable[2];
+    char* argv[] = {"program", NULL, NULL};
+    char buf[32];
+    int nerrors;
+    int i;
+
+    /* enough choices to need displaced buckets in the perfect hash */
+    for (i = 0; i < 500; i++) {
+        sprintf(names[i], "choice%d", i * 7);
+        choices[i] = names[i];
+    }
+    choices[500] = NULL;
+
+    a = arg_enum1(NULL, "x", choices, "<x>", 0, NULL);
+    argtable[0] = a;
+    argtable[1] = end;
+    CuAssertTrue(tc, a != NULL);
+
+    for (i = 0; i < 3500; i++) {
+        sprintf(buf, "--x=choice%d", i);
+        argv[1] = buf;
+        nerrors = arg_parse(2, argv, argtable);
+        if (i % 7 == 0) {
+            CuAssertIntEquals_Msg(tc, buf, 0, nerrors);
+            CuAssertIntEquals_Msg(tc, buf, i / 7, a->idx[0]);
+        } else {
+            CuAssertIntEquals_Msg(tc, buf, 1, nerrors);
+        }
+    }
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+CuSuite* get_argenum_testsuite() {
+    CuSuite* suite = CuSuiteNew();
+    SUITE_ADD_TEST(suite, test_argenum_basic_001);
+    SUITE_ADD_TEST(suite, test_argenum_basic_002);
+    SUITE_ADD_TEST(suite, test_argenum_basic_003);
+    SUITE_ADD_TEST(suite, test_argenum_basic_004);
+    SUITE_ADD_TEST(suite, test_argenum_basic_005);
+    return suite;
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
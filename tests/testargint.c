@@ -28,10 +28,12 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  ******************************************************************************/
 
+#include <limits.h>
 #include <string.h>
 
 #include "CuTest.h"
 #include "argtable3.h"
+#include "argtable3_private.h"
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -1954,6 +1956,91 @@ void test_argint_basic_054(CuTest* tc) {
     arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
 }
 
+void test_argint_basic_055(CuTest* tc) {
+    /* grammar corner cases that must keep the strtol() semantics */
+    static const struct {
+        const char* arg;
+        int value;
+    } cases[] = {
+        {"--x=010", 10},
+        {"--x= \t+42", 42},
+        {"--x=-0x-10", 16},
+        {"--x=0x 1f", 31},
+        {"--x=0x0x1A", 26},
+        {"--x=0X1b", 27},
+        {"--x=0o-17", -15},
+        {"--x=-0b1010", -10},
+        {"--x=0x1KB", 1024},
+        {"--x=2kB  ", 2048},
+        {"--x=2147483647", INT_MAX},
+        {"--x=-2147483648", INT_MIN},
+        {"--x=-0x80000000", INT_MIN},
+        {"--x=-2097152KB", INT_MIN},
+        {"--x=1GB", 1073741824},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_int* x = arg_int1(NULL, "x", "<int>", "x is <int>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, x->count);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].value, x->ival[0]);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argint_basic_056(CuTest* tc) {
+    /* malformed values are reported as such even when they would also overflow */
+    static const struct {
+        const char* arg;
+        int error;
+    } cases[] = {
+        {"--x= ", ARG_ERR_BADINT},
+        {"--x=+", ARG_ERR_BADINT},
+        {"--x=- 5", ARG_ERR_BADINT},
+        {"--x=0x", ARG_ERR_BADINT},
+        {"--x=0b2", ARG_ERR_BADINT},
+        {"--x=0o9", ARG_ERR_BADINT},
+        {"--x=0x0xg", ARG_ERR_BADINT},
+        {"--x=1 KB", ARG_ERR_BADINT},
+        {"--x=1K", ARG_ERR_BADINT},
+        {"--x=1KBx", ARG_ERR_BADINT},
+        {"--x=99999999999x", ARG_ERR_BADINT},
+        {"--x=2147483648", ARG_ERR_OVERFLOW},
+        {"--x=-2147483649", ARG_ERR_OVERFLOW},
+        {"--x=2097152KB", ARG_ERR_OVERFLOW},
+        {"--x=99999999999999999999999GB", ARG_ERR_OVERFLOW},
+        {"--x=-0x-80000000", ARG_ERR_OVERFLOW},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_int* x = arg_int0(NULL, "x", "<int>", "x is <int>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, x->count);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].error, end->error[0]);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
 CuSuite* get_argint_testsuite() {
     CuSuite* suite = CuSuiteNew();
     SUITE_ADD_TEST(suite, test_argint_basic_001);
@@ -2010,6 +2097,8 @@ CuSuite* get_argint_testsuite() {
     SUITE_ADD_TEST(suite, test_argint_basic_052);
     SUITE_ADD_TEST(suite, test_argint_basic_053);
     SUITE_ADD_TEST(suite, test_argint_basic_054);
+    SUITE_ADD_TEST(suite, test_argint_basic_055);
+    SUITE_ADD_TEST(suite, test_argint_basic_056);
     return suite;
 }
 
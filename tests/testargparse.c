@@ -0,0 +1,833 @@
+/*******************************************************************************
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CuTest.h"
+#include "argtable3.h"
+
+#ifdef _WIN32
+#define TEST_SETENV(name, value) _putenv_s(name, value)
+#define TEST_UNSETENV(name) _putenv_s(name, "")
+#else
+#define TEST_SETENV(name, value) setenv(name, value, 1)
+#define TEST_UNSETENV(name) unsetenv(name)
+#endif
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4204)
+#endif
+
+static void write_file(const char* path, const char* text) {
+    FILE* fp = fopen(path, "wb");
+    if (fp) {
+        fputs(text, fp);
+        fclose(fp);
+    }
+}
+
+void test_argparse_basic_001(CuTest* tc) {
+    struct arg_lit* v = arg_litn("v", "verbose", 0, 5, "verbose");
+    struct arg_str* name = arg_str0("n", "name", "<name>", "name");
+    struct arg_file* files = arg_filen(NULL, NULL, "<file>", 0, 10, "files");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {v, name, files, end};
+    char* argv[] = {"program", "first.c", "@testargparse_001.rsp", "-v", "last.c", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    int nerrors;
+
+    write_file("testargparse_001.rsp",
+               "-v --name \"hello \\\"world\\\"\"\n"
+               "  'it is'\tsecond\\ file.c\r\n"
+               "# not a comment\n");
+
+    arg_end_respfile(end, 1);
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 2, v->count);
+    CuAssertIntEquals(tc, 1, name->count);
+    CuAssertStrEquals(tc, "hello \"world\"", name->sval[0]);
+    CuAssertIntEquals(tc, 8, files->count);
+    CuAssertStrEquals(tc, "first.c", files->filename[0]);
+    CuAssertStrEquals(tc, "it is", files->filename[1]);
+    CuAssertStrEquals(tc, "second file.c", files->filename[2]);
+    CuAssertStrEquals(tc, "#", files->filename[3]);
+    CuAssertStrEquals(tc, "not", files->filename[4]);
+    CuAssertStrEquals(tc, "comment", files->filename[6]);
+    CuAssertStrEquals(tc, "last.c", files->filename[7]);
+
+    /* the caller's argv is left alone */
+    CuAssertStrEquals(tc, "@testargparse_001.rsp", argv[2]);
+
+    remove("testargparse_001.rsp");
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argparse_basic_002(CuTest* tc) {
+    struct arg_lit* v = arg_litn("v", NULL, 0, 5, "verbose");
+    struct arg_str* words = arg_strn(NULL, NULL, "<word>", 0, 20, "words");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {v, words, end};
+    char* argv[] = {"program", "@testargparse_002a.rsp", "@testargparse_002.missing", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    arg_dstr_t ds = arg_dstr_create();
+    int nerrors;
+
+    /* a refers to b and c, c refers back to a, and b is included twice, which is not a cycle */
+    write_file("testargparse_002a.rsp", "a1 @testargparse_002b.rsp @testargparse_002c.rsp a2");
+    write_file("testargparse_002b.rsp", "b1 -v");
+    write_file("testargparse_002c.rsp", "c1 @testargparse_002b.rsp @testargparse_002a.rsp c2");
+
+    arg_end_respfile(end, 1);
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 2, nerrors);
+    CuAssertIntEquals(tc, 2, v->count);
+    CuAssertIntEquals(tc, 6, words->count);
+    CuAssertStrEquals(tc, "a1", words->sval[0]);
+    CuAssertStrEquals(tc, "b1", words->sval[1]);
+    CuAssertStrEquals(tc, "c1", words->sval[2]);
+    CuAssertStrEquals(tc, "b1", words->sval[3]);
+    CuAssertStrEquals(tc, "c2", words->sval[4]);
+    CuAssertStrEquals(tc, "a2", words->sval[5]);
+
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc,
+                      "program: response file \"testargparse_002a.rsp\" refers to itself\n"
+                      "program: cannot read response file \"testargparse_002.missing\"\n",
+                      arg_dstr_cstr(ds));
+
+    remove("testargparse_002a.rsp");
+    remove("testargparse_002b.rsp");
+    remove("testargparse_002c.rsp");
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argparse_basic_003(CuTest* tc) {
+    struct arg_str* words = arg_strn(NULL, NULL, "<word>", 0, 20, "words");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {words, end};
+    char* argv[] = {"program", "@testargparse_003.rsp", "@", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    int nerrors;
+
+    write_file("testargparse_003.rsp", "one two");
+
+    /* without response files "@path" is an ordinary argument */
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 2, words->count);
+    CuAssertStrEquals(tc, "@testargparse_003.rsp", words->sval[0]);
+
+    /* a lone "@" is never a response file */
+    arg_end_respfile(end, 1);
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 3, words->count);
+    CuAssertStrEquals(tc, "one", words->sval[0]);
+    CuAssertStrEquals(tc, "two", words->sval[1]);
+    CuAssertStrEquals(tc, "@", words->sval[2]);
+
+    arg_end_respfile(end, 0);
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 2, words->count);
+
+    remove("testargparse_003.rsp");
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argparse_basic_004(CuTest* tc) {
+    struct arg_int* threads = arg_int0("t", "threads", "<n>", "threads");
+    struct arg_str* name = arg_str0(NULL, "log-file", "<file>", "log file");
+    struct arg_lit* dry = arg_lit0(NULL, "dry-run", "dry run");
+    struct arg_lit* color = arg_lit0("c", NULL, "color");
+    struct arg_int* jobs = arg_int0("j", "jobs", "<n>", "jobs");
+    struct arg_str* words = arg_strn(NULL, NULL, "<word>", 0, 5, "words");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {threads, name, dry, color, jobs, words, end};
+    char* argv[] = {"program", "--jobs=3", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    int nerrors;
+
+    TEST_SETENV("TESTARGPARSE_THREADS", "0x10");
+    TEST_SETENV("TESTARGPARSE_LOG_FILE", "out.log");
+    TEST_SETENV("TESTARGPARSE_DRY_RUN", "Yes");
+    TEST_SETENV("TESTARGPARSE_COLOR", "1");
+    TEST_SETENV("TESTARGPARSE_JOBS", "99");
+    TEST_SETENV("TESTARGPARSE_COLOUR", "1");
+
+    /* without a prefix or bindings the environment is ignored */
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 0, threads->count);
+
+    arg_end_envprefix(end, "TESTARGPARSE_");
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 1, threads->count);
+    CuAssertIntEquals(tc, 16, threads->ival[0]);
+    CuAssertIntEquals(tc, 1, name->count);
+    CuAssertStrEquals(tc, "out.log", name->sval[0]);
+    CuAssertIntEquals(tc, 1, dry->count);
+    CuAssertIntEquals(tc, 0, color->count);
+    CuAssertIntEquals(tc, 1, jobs->count);
+    CuAssertIntEquals(tc, 3, jobs->ival[0]);
+    CuAssertIntEquals(tc, 0, words->count);
+
+    /* bindings replace derived names, also for short-only options, or exclude options */
+    arg_end_envbind(end, color, "TESTARGPARSE_COLOUR");
+    arg_end_envbind(end, name, NULL);
+    arg_end_envbind(end, jobs, "TESTARGPARSE_THREADS");
+    argv[1] = "-t7";
+    TEST_SETENV("TESTARGPARSE_DRY_RUN", "OFF");
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 1, threads->count);
+    CuAssertIntEquals(tc, 7, threads->ival[0]);
+    CuAssertIntEquals(tc, 0, name->count);
+    CuAssertIntEquals(tc, 0, dry->count);
+    CuAssertIntEquals(tc, 1, color->count);
+    CuAssertIntEquals(tc, 1, jobs->count);
+    CuAssertIntEquals(tc, 16, jobs->ival[0]);
+
+    TEST_UNSETENV("TESTARGPARSE_THREADS");
+    TEST_UNSETENV("TESTARGPARSE_LOG_FILE");
+    TEST_UNSETENV("TESTARGPARSE_DRY_RUN");
+    TEST_UNSETENV("TESTARGPARSE_COLOR");
+    TEST_UNSETENV("TESTARGPARSE_JOBS");
+    TEST_UNSETENV("TESTARGPARSE_COLOUR");
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argparse_basic_005(CuTest* tc) {
+    struct arg_int* threads = arg_int1("t", "threads", "<n>", "threads");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {threads, end};
+    char* argv[] = {"program", NULL};
+    arg_dstr_t ds = arg_dstr_create();
+    int nerrors;
+
+    arg_end_envprefix(end, "TESTARGPARSE_");
+
+    /* a required option can come from the environment */
+    TEST_SETENV("TESTARGPARSE_THREADS", "4");
+    nerrors = arg_parse(1, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 4, threads->ival[0]);
+
+    nerrors = arg_parse(0, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 1, threads->count);
+
+    /* an invalid value is reported with the value of the variable */
+    TEST_SETENV("TESTARGPARSE_THREADS", "four");
+    nerrors = arg_parse(1, argv, argtable);
+    CuAssertIntEquals(tc, 1, nerrors);
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc, "program: invalid argument \"four\" to option -t|--threads=<n>\n", arg_dstr_cstr(ds));
+
+    TEST_UNSETENV("TESTARGPARSE_THREADS");
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argparse_basic_006(CuTest* tc) {
+    struct arg_int* threads = arg_int0("t", "threads", "<n>", "threads");
+    struct arg_str* name = arg_str0(NULL, "log-file,logfile", "<file>", "log file");
+    struct arg_lit* dry = arg_lit0(NULL, "dry-run", "dry run");
+    struct arg_lit* color = arg_lit0(NULL, "color", "color");
+    struct arg_int* jobs = arg_int0("j", "jobs", "<n>", "jobs");
+    struct arg_str* tags = arg_strn(NULL, "tag", "<tag>", 0, 5, "tags");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {threads, name, dry, color, jobs, tags, end};
+    char* argv[] = {"program", "--jobs=3", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    int nerrors;
+
+    write_file("testargparse_006_system.conf",
+               "# system defaults\n"
+               "[general]\n"
+               "threads = 2\n"
+               "jobs = 1\n"
+               "dry-run\n"
+               "tag = a\n"
+               "tag = b\n");
+    write_file("testargparse_006_user.conf",
+               "; user settings\r\n"
+               "  threads=8  \r\n"
+               "logfile = \" my tool.log \"\r\n"
+               "color = off\r\n"
+               "tag = c");
+
+    /* later files override earlier ones, and a missing file is skipped */
+    arg_end_config(end, "testargparse_006_system.conf");
+    arg_end_config(end, "testargparse_006_missing.conf");
+    arg_end_config(end, "testargparse_006_user.conf");
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 1, threads->count);
+    CuAssertIntEquals(tc, 8, threads->ival[0]);
+    CuAssertIntEquals(tc, 1, name->count);
+    CuAssertStrEquals(tc, " my tool.log ", name->sval[0]);
+    CuAssertIntEquals(tc, 1, dry->count);
+    CuAssertIntEquals(tc, 0, color->count);
+    CuAssertIntEquals(tc, 1, jobs->count);
+    CuAssertIntEquals(tc, 3, jobs->ival[0]);
+    CuAssertIntEquals(tc, 1, tags->count);
+    CuAssertStrEquals(tc, "c", tags->sval[0]);
+
+    /* the environment overrides the files, and the command line overrides both */
+    arg_end_envprefix(end, "TESTARGPARSE_");
+    TEST_SETENV("TESTARGPARSE_THREADS", "16");
+    TEST_SETENV("TESTARGPARSE_JOBS", "32");
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 16, threads->ival[0]);
+    CuAssertIntEquals(tc, 3, jobs->ival[0]);
+    CuAssertStrEquals(tc, " my tool.log ", name->sval[0]);
+    TEST_UNSETENV("TESTARGPARSE_THREADS");
+    TEST_UNSETENV("TESTARGPARSE_JOBS");
+    arg_end_envprefix(end, NULL);
+
+    /* a file alone sets every value of a multi-valued option */
+    arg_end_config(end, NULL);
+    arg_end_config(end, "testargparse_006_system.conf");
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 2, threads->ival[0]);
+    CuAssertIntEquals(tc, 0, name->count);
+    CuAssertIntEquals(tc, 2, tags->count);
+    CuAssertStrEquals(tc, "a", tags->sval[0]);
+    CuAssertStrEquals(tc, "b", tags->sval[1]);
+
+    remove("testargparse_006_system.conf");
+    remove("testargparse_006_user.conf");
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argparse_basic_007(CuTest* tc) {
+    struct arg_int* threads = arg_int0("t", "threads", "<n>", "threads");
+    struct arg_str* name = arg_str0(NULL, "log-file", "<file>", "log file");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {threads, name, end};
+    char* argv[] = {"program", "--threads", NULL};
+    arg_dstr_t ds = arg_dstr_create();
+    int nerrors;
+
+    write_file("testargparse_007.conf",
+               "threads = four\n"
+               "\n"
+               "colour = red\n"
+               "log-file\n"
+               "= value\n"
+               "log file = x\n");
+
+    /* errors name the file and line they come from */
+    arg_end_config(end, "testargparse_007.conf");
+    nerrors = arg_parse(1, argv, argtable);
+    CuAssertIntEquals(tc, 5, nerrors);
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc,
+                      "program: testargparse_007.conf:1: invalid argument \"four\" to option -t|--threads=<n>\n"
+                      "program: testargparse_007.conf:3: unknown option \"colour\"\n"
+                      "program: testargparse_007.conf:4: option \"log-file\" requires an argument\n"
+                      "program: testargparse_007.conf:5: invalid line \"= value\"\n"
+                      "program: testargparse_007.conf:6: invalid line \"log file = x\"\n",
+                      arg_dstr_cstr(ds));
+
+    /* errors of the command line are not located */
+    arg_end_config(end, NULL);
+    arg_dstr_reset(ds);
+    nerrors = arg_parse(2, argv, argtable);
+    CuAssertIntEquals(tc, 1, nerrors);
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc, "program: option \"--threads\" requires an argument\n", arg_dstr_cstr(ds));
+
+    remove("testargparse_007.conf");
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argparse_basic_008(CuTest* tc) {
+    struct arg_lit* verbose = arg_litn("v", "verbose", 0, 3, "verbose");
+    struct arg_int* level = arg_int0("l", "level", "<n>", "level");
+    struct arg_str* name = arg_str0(NULL, NULL, "<name>", "name");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {verbose, level, name, end};
+    char* job0[] = {"program", "-v", "-l", "1", "alpha", NULL};
+    char* job1[] = {"program", NULL};
+    char* job2[] = {"program", "-vv", "--level=2", NULL};
+    char* job3[] = {"program", "-l", "x", NULL};
+    char* job4[] = {"program", "beta", "gamma", NULL};
+    char* job5[] = {"program", "-vvv", "delta", NULL};
+    char* job6[] = {"program", "--level", "6", NULL};
+    char** argvs[] = {job0, job1, job2, job3, job4, job5, job6};
+    int argcs[] = {5, 1, 3, 3, 3, 3, 3};
+    int nverbose[7], nlevel[7], levels[7], nname[7], nerrors[7], errors[7 * 2];
+    const char* names[7];
+    arg_column_t columns[4];
+    struct arg_int* other;
+    int nfailed;
+
+    ARG_COLUMN_COUNT(&columns[0], verbose, nverbose);
+    ARG_COLUMN(&columns[1], level, ival, 1, nlevel, levels);
+    ARG_COLUMN(&columns[2], name, sval, 1, nname, names);
+    ARG_COLUMN(&columns[3], end, error, 2, nerrors, errors);
+
+    /* more jobs than workers, so each worker parses several jobs into its own copy of the table */
+    nfailed = arg_parse_batch(argtable, 7, argcs, argvs, columns, 4, 3);
+    CuAssertIntEquals(tc, 2, nfailed);
+
+    CuAssertIntEquals(tc, 1, nverbose[0]);
+    CuAssertIntEquals(tc, 1, levels[0]);
+    CuAssertStrEquals(tc, "alpha", names[0]);
+    CuAssertIntEquals(tc, 0, nerrors[0]);
+
+    CuAssertIntEquals(tc, 0, nverbose[1]);
+    CuAssertIntEquals(tc, 0, nlevel[1]);
+    CuAssertIntEquals(tc, 0, levels[1]);
+    CuAssertIntEquals(tc, 0, nname[1]);
+    CuAssertPtrEquals(tc, NULL, (void*)names[1]);
+
+    CuAssertIntEquals(tc, 2, nverbose[2]);
+    CuAssertIntEquals(tc, 2, levels[2]);
+
+    CuAssertIntEquals(tc, 1, nerrors[3]);
+    CuAssertTrue(tc, errors[3 * 2] != 0);
+    CuAssertIntEquals(tc, 0, errors[3 * 2 + 1]);
+
+    CuAssertIntEquals(tc, 1, nerrors[4]);
+    CuAssertTrue(tc, errors[4 * 2] != 0);
+
+    CuAssertIntEquals(tc, 3, nverbose[5]);
+    CuAssertStrEquals(tc, "delta", names[5]);
+
+    CuAssertIntEquals(tc, 1, nlevel[6]);
+    CuAssertIntEquals(tc, 6, levels[6]);
+    CuAssertIntEquals(tc, 0, nerrors[6]);
+
+    /* the table itself is left alone */
+    CuAssertIntEquals(tc, 0, verbose->count);
+    CuAssertIntEquals(tc, 0, level->count);
+
+    /* parsing on the calling thread gives the same results */
+    memset(levels, 0xff, sizeof(levels));
+    nfailed = arg_parse_batch(argtable, 7, argcs, argvs, columns, 4, 0);
+    CuAssertIntEquals(tc, 2, nfailed);
+    CuAssertIntEquals(tc, 1, levels[0]);
+    CuAssertIntEquals(tc, 0, levels[1]);
+    CuAssertIntEquals(tc, 6, levels[6]);
+
+    /* a column for an argument outside the table fails before any job is parsed */
+    other = arg_int0("o", "other", "<n>", "other");
+    ARG_COLUMN(&columns[3], other, ival, 1, nlevel, levels);
+    memset(levels, 0xff, sizeof(levels));
+    nfailed = arg_parse_batch(argtable, 7, argcs, argvs, columns, 4, 3);
+    CuAssertIntEquals(tc, -1, nfailed);
+    CuAssertIntEquals(tc, -1, levels[0]);
+    CuAssertIntEquals(tc, 0, verbose->count);
+
+    arg_freetable((void**)&other, 1);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+void test_argparse_basic_009(CuTest* tc) {
+    struct arg_lit* verbose = arg_lit0("v", "verbose", "verbose");
+    struct arg_int* level = arg_int0("l", "level", "<n>", "level");
+    struct arg_str* name = arg_str1(NULL, NULL, "<name>", "name");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {verbose, level, name, end};
+    char* argv1[] = {"program", "-v", "alpha", NULL};
+    char* argv2[] = {"program", "--level=2", "beta", NULL};
+    char* argv3[] = {"program", "-l", "x", NULL};
+    arg_result_t res1;
+    arg_result_t res2;
+    struct arg_int* level1;
+    struct arg_int* level2;
+    arg_dstr_t ds = arg_dstr_create();
+
+    arg_end_envbind(end, level, "TESTARGPARSE_009_LEVEL");
+    TEST_SETENV("TESTARGPARSE_009_LEVEL", "7");
+
+    res1 = arg_result_create(argtable);
+    res2 = arg_result_create(argtable);
+    CuAssertTrue(tc, res1 != NULL);
+    CuAssertTrue(tc, res2 != NULL);
+    level1 = (struct arg_int*)arg_result_get(res1, level);
+    level2 = (struct arg_int*)arg_result_get(res2, level);
+    CuAssertTrue(tc, level1 != level && level2 != level && level1 != level2);
+    CuAssertPtrEquals(tc, NULL, arg_result_get(res1, argv1));
+
+    /* each result object keeps its own values, and the bound variable fills in the option the command line leaves out */
+    CuAssertIntEquals(tc, 0, arg_parse_result(3, argv1, res1));
+    CuAssertIntEquals(tc, 0, arg_parse_result(3, argv2, res2));
+    CuAssertIntEquals(tc, 1, ((struct arg_lit*)arg_result_get(res1, verbose))->count);
+    CuAssertIntEquals(tc, 0, ((struct arg_lit*)arg_result_get(res2, verbose))->count);
+    CuAssertIntEquals(tc, 1, level1->count);
+    CuAssertIntEquals(tc, 7, level1->ival[0]);
+    CuAssertIntEquals(tc, 2, level2->ival[0]);
+    CuAssertStrEquals(tc, "alpha", ((struct arg_str*)arg_result_get(res1, name))->sval[0]);
+    CuAssertStrEquals(tc, "beta", ((struct arg_str*)arg_result_get(res2, name))->sval[0]);
+
+    /* the table is a definition only, and can still be parsed on its own */
+    CuAssertIntEquals(tc, 0, verbose->count);
+    CuAssertIntEquals(tc, 0, level->count);
+    CuAssertIntEquals(tc, 1, arg_parse(3, argv3, argtable));
+    CuAssertIntEquals(tc, 7, level1->ival[0]);
+
+    /* errors are recorded in the result object */
+    CuAssertIntEquals(tc, 1, arg_parse_result(3, argv3, res2));
+    CuAssertIntEquals(tc, 0, level2->count);
+    CuAssertIntEquals(tc, 1, arg_result_end(res2)->count);
+    arg_print_errors_ds(ds, arg_result_end(res2), "program");
+    CuAssertStrEquals(tc, "program: invalid argument \"x\" to option -l|--level=<n>\n", arg_dstr_cstr(ds));
+
+    TEST_UNSETENV("TESTARGPARSE_009_LEVEL");
+    arg_result_destroy(res1);
+    arg_result_destroy(res2);
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+static int s_010_scans = 0;
+static arg_scanfn* s_010_scanfn = NULL;
+
+static int scan_010(void* parent, const char* argval) {
+    s_010_scans++;
+    return s_010_scanfn(parent, argval);
+}
+
+static void create_010(void** argtable) {
+    argtable[0] = arg_litn("v", "verbose", 0, 3, "verbose");
+    argtable[1] = arg_int0("l", "level", "<n>", "level");
+    argtable[2] = arg_str0(NULL, "name", "<name>", "name");
+    argtable[3] = arg_int0(NULL, NULL, "<n>", "count");
+    argtable[4] = arg_strn(NULL, NULL, "<file>", 1, 3, "files");
+    argtable[5] = arg_end(20);
+}
+
+static void dump_010(arg_dstr_t ds, void** argtable) {
+    struct arg_lit* verbose = (struct arg_lit*)argtable[0];
+    struct arg_int* level = (struct arg_int*)argtable[1];
+    struct arg_str* name = (struct arg_str*)argtable[2];
+    struct arg_int* count = (struct arg_int*)argtable[3];
+    struct arg_str* files = (struct arg_str*)argtable[4];
+    int i;
+
+    arg_dstr_reset(ds);
+    arg_dstr_catf(ds, "v=%d l=%d", verbose->count, level->count);
+    for (i = 0; i < level->count; i++)
+        arg_dstr_catf(ds, ",%d", level->ival[i]);
+    arg_dstr_catf(ds, " name=%d", name->count);
+    for (i = 0; i < name->count; i++)
+        arg_dstr_catf(ds, ",%s", name->sval[i]);
+    arg_dstr_catf(ds, " count=%d", count->count);
+    for (i = 0; i < count->count; i++)
+        arg_dstr_catf(ds, ",%d", count->ival[i]);
+    arg_dstr_catf(ds, " files=%d", files->count);
+    for (i = 0; i < files->count; i++)
+        arg_dstr_catf(ds, ",%s", files->sval[i]);
+    arg_dstr_cat(ds, "\n");
+    arg_print_errors_ds(ds, (struct arg_end*)argtable[5], "program");
+}
+
+void test_argparse_basic_010(CuTest* tc) {
+    void* argtable[6];
+    void* fulltable[6];
+    char* argv[] = {"program", "--name=bob", "-v", "-l", "1", "a", NULL};
+    struct {
+        int edit;
+        int index;
+        const char* token;
+    } edits[] = {
+        {ARG_EDIT_REPLACE, 4, "2"},       {ARG_EDIT_INSERT, 6, "b"},   {ARG_EDIT_INSERT, 5, "7"},     {ARG_EDIT_REPLACE, 1, "--name=eve"},
+        {ARG_EDIT_INSERT, 3, "-l"},       {ARG_EDIT_REMOVE, 3, NULL},  {ARG_EDIT_INSERT, 1, "--bogus"}, {ARG_EDIT_REPLACE, 1, "--"},
+        {ARG_EDIT_REMOVE, 1, NULL},       {ARG_EDIT_INSERT, 3, "c"},   {ARG_EDIT_REPLACE, 5, "x"},    {ARG_EDIT_REMOVE, 5, NULL},
+        {ARG_EDIT_REPLACE, 2, "-vvvv"},   {ARG_EDIT_REPLACE, 2, "-v"}, {ARG_EDIT_REMOVE, 6, NULL},    {ARG_EDIT_REMOVE, 5, NULL},
+        {ARG_EDIT_REMOVE, 3, NULL},       {ARG_EDIT_REPLACE, 1, "--name"},
+    };
+    int nedits = (int)(sizeof(edits) / sizeof(edits[0]));
+    arg_dstr_t ds = arg_dstr_create();
+    arg_dstr_t fullds = arg_dstr_create();
+    arg_session_t session;
+    int nerrors;
+    int i;
+
+    create_010(argtable);
+    create_010(fulltable);
+    s_010_scanfn = ((struct arg_str*)argtable[2])->hdr.scanfn;
+    ((struct arg_str*)argtable[2])->hdr.scanfn = scan_010;
+
+    session = arg_session_create(argtable);
+    CuAssertIntEquals(tc, 0, arg_session_parse(session, 6, argv));
+    CuAssertIntEquals(tc, 1, s_010_scans);
+    CuAssertIntEquals(tc, 6, arg_session_argc(session));
+
+    /* every edit gives the results of a full parse of the edited command line */
+    for (i = 0; i < nedits; i++) {
+        nerrors = arg_session_edit(session, edits[i].edit, edits[i].index, edits[i].token);
+        CuAssertIntEquals(tc, arg_parse(arg_session_argc(session), arg_session_argv(session), fulltable), nerrors);
+        dump_010(ds, argtable);
+        dump_010(fullds, fulltable);
+        CuAssertStrEquals(tc, arg_dstr_cstr(fullds), arg_dstr_cstr(ds));
+
+        /* edits that leave --name alone do not scan it again */
+        if (i == 2)
+            CuAssertIntEquals(tc, 1, s_010_scans);
+        if (i == 3)
+            CuAssertIntEquals(tc, 2, s_010_scans);
+    }
+    CuAssertTrue(tc, arg_session_argv(session)[arg_session_argc(session)] == NULL);
+
+    /* invalid edits are rejected and leave the command line alone */
+    i = arg_session_argc(session);
+    CuAssertIntEquals(tc, -1, arg_session_edit(session, ARG_EDIT_INSERT, i + 1, "x"));
+    CuAssertIntEquals(tc, -1, arg_session_edit(session, ARG_EDIT_INSERT, -1, "x"));
+    CuAssertIntEquals(tc, -1, arg_session_edit(session, ARG_EDIT_INSERT, 1, NULL));
+    CuAssertIntEquals(tc, -1, arg_session_edit(session, ARG_EDIT_REMOVE, i, NULL));
+    CuAssertIntEquals(tc, -1, arg_session_edit(session, ARG_EDIT_REPLACE, i, "x"));
+    CuAssertIntEquals(tc, -1, arg_session_edit(session, ARG_EDIT_REPLACE + 1, 1, "x"));
+    CuAssertIntEquals(tc, i, arg_session_argc(session));
+    CuAssertStrEquals(tc, "--name", arg_session_argv(session)[1]);
+
+    arg_session_destroy(session);
+    arg_dstr_destroy(ds);
+    arg_dstr_destroy(fullds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    arg_freetable(fulltable, sizeof(fulltable) / sizeof(fulltable[0]));
+}
+
+void test_argparse_basic_011(CuTest* tc) {
+    struct arg_file* input = arg_file0("i", "input", "<file>", "input file");
+    struct arg_lit* use_stdin = arg_lit0(NULL, "stdin", "read standard input");
+    struct arg_str* key = arg_str0(NULL, "key", "<file>", "private key");
+    struct arg_str* cert = arg_str0(NULL, "cert", "<file>", "certificate");
+    struct arg_str* ca = arg_str0(NULL, "ca", "<file>", "certificate authority");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {input, use_stdin, key, cert, ca, end};
+    void* sources[] = {input, use_stdin};
+    void* tls[] = {key, cert, ca};
+    void* outside[] = {input, NULL, end};
+    char* argv1[] = {"program", "-i", "a.txt", "--key=k.pem", "--cert=c.pem", "--ca=ca.pem", NULL};
+    char* argv2[] = {"program", "-i", "a.txt", "--stdin", NULL};
+    char* argv3[] = {"program", "--key=k.pem", "--ca=ca.pem", NULL};
+    char* argv4[] = {"program", "--cert=c.pem", "--stdin", NULL};
+    arg_dstr_t ds = arg_dstr_create();
+    arg_result_t result;
+
+    CuAssertIntEquals(tc, 0, arg_end_constrain(argtable, ARG_CONSTRAINT_EXCLUSIVE, sources, 2));
+    CuAssertIntEquals(tc, 0, arg_end_constrain(argtable, ARG_CONSTRAINT_ANYOF, sources, 2));
+    CuAssertIntEquals(tc, 0, arg_end_constrain(argtable, ARG_CONSTRAINT_REQUIRES, tls, 3));
+
+    /* invalid constraints are rejected rather than never firing or never being satisfied */
+    CuAssertIntEquals(tc, -1, arg_end_constrain(argtable, ARG_CONSTRAINT_ANYOF + 1, sources, 2));
+    CuAssertIntEquals(tc, -1, arg_end_constrain(argtable, ARG_CONSTRAINT_ANYOF, sources, 0));
+    CuAssertIntEquals(tc, -1, arg_end_constrain(argtable, ARG_CONSTRAINT_EXCLUSIVE, sources, 1));
+    CuAssertIntEquals(tc, -1, arg_end_constrain(argtable, ARG_CONSTRAINT_ANYOF, outside, 2));
+    CuAssertIntEquals(tc, -1, arg_end_constrain(argtable, ARG_CONSTRAINT_ANYOF, outside + 2, 1));
+
+    /* options that are not given do not need what they require */
+    CuAssertIntEquals(tc, 0, arg_parse(6, argv1, argtable));
+    CuAssertIntEquals(tc, 0, arg_parse(3, argv4, argtable));
+
+    CuAssertIntEquals(tc, 1, arg_parse(4, argv2, argtable));
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc, "program: only one of -i|--input, --stdin may be given\n", arg_dstr_cstr(ds));
+
+    /* each violated constraint is reported once */
+    arg_dstr_reset(ds);
+    CuAssertIntEquals(tc, 2, arg_parse(3, argv3, argtable));
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc,
+                      "program: one of -i|--input, --stdin is required\n"
+                      "program: option --key requires --cert, --ca\n",
+                      arg_dstr_cstr(ds));
+
+    /* the constraints go with the table into result objects */
+    result = arg_result_create(argtable);
+    CuAssertIntEquals(tc, 0, arg_parse_result(3, argv4, result));
+    CuAssertIntEquals(tc, 2, arg_parse_result(3, argv3, result));
+    CuAssertIntEquals(tc, ARG_EANYOF, arg_result_end(result)->error[0]);
+    CuAssertIntEquals(tc, ARG_EREQUIRES, arg_result_end(result)->error[1]);
+
+    arg_result_destroy(result);
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+/* A custom argument type, as written against the arg_hdr struct of older releases */
+struct test_012 {
+    struct arg_hdr hdr;
+    int count;
+};
+
+static int s_012_freed = 0;
+
+static void reset_012(void* parent) {
+    ((struct test_012*)parent)->count = 0;
+}
+
+static int scan_012(void* parent, const char* argval) {
+    (void)argval;
+    ((struct test_012*)parent)->count++;
+    return 0;
+}
+
+static void free_012(void* parent) {
+    (void)parent;
+    s_012_freed++;
+}
+
+static void* clone_012(void* parent) {
+    struct test_012* result = (struct test_012*)malloc(sizeof(struct test_012));
+    memcpy(result, parent, sizeof(struct test_012));
+    result->hdr.parent = result;
+    return result;
+}
+
+static const arg_hdr_ext_t s_012_ext = {ARG_HDR_EXT_VERSION, free_012, clone_012};
+
+static struct test_012* create_012(void* priv) {
+    struct test_012* result = (struct test_012*)malloc(sizeof(struct test_012));
+    memset(result, 0, sizeof(struct test_012));
+    result->hdr.shortopts = "x";
+    result->hdr.maxcount = 1;
+    result->hdr.parent = result;
+    result->hdr.resetfn = reset_012;
+    result->hdr.scanfn = scan_012;
+    result->hdr.priv = priv;
+    return result;
+}
+
+void test_argparse_basic_012(CuTest* tc) {
+    int own = 0;
+    struct test_012* x = create_012(&own);
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {x, end};
+    char* argv[] = {"program", "-x", NULL};
+    arg_result_t result;
+
+    /* the optional functions are kept out of arg_hdr, whose last field is still priv */
+    CuAssertIntEquals(tc, (int)sizeof(arg_hdr_t), (int)(offsetof(arg_hdr_t, priv) + sizeof(void*)));
+
+    /* without ARG_HASEXT, priv belongs to the type, and the table is parsed as before */
+    CuAssertIntEquals(tc, 0, arg_parse(2, argv, argtable));
+    CuAssertIntEquals(tc, 1, x->count);
+    CuAssertPtrEquals(tc, NULL, arg_result_create(argtable));
+    CuAssertPtrEquals(tc, &own, x->hdr.priv);
+    arg_freetable(argtable, 1);
+    CuAssertIntEquals(tc, 0, s_012_freed);
+
+    /* with it, the type can be copied into result objects and releases its memory */
+    argtable[0] = x = create_012((void*)&s_012_ext);
+    x->hdr.flag = ARG_HASEXT;
+    result = arg_result_create(argtable);
+    CuAssertTrue(tc, result != NULL);
+    CuAssertIntEquals(tc, 0, arg_parse_result(2, argv, result));
+    CuAssertIntEquals(tc, 1, ((struct test_012*)arg_result_get(result, x))->count);
+    CuAssertIntEquals(tc, 0, x->count);
+    arg_result_destroy(result);
+    CuAssertIntEquals(tc, 1, s_012_freed);
+
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    CuAssertIntEquals(tc, 2, s_012_freed);
+}
+
+void test_argparse_basic_013(CuTest* tc) {
+    struct arg_str* words = arg_strn(NULL, NULL, "<word>", 0, 20, "words");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {words, end};
+    char* argv1[] = {"program", "@testargparse_013a.rsp", "--", "@handle", "@testargparse_013b.rsp", NULL};
+    char* argv2[] = {"program", "--", "@handle", NULL};
+    char* argv3[] = {"program", "@testargparse_013c.rsp", "@testargparse_013b.rsp", NULL};
+    int nerrors;
+
+    /* a quoted or escaped '@' is literal */
+    write_file("testargparse_013a.rsp", "'@user' \\@esc \"@dq\" @testargparse_013b.rsp");
+    write_file("testargparse_013b.rsp", "b1");
+    write_file("testargparse_013c.rsp", "c1 -- @testargparse_013b.rsp");
+    arg_end_respfile(end, 1);
+
+    /* operands after "--" on the command line are not response files */
+    nerrors = arg_parse(5, argv1, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 6, words->count);
+    CuAssertStrEquals(tc, "@user", words->sval[0]);
+    CuAssertStrEquals(tc, "@esc", words->sval[1]);
+    CuAssertStrEquals(tc, "@dq", words->sval[2]);
+    CuAssertStrEquals(tc, "b1", words->sval[3]);
+    CuAssertStrEquals(tc, "@handle", words->sval[4]);
+    CuAssertStrEquals(tc, "@testargparse_013b.rsp", words->sval[5]);
+
+    nerrors = arg_parse(3, argv2, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 1, words->count);
+    CuAssertStrEquals(tc, "@handle", words->sval[0]);
+
+    /* nor after "--" in a response file, up to the end of the command line */
+    nerrors = arg_parse(3, argv3, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 3, words->count);
+    CuAssertStrEquals(tc, "c1", words->sval[0]);
+    CuAssertStrEquals(tc, "@testargparse_013b.rsp", words->sval[1]);
+    CuAssertStrEquals(tc, "@testargparse_013b.rsp", words->sval[2]);
+
+    remove("testargparse_013a.rsp");
+    remove("testargparse_013b.rsp");
+    remove("testargparse_013c.rsp");
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+CuSuite* get_argparse_testsuite() {
+    CuSuite* suite = CuSuiteNew();
+    SUITE_ADD_TEST(suite, test_argparse_basic_001);
+    SUITE_ADD_TEST(suite, test_argparse_basic_002);
+    SUITE_ADD_TEST(suite, test_argparse_basic_003);
+    SUITE_ADD_TEST(suite, test_argparse_basic_004);
+    SUITE_ADD_TEST(suite, test_argparse_basic_005);
+    SUITE_ADD_TEST(suite, test_argparse_basic_006);
+    SUITE_ADD_TEST(suite, test_argparse_basic_007);
+    SUITE_ADD_TEST(suite, test_argparse_basic_008);
+    SUITE_ADD_TEST(suite, test_argparse_basic_009);
+    SUITE_ADD_TEST(suite, test_argparse_basic_010);
+    SUITE_ADD_TEST(suite, test_argparse_basic_011);
+    SUITE_ADD_TEST(suite, test_argparse_basic_012);
+    SUITE_ADD_TEST(suite, test_argparse_basic_013);
+    return suite;
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
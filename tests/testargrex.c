@@ -279,6 +279,49 @@ void test_argrex_basic_010(CuTest* tc) {
     arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
 }
 
+void test_argrex_basic_011(CuTest* tc) {
+    struct arg_rex* a = arg_rexn(NULL, "img", "^img-[0-9]+\\.raw$", NULL, 0, 10, 0, "blah blah");
+    struct arg_rex* b = arg_rexn(NULL, "mail", "[a-z]+@[a-z]+\\.com", NULL, 0, 10, 0, "blah blah");
+    struct arg_rex* c = arg_rexn(NULL, "pair", "(ab|cd)x{2}", NULL, 0, 10, 0, "blah blah");
+    struct arg_rex* d = arg_rexn(NULL, "opt", "a?b", NULL, 0, 10, 0, "blah blah");
+    struct arg_rex* e = arg_rexn(NULL, "icase", "^IMG-[0-9]+$", NULL, 0, 10, ARG_REX_ICASE, "blah blah");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, b, c, d, e, end};
+    arg_result_t result;
+    struct arg_rex* ra;
+    int nerrors;
+
+    char* good[] = {"program", "--img=img-42.raw", "--mail=bob@example.com", "--pair=abxx", "--pair=cdxx", "--opt=b", "--opt=ab", "--icase=img-7", NULL};
+    char* bad[] = {"program",      "--img=img-.raw", "--img=image.raw", "--img=img-42.raw.bak", "--img=img-42.RAW", "--mail=bob.example.com", "--mail=bob@x.org",
+                   "--mail=@example.com", "--pair=abx",     "--pair=cdyy",     "--opt=a",              "--icase=IMG-x",    NULL};
+    int ngood = sizeof(good) / sizeof(char*) - 1;
+    int nbad = sizeof(bad) / sizeof(char*) - 1;
+
+    /* values with the literals of a pattern still have to match it in full */
+    nerrors = arg_parse(ngood, good, argtable);
+    CuAssertIntEquals(tc, 0, nerrors);
+    CuAssertIntEquals(tc, 1, a->count);
+    CuAssertIntEquals(tc, 1, b->count);
+    CuAssertIntEquals(tc, 2, c->count);
+    CuAssertIntEquals(tc, 2, d->count);
+    CuAssertIntEquals(tc, 1, e->count);
+
+    nerrors = arg_parse(nbad, bad, argtable);
+    CuAssertIntEquals(tc, nbad - 1, nerrors);
+    CuAssertIntEquals(tc, 0, a->count + b->count + c->count + d->count + e->count);
+
+    /* clones keep the literals of the table they are cloned from */
+    result = arg_result_create(argtable);
+    CuAssertIntEquals(tc, 1, arg_parse_result(2, bad, result));
+    CuAssertIntEquals(tc, 0, arg_parse_result(2, good, result));
+    ra = (struct arg_rex*)arg_result_get(result, a);
+    CuAssertIntEquals(tc, 1, ra->count);
+    CuAssertStrEquals(tc, "img-42.raw", ra->sval[0]);
+
+    arg_result_destroy(result);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
 CuSuite* get_argrex_testsuite() {
     CuSuite* suite = CuSuiteNew();
     SUITE_ADD_TEST(suite, test_argrex_basic_001);
@@ -291,6 +334,7 @@ CuSuite* get_argrex_testsuite() {
     SUITE_ADD_TEST(suite, test_argrex_basic_008);
     SUITE_ADD_TEST(suite, test_argrex_basic_009);
     SUITE_ADD_TEST(suite, test_argrex_basic_010);
+    SUITE_ADD_TEST(suite, test_argrex_basic_011);
     return suite;
 }
 
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * This file is part of the argtable3 library.
+ *
+ * Copyright (C) 2013-2025 Tom G. Huang
+ * <tomghuang@gmail.com>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of STEWART HEITMANN nor the  names of its contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL STEWART HEITMANN BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "CuTest.h"
+#include "argtable3.h"
+#include "argtable3_private.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4204)
+#endif
+
+void test_argsize_basic_001(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        uint64_t value;
+    } cases[] = {
+        {"--x=0", 0},
+        {"--x=512", 512},
+        {"--x= +512B ", 512},
+        {"--x=10kB", 10000},
+        {"--x=10KB", 10000},
+        {"--x=3MB", 3000000},
+        {"--x=2GB", (uint64_t)2000000000},
+        {"--x=1kib", 1024},
+        {"--x=64MiB", (uint64_t)64 << 20},
+        {"--x=5GiB", (uint64_t)5 << 30},
+        {"--x=7TiB", (uint64_t)7 << 40},
+        {"--x=1PB", (uint64_t)1000000000 * 1000000},
+        {"--x=15EiB", (uint64_t)15 << 60},
+        {"--x=18EB", ((uint64_t)0xF9CCD8A1u << 32) | 0xC5080000u}, /* 18 * 10^18, C89 has no 64-bit integer literals */
+        {"--x=18446744073709551615", ~(uint64_t)0},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_size* x = arg_size1(NULL, "x", NULL, "x is <size>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, x->count);
+        CuAssert(tc, cases[i].arg, x->bytes[0] == cases[i].value);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argsize_basic_002(CuTest* tc) {
+    static const struct {
+        const char* arg;
+        int error;
+    } cases[] = {
+        {"--x=18446744073709551616", ARG_ERR_OVERFLOW},
+        {"--x=16EiB", ARG_ERR_OVERFLOW},
+        {"--x=19EB", ARG_ERR_OVERFLOW},
+        {"--x= ", ARG_ERR_BADINT},
+        {"--x=-1", ARG_ERR_BADINT},
+        {"--x=KiB", ARG_ERR_BADINT},
+        {"--x=1K", ARG_ERR_BADINT},
+        {"--x=1Ki", ARG_ERR_BADINT},
+        {"--x=1iB", ARG_ERR_BADINT},
+        {"--x=1 KiB", ARG_ERR_BADINT},
+        {"--x=1KiBx", ARG_ERR_BADINT},
+        {"--x=1.5GiB", ARG_ERR_BADINT},
+        {"--x=1ZB", ARG_ERR_BADINT},
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        struct arg_size* x = arg_size0(NULL, "x", NULL, "x is <size>");
+        struct arg_end* end = arg_end(20);
+        void* argtable[] = {x, end};
+        char* argv[] = {"program", NULL, NULL};
+        int nerrors;
+
+        argv[1] = (char*)cases[i].arg;
+        nerrors = arg_parse(2, argv, argtable);
+
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 1, nerrors);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, 0, x->count);
+        CuAssertIntEquals_Msg(tc, cases[i].arg, cases[i].error, end->error[0]);
+
+        arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+    }
+}
+
+void test_argsize_basic_003(CuTest* tc) {
+    struct arg_size* a = arg_sizen("s", "size", NULL, 1, 2, "a size");
+    struct arg_end* end = arg_end(20);
+    void* argtable[] = {a, end};
+    char* argv[] = {"program", "-s", "1KiB", "--size=100zz", NULL};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    arg_dstr_t ds = arg_dstr_create();
+    int nerrors;
+
+    CuAssertStrEquals(tc, "<size>", a->hdr.datatype);
+    CuAssertTrue(tc, ((size_t)a->bytes % sizeof(uint64_t)) == 0);
+
+    nerrors = arg_parse(argc, argv, argtable);
+    CuAssertIntEquals(tc, 1, nerrors);
+    CuAssertIntEquals(tc, 1, a->count);
+    CuAssertTrue(tc, a->bytes[0] == 1024);
+
+    arg_print_errors_ds(ds, end, "program");
+    CuAssertStrEquals(tc, "program: invalid argument \"100zz\" to option -s|--size=<size>\n", arg_dstr_cstr(ds));
+
+    arg_dstr_destroy(ds);
+    arg_freetable(argtable, sizeof(argtable) / sizeof(argtable[0]));
+}
+
+CuSuite* get_argsize_testsuite() {
+    CuSuite* suite = CuSuiteNew();
+    SUITE_ADD_TEST(suite, test_argsize_basic_001);
+    SUITE_ADD_TEST(suite, test_argsize_basic_002);
+    SUITE_ADD_TEST(suite, test_argsize_basic_003);
+    return suite;
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif